@@ -1,27 +1,31 @@
 // Copyright (c) 2009-2023 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
-// Include the defined classes that are to be exported to python
-#include "EvaluatorPairExample.h"
-
-#include "hoomd/md/PotentialPair.h"
 #include <pybind11/pybind11.h>
-#ifdef ENABLE_HIP
-#include "hoomd/md/PotentialPairGPU.h"
-#endif
 
 namespace hoomd
     {
 namespace md
     {
+namespace detail
+    {
+
+// Export functions are generated by CMake from the export_PotentialPair*.cc.inc templates, one
+// pair of compilation units per evaluator listed in CMakeLists.txt.
+void export_PotentialPairExample(pybind11::module& m);
+#ifdef ENABLE_HIP
+void export_PotentialPairExampleGPU(pybind11::module& m);
+#endif
+
+    } // end namespace detail
 
 // specify the python module. Note that the name must explicitly match the PROJECT() name provided
 // in CMakeLists (with an underscore in front)
 PYBIND11_MODULE(_pair_plugin, m)
     {
-    detail::export_PotentialPair<EvaluatorPairExample>(m, "PotentialPairExample");
+    detail::export_PotentialPairExample(m);
 #ifdef ENABLE_HIP
-    detail::export_PotentialPairGPU<EvaluatorPairExample>(m, "PotentialPairExampleGPU");
+    detail::export_PotentialPairExampleGPU(m);
 #endif
     }
 
@@ -67,6 +67,17 @@ ExampleUpdaterGPU::ExampleUpdaterGPU(std::shared_ptr<SystemDefinition> sysdef,
                                      std::shared_ptr<Trigger> trigger)
     : ExampleUpdater(sysdef, trigger)
     {
+    // this kernel writes only the velocity array: give it a private blocking stream so it
+    // can overlap with independent built-in kernels (for example the force computes, which
+    // read positions and write their own output arrays) instead of serializing on the
+    // default stream; blocking-stream semantics keep it ordered against default-stream
+    // kernels that touch the velocities
+    hipStreamCreate(&m_stream);
+    }
+
+ExampleUpdaterGPU::~ExampleUpdaterGPU()
+    {
+    hipStreamDestroy(m_stream);
     }
 
 /*! Perform the needed calculations to zero the system's velocity
@@ -81,8 +92,11 @@ void ExampleUpdaterGPU::update(uint64_t timestep)
                                access_location::device,
                                access_mode::readwrite);
 
-    // call the kernel defined in ExampleUpdater.cu
-    kernel::gpu_zero_velocities(d_vel.data, m_pdata->getN());
+    // call the kernel defined in ExampleUpdater.cu; multi-GPU partitions keep the default
+    // stream, as the built-in computes do
+    kernel::gpu_zero_velocities(d_vel.data,
+                                m_pdata->getN(),
+                                m_exec_conf->getNumActiveGPUs() == 1 ? m_stream : 0);
 
     // check for error codes from the GPU if error checking is enabled
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
@@ -38,9 +38,10 @@ __global__ void gpu_zero_velocities_kernel(Scalar4* d_vel, unsigned int N)
 
 /*! \param d_vel Velocity-mass array from the ParticleData
     \param N Number of particles
+    \param stream Stream to launch the kernel on (0 for the default stream)
     This is just a driver for gpu_zero_velocities_kernel(), see it for the details
 */
-hipError_t gpu_zero_velocities(Scalar4* d_vel, unsigned int N)
+hipError_t gpu_zero_velocities(Scalar4* d_vel, unsigned int N, hipStream_t stream)
     {
     // setup the grid to run the kernel
     int block_size = 256;
@@ -51,8 +52,9 @@ hipError_t gpu_zero_velocities(Scalar4* d_vel, unsigned int N)
         }
     dim3 threads(block_size, 1, 1);
 
-    // run the kernel
-    hipLaunchKernelGGL(gpu_zero_velocities_kernel, dim3(grid), dim3(threads), 0, 0, d_vel, N);
+    // run the kernel on the requested stream so that it may overlap with independent
+    // kernels launched on other streams
+    hipLaunchKernelGGL(gpu_zero_velocities_kernel, dim3(grid), dim3(threads), 0, stream, d_vel, N);
 
     // this method always succeeds. If you had a cuda* call in this driver, you could return its
     // error code if not hipSuccess
@@ -16,7 +16,7 @@ namespace hoomd
 namespace kernel
     {
 //! Zeros velocities on the GPU
-hipError_t gpu_zero_velocities(Scalar4* d_vel, unsigned int N);
+hipError_t gpu_zero_velocities(Scalar4* d_vel, unsigned int N, hipStream_t stream);
 
     } // end namespace kernel
     } // end namespace hoomd
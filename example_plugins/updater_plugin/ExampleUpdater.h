@@ -60,6 +60,15 @@ void export_ExampleUpdater(pybind11::module& m);
 //! code
 /*! This updater simply sets all of the particle's velocities to 0 (on the GPU) when update() is
  * called.
+ *
+ * It also demonstrates how a plugin kernel can overlap with the built-in kernels. HOOMD's small
+ * GPU computes each launch on a private *blocking* stream: two kernels on different blocking
+ * streams may execute concurrently, while both stay ordered against everything launched on the
+ * default stream. Whether a kernel may share a stream tier with others follows from its read and
+ * write sets — kernels are independent when neither writes an array the other touches. This
+ * kernel writes only the velocities, so it can overlap e.g. the force kernels (which read
+ * positions and write their own force arrays), but the blocking-stream semantics automatically
+ * serialize it against integration kernels on the default stream that read and write velocities.
  */
 class ExampleUpdaterGPU : public ExampleUpdater
     {
@@ -67,8 +76,14 @@ class ExampleUpdaterGPU : public ExampleUpdater
     //! Constructor
     ExampleUpdaterGPU(std::shared_ptr<SystemDefinition> sysdef, std::shared_ptr<Trigger> trigger);
 
+    //! Destructor
+    virtual ~ExampleUpdaterGPU();
+
     //! Take one timestep forward
     virtual void update(uint64_t timestep);
+
+    protected:
+    hipStream_t m_stream = 0; //!< Private launch stream so the kernel can overlap
     };
 
 namespace detail
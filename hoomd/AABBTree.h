@@ -155,6 +155,12 @@ class PYBIND11_EXPORT AABBTree
     //! Build a tree smartly from a list of AABBs
     inline void buildTree(AABB* aabbs, unsigned int N);
 
+    //! Recompute all node AABBs from a list of particle AABBs without changing the topology
+    inline void refit(const AABB* aabbs);
+
+    //! Get the sum of the surface areas of all node AABBs
+    inline Scalar getTotalSurfaceArea() const;
+
     //! Find all particles that overlap with the query AABB
     inline unsigned int query(std::vector<unsigned int>& hits, const AABB& aabb) const;
 
@@ -393,6 +399,57 @@ inline void AABBTree::buildTree(AABB* aabbs, unsigned int N)
     updateSkip(m_root);
     }
 
+/*! \param aabbs List of AABBs for each particle, indexed as at build time
+
+    Recomputes every node AABB bottom-up while leaving the tree topology, particle assignments,
+    and skip values untouched. Because buildNode() always allocates a parent before its children,
+    iterating the node array in reverse guarantees both children are refit before their parent.
+    Unlike update(), which only grows boxes, refit() recomputes them exactly, so the tree stays
+    tight; only the quality of the build-time partitioning degrades as particles move. Use
+    getTotalSurfaceArea() to detect when the degradation warrants a full rebuild.
+
+    The caller must pass AABBs in the same index order used for the last buildTree() call.
+*/
+inline void AABBTree::refit(const AABB* aabbs)
+    {
+    for (unsigned int i = m_num_nodes; i-- > 0;)
+        {
+        AABBNode& node = m_nodes[i];
+        if (node.left == INVALID_NODE)
+            {
+            // leaf: recompute the bound of the contained particles
+            AABB my_aabb = aabbs[node.particles[0]];
+            for (unsigned int j = 1; j < node.num_particles; j++)
+                {
+                my_aabb = merge(my_aabb, aabbs[node.particles[j]]);
+                }
+            node.aabb = my_aabb;
+            }
+        else
+            {
+            // internal node: both children have already been refit
+            node.aabb = merge(m_nodes[node.left].aabb, m_nodes[node.right].aabb);
+            }
+        }
+    }
+
+/*! \returns The sum of the surface areas of all node AABBs
+
+    The total node surface area is proportional to the expected number of box overlap tests a
+    query performs, so the ratio of the current value to the value at build time measures how far
+    the tree quality has degraded since the topology was last rebuilt.
+*/
+inline Scalar AABBTree::getTotalSurfaceArea() const
+    {
+    Scalar total(0.0);
+    for (unsigned int i = 0; i < m_num_nodes; i++)
+        {
+        vec3<Scalar> d = m_nodes[i].aabb.getUpper() - m_nodes[i].aabb.getLower();
+        total += Scalar(2.0) * (d.x * d.y + d.x * d.z + d.y * d.z);
+        }
+    return total;
+    }
+
 /*! \param aabbs List of AABBs
     \param idx List of indices
     \param start Start point in aabbs and idx to examine
@@ -14,6 +14,8 @@ void export_Autotuned(pybind11::module& m)
         .def(pybind11::init<>())
         .def("getAutotunerParameters", &Autotuned::getAutotunerParameters)
         .def("setAutotunerParameters", &Autotuned::setAutotunerParameters)
+        .def("getAutotunerStatistics", &Autotuned::getAutotunerStatistics)
+        .def("setAutotunerMeasurementsEnabled", &Autotuned::setAutotunerMeasurementsEnabled)
         .def("startAutotuning", &Autotuned::startAutotuning)
         .def("isAutotuningComplete", &Autotuned::isAutotuningComplete);
     }
@@ -63,6 +63,27 @@ class PYBIND11_EXPORT Autotuned
             }
         }
 
+    /// Get kernel timing statistics for all autotuners.
+    pybind11::dict getAutotunerStatistics()
+        {
+        pybind11::dict stats;
+
+        for (const auto& tuner : m_autotuners)
+            {
+            stats[tuner->getName().c_str()] = tuner->getStatisticsPython();
+            }
+        return stats;
+        }
+
+    /// Enable or disable post-tuning kernel timing measurements for all autotuners.
+    void setAutotunerMeasurementsEnabled(bool enable)
+        {
+        for (const auto& tuner : m_autotuners)
+            {
+            tuner->setMeasurementsEnabled(enable);
+            }
+        }
+
     /// Start an autotuning sequence.
     virtual void startAutotuning()
         {
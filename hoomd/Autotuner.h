@@ -77,8 +77,17 @@ class PYBIND11_EXPORT AutotunerBase
 
     /// Set autother parameters from a Python tuple.
     virtual void setParameterPython(pybind11::tuple parameter) {};
+
+    /// Get kernel timing statistics as a Python dict.
+    virtual pybind11::dict getStatisticsPython()
+        {
+        return pybind11::dict();
+        }
 #endif
 
+    /// Enable or disable timing measurements after tuning completes.
+    virtual void setMeasurementsEnabled(bool enable) { }
+
 #ifdef ENABLE_HIP
     /// Build a block size range that steps on the warp size.
     static std::vector<unsigned int>
@@ -216,8 +225,9 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
             }
 
 #ifdef ENABLE_HIP
-        // if we are scanning, record a cuda event - otherwise do nothing
-        if (m_state == SCANNING)
+        // if we are scanning (or measuring while idle), record a cuda event - otherwise do
+        // nothing
+        if (m_state == SCANNING || (m_state == IDLE && m_measure))
             {
             hipEventRecord(m_start, 0);
             if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
@@ -288,6 +298,57 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
                                     << formatParam(cpp_param) << std::endl;
         }
 
+    /// Get kernel timing statistics as a Python dict.
+    /*! Reports the center (median, average, or maximum per the sampling mode) time of the optimal
+        parameter at the completion of the last scan as the tuning baseline. When post-tuning
+        measurements are enabled (setMeasurementsEnabled), also reports summary statistics over a
+        rolling window of recent kernel launches so that callers can compare production timings
+        against the baseline.
+    */
+    virtual pybind11::dict getStatisticsPython()
+        {
+        pybind11::dict stats;
+        stats["tuned_time"] = m_tuned_time;
+        stats["n_samples"] = m_measured_count;
+
+        if (m_measured_count > 0)
+            {
+            std::vector<float> v(m_measured_samples.begin(),
+                                 m_measured_samples.begin() + m_measured_count);
+
+            float sum = 0.0f;
+            float minimum = v[0];
+            float maximum = v[0];
+            for (float t : v)
+                {
+                sum += t;
+                minimum = std::min(minimum, t);
+                maximum = std::max(maximum, t);
+                }
+
+            size_t n = v.size() / 2;
+            nth_element(v.begin(), v.begin() + n, v.end());
+
+            stats["mean"] = sum / float(v.size());
+            stats["median"] = v[n];
+            stats["minimum"] = minimum;
+            stats["maximum"] = maximum;
+            }
+        return stats;
+        }
+
+    /// Enable or disable timing measurements after tuning completes.
+    /*! \param enable When true, continue to time kernel launches with CUDA events after tuning
+        completes and retain a rolling window of the most recent samples. Defaults to off because
+        every measured launch requires an event synchronization.
+    */
+    virtual void setMeasurementsEnabled(bool enable)
+        {
+        m_measure = enable;
+        m_measured_count = 0;
+        m_measured_head = 0;
+        }
+
     static std::string formatParam(const std::array<unsigned int, n_dimensions>& p)
         {
         std::ostringstream s;
@@ -391,6 +452,24 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
     /// True when this is an optional tuner.
     bool m_optional;
 
+    /// Center time of the optimal parameter at the completion of the last scan.
+    float m_tuned_time;
+
+    /// Measure kernel times after tuning completes when true.
+    bool m_measure;
+
+    /// Rolling window of post-tuning kernel times.
+    std::vector<float> m_measured_samples;
+
+    /// Index of the next slot to fill in m_measured_samples.
+    size_t m_measured_head;
+
+    /// Number of valid entries in m_measured_samples.
+    size_t m_measured_count;
+
+    /// Capacity of the rolling measurement window.
+    static constexpr size_t measurement_window_size = 100;
+
     /// Helper method to initialize multi-dimensional arrays recursively.
     void initializeParameters(
         const std::vector<std::vector<unsigned int>>& dimension_ranges,
@@ -440,8 +519,10 @@ Autotuner<n_dimensions>::Autotuner(
     bool optional,
     std::function<bool(const std::array<unsigned int, n_dimensions>&)> is_parameter_valid)
     : AutotunerBase(name), m_n_samples(n_samples), m_exec_conf(exec_conf), m_sync(false),
-      m_mode(mode_median), m_optional(optional)
+      m_mode(mode_median), m_optional(optional), m_tuned_time(0.0f), m_measure(false),
+      m_measured_head(0), m_measured_count(0)
     {
+    m_measured_samples.resize(measurement_window_size);
     m_exec_conf->msg->notice(5) << "Constructing Autotuner " << name << " with " << n_samples
                                 << " samples." << std::endl;
 
@@ -516,6 +597,18 @@ template<size_t n_dimensions> void Autotuner<n_dimensions>::end()
             << m_current_sample << "] = " << m_samples[m_current_element][m_current_sample]
             << std::endl;
 
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+    else if (m_state == IDLE && m_measure)
+        {
+        // record the production kernel time into the rolling window
+        hipEventRecord(m_stop, 0);
+        hipEventSynchronize(m_stop);
+        hipEventElapsedTime(&m_measured_samples[m_measured_head], m_start, m_stop);
+        m_measured_head = (m_measured_head + 1) % measurement_window_size;
+        m_measured_count = std::min(m_measured_count + 1, measurement_window_size);
+
         if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
         }
@@ -657,9 +750,16 @@ template<size_t n_dimensions> size_t Autotuner<n_dimensions>::computeOptimalPara
             << "%." << std::endl;
         }
 
+    // Record the baseline time for the optimal parameter.
+    if (is_root)
+        m_tuned_time = m_sample_center[min_idx];
+
 #ifdef ENABLE_MPI
     if (m_sync && nranks)
+        {
         bcast(min_idx, 0, m_exec_conf->getMPICommunicator());
+        bcast(m_tuned_time, 0, m_exec_conf->getMPICommunicator());
+        }
 #endif
     return min_idx;
     }
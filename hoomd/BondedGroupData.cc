@@ -182,6 +182,15 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::initialize()
     GPUVector<unsigned int> n_groups(m_exec_conf);
     m_gpu_n_groups.swap(n_groups);
 
+    // host CSR lookup table
+    GPUVector<unsigned int> csr_row_offset(m_exec_conf);
+    m_csr_row_offset.swap(csr_row_offset);
+
+    GPUVector<unsigned int> csr_group_idx(m_exec_conf);
+    m_csr_group_idx.swap(csr_group_idx);
+
+    m_csr_dirty = true;
+
 #ifdef ENABLE_MPI
     if (m_pdata->getDomainDecomposition())
         {
@@ -880,6 +889,83 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::rebuildGPUTable
         }
     }
 
+template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
+void BondedGroupData<group_size, Group, name, has_type_mapping>::rebuildCSRTable()
+    {
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
+                                     access_location::host,
+                                     access_mode::read);
+
+    unsigned int N = m_pdata->getN() + m_pdata->getNGhosts();
+    unsigned int ngroups_tot = m_n_groups + m_n_ghost;
+
+    m_csr_row_offset.resize(N + 1);
+    m_csr_group_idx.resize(ngroups_tot * group_size);
+
+    ArrayHandle<unsigned int> h_row_offset(m_csr_row_offset,
+                                           access_location::host,
+                                           access_mode::overwrite);
+    ArrayHandle<unsigned int> h_group_idx(m_csr_group_idx,
+                                          access_location::host,
+                                          access_mode::overwrite);
+
+    // count the number of bonded groups per particle
+    memset(h_row_offset.data, 0, sizeof(unsigned int) * (N + 1));
+
+    for (unsigned int cur_group = 0; cur_group < ngroups_tot; cur_group++)
+        {
+        members_t g = m_groups[cur_group];
+        for (unsigned int i = 0; i < group_size; ++i)
+            {
+            unsigned int idx = h_rtag.data[g.tag[i]];
+
+            if (idx == NOT_LOCAL)
+                {
+                // incomplete group
+                std::ostringstream oss;
+                oss << name << " ";
+                for (unsigned int k = 0; k < group_size; ++k)
+                    oss << g.tag[k] << ((k != group_size - 1) ? ", " : " ");
+                oss << "incomplete!";
+                throw std::runtime_error(oss.str());
+                }
+
+            // insert each group only once per particle, even when a member is
+            // duplicated within the group (as in border mesh bonds)
+            bool duplicate = false;
+            for (unsigned int j = 0; j < i; ++j)
+                duplicate |= (g.tag[j] == g.tag[i]);
+            if (duplicate)
+                continue;
+
+            h_row_offset.data[idx + 1]++;
+            }
+        }
+
+    // turn the per-particle counts into row offsets with a prefix sum
+    for (unsigned int i = 0; i < N; ++i)
+        h_row_offset.data[i + 1] += h_row_offset.data[i];
+
+    // fill the rows, using a copy of the offsets as write cursors
+    std::vector<unsigned int> cursor(h_row_offset.data, h_row_offset.data + N);
+
+    for (unsigned int cur_group = 0; cur_group < ngroups_tot; cur_group++)
+        {
+        members_t g = m_groups[cur_group];
+        for (unsigned int i = 0; i < group_size; ++i)
+            {
+            bool duplicate = false;
+            for (unsigned int j = 0; j < i; ++j)
+                duplicate |= (g.tag[j] == g.tag[i]);
+            if (duplicate)
+                continue;
+
+            unsigned int idx = h_rtag.data[g.tag[i]];
+            h_group_idx.data[cursor[idx]++] = cur_group;
+            }
+        }
+    }
+
 #ifdef ENABLE_HIP
 template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
 void BondedGroupData<group_size, Group, name, has_type_mapping>::rebuildGPUTableGPU()
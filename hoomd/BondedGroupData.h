@@ -585,6 +585,42 @@ class BondedGroupData
         return m_gpu_n_groups;
         }
 
+    /*
+     * Host CSR group table
+     */
+
+    //! Return CSR row offsets of the host lookup-by-particle table
+    /*! The table has getN() + getNGhosts() + 1 entries. The local group indices of the
+        groups that particle \a idx participates in occupy entries
+        [offset[idx], offset[idx+1]) of the packed index array, so a host loop over the
+        groups of a contiguous range of particles makes sequential memory accesses and
+        rows can be partitioned between threads without write conflicts.
+    */
+    const GPUVector<unsigned int>& getCSRRowOffsets()
+        {
+        // rebuild lookup table if necessary
+        if (m_csr_dirty)
+            {
+            rebuildCSRTable();
+            m_csr_dirty = false;
+            }
+
+        return m_csr_row_offset;
+        }
+
+    //! Return the packed local group indices of the host CSR table
+    const GPUVector<unsigned int>& getCSRGroupIndices()
+        {
+        // rebuild lookup table if necessary
+        if (m_csr_dirty)
+            {
+            rebuildCSRTable();
+            m_csr_dirty = false;
+            }
+
+        return m_csr_group_idx;
+        }
+
     /*
      * add/remove groups globally
      */
@@ -616,6 +652,7 @@ class BondedGroupData
         {
         // set flag to trigger rebuild of GPU table
         m_groups_dirty = true;
+        m_csr_dirty = true;
 
         // notify subscribers
         m_group_reorder_signal.emit();
@@ -625,6 +662,7 @@ class BondedGroupData
     void setDirty()
         {
         m_groups_dirty = true;
+        m_csr_dirty = true;
         }
 
 #ifdef ENABLE_MPI
@@ -650,6 +688,8 @@ class BondedGroupData
     GPUVector<unsigned int> m_gpu_pos_table; //!< Position of particle idx in group table
     Index2D m_gpu_table_indexer;             //!< Indexer for GPU table
     GPUVector<unsigned int> m_gpu_n_groups;  //!< Number of entries in lookup table per particle
+    GPUVector<unsigned int> m_csr_row_offset; //!< CSR row offsets by particle index (host)
+    GPUVector<unsigned int> m_csr_group_idx;  //!< CSR packed local group indices (host)
     std::vector<std::string> m_type_mapping; //!< Mapping of types of bonded groups
 
     unsigned int m_n_groups; //!< Number of local groups
@@ -683,6 +723,7 @@ class BondedGroupData
 #endif
     private:
     bool m_groups_dirty; //!< Check if it is necessary to rebuild the lookup-by-index table
+    bool m_csr_dirty = true; //!< Check if it is necessary to rebuild the host CSR table
 
     Nano::Signal<void()> m_group_reorder_signal; //!< Signal that is triggered when groups are added
                                                  //!< or deleted locally
@@ -693,6 +734,9 @@ class BondedGroupData
     //! Helper function to rebuild lookup by index table
     virtual void rebuildGPUTable();
 
+    //! Helper function to rebuild the host CSR lookup table
+    void rebuildCSRTable();
+
     //! Resize internal tables
     /*! \param new_size New size of local group tables, new_size = n_local + n_ghost
      */
@@ -1096,11 +1140,12 @@ template<class Output, class GroupData>
 class LocalGroupData : public GhostLocalDataAccess<Output, GroupData>
     {
     public:
-    LocalGroupData(GroupData& data)
+    LocalGroupData(GroupData& data, bool force_read_only = false)
         : GhostLocalDataAccess<Output, GroupData>(data,
                                                   data.getN(),
                                                   data.getNGhosts(),
-                                                  data.getNGlobal()),
+                                                  data.getNGlobal(),
+                                                  force_read_only),
           m_tags_handle(nullptr), m_rtags_handle(nullptr), m_members_handle(nullptr),
           m_typeval_handle(nullptr)
         {
@@ -1164,7 +1209,9 @@ template<class Output, class Data> void export_LocalGroupData(pybind11::module&
     pybind11::class_<LocalGroupData<Output, Data>, std::shared_ptr<LocalGroupData<Output, Data>>>(
         m,
         name.c_str())
-        .def(pybind11::init<Data&>())
+        .def(pybind11::init<Data&, bool>(),
+             pybind11::arg("data"),
+             pybind11::arg("force_read_only") = false)
         .def("getTags", &LocalGroupData<Output, Data>::getTags)
         .def("getRTags", &LocalGroupData<Output, Data>::getRTags)
         .def("getTypeVal", &LocalGroupData<Output, Data>::getTypeVal)
@@ -300,11 +300,41 @@ struct
     */
     HOSTDEVICE Scalar3 minImage(const Scalar3& v) const
         {
+        return minImage(v, m_periodic.x, m_periodic.y, m_periodic.z);
+        }
+
+    //! Compute minimum image with compile-time periodicity
+    /*! \tparam periodic_x True when the box is periodic along x
+        \tparam periodic_y True when the box is periodic along y
+        \tparam periodic_z True when the box is periodic along z
+        \param v Vector to compute
+        \return a vector that is the minimum image vector of \a v
+
+        Inner loops that check getPeriodic() once outside the loop can instantiate this
+        variant to drop the three per-axis periodicity tests from every pair evaluation.
+        Most simulations are fully periodic; slab geometries instantiate the matching
+        combination instead.
+    */
+    template<bool periodic_x, bool periodic_y, bool periodic_z>
+    HOSTDEVICE Scalar3 minImage(const Scalar3& v) const
+        {
+        return minImage(v, periodic_x, periodic_y, periodic_z);
+        }
+
+    //! Minimum image implementation shared by the runtime and compile-time variants
+    /*! Both public variants inline this body; when the flags arrive as compile-time
+        constants the per-axis tests fold away.
+    */
+    HOSTDEVICE Scalar3 minImage(const Scalar3& v,
+                                const bool periodic_x,
+                                const bool periodic_y,
+                                const bool periodic_z) const
+        {
         Scalar3 w = v;
         Scalar3 L = getL();
 
 #ifdef __HIPCC__
-        if (m_periodic.z)
+        if (periodic_z)
             {
             Scalar img = slow::rint(w.z * m_Linv.z);
             w.z -= L.z * img;
@@ -312,20 +342,20 @@ struct
             w.x -= L.z * m_xz * img;
             }
 
-        if (m_periodic.y)
+        if (periodic_y)
             {
             Scalar img = slow::rint(w.y * m_Linv.y);
             w.y -= L.y * img;
             w.x -= L.y * m_xy * img;
             }
 
-        if (m_periodic.x)
+        if (periodic_x)
             {
             w.x -= L.x * slow::rint(w.x * m_Linv.x);
             }
 #else
         // on the cpu, branches are faster than calling rint
-        if (m_periodic.z)
+        if (periodic_z)
             {
             if (w.z >= m_hi.z)
                 {
@@ -341,7 +371,7 @@ struct
                 }
             }
 
-        if (m_periodic.y)
+        if (periodic_y)
             {
             if (w.y >= m_hi.y)
                 {
@@ -357,7 +387,7 @@ struct
                 }
             }
 
-        if (m_periodic.x)
+        if (periodic_x)
             {
             if (w.x >= m_hi.x)
                 {
@@ -32,12 +32,9 @@ BoxResizeUpdaterGPU::BoxResizeUpdaterGPU(std::shared_ptr<SystemDefinition> sysde
         throw std::runtime_error("Cannot initialize BoxResizeUpdaterGPU on a CPU device.");
         }
 
-    m_tuner_scale.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
-                                         m_exec_conf,
-                                         "box_resize_scale"));
-    m_tuner_wrap.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
-                                        m_exec_conf,
-                                        "box_resize_wrap"));
+    m_tuner_scale_wrap.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                              m_exec_conf,
+                                              "box_resize_scale_wrap"));
     }
 
 BoxResizeUpdaterGPU::~BoxResizeUpdaterGPU()
@@ -46,6 +43,10 @@ BoxResizeUpdaterGPU::~BoxResizeUpdaterGPU()
     }
 
 /// Scale particles to the new box and wrap any others back into the box
+/*! The scale and wrap passes run as one fused kernel keyed off the group membership flags,
+    so compression runs that resize every step make a single pass over the position array
+    per update with no host synchronization.
+*/
 void BoxResizeUpdaterGPU::scaleAndWrapParticles(const BoxDim& cur_box, const BoxDim& new_box)
     {
     ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
@@ -56,26 +57,18 @@ void BoxResizeUpdaterGPU::scaleAndWrapParticles(const BoxDim& cur_box, const Box
                               access_location::device,
                               access_mode::readwrite);
 
-    unsigned int group_size = m_group->getNumMembers();
-    ArrayHandle<unsigned int> d_group_members(m_group->getIndexArray(),
-                                              access_location::device,
-                                              access_mode::read);
-    m_tuner_scale->begin();
-    kernel::gpu_box_resize_scale(d_pos.data,
-                                 cur_box,
-                                 new_box,
-                                 d_group_members.data,
-                                 group_size,
-                                 m_tuner_scale->getParam()[0]);
-    m_tuner_scale->end();
-
-    m_tuner_wrap->begin();
-    kernel::gpu_box_resize_wrap(m_pdata->getN(),
-                                d_pos.data,
-                                d_image.data,
-                                new_box,
-                                m_tuner_wrap->getParam()[0]);
-    m_tuner_wrap->end();
+    ArrayHandle<unsigned int> d_is_member(m_group->getMembershipArray(),
+                                          access_location::device,
+                                          access_mode::read);
+    m_tuner_scale_wrap->begin();
+    kernel::gpu_box_resize_scale_wrap(m_pdata->getN(),
+                                      d_pos.data,
+                                      d_image.data,
+                                      cur_box,
+                                      new_box,
+                                      d_is_member.data,
+                                      m_tuner_scale_wrap->getParam()[0]);
+    m_tuner_scale_wrap->end();
     }
 
 namespace detail
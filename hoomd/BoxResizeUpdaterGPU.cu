@@ -8,86 +8,63 @@ namespace hoomd
 namespace kernel
     {
 
-__global__ void gpu_box_resize_scale_kernel(Scalar4* d_pos,
-                                            const BoxDim cur_box,
-                                            const BoxDim new_box,
-                                            const unsigned int* d_group_members,
-                                            const unsigned int group_size)
-    {
-    int group_idx = blockIdx.x * blockDim.x + threadIdx.x;
-
-    if (group_idx < group_size)
-        {
-        unsigned int idx = d_group_members[group_idx];
-
-        Scalar4 pos = d_pos[idx];
-
-        Scalar3 fractional_pos = cur_box.makeFraction(make_scalar3(pos.x, pos.y, pos.z));
-
-        Scalar3 scaled_pos = new_box.makeCoordinates(fractional_pos);
-        d_pos[idx].x = scaled_pos.x;
-        d_pos[idx].y = scaled_pos.y;
-        d_pos[idx].z = scaled_pos.z;
-        }
-    }
-
-__global__ void
-gpu_box_resize_wrap_kernel(unsigned int N, Scalar4* d_pos, int3* d_image, const BoxDim new_box)
+//! Scale group members into the new box and wrap all particles in one pass
+/*! Continuous compression runs resize the box every step, so the scale and wrap passes are
+    fused into one kernel: each particle is read and written exactly once instead of taking
+    a second read-modify-write pass over the position array.
+*/
+__global__ void gpu_box_resize_scale_wrap_kernel(const unsigned int N,
+                                                 Scalar4* d_pos,
+                                                 int3* d_image,
+                                                 const BoxDim cur_box,
+                                                 const BoxDim new_box,
+                                                 const unsigned int* d_is_member)
     {
     int idx = blockIdx.x * blockDim.x + threadIdx.x;
 
     if (idx < N)
         {
-        new_box.wrap(d_pos[idx], d_image[idx]);
-        }
-    }
+        Scalar4 pos = d_pos[idx];
 
-hipError_t gpu_box_resize_scale(Scalar4* d_pos,
-                                const BoxDim& cur_box,
-                                const BoxDim& new_box,
-                                const unsigned int* d_group_members,
-                                const unsigned int group_size,
-                                unsigned int block_size)
-    {
-    unsigned int max_block_size;
-    hipFuncAttributes attr;
-    hipFuncGetAttributes(&attr, (const void*)gpu_box_resize_wrap_kernel);
-    max_block_size = attr.maxThreadsPerBlock;
+        // scale the particle position (if we have been asked to)
+        if (d_is_member[idx])
+            {
+            Scalar3 fractional_pos = cur_box.makeFraction(make_scalar3(pos.x, pos.y, pos.z));
 
-    unsigned int run_block_size = min(block_size, max_block_size);
-    dim3 grid((group_size / run_block_size) + 1, 1, 1);
-    dim3 threads(run_block_size, 1, 1);
+            Scalar3 scaled_pos = new_box.makeCoordinates(fractional_pos);
+            pos.x = scaled_pos.x;
+            pos.y = scaled_pos.y;
+            pos.z = scaled_pos.z;
+            }
 
-    hipLaunchKernelGGL((gpu_box_resize_scale_kernel),
-                       grid,
-                       threads,
-                       0,
-                       0,
-                       d_pos,
-                       cur_box,
-                       new_box,
-                       d_group_members,
-                       group_size);
+        // wrap back into the new box, updating the image if the particle moved
+        // from one side of the box to the other
+        int3 image = d_image[idx];
+        new_box.wrap(pos, image);
 
-    return hipSuccess;
+        d_pos[idx] = pos;
+        d_image[idx] = image;
+        }
     }
 
-hipError_t gpu_box_resize_wrap(const unsigned int N,
-                               Scalar4* d_pos,
-                               int3* d_image,
-                               const BoxDim& new_box,
-                               unsigned int block_size)
+hipError_t gpu_box_resize_scale_wrap(const unsigned int N,
+                                     Scalar4* d_pos,
+                                     int3* d_image,
+                                     const BoxDim& cur_box,
+                                     const BoxDim& new_box,
+                                     const unsigned int* d_is_member,
+                                     unsigned int block_size)
     {
     unsigned int max_block_size;
     hipFuncAttributes attr;
-    hipFuncGetAttributes(&attr, (const void*)gpu_box_resize_wrap_kernel);
+    hipFuncGetAttributes(&attr, (const void*)gpu_box_resize_scale_wrap_kernel);
     max_block_size = attr.maxThreadsPerBlock;
 
     unsigned int run_block_size = min(block_size, max_block_size);
     dim3 grid((N / run_block_size) + 1, 1, 1);
     dim3 threads(run_block_size, 1, 1);
 
-    hipLaunchKernelGGL((gpu_box_resize_wrap_kernel),
+    hipLaunchKernelGGL((gpu_box_resize_scale_wrap_kernel),
                        grid,
                        threads,
                        0,
@@ -95,7 +72,9 @@ hipError_t gpu_box_resize_wrap(const unsigned int N,
                        N,
                        d_pos,
                        d_image,
-                       new_box);
+                       cur_box,
+                       new_box,
+                       d_is_member);
 
     return hipSuccess;
     }
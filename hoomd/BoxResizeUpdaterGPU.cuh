@@ -12,18 +12,13 @@ namespace hoomd
 namespace kernel
     {
 
-hipError_t gpu_box_resize_scale(Scalar4* d_pos,
-                                const BoxDim& cur_box,
-                                const BoxDim& new_box,
-                                const unsigned int* d_group_members,
-                                const unsigned int group_size,
-                                unsigned int block_size);
-
-hipError_t gpu_box_resize_wrap(const unsigned int N,
-                               Scalar4* d_pos,
-                               int3* d_image,
-                               const BoxDim& new_box,
-                               unsigned int block_size);
+hipError_t gpu_box_resize_scale_wrap(const unsigned int N,
+                                     Scalar4* d_pos,
+                                     int3* d_image,
+                                     const BoxDim& cur_box,
+                                     const BoxDim& new_box,
+                                     const unsigned int* d_is_member,
+                                     unsigned int block_size);
 
     } // end namespace kernel
     } // end namespace hoomd
@@ -41,10 +41,8 @@ class PYBIND11_EXPORT BoxResizeUpdaterGPU : public BoxResizeUpdater
     virtual void scaleAndWrapParticles(const BoxDim& cur_box, const BoxDim& new_box);
 
     private:
-    /// Autotuner for block size (scale kernel).
-    std::shared_ptr<Autotuner<1>> m_tuner_scale;
-    /// Autotuner for block size (wrap kernel).
-    std::shared_ptr<Autotuner<1>> m_tuner_wrap;
+    /// Autotuner for block size (fused scale/wrap kernel).
+    std::shared_ptr<Autotuner<1>> m_tuner_scale_wrap;
     };
 
 namespace detail
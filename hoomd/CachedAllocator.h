@@ -14,9 +14,17 @@
 #include <hip/hip_runtime.h>
 
 #include <cassert>
+#include <cstdlib>
+#include <iostream>
 #include <map>
+#include <set>
 #include <stdexcept>
 
+#if defined(__HIP_PLATFORM_NVCC__) && defined(CUDART_VERSION) && (CUDART_VERSION >= 11020)
+//! Stream-ordered allocation (cudaMallocAsync) is available
+#define HOOMD_MALLOC_ASYNC
+#endif
+
 //! Need to define an error checking macro that can be used in .cu files
 #define CHECK_CUDA()                                                         \
         {                                                                    \
@@ -37,6 +45,13 @@
 namespace hoomd
     {
 //! CachedAllocator: a simple allocator for caching allocation requests
+/*! On the CUDA platform, device allocations are served from the device's stream-ordered
+    memory pool (cudaMallocAsync): acquiring and releasing a scratch buffer is ordered on
+    the given stream and never forces a synchronization to reuse a block, and the driver
+    compacts the pool to resist fragmentation. The pool's release threshold is set to the
+    configured cache size so freed blocks are retained for reuse. Managed allocations and
+    other platforms fall back to the multimap free-list cache.
+*/
 class __attribute__((visibility("default"))) CachedAllocator
     {
     public:
@@ -65,6 +80,10 @@ class __attribute__((visibility("default"))) CachedAllocator
     void setMaxCachedBytes(unsigned int max_cached_bytes)
         {
         m_max_cached_bytes = max_cached_bytes;
+#ifdef HOOMD_MALLOC_ASYNC
+        // reapply the release threshold on the next allocation
+        m_pool_devices.clear();
+#endif
         }
 
     //! Destructor
@@ -75,10 +94,11 @@ class __attribute__((visibility("default"))) CachedAllocator
         }
 
     //! Allocate a temporary block
-    /*! \param num_bytes Number of elements to allocate
+    /*! \param num_elements Number of elements to allocate
+     * \param stream Stream the allocation is ordered on (stream-ordered pools only)
      * \returns a pointer to the allocated buffer
      */
-    template<typename T> T* getTemporaryBuffer(size_t num_elements);
+    template<typename T> T* getTemporaryBuffer(size_t num_elements, hipStream_t stream = 0);
 
     // Specifically allocate a char* buffer
     char* allocate(std::ptrdiff_t num_bytes)
@@ -87,11 +107,29 @@ class __attribute__((visibility("default"))) CachedAllocator
         }
 
     //! Release a previously allocated block
-    void deallocate(char* ptr, size_t n = 0)
+    /*! \param ptr Pointer returned by getTemporaryBuffer
+     * \param n Unused, needed by thrust
+     * \param stream Stream the free is ordered on (stream-ordered pools only)
+     */
+    void deallocate(char* ptr, size_t n = 0, hipStream_t stream = 0)
         {
         if (ptr == NULL)
             return;
 
+#ifdef HOOMD_MALLOC_ASYNC
+        if (!m_managed)
+            {
+            // return the block to the stream-ordered pool; the free is ordered after
+            // preceding work on the stream, so reuse needs no synchronization
+            cudaError_t error = cudaFreeAsync(ptr, stream);
+            if (error != cudaSuccess)
+                {
+                std::cerr << cudaGetErrorString(error) << std::endl;
+                }
+            return;
+            }
+#endif
+
         // erase the allocated block from the allocated blocks map
         allocated_blocks_type::iterator iter = m_allocated_blocks.find(ptr);
         assert(iter != m_allocated_blocks.end());
@@ -115,6 +153,25 @@ class __attribute__((visibility("default"))) CachedAllocator
     free_blocks_type m_free_blocks;
     allocated_blocks_type m_allocated_blocks;
 
+#ifdef HOOMD_MALLOC_ASYNC
+    std::set<int> m_pool_devices; //!< Devices whose memory pool has been configured
+
+    //! Configure the current device's memory pool to retain freed blocks
+    void setReleaseThreshold()
+        {
+        int device = -1;
+        cudaGetDevice(&device);
+        if (m_pool_devices.find(device) != m_pool_devices.end())
+            return;
+
+        cudaMemPool_t pool;
+        cudaDeviceGetDefaultMemPool(&pool, device);
+        cuuint64_t threshold = m_max_cached_bytes;
+        cudaMemPoolSetAttribute(pool, cudaMemPoolAttrReleaseThreshold, &threshold);
+        m_pool_devices.insert(device);
+        }
+#endif
+
     //! Free all allocated blocks
     void free_all()
         {
@@ -136,6 +193,146 @@ class __attribute__((visibility("default"))) CachedAllocator
         }
     };
 
+//! CachedHostAllocator: a caching pool of pinned host allocations
+/*! Pinning host memory for DMA (hipHostRegister) is an expensive operating system call that
+ * is performed on every GPUArray allocation and resize. This pool retains freed pinned
+ * blocks and hands them back out for subsequent requests of similar size, amortizing the
+ * registration cost across reuses while keeping host/device copies eligible for true
+ * asynchronous transfers. Blocks are unpinned and freed only when the cache exceeds its
+ * maximum size.
+ */
+class __attribute__((visibility("default"))) CachedHostAllocator
+    {
+    public:
+    //! Constructor
+    /*  \param max_cached_bytes Maximum size of cache
+     *   \param cache_reltol Relative tolerance for cache hits
+     */
+    CachedHostAllocator(unsigned int max_cached_bytes = 100u * 1024u * 1024u,
+                        float cache_reltol = 0.1f)
+        : m_num_bytes_tot(0), m_max_cached_bytes(max_cached_bytes), m_cache_reltol(cache_reltol)
+        {
+        }
+
+    CachedHostAllocator(const CachedHostAllocator&) = delete;
+    CachedHostAllocator& operator=(const CachedHostAllocator&) = delete;
+
+    CachedHostAllocator(const CachedHostAllocator&&) = delete;
+    CachedHostAllocator& operator=(const CachedHostAllocator&&) = delete;
+
+    //! Destructor
+    ~CachedHostAllocator()
+        {
+        free_all();
+        }
+
+    //! Allocate a pinned host block
+    /*! \param num_bytes Number of bytes to allocate
+     * \returns a pointer to a 32 byte aligned, DMA registered allocation
+     */
+    char* allocate(std::ptrdiff_t num_bytes)
+        {
+        char* result = 0;
+
+        if (!num_bytes)
+            return NULL;
+
+        size_t num_allocated_bytes = num_bytes;
+
+        // search the cache for a free block
+        free_blocks_type::iterator free_block = m_free_blocks.lower_bound(num_bytes);
+
+        // look for a cached buffer within m_cache_reltol relative tolerance
+        if (free_block != m_free_blocks.end()
+            && free_block->first
+                   <= (num_bytes + (unsigned int)((float)num_bytes * m_cache_reltol)))
+            {
+            result = free_block->second;
+            num_allocated_bytes = free_block->first;
+            m_free_blocks.erase(free_block);
+            }
+        else
+            {
+            // no block of the right size exists, create a new pinned one
+            // at minimum, alignment needs to be 32 bytes for AVX
+            void* ptr = nullptr;
+            int retval = posix_memalign(&ptr, 32, num_bytes);
+            if (retval != 0)
+                {
+                throw std::bad_alloc();
+                }
+
+            hipHostRegister(ptr, num_bytes, hipHostRegisterDefault);
+            CHECK_CUDA();
+            result = (char*)ptr;
+
+            m_num_bytes_tot += num_bytes;
+
+            while (m_num_bytes_tot > m_max_cached_bytes && m_free_blocks.size())
+                {
+                // eliminate largest cached block
+                free_blocks_type::reverse_iterator i = m_free_blocks.rbegin();
+
+                hipHostUnregister((void*)i->second);
+                CHECK_CUDA();
+                free((void*)i->second);
+
+                m_num_bytes_tot -= i->first;
+                m_free_blocks.erase((++i).base());
+                }
+            }
+
+        m_allocated_blocks.insert(std::make_pair(result, num_allocated_bytes));
+
+        return result;
+        }
+
+    //! Release a previously allocated block back to the pool
+    void deallocate(char* ptr)
+        {
+        if (ptr == NULL)
+            return;
+
+        // erase the allocated block from the allocated blocks map
+        allocated_blocks_type::iterator iter = m_allocated_blocks.find(ptr);
+        assert(iter != m_allocated_blocks.end());
+        std::ptrdiff_t num_bytes = iter->second;
+        m_allocated_blocks.erase(iter);
+
+        // insert the block into the free blocks map
+        m_free_blocks.insert(std::make_pair(num_bytes, ptr));
+        }
+
+    private:
+    typedef std::multimap<std::ptrdiff_t, char*> free_blocks_type;
+    typedef std::map<char*, std::ptrdiff_t> allocated_blocks_type;
+
+    size_t m_num_bytes_tot;
+    size_t m_max_cached_bytes;
+    float m_cache_reltol;
+
+    free_blocks_type m_free_blocks;
+    allocated_blocks_type m_allocated_blocks;
+
+    //! Unpin and free all blocks
+    void free_all()
+        {
+        for (free_blocks_type::iterator i = m_free_blocks.begin(); i != m_free_blocks.end(); ++i)
+            {
+            hipHostUnregister((void*)i->second);
+            free((void*)i->second);
+            }
+
+        for (allocated_blocks_type::iterator i = m_allocated_blocks.begin();
+             i != m_allocated_blocks.end();
+             ++i)
+            {
+            hipHostUnregister((void*)i->first);
+            free((void*)i->first);
+            }
+        }
+    };
+
 //! A temporary allocation object
 /*! When it goes out of scope, the temporary memory is automatically returned to the cache
  */
@@ -143,7 +340,7 @@ template<typename T> class ScopedAllocation
     {
     public:
     //! Copy constructor
-    ScopedAllocation(CachedAllocator& alloc, size_t num_elements);
+    ScopedAllocation(CachedAllocator& alloc, size_t num_elements, hipStream_t stream = 0);
 
     //! Destructor
     ~ScopedAllocation();
@@ -159,11 +356,12 @@ template<typename T> class ScopedAllocation
     ScopedAllocation(char* ptr, CachedAllocator& alloc);
 
     CachedAllocator& m_alloc;
+    hipStream_t m_stream;
 
     friend class CachedAllocator;
     };
 
-template<typename T> T* CachedAllocator::getTemporaryBuffer(size_t num_elements)
+template<typename T> T* CachedAllocator::getTemporaryBuffer(size_t num_elements, hipStream_t stream)
     {
     std::ptrdiff_t num_bytes = sizeof(T) * num_elements;
     char* result = 0;
@@ -172,6 +370,22 @@ template<typename T> T* CachedAllocator::getTemporaryBuffer(size_t num_elements)
     if (!num_bytes)
         return (T*)NULL;
 
+#ifdef HOOMD_MALLOC_ASYNC
+    if (!m_managed)
+        {
+        // allocate from the device's stream-ordered pool: acquisition is ordered on the
+        // stream and never synchronizes to reuse a previously freed block
+        setReleaseThreshold();
+        cudaError_t error = cudaMallocAsync((void**)&result, num_bytes, stream);
+        if (error != cudaSuccess)
+            {
+            throw std::runtime_error("CUDA Error in CachedAllocator "
+                                     + std::string(cudaGetErrorString(error)));
+            }
+        return (T*)result;
+        }
+#endif
+
     size_t num_allocated_bytes = num_bytes;
 
     // search the cache for a free block
@@ -233,15 +447,16 @@ template<typename T> T* CachedAllocator::getTemporaryBuffer(size_t num_elements)
 
 //! Constructor
 template<typename T>
-ScopedAllocation<T>::ScopedAllocation(CachedAllocator& alloc, size_t num_elements) : m_alloc(alloc)
+ScopedAllocation<T>::ScopedAllocation(CachedAllocator& alloc, size_t num_elements, hipStream_t stream)
+    : m_alloc(alloc), m_stream(stream)
     {
-    data = m_alloc.getTemporaryBuffer<T>(num_elements);
+    data = m_alloc.getTemporaryBuffer<T>(num_elements, stream);
     }
 
 //! Destructor
 template<typename T> ScopedAllocation<T>::~ScopedAllocation()
     {
-    m_alloc.deallocate((char*)data);
+    m_alloc.deallocate((char*)data, 0, m_stream);
     }
 
     } // end namespace hoomd
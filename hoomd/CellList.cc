@@ -18,9 +18,12 @@ namespace hoomd
  */
 CellList::CellList(std::shared_ptr<SystemDefinition> sysdef)
     : Compute(sysdef), m_nominal_width(Scalar(1.0)), m_radius(1), m_compute_xyzf(true),
-      m_compute_type_body(false), m_compute_orientation(false), m_compute_idx(false),
+      m_compute_xyzf_soa(false), m_compute_xyzf_q(false), m_compute_type_body(false),
+      m_compute_orientation(false), m_compute_idx(false),
       m_flag_charge(false), m_flag_type(false), m_sort_cell_list(false), m_compute_adj_list(true)
     {
+    m_binning_reduced = false;
+    m_lattice_reduce = true;
     m_exec_conf->msg->notice(5) << "Constructing CellList" << endl;
 
     // allocation is deferred until the first compute() call - initialize values to dummy variables
@@ -78,14 +81,59 @@ static unsigned int roundDown(unsigned int v, unsigned int m)
     return d * m;
     }
 
+/*! \returns The box the cell grid should be based on
+
+    For an untilted or mildly tilted box this is simply the global box. When shear
+    accumulates tilt factors beyond 1/2 (e.g. NEMD runs that do not flip the box), the
+    real-space shape of the fractional-space bins elongates and the neighbor candidate
+    volume grows with the tilt. Subtracting integer multiples of one lattice vector from
+    another describes the same periodic lattice, so the grid is re-based on the reduced
+    lattice vectors, which keeps the cells compact at any accumulated tilt. The reduction
+    is skipped under domain decomposition, where binning works on local sub-boxes.
+*/
+BoxDim CellList::computeBinningBox() const
+    {
+    const BoxDim& box = m_pdata->getBox();
+
+    if (!m_lattice_reduce)
+        return box;
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        return box;
+#endif
+
+    Scalar xy = box.getTiltFactorXY();
+    Scalar xz = box.getTiltFactorXZ();
+    Scalar yz = box.getTiltFactorYZ();
+
+    if (fabs(xy) <= Scalar(0.5) && fabs(xz) <= Scalar(0.5) && fabs(yz) <= Scalar(0.5))
+        return box;
+
+    // a3 -> a3 - round(yz) * a2 also shifts xz because a2 is itself tilted
+    Scalar n_yz = round(yz);
+    yz -= n_yz;
+    xz -= n_yz * xy;
+    // a3 -> a3 - round(xz) * a1 and a2 -> a2 - round(xy) * a1
+    xz -= round(xz);
+    xy -= round(xy);
+
+    BoxDim reduced = box;
+    reduced.setTiltFactors(xy, xz, yz);
+    return reduced;
+    }
+
 /*! \returns Cell dimensions that match with the current width, and box dimension
  */
 uint3 CellList::computeDimensions()
     {
     uint3 dim;
 
-    // calculate the bin dimensions
-    const BoxDim& box = m_pdata->getBox();
+    // calculate the bin dimensions against the (possibly lattice-reduced) binning box
+    m_binning_box = computeBinningBox();
+    m_binning_reduced = (m_binning_box.getTiltFactorXY() != m_pdata->getBox().getTiltFactorXY()
+                         || m_binning_box.getTiltFactorXZ() != m_pdata->getBox().getTiltFactorXZ()
+                         || m_binning_box.getTiltFactorYZ() != m_pdata->getBox().getTiltFactorYZ());
+    const BoxDim& box = m_binning_box;
 
     Scalar3 L = box.getNearestPlaneDistance();
 
@@ -183,6 +231,9 @@ void CellList::compute(uint64_t timestep)
     // only update if we need to
     if (shouldCompute(timestep) || force)
         {
+        // the counting sort scratch arrays are only valid when the host build fills them
+        m_sort_scratch_valid = false;
+
         bool overflowed = false;
         do
             {
@@ -209,14 +260,11 @@ void CellList::initializeWidth()
     {
     m_exec_conf->msg->notice(10) << "Cell list initialize width" << endl;
 
-    // get the local box
-    const BoxDim& box = m_pdata->getBox();
-
-    // initialize dimensions and width
+    // initialize dimensions and width (also refreshes the binning box)
     m_dim = computeDimensions();
 
     // stash the current actual cell width
-    const Scalar3 L = box.getNearestPlaneDistance();
+    const Scalar3 L = m_binning_box.getNearestPlaneDistance();
     m_actual_width = make_scalar3((L.x + Scalar(2.0) * m_ghost_width.x) / Scalar(m_dim.x),
                                   (L.y + Scalar(2.0) * m_ghost_width.y) / Scalar(m_dim.y),
                                   (L.z + Scalar(2.0) * m_ghost_width.z) / Scalar(m_dim.z));
@@ -299,6 +347,31 @@ void CellList::initializeMemory()
         m_xyzf.swap(xyzf);
         }
 
+    if (m_compute_xyzf_soa)
+        {
+        // four unit-stride planes: x, y, z, flag
+        GlobalArray<Scalar> xyzf_soa(4 * m_cell_list_indexer.getNumElements(), m_exec_conf);
+        m_xyzf_soa.swap(xyzf_soa);
+        TAG_ALLOCATION(m_xyzf_soa);
+        }
+    else
+        {
+        GlobalArray<Scalar> xyzf_soa;
+        m_xyzf_soa.swap(xyzf_soa);
+        }
+
+    if (m_compute_xyzf_q)
+        {
+        GlobalArray<uint2> xyzf_q(m_cell_list_indexer.getNumElements(), m_exec_conf);
+        m_xyzf_q.swap(xyzf_q);
+        TAG_ALLOCATION(m_xyzf_q);
+        }
+    else
+        {
+        GlobalArray<uint2> xyzf_q;
+        m_xyzf_q.swap(xyzf_q);
+        }
+
     if (m_compute_type_body)
         {
         GlobalArray<uint2> type_body(m_cell_list_indexer.getNumElements(), m_exec_conf);
@@ -412,13 +485,14 @@ void CellList::computeCellList()
     ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
                                      access_location::host,
                                      access_mode::read);
-    const BoxDim& box = m_pdata->getBox();
+    const BoxDim& box = m_binning_box;
 
     // access the cell list data arrays
     ArrayHandle<unsigned int> h_cell_size(m_cell_size,
                                           access_location::host,
                                           access_mode::overwrite);
     ArrayHandle<Scalar4> h_xyzf(m_xyzf, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar> h_xyzf_soa(m_xyzf_soa, access_location::host, access_mode::overwrite);
     ArrayHandle<Scalar4> h_cell_orientation(m_orientation,
                                             access_location::host,
                                             access_mode::overwrite);
@@ -441,8 +515,16 @@ void CellList::computeCellList()
     // for each particle
     unsigned n_tot_particles = m_pdata->getN() + m_pdata->getNGhosts();
 
+    // sentinel bin for particles rejected in the binning pass
+    const unsigned int invalid_bin = 0xffffffff;
+
+    // First pass of the counting sort: bin each particle and histogram the cell sizes.
+    m_particle_bins.resize(n_tot_particles);
+
     for (unsigned int n = 0; n < n_tot_particles; n++)
         {
+        m_particle_bins[n] = invalid_bin;
+
         Scalar3 p = make_scalar3(h_pos.data[n].x, h_pos.data[n].y, h_pos.data[n].z);
         if (std::isnan(p.x) || std::isnan(p.y) || std::isnan(p.z))
             {
@@ -452,6 +534,16 @@ void CellList::computeCellList()
 
         // find the bin each particle belongs in
         Scalar3 f = box.makeFraction(p, ghost_width);
+        // positions are wrapped into the global box, fold them into the reduced one
+        if (m_binning_reduced)
+            {
+            if (periodic.x)
+                f.x -= std::floor(f.x);
+            if (periodic.y)
+                f.y -= std::floor(f.y);
+            if (periodic.z)
+                f.z -= std::floor(f.z);
+            }
         int ib = (int)(f.x * m_dim.x);
         int jb = (int)(f.y * m_dim.y);
         int kb = (int)(f.z * m_dim.z);
@@ -479,9 +571,6 @@ void CellList::computeCellList()
         assert((ib < (int)(m_dim.x) && jb < (int)(m_dim.y) && kb < (int)(m_dim.z))
                || n >= m_pdata->getN());
 
-        // record its bin
-        unsigned int bin = ci(ib, jb, kb);
-
         // all particles should be in a valid cell
         if (ib < 0 || ib >= (int)m_dim.x || jb < 0 || jb >= (int)m_dim.y || kb < 0
             || kb >= (int)m_dim.z)
@@ -492,49 +581,96 @@ void CellList::computeCellList()
             continue;
             }
 
-        // setup the flag value to store
-        Scalar flag;
-        if (m_flag_charge)
-            flag = h_charge.data[n];
-        else if (m_flag_type)
-            flag = h_pos.data[n].w;
-        else
-            flag = __int_as_scalar(n);
+        // record its bin
+        unsigned int bin = ci(ib, jb, kb);
+        m_particle_bins[n] = bin;
+        h_cell_size.data[bin]++;
+        }
+
+    // Exclusive prefix sum of the histogram gives the start of each bin's entries. Also
+    // detect overflowing cells here so an overflowed build stops before the write pass.
+    const unsigned int n_cells = ci.getNumElements();
+    m_bin_head.resize(n_cells);
+
+    unsigned int total = 0;
+    for (unsigned int cell = 0; cell < n_cells; cell++)
+        {
+        m_bin_head[cell] = total;
+        unsigned int size = h_cell_size.data[cell];
+        total += size;
+        if (size > m_Nmax)
+            conditions.x = max((unsigned int)conditions.x, size);
+        }
+
+    // Placement pass: counting sort the particle indices by bin. After this loop
+    // m_bin_head[cell] points one past the last entry of the cell.
+    m_sorted_pidx.resize(total);
 
-        // store the bin entries
-        unsigned int offset = h_cell_size.data[bin];
+    for (unsigned int n = 0; n < n_tot_particles; n++)
+        {
+        unsigned int bin = m_particle_bins[n];
+        if (bin == invalid_bin)
+            continue;
+
+        m_sorted_pidx[m_bin_head[bin]++] = n;
+        }
 
-        if (offset < m_Nmax)
+    // Output pass: walk the cells in order so that the stores to the cell list arrays
+    // are sequential in memory (entries of a cell are contiguous in the Index2D layout).
+    unsigned int start = 0;
+    for (unsigned int cell = 0; cell < n_cells; cell++)
+        {
+        unsigned int end = m_bin_head[cell];
+        unsigned int n_entries = min(end - start, (unsigned int)m_Nmax);
+
+        for (unsigned int offset = 0; offset < n_entries; offset++)
             {
+            unsigned int n = m_sorted_pidx[start + offset];
+
+            // setup the flag value to store
+            Scalar flag;
+            if (m_flag_charge)
+                flag = h_charge.data[n];
+            else if (m_flag_type)
+                flag = h_pos.data[n].w;
+            else
+                flag = __int_as_scalar(n);
+
             if (m_compute_xyzf)
                 {
-                h_xyzf.data[cli(offset, bin)]
+                h_xyzf.data[cli(offset, cell)]
                     = make_scalar4(h_pos.data[n].x, h_pos.data[n].y, h_pos.data[n].z, flag);
                 }
 
+            if (m_compute_xyzf_soa)
+                {
+                // transpose into the unit-stride x/y/z/flag planes
+                const size_t pitch = cli.getNumElements();
+                const size_t entry = cli(offset, cell);
+                h_xyzf_soa.data[entry] = h_pos.data[n].x;
+                h_xyzf_soa.data[pitch + entry] = h_pos.data[n].y;
+                h_xyzf_soa.data[2 * pitch + entry] = h_pos.data[n].z;
+                h_xyzf_soa.data[3 * pitch + entry] = flag;
+                }
+
             if (m_compute_type_body)
                 {
-                h_type_body.data[cli(offset, bin)]
+                h_type_body.data[cli(offset, cell)]
                     = make_uint2(__scalar_as_int(h_pos.data[n].w), h_body.data[n]);
                 }
 
             if (m_compute_orientation)
                 {
-                h_cell_orientation.data[cli(offset, bin)] = h_orientation.data[n];
+                h_cell_orientation.data[cli(offset, cell)] = h_orientation.data[n];
                 }
 
             if (m_compute_idx)
                 {
-                h_cell_idx.data[cli(offset, bin)] = n;
+                h_cell_idx.data[cli(offset, cell)] = n;
                 }
             }
-        else
-            {
-            conditions.x = max((unsigned int)conditions.x, offset + 1);
-            }
 
-        // increment the cell occupancy counter
-        h_cell_size.data[bin]++;
+        start = end;
         }
 
         {
@@ -544,6 +680,70 @@ void CellList::computeCellList()
                                         access_mode::overwrite);
         *h_conditions.data = conditions;
         }
+
+    m_sort_scratch_valid = true;
+    }
+
+/*! \param order [out] Rank-local (non-ghost) particle indices in curve order
+    \returns true when \a order was produced from the last cell list build
+
+    Walks the cells of the last build along a Morton (Z-order) curve and concatenates each
+    cell's particles, producing a space-filling-curve particle ordering as a byproduct of the
+    counting sort in computeCellList(). Returns false when no host build data is available
+    (e.g. the cell list was last built on the GPU); callers should then fall back to a
+    standalone ordering pass.
+*/
+bool CellList::getCurveSortedOrder(std::vector<unsigned int>& order)
+    {
+    if (!m_sort_scratch_valid)
+        return false;
+
+    const unsigned int N = m_pdata->getN();
+    order.clear();
+    order.reserve(N);
+
+    ArrayHandle<unsigned int> h_cell_size(m_cell_size, access_location::host, access_mode::read);
+    const Index3D& ci = m_cell_indexer;
+
+    // number of bits needed to cover the largest cell dimension
+    unsigned int bits = 0;
+    while ((1u << bits) < std::max(ci.getW(), std::max(ci.getH(), ci.getD())))
+        bits++;
+
+    // traverse the cells in Morton order by de-interleaving the code bits, skipping codes
+    // that fall outside the (generally non power of two) cell dimensions
+    const uint64_t n_codes = uint64_t(1) << (3 * bits);
+    for (uint64_t code = 0; code < n_codes; code++)
+        {
+        unsigned int ib = 0;
+        unsigned int jb = 0;
+        unsigned int kb = 0;
+        for (unsigned int b = 0; b < bits; b++)
+            {
+            ib |= (unsigned int)((code >> (3 * b + 2)) & 1) << b;
+            jb |= (unsigned int)((code >> (3 * b + 1)) & 1) << b;
+            kb |= (unsigned int)((code >> (3 * b)) & 1) << b;
+            }
+        if (ib >= ci.getW() || jb >= ci.getH() || kb >= ci.getD())
+            continue;
+
+        const unsigned int cell = ci(ib, jb, kb);
+
+        // m_bin_head holds end pointers after the placement pass of the counting sort
+        const unsigned int end = m_bin_head[cell];
+        const unsigned int start = end - h_cell_size.data[cell];
+        for (unsigned int m = start; m < end; m++)
+            {
+            const unsigned int n = m_sorted_pidx[m];
+            if (n < N) // ghosts are re-exchanged after a reorder
+                order.push_back(n);
+            }
+        }
+
+    // particles rejected by the binning pass (NaN or out of box) are missing from the
+    // scratch arrays; such builds fail their condition checks, but do not hand out a
+    // partial permutation either
+    return (unsigned int)order.size() == N;
     }
 
 bool CellList::checkConditions()
@@ -9,6 +9,7 @@
 
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
 #include <memory>
+#include <vector>
 
 /*! \file CellList.h
     \brief Declares the CellList class
@@ -128,6 +129,33 @@ class PYBIND11_EXPORT CellList : public Compute
         m_params_changed = true;
         }
 
+    //! Specify if the XYZ,flag cell list is additionally stored structure-of-arrays
+    /*! The SoA layout keeps the x, y, z and flag lanes of each cell's entries in
+        separate unit-stride planes, so consumers scanning candidate cells stream full
+        SIMD lanes instead of loading interleaved Scalar4 values. Only the host cell
+        list build fills the SoA planes; the GPU binning kernels do not.
+    */
+    void setComputeXYZFSoA(bool compute_xyzf_soa)
+        {
+        m_compute_xyzf_soa = compute_xyzf_soa;
+        m_params_changed = true;
+        }
+
+    //! Specify if the quantized compact cell list is to be computed
+    /*! The compact layout stores each entry as 16-bit fixed-point fractional
+        coordinates plus the particle type in 8 bytes, a quarter of the Scalar4
+        xyzf entry in double precision builds. Consumers must widen their
+        acceptance radius by the quantization error and resolve accepted
+        candidates through the index list, so enabling the compact list requires
+        the xyzf, TypeBody and index lists as well. Only the GPU cell list build
+        fills the compact array; the host build does not.
+    */
+    void setComputeXYZFQ(bool compute_xyzf_q)
+        {
+        m_compute_xyzf_q = compute_xyzf_q;
+        m_params_changed = true;
+        }
+
     //! Specify if the TypeBody cell list is to be computed
     void setComputeTypeBody(bool compute_type_body)
         {
@@ -280,6 +308,23 @@ class PYBIND11_EXPORT CellList : public Compute
         return m_actual_width;
         }
 
+    //! Get the box particles are binned against
+    /*! For strongly tilted boxes the cell grid is re-based on the lattice-reduced box
+        (tilt factors brought back into [-1/2, 1/2] by integer lattice vector shifts),
+        which describes the same periodic lattice with compact cells. Consumers that
+        recompute a particle's cell must bin against this box, not the global box.
+    */
+    const BoxDim& getBinningBox() const
+        {
+        return m_binning_box;
+        }
+
+    //! Returns true when the binning box differs from the global box
+    bool isBinningReduced() const
+        {
+        return m_binning_reduced;
+        }
+
     // @}
     //! \name Get data
     // @{
@@ -312,6 +357,33 @@ class PYBIND11_EXPORT CellList : public Compute
         return m_xyzf;
         }
 
+    //! Get the structure-of-arrays cell list planes
+    /*! The array holds four planes of getCellListIndexer().getNumElements() entries
+        each: x, y, z and flag, in that order. Within a plane the entries of one cell
+        are contiguous, see getXYZFSoAPitch() for the plane stride.
+    */
+    const GlobalArray<Scalar>& getXYZFSoAArray() const
+        {
+        return m_xyzf_soa;
+        }
+
+    //! Get the number of entries in one plane of the SoA cell list
+    size_t getXYZFSoAPitch() const
+        {
+        return m_cell_list_indexer.getNumElements();
+        }
+
+    //! Get the quantized compact cell list
+    /*! Each entry packs the position as 16-bit fixed-point fractions of the
+        ghost-layer expanded box, x = qx | (qy << 16) and y = qz | (type << 16),
+        with q = round(f * 65535) and f the makeFraction() value the binning is
+        based on. Entries past the cell size are zero filled.
+    */
+    const GlobalArray<uint2>& getXYZFQArray() const
+        {
+        return m_xyzf_q;
+        }
+
     //! Get the cell list containing t,b
     const GlobalArray<uint2>& getTypeBodyArray() const
         {
@@ -340,6 +412,9 @@ class PYBIND11_EXPORT CellList : public Compute
     //! Compute the cell list given the current particle positions
     void compute(uint64_t timestep);
 
+    //! Get a space-filling-curve particle ordering from the last host build
+    bool getCurveSortedOrder(std::vector<unsigned int>& order);
+
     // @}
 
     /*! \param func Function to call when the cell width changes
@@ -359,6 +434,8 @@ class PYBIND11_EXPORT CellList : public Compute
     Scalar m_nominal_width;     //!< Minimum width of cell in any direction
     unsigned int m_radius;      //!< Radius of adjacency bins to list
     bool m_compute_xyzf;        //!< true if the xyzf list should be computed
+    bool m_compute_xyzf_soa;    //!< true if the xyzf list should also be stored SoA
+    bool m_compute_xyzf_q;      //!< true if the quantized compact list should be computed
     bool m_compute_type_body;   //!< true if the TypeBody list should be computed
     bool m_compute_orientation; //!< true if the orientation list should be computed
     bool m_compute_idx;         //!< true if the idx list should be computed
@@ -378,11 +455,16 @@ class PYBIND11_EXPORT CellList : public Compute
     unsigned int m_Nmax;         //!< Numer of spaces reserved for particles in each cell
     Scalar3 m_actual_width;      //!< Actual width of a cell in each direction
     Scalar3 m_ghost_width;       //!< Width of ghost layer sized for (on one side only)
+    BoxDim m_binning_box;        //!< Box the cell grid is based on, see getBinningBox()
+    bool m_binning_reduced;      //!< True when m_binning_box differs from the global box
+    bool m_lattice_reduce;       //!< True if binning may re-base on the reduced lattice
 
     // values computed by compute()
     GlobalArray<unsigned int> m_cell_size; //!< Number of members in each cell
     GlobalArray<unsigned int> m_cell_adj;  //!< Cell adjacency list
     GlobalArray<Scalar4> m_xyzf;           //!< Cell list with position and flags
+    GlobalArray<Scalar> m_xyzf_soa;        //!< SoA cell list planes (x, y, z, flag)
+    GlobalArray<uint2> m_xyzf_q;           //!< Quantized compact cell list (fractions + type)
     GlobalArray<uint2> m_type_body;        //!< Cell list with type,body
     GlobalArray<Scalar4> m_orientation;    //!< Cell list with orientation
     GlobalArray<unsigned int> m_idx;       //!< Cell list with index
@@ -391,6 +473,12 @@ class PYBIND11_EXPORT CellList : public Compute
     bool m_sort_cell_list;   //!< If true, sort cell list
     bool m_compute_adj_list; //!< If true, compute the cell adjacency lists
 
+    // host only scratch arrays for the counting sort in computeCellList()
+    std::vector<unsigned int> m_particle_bins; //!< Bin assigned to each particle
+    std::vector<unsigned int> m_bin_head;      //!< Prefix summed start of each bin's entries
+    std::vector<unsigned int> m_sorted_pidx;   //!< Particle indices sorted by bin
+    bool m_sort_scratch_valid = false; //!< True when the scratch arrays match the last build
+
 #ifdef ENABLE_MPI
     /// The system's communicator.
     std::shared_ptr<Communicator> m_comm;
@@ -399,6 +487,9 @@ class PYBIND11_EXPORT CellList : public Compute
     //! Computes what the dimensions should me
     uint3 computeDimensions();
 
+    //! Compute the box to bin against, lattice-reduced when the tilt warrants it
+    BoxDim computeBinningBox() const;
+
     //! Initialize width and indexers, allocates memory
     void initializeAll();
 
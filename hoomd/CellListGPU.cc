@@ -17,6 +17,10 @@ namespace hoomd
 CellListGPU::CellListGPU(std::shared_ptr<SystemDefinition> sysdef)
     : CellList(sysdef), m_per_device(false)
     {
+    // the GPU binning kernels work on the global box directly and do not implement the
+    // lattice-reduced binning of the host path
+    m_lattice_reduce = false;
+
     if (!m_exec_conf->isCUDAEnabled())
         {
         m_exec_conf->msg->error()
@@ -38,6 +42,18 @@ CellListGPU::CellListGPU(std::shared_ptr<SystemDefinition> sysdef)
 
 void CellListGPU::computeCellList()
     {
+    // the sorted build covers the single-GPU case; it determines the exact cell sizes
+    // before writing the list, so an Nmax overflow never forces a second build, and its
+    // output is already ordered by cell and particle index
+    if (m_exec_conf->getNumActiveGPUs() == 1 && !m_per_device)
+        {
+        computeCellListSorted();
+
+        if (m_compute_xyzf_q)
+            quantizeCellList();
+        return;
+        }
+
     // acquire the particle data
     ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
     ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
@@ -229,6 +245,139 @@ void CellListGPU::computeCellList()
 
     if (ngpu > 1 && !m_per_device)
         combineCellLists();
+
+    if (m_compute_xyzf_q)
+        quantizeCellList();
+    }
+
+/*! Builds the cell list in one deterministic pass from a radix sort of the particle indices
+    by cell id. The exact per-cell occupancies are known after the sort, so the arrays are
+    grown to the maximum occupancy up front instead of detecting an Nmax overflow afterwards
+    and rebuilding the whole list. The stable sort orders the particles within one cell by
+    ascending index, so the output needs no separate locality sort pass.
+ */
+void CellListGPU::computeCellListSorted()
+    {
+    unsigned int n_total = m_pdata->getN() + m_pdata->getNGhosts();
+    unsigned int n_cells = m_cell_indexer.getNumElements();
+
+    if (n_total == 0)
+        {
+        ArrayHandle<unsigned int> d_cell_size(m_cell_size,
+                                              access_location::device,
+                                              access_mode::overwrite);
+        hipMemsetAsync(d_cell_size.data, 0, sizeof(unsigned int) * n_cells, 0);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        return;
+        }
+
+    // scratch arrays for the sorted build
+    ScopedAllocation<unsigned int> d_cell_keys(m_exec_conf->getCachedAllocator(), n_total);
+    ScopedAllocation<unsigned int> d_sorted_idx(m_exec_conf->getCachedAllocator(), n_total);
+    ScopedAllocation<unsigned int> d_cell_start(m_exec_conf->getCachedAllocator(), n_cells);
+    ScopedAllocation<unsigned int> d_exact_cell_size(m_exec_conf->getCachedAllocator(), n_cells);
+
+    unsigned int max_cell_size = 0;
+
+    m_tuner->begin();
+    unsigned int block_size = m_tuner->getParam()[0];
+
+        {
+        ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+
+        // error conditions
+        ArrayHandle<uint3> d_conditions(m_conditions,
+                                        access_location::device,
+                                        access_mode::overwrite);
+
+        gpu_compute_cell_keys(d_cell_keys.data,
+                              d_sorted_idx.data,
+                              d_conditions.data,
+                              d_pos.data,
+                              m_pdata->getN(),
+                              m_pdata->getNGhosts(),
+                              m_pdata->getBox(),
+                              m_cell_indexer,
+                              getGhostWidth(),
+                              block_size);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+
+        gpu_sort_cell_keys(d_cell_keys.data,
+                           d_sorted_idx.data,
+                           d_cell_start.data,
+                           d_exact_cell_size.data,
+                           max_cell_size,
+                           n_total,
+                           n_cells,
+                           block_size);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+    // grow the cell list to the exact maximum occupancy before writing it, instead of
+    // detecting the overflow afterwards and rebuilding
+    if (max_cell_size > m_Nmax)
+        {
+        m_Nmax = max_cell_size;
+        initializeMemory();
+        }
+
+        {
+        ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+        ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
+                                           access_location::device,
+                                           access_mode::read);
+        ArrayHandle<Scalar> d_charge(m_pdata->getCharges(),
+                                     access_location::device,
+                                     access_mode::read);
+        ArrayHandle<unsigned int> d_body(m_pdata->getBodies(),
+                                         access_location::device,
+                                         access_mode::read);
+
+        // access the cell list data arrays
+        ArrayHandle<unsigned int> d_cell_size(m_cell_size,
+                                              access_location::device,
+                                              access_mode::overwrite);
+        ArrayHandle<Scalar4> d_xyzf(m_xyzf, access_location::device, access_mode::overwrite);
+        ArrayHandle<uint2> d_type_body(m_type_body,
+                                       access_location::device,
+                                       access_mode::overwrite);
+        ArrayHandle<Scalar4> d_cell_orientation(m_orientation,
+                                                access_location::device,
+                                                access_mode::overwrite);
+        ArrayHandle<unsigned int> d_cell_idx(m_idx,
+                                             access_location::device,
+                                             access_mode::overwrite);
+
+        gpu_fill_sorted_cell_list(d_cell_size.data,
+                                  d_xyzf.data,
+                                  d_type_body.data,
+                                  d_cell_orientation.data,
+                                  d_cell_idx.data,
+                                  d_cell_keys.data,
+                                  d_sorted_idx.data,
+                                  d_cell_start.data,
+                                  d_exact_cell_size.data,
+                                  d_pos.data,
+                                  d_orientation.data,
+                                  d_charge.data,
+                                  d_body.data,
+                                  n_total,
+                                  m_flag_charge,
+                                  m_flag_type,
+                                  m_cell_list_indexer,
+                                  block_size);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+    m_tuner->end();
     }
 
 void CellListGPU::combineCellLists()
@@ -291,6 +440,36 @@ void CellListGPU::combineCellLists()
     m_exec_conf->endMultiGPU();
     }
 
+/*! Derives the quantized compact cell list from the assembled xyzf and type/body
+    lists in one pass over the cell list slots. Running after the build (including
+    any combine or locality sort) keeps the compact entries consistent with the
+    final slot order no matter which build path produced it.
+ */
+void CellListGPU::quantizeCellList()
+    {
+    // the compact entries are derived from the xyzf and type/body lists
+    if (m_xyzf.isNull() || m_type_body.isNull())
+        {
+        throw std::runtime_error("The compact cell list requires the xyzf and TypeBody lists");
+        }
+
+    ArrayHandle<uint2> d_xyzf_q(m_xyzf_q, access_location::device, access_mode::overwrite);
+    ArrayHandle<Scalar4> d_xyzf(m_xyzf, access_location::device, access_mode::read);
+    ArrayHandle<uint2> d_type_body(m_type_body, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_cell_size(m_cell_size, access_location::device, access_mode::read);
+
+    gpu_quantize_cell_list(d_xyzf_q.data,
+                           d_xyzf.data,
+                           d_type_body.data,
+                           d_cell_size.data,
+                           m_pdata->getBox(),
+                           getGhostWidth(),
+                           m_cell_list_indexer,
+                           256);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    }
+
 void CellListGPU::initializeMemory()
     {
     // call base class method
@@ -6,6 +6,8 @@
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wconversion"
 #include <thrust/device_ptr.h>
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
 #include <thrust/sort.h>
 #pragma GCC diagnostic pop
 
@@ -243,6 +245,446 @@ void gpu_compute_cell_list(unsigned int* d_cell_size,
         }
     }
 
+//! Kernel that computes the cell key of each particle for the sorted cell list build
+/*! Performs the same binning and error checks as gpu_compute_cell_list_kernel(), but only
+    records the cell id of every particle. Particles that cannot be binned (NaN positions or
+    out of bounds) receive the sentinel key \a n_cells so that they sort to the end of the
+    keys and are skipped by the fill kernel.
+
+    \param d_cell_keys Cell id per particle (output)
+    \param d_sorted_idx Particle index per particle, filled with the identity (output)
+    \param d_conditions Conditions flags for detecting error conditions
+    \param d_pos Particle position array
+    \param N Number of particles
+    \param n_ghost Number of ghost particles
+    \param box Box dimensions
+    \param ci Indexer to compute cell id from cell grid coords
+    \param ghost_width Width of ghost layer
+*/
+__global__ void gpu_compute_cell_keys_kernel(unsigned int* d_cell_keys,
+                                             unsigned int* d_sorted_idx,
+                                             uint3* d_conditions,
+                                             const Scalar4* d_pos,
+                                             const unsigned int N,
+                                             const unsigned int n_ghost,
+                                             const BoxDim box,
+                                             const Index3D ci,
+                                             const Scalar3 ghost_width)
+    {
+    unsigned int idx = blockDim.x * blockIdx.x + threadIdx.x;
+    if (idx >= N + n_ghost)
+        return;
+
+    const unsigned int n_cells = ci.getNumElements();
+
+    // write the identity permutation, the key sort reorders it
+    d_sorted_idx[idx] = idx;
+
+    Scalar4 postype = d_pos[idx];
+    Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
+
+    // check for nan pos
+    if (isnan(pos.x) || isnan(pos.y) || isnan(pos.z))
+        {
+        (*d_conditions).y = idx + 1;
+        d_cell_keys[idx] = n_cells;
+        return;
+        }
+
+    uchar3 periodic = box.getPeriodic();
+    Scalar3 f = box.makeFraction(pos, ghost_width);
+
+    // check if the particle is inside the unit cell + ghost layer in all dimensions
+    if ((f.x < Scalar(-0.00001) || f.x >= Scalar(1.00001))
+        || (f.y < Scalar(-0.00001) || f.y >= Scalar(1.00001))
+        || (f.z < Scalar(-0.00001) || f.z >= Scalar(1.00001)))
+        {
+        // if a ghost particle is out of bounds, silently ignore it
+        if (idx < N)
+            (*d_conditions).z = idx + 1;
+        d_cell_keys[idx] = n_cells;
+        return;
+        }
+
+    // find the bin each particle belongs in
+    int ib = (int)(f.x * ci.getW());
+    int jb = (int)(f.y * ci.getH());
+    int kb = (int)(f.z * ci.getD());
+
+    // need to handle the case where the particle is exactly at the box hi
+    if (ib == ci.getW() && periodic.x)
+        ib = 0;
+    if (jb == ci.getH() && periodic.y)
+        jb = 0;
+    if (kb == ci.getD() && periodic.z)
+        kb = 0;
+
+    // all particles should be in a valid cell
+    if (ib < 0 || ib >= (int)ci.getW() || jb < 0 || jb >= (int)ci.getH() || kb < 0
+        || kb >= (int)ci.getD())
+        {
+        // but ghost particles that are out of range should not produce an error
+        if (idx < N)
+            {
+#if (__CUDA_ARCH__ >= 600)
+            atomicMax_system(&(*d_conditions).z, idx + 1);
+#else
+            atomicMax(&(*d_conditions).z, idx + 1);
+#endif
+            }
+        d_cell_keys[idx] = n_cells;
+        return;
+        }
+
+    d_cell_keys[idx] = ci(ib, jb, kb);
+    }
+
+//! Kernel that records the position of the first particle of each cell in the sorted keys
+__global__ void gpu_cell_run_starts_kernel(unsigned int* d_cell_start,
+                                           const unsigned int* d_cell_keys,
+                                           const unsigned int n_total,
+                                           const unsigned int n_cells)
+    {
+    unsigned int i = blockDim.x * blockIdx.x + threadIdx.x;
+    if (i >= n_total)
+        return;
+
+    unsigned int key = d_cell_keys[i];
+    if (key >= n_cells)
+        return;
+
+    if (i == 0 || d_cell_keys[i - 1] != key)
+        d_cell_start[key] = i;
+    }
+
+//! Kernel that computes the exact cell sizes from the run boundaries in the sorted keys
+__global__ void gpu_cell_run_sizes_kernel(unsigned int* d_exact_cell_size,
+                                          const unsigned int* d_cell_start,
+                                          const unsigned int* d_cell_keys,
+                                          const unsigned int n_total,
+                                          const unsigned int n_cells)
+    {
+    unsigned int i = blockDim.x * blockIdx.x + threadIdx.x;
+    if (i >= n_total)
+        return;
+
+    unsigned int key = d_cell_keys[i];
+    if (key >= n_cells)
+        return;
+
+    if (i == n_total - 1 || d_cell_keys[i + 1] != key)
+        d_exact_cell_size[key] = i + 1 - d_cell_start[key];
+    }
+
+/*! Driver that sorts the cell keys and determines the exact occupancy of every cell
+
+    The stable sort keeps the particles of one cell in ascending index order, so the
+    resulting cell list is deterministic without a separate locality sort pass.
+
+    \param d_cell_keys Cell id per particle, sorted on output
+    \param d_sorted_idx Particle indices, permuted alongside the keys on output
+    \param d_cell_start First position of each cell in the sorted keys (output)
+    \param d_exact_cell_size Exact number of particles in each cell (output)
+    \param max_cell_size Maximum of \a d_exact_cell_size, read back to the host (output)
+    \param n_total Number of local plus ghost particles
+    \param n_cells Number of cells
+    \param block_size GPU block size
+*/
+hipError_t gpu_sort_cell_keys(unsigned int* d_cell_keys,
+                              unsigned int* d_sorted_idx,
+                              unsigned int* d_cell_start,
+                              unsigned int* d_exact_cell_size,
+                              unsigned int& max_cell_size,
+                              const unsigned int n_total,
+                              const unsigned int n_cells,
+                              const unsigned int block_size)
+    {
+    // sort the particle indices by cell key; the radix sort is stable so the order within
+    // one cell is the ascending particle index
+    thrust::device_ptr<unsigned int> d_cell_keys_thrust(d_cell_keys);
+    thrust::device_ptr<unsigned int> d_sorted_idx_thrust(d_sorted_idx);
+    thrust::stable_sort_by_key(d_cell_keys_thrust,
+                               d_cell_keys_thrust + n_total,
+                               d_sorted_idx_thrust);
+
+    // empty cells keep a zero size
+    hipMemsetAsync(d_exact_cell_size, 0, sizeof(unsigned int) * n_cells);
+
+    dim3 threads(block_size);
+    dim3 grid(n_total / block_size + 1);
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_cell_run_starts_kernel),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       d_cell_start,
+                       d_cell_keys,
+                       n_total,
+                       n_cells);
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_cell_run_sizes_kernel),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       d_exact_cell_size,
+                       d_cell_start,
+                       d_cell_keys,
+                       n_total,
+                       n_cells);
+
+    // read back the maximum occupancy so the host can size the cell list before it is
+    // written
+    thrust::device_ptr<unsigned int> d_exact_cell_size_thrust(d_exact_cell_size);
+    max_cell_size = thrust::reduce(d_exact_cell_size_thrust,
+                                   d_exact_cell_size_thrust + n_cells,
+                                   (unsigned int)0,
+                                   thrust::maximum<unsigned int>());
+
+    return hipSuccess;
+    }
+
+//! Kernel that scatters the sorted particles into the cell list arrays
+__global__ void gpu_fill_sorted_cell_list_kernel(Scalar4* d_xyzf,
+                                                 uint2* d_type_body,
+                                                 Scalar4* d_cell_orientation,
+                                                 unsigned int* d_cell_idx,
+                                                 const unsigned int* d_cell_keys,
+                                                 const unsigned int* d_sorted_idx,
+                                                 const unsigned int* d_cell_start,
+                                                 const Scalar4* d_pos,
+                                                 const Scalar4* d_orientation,
+                                                 const Scalar* d_charge,
+                                                 const unsigned int* d_body,
+                                                 const unsigned int n_total,
+                                                 const bool flag_charge,
+                                                 const bool flag_type,
+                                                 const Index2D cli)
+    {
+    unsigned int i = blockDim.x * blockIdx.x + threadIdx.x;
+    if (i >= n_total)
+        return;
+
+    unsigned int bin = d_cell_keys[i];
+    if (bin >= cli.getH())
+        return;
+
+    unsigned int idx = d_sorted_idx[i];
+    unsigned int offset = i - d_cell_start[bin];
+    unsigned int write_pos = cli(offset, bin);
+
+    Scalar4 postype = d_pos[idx];
+    Scalar type = postype.w;
+
+    Scalar flag = 0;
+    if (flag_charge)
+        flag = d_charge[idx];
+    else if (flag_type)
+        flag = type;
+    else
+        flag = __int_as_scalar(idx);
+
+    if (d_xyzf != NULL)
+        d_xyzf[write_pos] = make_scalar4(postype.x, postype.y, postype.z, flag);
+    if (d_type_body != NULL)
+        d_type_body[write_pos] = make_uint2(__scalar_as_int(type), d_body[idx]);
+    if (d_cell_orientation != NULL)
+        d_cell_orientation[write_pos] = d_orientation[idx];
+    if (d_cell_idx != NULL)
+        d_cell_idx[write_pos] = idx;
+    }
+
+//! Kernel driver for gpu_compute_cell_keys_kernel()
+hipError_t gpu_compute_cell_keys(unsigned int* d_cell_keys,
+                                 unsigned int* d_sorted_idx,
+                                 uint3* d_conditions,
+                                 const Scalar4* d_pos,
+                                 const unsigned int N,
+                                 const unsigned int n_ghost,
+                                 const BoxDim& box,
+                                 const Index3D& ci,
+                                 const Scalar3& ghost_width,
+                                 const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, reinterpret_cast<const void*>(&gpu_compute_cell_keys_kernel));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_compute_cell_keys_kernel),
+                       dim3((N + n_ghost) / run_block_size + 1),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       d_cell_keys,
+                       d_sorted_idx,
+                       d_conditions,
+                       d_pos,
+                       N,
+                       n_ghost,
+                       box,
+                       ci,
+                       ghost_width);
+
+    return hipSuccess;
+    }
+
+//! Kernel driver for gpu_fill_sorted_cell_list_kernel()
+hipError_t gpu_fill_sorted_cell_list(unsigned int* d_cell_size,
+                                     Scalar4* d_xyzf,
+                                     uint2* d_type_body,
+                                     Scalar4* d_cell_orientation,
+                                     unsigned int* d_cell_idx,
+                                     const unsigned int* d_cell_keys,
+                                     const unsigned int* d_sorted_idx,
+                                     const unsigned int* d_cell_start,
+                                     const unsigned int* d_exact_cell_size,
+                                     const Scalar4* d_pos,
+                                     const Scalar4* d_orientation,
+                                     const Scalar* d_charge,
+                                     const unsigned int* d_body,
+                                     const unsigned int n_total,
+                                     const bool flag_charge,
+                                     const bool flag_type,
+                                     const Index2D& cli,
+                                     const unsigned int block_size)
+    {
+    // the cell list is sized for the exact maximum occupancy, the sizes carry over directly
+    hipMemcpyAsync(d_cell_size,
+                   d_exact_cell_size,
+                   sizeof(unsigned int) * cli.getH(),
+                   hipMemcpyDeviceToDevice);
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, reinterpret_cast<const void*>(&gpu_fill_sorted_cell_list_kernel));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_fill_sorted_cell_list_kernel),
+                       dim3(n_total / run_block_size + 1),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       d_xyzf,
+                       d_type_body,
+                       d_cell_orientation,
+                       d_cell_idx,
+                       d_cell_keys,
+                       d_sorted_idx,
+                       d_cell_start,
+                       d_pos,
+                       d_orientation,
+                       d_charge,
+                       d_body,
+                       n_total,
+                       flag_charge,
+                       flag_type,
+                       cli);
+
+    return hipSuccess;
+    }
+
+//! Kernel that packs the finished cell list into quantized 8-byte entries
+/*! \param d_xyzf_q Quantized cell list to write
+    \param d_xyzf Cell list with position and flags
+    \param d_type_body Cell list with type,body
+    \param d_cell_size Number of particles in each cell
+    \param box Box dimensions the binning is based on
+    \param ghost_width Width of ghost cell layer
+    \param cli Indexer into the cell lists
+
+    One thread per cell list slot re-derives the fractional coordinate the binning used
+    and rounds it to 16 bits per axis, packing the particle type into the remaining
+    half word. Running over the assembled list covers the sorted, unsorted, combined
+    and locality-sorted build paths with a single pass, at the cost of one extra read
+    of data the traversal would otherwise fetch many times. Slots past the cell size
+    are zero filled so the array is fully defined.
+*/
+__global__ void gpu_quantize_cell_list_kernel(uint2* d_xyzf_q,
+                                              const Scalar4* d_xyzf,
+                                              const uint2* d_type_body,
+                                              const unsigned int* d_cell_size,
+                                              const BoxDim box,
+                                              const Scalar3 ghost_width,
+                                              const Index2D cli)
+    {
+    unsigned int idx = blockDim.x * blockIdx.x + threadIdx.x;
+    if (idx >= cli.getNumElements())
+        return;
+
+    const unsigned int cell = idx / cli.getW();
+    const unsigned int offset = idx % cli.getW();
+
+    if (offset >= d_cell_size[cell])
+        {
+        d_xyzf_q[idx] = make_uint2(0, 0);
+        return;
+        }
+
+    const Scalar4 xyzf = d_xyzf[idx];
+    Scalar3 f = box.makeFraction(make_scalar3(xyzf.x, xyzf.y, xyzf.z), ghost_width);
+
+    // valid entries lie inside the ghost-layer expanded box up to roundoff; clamp
+    // so that stragglers at the edges stay representable
+    f.x = f.x < Scalar(0.0) ? Scalar(0.0) : (f.x > Scalar(1.0) ? Scalar(1.0) : f.x);
+    f.y = f.y < Scalar(0.0) ? Scalar(0.0) : (f.y > Scalar(1.0) ? Scalar(1.0) : f.y);
+    f.z = f.z < Scalar(0.0) ? Scalar(0.0) : (f.z > Scalar(1.0) ? Scalar(1.0) : f.z);
+
+    const unsigned int qx = (unsigned int)(f.x * Scalar(65535.0) + Scalar(0.5));
+    const unsigned int qy = (unsigned int)(f.y * Scalar(65535.0) + Scalar(0.5));
+    const unsigned int qz = (unsigned int)(f.z * Scalar(65535.0) + Scalar(0.5));
+
+    const unsigned int type = d_type_body[idx].x;
+
+    d_xyzf_q[idx] = make_uint2(qx | (qy << 16), qz | (type << 16));
+    }
+
+/*! \param d_xyzf_q Quantized cell list to write
+    \param d_xyzf Cell list with position and flags
+    \param d_type_body Cell list with type,body
+    \param d_cell_size Number of particles in each cell
+    \param box Box dimensions the binning is based on
+    \param ghost_width Width of ghost cell layer
+    \param cli Indexer into the cell lists
+    \param block_size Block size to launch with
+*/
+hipError_t gpu_quantize_cell_list(uint2* d_xyzf_q,
+                                  const Scalar4* d_xyzf,
+                                  const uint2* d_type_body,
+                                  const unsigned int* d_cell_size,
+                                  const BoxDim& box,
+                                  const Scalar3& ghost_width,
+                                  const Index2D& cli,
+                                  const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, reinterpret_cast<const void*>(&gpu_quantize_cell_list_kernel));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_quantize_cell_list_kernel),
+                       dim3(cli.getNumElements() / run_block_size + 1),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       d_xyzf_q,
+                       d_xyzf,
+                       d_type_body,
+                       d_cell_size,
+                       box,
+                       ghost_width,
+                       cli);
+
+    return hipSuccess;
+    }
+
 __global__ void gpu_fill_indices_kernel(unsigned int cl_size,
                                         uint2* d_idx,
                                         unsigned int* d_sort_permutation,
@@ -43,6 +43,48 @@ void gpu_compute_cell_list(unsigned int* d_cell_size,
                            const unsigned int block_size,
                            const GPUPartition& gpu_partition);
 
+//! Kernel driver for gpu_compute_cell_keys_kernel()
+hipError_t gpu_compute_cell_keys(unsigned int* d_cell_keys,
+                                 unsigned int* d_sorted_idx,
+                                 uint3* d_conditions,
+                                 const Scalar4* d_pos,
+                                 const unsigned int N,
+                                 const unsigned int n_ghost,
+                                 const BoxDim& box,
+                                 const Index3D& ci,
+                                 const Scalar3& ghost_width,
+                                 const unsigned int block_size);
+
+//! Driver that sorts the cell keys and determines the exact occupancy of every cell
+hipError_t gpu_sort_cell_keys(unsigned int* d_cell_keys,
+                              unsigned int* d_sorted_idx,
+                              unsigned int* d_cell_start,
+                              unsigned int* d_exact_cell_size,
+                              unsigned int& max_cell_size,
+                              const unsigned int n_total,
+                              const unsigned int n_cells,
+                              const unsigned int block_size);
+
+//! Kernel driver for gpu_fill_sorted_cell_list_kernel()
+hipError_t gpu_fill_sorted_cell_list(unsigned int* d_cell_size,
+                                     Scalar4* d_xyzf,
+                                     uint2* d_type_body,
+                                     Scalar4* d_cell_orientation,
+                                     unsigned int* d_cell_idx,
+                                     const unsigned int* d_cell_keys,
+                                     const unsigned int* d_sorted_idx,
+                                     const unsigned int* d_cell_start,
+                                     const unsigned int* d_exact_cell_size,
+                                     const Scalar4* d_pos,
+                                     const Scalar4* d_orientation,
+                                     const Scalar* d_charge,
+                                     const unsigned int* d_body,
+                                     const unsigned int n_total,
+                                     const bool flag_charge,
+                                     const bool flag_type,
+                                     const Index2D& cli,
+                                     const unsigned int block_size);
+
 //! Driver function to combine the cell lists from different GPUs into one
 hipError_t gpu_combine_cell_lists(const unsigned int* d_cell_size_scratch,
                                   unsigned int* d_cell_size,
@@ -61,6 +103,16 @@ hipError_t gpu_combine_cell_lists(const unsigned int* d_cell_size_scratch,
                                   uint3* d_conditions,
                                   const GPUPartition& gpu_partition);
 
+//! Kernel driver for gpu_quantize_cell_list_kernel()
+hipError_t gpu_quantize_cell_list(uint2* d_xyzf_q,
+                                  const Scalar4* d_xyzf,
+                                  const uint2* d_type_body,
+                                  const unsigned int* d_cell_size,
+                                  const BoxDim& box,
+                                  const Scalar3& ghost_width,
+                                  const Index2D& cli,
+                                  const unsigned int block_size);
+
 hipError_t gpu_sort_cell_list(unsigned int* d_cell_size,
                               Scalar4* d_xyzf,
                               Scalar4* d_xyzf_new,
@@ -74,12 +74,18 @@ class PYBIND11_EXPORT CellListGPU : public CellList
     //! Compute the cell list
     virtual void computeCellList();
 
+    //! Build the cell list from a single radix sort of the particles by cell id
+    virtual void computeCellListSorted();
+
     // Initialize GPU-specific data storage
     virtual void initializeMemory();
 
     //! Combine the per-device cell lists
     virtual void combineCellLists();
 
+    //! Pack the finished cell list into the quantized compact array
+    void quantizeCellList();
+
     /// Autotune block sizes for main kernel.
     std::shared_ptr<Autotuner<1>> m_tuner;
 
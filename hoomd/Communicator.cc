@@ -11,7 +11,11 @@
 #include "System.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <cstddef>
+#include <cstring>
+#include <new>
 #include <pybind11/stl.h>
 
 using namespace std;
@@ -325,7 +329,7 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
                                                          access_location::host,
                                                          access_mode::read);
 
-            std::vector<MPI_Request> reqs;
+            m_reqs.clear();
             MPI_Request req;
 
             // loop over neighbors
@@ -344,7 +348,7 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
                               1,
                               m_comm.m_mpi_comm,
                               &req);
-                    reqs.push_back(req);
+                    m_reqs.push_back(req);
                     }
 
                 if (n_recv_groups[ineigh])
@@ -356,12 +360,12 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
                               1,
                               m_comm.m_mpi_comm,
                               &req);
-                    reqs.push_back(req);
+                    m_reqs.push_back(req);
                     }
                 }
 
-            std::vector<MPI_Status> stats(reqs.size());
-            MPI_Waitall((unsigned int)reqs.size(), &reqs.front(), &stats.front());
+            m_stats.resize(m_reqs.size());
+            MPI_Waitall((unsigned int)m_reqs.size(), &m_reqs.front(), &m_stats.front());
             }
 
             {
@@ -654,7 +658,7 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
                                                          access_location::host,
                                                          access_mode::read);
 
-            std::vector<MPI_Request> reqs;
+            m_reqs.clear();
             MPI_Request req;
 
             // loop over neighbors
@@ -673,7 +677,7 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
                               1,
                               m_comm.m_mpi_comm,
                               &req);
-                    reqs.push_back(req);
+                    m_reqs.push_back(req);
                     }
 
                 if (n_recv_groups[ineigh])
@@ -685,12 +689,12 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
                               1,
                               m_comm.m_mpi_comm,
                               &req);
-                    reqs.push_back(req);
+                    m_reqs.push_back(req);
                     }
                 }
 
-            std::vector<MPI_Status> stats(reqs.size());
-            MPI_Waitall((unsigned int)reqs.size(), &reqs.front(), &stats.front());
+            m_stats.resize(m_reqs.size());
+            MPI_Waitall((unsigned int)m_reqs.size(), &m_reqs.front(), &m_stats.front());
             }
 
         // use a std::map, i.e. single-key, to filter out duplicate groups in input buffer
@@ -785,6 +789,33 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
 
         // resize arrays to final size
         m_gdata->removeGroups(nremove);
+
+        // record which of the final local groups span rank boundaries, so the ghost
+        // marking pass that follows can skip the purely local ones
+            {
+            ArrayHandle<typename group_data::ranks_t> h_group_ranks(m_gdata->getRanksArray(),
+                                                                    access_location::host,
+                                                                    access_mode::read);
+            ArrayHandle<unsigned int> h_group_tag(m_gdata->getTags(),
+                                                  access_location::host,
+                                                  access_mode::read);
+
+            m_group_spans.assign(m_gdata->getRTags().getNumElements(), 0);
+            m_n_spanning = 0;
+            for (unsigned int group_idx = 0; group_idx < m_gdata->getN(); group_idx++)
+                {
+                typename group_data::ranks_t r = h_group_ranks.data[group_idx];
+                bool spans = false;
+                for (unsigned int i = 0; i < group_size; ++i)
+                    spans |= (r.idx[i] != myrank);
+                if (spans)
+                    {
+                    m_group_spans[h_group_tag.data[group_idx]] = 1;
+                    m_n_spanning++;
+                    }
+                }
+            m_spans_valid = true;
+            }
         }
     }
 
@@ -796,6 +827,15 @@ void Communicator::GroupCommunicator<group_data>::markGhostParticles(
     {
     if (m_gdata->getNGlobal())
         {
+        // consume the boundary-group flags recorded by the preceding migration; they are
+        // exact for the rank table that migration produced, but only for that one
+        const bool use_spans = m_spans_valid;
+        m_spans_valid = false;
+
+        // nothing to mark when no local group reaches across a rank boundary
+        if (use_spans && m_n_spanning == 0)
+            return;
+
         unsigned int group_size = group_data::size;
 
         ArrayHandle<typename group_data::members_t> h_groups(m_gdata->getMembersArray(),
@@ -804,6 +844,9 @@ void Communicator::GroupCommunicator<group_data>::markGhostParticles(
         ArrayHandle<typename group_data::ranks_t> h_group_ranks(m_gdata->getRanksArray(),
                                                                 access_location::host,
                                                                 access_mode::read);
+        ArrayHandle<unsigned int> h_group_tag(m_gdata->getTags(),
+                                              access_location::host,
+                                              access_mode::read);
         ArrayHandle<unsigned int> h_rtag(m_comm.m_pdata->getRTags(),
                                          access_location::host,
                                          access_mode::read);
@@ -826,6 +869,10 @@ void Communicator::GroupCommunicator<group_data>::markGhostParticles(
 
         for (unsigned int group_idx = 0; group_idx < ngroups; ++group_idx)
             {
+            // skip groups the migration recorded as purely local
+            if (use_spans && !m_group_spans[h_group_tag.data[group_idx]])
+                continue;
+
             typename group_data::members_t g = h_groups.data[group_idx];
             typename group_data::ranks_t r = h_group_ranks.data[group_idx];
 
@@ -900,7 +947,9 @@ void Communicator::GroupCommunicator<group_data>::markGhostParticles(
                                 flags &= ~(f.z > Scalar(0.5) ? send_down : send_up);
                                 }
 
-                            h_plan.data[rtag_j] |= flags;
+                            // bonded ghosts always belong to the every-step tier
+                            h_plan.data[rtag_j]
+                                = (h_plan.data[rtag_j] | flags) & ~(flags << intermittent_shift);
                             }
                         } // end inner loop over group members
                     }
@@ -919,7 +968,7 @@ void Communicator::GroupCommunicator<group_data>::exchangeGhostGroups(
         unsigned int group_size = group_data::size;
 
         // send plan for groups
-        std::vector<unsigned int> group_plan(m_gdata->getN(), 0);
+        m_group_plan.assign(m_gdata->getN(), 0);
 
             {
             ArrayHandle<typename group_data::members_t> h_groups(m_gdata->getMembersArray(),
@@ -965,7 +1014,7 @@ void Communicator::GroupCommunicator<group_data>::exchangeGhostGroups(
                     plan |= h_plan.data[pidx];
                     }
 
-                group_plan[group_idx] = plan;
+                m_group_plan[group_idx] = plan;
                 } // end loop over groups
             }
 
@@ -988,7 +1037,7 @@ void Communicator::GroupCommunicator<group_data>::exchangeGhostGroups(
              */
 
             // resize buffers
-            std::vector<unsigned int> plan_copybuf(m_gdata->getN(), 0);
+            m_plan_copybuf.assign(m_gdata->getN(), 0);
             m_groups_sendbuf.resize(m_gdata->getN());
             unsigned int num_copy_ghosts;
             unsigned int num_recv_ghosts;
@@ -999,7 +1048,7 @@ void Communicator::GroupCommunicator<group_data>::exchangeGhostGroups(
             unsigned int max_copy_ghosts = m_gdata->getN() + m_gdata->getNGhosts();
 
             // resize buffers
-            plan_copybuf.resize(max_copy_ghosts);
+            m_plan_copybuf.resize(max_copy_ghosts);
             m_groups_sendbuf.resize(max_copy_ghosts);
 
                 {
@@ -1018,10 +1067,10 @@ void Communicator::GroupCommunicator<group_data>::exchangeGhostGroups(
 
                 for (unsigned int idx = 0; idx < m_gdata->getN() + m_gdata->getNGhosts(); idx++)
                     {
-                    if (group_plan[idx] & (1 << dir))
+                    if (m_group_plan[idx] & (1 << dir))
                         {
                         // send plan
-                        plan_copybuf[num_copy_ghosts] = group_plan[idx];
+                        m_plan_copybuf[num_copy_ghosts] = m_group_plan[idx];
 
                         // pack group
                         typename group_data::packed_t el;
@@ -1060,21 +1109,21 @@ void Communicator::GroupCommunicator<group_data>::exchangeGhostGroups(
             unsigned int start_idx = m_gdata->getN() + m_gdata->getNGhosts();
 
             // resize plan array
-            group_plan.resize(m_gdata->getN() + m_gdata->getNGhosts() + num_recv_ghosts);
+            m_group_plan.resize(m_gdata->getN() + m_gdata->getNGhosts() + num_recv_ghosts);
 
             // resize recv buf
             m_groups_recvbuf.resize(num_recv_ghosts);
 
                 // exchange group data, write directly to the particle data arrays
                 {
-                MPI_Isend(&plan_copybuf.front(),
+                MPI_Isend(&m_plan_copybuf.front(),
                           int(num_copy_ghosts * sizeof(unsigned int)),
                           MPI_BYTE,
                           send_neighbor,
                           1,
                           m_comm.m_mpi_comm,
                           &reqs[0]);
-                MPI_Irecv(&group_plan.front() + start_idx,
+                MPI_Irecv(&m_group_plan.front() + start_idx,
                           int(num_recv_ghosts * sizeof(unsigned int)),
                           MPI_BYTE,
                           recv_neighbor,
@@ -1185,7 +1234,8 @@ Communicator::Communicator(std::shared_ptr<SystemDefinition> sysdef,
       m_velocity_copybuf(m_exec_conf), m_orientation_copybuf(m_exec_conf),
       m_plan_copybuf(m_exec_conf), m_tag_copybuf(m_exec_conf), m_netforce_copybuf(m_exec_conf),
       m_nettorque_copybuf(m_exec_conf), m_netvirial_copybuf(m_exec_conf),
-      m_netvirial_recvbuf(m_exec_conf), m_plan(m_exec_conf), m_plan_reverse(m_exec_conf),
+      m_netvirial_recvbuf(m_exec_conf), m_pos_qcopybuf(m_exec_conf), m_pos_qrecvbuf(m_exec_conf),
+      m_pos_ref_recvbuf(m_exec_conf), m_plan(m_exec_conf), m_plan_reverse(m_exec_conf),
       m_tag_reverse(m_exec_conf), m_netforce_reverse_copybuf(m_exec_conf),
       m_netforce_reverse_recvbuf(m_exec_conf), m_r_ghost_max(Scalar(0.0)), m_ghosts_added(0),
       m_has_ghost_particles(false), m_last_flags(0), m_comm_pending(false),
@@ -1211,8 +1261,12 @@ Communicator::Communicator(std::shared_ptr<SystemDefinition> sysdef,
         {
         GlobalVector<unsigned int> copy_ghosts(m_exec_conf);
         m_copy_ghosts[dir].swap(copy_ghosts);
+        GlobalVector<Scalar4> pos_ref_copybuf(m_exec_conf);
+        m_pos_ref_copybuf[dir].swap(pos_ref_copybuf);
         m_num_copy_ghosts[dir] = 0;
         m_num_recv_ghosts[dir] = 0;
+        m_num_copy_ghosts_update[dir] = 0;
+        m_num_recv_ghosts_update[dir] = 0;
         }
 
     // All buffers corresponding to sending ghosts in reverse
@@ -1242,6 +1296,9 @@ Communicator::Communicator(std::shared_ptr<SystemDefinition> sysdef,
     GlobalArray<Scalar> r_ghost(m_pdata->getNTypes(), m_exec_conf);
     m_r_ghost.swap(r_ghost);
 
+    GlobalArray<Scalar> r_ghost_update(m_pdata->getNTypes(), m_exec_conf);
+    m_r_ghost_update.swap(r_ghost_update);
+
     GlobalArray<Scalar> r_ghost_body(m_pdata->getNTypes(), m_exec_conf);
     m_r_ghost_body.swap(r_ghost_body);
 
@@ -1338,6 +1395,42 @@ Communicator::Communicator(std::shared_ptr<SystemDefinition> sysdef,
     MPI_Type_create_resized(tmp, 0, sizeof(detail::pdata_element), &m_mpi_pdata_element);
     MPI_Type_commit(&m_mpi_pdata_element);
     MPI_Type_free(&tmp);
+
+    /* create a second type that skips the orientation, angmom, and inertia fields for systems
+       without anisotropic degrees of freedom */
+    const int nitems_iso = 11;
+    int blocklengths_iso[11] = {4, 4, 3, 1, 1, 3, 1, 1, 4, 4, 6};
+    MPI_Datatype types_iso[11] = {MPI_HOOMD_SCALAR,
+                                  MPI_HOOMD_SCALAR,
+                                  MPI_HOOMD_SCALAR,
+                                  MPI_HOOMD_SCALAR,
+                                  MPI_HOOMD_SCALAR,
+                                  MPI_INT,
+                                  MPI_UNSIGNED,
+                                  MPI_UNSIGNED,
+                                  MPI_HOOMD_SCALAR,
+                                  MPI_HOOMD_SCALAR,
+                                  MPI_HOOMD_SCALAR};
+    MPI_Aint offsets_iso[11];
+
+    offsets_iso[0] = offsetof(detail::pdata_element, pos);
+    offsets_iso[1] = offsetof(detail::pdata_element, vel);
+    offsets_iso[2] = offsetof(detail::pdata_element, accel);
+    offsets_iso[3] = offsetof(detail::pdata_element, charge);
+    offsets_iso[4] = offsetof(detail::pdata_element, diameter);
+    offsets_iso[5] = offsetof(detail::pdata_element, image);
+    offsets_iso[6] = offsetof(detail::pdata_element, body);
+    offsets_iso[7] = offsetof(detail::pdata_element, tag);
+    offsets_iso[8] = offsetof(detail::pdata_element, net_force);
+    offsets_iso[9] = offsetof(detail::pdata_element, net_torque);
+    offsets_iso[10] = offsetof(detail::pdata_element, net_virial);
+
+    MPI_Type_create_struct(nitems_iso, blocklengths_iso, offsets_iso, types_iso, &tmp);
+    MPI_Type_commit(&tmp);
+
+    MPI_Type_create_resized(tmp, 0, sizeof(detail::pdata_element), &m_mpi_pdata_element_isotropic);
+    MPI_Type_commit(&m_mpi_pdata_element_isotropic);
+    MPI_Type_free(&tmp);
     }
 
 //! Destructor
@@ -1379,6 +1472,12 @@ Communicator::~Communicator()
         }
 
     MPI_Type_free(&m_mpi_pdata_element);
+    MPI_Type_free(&m_mpi_pdata_element_isotropic);
+
+    invalidateUpdateChannels();
+
+    if (m_shm_win != MPI_WIN_NULL)
+        MPI_Win_free(&m_shm_win);
     }
 
 void Communicator::updateMeshDefinition()
@@ -1509,6 +1608,16 @@ void Communicator::initializeNeighborArrays()
 //! Interface to the communication methods.
 void Communicator::communicate(uint64_t timestep)
     {
+    if (startGhostUpdate(timestep))
+        {
+        finishGhostUpdate(timestep);
+        }
+    }
+
+bool Communicator::startGhostUpdate(uint64_t timestep)
+    {
+    int64_t start = m_clock.getTime();
+
     // Guard to prevent recursive triggering of migration
     m_is_communicating = true;
 
@@ -1540,12 +1649,15 @@ void Communicator::communicate(uint64_t timestep)
 
     bool migrate = migrate_request || m_force_migrate || !m_has_ghost_particles;
 
-    // Update ghosts if we are not migrating
+    // Update ghosts if we are not migrating: start the non-blocking update and leave
+    // the finish to the caller so ghost-independent computation can overlap it
     if (!migrate && m_compute_callbacks.empty())
         {
         beginUpdateGhosts(timestep);
 
-        finishUpdateGhosts(timestep);
+        m_ghost_update_pending = true;
+        m_communicate_time += m_clock.getTime() - start;
+        return true;
         }
 
     // Check if migration of particles is requested
@@ -1566,6 +1678,25 @@ void Communicator::communicate(uint64_t timestep)
         }
 
     m_is_communicating = false;
+    m_communicate_time += m_clock.getTime() - start;
+    return false;
+    }
+
+void Communicator::finishGhostUpdate(uint64_t timestep)
+    {
+    if (!m_ghost_update_pending)
+        {
+        return;
+        }
+
+    int64_t start = m_clock.getTime();
+
+    finishUpdateGhosts(timestep);
+
+    m_ghost_update_pending = false;
+    m_is_communicating = false;
+
+    m_communicate_time += m_clock.getTime() - start;
     }
 
 //! Transfer particles between neighboring domains
@@ -1667,8 +1798,8 @@ void Communicator::migrateParticles()
             }
 
         // fill send buffer
-        std::vector<unsigned int> comm_flag_out; // not currently used
-        m_pdata->removeParticles(m_sendbuf, comm_flag_out);
+        m_comm_flag_out.clear(); // not currently used
+        m_pdata->removeParticles(m_sendbuf, m_comm_flag_out);
 
         unsigned int send_neighbor = m_decomposition->getNeighborRank(dir);
 
@@ -1694,19 +1825,24 @@ void Communicator::migrateParticles()
         // Resize receive buffer
         m_recvbuf.resize(n_recv_ptls);
 
+        // skip the orientation, angmom, and inertia fields when no consumer uses them
+        const bool aniso_data = m_pdata->isAnisotropicDataInUse();
+        MPI_Datatype mpi_pdata_element
+            = aniso_data ? m_mpi_pdata_element : m_mpi_pdata_element_isotropic;
+
         // exchange particle data
         m_reqs.resize(2);
         m_stats.resize(2);
         MPI_Isend(&m_sendbuf.front(),
                   n_send_ptls,
-                  m_mpi_pdata_element,
+                  mpi_pdata_element,
                   send_neighbor,
                   1,
                   m_mpi_comm,
                   &m_reqs[0]);
         MPI_Irecv(&m_recvbuf.front(),
                   n_recv_ptls,
-                  m_mpi_pdata_element,
+                  mpi_pdata_element,
                   recv_neighbor,
                   1,
                   m_mpi_comm,
@@ -1722,6 +1858,14 @@ void Communicator::migrateParticles()
             int3& image = p.image;
 
             shifted_box.wrap(postype, image);
+
+            if (!aniso_data)
+                {
+                // the anisotropic fields were not transmitted, restore their default values
+                p.orientation = make_scalar4(1, 0, 0, 0);
+                p.angmom = make_scalar4(0, 0, 0, 0);
+                p.inertia = make_scalar3(0, 0, 0);
+                }
             }
 
         // remove particles that were sent and fill particle data with received particles
@@ -1734,27 +1878,46 @@ void Communicator::updateGhostWidth()
         {
         // reset values (this may not be needed in most cases, but it doesn't harm to be safe
         ArrayHandle<Scalar> h_r_ghost(m_r_ghost, access_location::host, access_mode::overwrite);
+        ArrayHandle<Scalar> h_r_ghost_update(m_r_ghost_update,
+                                             access_location::host,
+                                             access_mode::overwrite);
         ArrayHandle<Scalar> h_r_ghost_body(m_r_ghost_body,
                                            access_location::host,
                                            access_mode::overwrite);
         for (unsigned int cur_type = 0; cur_type < m_pdata->getNTypes(); ++cur_type)
             {
             h_r_ghost.data[cur_type] = Scalar(0.0);
+            h_r_ghost_update.data[cur_type] = Scalar(0.0);
             h_r_ghost_body.data[cur_type] = Scalar(0.0);
             }
         }
 
     ArrayHandle<Scalar> h_r_ghost(m_r_ghost, access_location::host, access_mode::readwrite);
-    if (!m_ghost_layer_width_requests.empty())
+    if (!m_ghost_layer_width_requests.empty() || !m_intermittent_ghost_layer_width_requests.empty())
         {
         // update the ghost layer width only if subscribers are available
+        ArrayHandle<Scalar> h_r_ghost_update(m_r_ghost_update,
+                                             access_location::host,
+                                             access_mode::readwrite);
 
         // reduce per type using the signals, and then overall
         Scalar r_ghost_max = 0.0;
         for (unsigned int cur_type = 0; cur_type < m_pdata->getNTypes(); ++cur_type)
             {
-            Scalar r_ghost_i = 0.0;
+            // width of the every-step (thin) tier
+            Scalar r_ghost_update_i = 0.0;
             m_ghost_layer_width_requests.emit_accumulate(
+                [&](Scalar r)
+                {
+                    if (r > r_ghost_update_i)
+                        r_ghost_update_i = r;
+                },
+                cur_type);
+            h_r_ghost_update.data[cur_type] = r_ghost_update_i;
+
+            // the exchanged layer additionally covers the intermittently updated widths
+            Scalar r_ghost_i = r_ghost_update_i;
+            m_intermittent_ghost_layer_width_requests.emit_accumulate(
                 [&](Scalar r)
                 {
                     if (r > r_ghost_i)
@@ -1799,6 +1962,9 @@ void Communicator::exchangeGhosts()
 
     m_exec_conf->msg->notice(7) << "Communicator: exchange ghosts" << std::endl;
 
+    // the pattern, buffer addresses, and message sizes are about to change
+    invalidateUpdateChannels();
+
     const BoxDim& box = m_pdata->getBox();
 
     // Sending ghosts proceeds in two stages:
@@ -1825,6 +1991,9 @@ void Communicator::exchangeGhosts()
 
     // compute the ghost layer widths as fractions
     ArrayHandle<Scalar> h_r_ghost(m_r_ghost, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_ghost_update(m_r_ghost_update,
+                                         access_location::host,
+                                         access_mode::read);
     ArrayHandle<Scalar> h_r_ghost_body(m_r_ghost_body, access_location::host, access_mode::read);
     const Scalar3 box_dist = box.getNearestPlaneDistance();
 
@@ -1846,31 +2015,60 @@ void Communicator::exchangeGhosts()
             // get the ghost fraction for this particle type
             const unsigned int type = __scalar_as_int(postype.w);
             Scalar ghost_width = h_r_ghost.data[type];
+            Scalar update_width = h_r_ghost_update.data[type];
 
             if (h_body.data[idx] < MIN_FLOPPY)
                 {
                 ghost_width = std::max(ghost_width, h_r_ghost_body.data[type]);
+                update_width = std::max(update_width, h_r_ghost_body.data[type]);
                 }
             Scalar3 ghost_fraction = ghost_width / box_dist;
+            Scalar3 update_fraction = update_width / box_dist;
 
+            // particles inside the exchanged layer but outside the every-step layer are
+            // additionally marked as intermittent-tier only in that direction
             Scalar3 f = box.makeFraction(pos);
             if (f.x >= Scalar(1.0) - ghost_fraction.x)
+                {
                 h_plan.data[idx] |= send_east;
+                if (f.x < Scalar(1.0) - update_fraction.x)
+                    h_plan.data[idx] |= send_east << intermittent_shift;
+                }
 
             if (f.x < ghost_fraction.x)
+                {
                 h_plan.data[idx] |= send_west;
+                if (f.x >= update_fraction.x)
+                    h_plan.data[idx] |= send_west << intermittent_shift;
+                }
 
             if (f.y >= Scalar(1.0) - ghost_fraction.y)
+                {
                 h_plan.data[idx] |= send_north;
+                if (f.y < Scalar(1.0) - update_fraction.y)
+                    h_plan.data[idx] |= send_north << intermittent_shift;
+                }
 
             if (f.y < ghost_fraction.y)
+                {
                 h_plan.data[idx] |= send_south;
+                if (f.y >= update_fraction.y)
+                    h_plan.data[idx] |= send_south << intermittent_shift;
+                }
 
             if (f.z >= Scalar(1.0) - ghost_fraction.z)
+                {
                 h_plan.data[idx] |= send_up;
+                if (f.z < Scalar(1.0) - update_fraction.z)
+                    h_plan.data[idx] |= send_up << intermittent_shift;
+                }
 
             if (f.z < ghost_fraction.z)
+                {
                 h_plan.data[idx] |= send_down;
+                if (f.z >= update_fraction.z)
+                    h_plan.data[idx] |= send_down << intermittent_shift;
+                }
             }
         }
 
@@ -2009,10 +2207,20 @@ void Communicator::exchangeGhosts()
                                                        access_location::host,
                                                        access_mode::overwrite);
 
-            for (unsigned int idx = 0; idx < m_pdata->getN() + m_pdata->getNGhosts(); idx++)
+            // pack the every-step (thin) tier first so that per-step updates can send a
+            // contiguous prefix of the ghost list
+            for (unsigned int pass = 0; pass < 2; ++pass)
                 {
-                if (h_plan.data[idx] & (1 << dir))
+                for (unsigned int idx = 0; idx < m_pdata->getN() + m_pdata->getNGhosts(); idx++)
                     {
+                    if (!(h_plan.data[idx] & (1 << dir)))
+                        continue;
+
+                    bool intermittent
+                        = h_plan.data[idx] & (1 << (dir + intermittent_shift));
+                    if ((pass == 0) == intermittent)
+                        continue;
+
                     // send with next message
                     if (flags[comm_flag::position])
                         h_pos_copybuf.data[m_num_copy_ghosts[dir]] = h_pos.data[idx];
@@ -2034,6 +2242,9 @@ void Communicator::exchangeGhosts()
                     h_copy_ghosts.data[m_num_copy_ghosts[dir]] = h_tag.data[idx];
                     m_num_copy_ghosts[dir]++;
                     }
+
+                if (pass == 0)
+                    m_num_copy_ghosts_update[dir] = m_num_copy_ghosts[dir];
                 }
             }
         unsigned int send_neighbor = m_decomposition->getNeighborRank(dir);
@@ -2066,7 +2277,26 @@ void Communicator::exchangeGhosts()
                   &req);
         m_reqs.push_back(req);
 
-        m_stats.resize(2);
+        // the receiver also needs to know how many of the incoming ghosts belong to the
+        // every-step tier
+        MPI_Isend(&m_num_copy_ghosts_update[dir],
+                  sizeof(unsigned int),
+                  MPI_BYTE,
+                  send_neighbor,
+                  10,
+                  m_mpi_comm,
+                  &req);
+        m_reqs.push_back(req);
+        MPI_Irecv(&m_num_recv_ghosts_update[dir],
+                  sizeof(unsigned int),
+                  MPI_BYTE,
+                  recv_neighbor,
+                  10,
+                  m_mpi_comm,
+                  &req);
+        m_reqs.push_back(req);
+
+        m_stats.resize(m_reqs.size());
         MPI_Waitall((unsigned int)m_reqs.size(), &m_reqs.front(), &m_stats.front());
 
         // append ghosts at the end of particle data array
@@ -2624,9 +2854,297 @@ void Communicator::exchangeGhosts()
 
             } // end dir loop
         }
+
+    // the compressed update format needs reference positions matching the new ghost lists
+    m_qpos_active = m_compressed_ghost_updates;
+    if (m_qpos_active)
+        captureGhostUpdateReferences();
+
+    // (re)establish or tear down the shared-memory ghost update window to match the new lists
+    if (m_shm_ghosts_requested)
+        setupSharedMemoryGhosts();
+    else if (m_shm_win != MPI_WIN_NULL)
+        {
+        MPI_Win_free(&m_shm_win);
+        m_shm_peer_base.clear();
+        m_shm_capacity = 0;
+        }
+    }
+
+namespace
+    {
+//! Control block at the head of each rank's shared-memory ghost segment
+/*! Each rank owns one region per (direction, field) pair that it fills with the ghost data
+    it sends along that direction. The node-local receiver reads the region directly. The
+    produced/consumed counters carry the sequence number of the ghost update they refer to
+    and implement a single-producer/single-consumer handshake per region.
+ */
+struct shm_ghost_header
+    {
+    std::atomic<uint64_t> produced[18]; //!< Update last written per (direction, field) region
+    std::atomic<uint64_t> consumed[6];  //!< Update last read per direction (set by the peer)
+    size_t offset[18];                  //!< Byte offset of every (direction, field) region
+    };
+    } // end anonymous namespace
+
+/*! Allocates (or grows) the MPI-3 shared-memory window over the node-local communicator and
+    refreshes the per-direction region offsets for the current m_num_copy_ghosts. Must be called
+    collectively on all ranks of the partition.
+ */
+void Communicator::setupSharedMemoryGhosts()
+    {
+    auto mpi_conf = m_exec_conf->getMPIConfig();
+    MPI_Comm node_comm = mpi_conf->getNodeCommunicator();
+
+    // payload: one region per (direction, field) pair, sized for the particles sent that way
+    size_t needed = sizeof(shm_ghost_header);
+    for (unsigned int dir = 0; dir < 6; dir++)
+        needed += 3 * m_num_copy_ghosts[dir] * sizeof(Scalar4);
+
+    // reallocation is collective, so grow when any node member outgrew its segment
+    int realloc_needed = (m_shm_win == MPI_WIN_NULL || needed > m_shm_capacity) ? 1 : 0;
+    MPI_Allreduce(MPI_IN_PLACE, &realloc_needed, 1, MPI_INT, MPI_MAX, node_comm);
+
+    if (realloc_needed)
+        {
+        if (m_shm_win != MPI_WIN_NULL)
+            MPI_Win_free(&m_shm_win);
+
+        // pad the allocation so that slowly growing ghost counts do not reallocate every time
+        m_shm_capacity = needed + needed / 2;
+
+        char* base = NULL;
+        MPI_Win_allocate_shared((MPI_Aint)m_shm_capacity,
+                                1,
+                                MPI_INFO_NULL,
+                                node_comm,
+                                &base,
+                                &m_shm_win);
+
+        // cache the segment base pointer of every node member
+        int node_size;
+        MPI_Comm_size(node_comm, &node_size);
+        m_shm_peer_base.resize(node_size);
+        for (int i = 0; i < node_size; i++)
+            {
+            MPI_Aint size;
+            int disp_unit;
+            MPI_Win_shared_query(m_shm_win, i, &size, &disp_unit, &m_shm_peer_base[i]);
+            }
+
+        // start all handshake counters from the current update sequence
+        shm_ghost_header* header = new (base) shm_ghost_header;
+        for (unsigned int i = 0; i < 18; i++)
+            header->produced[i].store(m_shm_seq, std::memory_order_relaxed);
+        for (unsigned int dir = 0; dir < 6; dir++)
+            header->consumed[dir].store(m_shm_seq, std::memory_order_relaxed);
+        }
+
+    // refresh the region offsets for the current ghost counts
+    int node_rank;
+    MPI_Comm_rank(node_comm, &node_rank);
+    shm_ghost_header* header = reinterpret_cast<shm_ghost_header*>(m_shm_peer_base[node_rank]);
+    size_t offset = sizeof(shm_ghost_header);
+    for (unsigned int dir = 0; dir < 6; dir++)
+        for (unsigned int field = 0; field < 3; field++)
+            {
+            header->offset[3 * dir + field] = offset;
+            offset += m_num_copy_ghosts[dir] * sizeof(Scalar4);
+            }
+
+    // peers must not read the refreshed offsets before they are in place
+    MPI_Barrier(node_comm);
+    }
+
+/*! Snapshots the full-precision position of every ghost in the current exchange pattern:
+    per direction the positions this rank sends (including forwarded ghosts), and per ghost
+    slot the positions it received. Between exchanges the buffer distance check limits every
+    displacement to half the neighbor list buffer, so offsets against these references fit
+    comfortably in the 16-bit range spanned by the ghost layer width. The scale is reduced to
+    the global maximum so that both ends of every channel decode with identical factors.
+ */
+void Communicator::captureGhostUpdateReferences()
+    {
+    Scalar range = m_r_ghost_max;
+    MPI_Allreduce(MPI_IN_PLACE, &range, 1, MPI_HOOMD_SCALAR, MPI_MAX, m_mpi_comm);
+    m_qpos_scale = (range > Scalar(0.0)) ? range : Scalar(1.0);
+
+    for (unsigned int dir = 0; dir < 6; dir++)
+        m_pos_ref_copybuf[dir].resize(m_num_copy_ghosts[dir]);
+    m_pos_ref_recvbuf.resize(m_pdata->getNGhosts());
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
+                                     access_location::host,
+                                     access_mode::read);
+
+    for (unsigned int dir = 0; dir < 6; dir++)
+        {
+        if (!isCommunicating(dir))
+            continue;
+
+        ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir],
+                                                access_location::host,
+                                                access_mode::read);
+        ArrayHandle<Scalar4> h_pos_ref(m_pos_ref_copybuf[dir],
+                                       access_location::host,
+                                       access_mode::overwrite);
+
+        for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
+            {
+            unsigned int idx = h_rtag.data[h_copy_ghosts.data[ghost_idx]];
+            assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
+            h_pos_ref.data[ghost_idx] = h_pos.data[idx];
+            }
+        }
+
+        {
+        ArrayHandle<Scalar4> h_pos_ref_recv(m_pos_ref_recvbuf,
+                                            access_location::host,
+                                            access_mode::overwrite);
+        for (unsigned int i = 0; i < m_pdata->getNGhosts(); i++)
+            h_pos_ref_recv.data[i] = h_pos.data[m_pdata->getN() + i];
+        }
     }
 
 //! update positions of ghost particles
+void Communicator::setupUpdateChannels()
+    {
+    // release any channels from the previous pattern
+    invalidateUpdateChannels();
+
+    const bool use_shm = (m_shm_win != MPI_WIN_NULL);
+    auto mpi_conf = m_exec_conf->getMPIConfig();
+
+    CommFlags flags = getFlags();
+    const bool field_active[3]
+        = {flags[comm_flag::position], flags[comm_flag::velocity], flags[comm_flag::orientation]};
+
+    // the compressed buffers are reused across directions, size them for the largest message
+    if (m_qpos_active)
+        {
+        unsigned int max_copy = 0;
+        unsigned int max_recv = 0;
+        for (unsigned int dir = 0; dir < 6; dir++)
+            {
+            max_copy = std::max(max_copy, m_num_copy_ghosts[dir]);
+            max_recv = std::max(max_recv, m_num_recv_ghosts[dir]);
+            }
+        m_pos_qcopybuf.resize(max_copy);
+        m_pos_qrecvbuf.resize(max_recv);
+        }
+
+    // the registered addresses stay valid between ghost exchanges: the particle data arrays and
+    // the copy buffers are only reallocated during migration / ghost exchange, which invalidates
+    // the channels
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                       access_location::host,
+                                       access_mode::read);
+    ArrayHandle<Scalar4> h_pos_copybuf(m_pos_copybuf, access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_vel_copybuf(m_velocity_copybuf,
+                                       access_location::host,
+                                       access_mode::read);
+    ArrayHandle<Scalar4> h_orientation_copybuf(m_orientation_copybuf,
+                                               access_location::host,
+                                               access_mode::read);
+    ArrayHandle<qpos_element> h_pos_qcopybuf(m_pos_qcopybuf,
+                                             access_location::host,
+                                             access_mode::read);
+    ArrayHandle<qpos_element> h_pos_qrecvbuf(m_pos_qrecvbuf,
+                                             access_location::host,
+                                             access_mode::read);
+
+    Scalar4* send_bufs[3] = {h_pos_copybuf.data, h_vel_copybuf.data, h_orientation_copybuf.data};
+    Scalar4* recv_bufs[3] = {h_pos.data, h_vel.data, h_orientation.data};
+
+    unsigned int num_tot_recv_ghosts = 0;
+
+    for (unsigned int dir = 0; dir < 6; dir++)
+        {
+        if (!isCommunicating(dir))
+            continue;
+
+        unsigned int send_neighbor = m_decomposition->getNeighborRank(dir);
+        unsigned int recv_neighbor;
+        if (dir % 2 == 0)
+            recv_neighbor = m_decomposition->getNeighborRank(dir + 1);
+        else
+            recv_neighbor = m_decomposition->getNeighborRank(dir - 1);
+
+        // the ghost slots are laid out by the full pattern regardless of the tier updated
+        const unsigned int start_idx = m_pdata->getN() + num_tot_recv_ghosts;
+        num_tot_recv_ghosts += m_num_recv_ghosts[dir];
+
+        // node-local neighbors are served through the shared-memory window
+        const bool send_shm = use_shm && mpi_conf->isNodeLocal(send_neighbor);
+        const bool recv_shm = use_shm && mpi_conf->isNodeLocal(recv_neighbor);
+
+        for (unsigned int tier = 0; tier < 2; tier++)
+            {
+            const unsigned int num_copy
+                = (tier == 0) ? m_num_copy_ghosts[dir] : m_num_copy_ghosts_update[dir];
+            const unsigned int num_recv
+                = (tier == 0) ? m_num_recv_ghosts[dir] : m_num_recv_ghosts_update[dir];
+
+            for (unsigned int field = 0; field < 3; field++)
+                {
+                if (!field_active[field])
+                    continue;
+
+                // positions travel in the compressed wire format when it is active; off-node
+                // receives then land in the staging buffer and are reconstructed on unpack
+                const bool qpos = m_qpos_active && field == 0;
+                void* send_buf = qpos ? (void*)h_pos_qcopybuf.data : (void*)send_bufs[field];
+                void* recv_buf
+                    = qpos ? (void*)h_pos_qrecvbuf.data : (void*)(recv_bufs[field] + start_idx);
+                const size_t elem_size = qpos ? sizeof(qpos_element) : sizeof(Scalar4);
+
+                unsigned int nreq = 0;
+                MPI_Request* reqs = m_update_channel_reqs[tier][dir][field];
+                if (!send_shm)
+                    {
+                    MPI_Send_init(send_buf,
+                                  (unsigned int)(num_copy * elem_size),
+                                  MPI_BYTE,
+                                  send_neighbor,
+                                  field + 1,
+                                  m_mpi_comm,
+                                  &reqs[nreq++]);
+                    }
+                if (!recv_shm)
+                    {
+                    MPI_Recv_init(recv_buf,
+                                  (unsigned int)(num_recv * elem_size),
+                                  MPI_BYTE,
+                                  recv_neighbor,
+                                  field + 1,
+                                  m_mpi_comm,
+                                  &reqs[nreq++]);
+                    }
+                m_num_update_channel_reqs[tier][dir][field] = nreq;
+                }
+            }
+        }
+
+    m_update_channels_valid = true;
+    }
+
+void Communicator::invalidateUpdateChannels()
+    {
+    for (unsigned int tier = 0; tier < 2; tier++)
+        for (unsigned int dir = 0; dir < 6; dir++)
+            for (unsigned int field = 0; field < 3; field++)
+                {
+                for (unsigned int i = 0; i < m_num_update_channel_reqs[tier][dir][field]; i++)
+                    MPI_Request_free(&m_update_channel_reqs[tier][dir][field][i]);
+                m_num_update_channel_reqs[tier][dir][field] = 0;
+                }
+
+    m_update_channels_valid = false;
+    }
+
 void Communicator::beginUpdateGhosts(uint64_t timestep)
     {
     // we have a current m_copy_ghosts liss which contain the indices of particles
@@ -2635,6 +3153,31 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
 
     // update data in these arrays
 
+    // every update advances the shared-memory handshake sequence on all ranks
+    const bool use_shm = (m_shm_win != MPI_WIN_NULL);
+    if (use_shm)
+        m_shm_seq++;
+    auto mpi_conf = m_exec_conf->getMPIConfig();
+
+    // determine whether the intermittent (thick) ghost tier needs fresh data this step, or
+    // only the every-step (thin) tier; without subscribers all ghosts are updated
+    bool full_update = true;
+    if (!m_intermittent_ghost_layer_width_requests.empty()
+        && !m_full_ghost_update_requests.empty())
+        {
+        full_update = false;
+        m_full_ghost_update_requests.emit_accumulate(
+            [&](bool r) { full_update = full_update || r; },
+            timestep);
+        }
+
+    // the exchange pattern is fixed between ghost exchanges: register it once as persistent
+    // requests and only restart them every step
+    if (!m_update_channels_valid)
+        setupUpdateChannels();
+
+    const unsigned int tier = full_update ? 0 : 1;
+
     unsigned int num_tot_recv_ghosts = 0; // total number of ghosts received
 
     for (unsigned int dir = 0; dir < 6; dir++)
@@ -2644,14 +3187,36 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
 
         CommFlags flags = getFlags();
 
+        // the every-step tier is a prefix of the per-direction ghost lists
+        const unsigned int num_copy
+            = full_update ? m_num_copy_ghosts[dir] : m_num_copy_ghosts_update[dir];
+        const unsigned int num_recv
+            = full_update ? m_num_recv_ghosts[dir] : m_num_recv_ghosts_update[dir];
+
+        unsigned int send_neighbor = m_decomposition->getNeighborRank(dir);
+
+        // we receive from the direction opposite to the one we send to
+        unsigned int recv_neighbor;
+        if (dir % 2 == 0)
+            recv_neighbor = m_decomposition->getNeighborRank(dir + 1);
+        else
+            recv_neighbor = m_decomposition->getNeighborRank(dir - 1);
+
+        unsigned int start_idx;
+
+        start_idx = m_pdata->getN() + num_tot_recv_ghosts;
+
+        num_tot_recv_ghosts += m_num_recv_ghosts[dir];
+
+        // node-local neighbors are served through the shared-memory window, all others via MPI
+        const bool send_shm = use_shm && mpi_conf->isNodeLocal(send_neighbor);
+        const bool recv_shm = use_shm && mpi_conf->isNodeLocal(recv_neighbor);
+
         if (flags[comm_flag::position])
             {
             ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
                                        access_location::host,
                                        access_mode::read);
-            ArrayHandle<Scalar4> h_pos_copybuf(m_pos_copybuf,
-                                               access_location::host,
-                                               access_mode::overwrite);
             ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir],
                                                     access_location::host,
                                                     access_mode::read);
@@ -2659,15 +3224,62 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                                              access_location::host,
                                              access_mode::read);
 
-            // copy positions of ghost particles
-            for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
+            // the shared-memory transport always carries full precision
+            if (!m_qpos_active || send_shm)
                 {
-                unsigned int idx = h_rtag.data[h_copy_ghosts.data[ghost_idx]];
+                ArrayHandle<Scalar4> h_pos_copybuf(m_pos_copybuf,
+                                                   access_location::host,
+                                                   access_mode::overwrite);
 
-                assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
+                // copy positions of ghost particles
+                for (unsigned int ghost_idx = 0; ghost_idx < num_copy; ghost_idx++)
+                    {
+                    unsigned int idx = h_rtag.data[h_copy_ghosts.data[ghost_idx]];
+
+                    assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
 
-                // copy position into send buffer
-                h_pos_copybuf.data[ghost_idx] = h_pos.data[idx];
+                    // copy position into send buffer
+                    h_pos_copybuf.data[ghost_idx] = h_pos.data[idx];
+                    }
+                }
+
+            if (m_qpos_active && !send_shm)
+                {
+                ArrayHandle<Scalar4> h_pos_ref(m_pos_ref_copybuf[dir],
+                                               access_location::host,
+                                               access_mode::read);
+                ArrayHandle<qpos_element> h_pos_qcopybuf(m_pos_qcopybuf,
+                                                         access_location::host,
+                                                         access_mode::overwrite);
+
+                // encode positions as fixed-point offsets from the last ghost exchange; the
+                // clamp is defensive, the distance check keeps displacements inside the range
+                const Scalar s = Scalar(32767.0) / m_qpos_scale;
+                auto quantize = [s](Scalar delta) -> int16_t
+                    {
+                    long v = std::lround(delta * s);
+                    if (v > 32767)
+                        v = 32767;
+                    if (v < -32767)
+                        v = -32767;
+                    return (int16_t)v;
+                    };
+
+                for (unsigned int ghost_idx = 0; ghost_idx < num_copy; ghost_idx++)
+                    {
+                    unsigned int idx = h_rtag.data[h_copy_ghosts.data[ghost_idx]];
+
+                    assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
+
+                    const Scalar4 pos = h_pos.data[idx];
+                    const Scalar4 ref = h_pos_ref.data[ghost_idx];
+                    qpos_element q;
+                    q.dx = quantize(pos.x - ref.x);
+                    q.dy = quantize(pos.y - ref.y);
+                    q.dz = quantize(pos.z - ref.z);
+                    q.pad = 0;
+                    h_pos_qcopybuf.data[ghost_idx] = q;
+                    }
                 }
             }
 
@@ -2687,7 +3299,7 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                                              access_mode::read);
 
             // copy velocity of ghost particles
-            for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
+            for (unsigned int ghost_idx = 0; ghost_idx < num_copy; ghost_idx++)
                 {
                 unsigned int idx = h_rtag.data[h_copy_ghosts.data[ghost_idx]];
 
@@ -2714,7 +3326,7 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                                              access_mode::read);
 
             // copy orientation of ghost particles
-            for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
+            for (unsigned int ghost_idx = 0; ghost_idx < num_copy; ghost_idx++)
                 {
                 unsigned int idx = h_rtag.data[h_copy_ghosts.data[ghost_idx]];
 
@@ -2725,28 +3337,31 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                 }
             }
 
-        unsigned int send_neighbor = m_decomposition->getNeighborRank(dir);
-
-        // we receive from the direction opposite to the one we send to
-        unsigned int recv_neighbor;
-        if (dir % 2 == 0)
-            recv_neighbor = m_decomposition->getNeighborRank(dir + 1);
-        else
-            recv_neighbor = m_decomposition->getNeighborRank(dir - 1);
-
-        unsigned int start_idx;
+        shm_ghost_header* my_header = NULL;
+        char* my_base = NULL;
+        if (send_shm)
+            {
+            my_base = m_shm_peer_base[mpi_conf->getNodeRank(m_exec_conf->getRank())];
+            my_header = reinterpret_cast<shm_ghost_header*>(my_base);
 
-        start_idx = m_pdata->getN() + num_tot_recv_ghosts;
+            // wait until the peer has drained the previous update from our regions
+            while (my_header->consumed[dir].load(std::memory_order_acquire) < m_shm_seq - 1)
+                {
+                }
+            }
 
-        num_tot_recv_ghosts += m_num_recv_ghosts[dir];
+        shm_ghost_header* peer_header = NULL;
+        char* peer_base = NULL;
+        if (recv_shm)
+            {
+            peer_base = m_shm_peer_base[mpi_conf->getNodeRank(recv_neighbor)];
+            peer_header = reinterpret_cast<shm_ghost_header*>(peer_base);
+            }
 
         // only non-permanent fields (position, velocity, orientation) need to be considered here
         // charge, body, image and diameter are not updated between neighbor list builds
         if (flags[comm_flag::position])
             {
-            m_reqs.resize(2);
-            m_stats.resize(2);
-
             ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
                                        access_location::host,
                                        access_mode::readwrite);
@@ -2754,29 +3369,61 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                                                access_location::host,
                                                access_mode::read);
 
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_pos_copybuf.data,
-                      (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      send_neighbor,
-                      1,
-                      m_mpi_comm,
-                      &m_reqs[0]);
-            MPI_Irecv(h_pos.data + start_idx,
-                      (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      recv_neighbor,
-                      1,
-                      m_mpi_comm,
-                      &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
+            if (send_shm)
+                {
+                // publish the packed positions in our shared region
+                memcpy(my_base + my_header->offset[3 * dir],
+                       h_pos_copybuf.data,
+                       num_copy * sizeof(Scalar4));
+                my_header->produced[3 * dir].store(m_shm_seq, std::memory_order_release);
+                }
+            if (recv_shm)
+                {
+                // spin until the peer published this update, then copy directly into pdata
+                while (peer_header->produced[3 * dir].load(std::memory_order_acquire) < m_shm_seq)
+                    {
+                    }
+                memcpy(h_pos.data + start_idx,
+                       peer_base + peer_header->offset[3 * dir],
+                       num_recv * sizeof(Scalar4));
+                }
+            if (!send_shm || !recv_shm)
+                {
+                // restart the preregistered channel, writing directly to the particle data
+                const unsigned int nreq = m_num_update_channel_reqs[tier][dir][0];
+                MPI_Request* reqs = m_update_channel_reqs[tier][dir][0];
+                MPI_Startall(nreq, reqs);
+                m_stats.resize(nreq);
+                MPI_Waitall(nreq, reqs, &m_stats.front());
+                }
+
+            if (m_qpos_active && !recv_shm)
+                {
+                ArrayHandle<qpos_element> h_pos_qrecvbuf(m_pos_qrecvbuf,
+                                                         access_location::host,
+                                                         access_mode::read);
+                ArrayHandle<Scalar4> h_pos_ref_recv(m_pos_ref_recvbuf,
+                                                    access_location::host,
+                                                    access_mode::read);
+
+                // reconstruct full positions against the references of the last exchange; the
+                // type (w component) is constant between exchanges and comes from the reference
+                const Scalar s = m_qpos_scale / Scalar(32767.0);
+                const unsigned int ref_offset = start_idx - m_pdata->getN();
+                for (unsigned int i = 0; i < num_recv; i++)
+                    {
+                    const qpos_element q = h_pos_qrecvbuf.data[i];
+                    const Scalar4 ref = h_pos_ref_recv.data[ref_offset + i];
+                    h_pos.data[start_idx + i] = make_scalar4(ref.x + Scalar(q.dx) * s,
+                                                             ref.y + Scalar(q.dy) * s,
+                                                             ref.z + Scalar(q.dz) * s,
+                                                             ref.w);
+                    }
+                }
             }
 
         if (flags[comm_flag::velocity])
             {
-            m_reqs.resize(2);
-            m_stats.resize(2);
-
             ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
                                        access_location::host,
                                        access_mode::readwrite);
@@ -2784,29 +3431,35 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                                                access_location::host,
                                                access_mode::read);
 
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_vel_copybuf.data,
-                      (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      send_neighbor,
-                      2,
-                      m_mpi_comm,
-                      &m_reqs[0]);
-            MPI_Irecv(h_vel.data + start_idx,
-                      (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      recv_neighbor,
-                      2,
-                      m_mpi_comm,
-                      &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
+            if (send_shm)
+                {
+                memcpy(my_base + my_header->offset[3 * dir + 1],
+                       h_vel_copybuf.data,
+                       num_copy * sizeof(Scalar4));
+                my_header->produced[3 * dir + 1].store(m_shm_seq, std::memory_order_release);
+                }
+            if (recv_shm)
+                {
+                while (peer_header->produced[3 * dir + 1].load(std::memory_order_acquire)
+                       < m_shm_seq)
+                    {
+                    }
+                memcpy(h_vel.data + start_idx,
+                       peer_base + peer_header->offset[3 * dir + 1],
+                       num_recv * sizeof(Scalar4));
+                }
+            if (!send_shm || !recv_shm)
+                {
+                const unsigned int nreq = m_num_update_channel_reqs[tier][dir][1];
+                MPI_Request* reqs = m_update_channel_reqs[tier][dir][1];
+                MPI_Startall(nreq, reqs);
+                m_stats.resize(nreq);
+                MPI_Waitall(nreq, reqs, &m_stats.front());
+                }
             }
 
         if (flags[comm_flag::orientation])
             {
-            m_reqs.resize(2);
-            m_stats.resize(2);
-
             ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
                                                access_location::host,
                                                access_mode::readwrite);
@@ -2814,24 +3467,37 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                                                        access_location::host,
                                                        access_mode::read);
 
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_orientation_copybuf.data,
-                      (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      send_neighbor,
-                      3,
-                      m_mpi_comm,
-                      &m_reqs[0]);
-            MPI_Irecv(h_orientation.data + start_idx,
-                      (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      recv_neighbor,
-                      3,
-                      m_mpi_comm,
-                      &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
+            if (send_shm)
+                {
+                memcpy(my_base + my_header->offset[3 * dir + 2],
+                       h_orientation_copybuf.data,
+                       num_copy * sizeof(Scalar4));
+                my_header->produced[3 * dir + 2].store(m_shm_seq, std::memory_order_release);
+                }
+            if (recv_shm)
+                {
+                while (peer_header->produced[3 * dir + 2].load(std::memory_order_acquire)
+                       < m_shm_seq)
+                    {
+                    }
+                memcpy(h_orientation.data + start_idx,
+                       peer_base + peer_header->offset[3 * dir + 2],
+                       num_recv * sizeof(Scalar4));
+                }
+            if (!send_shm || !recv_shm)
+                {
+                const unsigned int nreq = m_num_update_channel_reqs[tier][dir][2];
+                MPI_Request* reqs = m_update_channel_reqs[tier][dir][2];
+                MPI_Startall(nreq, reqs);
+                m_stats.resize(nreq);
+                MPI_Waitall(nreq, reqs, &m_stats.front());
+                }
             }
 
+        // all fields of this direction are in, release the peer's regions for the next update
+        if (recv_shm)
+            peer_header->consumed[dir].store(m_shm_seq, std::memory_order_release);
+
         // wrap particle positions (only if copying positions)
         if (flags[comm_flag::position])
             {
@@ -2840,7 +3506,7 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                                        access_mode::readwrite);
 
             const BoxDim shifted_box = getShiftedBox();
-            for (unsigned int idx = start_idx; idx < start_idx + m_num_recv_ghosts[dir]; idx++)
+            for (unsigned int idx = start_idx; idx < start_idx + num_recv; idx++)
                 {
                 Scalar4& pos = h_pos.data[idx];
 
@@ -3409,7 +4075,14 @@ void export_Communicator(pybind11::module& m)
         .def(pybind11::init<std::shared_ptr<SystemDefinition>,
                             std::shared_ptr<DomainDecomposition>>())
         .def("addMeshDefinition", &Communicator::addMeshDefinition)
-        .def_property_readonly("domain_decomposition", &Communicator::getDomainDecomposition);
+        .def_property("use_shared_memory_ghosts",
+                      &Communicator::getUseSharedMemoryGhosts,
+                      &Communicator::setUseSharedMemoryGhosts)
+        .def_property("compressed_ghost_updates",
+                      &Communicator::getCompressedGhostUpdates,
+                      &Communicator::setCompressedGhostUpdates)
+        .def_property_readonly("domain_decomposition", &Communicator::getDomainDecomposition)
+        .def_property_readonly("communicate_time", &Communicator::getCommunicateTime);
     }
     } // end namespace detail
 
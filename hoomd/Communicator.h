@@ -11,6 +11,7 @@
 #define __COMMUNICATOR_H__
 
 #include "BondedGroupData.h"
+#include "ClockSource.h"
 #include "DomainDecomposition.h"
 #include "GPUVector.h"
 #include "GlobalArray.h"
@@ -19,6 +20,7 @@
 #include "MeshGroupData.h"
 #include "ParticleData.h"
 
+#include <cstdint>
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
 #include <memory>
 
@@ -178,6 +180,31 @@ class PYBIND11_EXPORT Communicator
         return m_ghost_layer_width_requests;
         }
 
+    //! Subscribe to list of functions that request an intermittently updated ghost layer width
+    /*! Widths requested through this signal extend the ghost layer exchanged at migration, but
+     * the extra (thick) tier receives per-step position updates only on time steps for which a
+     * subscriber of getFullGhostUpdateRequestSignal() requests them. Consumers that need current
+     * ghost data on every time step must use getGhostLayerWidthRequestSignal() instead.
+     * \return A Nano::Signal object reference to be used for connect and disconnect calls.
+     */
+    Nano::Signal<Scalar(unsigned int type)>& getIntermittentGhostLayerWidthRequestSignal()
+        {
+        return m_intermittent_ghost_layer_width_requests;
+        }
+
+    //! Subscribe to list of functions that determine when the thick ghost tier is refreshed
+    /*! When both this signal and the intermittent width request signal have subscribers,
+     * per-step ghost updates carry only the ghosts within the every-step (thin) width unless one
+     * of the subscribers returns true for the current time step. Without subscribers all ghosts
+     * are updated on every time step.
+     * \note Subscribers must return the same value on every rank for a given time step.
+     * \return A Nano::Signal object reference to be used for connect and disconnect calls.
+     */
+    Nano::Signal<bool(uint64_t timestep)>& getFullGhostUpdateRequestSignal()
+        {
+        return m_full_ghost_update_requests;
+        }
+
     //! Subscribe to list of functions that request a minimum ghost layer width for rigid bodies.
     /*! This method keeps track of all functions that request a minimum ghost layer width.
      * The actual ghost layer width is chosen from the max over the inputs, which is a function
@@ -293,6 +320,30 @@ class PYBIND11_EXPORT Communicator
      */
     void communicate(uint64_t timestep);
 
+    /*! Start the per-step communication, overlapping the ghost update when possible
+     *
+     * When no migration is required and no compute callbacks are registered, this
+     * starts the non-blocking ghost position update and returns true; the caller may
+     * overlap ghost-independent computation and must then call finishGhostUpdate().
+     * Otherwise the full synchronous communication is performed and false is returned.
+     *
+     * \param timestep The time step
+     * \returns true when a ghost update is in flight
+     */
+    bool startGhostUpdate(uint64_t timestep);
+
+    /*! Complete a ghost update started by startGhostUpdate()
+     *
+     * \param timestep The time step
+     */
+    void finishGhostUpdate(uint64_t timestep);
+
+    //! Get the wall time spent communicating since creation, in seconds
+    double getCommunicateTime() const
+        {
+        return double(m_communicate_time) / 1e9;
+        }
+
     //@}
 
     //! Force particle migration
@@ -355,6 +406,43 @@ class PYBIND11_EXPORT Communicator
      */
     virtual void exchangeGhosts();
 
+    //! Enable or disable the shared-memory transport for ghost updates
+    /*! When enabled, per-step ghost updates to neighbor ranks on the same node are
+        exchanged through an MPI-3 shared-memory window with flag-based synchronization
+        instead of MPI messages; off-node neighbors always use MPI. The window is (re)built
+        on the next exchangeGhosts(), so this must be set collectively on all ranks.
+     */
+    void setUseSharedMemoryGhosts(bool enable)
+        {
+        m_shm_ghosts_requested = enable;
+        }
+
+    //! Returns true when the shared-memory ghost transport is requested
+    bool getUseSharedMemoryGhosts() const
+        {
+        return m_shm_ghosts_requested;
+        }
+
+    //! Enable or disable compressed per-step ghost position updates
+    /*! When enabled, ghost positions sent to off-node neighbors in per-step updates are
+        communicated as 16-bit fixed-point offsets relative to the positions of the last
+        ghost exchange instead of full precision, reducing ghost position traffic four-fold
+        in double precision builds. The offsets are exact to within one part in 32767 of the
+        ghost layer width; the buffer distance check rebuilds the ghost lists before any
+        particle displaces further than that range. Takes effect at the next ghost exchange
+        and must be set collectively on all ranks.
+     */
+    void setCompressedGhostUpdates(bool enable)
+        {
+        m_compressed_ghost_updates = enable;
+        }
+
+    //! Returns true when compressed ghost position updates are requested
+    bool getCompressedGhostUpdates() const
+        {
+        return m_compressed_ghost_updates;
+        }
+
     //! \name Enumerations
     //@{
 
@@ -383,6 +471,13 @@ class PYBIND11_EXPORT Communicator
         send_down = 32
         };
 
+    //! Shift applied to the itinerary flags to mark a direction as intermittent-tier only
+    /*! A send flag shifted by this amount marks a ghost that is needed in that direction only
+        by subscribers of getIntermittentGhostLayerWidthRequestSignal(); such ghosts are packed
+        after the every-step tier and skipped in per-step updates without a full-update request.
+     */
+    static const unsigned int intermittent_shift = 8;
+
     //@}
     virtual void updateMeshDefinition();
 
@@ -442,6 +537,24 @@ class PYBIND11_EXPORT Communicator
             m_groups_sendbuf; //!< Send buffer for group elements
         std::vector<typename group_data::packed_t>
             m_groups_recvbuf; //!< Receive buffer for group elements
+
+        /* Reusable scratch buffers: these keep their capacity across calls so
+           steady-state migrations and ghost exchanges do not allocate. */
+        std::vector<MPI_Request> m_reqs;          //!< MPI requests of the current exchange
+        std::vector<MPI_Status> m_stats;          //!< MPI statuses of the current exchange
+        std::vector<unsigned int> m_group_plan;   //!< Send plans per local group
+        std::vector<unsigned int> m_plan_copybuf; //!< Send buffer for ghost group plans
+
+        /* Boundary-group tracking: migrateGroups() records, per group tag, whether the
+           group spans rank boundaries after the migration it performed. The ghost marking
+           pass immediately following in exchangeGhosts() then skips the (typically vast)
+           majority of groups that are purely local instead of re-deriving the boundary
+           set from the rank table. The flags are consumed once per migration; any call
+           path that reaches markGhostParticles() without a fresh migration falls back to
+           the full scan. */
+        std::vector<char> m_group_spans;  //!< Per group tag, 1 if the group spans ranks
+        unsigned int m_n_spanning = 0;    //!< Number of boundary-spanning local groups
+        bool m_spans_valid = false;       //!< True when m_group_spans matches the rank table
         };
 
     //! Returns true if we are communicating particles along a given direction
@@ -475,8 +588,12 @@ class PYBIND11_EXPORT Communicator
     std::shared_ptr<DomainDecomposition> m_decomposition;      //!< Domain decomposition information
 
     bool m_is_communicating; //!< Whether we are currently communicating
+    bool m_ghost_update_pending = false; //!< True while a started ghost update awaits finish
     bool m_force_migrate;    //!< True if particle migration is forced
 
+    ClockSource m_clock;              //!< Clock used to time communication
+    int64_t m_communicate_time = 0;   //!< Total wall time spent communicating, in nanoseconds
+
     unsigned int m_is_at_boundary[6]; //!< Array of flags indicating whether this box lies at a
                                       //!< global boundary
 
@@ -508,6 +625,69 @@ class PYBIND11_EXPORT Communicator
         m_num_copy_ghosts[6]; //!< Number of local particles that are sent to neighboring processors
     unsigned int m_num_recv_ghosts[6]; //!< Number of ghosts received per direction
 
+    unsigned int m_num_copy_ghosts_update[6]; //!< Number of sent ghosts in the every-step tier
+    unsigned int m_num_recv_ghosts_update[6]; //!< Number of received ghosts in the every-step tier
+
+    //! (Re)create the shared-memory ghost window after a ghost exchange
+    /*! Called collectively at the end of exchangeGhosts() when the shared-memory transport
+        is requested. Allocates (or grows) the MPI-3 shared window and refreshes the
+        per-direction offsets for the current ghost counts.
+     */
+    void setupSharedMemoryGhosts();
+
+    bool m_shm_ghosts_requested = false; //!< True when the shared-memory transport is requested
+    MPI_Win m_shm_win = MPI_WIN_NULL;    //!< Shared-memory window for node-local ghost updates
+    std::vector<char*> m_shm_peer_base;  //!< Segment base pointer of every node-local peer
+    size_t m_shm_capacity = 0;           //!< Payload capacity of the local segment in bytes
+    uint64_t m_shm_seq = 0;              //!< Sequence number of the current ghost update
+
+    //! Register persistent MPI requests for the current per-step ghost update pattern
+    /*! The neighbor topology, message sizes, and buffer addresses are fixed between ghost
+        exchanges, so the send/recv pattern of beginUpdateGhosts() is registered once with
+        MPI_Send_init/MPI_Recv_init and restarted with MPI_Startall every step, avoiding the
+        per-message request construction of MPI_Isend/MPI_Irecv.
+     */
+    void setupUpdateChannels();
+
+    //! Free the persistent ghost update requests (called when the pattern is rebuilt)
+    void invalidateUpdateChannels();
+
+    /// Persistent requests, indexed by tier (0 = full, 1 = every-step), direction, and field
+    /// (0 = position, 1 = velocity, 2 = orientation); at most one send and one receive each
+    MPI_Request m_update_channel_reqs[2][6][3][2];
+    /// Number of active persistent requests per tier/direction/field
+    unsigned int m_num_update_channel_reqs[2][6][3] = {};
+    /// True when the persistent requests match the current ghost exchange pattern
+    bool m_update_channels_valid = false;
+
+    //! A ghost position update in the compressed wire format
+    /*! Three 16-bit fixed-point offsets relative to the position sent at the last ghost
+        exchange, in units of m_qpos_scale / 32767; the pad keeps elements eight bytes.
+     */
+    struct qpos_element
+        {
+        int16_t dx; //!< Offset in x
+        int16_t dy; //!< Offset in y
+        int16_t dz; //!< Offset in z
+        int16_t pad;
+        };
+
+    //! Record the reference positions the compressed updates are encoded against
+    /*! Called collectively at the end of exchangeGhosts(); snapshots the position of every
+        sent and received ghost and agrees on the fixed-point scale across ranks.
+     */
+    void captureGhostUpdateReferences();
+
+    bool m_compressed_ghost_updates = false; //!< True when compressed updates are requested
+    bool m_qpos_active = false;  //!< True when references for the current ghost lists exist
+    Scalar m_qpos_scale = Scalar(1.0); //!< Offset magnitude mapped to the full 16-bit range
+    GlobalVector<qpos_element> m_pos_qcopybuf; //!< Send buffer for compressed position updates
+    GlobalVector<qpos_element> m_pos_qrecvbuf; //!< Receive buffer for compressed updates
+    GlobalVector<Scalar4>
+        m_pos_ref_copybuf[6]; //!< Per-direction sent-ghost positions at the last exchange
+    GlobalVector<Scalar4>
+        m_pos_ref_recvbuf; //!< Per-slot received-ghost positions at the last exchange
+
     GlobalVector<unsigned int>
         m_plan; //!< Array of per-direction flags that determine the sending route
 
@@ -553,15 +733,18 @@ class PYBIND11_EXPORT Communicator
     GlobalVector<Scalar4> m_netforce_reverse_recvbuf; //!< Buffer for the reverse net force. Receive
                                                       //!< buffer for m_netforce_reverse_copybuf
 
-    BoxDim m_global_box;                //!< Global simulation box
-    GlobalArray<Scalar> m_r_ghost;      //!< Width of ghost layer
-    GlobalArray<Scalar> m_r_ghost_body; //!< Extra ghost width for rigid bodies
-    Scalar m_r_ghost_max;               //!< Maximum ghost layer width
+    BoxDim m_global_box;                  //!< Global simulation box
+    GlobalArray<Scalar> m_r_ghost;        //!< Width of ghost layer
+    GlobalArray<Scalar> m_r_ghost_update; //!< Width of the every-step (thin) ghost tier
+    GlobalArray<Scalar> m_r_ghost_body;   //!< Extra ghost width for rigid bodies
+    Scalar m_r_ghost_max;                 //!< Maximum ghost layer width
 
     unsigned int m_ghosts_added; //!< Number of ghosts added
     bool m_has_ghost_particles;  //!< True if we have a current copy of ghost particles
 
     MPI_Datatype m_mpi_pdata_element; //!< A datatype for the (non-packed) pdata_element struct
+    MPI_Datatype m_mpi_pdata_element_isotropic; //!< A pdata_element datatype that skips the
+                                                //!< orientation, angmom, and inertia fields
 
     //! Update the ghost width array
     void updateGhostWidth();
@@ -576,6 +759,14 @@ class PYBIND11_EXPORT Communicator
         m_ghost_layer_width_requests; //!< List of functions that request a minimum ghost layer
                                       //!< width
 
+    Nano::Signal<Scalar(unsigned int type)>
+        m_intermittent_ghost_layer_width_requests; //!< List of functions that request a minimum
+                                                   //!< width for the intermittently updated tier
+
+    Nano::Signal<bool(uint64_t timestep)>
+        m_full_ghost_update_requests; //!< List of functions that may request a full (thick tier)
+                                      //!< ghost update on a given time step
+
     /// List of functions that compute the body ghost layer width.
     Nano::Signal<Scalar(unsigned int type, Scalar* h_r_ghost)> m_body_ghost_layer_width_requests;
 
@@ -684,6 +875,8 @@ class PYBIND11_EXPORT Communicator
     private:
     std::vector<detail::pdata_element> m_sendbuf; //!< Buffer for particles that are sent
     std::vector<detail::pdata_element> m_recvbuf; //!< Buffer for particles that are received
+    std::vector<unsigned int>
+        m_comm_flag_out; //!< Reusable scratch for the unused removeParticles flag output
 
     /* Communication of bonded groups */
     GroupCommunicator<BondData> m_bond_comm; //!< Communication helper for bonds
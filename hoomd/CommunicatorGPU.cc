@@ -12,6 +12,7 @@
 #include "System.h"
 
 #include <algorithm>
+#include <cstring>
 
 namespace hoomd
     {
@@ -48,6 +49,7 @@ CommunicatorGPU::CommunicatorGPU(std::shared_ptr<SystemDefinition> sysdef,
 CommunicatorGPU::~CommunicatorGPU()
     {
     m_exec_conf->msg->notice(5) << "Destroying CommunicatorGPU";
+    teardownPeerGhosts();
     hipEventDestroy(m_event);
     }
 
@@ -2921,6 +2923,237 @@ void CommunicatorGPU::exchangeGhosts()
     m_constraint_comm.exchangeGhostGroups(m_ghost_plan);
 
     m_last_flags = flags;
+
+    // the ghost lists and send buffer layout changed: rebuild the peer mappings
+    setupPeerGhosts();
+    }
+
+void CommunicatorGPU::teardownPeerGhosts()
+    {
+    for (auto ptr : m_peer_mapped_bufs)
+        {
+        hipIpcCloseMemHandle(ptr);
+        }
+    m_peer_mapped_bufs.clear();
+    m_peer_pos_sendbuf.clear();
+    m_peer_vel_sendbuf.clear();
+    m_peer_orientation_sendbuf.clear();
+    m_peer_ghost_begin.clear();
+
+    if (m_pos_ghost_sendbuf_ipc)
+        {
+        hipFree(m_pos_ghost_sendbuf_ipc);
+        m_pos_ghost_sendbuf_ipc = nullptr;
+        }
+    if (m_vel_ghost_sendbuf_ipc)
+        {
+        hipFree(m_vel_ghost_sendbuf_ipc);
+        m_vel_ghost_sendbuf_ipc = nullptr;
+        }
+    if (m_orientation_ghost_sendbuf_ipc)
+        {
+        hipFree(m_orientation_ghost_sendbuf_ipc);
+        m_orientation_ghost_sendbuf_ipc = nullptr;
+        }
+
+    m_peer_ghosts_active = false;
+    }
+
+/*! (Re)establish the CUDA IPC handle table used by the peer-to-peer ghost transport.
+
+    Called collectively from exchangeGhosts() whenever the ghost lists change. Every rank
+    exports an unmanaged device copy of its per-step send buffers through an IPC handle,
+    sends the handle and its span offsets to each neighbor, and maps the neighbors'
+    buffers into its own address space. The transport only activates when every rank of
+    the partition talks to node-local neighbors exclusively, so the per-step barrier
+    handshake in beginUpdateGhosts() matches up on all ranks.
+*/
+void CommunicatorGPU::setupPeerGhosts()
+    {
+    // drop mappings of the previous ghost lists
+    teardownPeerGhosts();
+
+    if (!m_peer_ghosts_requested)
+        return;
+
+    auto mpi_conf = m_exec_conf->getMPIConfig();
+
+    ArrayHandle<unsigned int> h_unique_neighbors(m_unique_neighbors,
+                                                 access_location::host,
+                                                 access_mode::read);
+
+    // decide collectively whether every neighbor of every rank shares the node
+    char node_local = 1;
+    for (unsigned int ineigh = 0; ineigh < m_n_unique_neigh; ineigh++)
+        {
+        if (!mpi_conf->isNodeLocal(h_unique_neighbors.data[ineigh]))
+            node_local = 0;
+        }
+
+    char all_node_local = 0;
+    MPI_Allreduce(&node_local, &all_node_local, 1, MPI_CHAR, MPI_LAND, m_mpi_comm);
+    if (!all_node_local)
+        {
+        m_exec_conf->msg->notice(6) << "CommunicatorGPU: off-node neighbors present, not "
+                                       "using peer-to-peer ghost updates"
+                                    << std::endl;
+        return;
+        }
+
+    // IPC handles of this rank's send buffers
+    struct peer_ghost_handles
+        {
+        hipIpcMemHandle_t pos;
+        hipIpcMemHandle_t vel;
+        hipIpcMemHandle_t orientation;
+        char valid;
+        };
+
+    peer_ghost_handles my_handles;
+    memset(&my_handles, 0, sizeof(my_handles));
+
+    // IPC cannot export managed memory: stage the pack output in plain device buffers
+    size_t n_send_elements = m_pos_ghost_sendbuf.getNumElements();
+    if (n_send_elements)
+        {
+        my_handles.valid
+            = (hipMalloc(&m_pos_ghost_sendbuf_ipc, n_send_elements * sizeof(Scalar4))
+                   == hipSuccess
+               && hipMalloc(&m_vel_ghost_sendbuf_ipc, n_send_elements * sizeof(Scalar4))
+                      == hipSuccess
+               && hipMalloc(&m_orientation_ghost_sendbuf_ipc, n_send_elements * sizeof(Scalar4))
+                      == hipSuccess
+               && hipIpcGetMemHandle(&my_handles.pos, m_pos_ghost_sendbuf_ipc) == hipSuccess
+               && hipIpcGetMemHandle(&my_handles.vel, m_vel_ghost_sendbuf_ipc) == hipSuccess
+               && hipIpcGetMemHandle(&my_handles.orientation, m_orientation_ghost_sendbuf_ipc)
+                      == hipSuccess);
+        }
+
+    // exchange handles and per-stage span offsets with every neighbor
+    ArrayHandle<unsigned int> h_ghost_begin(m_ghost_begin,
+                                            access_location::host,
+                                            access_mode::read);
+
+    std::vector<peer_ghost_handles> peer_handles(m_n_unique_neigh);
+    std::vector<unsigned int> send_begin(m_n_unique_neigh * m_num_stages);
+    std::vector<unsigned int> recv_begin(m_n_unique_neigh * m_num_stages);
+
+    m_reqs.clear();
+    MPI_Request req;
+    for (unsigned int ineigh = 0; ineigh < m_n_unique_neigh; ineigh++)
+        {
+        unsigned int neighbor = h_unique_neighbors.data[ineigh];
+
+        for (unsigned int stage = 0; stage < m_num_stages; ++stage)
+            {
+            send_begin[ineigh * m_num_stages + stage]
+                = h_ghost_begin.data[ineigh + stage * m_n_unique_neigh];
+            }
+
+        MPI_Isend(&my_handles, sizeof(peer_ghost_handles), MPI_BYTE, neighbor, 20, m_mpi_comm, &req);
+        m_reqs.push_back(req);
+        MPI_Irecv(&peer_handles[ineigh],
+                  sizeof(peer_ghost_handles),
+                  MPI_BYTE,
+                  neighbor,
+                  20,
+                  m_mpi_comm,
+                  &req);
+        m_reqs.push_back(req);
+
+        MPI_Isend(&send_begin[ineigh * m_num_stages],
+                  int(m_num_stages * sizeof(unsigned int)),
+                  MPI_BYTE,
+                  neighbor,
+                  21,
+                  m_mpi_comm,
+                  &req);
+        m_reqs.push_back(req);
+        MPI_Irecv(&recv_begin[ineigh * m_num_stages],
+                  int(m_num_stages * sizeof(unsigned int)),
+                  MPI_BYTE,
+                  neighbor,
+                  21,
+                  m_mpi_comm,
+                  &req);
+        m_reqs.push_back(req);
+        }
+
+    std::vector<MPI_Status> stats(m_reqs.size());
+    MPI_Waitall((unsigned int)m_reqs.size(), &m_reqs.front(), &stats.front());
+
+    // map the neighbors' buffers into this address space
+    m_peer_pos_sendbuf.resize(m_n_unique_neigh, nullptr);
+    m_peer_vel_sendbuf.resize(m_n_unique_neigh, nullptr);
+    m_peer_orientation_sendbuf.resize(m_n_unique_neigh, nullptr);
+    m_peer_ghost_begin.resize(m_n_unique_neigh);
+
+    char ok = 1;
+    for (unsigned int ineigh = 0; ineigh < m_n_unique_neigh; ineigh++)
+        {
+        m_peer_ghost_begin[ineigh].assign(recv_begin.begin() + ineigh * m_num_stages,
+                                          recv_begin.begin() + (ineigh + 1) * m_num_stages);
+
+        if (!peer_handles[ineigh].valid)
+            {
+            // acceptable only when this peer never sends to us
+            for (unsigned int stage = 0; stage < m_num_stages; ++stage)
+                {
+                if (m_n_recv_ghosts[stage][ineigh])
+                    ok = 0;
+                }
+            continue;
+            }
+
+        void* pos_ptr = nullptr;
+        void* vel_ptr = nullptr;
+        void* orientation_ptr = nullptr;
+        if (hipIpcOpenMemHandle(&pos_ptr,
+                                peer_handles[ineigh].pos,
+                                hipIpcMemLazyEnablePeerAccess)
+                == hipSuccess
+            && hipIpcOpenMemHandle(&vel_ptr,
+                                   peer_handles[ineigh].vel,
+                                   hipIpcMemLazyEnablePeerAccess)
+                   == hipSuccess
+            && hipIpcOpenMemHandle(&orientation_ptr,
+                                   peer_handles[ineigh].orientation,
+                                   hipIpcMemLazyEnablePeerAccess)
+                   == hipSuccess)
+            {
+            m_peer_pos_sendbuf[ineigh] = (Scalar4*)pos_ptr;
+            m_peer_vel_sendbuf[ineigh] = (Scalar4*)vel_ptr;
+            m_peer_orientation_sendbuf[ineigh] = (Scalar4*)orientation_ptr;
+            }
+        else
+            {
+            ok = 0;
+            }
+
+        // record whatever was opened so a partial failure is cleaned up
+        if (pos_ptr)
+            m_peer_mapped_bufs.push_back(pos_ptr);
+        if (vel_ptr)
+            m_peer_mapped_bufs.push_back(vel_ptr);
+        if (orientation_ptr)
+            m_peer_mapped_bufs.push_back(orientation_ptr);
+        }
+
+    // the transport is all-or-nothing across the partition
+    char all_ok = 0;
+    MPI_Allreduce(&ok, &all_ok, 1, MPI_CHAR, MPI_LAND, m_mpi_comm);
+    if (!all_ok)
+        {
+        m_exec_conf->msg->notice(3) << "CommunicatorGPU: could not establish CUDA IPC "
+                                       "mappings, falling back to MPI ghost updates"
+                                    << std::endl;
+        teardownPeerGhosts();
+        return;
+        }
+
+    m_peer_ghosts_active = true;
+    m_exec_conf->msg->notice(6) << "CommunicatorGPU: using peer-to-peer ghost updates"
+                                << std::endl;
     }
 
 //! Perform ghosts update
@@ -2968,6 +3201,16 @@ void CommunicatorGPU::beginUpdateGhosts(uint64_t timestep)
             const Index3D& di = m_pdata->getDomainDecomposition()->getDomainIndexer();
             uint3 my_pos = m_pdata->getDomainDecomposition()->getGridPos();
 
+            // in peer-to-peer mode, pack into the IPC-exported buffers the neighbors pull
+            // from
+            Scalar4* pos_sendbuf
+                = m_peer_ghosts_active ? m_pos_ghost_sendbuf_ipc : d_pos_ghost_sendbuf.data;
+            Scalar4* vel_sendbuf
+                = m_peer_ghosts_active ? m_vel_ghost_sendbuf_ipc : d_vel_ghost_sendbuf.data;
+            Scalar4* orientation_sendbuf = m_peer_ghosts_active
+                                               ? m_orientation_ghost_sendbuf_ipc
+                                               : d_orientation_ghost_sendbuf.data;
+
             // Pack ghosts into send buffers
             gpu_exchange_ghosts_pack(m_n_send_ghosts_tot[stage],
                                      d_ghost_idx_adj.data + m_idx_offs[stage],
@@ -2980,13 +3223,13 @@ void CommunicatorGPU::beginUpdateGhosts(uint64_t timestep)
                                      NULL,
                                      d_orientation.data,
                                      NULL,
-                                     d_pos_ghost_sendbuf.data,
-                                     d_vel_ghost_sendbuf.data,
+                                     pos_sendbuf,
+                                     vel_sendbuf,
                                      NULL,
                                      NULL,
                                      NULL,
                                      NULL,
-                                     d_orientation_ghost_sendbuf.data,
+                                     orientation_sendbuf,
                                      false,
                                      flags[comm_flag::position],
                                      flags[comm_flag::velocity],
@@ -3018,28 +3261,6 @@ void CommunicatorGPU::beginUpdateGhosts(uint64_t timestep)
 
             {
             unsigned int offs = 0;
-            // access particle data
-            // recv buffers
-            ArrayHandle<Scalar4> pos_ghost_recvbuf_handle(m_pos_ghost_recvbuf,
-                                                          access_location::host,
-                                                          access_mode::overwrite);
-            ArrayHandle<Scalar4> vel_ghost_recvbuf_handle(m_vel_ghost_recvbuf,
-                                                          access_location::host,
-                                                          access_mode::overwrite);
-            ArrayHandle<Scalar4> orientation_ghost_recvbuf_handle(m_orientation_ghost_recvbuf,
-                                                                  access_location::host,
-                                                                  access_mode::overwrite);
-
-            // send buffers
-            ArrayHandleAsync<Scalar4> pos_ghost_sendbuf_handle(m_pos_ghost_sendbuf,
-                                                               access_location::host,
-                                                               access_mode::read);
-            ArrayHandleAsync<Scalar4> vel_ghost_sendbuf_handle(m_vel_ghost_sendbuf,
-                                                               access_location::host,
-                                                               access_mode::read);
-            ArrayHandleAsync<Scalar4> orientation_ghost_sendbuf_handle(m_orientation_ghost_sendbuf,
-                                                                       access_location::host,
-                                                                       access_mode::read);
 
             ArrayHandleAsync<unsigned int> h_unique_neighbors(m_unique_neighbors,
                                                               access_location::host,
@@ -3048,118 +3269,264 @@ void CommunicatorGPU::beginUpdateGhosts(uint64_t timestep)
                                                          access_location::host,
                                                          access_mode::read);
 
-            // lump together into one synchronization call
-            hipEventRecord(m_event);
-            hipEventSynchronize(m_event);
-
-            // access send buffers
-            m_reqs.clear();
-            MPI_Request req;
-
-            unsigned int send_bytes = 0;
-            unsigned int recv_bytes = 0;
-
-            // loop over neighbors
-            for (unsigned int ineigh = 0; ineigh < m_n_unique_neigh; ineigh++)
+            // post all sends and receives for this stage from the given buffers
+            auto post_ghost_exchange = [&](const Scalar4* pos_ghost_sendbuf,
+                                           const Scalar4* vel_ghost_sendbuf,
+                                           const Scalar4* orientation_ghost_sendbuf,
+                                           Scalar4* pos_ghost_recvbuf,
+                                           Scalar4* vel_ghost_recvbuf,
+                                           Scalar4* orientation_ghost_recvbuf)
                 {
-                // rank of neighbor processor
-                unsigned int neighbor = h_unique_neighbors.data[ineigh];
+                m_reqs.clear();
+                MPI_Request req;
 
-                if (flags[comm_flag::position])
+                unsigned int send_bytes = 0;
+                unsigned int recv_bytes = 0;
+
+                // loop over neighbors
+                for (unsigned int ineigh = 0; ineigh < m_n_unique_neigh; ineigh++)
                     {
-                    if (m_n_send_ghosts[stage][ineigh])
-                        {
-                        MPI_Isend(pos_ghost_sendbuf_handle.data
-                                      + h_ghost_begin.data[ineigh + stage * m_n_unique_neigh],
-                                  int(m_n_send_ghosts[stage][ineigh] * sizeof(Scalar4)),
-                                  MPI_BYTE,
-                                  neighbor,
-                                  2,
-                                  m_mpi_comm,
-                                  &req);
-                        m_reqs.push_back(req);
-                        }
-                    send_bytes += (unsigned int)(m_n_send_ghosts[stage][ineigh] * sizeof(Scalar4));
+                    // rank of neighbor processor
+                    unsigned int neighbor = h_unique_neighbors.data[ineigh];
 
-                    if (m_n_recv_ghosts[stage][ineigh])
+                    if (flags[comm_flag::position])
                         {
-                        MPI_Irecv(pos_ghost_recvbuf_handle.data + m_ghost_offs[stage][ineigh]
-                                      + offs,
-                                  int(m_n_recv_ghosts[stage][ineigh] * sizeof(Scalar4)),
-                                  MPI_BYTE,
-                                  neighbor,
-                                  2,
-                                  m_mpi_comm,
-                                  &req);
-                        m_reqs.push_back(req);
+                        if (m_n_send_ghosts[stage][ineigh])
+                            {
+                            MPI_Isend(pos_ghost_sendbuf
+                                          + h_ghost_begin.data[ineigh + stage * m_n_unique_neigh],
+                                      int(m_n_send_ghosts[stage][ineigh] * sizeof(Scalar4)),
+                                      MPI_BYTE,
+                                      neighbor,
+                                      2,
+                                      m_mpi_comm,
+                                      &req);
+                            m_reqs.push_back(req);
+                            }
+                        send_bytes
+                            += (unsigned int)(m_n_send_ghosts[stage][ineigh] * sizeof(Scalar4));
+
+                        if (m_n_recv_ghosts[stage][ineigh])
+                            {
+                            MPI_Irecv(pos_ghost_recvbuf + m_ghost_offs[stage][ineigh] + offs,
+                                      int(m_n_recv_ghosts[stage][ineigh] * sizeof(Scalar4)),
+                                      MPI_BYTE,
+                                      neighbor,
+                                      2,
+                                      m_mpi_comm,
+                                      &req);
+                            m_reqs.push_back(req);
+                            }
+                        recv_bytes
+                            += (unsigned int)(m_n_recv_ghosts[stage][ineigh] * sizeof(Scalar4));
                         }
-                    recv_bytes += (unsigned int)(m_n_recv_ghosts[stage][ineigh] * sizeof(Scalar4));
-                    }
 
-                if (flags[comm_flag::velocity])
-                    {
-                    if (m_n_send_ghosts[stage][ineigh])
+                    if (flags[comm_flag::velocity])
                         {
-                        MPI_Isend(vel_ghost_sendbuf_handle.data
-                                      + h_ghost_begin.data[ineigh + stage * m_n_unique_neigh],
-                                  int(m_n_send_ghosts[stage][ineigh] * sizeof(Scalar4)),
-                                  MPI_BYTE,
-                                  neighbor,
-                                  3,
-                                  m_mpi_comm,
-                                  &req);
-                        m_reqs.push_back(req);
+                        if (m_n_send_ghosts[stage][ineigh])
+                            {
+                            MPI_Isend(vel_ghost_sendbuf
+                                          + h_ghost_begin.data[ineigh + stage * m_n_unique_neigh],
+                                      int(m_n_send_ghosts[stage][ineigh] * sizeof(Scalar4)),
+                                      MPI_BYTE,
+                                      neighbor,
+                                      3,
+                                      m_mpi_comm,
+                                      &req);
+                            m_reqs.push_back(req);
+                            }
+                        send_bytes
+                            += (unsigned int)(m_n_send_ghosts[stage][ineigh] * sizeof(Scalar4));
+
+                        if (m_n_recv_ghosts[stage][ineigh])
+                            {
+                            MPI_Irecv(vel_ghost_recvbuf + m_ghost_offs[stage][ineigh] + offs,
+                                      int(m_n_recv_ghosts[stage][ineigh] * sizeof(Scalar4)),
+                                      MPI_BYTE,
+                                      neighbor,
+                                      3,
+                                      m_mpi_comm,
+                                      &req);
+                            m_reqs.push_back(req);
+                            }
+                        recv_bytes
+                            += (unsigned int)(m_n_recv_ghosts[stage][ineigh] * sizeof(Scalar4));
                         }
-                    send_bytes += (unsigned int)(m_n_send_ghosts[stage][ineigh] * sizeof(Scalar4));
 
-                    if (m_n_recv_ghosts[stage][ineigh])
+                    if (flags[comm_flag::orientation])
                         {
-                        MPI_Irecv(vel_ghost_recvbuf_handle.data + m_ghost_offs[stage][ineigh]
-                                      + offs,
-                                  int(m_n_recv_ghosts[stage][ineigh] * sizeof(Scalar4)),
-                                  MPI_BYTE,
-                                  neighbor,
-                                  3,
-                                  m_mpi_comm,
-                                  &req);
-                        m_reqs.push_back(req);
+                        if (m_n_send_ghosts[stage][ineigh])
+                            {
+                            MPI_Isend(orientation_ghost_sendbuf
+                                          + h_ghost_begin.data[ineigh + stage * m_n_unique_neigh],
+                                      int(m_n_send_ghosts[stage][ineigh] * sizeof(Scalar4)),
+                                      MPI_BYTE,
+                                      neighbor,
+                                      6,
+                                      m_mpi_comm,
+                                      &req);
+                            m_reqs.push_back(req);
+                            }
+                        send_bytes
+                            += (unsigned int)(m_n_send_ghosts[stage][ineigh] * sizeof(Scalar4));
+
+                        if (m_n_recv_ghosts[stage][ineigh])
+                            {
+                            MPI_Irecv(orientation_ghost_recvbuf + m_ghost_offs[stage][ineigh]
+                                          + offs,
+                                      int(m_n_recv_ghosts[stage][ineigh] * sizeof(Scalar4)),
+                                      MPI_BYTE,
+                                      neighbor,
+                                      6,
+                                      m_mpi_comm,
+                                      &req);
+                            m_reqs.push_back(req);
+                            }
+                        recv_bytes
+                            += (unsigned int)(m_n_recv_ghosts[stage][ineigh] * sizeof(Scalar4));
                         }
-                    recv_bytes += (unsigned int)(m_n_recv_ghosts[stage][ineigh] * sizeof(Scalar4));
-                    }
+                    } // end neighbor loop
+                };
 
-                if (flags[comm_flag::orientation])
+            if (m_peer_ghosts_active)
+                {
+                // pull our spans directly out of the node-local peers' send buffers
+                ArrayHandle<Scalar4> pos_ghost_recvbuf_handle(m_pos_ghost_recvbuf,
+                                                              access_location::device,
+                                                              access_mode::overwrite);
+                ArrayHandle<Scalar4> vel_ghost_recvbuf_handle(m_vel_ghost_recvbuf,
+                                                              access_location::device,
+                                                              access_mode::overwrite);
+                ArrayHandle<Scalar4> orientation_ghost_recvbuf_handle(m_orientation_ghost_recvbuf,
+                                                                      access_location::device,
+                                                                      access_mode::overwrite);
+
+                // wait for the pack kernels to complete before the peers read our buffers
+                hipEventRecord(m_event);
+                hipEventSynchronize(m_event);
+
+                // after this barrier every peer has packed its send buffers
+                MPI_Barrier(m_mpi_comm);
+
+                for (unsigned int ineigh = 0; ineigh < m_n_unique_neigh; ineigh++)
                     {
-                    if (m_n_send_ghosts[stage][ineigh])
+                    unsigned int nrecv = m_n_recv_ghosts[stage][ineigh];
+                    if (!nrecv)
+                        continue;
+
+                    unsigned int peer_begin = m_peer_ghost_begin[ineigh][stage];
+
+                    if (flags[comm_flag::position])
                         {
-                        MPI_Isend(orientation_ghost_sendbuf_handle.data
-                                      + h_ghost_begin.data[ineigh + stage * m_n_unique_neigh],
-                                  int(m_n_send_ghosts[stage][ineigh] * sizeof(Scalar4)),
-                                  MPI_BYTE,
-                                  neighbor,
-                                  6,
-                                  m_mpi_comm,
-                                  &req);
-                        m_reqs.push_back(req);
+                        hipMemcpyAsync(pos_ghost_recvbuf_handle.data + m_ghost_offs[stage][ineigh]
+                                           + offs,
+                                       m_peer_pos_sendbuf[ineigh] + peer_begin,
+                                       nrecv * sizeof(Scalar4),
+                                       hipMemcpyDeviceToDevice);
                         }
-                    send_bytes += (unsigned int)(m_n_send_ghosts[stage][ineigh] * sizeof(Scalar4));
-
-                    if (m_n_recv_ghosts[stage][ineigh])
+                    if (flags[comm_flag::velocity])
                         {
-                        MPI_Irecv(orientation_ghost_recvbuf_handle.data
-                                      + m_ghost_offs[stage][ineigh] + offs,
-                                  int(m_n_recv_ghosts[stage][ineigh] * sizeof(Scalar4)),
-                                  MPI_BYTE,
-                                  neighbor,
-                                  6,
-                                  m_mpi_comm,
-                                  &req);
-                        m_reqs.push_back(req);
+                        hipMemcpyAsync(vel_ghost_recvbuf_handle.data + m_ghost_offs[stage][ineigh]
+                                           + offs,
+                                       m_peer_vel_sendbuf[ineigh] + peer_begin,
+                                       nrecv * sizeof(Scalar4),
+                                       hipMemcpyDeviceToDevice);
+                        }
+                    if (flags[comm_flag::orientation])
+                        {
+                        hipMemcpyAsync(orientation_ghost_recvbuf_handle.data
+                                           + m_ghost_offs[stage][ineigh] + offs,
+                                       m_peer_orientation_sendbuf[ineigh] + peer_begin,
+                                       nrecv * sizeof(Scalar4),
+                                       hipMemcpyDeviceToDevice);
                         }
-                    recv_bytes += (unsigned int)(m_n_recv_ghosts[stage][ineigh] * sizeof(Scalar4));
                     }
-                } // end neighbor loop
 
-            if (m_num_stages == 1)
+                // complete the pulls before the peers may repack their send buffers
+                hipEventRecord(m_event);
+                hipEventSynchronize(m_event);
+                MPI_Barrier(m_mpi_comm);
+
+                if (m_exec_conf->isCUDAErrorCheckingEnabled())
+                    CHECK_CUDA_ERROR();
+                }
+            else if (m_exec_conf->getMPIConfig()->isCUDAAwareMPIEnabled())
+                {
+                // pass device pointers directly to MPI, skipping the host staging copies
+                ArrayHandle<Scalar4> pos_ghost_recvbuf_handle(m_pos_ghost_recvbuf,
+                                                              access_location::device,
+                                                              access_mode::overwrite);
+                ArrayHandle<Scalar4> vel_ghost_recvbuf_handle(m_vel_ghost_recvbuf,
+                                                              access_location::device,
+                                                              access_mode::overwrite);
+                ArrayHandle<Scalar4> orientation_ghost_recvbuf_handle(m_orientation_ghost_recvbuf,
+                                                                      access_location::device,
+                                                                      access_mode::overwrite);
+
+                ArrayHandle<Scalar4> pos_ghost_sendbuf_handle(m_pos_ghost_sendbuf,
+                                                              access_location::device,
+                                                              access_mode::read);
+                ArrayHandle<Scalar4> vel_ghost_sendbuf_handle(m_vel_ghost_sendbuf,
+                                                              access_location::device,
+                                                              access_mode::read);
+                ArrayHandle<Scalar4> orientation_ghost_sendbuf_handle(m_orientation_ghost_sendbuf,
+                                                                      access_location::device,
+                                                                      access_mode::read);
+
+                // wait for the pack kernels to complete before MPI reads the send buffers
+                hipEventRecord(m_event);
+                hipEventSynchronize(m_event);
+
+                post_ghost_exchange(pos_ghost_sendbuf_handle.data,
+                                    vel_ghost_sendbuf_handle.data,
+                                    orientation_ghost_sendbuf_handle.data,
+                                    pos_ghost_recvbuf_handle.data,
+                                    vel_ghost_recvbuf_handle.data,
+                                    orientation_ghost_recvbuf_handle.data);
+                }
+            else
+                {
+                // stage the exchange through host buffers
+                // recv buffers
+                ArrayHandle<Scalar4> pos_ghost_recvbuf_handle(m_pos_ghost_recvbuf,
+                                                              access_location::host,
+                                                              access_mode::overwrite);
+                ArrayHandle<Scalar4> vel_ghost_recvbuf_handle(m_vel_ghost_recvbuf,
+                                                              access_location::host,
+                                                              access_mode::overwrite);
+                ArrayHandle<Scalar4> orientation_ghost_recvbuf_handle(m_orientation_ghost_recvbuf,
+                                                                      access_location::host,
+                                                                      access_mode::overwrite);
+
+                // send buffers
+                ArrayHandleAsync<Scalar4> pos_ghost_sendbuf_handle(m_pos_ghost_sendbuf,
+                                                                   access_location::host,
+                                                                   access_mode::read);
+                ArrayHandleAsync<Scalar4> vel_ghost_sendbuf_handle(m_vel_ghost_sendbuf,
+                                                                   access_location::host,
+                                                                   access_mode::read);
+                ArrayHandleAsync<Scalar4> orientation_ghost_sendbuf_handle(
+                    m_orientation_ghost_sendbuf,
+                    access_location::host,
+                    access_mode::read);
+
+                // lump together into one synchronization call
+                hipEventRecord(m_event);
+                hipEventSynchronize(m_event);
+
+                post_ghost_exchange(pos_ghost_sendbuf_handle.data,
+                                    vel_ghost_sendbuf_handle.data,
+                                    orientation_ghost_sendbuf_handle.data,
+                                    pos_ghost_recvbuf_handle.data,
+                                    vel_ghost_recvbuf_handle.data,
+                                    orientation_ghost_recvbuf_handle.data);
+                }
+
+            if (m_peer_ghosts_active)
+                {
+                // the peer pulls completed above, nothing is pending
+                }
+            else if (m_num_stages == 1)
                 {
                 // use non-blocking MPI
                 m_comm_pending = true;
@@ -3681,7 +4048,10 @@ void export_CommunicatorGPU(pybind11::module& m)
         "CommunicatorGPU")
         .def(pybind11::init<std::shared_ptr<SystemDefinition>,
                             std::shared_ptr<DomainDecomposition>>())
-        .def("setMaxStages", &CommunicatorGPU::setMaxStages);
+        .def("setMaxStages", &CommunicatorGPU::setMaxStages)
+        .def_property("use_peer_ghosts",
+                      &CommunicatorGPU::getUsePeerGhosts,
+                      &CommunicatorGPU::setUsePeerGhosts);
     }
     } // end namespace detail
 
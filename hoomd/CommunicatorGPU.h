@@ -78,6 +78,25 @@ class PYBIND11_EXPORT CommunicatorGPU : public Communicator
         forceMigrate();
         }
 
+    //! Enable or disable the peer-to-peer transport for ghost updates
+    /*! When enabled and every neighbor rank shares the node, per-step ghost updates are
+        pulled directly from the peers' device send buffers via CUDA IPC mappings
+        (NVLink/PCIe) instead of passing through MPI. The IPC handle table is (re)built
+        on the next exchangeGhosts(), so this must be set collectively on all ranks.
+     */
+    void setUsePeerGhosts(bool enable)
+        {
+        m_peer_ghosts_requested = enable;
+        if (!enable)
+            teardownPeerGhosts();
+        }
+
+    //! Returns true when the peer-to-peer ghost transport is requested
+    bool getUsePeerGhosts() const
+        {
+        return m_peer_ghosts_requested;
+        }
+
     //! Helper function to initialize adjacency arrays
     virtual void updateMeshDefinition();
 
@@ -264,6 +283,32 @@ class PYBIND11_EXPORT CommunicatorGPU : public Communicator
 
     hipEvent_t m_event; //!< CUDA event for synchronization
 
+    /* Peer-to-peer ghost transport
+
+       When active, the pack kernels write the per-step ghost fields into dedicated
+       device buffers (IPC requires unmanaged allocations), and every rank pulls its
+       spans directly out of the node-local peers' buffers with device-to-device copies.
+    */
+    bool m_peer_ghosts_requested = false; //!< Peer transport requested
+    bool m_peer_ghosts_active = false;    //!< IPC table is valid for the current ghost lists
+
+    Scalar4* m_pos_ghost_sendbuf_ipc = nullptr; //!< IPC-exported position send buffer
+    Scalar4* m_vel_ghost_sendbuf_ipc = nullptr; //!< IPC-exported velocity send buffer
+    Scalar4* m_orientation_ghost_sendbuf_ipc = nullptr; //!< IPC-exported orientation send buffer
+
+    std::vector<void*> m_peer_mapped_bufs;     //!< Opened peer mappings, for closing
+    std::vector<Scalar4*> m_peer_pos_sendbuf;  //!< Mapped peer position buffers per neighbor
+    std::vector<Scalar4*> m_peer_vel_sendbuf;  //!< Mapped peer velocity buffers per neighbor
+    std::vector<Scalar4*> m_peer_orientation_sendbuf; //!< Mapped peer orientation buffers
+    std::vector<std::vector<unsigned int>>
+        m_peer_ghost_begin; //!< Start of our span in the peer buffer per neighbor and stage
+
+    //! (Re)establish the IPC handle table for node-local peer ghost updates
+    void setupPeerGhosts();
+
+    //! Close all peer mappings and deactivate the peer transport
+    void teardownPeerGhosts();
+
     //! Helper function to allocate various buffers
     void allocateBuffers();
 
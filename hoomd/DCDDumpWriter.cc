@@ -134,6 +134,17 @@ DCDDumpWriter::~DCDDumpWriter()
     {
     m_exec_conf->msg->notice(5) << "Destroying DCDDumpWriter" << endl;
 
+    if (m_io_thread.joinable())
+        {
+            {
+            std::unique_lock<std::mutex> lock(m_io_mutex);
+            m_io_cv.wait(lock, [&] { return !m_io_pending; });
+            m_io_exit = true;
+            }
+        m_io_cv.notify_all();
+        m_io_thread.join();
+        }
+
     if (m_is_initialized)
         {
         m_file.close();
@@ -149,10 +160,8 @@ DCDDumpWriter::~DCDDumpWriter()
 void DCDDumpWriter::analyze(uint64_t timestep)
     {
     Analyzer::analyze(timestep);
-    // take particle data snapshot
-    SnapshotParticleData<Scalar> snapshot;
-
-    m_pdata->takeSnapshot(snapshot);
+    // take particle data snapshot into the staging frame
+    m_pdata->takeSnapshot(m_frame.snapshot);
 
 #ifdef ENABLE_MPI
     // if we are not the root processor, do not perform file I/O
@@ -189,14 +198,112 @@ void DCDDumpWriter::analyze(uint64_t timestep)
             << " which is not specified in the period of the DCD file: " << m_start_timestep
             << " + i * " << m_period << endl;
 
+    // finish staging the frame: the group membership, box, and time step are captured
+    // here so the I/O thread never touches the particle data
+    unsigned int nparticles = m_group->getNumMembersGlobal();
+    m_frame.tags.resize(nparticles);
+    for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
+        {
+        m_frame.tags[group_idx] = m_group->getMemberTag(group_idx);
+        }
+    m_frame.box = m_pdata->getGlobalBox();
+    m_frame.timestep = timestep;
+
+    if (m_async)
+        {
+        // double buffering: block only when the previous frame is still in flight
+        waitForPendingWrite();
+
+        // hand the frame to the background I/O thread: swapping buffers leaves the
+        // previous I/O frame for takeSnapshot to refill on the next trigger
+        std::swap(m_io_frame, m_frame);
+
+        if (!m_io_thread.joinable())
+            {
+            m_io_thread = std::thread(&DCDDumpWriter::ioThreadLoop, this);
+            }
+
+            {
+            std::lock_guard<std::mutex> lock(m_io_mutex);
+            m_io_pending = true;
+            }
+        m_io_cv.notify_all();
+        }
+    else
+        {
+        writeFrame(m_frame);
+        }
+    }
+
+/*! \param frame Staged frame to write
+    Performs the unwrap, float conversion, and file writes for one frame and updates the
+    file header. Only touches the file and \a frame: safe to run on the background I/O
+    thread.
+*/
+void DCDDumpWriter::writeFrame(const DCDFrame& frame)
+    {
     // write the data for the current time step
     m_file.seekp(0, std::ios_base::end);
-    write_frame_header(m_file);
-    write_frame_data(m_file, snapshot);
+    write_frame_header(m_file, frame.box);
+    write_frame_data(m_file, frame);
 
     // update the header with the number of frames written
     m_num_frames_written++;
-    write_updated_header(m_file, timestep);
+    write_updated_header(m_file, frame.timestep);
+    }
+
+void DCDDumpWriter::ioThreadLoop()
+    {
+    std::unique_lock<std::mutex> lock(m_io_mutex);
+    while (true)
+        {
+        m_io_cv.wait(lock, [&] { return m_io_pending || m_io_exit; });
+        if (!m_io_pending)
+            {
+            break;
+            }
+
+        lock.unlock();
+        try
+            {
+            writeFrame(m_io_frame);
+            }
+        catch (...)
+            {
+            // defer the error to the simulation thread: it is rethrown from the next
+            // waitForPendingWrite()
+            m_io_exception = std::current_exception();
+            }
+        lock.lock();
+
+        m_io_pending = false;
+        m_io_cv.notify_all();
+        }
+    }
+
+void DCDDumpWriter::waitForPendingWrite()
+    {
+    if (m_io_thread.joinable())
+        {
+        std::unique_lock<std::mutex> lock(m_io_mutex);
+        m_io_cv.wait(lock, [&] { return !m_io_pending; });
+        }
+
+    if (m_io_exception)
+        {
+        std::exception_ptr e = m_io_exception;
+        m_io_exception = nullptr;
+        std::rethrow_exception(e);
+        }
+    }
+
+void DCDDumpWriter::setAsync(bool async)
+    {
+    if (!async)
+        {
+        waitForPendingWrite();
+        }
+    m_async = async;
     }
 
 /*! \param file File to write to
@@ -270,13 +377,13 @@ void DCDDumpWriter::write_file_header(std::fstream& file)
     }
 
 /*! \param file File to write to
+    \param box Global box of the staged frame
     Writes the header that precedes each snapshot in the file. This header
     includes information on the box size of the simulation.
 */
-void DCDDumpWriter::write_frame_header(std::fstream& file)
+void DCDDumpWriter::write_frame_header(std::fstream& file, const BoxDim& box)
     {
     double unitcell[6];
-    BoxDim box = m_pdata->getGlobalBox();
     // set box dimensions
     Scalar a, b, c, alpha, beta, gamma;
     Scalar3 va = box.getLatticeVector(0);
@@ -309,24 +416,24 @@ void DCDDumpWriter::write_frame_header(std::fstream& file)
     }
 
 /*! \param file File to write to
-    \param snapshot Snapshot to write
+    \param frame Staged frame to write
     Writes the actual particle positions for all particles at the current time step
 */
-void DCDDumpWriter::write_frame_data(std::fstream& file,
-                                     const SnapshotParticleData<Scalar>& snapshot)
+void DCDDumpWriter::write_frame_data(std::fstream& file, const DCDFrame& frame)
     {
     // we need to unsort the positions and write in tag order
     assert(m_staging_buffer);
 
-    BoxDim box = m_pdata->getGlobalBox();
+    const SnapshotParticleData<Scalar>& snapshot = frame.snapshot;
+    const BoxDim& box = frame.box;
 
-    unsigned int nparticles = m_group->getNumMembersGlobal();
+    unsigned int nparticles = (unsigned int)frame.tags.size();
 
     // Create a tmp copy of the particle data and unwrap particles
     std::vector<vec3<Scalar>> tmp_pos(snapshot.pos);
     for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
         {
-        unsigned int i = m_group->getMemberTag(group_idx);
+        unsigned int i = frame.tags[group_idx];
 
         if (m_unwrap_full)
             {
@@ -350,7 +457,7 @@ void DCDDumpWriter::write_frame_data(std::fstream& file,
     // prepare x coords for writing, looping in tag order
     for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
         {
-        unsigned int i = m_group->getMemberTag(group_idx);
+        unsigned int i = frame.tags[group_idx];
         m_staging_buffer[group_idx] = float(tmp_pos[i].x);
         }
 
@@ -362,7 +469,7 @@ void DCDDumpWriter::write_frame_data(std::fstream& file,
     // prepare y coords for writing
     for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
         {
-        unsigned int i = m_group->getMemberTag(group_idx);
+        unsigned int i = frame.tags[group_idx];
         m_staging_buffer[group_idx] = float(tmp_pos[i].y);
         }
 
@@ -374,7 +481,7 @@ void DCDDumpWriter::write_frame_data(std::fstream& file,
     // prepare z coords for writing
     for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
         {
-        unsigned int i = m_group->getMemberTag(group_idx);
+        unsigned int i = frame.tags[group_idx];
         m_staging_buffer[group_idx] = float(tmp_pos[i].z);
 
         // m_angle set to True turns on a hack where the particle orientation angle is written out
@@ -432,6 +539,7 @@ void export_DCDDumpWriter(pybind11::module& m)
                       &DCDDumpWriter::getUnwrapRigid,
                       &DCDDumpWriter::setUnwrapRigid)
         .def_property("angle_z", &DCDDumpWriter::getAngleZ, &DCDDumpWriter::setAngleZ)
+        .def_property("async_write", &DCDDumpWriter::getAsync, &DCDDumpWriter::setAsync)
         .def_property_readonly("overwrite", &DCDDumpWriter::getOverwrite);
     }
     } // end namespace detail
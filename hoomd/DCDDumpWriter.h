@@ -7,9 +7,13 @@
 #include "Analyzer.h"
 #include "ParticleGroup.h"
 
+#include <condition_variable>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 /*! \file DCDDumpWriter.h
     \brief Declares the DCDDumpWriter class
@@ -102,7 +106,28 @@ class PYBIND11_EXPORT DCDDumpWriter : public Analyzer
         return m_overwrite;
         }
 
+    //! Enable or disable asynchronous frame writes
+    void setAsync(bool async);
+
+    //! Get the async write flag
+    bool getAsync() const
+        {
+        return m_async;
+        }
+
+    //! Block until any in-flight asynchronous frame write has completed
+    void waitForPendingWrite();
+
     private:
+    //! All data needed to write one frame, staged on the simulation thread
+    struct DCDFrame
+        {
+        SnapshotParticleData<Scalar> snapshot; //!< Global particle data snapshot
+        std::vector<unsigned int> tags;        //!< Group member tags in group order
+        BoxDim box;                            //!< Global box at the time of the snapshot
+        uint64_t timestep = 0;                 //!< Time step of the snapshot
+        };
+
     std::string m_fname;                    //!< The file name we are writing to
     uint64_t m_start_timestep;              //!< First time step written to the file
     unsigned int m_period;                  //!< Time step period between writes
@@ -121,16 +146,37 @@ class PYBIND11_EXPORT DCDDumpWriter : public Analyzer
     float* m_staging_buffer; //!< Buffer for staging particle positions in tag order
     std::fstream m_file;     //!< The file object
 
+    /** Asynchronous write state.
+
+        In async mode analyze() stages the snapshot into m_frame on the simulation
+        thread and hands it to a background I/O thread, which performs the unwrap,
+        float conversion, and file writes. The simulation thread only blocks when the
+        previous frame is still in flight (double buffering via the m_io_frame swap).
+    */
+    bool m_async = false;              //!< True when asynchronous writes are enabled
+    std::thread m_io_thread;           //!< Background I/O thread (root rank only)
+    std::mutex m_io_mutex;             //!< Protects the pending/exit flags
+    std::condition_variable m_io_cv;   //!< Signals frame hand off and completion
+    bool m_io_pending = false;         //!< True while a frame write is in flight
+    bool m_io_exit = false;            //!< Request the I/O thread to exit
+    std::exception_ptr m_io_exception; //!< Deferred exception from the I/O thread
+    DCDFrame m_frame;                  //!< Frame staged by the simulation thread
+    DCDFrame m_io_frame;               //!< Frame owned by the I/O thread while pending
+
     // helper functions
 
     //! Initializes the file header
     void write_file_header(std::fstream& file);
     //! Writes the frame header
-    void write_frame_header(std::fstream& file);
+    void write_frame_header(std::fstream& file, const BoxDim& box);
     //! Writes the particle positions for a frame
-    void write_frame_data(std::fstream& file, const SnapshotParticleData<Scalar>& snapshot);
+    void write_frame_data(std::fstream& file, const DCDFrame& frame);
     //! Updates the file header
     void write_updated_header(std::fstream& file, uint64_t timestep);
+    //! Writes a complete staged frame and updates the file header
+    void writeFrame(const DCDFrame& frame);
+    //! Body of the background I/O thread
+    void ioThreadLoop();
     //! Initializes the output file for writing
     void initFileIO(uint64_t timestep);
     };
@@ -261,11 +261,36 @@ void DomainDecomposition::initializeDomainGrid(Scalar3 L,
         } // twolevel
     else
         {
-        // simply map the global grid in sequential order to ranks
-        for (unsigned int iglob = 0; iglob < nranks; ++iglob)
+        // Fill the global grid node by node: consecutive cells share a face along the
+        // fastest-varying grid dimension, so placing the ranks of one node in
+        // consecutive cells keeps those halo exchanges intra-node even when the
+        // two-level decomposition is unavailable (non-uniform ranks per node) or
+        // disabled by an explicit grid. The node map is identical on all ranks and the
+        // ranks of each node are visited in sorted order, so the mapping is
+        // deterministic. With one rank per node or a single node this reduces to the
+        // sequential mapping.
+        unsigned int iglob = 0;
+        std::set<unsigned int> node_rank_set;
+        for (std::set<std::string>::iterator node_it = m_nodes.begin(); node_it != m_nodes.end();
+             ++node_it)
             {
-            h_cart_ranks.data[iglob] = iglob;
-            h_cart_ranks_inv.data[iglob] = iglob;
+            typedef std::multimap<std::string, unsigned int> map_t;
+            std::pair<map_t::iterator, map_t::iterator> p = m_node_map.equal_range(*node_it);
+
+            node_rank_set.clear();
+            for (map_t::iterator it = p.first; it != p.second; ++it)
+                {
+                node_rank_set.insert(it->second);
+                }
+
+            for (std::set<unsigned int>::iterator set_it = node_rank_set.begin();
+                 set_it != node_rank_set.end();
+                 ++set_it)
+                {
+                h_cart_ranks.data[iglob] = *set_it;
+                h_cart_ranks_inv.data[*set_it] = iglob;
+                iglob++;
+                }
             }
         }
 
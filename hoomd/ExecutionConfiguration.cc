@@ -184,6 +184,44 @@ ExecutionConfiguration::ExecutionConfiguration(executionMode mode,
                                    << endl;
                     }
                 }
+
+            // enable peer-to-peer access between all active GPUs so that managed memory
+            // migration and direct transfers take the on-package interconnect (e.g. NVLink)
+            // instead of staging through host memory
+            for (unsigned int idev = 0; idev < m_gpu_id.size(); ++idev)
+                {
+                hipSetDevice(m_gpu_id[idev]);
+                for (unsigned int jdev = 0; jdev < m_gpu_id.size(); ++jdev)
+                    {
+                    if (jdev == idev)
+                        continue;
+
+                    int can_access = 0;
+                    hipDeviceCanAccessPeer(&can_access, m_gpu_id[idev], m_gpu_id[jdev]);
+                    if (can_access)
+                        {
+                        hipError_t err_peer = hipDeviceEnablePeerAccess(m_gpu_id[jdev], 0);
+                        if (err_peer == hipErrorPeerAccessAlreadyEnabled)
+                            {
+                            // the link is already up, clear the sticky error and move on
+                            (void)hipGetLastError();
+                            }
+                        else
+                            {
+                            handleHIPError(err_peer, __FILE__, __LINE__);
+                            }
+                        msg->notice(4) << "Enabled peer access from GPU " << m_gpu_id[idev]
+                                       << " to GPU " << m_gpu_id[jdev] << endl;
+                        }
+                    else
+                        {
+                        msg->warning()
+                            << "GPU " << m_gpu_id[idev] << " cannot access GPU " << m_gpu_id[jdev]
+                            << " directly. Multi-GPU transfers will be staged through host memory."
+                            << endl;
+                        }
+                    }
+                }
             }
 
         // select first device by default
@@ -197,6 +235,9 @@ ExecutionConfiguration::ExecutionConfiguration(executionMode mode,
             new CachedAllocator(false, (unsigned int)(0.5f * (float)dev_prop.totalGlobalMem)));
         m_cached_alloc_managed.reset(
             new CachedAllocator(true, (unsigned int)(0.5f * (float)dev_prop.totalGlobalMem)));
+
+        // pinned host memory pool for GPUArray host mirrors, uses the default cache size
+        m_cached_host_alloc.reset(new CachedHostAllocator());
         }
 #endif
 
@@ -243,6 +284,17 @@ ExecutionConfiguration::ExecutionConfiguration(executionMode mode,
         hipSetDevice(m_gpu_id[idev]);
         hipEventCreateWithFlags(&m_events[idev], hipEventDisableTiming);
         }
+
+    if (exec_mode == GPU)
+        {
+        // create the shared launch stream on the first device: a non-default stream is
+        // required for graph capture of the step sequence, and creating it once here
+        // avoids per-operation stream creation costs
+        hipSetDevice(m_gpu_id[0]);
+        hipStreamCreate(&m_stream);
+        hipError_t err_stream = hipPeekAtLastError();
+        handleHIPError(err_stream, __FILE__, __LINE__);
+        }
 #endif
     }
 
@@ -255,12 +307,18 @@ ExecutionConfiguration::~ExecutionConfiguration()
         {
         hipEventDestroy(m_events[idev]);
         }
+
+    if (m_stream)
+        {
+        hipStreamDestroy(m_stream);
+        }
 #endif
 
 #if defined(ENABLE_HIP)
     // the destructors of these objects can issue hip calls, so free them before the device reset
     m_cached_alloc.reset();
     m_cached_alloc_managed.reset();
+    m_cached_host_alloc.reset();
 #endif
     }
 
@@ -722,6 +780,7 @@ void export_ExecutionConfiguration(pybind11::module& m)
         .def("getNumThreads", &ExecutionConfiguration::getNumThreads)
         .def("setMemoryTracing", &ExecutionConfiguration::setMemoryTracing)
         .def("memoryTracingEnabled", &ExecutionConfiguration::memoryTracingEnabled)
+        .def("getMemoryTracker", &ExecutionConfiguration::getMemoryTrackerShared)
         .def_static("getCapableDevices", &ExecutionConfiguration::getCapableDevices)
         .def_static("getScanMessages", &ExecutionConfiguration::getScanMessages)
         .def("getActiveDevices", &ExecutionConfiguration::getActiveDevices);
@@ -731,6 +790,15 @@ void export_ExecutionConfiguration(pybind11::module& m)
         .value("CPU", ExecutionConfiguration::executionMode::CPU)
         .value("AUTO", ExecutionConfiguration::executionMode::AUTO)
         .export_values();
+
+    pybind11::class_<MemoryTracker, std::shared_ptr<MemoryTracker>>(m, "MemoryTracker")
+        .def("setBudget", &MemoryTracker::setBudget)
+        .def("getBudget", &MemoryTracker::getBudget)
+        .def("getDeviceBytes", &MemoryTracker::getDeviceBytes)
+        .def("getUsageByTag", &MemoryTracker::getUsageByTag)
+        .def("setTracing", &MemoryTracker::setTracing)
+        .def("getTracing", &MemoryTracker::getTracing)
+        .def("getTrace", &MemoryTracker::getTrace);
     }
     } // end namespace detail
 
@@ -12,6 +12,7 @@
 #endif
 
 #include "MPIConfiguration.h"
+#include "MemoryTracker.h"
 
 #include <memory>
 #include <string>
@@ -48,6 +49,7 @@ namespace hoomd
 #if defined(ENABLE_HIP)
 //! Forward declaration
 class CachedAllocator;
+class CachedHostAllocator;
 #endif
 
 //! Defines the execution configuration for the simulation
@@ -149,6 +151,18 @@ class PYBIND11_EXPORT ExecutionConfiguration
         return m_gpu_id;
         }
 
+    //! Get the shared launch stream
+    /*! Kernels launched on this stream (instead of the legacy default stream) execute in
+        a well defined stream order, which is the prerequisite for capturing the
+        steady-state step sequence into a HIP/CUDA graph for replay. The stream is
+        created once per execution configuration so launch overheads are not paid per
+        operation.
+    */
+    hipStream_t getStream() const
+        {
+        return m_stream;
+        }
+
     void hipProfileStart() const
         {
         for (int idev = (unsigned int)(m_gpu_id.size() - 1); idev >= 0; idev--)
@@ -268,6 +282,14 @@ class PYBIND11_EXPORT ExecutionConfiguration
             throw std::runtime_error("TBB task arena not set.");
         return m_task_arena;
         }
+
+    //! Grain size for per-particle parallel loops on the task arena
+    /*! Used together with tbb::simple_partitioner so that every chunk of this many
+        particles is an independently stealable task. Per-particle costs vary with the
+        local neighbor count, and small uniform chunks let idle threads steal work from
+        dense regions instead of waiting on a coarse static split.
+    */
+    static constexpr int work_stealing_chunk_size = 64;
 #endif
 
     //! Return the number of active threads
@@ -292,8 +314,26 @@ class PYBIND11_EXPORT ExecutionConfiguration
         {
         return *m_cached_alloc_managed;
         }
+
+    //! Returns the pinned host memory pool backing GPUArray host mirrors
+    CachedHostAllocator& getCachedHostAllocator() const
+        {
+        return *m_cached_host_alloc;
+        }
 #endif
 
+    //! Returns the registry of array allocations
+    MemoryTracker& getMemoryTracker() const
+        {
+        return *m_memory_tracker;
+        }
+
+    //! Returns the registry of array allocations (shared pointer form for python)
+    std::shared_ptr<MemoryTracker> getMemoryTrackerShared() const
+        {
+        return m_memory_tracker;
+        }
+
     //! Set up memory tracing
     void setMemoryTracing(bool enable)
         {
@@ -361,6 +401,8 @@ class PYBIND11_EXPORT ExecutionConfiguration
 
     std::vector<hipEvent_t> m_events; //!< A list of events to synchronize between GPUs
 
+    hipStream_t m_stream = nullptr; //!< Shared capture-capable launch stream
+
     /// IDs of active GPUs
     std::vector<unsigned int> m_gpu_id;
 
@@ -400,6 +442,8 @@ class PYBIND11_EXPORT ExecutionConfiguration
     std::unique_ptr<CachedAllocator> m_cached_alloc; //!< Cached allocator for temporary allocations
     std::unique_ptr<CachedAllocator>
         m_cached_alloc_managed; //!< Cached allocator for temporary allocations in managed memory
+    std::unique_ptr<CachedHostAllocator>
+        m_cached_host_alloc; //!< Pool of pinned host allocations for GPUArray host mirrors
 #endif
 
 #ifdef ENABLE_TBB
@@ -411,6 +455,9 @@ class PYBIND11_EXPORT ExecutionConfiguration
     void setupStats();
 
     bool m_memory_tracing = false;
+
+    /// Registry of array allocations
+    std::shared_ptr<MemoryTracker> m_memory_tracker = std::make_shared<MemoryTracker>();
     };
 
 #if defined(ENABLE_HIP)
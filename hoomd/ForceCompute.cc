@@ -202,15 +202,17 @@ ForceCompute::~ForceCompute()
     }
 
 /*! Sums the total potential energy calculated by the last call to compute() and returns it.
+
+    The reduction touches the full force array, so the result is cached until the next force
+    evaluation: repeated logger queries within a step (and every step forces are held
+    constant by an evaluation interval) reuse the cached sum.
  */
 Scalar ForceCompute::calcEnergySum()
     {
-    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::read);
-    double pe_total = m_external_energy;
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        {
-        pe_total += (double)h_force.data[i].w;
-        }
+    if (m_energy_sum_valid)
+        return m_energy_sum;
+
+    double pe_total = calcEnergySumLocal();
 #ifdef ENABLE_MPI
     if (m_sysdef->isDomainDecomposed())
         {
@@ -223,7 +225,24 @@ Scalar ForceCompute::calcEnergySum()
                       m_exec_conf->getMPICommunicator());
         }
 #endif
-    return Scalar(pe_total);
+    m_energy_sum = Scalar(pe_total);
+    m_energy_sum_valid = true;
+    return m_energy_sum;
+    }
+
+/*! Sums the potential energy of the particles local to this rank. Callers that hold several
+    force computes (e.g. the Integrator) combine these partial sums into a single MPI reduction
+    instead of issuing one collective per force compute.
+ */
+double ForceCompute::calcEnergySumLocal()
+    {
+    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::read);
+    double pe_total = m_external_energy;
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        {
+        pe_total += (double)h_force.data[i].w;
+        }
+    return pe_total;
     }
 
 /*! Sums the potential energy of a particle group calculated by the last call to compute() and
@@ -511,11 +530,27 @@ pybind11::object ForceCompute::getVirialsPython()
 void ForceCompute::compute(uint64_t timestep)
     {
     Compute::compute(timestep);
+
+    // when evaluating on an interval, hold the previous forces constant on intermediate steps -
+    // unless the cached per-index arrays were invalidated by a sort, a flag change, or a forced
+    // compute
+    if (m_eval_interval > 1 && !m_first_compute && !m_force_compute && !m_particles_sorted
+        && (timestep % m_eval_interval) != 0 && m_pdata->getFlags() == m_computed_flags)
+        {
+        int64_t start = m_clock.getTime();
+        refreshHeldForces(timestep);
+        m_compute_time += m_clock.getTime() - start;
+        return;
+        }
+
     // recompute forces if the particles were sorted, this is a new timestep, or the particle data
     // flags do not match
     if (m_particles_sorted || shouldCompute(timestep) || m_pdata->getFlags() != m_computed_flags)
         {
+        int64_t start = m_clock.getTime();
         computeForces(timestep);
+        m_compute_time += m_clock.getTime() - start;
+        m_energy_sum_valid = false;
         }
 
     m_particles_sorted = false;
@@ -639,7 +674,8 @@ void export_ForceCompute(pybind11::module& m)
         .def("getEnergies", &ForceCompute::getEnergiesPython)
         .def("getForces", &ForceCompute::getForcesPython)
         .def("getTorques", &ForceCompute::getTorquesPython)
-        .def("getVirials", &ForceCompute::getVirialsPython);
+        .def("getVirials", &ForceCompute::getVirialsPython)
+        .def_property_readonly("compute_time", &ForceCompute::getComputeTime);
     }
     } // end namespace detail
 
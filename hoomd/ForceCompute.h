@@ -1,6 +1,7 @@
 // Copyright (c) 2009-2023 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+#include "ClockSource.h"
 #include "Compute.h"
 #include "GlobalArray.h"
 #include "Index1D.h"
@@ -17,6 +18,7 @@
 
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
 #include <memory>
+#include <stdexcept>
 
 /*! \file ForceCompute.h
     \brief Declares the ForceCompute class
@@ -75,9 +77,56 @@ class PYBIND11_EXPORT ForceCompute : public Compute
     //! Computes the forces
     virtual void compute(uint64_t timestep);
 
+    //! Set the interval (in time steps) between force evaluations
+    /*! When \a interval is greater than one, compute() holds the previously computed
+        forces constant on intermediate time steps instead of recomputing them. Particle
+        sorts, particle data flag changes, and forced computes always trigger a fresh
+        evaluation so that the cached per-index force arrays remain valid.
+    */
+    void setEvaluationInterval(unsigned int interval)
+        {
+        if (interval == 0)
+            {
+            throw std::invalid_argument("Evaluation interval must be at least 1.");
+            }
+        m_eval_interval = interval;
+        }
+
+    //! Get the interval (in time steps) between force evaluations
+    unsigned int getEvaluationInterval() const
+        {
+        return m_eval_interval;
+        }
+
     //! Total the potential energy
     Scalar calcEnergySum();
 
+    //! Sum the potential energy of particles local to this rank (no MPI reduction)
+    double calcEnergySumLocal();
+
+    //! Check if the cached potential energy sum is up to date
+    bool isEnergySumValid() const
+        {
+        return m_energy_sum_valid;
+        }
+
+    //! Seed the cached potential energy sum with an externally reduced value
+    /*! Used by Integrator::reduceForceEnergies() to batch the MPI reductions of several force
+        computes into a single collective call.
+        \param energy the globally reduced potential energy
+    */
+    void setEnergySumFromReduction(double energy)
+        {
+        m_energy_sum = Scalar(energy);
+        m_energy_sum_valid = true;
+        }
+
+    //! Invalidate the cached potential energy sum (when forces are written externally)
+    void invalidateEnergySum()
+        {
+        m_energy_sum_valid = false;
+        }
+
     //! Sum the potential energy of a group
     Scalar calcEnergyGroup(std::shared_ptr<ParticleGroup> group);
 
@@ -178,6 +227,15 @@ class PYBIND11_EXPORT ForceCompute : public Compute
         return m_buffers_writeable;
         }
 
+    //! Get the wall time spent in computeForces() since creation, in seconds
+    /*! On the GPU, kernel launches are asynchronous: the reported time covers the host side
+        of the computation only, unless a later operation synchronizes with the device.
+    */
+    double getComputeTime() const
+        {
+        return double(m_compute_time) / 1e9;
+        }
+
     protected:
     bool m_particles_sorted; //!< Flag set to true when particles are resorted in memory
 
@@ -219,6 +277,21 @@ class PYBIND11_EXPORT ForceCompute : public Compute
     /// Store the particle data flags used during the last computation
     PDataFlags m_computed_flags;
 
+    /// True when m_energy_sum holds the reduction of the current forces
+    bool m_energy_sum_valid = false;
+
+    /// Cached result of calcEnergySum()
+    Scalar m_energy_sum = 0;
+
+    /// Interval (in time steps) between force evaluations, see setEvaluationInterval()
+    unsigned int m_eval_interval = 1;
+
+    /// Clock used to time force computations
+    ClockSource m_clock;
+
+    /// Total wall time spent in computeForces(), in nanoseconds
+    int64_t m_compute_time = 0;
+
     // whether the local force buffers exposed by this class should be read-only
     bool m_buffers_writeable;
 
@@ -228,6 +301,14 @@ class PYBIND11_EXPORT ForceCompute : public Compute
         \param timestep Current time step
     */
     virtual void computeForces(uint64_t timestep) { }
+
+    //! Refresh the held forces on intermediate steps of the evaluation interval
+    /*! Called by compute() instead of computeForces() when the previously computed forces are
+        held constant, see setEvaluationInterval(). The default implementation leaves the forces
+        untouched; sub-classes may cheaply update them from cached intermediate results.
+        \param timestep Current time step
+    */
+    virtual void refreshHeldForces(uint64_t timestep) { }
     };
 
 /** Make the local particle data available to python via zero-copy access
@@ -246,6 +327,9 @@ class PYBIND11_EXPORT LocalForceComputeData : public GhostLocalDataAccess<Output
           m_virial_pitch(data.getVirialArray().getPitch()),
           m_buffers_writeable(data.getLocalBuffersWriteable())
         {
+        // forces may be modified in place through this view
+        if (m_buffers_writeable)
+            data.invalidateEnergySum();
         }
 
     virtual ~LocalForceComputeData() = default;
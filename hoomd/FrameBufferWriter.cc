@@ -0,0 +1,96 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "FrameBufferWriter.h"
+
+namespace hoomd
+    {
+FrameBufferWriter::FrameBufferWriter(std::shared_ptr<SystemDefinition> sysdef,
+                                     std::shared_ptr<Trigger> trigger,
+                                     int max_frames)
+    : Analyzer(sysdef, trigger), m_max_frames(max_frames)
+    {
+    }
+
+void FrameBufferWriter::analyze(uint64_t timestep)
+    {
+    auto snapshot = std::make_shared<SnapshotParticleData<float>>();
+    m_pdata->takeSnapshot(*snapshot);
+    m_frames.push_back(Frame {timestep, m_pdata->getGlobalBox(), std::move(snapshot)});
+    if (m_max_frames != -1 && m_frames.size() > static_cast<size_t>(m_max_frames))
+        {
+        m_frames.pop_front();
+        }
+    }
+
+void FrameBufferWriter::clear()
+    {
+    m_frames.clear();
+    }
+
+int FrameBufferWriter::getMaxFrames() const
+    {
+    return m_max_frames;
+    }
+
+void FrameBufferWriter::setMaxFrames(int new_max_frames)
+    {
+    m_max_frames = new_max_frames;
+    if (m_max_frames == -1)
+        {
+        return;
+        }
+    while (static_cast<size_t>(m_max_frames) < m_frames.size())
+        {
+        m_frames.pop_front();
+        }
+    }
+
+size_t FrameBufferWriter::getCurrentSize() const
+    {
+    return m_frames.size();
+    }
+
+const FrameBufferWriter::Frame& FrameBufferWriter::getFrame(size_t i) const
+    {
+    if (i >= m_frames.size())
+        {
+        throw std::out_of_range("Frame index out of range.");
+        }
+    return m_frames[i];
+    }
+
+uint64_t FrameBufferWriter::getFrameTimestep(size_t i) const
+    {
+    return getFrame(i).timestep;
+    }
+
+std::shared_ptr<BoxDim> FrameBufferWriter::getFrameBox(size_t i) const
+    {
+    return std::make_shared<BoxDim>(getFrame(i).box);
+    }
+
+std::shared_ptr<SnapshotParticleData<float>> FrameBufferWriter::getFrameSnapshot(size_t i) const
+    {
+    return getFrame(i).snapshot;
+    }
+
+namespace detail
+    {
+void export_FrameBufferWriter(pybind11::module& m)
+    {
+    pybind11::class_<FrameBufferWriter, Analyzer, std::shared_ptr<FrameBufferWriter>>(
+        m,
+        "FrameBufferWriter")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<Trigger>, int>())
+        .def_property("max_frames",
+                      &FrameBufferWriter::getMaxFrames,
+                      &FrameBufferWriter::setMaxFrames)
+        .def("__len__", &FrameBufferWriter::getCurrentSize)
+        .def("clear", &FrameBufferWriter::clear)
+        .def("getFrameTimestep", &FrameBufferWriter::getFrameTimestep)
+        .def("getFrameBox", &FrameBufferWriter::getFrameBox)
+        .def("getFrameSnapshot", &FrameBufferWriter::getFrameSnapshot);
+    }
+    } // namespace detail
+    } // namespace hoomd
@@ -0,0 +1,78 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <deque>
+
+#include <pybind11/pybind11.h>
+
+#include "Analyzer.h"
+
+namespace hoomd
+    {
+//! Captures recent frames in an in-memory ring buffer
+/*! FrameBufferWriter stores a snapshot of the particle data for each triggered time step in a
+    bounded deque, following the buffering pattern of GSDDequeWriter but without serializing to a
+    file. The stored snapshots are exposed to Python as SnapshotParticleData objects whose numpy
+    properties view the buffered memory directly, so analysis pipelines can consume recent
+    trajectory frames without touching the filesystem.
+
+    In MPI simulations the particle data is gathered to rank 0; the buffered frames on other
+    ranks are empty.
+
+    \ingroup analyzers
+*/
+class PYBIND11_EXPORT FrameBufferWriter : public Analyzer
+    {
+    public:
+    FrameBufferWriter(std::shared_ptr<SystemDefinition> sysdef,
+                      std::shared_ptr<Trigger> trigger,
+                      int max_frames);
+    ~FrameBufferWriter() = default;
+
+    //! Capture a frame into the buffer
+    void analyze(uint64_t timestep) override;
+
+    //! Remove all buffered frames
+    void clear();
+
+    int getMaxFrames() const;
+    void setMaxFrames(int new_max_frames);
+
+    size_t getCurrentSize() const;
+
+    //! Get the time step of the i-th buffered frame (0 is the oldest)
+    uint64_t getFrameTimestep(size_t i) const;
+
+    //! Get the global box of the i-th buffered frame
+    std::shared_ptr<BoxDim> getFrameBox(size_t i) const;
+
+    //! Get the particle data snapshot of the i-th buffered frame
+    std::shared_ptr<SnapshotParticleData<float>> getFrameSnapshot(size_t i) const;
+
+    protected:
+    //! One captured frame
+    struct Frame
+        {
+        uint64_t timestep;
+        BoxDim box;
+        std::shared_ptr<SnapshotParticleData<float>> snapshot;
+        };
+
+    //! Validate a frame index and return the frame
+    const Frame& getFrame(size_t i) const;
+
+    int m_max_frames;           //!< Maximum number of buffered frames (-1 for no limit)
+    std::deque<Frame> m_frames; //!< Buffered frames, oldest first
+    };
+
+namespace detail
+    {
+void export_FrameBufferWriter(pybind11::module& m);
+    } // namespace detail
+    } // namespace hoomd
@@ -17,6 +17,8 @@
 // for vector types
 #ifdef ENABLE_HIP
 #include <hip/hip_runtime.h>
+
+#include "CachedAllocator.h"
 #endif
 
 #include "ExecutionConfiguration.h"
@@ -27,6 +29,11 @@
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 #include <cxxabi.h>
 #include <sstream>
 
@@ -107,6 +114,8 @@ template<class T> class device_deleter
             this->m_exec_conf->msg->notice(10)
                 << "Freeing " << m_N * sizeof(T) << " bytes of CUDA memory." << std::endl;
 
+            m_exec_conf->getMemoryTracker().unregisterAllocation(ptr);
+
 #ifdef ENABLE_HIP
             hipFree(ptr);
 #endif
@@ -124,16 +133,18 @@ template<class T> class host_deleter
     {
     public:
     //! Default constructor
-    host_deleter() : m_use_device(false), m_N(0) { }
+    host_deleter() : m_use_device(false), m_N(0), m_from_pool(false) { }
 
     //! Ctor
     /*! \param exec_conf Execution configuration
         \param use_device whether the array is managed or on the host
+        \param from_pool whether the allocation came from the pinned host memory pool
      */
     host_deleter(std::shared_ptr<const ExecutionConfiguration> exec_conf,
                  bool use_device,
-                 const size_t N)
-        : m_exec_conf(exec_conf), m_use_device(use_device), m_N(N)
+                 const size_t N,
+                 bool from_pool = false)
+        : m_exec_conf(exec_conf), m_use_device(use_device), m_N(N), m_from_pool(from_pool)
         {
         }
 
@@ -146,8 +157,21 @@ template<class T> class host_deleter
             return;
 
         if (m_exec_conf)
+            {
             m_exec_conf->msg->notice(10)
                 << "Freeing " << m_N * sizeof(T) << " bytes of host memory." << std::endl;
+            m_exec_conf->getMemoryTracker().unregisterAllocation(ptr);
+            }
+
+#ifdef ENABLE_HIP
+        if (m_from_pool)
+            {
+            // return the still-pinned block to the pool for reuse
+            assert(m_exec_conf);
+            m_exec_conf->getCachedHostAllocator().deallocate(reinterpret_cast<char*>(ptr));
+            return;
+            }
+#endif
 
         if (m_use_device)
             {
@@ -167,6 +191,7 @@ template<class T> class host_deleter
     std::shared_ptr<const ExecutionConfiguration> m_exec_conf; //!< The execution configuration
     bool m_use_device;                                         //!< Whether to use hostMallocManaged
     size_t m_N;                                                //!< Number of elements in array
+    bool m_from_pool;                                          //!< True if drawn from the pool
     };
     } // end namespace detail
 
@@ -560,6 +585,25 @@ template<class T> class GPUArray : public GPUArrayBase<T, GPUArray<T>>
         return m_exec_conf;
         }
 
+    //! Set an optional tag for memory profiling
+    /*! \param tag The name of this allocation
+     */
+    inline void setTag(const std::string& tag)
+        {
+        m_tag = tag;
+
+        // retag the live allocations in the registry
+        if (m_exec_conf)
+            {
+            if (h_data)
+                m_exec_conf->getMemoryTracker().updateTag(h_data.get(), tag);
+#ifdef ENABLE_HIP
+            if (d_data)
+                m_exec_conf->getMemoryTracker().updateTag(d_data.get(), tag);
+#endif
+            }
+        }
+
     protected:
     //! Clear memory starting from a given element
     /*! \param first The first element to clear
@@ -607,6 +651,8 @@ template<class T> class GPUArray : public GPUArrayBase<T, GPUArray<T>>
     bool m_mapped; //!< True if we are using mapped memory
 #endif
 
+    std::string m_tag; //!< Name tag of this buffer (optional)
+
     // ok, this looks weird, but I want m_exec_conf to be protected and not have to go reorder all
     // of the initializers
     protected:
@@ -815,6 +861,8 @@ GPUArray<T>::GPUArray(const GPUArray& from) noexcept
 #endif
       m_exec_conf(from.m_exec_conf)
     {
+    m_tag = from.m_tag;
+
     // allocate and clear new memory the same size as the data in from
     allocate();
     memclear();
@@ -839,6 +887,7 @@ template<class T> GPUArray<T>& GPUArray<T>::operator=(const GPUArray& rhs) noexc
         m_pitch = rhs.m_pitch;
         m_height = rhs.m_height;
         m_exec_conf = rhs.m_exec_conf;
+        m_tag = rhs.m_tag;
 #ifdef ENABLE_HIP
         m_mapped = rhs.m_mapped;
 #endif
@@ -879,6 +928,7 @@ GPUArray<T>::GPUArray(GPUArray&& from) noexcept
 #endif
       h_data(std::move(from.h_data)), m_exec_conf(std::move(from.m_exec_conf))
     {
+    m_tag = std::move(from.m_tag);
     }
 
 //! Move assignment operator
@@ -895,6 +945,7 @@ template<class T> GPUArray<T>& GPUArray<T>::operator=(GPUArray&& rhs) noexcept
         d_data = std::move(rhs.d_data);
 #endif
         h_data = std::move(rhs.h_data);
+        m_tag = std::move(rhs.m_tag);
         m_data_location = std::move(rhs.m_data_location);
         m_acquired = std::move(rhs.m_acquired);
         }
@@ -932,6 +983,7 @@ template<class T> void GPUArray<T>::swap(GPUArray& from)
     std::swap(m_mapped, from.m_mapped);
 #endif
     std::swap(h_data, from.h_data);
+    std::swap(m_tag, from.m_tag);
     }
 
 /*! \pre m_num_elements is set
@@ -970,35 +1022,57 @@ template<class T> void GPUArray<T>::allocate()
 
     void* host_ptr = nullptr;
 
-    // allocate host memory
-    // at minimum, alignment needs to be 32 bytes for AVX
-    int retval = posix_memalign(&host_ptr, 32, m_num_elements * sizeof(T));
-    if (retval != 0)
-        {
-        throw std::bad_alloc();
-        }
-
     bool use_device = m_exec_conf && m_exec_conf->isCUDAEnabled();
+    bool from_pool = false;
 
 #ifdef ENABLE_HIP
-    void* device_ptr = nullptr;
-    if (use_device)
+    if (use_device && !m_mapped)
         {
-// register pointer for DMA
+        // draw the host mirror from the pinned memory pool, amortizing the cost of DMA
+        // registration over reuses (mapped arrays need hipHostRegisterMapped and bypass the
+        // pool)
+        host_ptr = m_exec_conf->getCachedHostAllocator().allocate(m_num_elements * sizeof(T));
+        from_pool = true;
+        }
+#endif
+
+    if (!host_ptr)
+        {
+        // allocate host memory
+        // at minimum, alignment needs to be 32 bytes for AVX
+        int retval = posix_memalign(&host_ptr, 32, m_num_elements * sizeof(T));
+        if (retval != 0)
+            {
+            throw std::bad_alloc();
+            }
+
 #ifdef ENABLE_HIP
-        hipHostRegister(host_ptr,
-                        m_num_elements * sizeof(T),
-                        m_mapped ? hipHostRegisterMapped : hipHostRegisterDefault);
+        if (use_device)
+            {
+            // register pointer for DMA
+            hipHostRegister(host_ptr,
+                            m_num_elements * sizeof(T),
+                            m_mapped ? hipHostRegisterMapped : hipHostRegisterDefault);
+            CHECK_CUDA_ERROR();
+            }
 #endif
-        CHECK_CUDA_ERROR();
         }
+
+#ifdef ENABLE_HIP
+    void* device_ptr = nullptr;
 #endif
 
     // store in smart ptr with custom deleter
-    hoomd::detail::host_deleter<T> host_deleter(m_exec_conf, use_device, m_num_elements);
+    hoomd::detail::host_deleter<T> host_deleter(m_exec_conf, use_device, m_num_elements, from_pool);
     h_data = std::unique_ptr<T, hoomd::detail::host_deleter<T>>(reinterpret_cast<T*>(host_ptr),
                                                                 host_deleter);
 
+    if (m_exec_conf)
+        m_exec_conf->getMemoryTracker().registerAllocation(host_ptr,
+                                                           m_num_elements * sizeof(T),
+                                                           MemoryTracker::kind::host,
+                                                           m_tag);
+
 #if defined(ENABLE_HIP)
     if (m_exec_conf && m_exec_conf->isCUDAEnabled())
         {
@@ -1023,6 +1097,9 @@ template<class T> void GPUArray<T>::allocate()
         else
             {
 #ifdef ENABLE_HIP
+            // fail before the driver does when a budget is set
+            m_exec_conf->getMemoryTracker().checkBudget(m_num_elements * sizeof(T), m_tag);
+
             hipError_t error = hipMalloc(&device_ptr, m_num_elements * sizeof(T));
             if (error == hipErrorMemoryAllocation)
                 {
@@ -1032,6 +1109,11 @@ template<class T> void GPUArray<T>::allocate()
                 {
                 throw std::runtime_error(hipGetErrorString(error));
                 }
+
+            m_exec_conf->getMemoryTracker().registerAllocation(device_ptr,
+                                                               m_num_elements * sizeof(T),
+                                                               MemoryTracker::kind::device,
+                                                               m_tag);
 #endif
             }
 
@@ -1060,7 +1142,31 @@ template<class T> void GPUArray<T>::memclear(size_t first)
     assert(first < m_num_elements);
 
     // clear memory
-    memset((void*)(h_data.get() + first), 0, sizeof(T) * (m_num_elements - first));
+#ifdef ENABLE_TBB
+    // on threaded CPU-only builds, zero large arrays in parallel so that the first touch of
+    // each page happens on the thread that will later work on it, placing the pages on the
+    // local NUMA node under the OS first-touch policy
+    const size_t n_clear = m_num_elements - first;
+    if (m_exec_conf && !m_exec_conf->isCUDAEnabled() && m_exec_conf->getNumThreads() > 1
+        && n_clear * sizeof(T) >= 1048576)
+        {
+        T* h_clear = h_data.get() + first;
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<size_t>(0, n_clear),
+                                  [&](const tbb::blocked_range<size_t>& r) {
+                                      memset((void*)(h_clear + r.begin()),
+                                             0,
+                                             sizeof(T) * (r.end() - r.begin()));
+                                  });
+            });
+        }
+    else
+#endif
+        {
+        memset((void*)(h_data.get() + first), 0, sizeof(T) * (m_num_elements - first));
+        }
 
 #if defined(ENABLE_HIP)
     if (m_exec_conf && m_exec_conf->isCUDAEnabled())
@@ -1338,25 +1444,41 @@ template<class T> T* GPUArray<T>::resizeHostArray(size_t num_elements)
     // allocate resized array
     T* h_tmp = NULL;
 
-    // allocate host memory
-    // at minimum, alignment needs to be 32 bytes for AVX
-    int retval = posix_memalign((void**)&h_tmp, 32, num_elements * sizeof(T));
-    if (retval != 0)
+    bool use_device = m_exec_conf && m_exec_conf->isCUDAEnabled();
+    bool from_pool = false;
+
+#ifdef ENABLE_HIP
+    if (use_device && !m_mapped)
         {
-        throw std::bad_alloc();
+        // reuse a pinned block from the pool, avoiding a fresh DMA registration on every
+        // resize
+        h_tmp = reinterpret_cast<T*>(
+            m_exec_conf->getCachedHostAllocator().allocate(num_elements * sizeof(T)));
+        from_pool = true;
         }
+#endif
 
-#ifdef ENABLE_HIP
-    if (m_exec_conf && m_exec_conf->isCUDAEnabled())
+    if (!h_tmp)
         {
+        // allocate host memory
+        // at minimum, alignment needs to be 32 bytes for AVX
+        int retval = posix_memalign((void**)&h_tmp, 32, num_elements * sizeof(T));
+        if (retval != 0)
+            {
+            throw std::bad_alloc();
+            }
+
 #ifdef ENABLE_HIP
-        hipHostRegister(h_tmp,
-                        num_elements * sizeof(T),
-                        m_mapped ? hipHostRegisterMapped : hipHostRegisterDefault);
+        if (use_device)
+            {
+            hipHostRegister(h_tmp,
+                            num_elements * sizeof(T),
+                            m_mapped ? hipHostRegisterMapped : hipHostRegisterDefault);
+            CHECK_CUDA_ERROR();
+            }
 #endif
-        CHECK_CUDA_ERROR();
         }
-#endif
+
     // clear memory
     memset((void*)h_tmp, 0, sizeof(T) * num_elements);
 
@@ -1365,10 +1487,15 @@ template<class T> T* GPUArray<T>::resizeHostArray(size_t num_elements)
     memcpy((void*)h_tmp, (void*)h_data.get(), sizeof(T) * num_copy_elements);
 
     // update smart pointer
-    bool use_device = m_exec_conf && m_exec_conf->isCUDAEnabled();
-    hoomd::detail::host_deleter<T> host_deleter(m_exec_conf, use_device, num_elements);
+    hoomd::detail::host_deleter<T> host_deleter(m_exec_conf, use_device, num_elements, from_pool);
     h_data = std::unique_ptr<T, hoomd::detail::host_deleter<T>>(h_tmp, host_deleter);
 
+    if (m_exec_conf)
+        m_exec_conf->getMemoryTracker().registerAllocation(h_tmp,
+                                                           num_elements * sizeof(T),
+                                                           MemoryTracker::kind::host,
+                                                           m_tag);
+
 #ifdef ENABLE_HIP
     // update device pointer
     if (m_mapped)
@@ -1404,21 +1531,36 @@ T* GPUArray<T>::resize2DHostArray(size_t pitch, size_t new_pitch, size_t height,
     // allocate host memory
     // at minimum, alignment needs to be 32 bytes for AVX
     size_t size = new_pitch * new_height * sizeof(T);
-    int retval = posix_memalign((void**)&h_tmp, 32, size);
-    if (retval != 0)
+
+    bool use_device = m_exec_conf && m_exec_conf->isCUDAEnabled();
+    bool from_pool = false;
+
+#ifdef ENABLE_HIP
+    if (use_device && !m_mapped)
         {
-        throw std::bad_alloc();
+        // reuse a pinned block from the pool, avoiding a fresh DMA registration on every
+        // resize
+        h_tmp = reinterpret_cast<T*>(m_exec_conf->getCachedHostAllocator().allocate(size));
+        from_pool = true;
         }
+#endif
 
-#ifdef ENABLE_HIP
-    if (m_exec_conf && m_exec_conf->isCUDAEnabled())
+    if (!h_tmp)
         {
+        int retval = posix_memalign((void**)&h_tmp, 32, size);
+        if (retval != 0)
+            {
+            throw std::bad_alloc();
+            }
+
 #ifdef ENABLE_HIP
-        hipHostRegister(h_tmp, size, m_mapped ? hipHostRegisterMapped : hipHostRegisterDefault);
+        if (use_device)
+            {
+            hipHostRegister(h_tmp, size, m_mapped ? hipHostRegisterMapped : hipHostRegisterDefault);
+            CHECK_CUDA_ERROR();
+            }
 #endif
-        CHECK_CUDA_ERROR();
         }
-#endif
 
     // clear memory
     memset((void*)h_tmp, 0, sizeof(T) * new_pitch * new_height);
@@ -1433,10 +1575,18 @@ T* GPUArray<T>::resize2DHostArray(size_t pitch, size_t new_pitch, size_t height,
                sizeof(T) * num_copy_columns);
 
     // update smart pointer
-    bool use_device = m_exec_conf && m_exec_conf->isCUDAEnabled();
-    hoomd::detail::host_deleter<T> host_deleter(m_exec_conf, use_device, new_pitch * new_height);
+    hoomd::detail::host_deleter<T> host_deleter(m_exec_conf,
+                                                use_device,
+                                                new_pitch * new_height,
+                                                from_pool);
     h_data = std::unique_ptr<T, hoomd::detail::host_deleter<T>>(h_tmp, host_deleter);
 
+    if (m_exec_conf)
+        m_exec_conf->getMemoryTracker().registerAllocation(h_tmp,
+                                                           size,
+                                                           MemoryTracker::kind::host,
+                                                           m_tag);
+
 #ifdef ENABLE_HIP
     // update device pointer
     if (m_mapped)
@@ -1476,6 +1626,10 @@ template<class T> T* GPUArray<T>::resizeDeviceArray(size_t num_elements)
     // allocate resized array
     T* d_tmp;
 #ifdef ENABLE_HIP
+    // fail before the driver does when a budget is set
+    if (m_exec_conf)
+        m_exec_conf->getMemoryTracker().checkBudget(num_elements * sizeof(T), m_tag);
+
     hipError_t error = hipMalloc(&d_tmp, num_elements * sizeof(T));
     if (error == hipErrorMemoryAllocation)
         {
@@ -1485,6 +1639,12 @@ template<class T> T* GPUArray<T>::resizeDeviceArray(size_t num_elements)
         {
         throw std::runtime_error(hipGetErrorString(error));
         }
+
+    if (m_exec_conf)
+        m_exec_conf->getMemoryTracker().registerAllocation(d_tmp,
+                                                           num_elements * sizeof(T),
+                                                           MemoryTracker::kind::device,
+                                                           m_tag);
 #endif
 
     assert(d_tmp);
@@ -1535,6 +1695,10 @@ T* GPUArray<T>::resize2DDeviceArray(size_t pitch,
     // allocate resized array
     T* d_tmp;
 #ifdef ENABLE_HIP
+    // fail before the driver does when a budget is set
+    if (m_exec_conf)
+        m_exec_conf->getMemoryTracker().checkBudget(new_pitch * new_height * sizeof(T), m_tag);
+
     hipError_t error = hipMalloc(&d_tmp, new_pitch * new_height * sizeof(T));
     if (error == hipErrorMemoryAllocation)
         {
@@ -1544,6 +1708,12 @@ T* GPUArray<T>::resize2DDeviceArray(size_t pitch,
         {
         throw std::runtime_error(hipGetErrorString(error));
         }
+
+    if (m_exec_conf)
+        m_exec_conf->getMemoryTracker().registerAllocation(d_tmp,
+                                                           new_pitch * new_height * sizeof(T),
+                                                           MemoryTracker::kind::device,
+                                                           m_tag);
 #endif
     assert(d_tmp);
 
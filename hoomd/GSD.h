@@ -4,9 +4,12 @@
 #pragma once
 
 #include "hoomd/extern/gsd.h"
+#include <cmath>
+#include <cstdint>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace hoomd
     {
@@ -99,5 +102,86 @@ class GSDUtils
             }
         }
     };
+
+/// Quantized-delta codec for compressed trajectory chunks.
+/** Values are converted to fixed point on a grid of a given precision. Each frame stores
+    the difference to the previous frame's grid values, zig-zag mapped to unsigned and
+    packed as LEB128 variable length integers: coordinates that moved little since the
+    last frame encode in one or two bytes. The integer reference (not the reconstructed
+    floats) carries from frame to frame, so quantization error does not accumulate along
+    the trajectory.
+*/
+class GSDDeltaCodec
+    {
+    public:
+    /// Convert \a n float values to fixed point with the given grid spacing.
+    static void quantize(const float* values, size_t n, double precision, std::vector<int64_t>& q)
+        {
+        q.resize(n);
+        for (size_t i = 0; i < n; i++)
+            q[i] = (int64_t)llround((double)values[i] / precision);
+        }
+
+    /// Convert fixed point values back to floats.
+    static void dequantize(const std::vector<int64_t>& q, double precision, float* values)
+        {
+        for (size_t i = 0; i < q.size(); i++)
+            values[i] = (float)((double)q[i] * precision);
+        }
+
+    /// Encode the delta from \a reference to \a q into \a out and advance the reference.
+    static void encode(const std::vector<int64_t>& q,
+                       std::vector<int64_t>& reference,
+                       std::vector<uint8_t>& out)
+        {
+        out.clear();
+        for (size_t i = 0; i < q.size(); i++)
+            {
+            uint64_t u = zigzag(q[i] - reference[i]);
+            while (u >= 0x80)
+                {
+                out.push_back((uint8_t)(u & 0x7f) | 0x80);
+                u >>= 7;
+                }
+            out.push_back((uint8_t)u);
+            }
+        reference = q;
+        }
+
+    /// Apply one frame of encoded deltas to \a reference.
+    static void decode(const uint8_t* data, size_t n_bytes, std::vector<int64_t>& reference)
+        {
+        size_t pos = 0;
+        for (size_t i = 0; i < reference.size(); i++)
+            {
+            uint64_t u = 0;
+            unsigned int shift = 0;
+            while (true)
+                {
+                if (pos == n_bytes || shift > 63)
+                    throw std::runtime_error("GSD: Corrupt compressed position chunk");
+                uint8_t byte = data[pos++];
+                u |= (uint64_t)(byte & 0x7f) << shift;
+                if (!(byte & 0x80))
+                    break;
+                shift += 7;
+                }
+            reference[i] += unzigzag(u);
+            }
+        if (pos != n_bytes)
+            throw std::runtime_error("GSD: Corrupt compressed position chunk");
+        }
+
+    private:
+    static uint64_t zigzag(int64_t v)
+        {
+        return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+        }
+
+    static int64_t unzigzag(uint64_t u)
+        {
+        return (int64_t)(u >> 1) ^ -(int64_t)(u & 1);
+        }
+    };
     } // namespace detail
     } // namespace hoomd
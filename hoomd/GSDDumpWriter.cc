@@ -13,16 +13,30 @@
 #include <pybind11/numpy.h>
 #include <pybind11/stl_bind.h>
 
+#include <algorithm>
 #include <limits>
 #include <list>
+#include <cerrno>
 #include <sstream>
 #include <stdexcept>
 #include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
 using namespace std;
 using namespace hoomd::detail;
 
 namespace hoomd
     {
+namespace
+    {
+//! Map a box fraction in [0,1] onto the full uint16 range, clamping roundoff excursions
+inline uint16_t quantizeUnitFraction(Scalar f)
+    {
+    f = std::min(std::max(f, Scalar(0.0)), Scalar(1.0));
+    return (uint16_t)(f * Scalar(65535.0) + Scalar(0.5));
+    }
+    } // end namespace
+
 std::list<std::string> GSDDumpWriter::particle_chunks {"particles/position",
                                                        "particles/typeid",
                                                        "particles/mass",
@@ -75,6 +89,12 @@ GSDDumpWriter::GSDDumpWriter(std::shared_ptr<SystemDefinition> sysdef,
     m_dynamic[gsd_flag::particles_position] = true;
     m_dynamic[gsd_flag::particles_orientation] = true;
 
+    // the tag ordered index is maintained across frames and rebuilt only after resorts,
+    // migrations, particle number changes, or group membership rebuilds
+    m_pdata->getParticleSortSignal().connect<GSDDumpWriter, &GSDDumpWriter::slotParticleSort>(this);
+    m_pdata->getGlobalParticleNumberChangeSignal()
+        .connect<GSDDumpWriter, &GSDDumpWriter::slotParticleSort>(this);
+
     initFileIO();
     }
 
@@ -220,6 +240,9 @@ void GSDDumpWriter::setDynamic(pybind11::object dynamic)
 
 void GSDDumpWriter::flush()
     {
+    waitForPendingWrite();
+    reapCheckpointChild();
+
     if (m_exec_conf->isRoot())
         {
         m_exec_conf->msg->notice(5) << "GSD: flush gsd file " << m_fname << endl;
@@ -230,6 +253,9 @@ void GSDDumpWriter::flush()
 
 void GSDDumpWriter::setMaximumWriteBufferSize(uint64_t size)
     {
+    waitForPendingWrite();
+    reapCheckpointChild();
+
     if (m_exec_conf->isRoot())
         {
         int retval = gsd_set_maximum_write_buffer_size(&m_handle, size);
@@ -327,6 +353,31 @@ GSDDumpWriter::~GSDDumpWriter()
     {
     m_exec_conf->msg->notice(5) << "Destroying GSDDumpWriter" << endl;
 
+    m_pdata->getParticleSortSignal().disconnect<GSDDumpWriter, &GSDDumpWriter::slotParticleSort>(
+        this);
+    m_pdata->getGlobalParticleNumberChangeSignal()
+        .disconnect<GSDDumpWriter, &GSDDumpWriter::slotParticleSort>(this);
+
+    if (m_io_thread.joinable())
+        {
+            {
+            std::unique_lock<std::mutex> lock(m_io_mutex);
+            m_io_cv.wait(lock, [&] { return !m_io_pending; });
+            m_io_exit = true;
+            }
+        m_io_cv.notify_all();
+        m_io_thread.join();
+        }
+
+    try
+        {
+        reapCheckpointChild();
+        }
+    catch (const std::exception& e)
+        {
+        m_exec_conf->msg->warning() << e.what() << endl;
+        }
+
     if (m_exec_conf->isRoot())
         {
         m_exec_conf->msg->notice(5) << "GSD: close gsd file " << m_fname << endl;
@@ -358,6 +409,10 @@ void GSDDumpWriter::analyze(uint64_t timestep)
     // truncate the file if requested
     if (m_truncate)
         {
+        // the truncate touches the file handle: wait for any in-flight frame first
+        waitForPendingWrite();
+        reapCheckpointChild();
+
         if (m_exec_conf->isRoot())
             {
             m_exec_conf->msg->notice(10) << "GSD: truncating file" << endl;
@@ -375,29 +430,40 @@ void GSDDumpWriter::analyze(uint64_t timestep)
 
 void GSDDumpWriter::write(GSDDumpWriter::GSDFrame& frame, pybind11::dict log_data)
     {
+    GSDFrame* write_frame = &frame;
 #ifdef ENABLE_MPI
     if (m_sysdef->isDomainDecomposed())
         {
-        gatherGlobalFrame(frame);
-
-        if (m_exec_conf->isRoot())
+        // stage the gather quantity group by quantity group to keep the root rank's
+        // peak memory below the full global frame; async writes need the whole frame
+        // in one buffer and keep the single full gather
+        if (!m_async)
             {
-            writeFrameHeader(m_global_frame);
-            writeAttributes(m_global_frame);
-            writeProperties(m_global_frame);
-            writeMomenta(m_global_frame);
-            writeLogQuantities(log_data);
+            writeStagedFrame(frame, log_data);
+            return;
             }
+
+        gatherGlobalFrame(frame);
+        write_frame = &m_global_frame;
         }
-    else
 #endif
+
+    // double buffering: block only when the previous frame is still in flight
+    waitForPendingWrite();
+
+    if (m_fork_write)
+        {
+        // the child serializes everything, including the python-facing chunks
+        forkWriteFrame(*write_frame, log_data);
+        return;
+        }
+
+    // chunks that touch python state are written on the simulation thread
+    if (m_exec_conf->isRoot())
         {
-        writeFrameHeader(frame);
-        writeAttributes(frame);
-        writeProperties(frame);
-        writeMomenta(frame);
         writeLogQuantities(log_data);
         }
+
     // topology is only meaningful if this is the all group
     if (m_group->getNumMembersGlobal() == m_pdata->getNGlobal()
         && (m_write_topology || m_nframes == 0))
@@ -413,12 +479,231 @@ void GSDDumpWriter::write(GSDDumpWriter::GSDFrame& frame, pybind11::dict log_dat
             }
         }
 
-    if (m_exec_conf->isRoot())
+    if (m_async && m_exec_conf->isRoot())
         {
-        m_exec_conf->msg->notice(10) << "GSD: ending frame" << endl;
-        int retval = gsd_end_frame(&m_handle);
+        // hand the frame to the background I/O thread: swapping buffers leaves the
+        // previous I/O frame for populateLocalFrame to refill on the next trigger
+        std::swap(m_io_frame, *write_frame);
+
+        if (!m_io_thread.joinable())
+            {
+            m_io_thread = std::thread(&GSDDumpWriter::ioThreadLoop, this);
+            }
+
+            {
+            std::lock_guard<std::mutex> lock(m_io_mutex);
+            m_io_pending = true;
+            }
+        m_io_cv.notify_all();
+        }
+    else
+        {
+        if (m_exec_conf->isRoot())
+            {
+            writeFrameData(*write_frame);
+            }
+
+        m_nframes++;
+        }
+    }
+
+/*! Write the heavy per-frame particle chunks and end the frame. Only touches the GSD
+    handle and \a frame: safe to run on the background I/O thread.
+*/
+void GSDDumpWriter::writeFrameData(const GSDDumpWriter::GSDFrame& frame)
+    {
+    writeFrameHeader(frame);
+    writeAttributes(frame);
+    writeProperties(frame);
+    writeMomenta(frame);
+
+    m_exec_conf->msg->notice(10) << "GSD: ending frame" << endl;
+    int retval = gsd_end_frame(&m_handle);
+    GSDUtils::checkError(retval, m_fname);
+    }
+
+void GSDDumpWriter::ioThreadLoop()
+    {
+    std::unique_lock<std::mutex> lock(m_io_mutex);
+    while (true)
+        {
+        m_io_cv.wait(lock, [&] { return m_io_pending || m_io_exit; });
+        if (!m_io_pending)
+            {
+            break;
+            }
+
+        lock.unlock();
+        try
+            {
+            writeFrameData(m_io_frame);
+            }
+        catch (...)
+            {
+            // defer the error to the simulation thread: it is rethrown from the next
+            // waitForPendingWrite()
+            m_io_exception = std::current_exception();
+            }
+        lock.lock();
+
+        m_nframes++;
+        m_io_pending = false;
+        m_io_cv.notify_all();
+        }
+    }
+
+void GSDDumpWriter::waitForPendingWrite()
+    {
+    if (m_io_thread.joinable())
+        {
+        std::unique_lock<std::mutex> lock(m_io_mutex);
+        m_io_cv.wait(lock, [&] { return !m_io_pending; });
+        }
+
+    if (m_io_exception)
+        {
+        std::exception_ptr e = m_io_exception;
+        m_io_exception = nullptr;
+        std::rethrow_exception(e);
+        }
+    }
+
+void GSDDumpWriter::setAsync(bool async)
+    {
+    if (async && m_fork_write)
+        {
+        throw std::invalid_argument("async_write and fork_write are mutually exclusive.");
+        }
+    if (!async)
+        {
+        waitForPendingWrite();
+        }
+    m_async = async;
+    }
+
+void GSDDumpWriter::setForkWrite(bool fork_write)
+    {
+    if (fork_write)
+        {
+#ifdef ENABLE_MPI
+        if (m_exec_conf->getNRanks() > 1)
+            {
+            throw std::invalid_argument("fork_write is not available in MPI simulations.");
+            }
+#endif
+        if (m_exec_conf->isCUDAEnabled())
+            {
+            throw std::invalid_argument("fork_write is only available on the CPU device.");
+            }
+        if (m_async)
+            {
+            throw std::invalid_argument("async_write and fork_write are mutually exclusive.");
+            }
+        if (m_compress_positions)
+            {
+            // the parent's delta reference would go stale: each child mutates only its
+            // own copy-on-write image of it
+            throw std::invalid_argument("fork_write and compress_positions are mutually "
+                                        "exclusive.");
+            }
+        }
+    else
+        {
+        reapCheckpointChild();
+        }
+    m_fork_write = fork_write;
+    }
+
+/*! Block until the in-flight checkpoint child (if any) exits, then re-read the file
+    index so that later writes from this process append after the frame the child wrote.
+*/
+void GSDDumpWriter::reapCheckpointChild()
+    {
+    if (m_checkpoint_pid < 0)
+        {
+        return;
+        }
+
+    int status = 0;
+    while (waitpid(m_checkpoint_pid, &status, 0) < 0 && errno == EINTR)
+        {
+        }
+    m_checkpoint_pid = -1;
+
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        {
+        throw std::runtime_error("Error writing GSD checkpoint in forked process: " + m_fname);
+        }
+
+    gsd_close(&m_handle);
+    int retval = gsd_open(&m_handle, m_fname.c_str(), GSD_OPEN_APPEND);
+    GSDUtils::checkError(retval, m_fname);
+    m_nframes = gsd_get_nframes(&m_handle);
+    }
+
+/*! Fork the process and serialize \a frame in the child while this process returns
+    immediately. The copy-on-write fork freezes the simulation state for the child at no
+    cost to the parent, hiding the full serialization latency behind continued stepping.
+    When the fork fails the frame is written synchronously instead.
+*/
+void GSDDumpWriter::forkWriteFrame(GSDDumpWriter::GSDFrame& frame, pybind11::dict log_data)
+    {
+    // only one checkpoint child at a time: the next trigger waits for the previous one
+    reapCheckpointChild();
+
+    // put the file in a consistent on-disk state so the child appends to a clean index
+    int retval = gsd_flush(&m_handle);
+    GSDUtils::checkError(retval, m_fname);
+
+    pid_t pid = fork();
+    if (pid > 0)
+        {
+        m_checkpoint_pid = pid;
+        m_nframes++;
+        return;
+        }
+
+    if (pid < 0)
+        {
+        m_exec_conf->msg->warning()
+            << "GSD: fork() failed, writing checkpoint synchronously" << endl;
+        }
+
+    // child (or synchronous fallback): serialize the frozen state
+    try
+        {
+        writeLogQuantities(log_data);
+
+        if (m_group->getNumMembersGlobal() == m_pdata->getNGlobal()
+            && (m_write_topology || m_nframes == 0))
+            {
+            writeTopology(frame.bond_data,
+                          frame.angle_data,
+                          frame.dihedral_data,
+                          frame.improper_data,
+                          frame.constraint_data,
+                          frame.pair_data);
+            }
+
+        writeFrameData(frame);
+
+        retval = gsd_flush(&m_handle);
         GSDUtils::checkError(retval, m_fname);
         }
+    catch (...)
+        {
+        if (pid == 0)
+            {
+            _exit(1);
+            }
+        throw;
+        }
+
+    if (pid == 0)
+        {
+        // skip destructors and atexit handlers: the child shares them with the parent
+        _exit(0);
+        }
 
     m_nframes++;
     }
@@ -507,68 +792,116 @@ void GSDDumpWriter::writeFrameHeader(const GSDDumpWriter::GSDFrame& frame)
         }
     }
 
+namespace
+    {
+//! True when the contents of \a a and \a b are bit-identical
+template<class T> bool identical_chunks(const std::vector<T>& a, const std::vector<T>& b)
+    {
+    return a.size() == b.size()
+           && (a.empty() || memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0);
+    }
+    } // namespace
+
 /*! Writes the data chunks types, typeid, mass, charge, diameter, body, moment_inertia in
    particles/.
+
+    Chunks that are marked dynamic but are bit-identical to the copy written in frame 0 are
+    skipped: readers fall back to frame 0 when a chunk is absent from a frame, so no
+    information is lost. This keeps close-spaced frames (e.g. burst checkpoints) from
+    rewriting attribute data that never changes. The cache is only valid when this writer
+    wrote frame 0 of the file; appends to pre-existing files always write.
 */
 void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
     {
     uint32_t N = m_group->getNumMembersGlobal();
     int retval;
 
+    if (m_nframes == 0)
+        {
+        m_attribute_cache = AttributeCache();
+        m_attribute_cache.valid = true;
+        }
+
+    const bool check_cache = m_nframes > 0 && m_attribute_cache.valid;
+
     if (m_dynamic[gsd_flag::particles_types] || m_nframes == 0)
         {
-        writeTypeMapping("particles/types", frame.particle_data.type_mapping);
+        if (!(check_cache && frame.particle_data.type_mapping == m_attribute_cache.type_mapping))
+            {
+            writeTypeMapping("particles/types", frame.particle_data.type_mapping);
+            }
+        if (m_nframes == 0)
+            m_attribute_cache.type_mapping = frame.particle_data.type_mapping;
         }
 
     if (frame.particle_data.type.size() != 0)
         {
         assert(frame.particle_data.type.size() == N);
 
-        m_exec_conf->msg->notice(10) << "GSD: writing particles/typeid" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/typeid",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)frame.particle_data.type.data());
-        GSDUtils::checkError(retval, m_fname);
+        if (!(check_cache && identical_chunks(frame.particle_data.type, m_attribute_cache.type)))
+            {
+            m_exec_conf->msg->notice(10) << "GSD: writing particles/typeid" << endl;
+            retval = gsd_write_chunk(&m_handle,
+                                     "particles/typeid",
+                                     GSD_TYPE_UINT32,
+                                     N,
+                                     1,
+                                     0,
+                                     (void*)frame.particle_data.type.data());
+            GSDUtils::checkError(retval, m_fname);
+            }
         if (m_nframes == 0)
+            {
             m_nondefault["particles/typeid"] = true;
+            m_attribute_cache.type = frame.particle_data.type;
+            }
         }
 
     if (frame.particle_data.mass.size() != 0)
         {
         assert(frame.particle_data.mass.size() == N);
 
-        m_exec_conf->msg->notice(10) << "GSD: writing particles/mass" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/mass",
-                                 GSD_TYPE_FLOAT,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)frame.particle_data.mass.data());
-        GSDUtils::checkError(retval, m_fname);
+        if (!(check_cache && identical_chunks(frame.particle_data.mass, m_attribute_cache.mass)))
+            {
+            m_exec_conf->msg->notice(10) << "GSD: writing particles/mass" << endl;
+            retval = gsd_write_chunk(&m_handle,
+                                     "particles/mass",
+                                     GSD_TYPE_FLOAT,
+                                     N,
+                                     1,
+                                     0,
+                                     (void*)frame.particle_data.mass.data());
+            GSDUtils::checkError(retval, m_fname);
+            }
         if (m_nframes == 0)
+            {
             m_nondefault["particles/mass"] = true;
+            m_attribute_cache.mass = frame.particle_data.mass;
+            }
         }
 
     if (frame.particle_data.charge.size() != 0)
         {
         assert(frame.particle_data.charge.size() == N);
 
-        m_exec_conf->msg->notice(10) << "GSD: writing particles/charge" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/charge",
-                                 GSD_TYPE_FLOAT,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)frame.particle_data.charge.data());
-        GSDUtils::checkError(retval, m_fname);
+        if (!(check_cache
+              && identical_chunks(frame.particle_data.charge, m_attribute_cache.charge)))
+            {
+            m_exec_conf->msg->notice(10) << "GSD: writing particles/charge" << endl;
+            retval = gsd_write_chunk(&m_handle,
+                                     "particles/charge",
+                                     GSD_TYPE_FLOAT,
+                                     N,
+                                     1,
+                                     0,
+                                     (void*)frame.particle_data.charge.data());
+            GSDUtils::checkError(retval, m_fname);
+            }
         if (m_nframes == 0)
+            {
             m_nondefault["particles/charge"] = true;
+            m_attribute_cache.charge = frame.particle_data.charge;
+            }
         }
 
     if (m_write_diameter)
@@ -577,17 +910,24 @@ void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
             {
             assert(frame.particle_data.diameter.size() == N);
 
-            m_exec_conf->msg->notice(10) << "GSD: writing particles/diameter" << endl;
-            retval = gsd_write_chunk(&m_handle,
-                                     "particles/diameter",
-                                     GSD_TYPE_FLOAT,
-                                     N,
-                                     1,
-                                     0,
-                                     (void*)frame.particle_data.diameter.data());
-            GSDUtils::checkError(retval, m_fname);
+            if (!(check_cache
+                  && identical_chunks(frame.particle_data.diameter, m_attribute_cache.diameter)))
+                {
+                m_exec_conf->msg->notice(10) << "GSD: writing particles/diameter" << endl;
+                retval = gsd_write_chunk(&m_handle,
+                                         "particles/diameter",
+                                         GSD_TYPE_FLOAT,
+                                         N,
+                                         1,
+                                         0,
+                                         (void*)frame.particle_data.diameter.data());
+                GSDUtils::checkError(retval, m_fname);
+                }
             if (m_nframes == 0)
+                {
                 m_nondefault["particles/diameter"] = true;
+                m_attribute_cache.diameter = frame.particle_data.diameter;
+                }
             }
         }
 
@@ -595,34 +935,47 @@ void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
         {
         assert(frame.particle_data.body.size() == N);
 
-        m_exec_conf->msg->notice(10) << "GSD: writing particles/body" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/body",
-                                 GSD_TYPE_INT32,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)frame.particle_data.body.data());
-        GSDUtils::checkError(retval, m_fname);
+        if (!(check_cache && identical_chunks(frame.particle_data.body, m_attribute_cache.body)))
+            {
+            m_exec_conf->msg->notice(10) << "GSD: writing particles/body" << endl;
+            retval = gsd_write_chunk(&m_handle,
+                                     "particles/body",
+                                     GSD_TYPE_INT32,
+                                     N,
+                                     1,
+                                     0,
+                                     (void*)frame.particle_data.body.data());
+            GSDUtils::checkError(retval, m_fname);
+            }
         if (m_nframes == 0)
+            {
             m_nondefault["particles/body"] = true;
+            m_attribute_cache.body = frame.particle_data.body;
+            }
         }
 
     if (frame.particle_data.inertia.size() != 0)
         {
         assert(frame.particle_data.inertia.size() == N);
 
-        m_exec_conf->msg->notice(10) << "GSD: writing particles/moment_inertia" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/moment_inertia",
-                                 GSD_TYPE_FLOAT,
-                                 N,
-                                 3,
-                                 0,
-                                 (void*)frame.particle_data.inertia.data());
-        GSDUtils::checkError(retval, m_fname);
+        if (!(check_cache
+              && identical_chunks(frame.particle_data.inertia, m_attribute_cache.inertia)))
+            {
+            m_exec_conf->msg->notice(10) << "GSD: writing particles/moment_inertia" << endl;
+            retval = gsd_write_chunk(&m_handle,
+                                     "particles/moment_inertia",
+                                     GSD_TYPE_FLOAT,
+                                     N,
+                                     3,
+                                     0,
+                                     (void*)frame.particle_data.inertia.data());
+            GSDUtils::checkError(retval, m_fname);
+            }
         if (m_nframes == 0)
+            {
             m_nondefault["particles/moment_inertia"] = true;
+            m_attribute_cache.inertia = frame.particle_data.inertia;
+            }
         }
     }
 
@@ -637,17 +990,90 @@ void GSDDumpWriter::writeProperties(const GSDDumpWriter::GSDFrame& frame)
         {
         assert(frame.particle_data.pos.size() == N);
 
-        m_exec_conf->msg->notice(10) << "GSD: writing particles/position" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/position",
-                                 GSD_TYPE_FLOAT,
-                                 N,
-                                 3,
-                                 0,
-                                 (void*)frame.particle_data.pos.data());
-        GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
-            m_nondefault["particles/position"] = true;
+        if (m_normalized_positions)
+            {
+            // box-normalized 16-bit fractions: each frame is self-contained and readable
+            // at random, for archives that are only rendered and never re-analyzed
+            m_exec_conf->msg->notice(10) << "GSD: writing quantization/position" << endl;
+            m_position_u16_buffer.resize((size_t)N * 3);
+            const float* pos = (const float*)frame.particle_data.pos.data();
+            for (size_t i = 0; i < (size_t)N; i++)
+                {
+                const Scalar3 f = frame.global_box.makeFraction(
+                    make_scalar3(pos[3 * i], pos[3 * i + 1], pos[3 * i + 2]));
+                m_position_u16_buffer[3 * i] = quantizeUnitFraction(f.x);
+                m_position_u16_buffer[3 * i + 1] = quantizeUnitFraction(f.y);
+                m_position_u16_buffer[3 * i + 2] = quantizeUnitFraction(f.z);
+                }
+
+            retval = gsd_write_chunk(&m_handle,
+                                     "quantization/position",
+                                     GSD_TYPE_UINT16,
+                                     N,
+                                     3,
+                                     0,
+                                     (void*)m_position_u16_buffer.data());
+            GSDUtils::checkError(retval, m_fname);
+            }
+        else
+            {
+            // write an absolute position keyframe when compression is off, on the first
+            // compressed frame, and whenever the number of particles changes
+            bool keyframe = !m_compress_positions || m_truncate
+                            || m_position_reference.size() != (size_t)N * 3;
+
+            if (keyframe)
+                {
+                m_exec_conf->msg->notice(10) << "GSD: writing particles/position" << endl;
+                retval = gsd_write_chunk(&m_handle,
+                                         "particles/position",
+                                         GSD_TYPE_FLOAT,
+                                         N,
+                                         3,
+                                         0,
+                                         (void*)frame.particle_data.pos.data());
+                GSDUtils::checkError(retval, m_fname);
+                if (m_nframes == 0)
+                    m_nondefault["particles/position"] = true;
+
+                if (m_compress_positions)
+                    {
+                    // the reader recovers the same reference by quantizing the keyframe
+                    GSDDeltaCodec::quantize((const float*)frame.particle_data.pos.data(),
+                                            (size_t)N * 3,
+                                            m_compression_precision,
+                                            m_position_reference);
+                    }
+                }
+            else
+                {
+                m_exec_conf->msg->notice(10) << "GSD: writing compression/position" << endl;
+                std::vector<int64_t> q;
+                GSDDeltaCodec::quantize((const float*)frame.particle_data.pos.data(),
+                                        (size_t)N * 3,
+                                        m_compression_precision,
+                                        q);
+                GSDDeltaCodec::encode(q, m_position_reference, m_position_delta_buffer);
+
+                retval = gsd_write_chunk(&m_handle,
+                                         "compression/position/precision",
+                                         GSD_TYPE_DOUBLE,
+                                         1,
+                                         1,
+                                         0,
+                                         (void*)&m_compression_precision);
+                GSDUtils::checkError(retval, m_fname);
+
+                retval = gsd_write_chunk(&m_handle,
+                                         "compression/position",
+                                         GSD_TYPE_UINT8,
+                                         m_position_delta_buffer.size(),
+                                         1,
+                                         0,
+                                         (void*)m_position_delta_buffer.data());
+                GSDUtils::checkError(retval, m_fname);
+                }
+            }
         }
 
     if (frame.particle_data.orientation.size() != 0)
@@ -1072,28 +1498,45 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
     all_default.set();
     frame.clear();
 
-    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
-
     if (N > 0)
         {
-        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
-                                        access_location::host,
-                                        access_mode::read);
+        // rebuild the tag ordered index when particles were resorted or migrated since the
+        // last frame, or when the group membership itself was rebuilt (e.g. by
+        // hoomd.update.FilterUpdater, which does not fire a particle data signal)
+        if (!m_tag_order_cached || m_cached_member_generation != m_group->getMemberGeneration())
+            {
+            ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
+                                             access_location::host,
+                                             access_mode::read);
+            ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
+                                            access_location::host,
+                                            access_mode::read);
 
-        m_index.resize(0);
+            m_index.resize(0);
+            m_local_tags.resize(0);
 
-        for (unsigned int group_tag_index = 0; group_tag_index < N; group_tag_index++)
-            {
-            unsigned int tag = m_group->getMemberTag(group_tag_index);
-            unsigned int index = h_rtag.data[tag];
-            if (index >= m_pdata->getN())
+            for (unsigned int group_tag_index = 0; group_tag_index < N; group_tag_index++)
                 {
-                continue;
+                unsigned int tag = m_group->getMemberTag(group_tag_index);
+                unsigned int index = h_rtag.data[tag];
+                if (index >= m_pdata->getN())
+                    {
+                    continue;
+                    }
+
+                m_local_tags.push_back(h_tag.data[index]);
+                m_index.push_back(index);
                 }
 
-            frame.particle_tags.push_back(h_tag.data[index]);
-            m_index.push_back(index);
+            m_tag_order_cached = true;
+            m_cached_member_generation = m_group->getMemberGeneration();
+#ifdef ENABLE_MPI
+            // the gather order is derived from the local tag list and must follow it
+            m_gather_order_current = false;
+#endif
             }
+
+        frame.particle_tags = m_local_tags;
         }
 
     if (N > 0
@@ -1459,6 +1902,39 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
 */
 void GSDDumpWriter::gatherGlobalFrame(const GSDFrame& local_frame)
     {
+    // re-establish the gather order only when a rank's local tag list changed since the
+    // last frame; agree on the decision collectively so the ranks stay in lockstep
+    int order_current = m_gather_order_current ? 1 : 0;
+    MPI_Allreduce(MPI_IN_PLACE,
+                  &order_current,
+                  1,
+                  MPI_INT,
+                  MPI_LAND,
+                  m_exec_conf->getMPICommunicator());
+
+    if (!order_current)
+        {
+        m_gather_tag_order.setLocalTagsSorted(local_frame.particle_tags);
+        m_gather_order_current = true;
+        }
+
+    std::bitset<n_gsd_flags> fields;
+    fields.set();
+    gatherParticleFields(local_frame, fields);
+    }
+
+/*! Gather the selected per-particle arrays from the local frame into m_global_frame,
+    releasing whatever the global frame held before.
+
+    \pre setLocalTagsSorted() has established the gather order for this frame
+
+    The staged write path gathers one group of quantities at a time, so the root rank
+    never holds more than one group of global arrays: without staging, the full global
+    frame is the rank 0 memory ceiling for large systems.
+*/
+void GSDDumpWriter::gatherParticleFields(const GSDFrame& local_frame,
+                                         const std::bitset<n_gsd_flags>& fields)
+    {
     m_global_frame.clear();
 
     m_global_frame.timestep = local_frame.timestep;
@@ -1466,66 +1942,157 @@ void GSDDumpWriter::gatherGlobalFrame(const GSDFrame& local_frame)
     m_global_frame.particle_data.type_mapping = local_frame.particle_data.type_mapping;
     m_global_frame.particle_data_present = local_frame.particle_data_present;
 
-    m_gather_tag_order.setLocalTagsSorted(local_frame.particle_tags);
-
-    if (local_frame.particle_data_present[gsd_flag::particles_position])
+    if (fields[gsd_flag::particles_position]
+        && local_frame.particle_data_present[gsd_flag::particles_position])
         {
         m_gather_tag_order.gatherArray(m_global_frame.particle_data.pos,
                                        local_frame.particle_data.pos);
         }
 
-    if (local_frame.particle_data_present[gsd_flag::particles_orientation])
+    if (fields[gsd_flag::particles_orientation]
+        && local_frame.particle_data_present[gsd_flag::particles_orientation])
         {
         m_gather_tag_order.gatherArray(m_global_frame.particle_data.orientation,
                                        local_frame.particle_data.orientation);
         }
-    if (local_frame.particle_data_present[gsd_flag::particles_type])
+    if (fields[gsd_flag::particles_type]
+        && local_frame.particle_data_present[gsd_flag::particles_type])
         {
         m_gather_tag_order.gatherArray(m_global_frame.particle_data.type,
                                        local_frame.particle_data.type);
         }
-    if (local_frame.particle_data_present[gsd_flag::particles_mass])
+    if (fields[gsd_flag::particles_mass]
+        && local_frame.particle_data_present[gsd_flag::particles_mass])
         {
         m_gather_tag_order.gatherArray(m_global_frame.particle_data.mass,
                                        local_frame.particle_data.mass);
         }
-    if (local_frame.particle_data_present[gsd_flag::particles_charge])
+    if (fields[gsd_flag::particles_charge]
+        && local_frame.particle_data_present[gsd_flag::particles_charge])
         {
         m_gather_tag_order.gatherArray(m_global_frame.particle_data.charge,
                                        local_frame.particle_data.charge);
         }
-    if (local_frame.particle_data_present[gsd_flag::particles_diameter])
+    if (fields[gsd_flag::particles_diameter]
+        && local_frame.particle_data_present[gsd_flag::particles_diameter])
         {
         m_gather_tag_order.gatherArray(m_global_frame.particle_data.diameter,
                                        local_frame.particle_data.diameter);
         }
-    if (local_frame.particle_data_present[gsd_flag::particles_body])
+    if (fields[gsd_flag::particles_body]
+        && local_frame.particle_data_present[gsd_flag::particles_body])
         {
         m_gather_tag_order.gatherArray(m_global_frame.particle_data.body,
                                        local_frame.particle_data.body);
         }
-    if (local_frame.particle_data_present[gsd_flag::particles_inertia])
+    if (fields[gsd_flag::particles_inertia]
+        && local_frame.particle_data_present[gsd_flag::particles_inertia])
         {
         m_gather_tag_order.gatherArray(m_global_frame.particle_data.inertia,
                                        local_frame.particle_data.inertia);
         }
-    if (local_frame.particle_data_present[gsd_flag::particles_velocity])
+    if (fields[gsd_flag::particles_velocity]
+        && local_frame.particle_data_present[gsd_flag::particles_velocity])
         {
         m_gather_tag_order.gatherArray(m_global_frame.particle_data.vel,
                                        local_frame.particle_data.vel);
         }
-    if (local_frame.particle_data_present[gsd_flag::particles_angmom])
+    if (fields[gsd_flag::particles_angmom]
+        && local_frame.particle_data_present[gsd_flag::particles_angmom])
         {
         m_gather_tag_order.gatherArray(m_global_frame.particle_data.angmom,
                                        local_frame.particle_data.angmom);
         }
-    if (local_frame.particle_data_present[gsd_flag::particles_image])
+    if (fields[gsd_flag::particles_image]
+        && local_frame.particle_data_present[gsd_flag::particles_image])
         {
         m_gather_tag_order.gatherArray(m_global_frame.particle_data.image,
                                        local_frame.particle_data.image);
         }
     }
 
+/*! Gather and write the frame one group of particle quantities at a time: attributes,
+    then properties, then momenta. Each group is released before the next is gathered,
+    so the root rank's peak memory is one group of global arrays instead of the whole
+    frame. The GSD index stays consistent because all chunks are still written by the
+    root rank within a single gsd frame.
+
+    Only used when asynchronous writes are off: the staged path interleaves collective
+    gathers with file writes, so there is no frame-sized buffer to hand to the I/O
+    thread.
+*/
+void GSDDumpWriter::writeStagedFrame(GSDFrame& frame, pybind11::dict log_data)
+    {
+    // an earlier async frame may still be in flight after a mode switch
+    waitForPendingWrite();
+
+    bool root = m_exec_conf->isRoot();
+
+    if (root)
+        {
+        writeLogQuantities(log_data);
+        }
+
+    // topology is only meaningful if this is the all group
+    if (m_group->getNumMembersGlobal() == m_pdata->getNGlobal()
+        && (m_write_topology || m_nframes == 0))
+        {
+        if (root)
+            {
+            writeTopology(frame.bond_data,
+                          frame.angle_data,
+                          frame.dihedral_data,
+                          frame.improper_data,
+                          frame.constraint_data,
+                          frame.pair_data);
+            }
+        }
+
+    m_gather_tag_order.setLocalTagsSorted(frame.particle_tags);
+
+    std::bitset<n_gsd_flags> fields;
+    fields[gsd_flag::particles_type] = true;
+    fields[gsd_flag::particles_mass] = true;
+    fields[gsd_flag::particles_charge] = true;
+    fields[gsd_flag::particles_diameter] = true;
+    fields[gsd_flag::particles_body] = true;
+    fields[gsd_flag::particles_inertia] = true;
+    gatherParticleFields(frame, fields);
+    if (root)
+        {
+        writeFrameHeader(m_global_frame);
+        writeAttributes(m_global_frame);
+        }
+
+    fields.reset();
+    fields[gsd_flag::particles_position] = true;
+    fields[gsd_flag::particles_orientation] = true;
+    gatherParticleFields(frame, fields);
+    if (root)
+        {
+        writeProperties(m_global_frame);
+        }
+
+    fields.reset();
+    fields[gsd_flag::particles_velocity] = true;
+    fields[gsd_flag::particles_angmom] = true;
+    fields[gsd_flag::particles_image] = true;
+    gatherParticleFields(frame, fields);
+    if (root)
+        {
+        writeMomenta(m_global_frame);
+
+        m_exec_conf->msg->notice(10) << "GSD: ending frame" << endl;
+        int retval = gsd_end_frame(&m_handle);
+        GSDUtils::checkError(retval, m_fname);
+        }
+
+    // release the last gathered group
+    m_global_frame.clear();
+
+    m_nframes++;
+    }
+
 #endif
 
 namespace detail
@@ -1553,9 +2120,20 @@ void export_GSDDumpWriter(pybind11::module& m)
                       &GSDDumpWriter::getWriteDiameter,
                       &GSDDumpWriter::setWriteDiameter)
         .def("flush", &GSDDumpWriter::flush)
+        .def_property("async_write", &GSDDumpWriter::getAsync, &GSDDumpWriter::setAsync)
+        .def_property("fork_write", &GSDDumpWriter::getForkWrite, &GSDDumpWriter::setForkWrite)
         .def_property("maximum_write_buffer_size",
                       &GSDDumpWriter::getMaximumWriteBufferSize,
-                      &GSDDumpWriter::setMaximumWriteBufferSize);
+                      &GSDDumpWriter::setMaximumWriteBufferSize)
+        .def_property("compress_positions",
+                      &GSDDumpWriter::getCompressPositions,
+                      &GSDDumpWriter::setCompressPositions)
+        .def_property("compression_precision",
+                      &GSDDumpWriter::getCompressionPrecision,
+                      &GSDDumpWriter::setCompressionPrecision)
+        .def_property("normalized_positions",
+                      &GSDDumpWriter::getNormalizedPositions,
+                      &GSDDumpWriter::setNormalizedPositions);
     }
 
     } // end namespace detail
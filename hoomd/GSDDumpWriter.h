@@ -8,8 +8,14 @@
 #include "SharedSignal.h"
 
 #include "hoomd/extern/gsd.h"
+#include <condition_variable>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 
 /*! \file GSDDumpWriter.h
     \brief Declares the GSDDumpWriter class
@@ -122,12 +128,76 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     /// Flush the write buffer
     void flush();
 
+    /// Enable or disable asynchronous frame writes
+    void setAsync(bool async);
+
+    /// Get the async write flag
+    bool getAsync() const
+        {
+        return m_async;
+        }
+
+    /// Block until any in-flight asynchronous frame write has completed
+    void waitForPendingWrite();
+
+    /// Enable or disable fork-based checkpoint writes
+    void setForkWrite(bool fork_write);
+
+    /// Get the fork write flag
+    bool getForkWrite() const
+        {
+        return m_fork_write;
+        }
+
     /// Set the maximum write buffer size (in bytes)
     void setMaximumWriteBufferSize(uint64_t size);
 
     /// Get the maximum write buffer size (in bytes)
     uint64_t getMaximumWriteBufferSize();
 
+    /// Enable or disable quantized-delta position compression
+    void setCompressPositions(bool compress)
+        {
+        m_compress_positions = compress;
+        // force a keyframe so readers never chain deltas across a gap
+        m_position_reference.clear();
+        }
+
+    /// Get the position compression flag
+    bool getCompressPositions() const
+        {
+        return m_compress_positions;
+        }
+
+    /// Set the position quantization step (in distance units)
+    void setCompressionPrecision(double precision)
+        {
+        if (precision <= 0.0)
+            {
+            throw std::invalid_argument("compression_precision must be positive");
+            }
+        m_compression_precision = precision;
+        m_position_reference.clear();
+        }
+
+    /// Get the position quantization step (in distance units)
+    double getCompressionPrecision() const
+        {
+        return m_compression_precision;
+        }
+
+    /// Enable or disable box-normalized 16-bit position output
+    void setNormalizedPositions(bool normalized)
+        {
+        m_normalized_positions = normalized;
+        }
+
+    /// Get the normalized position flag
+    bool getNormalizedPositions() const
+        {
+        return m_normalized_positions;
+        }
+
     protected:
     gsd_handle m_handle; //!< Handle to the file
 
@@ -224,6 +294,12 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     GatherTagOrder m_gather_tag_order;
 
     void gatherGlobalFrame(const GSDFrame& local_frame);
+
+    /// Gather only the selected per-particle arrays into the global frame
+    void gatherParticleFields(const GSDFrame& local_frame, const std::bitset<n_gsd_flags>& fields);
+
+    /// Gather and write the frame one quantity group at a time to bound rank 0 memory
+    void writeStagedFrame(GSDFrame& frame, pybind11::dict log_data);
 #endif
 
     private:
@@ -248,12 +324,109 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     std::unordered_map<std::string, bool>
         m_nondefault; //!< Map of quantities (true when non-default in frame 0)
 
+    /// Copies of the attribute chunks written to frame 0 of this file. Later frames skip
+    /// chunks that are bit-identical to these: readers fall back to frame 0 when a chunk
+    /// is absent, so the omission is lossless.
+    struct AttributeCache
+        {
+        bool valid = false; //!< True when this writer wrote frame 0 of the file
+        std::vector<std::string> type_mapping;
+        std::vector<unsigned int> type;
+        std::vector<float> mass;
+        std::vector<float> charge;
+        std::vector<float> diameter;
+        std::vector<unsigned int> body;
+        std::vector<vec3<float>> inertia;
+        };
+    AttributeCache m_attribute_cache;
+
+    /// True when positions are written as quantized deltas to the previous frame
+    bool m_compress_positions = false;
+
+    /// Quantization step for compressed positions (in distance units)
+    double m_compression_precision = 1e-4;
+
+    /// Quantized positions of the last written frame (codec reference)
+    std::vector<int64_t> m_position_reference;
+
+    /// Scratch buffer holding the encoded delta stream
+    std::vector<uint8_t> m_position_delta_buffer;
+
+    /// True when positions are written as box-normalized uint16 fractions
+    bool m_normalized_positions = false;
+
+    /// Scratch buffer holding the normalized positions
+    std::vector<uint16_t> m_position_u16_buffer;
+
     /// Copy of the state properties local to this rank, in ascending tag order.
     GSDFrame m_local_frame;
 
     /// Working array to sort local particles by tag
     std::vector<unsigned int> m_index;
 
+    /// Cached local member tags matching m_index, in ascending tag order
+    std::vector<unsigned int> m_local_tags;
+
+    /// True while m_index and m_local_tags match the current particle storage order
+    bool m_tag_order_cached = false;
+
+    /// Group membership generation the cached tag order was built from
+    uint64_t m_cached_member_generation = 0;
+
+#ifdef ENABLE_MPI
+    /// True while the gather order in m_gather_tag_order matches m_local_tags
+    bool m_gather_order_current = false;
+#endif
+
+    /// Invalidate the cached tag order when particles are resorted or migrated
+    void slotParticleSort()
+        {
+        m_tag_order_cached = false;
+#ifdef ENABLE_MPI
+        m_gather_order_current = false;
+#endif
+        }
+
+    /** Asynchronous write state.
+
+        In async mode analyze() hands the populated frame to a background I/O thread
+        and returns; the simulation thread only blocks when the previous frame is still
+        in flight (double buffering via the m_io_frame swap). Python-facing chunks (log
+        quantities) and topology are still written on the simulation thread before the
+        hand off, so the I/O thread never touches the interpreter.
+    */
+    bool m_async = false;                //!< True when asynchronous writes are enabled
+    std::thread m_io_thread;             //!< Background I/O thread (root rank only)
+    std::mutex m_io_mutex;               //!< Protects the pending/exit flags and m_nframes
+    std::condition_variable m_io_cv;     //!< Signals frame hand off and completion
+    bool m_io_pending = false;           //!< True while a frame write is in flight
+    bool m_io_exit = false;              //!< Request the I/O thread to exit
+    std::exception_ptr m_io_exception;   //!< Deferred exception from the I/O thread
+    GSDFrame m_io_frame;                 //!< Frame owned by the I/O thread while pending
+
+    //! Body of the background I/O thread
+    void ioThreadLoop();
+
+    /** Fork-based checkpoint state.
+
+        In fork mode analyze() forks the process: the child serializes the frozen
+        copy-on-write state to the file and exits, while the parent continues stepping
+        immediately. Only one child is in flight at a time; the next trigger (or any
+        operation that touches the file handle) first waits for it and re-reads the
+        file index to pick up the frame the child appended.
+    */
+    bool m_fork_write = false; //!< True when frames are written by a forked child
+    int m_checkpoint_pid = -1; //!< PID of the in-flight checkpoint child (-1 when none)
+
+    //! Wait for the in-flight checkpoint child and re-read the file index
+    void reapCheckpointChild();
+
+    //! Fork and write the frame in the child process
+    void forkWriteFrame(GSDFrame& frame, pybind11::dict log_data);
+
+    //! Write the per-frame particle chunks and end the frame
+    void writeFrameData(const GSDFrame& frame);
+
     //! Write a type mapping out to the file
     void writeTypeMapping(std::string chunk, std::vector<std::string> type_mapping);
 
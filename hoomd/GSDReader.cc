@@ -9,7 +9,14 @@
 #include <sstream>
 #include <string.h>
 
+#include <algorithm>
 #include <stdexcept>
+
+#ifdef ENABLE_MPI
+#include <cerrno>
+#include <unistd.h>
+#endif
+#include <fcntl.h>
 using namespace std;
 using namespace hoomd::detail;
 
@@ -19,21 +26,27 @@ namespace hoomd
     \param name File name to read
     \param frame Frame index to read from the file
     \param from_end Count frames back from the end of the file
+    \param parallel Stripe per-particle chunk reads across all ranks
 
     The GSDReader constructor opens the GSD file, initializes an empty snapshot, and reads the file
-   into memory (on the root rank).
+   into memory (on the root rank). In parallel mode all ranks open the file and cooperate on
+   reading the large per-particle chunks; the snapshot is still assembled on the root rank and
+   distributed by the usual initialization path.
 */
 GSDReader::GSDReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
                      const std::string& name,
                      const uint64_t frame,
-                     bool from_end)
-    : m_exec_conf(exec_conf), m_timestep(0), m_name(name), m_frame(frame)
+                     bool from_end,
+                     bool parallel)
+    : m_exec_conf(exec_conf), m_timestep(0), m_name(name), m_frame(frame), m_parallel(false)
     {
     m_snapshot = std::shared_ptr<SnapshotSystemData<float>>(new SnapshotSystemData<float>);
 
 #ifdef ENABLE_MPI
+    m_parallel = parallel && m_exec_conf->getNRanks() > 1;
+
     // if we are not the root processor, do not perform file I/O
-    if (!m_exec_conf->isRoot())
+    if (!m_exec_conf->isRoot() && !m_parallel)
         {
         return;
         }
@@ -72,16 +85,19 @@ GSDReader::GSDReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
         throw runtime_error(s.str());
         }
 
-    readHeader();
+    // the header and topology stay on the root; all ranks cooperate on the particle chunks
+    if (m_exec_conf->isRoot())
+        readHeader();
     readParticles();
-    readTopology();
+    if (m_exec_conf->isRoot())
+        readTopology();
     }
 
 GSDReader::~GSDReader()
     {
 #ifdef ENABLE_MPI
     // if we are not the root processor, do not perform file I/O
-    if (!m_exec_conf->isRoot())
+    if (!m_exec_conf->isRoot() && !m_parallel)
         {
         return;
         }
@@ -137,6 +153,136 @@ bool GSDReader::readChunk(void* data,
         }
     }
 
+#ifdef ENABLE_MPI
+namespace
+    {
+//! Read exactly \a count bytes at \a offset, retrying on short reads
+void pread_exact(int fd, void* buf, size_t count, int64_t offset, const std::string& name)
+    {
+    char* out = (char*)buf;
+    while (count > 0)
+        {
+        ssize_t n = pread(fd, out, count, (off_t)offset);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            {
+            std::ostringstream s;
+            s << "Error reading " << name << ".";
+            throw runtime_error(s.str());
+            }
+        out += n;
+        offset += n;
+        count -= (size_t)n;
+        }
+    }
+
+// keep individual messages below the int count limit of MPI
+const size_t mpi_piece_bytes = ((size_t)1) << 30;
+    } // end namespace
+
+/*! Same contract as readChunk, executed cooperatively: every rank locates the chunk in its
+    own copy of the index (the indices are identical, so all ranks take the same branches
+    without any metadata exchange), preads only its stripe of rows, and the stripes are
+    assembled into \a data on the root rank. Non-root ranks pass \a data = NULL.
+*/
+bool GSDReader::readChunkParallel(void* data,
+                                  uint64_t frame,
+                                  const char* name,
+                                  size_t expected_size,
+                                  unsigned int cur_n)
+    {
+    const struct gsd_index_entry* entry = gsd_find_chunk(&m_handle, frame, name);
+    if (entry == NULL && frame != 0)
+        entry = gsd_find_chunk(&m_handle, 0, name);
+
+    if (entry == NULL || (cur_n != 0 && entry->N != cur_n))
+        {
+        m_exec_conf->msg->notice(10) << "data.gsd_snapshot: chunk not found " << name << endl;
+        return false;
+        }
+
+    size_t row_bytes = entry->M * gsd_sizeof_type((enum gsd_type)entry->type);
+    size_t actual_size = entry->N * row_bytes;
+    if (actual_size != expected_size)
+        {
+        std::ostringstream s;
+        s << "Expecting " << expected_size << " bytes in " << name << " but found " << actual_size
+          << ".";
+        throw runtime_error(s.str());
+        }
+
+    m_exec_conf->msg->notice(7) << "data.gsd_snapshot: reading chunk " << name << " ("
+                                << m_exec_conf->getNRanks() << " rank stripes)" << endl;
+
+    const MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
+    const uint64_t nranks = m_exec_conf->getNRanks();
+    const uint64_t rank = m_exec_conf->getRank();
+    const uint64_t N = entry->N;
+
+    const uint64_t start = N * rank / nranks;
+    const uint64_t end = N * (rank + 1) / nranks;
+    const size_t slice_bytes = (size_t)(end - start) * row_bytes;
+
+    if (rank == 0)
+        {
+        // read our own stripe directly into place, then receive the others
+        pread_exact(m_handle.fd, data, slice_bytes, entry->location, m_name);
+
+        for (uint64_t r = 1; r < nranks; r++)
+            {
+            const uint64_t r_start = N * r / nranks;
+            const uint64_t r_end = N * (r + 1) / nranks;
+            char* dest = (char*)data + r_start * row_bytes;
+            size_t remaining = (size_t)(r_end - r_start) * row_bytes;
+            while (remaining > 0)
+                {
+                size_t piece = std::min(remaining, mpi_piece_bytes);
+                MPI_Recv(dest, (int)piece, MPI_BYTE, (int)r, 0, mpi_comm, MPI_STATUS_IGNORE);
+                dest += piece;
+                remaining -= piece;
+                }
+            }
+        }
+    else
+        {
+        std::vector<char> buf(slice_bytes);
+        pread_exact(m_handle.fd,
+                    buf.data(),
+                    slice_bytes,
+                    entry->location + (int64_t)(start * row_bytes),
+                    m_name);
+
+        char* src = buf.data();
+        size_t remaining = slice_bytes;
+        while (remaining > 0)
+            {
+            size_t piece = std::min(remaining, mpi_piece_bytes);
+            MPI_Send(src, (int)piece, MPI_BYTE, 0, 0, mpi_comm);
+            src += piece;
+            remaining -= piece;
+            }
+        }
+
+    return true;
+    }
+#endif
+
+/*! Dispatch a per-particle chunk read to the cooperative striped path in parallel mode,
+    or to the usual root-rank readChunk otherwise.
+*/
+bool GSDReader::readParticleChunk(void* data,
+                                  const char* name,
+                                  size_t expected_size,
+                                  unsigned int cur_n)
+    {
+#ifdef ENABLE_MPI
+    if (m_parallel)
+        return readChunkParallel(data, m_frame, name, expected_size, cur_n);
+#endif
+    return readChunk(data, m_frame, name, expected_size, cur_n);
+    }
+
 /*! \param frame Frame index to read from
     \param name Name of the data chunk
 
@@ -214,33 +360,159 @@ void GSDReader::readHeader()
     }
 
 /*! Read the same data chunks for particles
+
+    In parallel mode every rank enters this method: each rank resolves the chunk layout
+    from its own copy of the file index and serves stripe reads, while only the root rank
+    stores the assembled arrays in the snapshot.
  */
+/*! Issue kernel readahead hints for every per-particle chunk of the frame before the
+    synchronous reads start: the page cache fills for the later chunks while the earlier
+    ones are being copied out. This is only a hint; platforms without posix_fadvise read
+    on demand as before.
+*/
+void GSDReader::prefetchParticleChunks()
+    {
+#if defined(POSIX_FADV_WILLNEED)
+    const char* names[] = {"particles/typeid",
+                           "particles/mass",
+                           "particles/charge",
+                           "particles/diameter",
+                           "particles/body",
+                           "particles/moment_inertia",
+                           "particles/position",
+                           "particles/orientation",
+                           "particles/velocity",
+                           "particles/angmom",
+                           "particles/image"};
+
+    for (const char* name : names)
+        {
+        const struct gsd_index_entry* entry = gsd_find_chunk(&m_handle, m_frame, name);
+        if (entry == NULL && m_frame != 0)
+            entry = gsd_find_chunk(&m_handle, 0, name);
+        if (entry == NULL)
+            continue;
+
+        size_t size = entry->N * entry->M * gsd_sizeof_type((enum gsd_type)entry->type);
+        posix_fadvise(m_handle.fd, (off_t)entry->location, (off_t)size, POSIX_FADV_WILLNEED);
+        }
+#endif
+    }
+
 void GSDReader::readParticles()
     {
+    const bool root = m_exec_conf->isRoot();
     unsigned int N = m_snapshot->particle_data.size;
-    m_snapshot->particle_data.type_mapping = readTypes(m_frame, "particles/types");
+
+    prefetchParticleChunks();
+
+#ifdef ENABLE_MPI
+    // non-root ranks need N to compute their stripes; the snapshot is only sized on root
+    if (m_parallel)
+        bcast(N, 0, m_exec_conf->getMPICommunicator());
+#endif
+
+    if (root)
+        m_snapshot->particle_data.type_mapping = readTypes(m_frame, "particles/types");
+
+    auto& pdata = m_snapshot->particle_data;
 
     // the snapshot already has default values, if a chunk is not found, the value
     // is already at the default, and the failed read is not a problem
-    readChunk(&m_snapshot->particle_data.type[0], m_frame, "particles/typeid", N * 4, N);
-    readChunk(&m_snapshot->particle_data.mass[0], m_frame, "particles/mass", N * 4, N);
-    readChunk(&m_snapshot->particle_data.charge[0], m_frame, "particles/charge", N * 4, N);
-    readChunk(&m_snapshot->particle_data.diameter[0], m_frame, "particles/diameter", N * 4, N);
-    readChunk(&m_snapshot->particle_data.body[0], m_frame, "particles/body", N * 4, N);
-    readChunk(&m_snapshot->particle_data.inertia[0],
-              m_frame,
-              "particles/moment_inertia",
-              N * 12,
-              N);
-    readChunk(&m_snapshot->particle_data.pos[0], m_frame, "particles/position", N * 12, N);
-    readChunk(&m_snapshot->particle_data.orientation[0],
-              m_frame,
-              "particles/orientation",
-              N * 16,
-              N);
-    readChunk(&m_snapshot->particle_data.vel[0], m_frame, "particles/velocity", N * 12, N);
-    readChunk(&m_snapshot->particle_data.angmom[0], m_frame, "particles/angmom", N * 16, N);
-    readChunk(&m_snapshot->particle_data.image[0], m_frame, "particles/image", N * 12, N);
+    readParticleChunk(root ? (void*)&pdata.type[0] : nullptr, "particles/typeid", N * 4, N);
+    readParticleChunk(root ? (void*)&pdata.mass[0] : nullptr, "particles/mass", N * 4, N);
+    readParticleChunk(root ? (void*)&pdata.charge[0] : nullptr, "particles/charge", N * 4, N);
+    readParticleChunk(root ? (void*)&pdata.diameter[0] : nullptr, "particles/diameter", N * 4, N);
+    readParticleChunk(root ? (void*)&pdata.body[0] : nullptr, "particles/body", N * 4, N);
+    readParticleChunk(root ? (void*)&pdata.inertia[0] : nullptr,
+                      "particles/moment_inertia",
+                      N * 12,
+                      N);
+    if (gsd_find_chunk(&m_handle, m_frame, "compression/position") != NULL)
+        {
+        // the sequential delta decode stays on the root rank
+        if (root)
+            readCompressedPositions(N);
+        }
+    else
+        readParticleChunk(root ? (void*)&pdata.pos[0] : nullptr, "particles/position", N * 12, N);
+    readParticleChunk(root ? (void*)&pdata.orientation[0] : nullptr,
+                      "particles/orientation",
+                      N * 16,
+                      N);
+    readParticleChunk(root ? (void*)&pdata.vel[0] : nullptr, "particles/velocity", N * 12, N);
+    readParticleChunk(root ? (void*)&pdata.angmom[0] : nullptr, "particles/angmom", N * 16, N);
+    readParticleChunk(root ? (void*)&pdata.image[0] : nullptr, "particles/image", N * 12, N);
+    }
+
+/*! \param N Number of particles in the current frame
+
+    Decode positions written by GSDDumpWriter with position compression enabled. Frames
+    with compressed positions store a quantized delta to the previous frame in
+    compression/position: walk back to the most recent absolute position keyframe, then
+    apply the delta of every frame in between. See detail::GSDDeltaCodec for the stream
+    format.
+*/
+void GSDReader::readCompressedPositions(unsigned int N)
+    {
+    // find the most recent frame at or before m_frame holding absolute positions
+    uint64_t key_frame = m_frame;
+    const struct gsd_index_entry* entry = NULL;
+    while (true)
+        {
+        entry = gsd_find_chunk(&m_handle, key_frame, "particles/position");
+        if (entry != NULL || key_frame == 0)
+            break;
+        key_frame--;
+        }
+
+    if (entry == NULL || entry->N != N || entry->M != 3 || entry->type != GSD_TYPE_FLOAT)
+        {
+        std::ostringstream s;
+        s << "No position keyframe for compressed frame " << m_frame << " in " << m_name << ".";
+        throw runtime_error(s.str());
+        }
+
+    m_exec_conf->msg->notice(7) << "data.gsd_snapshot: reading chunk particles/position (frame "
+                                << key_frame << " keyframe)" << endl;
+    int retval = gsd_read_chunk(&m_handle, &m_snapshot->particle_data.pos[0], entry);
+    GSDUtils::checkError(retval, m_name);
+
+    double precision = 0.0;
+    if (!readChunk(&precision, m_frame, "compression/position/precision", 8) || precision <= 0.0)
+        {
+        std::ostringstream s;
+        s << "Missing compression/position/precision in " << m_name << ".";
+        throw runtime_error(s.str());
+        }
+
+    // quantizing the keyframe recovers the writer's codec reference exactly
+    std::vector<int64_t> reference;
+    GSDDeltaCodec::quantize((const float*)&m_snapshot->particle_data.pos[0],
+                            (size_t)N * 3,
+                            precision,
+                            reference);
+
+    for (uint64_t frame = key_frame + 1; frame <= m_frame; frame++)
+        {
+        entry = gsd_find_chunk(&m_handle, frame, "compression/position");
+        if (entry == NULL || entry->M != 1 || entry->type != GSD_TYPE_UINT8)
+            {
+            std::ostringstream s;
+            s << "Missing compression/position at frame " << frame << " in " << m_name << ".";
+            throw runtime_error(s.str());
+            }
+
+        m_exec_conf->msg->notice(7) << "data.gsd_snapshot: reading chunk compression/position"
+                                    << " (frame " << frame << ")" << endl;
+        std::vector<uint8_t> data(entry->N);
+        retval = gsd_read_chunk(&m_handle, data.data(), entry);
+        GSDUtils::checkError(retval, m_name);
+
+        GSDDeltaCodec::decode(data.data(), data.size(), reference);
+        }
+
+    GSDDeltaCodec::dequantize(reference, precision, (float*)&m_snapshot->particle_data.pos[0]);
     }
 
 /*! Read the same data chunks for topology
@@ -332,6 +604,11 @@ void export_GSDReader(pybind11::module& m)
                             const string&,
                             const uint64_t,
                             bool>())
+        .def(pybind11::init<std::shared_ptr<const ExecutionConfiguration>,
+                            const string&,
+                            const uint64_t,
+                            bool,
+                            bool>())
         .def("getTimeStep", &GSDReader::getTimeStep)
         .def("getSnapshot", &GSDReader::getSnapshot)
         .def("clearSnapshot", &GSDReader::clearSnapshot)
@@ -30,10 +30,16 @@ class PYBIND11_EXPORT GSDReader
     {
     public:
     //! Loads in the file and parses the data
+    /*! \param parallel When true (and running on more than one rank), every rank opens the
+        file and reads only its stripe of the large per-particle chunks with pread(),
+        assembling the snapshot on the root rank. The file must be accessible from all
+        ranks. When false, only the root rank performs I/O.
+     */
     GSDReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
               const std::string& name,
               const uint64_t frame,
-              bool from_end);
+              bool from_end,
+              bool parallel = false);
 
     //! Destructor
     ~GSDReader();
@@ -92,6 +98,7 @@ class PYBIND11_EXPORT GSDReader
     uint64_t m_frame;                                          //!< Cached frame
     std::shared_ptr<SnapshotSystemData<float>> m_snapshot;     //!< The snapshot to read
     gsd_handle m_handle;                                       //!< Handle to the file
+    bool m_parallel; //!< True when all ranks cooperate on reading particle chunks
 
     //! Helper function to read a type list from the file
     std::vector<std::string> readTypes(uint64_t frame, const char* name);
@@ -100,6 +107,27 @@ class PYBIND11_EXPORT GSDReader
     void readHeader();
     void readParticles();
     void readTopology();
+
+    //! Read a per-particle chunk, striped across ranks when in parallel mode
+    bool readParticleChunk(void* data,
+                           const char* name,
+                           size_t expected_size,
+                           unsigned int cur_n);
+
+#ifdef ENABLE_MPI
+    //! Cooperative chunk read: each rank preads its slice, root assembles the full chunk
+    bool readChunkParallel(void* data,
+                           uint64_t frame,
+                           const char* name,
+                           size_t expected_size,
+                           unsigned int cur_n);
+#endif
+
+    //! Decode quantized-delta compressed positions at the cached frame
+    void readCompressedPositions(unsigned int N);
+
+    //! Hint the kernel to prefetch all per-particle chunks of the cached frame
+    void prefetchParticleChunks();
     };
 
 namespace detail
@@ -131,6 +131,8 @@ template<class T> class managed_deleter
             ptr[i].~T();
             }
 
+        m_exec_conf->getMemoryTracker().unregisterAllocation(m_allocation_ptr);
+
 #ifdef ENABLE_HIP
         if (m_use_device)
             {
@@ -636,10 +638,24 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
         // update the tag
         m_tag = tag;
 
+#ifndef ALWAYS_USE_MANAGED_MEMORY
+        // forward to the fallback array, which owns the allocation in that mode
+        if (!m_is_managed)
+            m_fallback.setTag(tag);
+#endif
+
         // set tag on deleter so it can be displayed upon free
         if (!isNull() && m_data)
+            {
             m_data.get_deleter().setTag(tag);
 
+            // retag the live allocation in the registry
+            if (m_exec_conf)
+                m_exec_conf->getMemoryTracker().updateTag(
+                    m_data.get_deleter().getAllocationRange().first,
+                    tag);
+            }
+
         // for debugging
         this->outputRepresentation();
         }
@@ -775,6 +791,9 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
             this->m_exec_conf->msg->notice(10)
                 << "Allocating " << allocation_bytes << " bytes of managed memory." << std::endl;
 
+            // fail before the driver does when a budget is set
+            this->m_exec_conf->getMemoryTracker().checkBudget(allocation_bytes, m_tag);
+
             hipError_t error = hipMallocManaged(&ptr, allocation_bytes, hipMemAttachGlobal);
             if (error == hipErrorMemoryAllocation)
                 {
@@ -842,6 +861,13 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
         deleter.setTag(m_tag);
         m_data = std::unique_ptr<T, decltype(deleter)>(reinterpret_cast<T*>(ptr), deleter);
 
+        if (this->m_exec_conf)
+            this->m_exec_conf->getMemoryTracker().registerAllocation(
+                allocation_ptr,
+                allocation_bytes,
+                use_device ? MemoryTracker::kind::managed : MemoryTracker::kind::host,
+                m_tag);
+
         // construct objects explicitly using placement new
         for (std::size_t i = 0; i < m_num_elements; ++i)
             ::new ((void**)&((T*)ptr)[i]) T;
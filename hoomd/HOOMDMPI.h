@@ -388,6 +388,106 @@ void gather_v(const T& in_value,
         }
     }
 
+//! Tree-structured gather with per-level aggregation
+/*! Provides the same semantics as gather_v, but routes the serialized objects up a binomial tree
+    rooted at \a root instead of a flat MPI_Gatherv. At each level, ranks with the current bit of
+    their relative rank set forward their aggregate (a framed concatenation of all buffers from
+    their subtree) to the parent and drop out; the others absorb one child aggregate. The root
+    receives O(log N) messages and is the only rank that deserializes, so the per-rank setup cost
+    of the flat gather (count exchange plus N deserializations triggered serially by the root)
+    does not grow linearly with the communicator size.
+*/
+template<typename T>
+void gather_v_tree(const T& in_value,
+                   std::vector<T>& out_values,
+                   unsigned int root,
+                   const MPI_Comm mpi_comm)
+    {
+    int rank;
+    int size;
+    MPI_Comm_rank(mpi_comm, &rank);
+    MPI_Comm_size(mpi_comm, &size);
+
+    if (size == 1)
+        {
+        out_values.resize(1);
+        out_values[0] = in_value;
+        return;
+        }
+
+    // serialize in_value
+    std::stringstream s(std::ios_base::out | std::ios_base::binary);
+    cereal::BinaryOutputArchive ar(s);
+
+    ar << in_value;
+    s.flush();
+
+    // the aggregate is a list of (origin rank, length) frames plus the concatenated payloads
+    std::string payload = s.str();
+    std::vector<unsigned int> header;
+    header.push_back((unsigned int)rank);
+    header.push_back((unsigned int)payload.size());
+
+    int rrank = (rank - (int)root + size) % size;
+    for (int mask = 1; mask < size; mask <<= 1)
+        {
+        if (rrank & mask)
+            {
+            // forward the aggregate to the parent and drop out of the reduction
+            int parent = ((rrank - mask) + (int)root) % size;
+            unsigned int counts[2] = {(unsigned int)header.size(), (unsigned int)payload.size()};
+            MPI_Send(counts, 2, MPI_UNSIGNED, parent, 0, mpi_comm);
+            MPI_Send(header.data(), (int)header.size(), MPI_UNSIGNED, parent, 1, mpi_comm);
+            MPI_Send(payload.data(), (int)payload.size(), MPI_BYTE, parent, 2, mpi_comm);
+            break;
+            }
+        else if (rrank + mask < size)
+            {
+            // absorb the aggregate of the child subtree
+            int child = (rrank + mask + (int)root) % size;
+            unsigned int counts[2];
+            MPI_Recv(counts, 2, MPI_UNSIGNED, child, 0, mpi_comm, MPI_STATUS_IGNORE);
+            std::vector<unsigned int> child_header(counts[0]);
+            MPI_Recv(child_header.data(),
+                     (int)counts[0],
+                     MPI_UNSIGNED,
+                     child,
+                     1,
+                     mpi_comm,
+                     MPI_STATUS_IGNORE);
+            std::string child_payload(counts[1], '\0');
+            MPI_Recv(counts[1] ? &child_payload[0] : NULL,
+                     (int)counts[1],
+                     MPI_BYTE,
+                     child,
+                     2,
+                     mpi_comm,
+                     MPI_STATUS_IGNORE);
+            header.insert(header.end(), child_header.begin(), child_header.end());
+            payload += child_payload;
+            }
+        }
+
+    // on the root processor, de-serialize every frame into its origin slot
+    if (rank == (int)root)
+        {
+        out_values.clear();
+        out_values.resize(size);
+        size_t offset = 0;
+        for (size_t i = 0; i < header.size(); i += 2)
+            {
+            unsigned int origin = header[i];
+            unsigned int len = header[i + 1];
+            std::stringstream s(payload.substr(offset, len),
+                                std::ios_base::in | std::ios_base::binary);
+            cereal::BinaryInputArchive ar(s);
+
+            ar >> out_values[origin];
+            offset += len;
+            }
+        }
+    }
+
 //! Wrapper around MPI_Allgatherv
 template<typename T>
 void all_gather_v(const T& in_value, std::vector<T>& out_values, const MPI_Comm mpi_comm)
@@ -11,6 +11,8 @@
 #include "Communicator.h"
 #endif
 
+#include <chrono>
+
 #include <pybind11/stl_bind.h>
 PYBIND11_MAKE_OPAQUE(std::vector<std::shared_ptr<hoomd::ForceConstraint>>);
 PYBIND11_MAKE_OPAQUE(std::vector<std::shared_ptr<hoomd::ForceCompute>>);
@@ -143,7 +145,7 @@ vec3<double> Integrator::computeLinearMomentum()
         }
 
 #ifdef ENABLE_MPI
-    if (m_pdata->getDomainDecomposition())
+    if (m_pdata->isDomainDecomposed())
         {
         MPI_Allreduce(MPI_IN_PLACE,
                       &p_total,
@@ -157,6 +159,63 @@ vec3<double> Integrator::computeLinearMomentum()
     return p_total;
     }
 
+/** @param timestep Current time step of the simulation
+
+    Loggers query the energy of each force compute separately, which costs one scalar
+    MPI_Allreduce per force compute per logging step. This method batches those reductions:
+    it sums the local energies of every attached force compute whose cached sum is stale into
+    one buffer, reduces the buffer in a single collective call, and seeds the caches with the
+    results so that the subsequent per-force calcEnergySum() calls are local.
+
+    All ranks must call this method at the same timesteps. It is a no-op without domain
+    decomposition, where calcEnergySum() issues no collectives anyway.
+*/
+void Integrator::reduceForceEnergies(uint64_t timestep)
+    {
+#ifdef ENABLE_MPI
+    if (!m_sysdef->isDomainDecomposed())
+        return;
+
+    // bring all forces up to date so the seeded caches remain valid afterwards
+    for (auto& force : m_forces)
+        force->compute(timestep);
+    for (auto& constraint_force : m_constraint_forces)
+        constraint_force->compute(timestep);
+
+    // collect the local sums of the forces whose cache is stale. compute() runs in lockstep on
+    // all ranks, so the set of stale caches (and hence the buffer length) matches across ranks.
+    std::vector<ForceCompute*> pending;
+    for (auto& force : m_forces)
+        {
+        if (!force->isEnergySumValid())
+            pending.push_back(force.get());
+        }
+    for (auto& constraint_force : m_constraint_forces)
+        {
+        if (!constraint_force->isEnergySumValid())
+            pending.push_back(constraint_force.get());
+        }
+
+    if (pending.empty())
+        return;
+
+    std::vector<double> energies;
+    energies.reserve(pending.size());
+    for (auto force : pending)
+        energies.push_back(force->calcEnergySumLocal());
+
+    MPI_Allreduce(MPI_IN_PLACE,
+                  energies.data(),
+                  (int)energies.size(),
+                  MPI_DOUBLE,
+                  MPI_SUM,
+                  m_exec_conf->getMPICommunicator());
+
+    for (size_t i = 0; i < pending.size(); i++)
+        pending[i]->setEnergySumFromReduction(energies[i]);
+#endif
+    }
+
 /** @param timestep Current time step of the simulation
     \post All added force computes in \a m_forces are computed and totaled up in \a m_net_force and
    \a m_net_virial \note The summation step is performed <b>on the CPU</b> and will result in a lot
@@ -165,13 +224,21 @@ vec3<double> Integrator::computeLinearMomentum()
 */
 void Integrator::computeNetForce(uint64_t timestep)
     {
-    for (auto& force : m_forces)
         {
-        force->compute(timestep);
+        // time the local force evaluations for measured-cost load balancing
+        auto start = std::chrono::steady_clock::now();
+        for (auto& force : m_forces)
+            {
+            force->compute(timestep);
+            }
+        m_force_compute_time
+            += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
         }
 
-    Scalar external_virial[6];
-    Scalar external_energy;
+    // accumulate in double precision so that single precision builds do not lose
+    // accuracy in the reduction (see ComputeThermo for the same pattern)
+    double external_virial[6];
+    double external_energy;
         {
         // access the net force and virial arrays
         const GlobalArray<Scalar4>& net_force = m_pdata->getNetForce();
@@ -183,15 +250,10 @@ void Integrator::computeNetForce(uint64_t timestep)
                                           access_location::host,
                                           access_mode::overwrite);
 
-        // start by zeroing the net force and virial arrays
-        memset((void*)h_net_force.data, 0, sizeof(Scalar4) * net_force.getNumElements());
-        memset((void*)h_net_virial.data, 0, sizeof(Scalar) * net_virial.getNumElements());
-        memset((void*)h_net_torque.data, 0, sizeof(Scalar4) * net_torque.getNumElements());
-
         for (unsigned int i = 0; i < 6; ++i)
-            external_virial[i] = Scalar(0.0);
+            external_virial[i] = 0.0;
 
-        external_energy = Scalar(0.0);
+        external_energy = 0.0;
 
         // now, add up the net forces
         // also sum up forces for ghosts, in case they are needed by the communicator
@@ -202,6 +264,27 @@ void Integrator::computeNetForce(uint64_t timestep)
         assert(6 * nparticles <= net_virial.getNumElements());
         assert(nparticles <= net_torque.getNumElements());
 
+        // zero the slots beyond the local particles; the accumulation below writes the rest
+        memset((void*)(h_net_force.data + nparticles),
+               0,
+               sizeof(Scalar4) * (net_force.getNumElements() - nparticles));
+        memset((void*)h_net_virial.data, 0, sizeof(Scalar) * net_virial.getNumElements());
+        memset((void*)(h_net_torque.data + nparticles),
+               0,
+               sizeof(Scalar4) * (net_torque.getNumElements() - nparticles));
+
+        // acquire all force arrays up front and accumulate them in a single pass over
+        // particles, so that the net arrays are written once instead of read and written
+        // once per force
+        std::vector<ArrayHandle<Scalar4>> h_forces;
+        std::vector<ArrayHandle<Scalar>> h_virials;
+        std::vector<ArrayHandle<Scalar4>> h_torques;
+        std::vector<size_t> virial_pitches;
+        h_forces.reserve(m_forces.size());
+        h_virials.reserve(m_forces.size());
+        h_torques.reserve(m_forces.size());
+        virial_pitches.reserve(m_forces.size());
+
         for (const auto& force : m_forces)
             {
             const GlobalArray<Scalar4>& h_force_array = force->getForceArray();
@@ -212,45 +295,64 @@ void Integrator::computeNetForce(uint64_t timestep)
             assert(6 * nparticles <= h_virial_array.getNumElements());
             assert(nparticles <= h_torque_array.getNumElements());
 
-            ArrayHandle<Scalar4> h_force(h_force_array, access_location::host, access_mode::read);
-            ArrayHandle<Scalar> h_virial(h_virial_array, access_location::host, access_mode::read);
-            ArrayHandle<Scalar4> h_torque(h_torque_array, access_location::host, access_mode::read);
+            h_forces.push_back(
+                ArrayHandle<Scalar4>(h_force_array, access_location::host, access_mode::read));
+            h_virials.push_back(
+                ArrayHandle<Scalar>(h_virial_array, access_location::host, access_mode::read));
+            h_torques.push_back(
+                ArrayHandle<Scalar4>(h_torque_array, access_location::host, access_mode::read));
+            virial_pitches.push_back(h_virial_array.getPitch());
 
-            size_t virial_pitch = h_virial_array.getPitch();
-            for (unsigned int j = 0; j < nparticles; j++)
+            for (unsigned int k = 0; k < 6; k++)
                 {
-                h_net_force.data[j].x += h_force.data[j].x;
-                h_net_force.data[j].y += h_force.data[j].y;
-                h_net_force.data[j].z += h_force.data[j].z;
-                h_net_force.data[j].w += h_force.data[j].w;
+                external_virial[k] += (double)force->getExternalVirial(k);
+                }
 
-                h_net_torque.data[j].x += h_torque.data[j].x;
-                h_net_torque.data[j].y += h_torque.data[j].y;
-                h_net_torque.data[j].z += h_torque.data[j].z;
-                h_net_torque.data[j].w += h_torque.data[j].w;
+            external_energy += (double)force->getExternalEnergy();
+            }
+
+        const unsigned int n_forces = (unsigned int)m_forces.size();
+        for (unsigned int j = 0; j < nparticles; j++)
+            {
+            Scalar4 sum_force = make_scalar4(0, 0, 0, 0);
+            Scalar4 sum_torque = make_scalar4(0, 0, 0, 0);
+            Scalar sum_virial[6] = {0, 0, 0, 0, 0, 0};
+
+            for (unsigned int i = 0; i < n_forces; i++)
+                {
+                const Scalar4 f = h_forces[i].data[j];
+                sum_force.x += f.x;
+                sum_force.y += f.y;
+                sum_force.z += f.z;
+                sum_force.w += f.w;
+
+                const Scalar4 t = h_torques[i].data[j];
+                sum_torque.x += t.x;
+                sum_torque.y += t.y;
+                sum_torque.z += t.z;
+                sum_torque.w += t.w;
 
                 for (unsigned int k = 0; k < 6; k++)
                     {
-                    h_net_virial.data[k * net_virial_pitch + j]
-                        += h_virial.data[k * virial_pitch + j];
+                    sum_virial[k] += h_virials[i].data[k * virial_pitches[i] + j];
                     }
                 }
 
+            h_net_force.data[j] = sum_force;
+            h_net_torque.data[j] = sum_torque;
             for (unsigned int k = 0; k < 6; k++)
                 {
-                external_virial[k] += force->getExternalVirial(k);
+                h_net_virial.data[k * net_virial_pitch + j] = sum_virial[k];
                 }
-
-            external_energy += force->getExternalEnergy();
             }
         }
 
     for (unsigned int k = 0; k < 6; k++)
         {
-        m_pdata->setExternalVirial(k, external_virial[k]);
+        m_pdata->setExternalVirial(k, Scalar(external_virial[k]));
         }
 
-    m_pdata->setExternalEnergy(external_energy);
+    m_pdata->setExternalEnergy(Scalar(external_energy));
 
     // return early if there are no constraint forces or no HalfStepHook set
     if (m_constraint_forces.size() == 0)
@@ -287,53 +389,90 @@ void Integrator::computeNetForce(uint64_t timestep)
         unsigned int nparticles = m_pdata->getN();
         assert(nparticles <= net_force.getNumElements());
         assert(6 * nparticles <= net_virial.getNumElements());
+
+        // as above, acquire all constraint force arrays up front and fold them into the
+        // net arrays in a single pass
+        std::vector<ArrayHandle<Scalar4>> h_forces;
+        std::vector<ArrayHandle<Scalar>> h_virials;
+        std::vector<ArrayHandle<Scalar4>> h_torques;
+        std::vector<size_t> virial_pitches;
+        h_forces.reserve(m_constraint_forces.size());
+        h_virials.reserve(m_constraint_forces.size());
+        h_torques.reserve(m_constraint_forces.size());
+        virial_pitches.reserve(m_constraint_forces.size());
+
         for (const auto& constraint_force : m_constraint_forces)
             {
             const GlobalArray<Scalar4>& h_force_array = constraint_force->getForceArray();
             const GlobalArray<Scalar>& h_virial_array = constraint_force->getVirialArray();
             const GlobalArray<Scalar4>& h_torque_array = constraint_force->getTorqueArray();
-            ArrayHandle<Scalar4> h_force(h_force_array, access_location::host, access_mode::read);
-            ArrayHandle<Scalar> h_virial(h_virial_array, access_location::host, access_mode::read);
-            ArrayHandle<Scalar4> h_torque(h_torque_array, access_location::host, access_mode::read);
-            size_t virial_pitch = h_virial_array.getPitch();
 
             assert(nparticles <= h_force_array.getNumElements());
             assert(6 * nparticles <= h_virial_array.getNumElements());
             assert(nparticles <= h_torque_array.getNumElements());
 
-            for (unsigned int j = 0; j < nparticles; j++)
+            h_forces.push_back(
+                ArrayHandle<Scalar4>(h_force_array, access_location::host, access_mode::read));
+            h_virials.push_back(
+                ArrayHandle<Scalar>(h_virial_array, access_location::host, access_mode::read));
+            h_torques.push_back(
+                ArrayHandle<Scalar4>(h_torque_array, access_location::host, access_mode::read));
+            virial_pitches.push_back(h_virial_array.getPitch());
+
+            for (unsigned int k = 0; k < 6; k++)
+                {
+                external_virial[k] += (double)constraint_force->getExternalVirial(k);
+                }
+
+            external_energy += (double)constraint_force->getExternalEnergy();
+            }
+
+        const unsigned int n_forces = (unsigned int)m_constraint_forces.size();
+        for (unsigned int j = 0; j < nparticles; j++)
+            {
+            Scalar4 sum_force = h_net_force.data[j];
+            Scalar4 sum_torque = h_net_torque.data[j];
+            Scalar sum_virial[6];
+            for (unsigned int k = 0; k < 6; k++)
                 {
-                h_net_force.data[j].x += h_force.data[j].x;
-                h_net_force.data[j].y += h_force.data[j].y;
-                h_net_force.data[j].z += h_force.data[j].z;
-                h_net_force.data[j].w += h_force.data[j].w;
+                sum_virial[k] = h_net_virial.data[k * net_virial_pitch + j];
+                }
 
-                h_net_torque.data[j].x += h_torque.data[j].x;
-                h_net_torque.data[j].y += h_torque.data[j].y;
-                h_net_torque.data[j].z += h_torque.data[j].z;
-                h_net_torque.data[j].w += h_torque.data[j].w;
+            for (unsigned int i = 0; i < n_forces; i++)
+                {
+                const Scalar4 f = h_forces[i].data[j];
+                sum_force.x += f.x;
+                sum_force.y += f.y;
+                sum_force.z += f.z;
+                sum_force.w += f.w;
+
+                const Scalar4 t = h_torques[i].data[j];
+                sum_torque.x += t.x;
+                sum_torque.y += t.y;
+                sum_torque.z += t.z;
+                sum_torque.w += t.w;
 
                 for (unsigned int k = 0; k < 6; k++)
                     {
-                    h_net_virial.data[k * net_virial_pitch + j]
-                        += h_virial.data[k * virial_pitch + j];
+                    sum_virial[k] += h_virials[i].data[k * virial_pitches[i] + j];
                     }
                 }
+
+            h_net_force.data[j] = sum_force;
+            h_net_torque.data[j] = sum_torque;
             for (unsigned int k = 0; k < 6; k++)
                 {
-                external_virial[k] += constraint_force->getExternalVirial(k);
+                h_net_virial.data[k * net_virial_pitch + j] = sum_virial[k];
                 }
-
-            external_energy += constraint_force->getExternalEnergy();
             }
         }
 
     for (unsigned int k = 0; k < 6; k++)
         {
-        m_pdata->setExternalVirial(k, external_virial[k]);
+        m_pdata->setExternalVirial(k, Scalar(external_virial[k]));
         }
 
-    m_pdata->setExternalEnergy(external_energy);
+    m_pdata->setExternalEnergy(Scalar(external_energy));
     }
 
 #ifdef ENABLE_HIP
@@ -350,13 +489,21 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
 
     // compute all the normal forces first
 
-    for (auto& force : m_forces)
         {
-        force->compute(timestep);
+        // time the local force evaluations for measured-cost load balancing
+        auto start = std::chrono::steady_clock::now();
+        for (auto& force : m_forces)
+            {
+            force->compute(timestep);
+            }
+        m_force_compute_time
+            += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
         }
 
-    Scalar external_virial[6];
-    Scalar external_energy;
+    // accumulate in double precision so that single precision builds do not lose
+    // accuracy in the reduction (see ComputeThermo for the same pattern)
+    double external_virial[6];
+    double external_energy;
 
         {
         // access the net force and virial arrays
@@ -383,9 +530,9 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
 
         // zero external virial
         for (unsigned int i = 0; i < 6; ++i)
-            external_virial[i] = Scalar(0.0);
+            external_virial[i] = 0.0;
 
-        external_energy = Scalar(0.0);
+        external_energy = 0.0;
 
         // there is no need to zero out the initial net force and virial here, the first call to the
         // addition kernel will do that ahh!, but we do need to zer out the net force and virial if
@@ -400,10 +547,58 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
                 CHECK_CUDA_ERROR();
             }
 
+        // Fast path: with exactly one force compute there is nothing to sum. Copy the
+        // force, torque, and (when needed) virial into the net arrays with
+        // device-to-device copies, which run on the copy engines instead of launching
+        // the generic reduction kernel and paying its read-modify-write pass. This is
+        // the common single pair potential production case.
+        if (m_forces.size() == 1)
+            {
+            PDataFlags flags = this->m_pdata->getFlags();
+
+            const GlobalArray<Scalar4>& d_force_array0 = m_forces[0]->getForceArray();
+            ArrayHandle<Scalar4> d_force0(d_force_array0,
+                                          access_location::device,
+                                          access_mode::read);
+            const GlobalArray<Scalar4>& d_torque_array0 = m_forces[0]->getTorqueArray();
+            ArrayHandle<Scalar4> d_torque0(d_torque_array0,
+                                           access_location::device,
+                                           access_mode::read);
+
+            hipMemcpy(d_net_force.data,
+                      d_force0.data,
+                      sizeof(Scalar4) * nparticles,
+                      hipMemcpyDeviceToDevice);
+            hipMemcpy(d_net_torque.data,
+                      d_torque0.data,
+                      sizeof(Scalar4) * nparticles,
+                      hipMemcpyDeviceToDevice);
+
+            if (flags[pdata_flag::pressure_tensor])
+                {
+                const GlobalArray<Scalar>& d_virial_array0 = m_forces[0]->getVirialArray();
+                ArrayHandle<Scalar> d_virial0(d_virial_array0,
+                                              access_location::device,
+                                              access_mode::read);
+                size_t virial_pitch = d_virial_array0.getPitch();
+                for (unsigned int k = 0; k < 6; k++)
+                    {
+                    hipMemcpy(d_net_virial.data + k * net_virial_pitch,
+                              d_virial0.data + k * virial_pitch,
+                              sizeof(Scalar) * nparticles,
+                              hipMemcpyDeviceToDevice);
+                    }
+                }
+
+            if (m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+            }
+
         // now, add up the accelerations
         // sum all the forces into the net force
         // perform the sum in groups of 6 to avoid kernel launch and memory access overheads
-        for (unsigned int cur_force = 0; cur_force < m_forces.size(); cur_force += 6)
+        for (unsigned int cur_force = 0; m_forces.size() > 1 && cur_force < m_forces.size();
+             cur_force += 6)
             {
             // grab the device pointers for the current set
             kernel::gpu_force_list force_list;
@@ -565,14 +760,14 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
     for (const auto& force : m_forces)
         {
         for (unsigned int k = 0; k < 6; k++)
-            external_virial[k] += force->getExternalVirial(k);
-        external_energy += force->getExternalEnergy();
+            external_virial[k] += (double)force->getExternalVirial(k);
+        external_energy += (double)force->getExternalEnergy();
         }
 
     for (unsigned int k = 0; k < 6; k++)
-        m_pdata->setExternalVirial(k, external_virial[k]);
+        m_pdata->setExternalVirial(k, Scalar(external_virial[k]));
 
-    m_pdata->setExternalEnergy(external_energy);
+    m_pdata->setExternalEnergy(Scalar(external_energy));
 
     // return early if there are no constraint forces or no HalfStepHook set
     if (m_constraint_forces.size() == 0)
@@ -780,15 +975,15 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
         {
         for (unsigned int k = 0; k < 6; k++)
             {
-            external_virial[k] += constraint_force->getExternalVirial(k);
+            external_virial[k] += (double)constraint_force->getExternalVirial(k);
             }
-        external_energy += constraint_force->getExternalEnergy();
+        external_energy += (double)constraint_force->getExternalEnergy();
         }
 
     for (unsigned int k = 0; k < 6; k++)
-        m_pdata->setExternalVirial(k, external_virial[k]);
+        m_pdata->setExternalVirial(k, Scalar(external_virial[k]));
 
-    m_pdata->setExternalEnergy(external_energy);
+    m_pdata->setExternalEnergy(Scalar(external_energy));
     }
 #endif
 
@@ -899,7 +1094,8 @@ void export_Integrator(pybind11::module& m)
         .def_property("dt", &Integrator::getDeltaT, &Integrator::setDeltaT)
         .def_property_readonly("forces", &Integrator::getForces)
         .def_property_readonly("constraints", &Integrator::getConstraintForces)
-        .def("computeLinearMomentum", &Integrator::computeLinearMomentum);
+        .def("computeLinearMomentum", &Integrator::computeLinearMomentum)
+        .def("reduceForceEnergies", &Integrator::reduceForceEnergies);
     }
 
     } // end namespace detail
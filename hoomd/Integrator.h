@@ -133,6 +133,25 @@ class PYBIND11_EXPORT Integrator : public Updater
     /// Compute the linear momentum of the system
     virtual vec3<double> computeLinearMomentum();
 
+    /// Reduce the energy sums of all attached force computes in one collective call
+    void reduceForceEnergies(uint64_t timestep);
+
+    /// Get the wall time this rank has spent in the force compute loop since the last reset
+    /*! The accumulated time covers only the local force evaluations, not the communication
+        that follows them, so differences between ranks measure compute load imbalance. It is
+        consumed by LoadBalancer when balancing on measured time.
+    */
+    double getForceComputeTime() const
+        {
+        return m_force_compute_time;
+        }
+
+    /// Reset the accumulated force compute time
+    void resetForceComputeTime()
+        {
+        m_force_compute_time = 0.0;
+        }
+
     /// Prepare for the run
     virtual void prepRun(uint64_t timestep);
 
@@ -189,6 +208,9 @@ class PYBIND11_EXPORT Integrator : public Updater
     /// The HalfStepHook, if active
     std::shared_ptr<HalfStepHook> m_half_step_hook;
 
+    /// Accumulated wall time of the force compute loop on this rank (seconds)
+    double m_force_compute_time = 0.0;
+
     /// helper function to compute initial accelerations
     void computeAccelerations(uint64_t timestep);
 
@@ -7,6 +7,7 @@
 
 #include "LoadBalancer.h"
 #include "Communicator.h"
+#include "Integrator.h"
 
 #include "hoomd/extern/BVLSSolver.h"
 #include <Eigen/Dense>
@@ -84,6 +85,10 @@ void LoadBalancer::update(uint64_t timestep)
     // no adjustment has been made yet, so set m_N_own to the number of particles on the rank
     resetNOwn(m_pdata->getN());
 
+    // when balancing on measured time, convert the per-rank force loop time into a
+    // per-particle cost weight so that the count-based machinery below equalizes time
+    updateCostWeight();
+
     // figure out which rank is the reduction root for broadcasting
     const Index3D& di = m_decomposition->getDomainIndexer();
     unsigned int reduce_root(0);
@@ -181,6 +186,37 @@ void LoadBalancer::update(uint64_t timestep)
 
 #ifdef ENABLE_MPI
 
+/*!
+ * Converts the wall time each rank spent in its force compute loop (accumulated by the
+ * Integrator since the previous balancing step) into a per-particle cost weight. The weight is
+ * normalized so that the weighted counts sum to the global number of particles, which preserves
+ * the integer resolution of the count-based reduction. When time balancing is disabled, no
+ * integrator is set, or no time has been measured yet, the weight falls back to 1.0 and the
+ * balancer operates on raw particle counts.
+ */
+void LoadBalancer::updateCostWeight()
+    {
+    m_cost_weight = 1.0;
+    if (!m_balance_time || !m_integrator)
+        return;
+
+    double t = m_integrator->getForceComputeTime();
+    m_integrator->resetForceComputeTime();
+
+    double total_time = 0.0;
+    MPI_Allreduce(&t, &total_time, 1, MPI_DOUBLE, MPI_SUM, m_mpi_comm);
+    if (total_time <= 0.0)
+        return;
+
+    // empty ranks keep a weight of 1 so that they still attract particles
+    const double N = (double)m_pdata->getN();
+    if (N > 0.0)
+        {
+        m_cost_weight = (t / N) * ((double)m_pdata->getNGlobal() / total_time);
+        m_recompute_max_imbalance = true;
+        }
+    }
+
 /*!
  * Computes the imbalance factor I = N / <N> for each rank, and computes the maximum among all
  * ranks.
@@ -628,7 +664,11 @@ void export_LoadBalancer(pybind11::module& m)
                       &LoadBalancer::setMaxIterations)
         .def_property("x", &LoadBalancer::getEnableX, &LoadBalancer::setEnableX)
         .def_property("y", &LoadBalancer::getEnableY, &LoadBalancer::setEnableY)
-        .def_property("z", &LoadBalancer::getEnableZ, &LoadBalancer::setEnableZ);
+        .def_property("z", &LoadBalancer::getEnableZ, &LoadBalancer::setEnableZ)
+        .def_property("balance_time",
+                      &LoadBalancer::getBalanceTime,
+                      &LoadBalancer::setBalanceTime)
+        .def("setIntegrator", &LoadBalancer::setIntegrator);
     }
 
     } // end namespace detail
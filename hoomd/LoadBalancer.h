@@ -13,6 +13,7 @@
 #include "Trigger.h"
 #include "Tuner.h"
 
+#include <cmath>
 #include <map>
 #include <memory>
 #include <pybind11/pybind11.h>
@@ -21,6 +22,8 @@
 
 namespace hoomd
     {
+class Integrator;
+
 //! Updates domain decompositions to balance the load
 /*!
  * Adjusts the boundaries of the processor domains to distribute the load close to evenly between
@@ -136,6 +139,28 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
         return m_enable_z;
         }
 
+    /// Set whether to balance on measured per-rank time instead of particle count
+    void setBalanceTime(bool enable)
+        {
+        m_balance_time = enable;
+        }
+
+    /// Get whether balancing uses measured per-rank time
+    bool getBalanceTime()
+        {
+        return m_balance_time;
+        }
+
+    //! Set the integrator supplying the per-rank time measurement
+    /*!
+     * \param integrator Integrator whose force compute time is consumed when balancing on
+     * measured time. Pass a null pointer to fall back to particle counts.
+     */
+    void setIntegrator(std::shared_ptr<Integrator> integrator)
+        {
+        m_integrator = integrator;
+        }
+
     //! Take one timestep forward
     virtual void update(uint64_t timestep);
 
@@ -178,11 +203,18 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
     //! Count the number of particles that have gone off the rank
     virtual void countParticlesOffRank(std::map<unsigned int, unsigned int>& cnts);
 
+    //! Compute the per-particle cost weight from the measured per-rank time
+    void updateCostWeight();
+
     //! Gets the number of owned particles, updating if necessary
+    /*!
+     * When balancing on measured time, the count is scaled by the per-particle cost weight
+     * so that the count-based balancing machinery equalizes time instead.
+     */
     unsigned int getNOwn()
         {
         computeOwnedParticles();
-        return m_N_own;
+        return (unsigned int)llround(m_cost_weight * (double)m_N_own);
         }
 
     //! Force a reset of the number of owned particles without counting
@@ -209,6 +241,10 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
     bool m_enable_y;        //!< Flag to enable balancing in y
     bool m_enable_z;        //!< Flag to enable balancing z
 
+    bool m_balance_time = false; //!< Flag to balance on measured time instead of count
+    std::shared_ptr<Integrator> m_integrator; //!< Source of the per-rank time measurement
+    double m_cost_weight = 1.0; //!< Per-particle cost weight from the last measurement
+
     const Scalar m_max_scale; //!< Maximum fraction to rescale either direction (5%)
 
     private:
@@ -5,8 +5,15 @@
 
 #ifdef ENABLE_MPI
 #include "HOOMDMPI.h"
+
+// Open MPI exposes its CUDA awareness through mpi-ext.h
+#if defined(OPEN_MPI) && OPEN_MPI
+#include <mpi-ext.h>
+#endif
 #endif
 
+#include <cassert>
+#include <chrono>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
@@ -36,6 +43,71 @@ MPIConfiguration::MPIConfiguration(
     int rank;
     MPI_Comm_rank(m_mpi_comm, &rank);
     m_rank = rank;
+
+    // detect whether the MPI library can operate directly on device memory
+#if defined(MPIX_CUDA_AWARE_SUPPORT) && MPIX_CUDA_AWARE_SUPPORT
+    m_cuda_aware_mpi = (MPIX_Query_cuda_support() == 1);
+#endif
+#endif
+    }
+
+MPIConfiguration::~MPIConfiguration()
+    {
+    setAsyncProgressEnabled(false);
+#ifdef ENABLE_MPI
+    if (m_progress_comm != MPI_COMM_NULL)
+        {
+        MPI_Comm_free(&m_progress_comm);
+        }
+#endif
+    }
+
+void MPIConfiguration::setAsyncProgressEnabled(bool enable)
+    {
+#ifdef ENABLE_MPI
+    if (enable == m_progress_thread_run.load())
+        return;
+
+    if (enable)
+        {
+        int provided;
+        MPI_Query_thread(&provided);
+        if (provided < MPI_THREAD_MULTIPLE)
+            {
+            throw std::runtime_error(
+                "The MPI library was not initialized with MPI_THREAD_MULTIPLE support, "
+                "which the asynchronous progress thread requires.");
+            }
+
+        if (m_progress_comm == MPI_COMM_NULL)
+            {
+            // probe on a private duplicate so that the polling cannot interfere with
+            // message matching on the application communicators
+            MPI_Comm_dup(m_hoomd_world, &m_progress_comm);
+            }
+
+        m_progress_thread_run = true;
+        m_progress_thread = std::thread(
+            [this]()
+            {
+                while (m_progress_thread_run.load())
+                    {
+                    // any MPI call drives the progress engine for all pending operations
+                    int flag;
+                    MPI_Status status;
+                    MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, m_progress_comm, &flag, &status);
+                    std::this_thread::sleep_for(std::chrono::microseconds(1));
+                    }
+            });
+        }
+    else
+        {
+        m_progress_thread_run = false;
+        if (m_progress_thread.joinable())
+            {
+            m_progress_thread.join();
+            }
+        }
 #endif
     }
 
@@ -68,9 +140,52 @@ void MPIConfiguration::splitPartitions(unsigned int nrank)
 
     MPI_Comm_rank(m_mpi_comm, &rank);
     m_rank = rank;
+
+    // the node-local communicator derives from the partition communicator, recreate it lazily
+    if (m_node_comm != MPI_COMM_NULL)
+        {
+        MPI_Comm_free(&m_node_comm);
+        m_node_comm = MPI_COMM_NULL;
+        m_node_rank_map.clear();
+        }
 #endif
     }
 
+#ifdef ENABLE_MPI
+MPI_Comm MPIConfiguration::getNodeCommunicator()
+    {
+    if (m_node_comm == MPI_COMM_NULL)
+        {
+        MPI_Comm_split_type(m_mpi_comm, MPI_COMM_TYPE_SHARED, m_rank, MPI_INFO_NULL, &m_node_comm);
+
+        // gather the partition rank of every node member to build the lookup table
+        int node_size;
+        MPI_Comm_size(m_node_comm, &node_size);
+        std::vector<int> node_members(node_size);
+        int my_rank = (int)m_rank;
+        MPI_Allgather(&my_rank, 1, MPI_INT, node_members.data(), 1, MPI_INT, m_node_comm);
+
+        m_node_rank_map.assign(getNRanks(), -1);
+        for (int i = 0; i < node_size; ++i)
+            m_node_rank_map[node_members[i]] = i;
+        }
+
+    return m_node_comm;
+    }
+
+bool MPIConfiguration::isNodeLocal(unsigned int rank)
+    {
+    return getNodeRank(rank) != -1;
+    }
+
+int MPIConfiguration::getNodeRank(unsigned int rank)
+    {
+    getNodeCommunicator();
+    assert(rank < m_node_rank_map.size());
+    return m_node_rank_map[rank];
+    }
+#endif
+
 unsigned int MPIConfiguration::getNRanks() const
     {
 #ifdef ENABLE_MPI
@@ -99,6 +214,12 @@ void export_MPIConfiguration(pybind11::module& m)
         .def("getNRanksGlobal", &MPIConfiguration::getNRanksGlobal)
         .def("getRankGlobal", &MPIConfiguration::getRankGlobal)
         .def("getWalltime", &MPIConfiguration::getWalltime)
+        .def_property("cuda_aware_mpi",
+                      &MPIConfiguration::isCUDAAwareMPIEnabled,
+                      &MPIConfiguration::setCUDAAwareMPIEnabled)
+        .def_property("async_progress",
+                      &MPIConfiguration::isAsyncProgressEnabled,
+                      &MPIConfiguration::setAsyncProgressEnabled)
 #ifdef ENABLE_MPI
         .def_static("_make_mpi_conf_mpi_comm",
                     [](pybind11::object mpi_comm) -> std::shared_ptr<MPIConfiguration>
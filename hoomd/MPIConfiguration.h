@@ -12,6 +12,10 @@
 
 #include "ClockSource.h"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 /*! \file MPIConfiguration.h
     \brief Declares MPIConfiguration, which initializes the MPI environment
 */
@@ -45,7 +49,7 @@ class PYBIND11_EXPORT MPIConfiguration
     );
 
     //! Destructor
-    virtual ~MPIConfiguration() {};
+    virtual ~MPIConfiguration();
 
 #ifdef ENABLE_MPI
     MPI_Comm operator()() const
@@ -63,6 +67,20 @@ class PYBIND11_EXPORT MPIConfiguration
         {
         return m_hoomd_world;
         }
+
+    //! Returns a communicator over the ranks of this partition that share a node
+    /*! Created lazily with MPI_Comm_split_type(MPI_COMM_TYPE_SHARED), so members can
+        exchange data through shared memory.
+     */
+    MPI_Comm getNodeCommunicator();
+
+    //! Returns true when \a rank (in this partition) shares a node with this rank
+    bool isNodeLocal(unsigned int rank);
+
+    //! Map a partition rank to its rank on the node communicator
+    /*! \returns the node-local rank of \a rank, or -1 when it is on another node
+     */
+    int getNodeRank(unsigned int rank);
 #endif
 
     //!< Partition the communicator
@@ -130,6 +148,43 @@ class PYBIND11_EXPORT MPIConfiguration
 #endif
         }
 
+    //! Returns true when MPI calls may be passed device memory pointers
+    /*! Detected from the MPI library at construction when possible, and may be overridden
+        from Python. When enabled, communication code passes device pointers directly to MPI
+        instead of staging through host buffers.
+    */
+    bool isCUDAAwareMPIEnabled() const
+        {
+        return m_cuda_aware_mpi;
+        }
+
+    //! Set whether MPI calls may be passed device memory pointers
+    void setCUDAAwareMPIEnabled(bool enable)
+        {
+        m_cuda_aware_mpi = enable;
+        }
+
+    //! Returns true when the asynchronous progress thread is running
+    bool isAsyncProgressEnabled() const
+        {
+#ifdef ENABLE_MPI
+        return m_progress_thread_run.load();
+#else
+        return false;
+#endif
+        }
+
+    //! Enable or disable the asynchronous MPI progress thread
+    /*! Nonblocking MPI operations otherwise only progress inside MPI_Wait/MPI_Test, so
+        packing and transport do not overlap. When enabled, a dedicated thread polls the MPI
+        library so that halo messages move while compute kernels run. The thread effectively
+        occupies one core per rank; reserve one when binding ranks.
+
+        Requires an MPI library initialized with MPI_THREAD_MULTIPLE support, and must be
+        called collectively on all ranks.
+    */
+    void setAsyncProgressEnabled(bool enable);
+
     double getWalltime()
         {
         double walltime = static_cast<double>(m_clock.getTime()) / 1e9;
@@ -143,10 +198,20 @@ class PYBIND11_EXPORT MPIConfiguration
 #ifdef ENABLE_MPI
     MPI_Comm m_mpi_comm;    //!< The MPI communicator
     MPI_Comm m_hoomd_world; //!< The HOOMD world communicator
+
+    MPI_Comm m_node_comm = MPI_COMM_NULL; //!< Node-local communicator (lazily created)
+    std::vector<int> m_node_rank_map;     //!< Partition rank -> node rank (-1 when off-node)
+
+    MPI_Comm m_progress_comm = MPI_COMM_NULL; //!< Private duplicate the progress thread probes
+    std::thread m_progress_thread;            //!< Thread driving asynchronous MPI progress
 #endif
+    std::atomic<bool> m_progress_thread_run {false}; //!< Keeps the progress thread polling
     unsigned int m_rank;   //!< Rank of this processor (0 if running in single-processor mode)
     unsigned int m_n_rank; //!< Ranks per partition
 
+    /// True when the MPI library can operate directly on device memory
+    bool m_cuda_aware_mpi = false;
+
     /// Clock to provide rank synchronized walltime.
     ClockSource m_clock;
     };
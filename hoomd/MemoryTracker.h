@@ -0,0 +1,287 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file MemoryTracker.h
+    \brief Declares a registry of array allocations with an optional device memory budget
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace hoomd
+    {
+//! Registry of GPUArray/GlobalArray allocations with an optional device memory budget
+/*! Every array allocation is registered here with its size, kind of memory, and the
+    profiling tag assigned with TAG_ALLOCATION(). The registry aggregates current usage by
+    tag for capacity planning, and an optional budget turns a mid-run device out-of-memory
+    abort into an exception that names the requesting array and the largest consumers,
+    thrown before the allocation is attempted.
+
+    The budget covers device global and managed memory; host mirrors are tracked for
+    reporting only. All methods are thread-safe.
+*/
+class MemoryTracker
+    {
+    public:
+    //! Kinds of tracked allocations
+    struct kind
+        {
+        enum Enum
+            {
+            host,    //!< Host memory (pageable or pinned)
+            device,  //!< Device global memory
+            managed, //!< Managed (unified) memory
+            };
+        };
+
+    /// Number of entries in the kind enum
+    static const unsigned int n_kinds = 3;
+
+    //! Register an allocation
+    /*! \param ptr Start of the allocation
+        \param nbytes Size of the allocation in bytes
+        \param k Kind of memory
+        \param tag Profiling tag of the owning array (may be empty)
+    */
+    void registerAllocation(const void* ptr,
+                            size_t nbytes,
+                            kind::Enum k,
+                            const std::string& tag)
+        {
+        if (ptr == nullptr || nbytes == 0)
+            return;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries[ptr] = Entry {nbytes, k, tag};
+        m_bytes[k] += nbytes;
+
+        if (m_tracing)
+            m_trace.push_back(TraceEvent {tag, k, nbytes});
+        }
+
+    //! Unregister an allocation
+    /*! \param ptr Start of the allocation
+
+        Unknown pointers are ignored so deleters of untracked arrays (e.g. mapped device
+        aliases) may call this unconditionally.
+    */
+    void unregisterAllocation(const void* ptr)
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(ptr);
+        if (it == m_entries.end())
+            return;
+        m_bytes[it->second.k] -= it->second.nbytes;
+        m_entries.erase(it);
+        }
+
+    //! Update the tag of an existing allocation
+    /*! \param ptr Start of the allocation
+        \param tag New profiling tag
+    */
+    void updateTag(const void* ptr, const std::string& tag)
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(ptr);
+        if (it != m_entries.end())
+            it->second.tag = tag;
+        }
+
+    //! Get the number of bytes currently allocated for one kind of memory
+    size_t getAllocatedBytes(kind::Enum k) const
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_bytes[k];
+        }
+
+    //! Get the number of device-resident bytes (device global plus managed)
+    size_t getDeviceBytes() const
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_bytes[kind::device] + m_bytes[kind::managed];
+        }
+
+    //! Set the device memory budget
+    /*! \param bytes Budget in bytes (0 disables the budget)
+     */
+    void setBudget(size_t bytes)
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_budget = bytes;
+        }
+
+    //! Get the device memory budget in bytes (0 when disabled)
+    size_t getBudget() const
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_budget;
+        }
+
+    //! Throw if a device allocation would exceed the budget
+    /*! \param nbytes Size of the requested allocation in bytes
+        \param tag Profiling tag of the requesting array (may be empty)
+
+        Called before device allocations are attempted so the request fails with an
+        informative error rather than a mid-run out of memory abort.
+    */
+    void checkBudget(size_t nbytes, const std::string& tag) const
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_budget == 0)
+            return;
+
+        size_t in_use = m_bytes[kind::device] + m_bytes[kind::managed];
+        if (in_use + nbytes <= m_budget)
+            return;
+
+        std::ostringstream oss;
+        oss << "Device memory budget exceeded: "
+            << (tag.empty() ? std::string("an anonymous array") : tag) << " requested "
+            << nbytes << " bytes with " << in_use << " of " << m_budget
+            << " bytes already in use.";
+
+        auto usage = usageByTag();
+        size_t n_report = std::min<size_t>(usage.size(), 5);
+        if (n_report > 0)
+            {
+            oss << " Largest consumers:";
+            for (size_t i = 0; i < n_report; i++)
+                oss << " " << usage[i].first << "=" << usage[i].second << "B";
+            }
+
+        throw std::runtime_error(oss.str());
+        }
+
+    //! Aggregate the current usage by tag
+    /*! \returns (tag, bytes) pairs sorted by decreasing size; untagged allocations are
+        lumped under "(untagged)"
+    */
+    std::vector<std::pair<std::string, size_t>> getUsageByTag() const
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return usageByTag();
+        }
+
+    //! Enable / disable allocation tracing
+    /*! \param enable True to record every subsequently registered allocation
+
+        Enable after warmup to flag allocations that still occur during steady-state
+        stepping: a run whose steps perform no allocations leaves the trace empty.
+        Enabling clears any previous trace and reserves the recording buffer up front so
+        the tracer itself does not allocate while recording (until the reserve is
+        exhausted).
+    */
+    void setTracing(bool enable)
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tracing = enable;
+        if (enable)
+            {
+            m_trace.clear();
+            m_trace.reserve(trace_reserve);
+            }
+        }
+
+    //! Get whether allocation tracing is enabled
+    bool getTracing() const
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_tracing;
+        }
+
+    //! Get the recorded allocation trace
+    /*! \returns (tag, kind, bytes) tuples in allocation order; untagged allocations are
+        reported as "(untagged)"
+    */
+    std::vector<std::tuple<std::string, std::string, size_t>> getTrace() const
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        std::vector<std::tuple<std::string, std::string, size_t>> result;
+        result.reserve(m_trace.size());
+        for (const auto& event : m_trace)
+            {
+            result.emplace_back(event.tag.empty() ? s_untagged : event.tag,
+                                kindName(event.k),
+                                event.nbytes);
+            }
+        return result;
+        }
+
+    private:
+    /// One tracked allocation
+    struct Entry
+        {
+        size_t nbytes;
+        kind::Enum k;
+        std::string tag;
+        };
+
+    /// One recorded allocation event
+    struct TraceEvent
+        {
+        std::string tag;
+        kind::Enum k;
+        size_t nbytes;
+        };
+
+    /// Number of trace events reserved when tracing is enabled
+    static const size_t trace_reserve = 4096;
+
+    /// Human readable name of a kind of memory
+    static const char* kindName(kind::Enum k)
+        {
+        switch (k)
+            {
+        case kind::host:
+            return "host";
+        case kind::device:
+            return "device";
+        case kind::managed:
+            return "managed";
+        default:
+            return "unknown";
+            }
+        }
+
+    /// Aggregate usage by tag without taking the lock (caller holds it)
+    std::vector<std::pair<std::string, size_t>> usageByTag() const
+        {
+        std::map<std::string, size_t> by_tag;
+        for (const auto& e : m_entries)
+            {
+            const std::string& tag = e.second.tag.empty() ? s_untagged : e.second.tag;
+            by_tag[tag] += e.second.nbytes;
+            }
+
+        std::vector<std::pair<std::string, size_t>> result(by_tag.begin(), by_tag.end());
+        std::sort(result.begin(),
+                  result.end(),
+                  [](const std::pair<std::string, size_t>& a,
+                     const std::pair<std::string, size_t>& b) { return a.second > b.second; });
+        return result;
+        }
+
+    /// Label applied to allocations without a tag
+    inline static const std::string s_untagged = "(untagged)";
+
+    mutable std::mutex m_mutex;               //!< Protects all registry state
+    std::map<const void*, Entry> m_entries;   //!< Tracked allocations, keyed by pointer
+    size_t m_bytes[n_kinds] = {0, 0, 0};      //!< Current bytes allocated, per kind
+    size_t m_budget = 0;                      //!< Device memory budget (0 = unlimited)
+    bool m_tracing = false;                   //!< True when allocation tracing is active
+    std::vector<TraceEvent> m_trace;          //!< Recorded allocation events
+    };
+
+    } // end namespace hoomd
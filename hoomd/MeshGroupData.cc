@@ -123,6 +123,11 @@ void MeshGroupData<group_size, Group, name, snap>::initializeFromTriangleSnapsho
 
     std::vector<unsigned int> all_types;
 
+    // map each unique edge (ordered tag pair) to its index in all_helper, so that bonds
+    // shared between adjacent triangles are deduplicated in O(log N) per edge instead of
+    // scanning all previously added bonds; large remeshes were quadratic otherwise
+    std::map<std::pair<unsigned int, unsigned int>, unsigned int> edge_map;
+
     if (group_size == 4)
         {
         for (unsigned group_idx = 0; group_idx < snapshot.groups.size(); group_idx++)
@@ -161,25 +166,23 @@ void MeshGroupData<group_size, Group, name, snap>::initializeFromTriangleSnapsho
                     }
                 }
 
-            // Remove any duplicate bonds.
-            for (unsigned int i = 0; i < all_helper.size(); ++i)
+            for (unsigned int j = 0; j < bonds.size(); ++j)
                 {
-                for (unsigned int j = 0; j < bonds.size(); ++j)
+                std::pair<unsigned int, unsigned int> edge(bonds[j].tag[0], bonds[j].tag[1]);
+                auto it = edge_map.find(edge);
+                if (it != edge_map.end())
                     {
-                    if (bonds[j].tag[0] == all_helper[i].tag[0]
-                        && bonds[j].tag[1] == all_helper[i].tag[1])
-                        {
-                        // all_helper[i].tag[3] = group_idx;
-                        all_helper[i].tag[3] = bonds[j].tag[2];
-                        bonds.erase(bonds.begin() + j);
-                        break;
-                        }
+                    // the neighboring triangle already added this bond; record the second
+                    // opposite vertex
+                    all_helper[it->second].tag[3] = bonds[j].tag[2];
+                    }
+                else
+                    {
+                    edge_map.insert(
+                        std::make_pair(edge, (unsigned int)all_helper.size()));
+                    all_helper.push_back(bonds[j]);
+                    all_types.push_back(snapshot.type_id[group_idx]);
                     }
-                }
-            for (unsigned int i = 0; i < bonds.size(); ++i)
-                {
-                all_helper.push_back(bonds[i]);
-                all_types.push_back(snapshot.type_id[group_idx]);
                 }
             }
         all_groups = all_helper;
@@ -209,28 +212,33 @@ void MeshGroupData<group_size, Group, name, snap>::initializeFromTriangleSnapsho
             bonds[2].tag[1] = triag.tag[0];
             bonds[2].tag[2] = triag.tag[1];
 
-            for (unsigned int i = 0; i < all_helper.size(); ++i)
+            for (unsigned int j = 0; j < bonds.size(); ++j)
                 {
-                for (unsigned int j = 0; j < bonds.size(); ++j)
+                if (bonds[j].tag[0] > bonds[j].tag[1])
                     {
-                    if (bonds[j].tag[0] > bonds[j].tag[1])
-                        {
-                        bonds0 = bonds[j].tag[0];
-                        bonds1 = bonds[j].tag[1];
-
-                        bonds[j].tag[0] = bonds1;
-                        bonds[j].tag[1] = bonds0;
-                        }
-                    if (bonds[j].tag[0] == all_helper[i].tag[0]
-                        && bonds[j].tag[1] == all_helper[i].tag[1])
-                        {
-                        // bond_id.push_back(i);
-                        bond_id.push_back(all_helper[i].tag[2]);
-                        bonds.erase(bonds.begin() + j);
-                        break;
-                        }
+                    bonds0 = bonds[j].tag[0];
+                    bonds1 = bonds[j].tag[1];
+
+                    bonds[j].tag[0] = bonds1;
+                    bonds[j].tag[1] = bonds0;
+                    }
+                }
+
+            for (unsigned int j = 0; j < bonds.size();)
+                {
+                std::pair<unsigned int, unsigned int> edge(bonds[j].tag[0], bonds[j].tag[1]);
+                auto it = edge_map.find(edge);
+                if (it != edge_map.end())
+                    {
+                    bond_id.push_back(all_helper[it->second].tag[2]);
+                    bonds.erase(bonds.begin() + j);
+                    }
+                else
+                    {
+                    ++j;
                     }
                 }
+
             unsigned int j = 0;
             for (j = 0; j < bond_id.size(); ++j)
                 {
@@ -241,6 +249,8 @@ void MeshGroupData<group_size, Group, name, snap>::initializeFromTriangleSnapsho
                 {
                 // triag.tag[3 + j] = static_cast<unsigned int>(all_helper.size());
                 triag.tag[3 + j] = bonds[i].tag[2];
+                edge_map.insert(std::make_pair(std::make_pair(bonds[i].tag[0], bonds[i].tag[1]),
+                                               (unsigned int)all_helper.size()));
                 all_helper.push_back(bonds[i]);
                 j++;
                 }
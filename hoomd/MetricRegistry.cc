@@ -0,0 +1,98 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file MetricRegistry.cc
+    \brief Defines the MetricRegistry class
+*/
+
+#include "MetricRegistry.h"
+#include "Compute.h"
+
+#include <algorithm>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+#include <stdexcept>
+
+namespace hoomd
+    {
+void MetricRegistry::registerMetric(const void* owner,
+                                    const std::string& name,
+                                    std::function<double()> getter,
+                                    Compute* compute)
+    {
+    for (const auto& metric : m_metrics)
+        {
+        if (metric.name == name)
+            {
+            throw std::invalid_argument("Metric '" + name + "' is already registered.");
+            }
+        }
+
+    m_metrics.push_back(Metric {owner, name, getter, compute});
+    m_layout_version++;
+    }
+
+void MetricRegistry::removeMetrics(const void* owner)
+    {
+    auto new_end = std::remove_if(m_metrics.begin(),
+                                  m_metrics.end(),
+                                  [owner](const Metric& metric) { return metric.owner == owner; });
+    if (new_end != m_metrics.end())
+        {
+        m_metrics.erase(new_end, m_metrics.end());
+        m_layout_version++;
+        }
+    }
+
+const std::vector<double>& MetricRegistry::collect(uint64_t timestep)
+    {
+    // bring the producing computes up to date first: Compute::compute is cheap when the compute
+    // has already run this timestep, and evaluating before the getters keeps any collective
+    // communication inside the computes (collect must be called on all ranks)
+    Compute* last_compute = nullptr;
+    for (const auto& metric : m_metrics)
+        {
+        if (metric.compute && metric.compute != last_compute)
+            {
+            metric.compute->compute(timestep);
+            last_compute = metric.compute;
+            }
+        }
+
+    m_frame.resize(m_metrics.size());
+    for (size_t i = 0; i < m_metrics.size(); i++)
+        {
+        m_frame[i] = m_metrics[i].getter();
+        }
+    return m_frame;
+    }
+
+std::vector<std::string> MetricRegistry::getNames() const
+    {
+    std::vector<std::string> names;
+    names.reserve(m_metrics.size());
+    for (const auto& metric : m_metrics)
+        {
+        names.push_back(metric.name);
+        }
+    return names;
+    }
+
+namespace detail
+    {
+void export_MetricRegistry(pybind11::module& m)
+    {
+    pybind11::class_<MetricRegistry, std::shared_ptr<MetricRegistry>>(m, "MetricRegistry")
+        .def("collect",
+             [](MetricRegistry& registry, uint64_t timestep)
+             {
+                 const std::vector<double>& frame = registry.collect(timestep);
+                 return pybind11::array_t<double>(frame.size(), frame.data());
+             })
+        .def("getNames", &MetricRegistry::getNames)
+        .def_property_readonly("layout_version", &MetricRegistry::getLayoutVersion);
+    }
+
+    } // end namespace detail
+
+    } // end namespace hoomd
@@ -0,0 +1,87 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <functional>
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <string>
+#include <vector>
+
+/*! \file MetricRegistry.h
+    \brief Declares the MetricRegistry class
+*/
+
+namespace hoomd
+    {
+class Compute;
+
+//! Registry of named scalar metrics published by operations
+/*! Operations register scalar getters under dotted names (matching the logger namespace of the
+    corresponding loggable quantity). collect() evaluates every registered getter on the C++ side
+    and returns the values in one contiguous buffer, so Python consumers retrieve a whole frame of
+    scalars with a single call instead of dispatching one attribute access per quantity.
+
+    Registrations are keyed by an owner pointer so that an operation can atomically replace or
+    remove its metrics when it detaches or is destroyed. The layout version increments whenever
+    the set of registered metrics changes, letting consumers cache the name list.
+
+    \ingroup data_structs
+*/
+class PYBIND11_EXPORT MetricRegistry
+    {
+    public:
+    //! Register a scalar metric
+    /*! \param owner Pointer identifying the registering operation (used for removal)
+        \param name Dotted name of the metric, unique within the registry
+        \param getter Callable returning the current value of the metric
+        \param compute Compute to bring up to date before evaluating the getter (may be null)
+    */
+    void registerMetric(const void* owner,
+                        const std::string& name,
+                        std::function<double()> getter,
+                        Compute* compute = nullptr);
+
+    //! Remove all metrics registered by the given owner
+    void removeMetrics(const void* owner);
+
+    //! Evaluate all metrics at the given timestep and return the frame
+    const std::vector<double>& collect(uint64_t timestep);
+
+    //! Get the names of all registered metrics, in frame order
+    std::vector<std::string> getNames() const;
+
+    //! Get the layout version (incremented when metrics are added or removed)
+    uint64_t getLayoutVersion() const
+        {
+        return m_layout_version;
+        }
+
+    private:
+    /// One registered metric
+    struct Metric
+        {
+        const void* owner;             //!< Owner key used for removal
+        std::string name;              //!< Dotted metric name
+        std::function<double()> getter; //!< Evaluates the metric
+        Compute* compute;              //!< Compute to update first (may be null)
+        };
+
+    std::vector<Metric> m_metrics; //!< Registered metrics, in registration order
+    std::vector<double> m_frame;   //!< Contiguous buffer holding the last collected frame
+    uint64_t m_layout_version = 0; //!< Incremented on every registration change
+    };
+
+namespace detail
+    {
+//! Exports the MetricRegistry class to python
+void export_MetricRegistry(pybind11::module& m);
+
+    } // end namespace detail
+
+    } // end namespace hoomd
@@ -0,0 +1,257 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "MultipleTauCorrelator.h"
+
+#include <pybind11/stl.h>
+
+#include <stdexcept>
+
+namespace hoomd
+    {
+MultipleTauCorrelator::MultipleTauCorrelator(std::shared_ptr<SystemDefinition> sysdef,
+                                             std::shared_ptr<Trigger> trigger,
+                                             unsigned int points_per_level,
+                                             unsigned int max_levels)
+    : Analyzer(sysdef, trigger), m_points(points_per_level), m_max_levels(max_levels),
+      m_n_global(0), m_n_samples(0), m_last_timestep(0), m_sample_interval(0),
+      m_interval_warned(false)
+    {
+    if (m_points < 4 || m_points % 2 != 0)
+        {
+        throw std::invalid_argument("points_per_level must be an even number >= 4.");
+        }
+    if (m_max_levels == 0)
+        {
+        throw std::invalid_argument("max_levels must be >= 1.");
+        }
+    }
+
+/*! \param timestep Current time step of the simulation
+
+    Takes a snapshot of the particle data, unwraps the positions through the particle images, and
+    feeds the sample into the finest correlator level. The sample cascades to coarser levels by
+    pairwise averaging inside insertSample().
+*/
+void MultipleTauCorrelator::analyze(uint64_t timestep)
+    {
+    Analyzer::analyze(timestep);
+
+    SnapshotParticleData<Scalar> snapshot;
+    m_pdata->takeSnapshot(snapshot);
+
+#ifdef ENABLE_MPI
+    // the snapshot is gathered to the root rank, only accumulate there
+    if (m_sysdef->isDomainDecomposed() && !m_exec_conf->isRoot())
+        {
+        return;
+        }
+#endif
+
+    // the lag times assume periodic sampling, validate against the first observed interval
+    if (m_n_samples == 1)
+        {
+        m_sample_interval = timestep - m_last_timestep;
+        }
+    else if (m_n_samples > 1 && !m_interval_warned
+             && timestep - m_last_timestep != m_sample_interval)
+        {
+        m_exec_conf->msg->warning()
+            << "MultipleTauCorrelator is triggered at non-periodic time steps, the reported"
+            << " lag times are inaccurate." << std::endl;
+        m_interval_warned = true;
+        }
+    m_last_timestep = timestep;
+
+    const unsigned int n_global = static_cast<unsigned int>(snapshot.size);
+    if (n_global != m_n_global)
+        {
+        if (m_n_global != 0)
+            {
+            m_exec_conf->msg->warning()
+                << "The number of particles changed, resetting the correlator." << std::endl;
+            }
+        reset();
+        m_n_global = n_global;
+        }
+    if (n_global == 0)
+        {
+        return;
+        }
+
+    // unwrap the positions so displacements accumulate across periodic boundaries
+    const BoxDim& box = m_pdata->getGlobalBox();
+    std::vector<vec3<double>> pos(n_global);
+    std::vector<vec3<double>> vel(n_global);
+    for (unsigned int i = 0; i < n_global; i++)
+        {
+        pos[i] = vec3<double>(box.shift(vec3<Scalar>(snapshot.pos[i]), snapshot.image[i]));
+        vel[i] = vec3<double>(snapshot.vel[i]);
+        }
+
+    insertSample(0, pos, vel);
+    m_n_samples++;
+    }
+
+/*! \param level_idx Level to insert into (0 is the finest)
+    \param pos Unwrapped particle positions, or pairwise averages thereof
+    \param vel Particle velocities, or pairwise averages thereof
+
+    Correlates the new sample against the level's ring buffer and accumulates MSD and VACF at
+    every reachable lag. Level 0 covers lags 0 to m_points-1; coarser levels only cover the upper
+    half of their lag range, the lower half is already resolved by the finer level below. Every
+    second sample, the pairwise average of the last two samples is inserted into the next level.
+*/
+void MultipleTauCorrelator::insertSample(unsigned int level_idx,
+                                         const std::vector<vec3<double>>& pos,
+                                         const std::vector<vec3<double>>& vel)
+    {
+    if (level_idx == m_levels.size())
+        {
+        Level level;
+        level.pos.resize(static_cast<size_t>(m_points) * m_n_global);
+        level.vel.resize(static_cast<size_t>(m_points) * m_n_global);
+        level.accum_pos.assign(m_n_global, vec3<double>(0, 0, 0));
+        level.accum_vel.assign(m_n_global, vec3<double>(0, 0, 0));
+        level.msd_sum.assign(m_points, 0.0);
+        level.vacf_sum.assign(m_points, 0.0);
+        level.count.assign(m_points, 0);
+        m_levels.push_back(std::move(level));
+        }
+
+    Level& level = m_levels[level_idx];
+    const unsigned int slot = static_cast<unsigned int>(level.n_samples % m_points);
+    std::copy(pos.begin(), pos.end(), level.pos.begin() + static_cast<size_t>(slot) * m_n_global);
+    std::copy(vel.begin(), vel.end(), level.vel.begin() + static_cast<size_t>(slot) * m_n_global);
+    level.n_samples++;
+
+    const double inv_n = 1.0 / static_cast<double>(m_n_global);
+    const unsigned int min_lag = (level_idx == 0) ? 0 : m_points / 2;
+    const unsigned int max_lag = static_cast<unsigned int>(
+        std::min(level.n_samples - 1, static_cast<uint64_t>(m_points - 1)));
+    for (unsigned int lag = min_lag; lag <= max_lag; lag++)
+        {
+        const unsigned int old_slot = (slot + m_points - lag) % m_points;
+        const vec3<double>* old_pos = level.pos.data() + static_cast<size_t>(old_slot) * m_n_global;
+        const vec3<double>* old_vel = level.vel.data() + static_cast<size_t>(old_slot) * m_n_global;
+
+        double msd = 0.0;
+        double vacf = 0.0;
+        for (unsigned int i = 0; i < m_n_global; i++)
+            {
+            const vec3<double> dr = pos[i] - old_pos[i];
+            msd += dot(dr, dr);
+            vacf += dot(vel[i], old_vel[i]);
+            }
+        level.msd_sum[lag] += msd * inv_n;
+        level.vacf_sum[lag] += vacf * inv_n;
+        level.count[lag]++;
+        }
+
+    // cascade the pairwise average of two consecutive samples to the next coarser level
+    for (unsigned int i = 0; i < m_n_global; i++)
+        {
+        level.accum_pos[i] += pos[i];
+        level.accum_vel[i] += vel[i];
+        }
+    level.n_accum++;
+    if (level.n_accum == 2)
+        {
+        if (level_idx + 1 < m_max_levels)
+            {
+            std::vector<vec3<double>> avg_pos(m_n_global);
+            std::vector<vec3<double>> avg_vel(m_n_global);
+            for (unsigned int i = 0; i < m_n_global; i++)
+                {
+                avg_pos[i] = level.accum_pos[i] * 0.5;
+                avg_vel[i] = level.accum_vel[i] * 0.5;
+                }
+            insertSample(level_idx + 1, avg_pos, avg_vel);
+            }
+        // m_levels may have reallocated, re-resolve the reference
+        Level& level_again = m_levels[level_idx];
+        std::fill(level_again.accum_pos.begin(), level_again.accum_pos.end(), vec3<double>(0, 0, 0));
+        std::fill(level_again.accum_vel.begin(), level_again.accum_vel.end(), vec3<double>(0, 0, 0));
+        level_again.n_accum = 0;
+        }
+    }
+
+void MultipleTauCorrelator::reset()
+    {
+    m_levels.clear();
+    m_n_global = 0;
+    m_n_samples = 0;
+    m_sample_interval = 0;
+    m_interval_warned = false;
+    }
+
+/*! \param visit Callable visit(level_idx, lag, msd_mean, vacf_mean) invoked in order of
+        increasing lag time for every lag with at least one accumulated pair
+*/
+template<class Visitor> void MultipleTauCorrelator::forEachLag(Visitor&& visit) const
+    {
+    for (unsigned int level_idx = 0; level_idx < m_levels.size(); level_idx++)
+        {
+        const Level& level = m_levels[level_idx];
+        const unsigned int min_lag = (level_idx == 0) ? 0 : m_points / 2;
+        for (unsigned int lag = min_lag; lag < m_points; lag++)
+            {
+            if (level.count[lag] == 0)
+                {
+                continue;
+                }
+            const double norm = 1.0 / static_cast<double>(level.count[lag]);
+            visit(level_idx, lag, level.msd_sum[lag] * norm, level.vacf_sum[lag] * norm);
+            }
+        }
+    }
+
+std::vector<double> MultipleTauCorrelator::getLagTimes() const
+    {
+    std::vector<double> times;
+    const double interval = (m_sample_interval != 0) ? static_cast<double>(m_sample_interval) : 1.0;
+    forEachLag(
+        [&](unsigned int level_idx, unsigned int lag, double, double)
+        {
+            times.push_back(static_cast<double>(lag) * static_cast<double>(uint64_t(1) << level_idx)
+                            * interval);
+        });
+    return times;
+    }
+
+std::vector<double> MultipleTauCorrelator::getMSD() const
+    {
+    std::vector<double> msd;
+    forEachLag([&](unsigned int, unsigned int, double msd_mean, double) { msd.push_back(msd_mean); });
+    return msd;
+    }
+
+std::vector<double> MultipleTauCorrelator::getVACF() const
+    {
+    std::vector<double> vacf;
+    forEachLag([&](unsigned int, unsigned int, double, double vacf_mean)
+               { vacf.push_back(vacf_mean); });
+    return vacf;
+    }
+
+namespace detail
+    {
+void export_MultipleTauCorrelator(pybind11::module& m)
+    {
+    pybind11::class_<MultipleTauCorrelator, Analyzer, std::shared_ptr<MultipleTauCorrelator>>(
+        m,
+        "MultipleTauCorrelator")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            unsigned int,
+                            unsigned int>())
+        .def_property_readonly("points_per_level", &MultipleTauCorrelator::getPointsPerLevel)
+        .def_property_readonly("max_levels", &MultipleTauCorrelator::getMaxLevels)
+        .def_property_readonly("num_samples", &MultipleTauCorrelator::getNumSamples)
+        .def("getLagTimes", &MultipleTauCorrelator::getLagTimes)
+        .def("getMSD", &MultipleTauCorrelator::getMSD)
+        .def("getVACF", &MultipleTauCorrelator::getVACF)
+        .def("reset", &MultipleTauCorrelator::reset);
+    }
+    } // namespace detail
+    } // namespace hoomd
@@ -0,0 +1,117 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+#include "Analyzer.h"
+#include "VectorMath.h"
+
+namespace hoomd
+    {
+//! Streaming multiple-tau correlator for single-particle dynamics
+/*! MultipleTauCorrelator accumulates the mean squared displacement (MSD) and the velocity
+    autocorrelation function (VACF) on the fly with the multiple-tau (order-n) blocking scheme.
+    Each correlator level holds a short ring buffer of samples; every second sample of a level is
+    averaged pairwise and passed to the next coarser level, so lag times grow geometrically while
+    the memory footprint stays at a few ring buffers regardless of run length. This replaces
+    dumping full trajectories to disk for quantities that only need running accumulators.
+
+    Samples are taken from a particle data snapshot each time the analyzer triggers, so the
+    correlation functions are exact at short lags and carry the usual multiple-tau pairwise
+    averaging error at long lags. Positions are unwrapped through the particle images before
+    accumulation. Sampling must be periodic: the lag times reported assume the interval between
+    the first two triggered time steps.
+
+    In MPI simulations the snapshot is gathered to rank 0 and the accumulators are valid on
+    rank 0 only.
+
+    \ingroup analyzers
+*/
+class PYBIND11_EXPORT MultipleTauCorrelator : public Analyzer
+    {
+    public:
+    MultipleTauCorrelator(std::shared_ptr<SystemDefinition> sysdef,
+                          std::shared_ptr<Trigger> trigger,
+                          unsigned int points_per_level,
+                          unsigned int max_levels);
+    ~MultipleTauCorrelator() = default;
+
+    //! Sample the particle data and update the accumulators
+    void analyze(uint64_t timestep) override;
+
+    //! Discard all accumulated samples
+    void reset();
+
+    unsigned int getPointsPerLevel() const
+        {
+        return m_points;
+        }
+
+    unsigned int getMaxLevels() const
+        {
+        return m_max_levels;
+        }
+
+    uint64_t getNumSamples() const
+        {
+        return m_n_samples;
+        }
+
+    //! Get the lag times (in time steps) with at least one accumulated sample pair
+    std::vector<double> getLagTimes() const;
+
+    //! Get the mean squared displacement at the lag times of getLagTimes()
+    std::vector<double> getMSD() const;
+
+    //! Get the velocity autocorrelation function at the lag times of getLagTimes()
+    std::vector<double> getVACF() const;
+
+    protected:
+    //! One blocking level of the correlator
+    struct Level
+        {
+        std::vector<vec3<double>> pos; //!< Ring buffer of unwrapped positions, m_points * N
+        std::vector<vec3<double>> vel; //!< Ring buffer of velocities, m_points * N
+        uint64_t n_samples = 0;        //!< Number of samples received at this level
+
+        std::vector<vec3<double>> accum_pos; //!< Pending pairwise position average, N
+        std::vector<vec3<double>> accum_vel; //!< Pending pairwise velocity average, N
+        unsigned int n_accum = 0;            //!< Samples in the pending average (0 or 1)
+
+        std::vector<double> msd_sum;  //!< MSD accumulator per lag
+        std::vector<double> vacf_sum; //!< VACF accumulator per lag
+        std::vector<uint64_t> count;  //!< Number of accumulated pairs per lag
+        };
+
+    //! Insert a sample into the given level and cascade the pairwise average upward
+    void insertSample(unsigned int level_idx,
+                      const std::vector<vec3<double>>& pos,
+                      const std::vector<vec3<double>>& vel);
+
+    //! Visit all lags with accumulated data in order of increasing lag time
+    template<class Visitor> void forEachLag(Visitor&& visit) const;
+
+    unsigned int m_points;       //!< Correlation points per level (ring buffer length)
+    unsigned int m_max_levels;   //!< Maximum number of blocking levels
+    std::vector<Level> m_levels; //!< Blocking levels, finest first
+
+    unsigned int m_n_global;     //!< Number of particles the accumulators were sized for
+    uint64_t m_n_samples;        //!< Total number of level-0 samples taken
+    uint64_t m_last_timestep;    //!< Time step of the previous sample
+    uint64_t m_sample_interval;  //!< Time steps between samples, set by the first two samples
+    bool m_interval_warned;      //!< True after warning about non-periodic sampling
+    };
+
+namespace detail
+    {
+void export_MultipleTauCorrelator(pybind11::module& m);
+    } // namespace detail
+    } // namespace hoomd
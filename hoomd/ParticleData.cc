@@ -19,12 +19,14 @@
 #include <pybind11/numpy.h>
 #include <pybind11/operators.h>
 
+#include <algorithm>
 #include <cassert>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
 #include <stdlib.h>
+#include <type_traits>
 
 using namespace std;
 
@@ -77,7 +79,8 @@ ParticleData::ParticleData(unsigned int N,
                            std::shared_ptr<ExecutionConfiguration> exec_conf,
                            std::shared_ptr<DomainDecomposition> decomposition)
     : m_exec_conf(exec_conf), m_nparticles(0), m_nghosts(0), m_max_nparticles(0), m_nglobal(0),
-      m_accel_set(false), m_resize_factor(9. / 8.), m_arrays_allocated(false)
+      m_accel_set(false), m_aniso_data_in_use(false), m_resize_factor(9. / 8.),
+      m_arrays_allocated(false)
     {
     m_exec_conf->msg->notice(5) << "Constructing ParticleData" << endl;
 
@@ -139,7 +142,8 @@ ParticleData::ParticleData(const SnapshotParticleData<Real>& snapshot,
                            std::shared_ptr<ExecutionConfiguration> exec_conf,
                            std::shared_ptr<DomainDecomposition> decomposition)
     : m_exec_conf(exec_conf), m_nparticles(0), m_nghosts(0), m_max_nparticles(0), m_nglobal(0),
-      m_accel_set(false), m_resize_factor(9. / 8.), m_arrays_allocated(false)
+      m_accel_set(false), m_aniso_data_in_use(false), m_resize_factor(9. / 8.),
+      m_arrays_allocated(false)
     {
     m_exec_conf->msg->notice(5) << "Constructing ParticleData" << endl;
 
@@ -287,9 +291,53 @@ void ParticleData::notifyParticleSort()
         }
 #endif
 
+    // invalidate any published rtag snapshot before listeners observe the new order
+    m_rtag_epoch.fetch_add(1, std::memory_order_release);
+
     m_sort_signal.emit();
     }
 
+std::shared_ptr<const std::vector<unsigned int>> ParticleData::updateRTagSnapshot()
+    {
+    uint64_t epoch = m_rtag_epoch.load(std::memory_order_acquire);
+    auto current = std::atomic_load(&m_rtag_snapshot);
+
+    // no-op when the mapping has not changed since the last publication
+    if (current && m_rtag_snapshot_epoch == epoch)
+        return current;
+
+    auto snapshot = std::make_shared<std::vector<unsigned int>>(m_rtag.size());
+        {
+        ArrayHandle<unsigned int> h_rtag(m_rtag, access_location::host, access_mode::read);
+        std::copy(h_rtag.data, h_rtag.data + m_rtag.size(), snapshot->begin());
+        }
+
+    std::shared_ptr<const std::vector<unsigned int>> published = snapshot;
+    std::atomic_store(&m_rtag_snapshot, published);
+    m_rtag_snapshot_epoch = epoch;
+
+    return published;
+    }
+
+void ParticleData::getRTagsBatched(const std::vector<unsigned int>& tags,
+                                   std::vector<unsigned int>& indices) const
+    {
+    indices.resize(tags.size());
+
+    // resolve all queries against one snapshot so the batch sees a single epoch
+    auto snapshot = std::atomic_load(&m_rtag_snapshot);
+    if (!snapshot)
+        {
+        std::fill(indices.begin(), indices.end(), NOT_LOCAL);
+        return;
+        }
+
+    for (size_t i = 0; i < tags.size(); i++)
+        {
+        indices[i] = (tags[i] < snapshot->size()) ? (*snapshot)[tags[i]] : NOT_LOCAL;
+        }
+    }
+
 /*! This function is called any time the ghost particles are removed
  *
  * The rationale is that a subscriber (i.e. the Communicator) can perform clean-up for ghost
@@ -999,6 +1047,35 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
         snapshot.validate();
         }
 
+    // detect non-default anisotropic data in the snapshot so that migration keeps it intact
+    if (!m_aniso_data_in_use)
+        {
+        bool aniso = false;
+        if (m_exec_conf->getRank() == 0)
+            {
+            for (unsigned int i = 0; i < snapshot.size; ++i)
+                {
+                const quat<Real>& q = snapshot.orientation[i];
+                const quat<Real>& p = snapshot.angmom[i];
+                const vec3<Real>& moi = snapshot.inertia[i];
+                if (q.s != Real(1.0) || q.v.x != Real(0.0) || q.v.y != Real(0.0)
+                    || q.v.z != Real(0.0) || p.s != Real(0.0) || p.v.x != Real(0.0)
+                    || p.v.y != Real(0.0) || p.v.z != Real(0.0) || moi.x != Real(0.0)
+                    || moi.y != Real(0.0) || moi.z != Real(0.0))
+                    {
+                    aniso = true;
+                    break;
+                    }
+                }
+            }
+#ifdef ENABLE_MPI
+        if (m_decomposition)
+            bcast(aniso, 0, m_exec_conf->getMPICommunicator());
+#endif
+        if (aniso)
+            setAnisotropicDataInUse();
+        }
+
     // clear set of active tags
     m_tag_set.clear();
 
@@ -1006,6 +1083,9 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
     while (!m_recycled_tags.empty())
         m_recycled_tags.pop();
 
+    // reinitialization reassigns all tags, invalidating any cached per-tag state
+    m_n_tag_removals++;
+
     // global number of particles
     unsigned int nglobal = 0;
     unsigned int max_typeid = 0;
@@ -1378,6 +1458,84 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
         }
     }
 
+/*! \param other Particle data to copy the buffers from
+
+    Copies all per-particle buffers directly, without gathering a global snapshot. Both
+    particle datas must live on the same execution configuration and use the same domain
+    decomposition, so that each rank copies its own local particles. Ghost particles are
+    dropped; the communicator of the copy restores them on its next exchange.
+*/
+void ParticleData::copyParticlesFrom(const ParticleData& other)
+    {
+    m_exec_conf->msg->notice(4) << "ParticleData: copying particle buffers" << std::endl;
+
+    if (getNGlobal() != other.getNGlobal())
+        {
+        throw std::runtime_error("Cannot copy particle data of different global size.");
+        }
+
+    // local and maximum counts (ghosts are not copied)
+    m_nparticles = other.m_nparticles;
+    m_nghosts = 0;
+    m_max_nparticles = other.m_max_nparticles;
+    m_accel_set = other.m_accel_set;
+
+    // type names
+    m_type_mapping = other.m_type_mapping;
+
+    // per-particle data
+    m_pos = other.m_pos;
+    m_vel = other.m_vel;
+    m_accel = other.m_accel;
+    m_charge = other.m_charge;
+    m_diameter = other.m_diameter;
+    m_image = other.m_image;
+    m_tag = other.m_tag;
+    m_rtag = other.m_rtag;
+    m_body = other.m_body;
+    m_orientation = other.m_orientation;
+    m_angmom = other.m_angmom;
+    m_inertia = other.m_inertia;
+    m_comm_flags = other.m_comm_flags;
+
+    m_net_force = other.m_net_force;
+    m_net_virial = other.m_net_virial;
+    m_net_torque = other.m_net_torque;
+
+    // alternate (swap-in) arrays have to match the size of the primary arrays
+    m_pos_alt = other.m_pos_alt;
+    m_vel_alt = other.m_vel_alt;
+    m_accel_alt = other.m_accel_alt;
+    m_charge_alt = other.m_charge_alt;
+    m_diameter_alt = other.m_diameter_alt;
+    m_image_alt = other.m_image_alt;
+    m_tag_alt = other.m_tag_alt;
+    m_body_alt = other.m_body_alt;
+    m_orientation_alt = other.m_orientation_alt;
+    m_angmom_alt = other.m_angmom_alt;
+    m_inertia_alt = other.m_inertia_alt;
+    m_net_force_alt = other.m_net_force_alt;
+    m_net_virial_alt = other.m_net_virial_alt;
+    m_net_torque_alt = other.m_net_torque_alt;
+
+    for (unsigned int i = 0; i < 6; i++)
+        {
+        m_external_virial[i] = other.m_external_virial[i];
+        }
+    m_external_energy = other.m_external_energy;
+
+    // origin and tag bookkeeping
+    m_origin = other.m_origin;
+    m_o_image = other.m_o_image;
+    m_tag_set = other.m_tag_set;
+    m_cached_tag_set = other.m_cached_tag_set;
+    m_invalid_cached_tags = other.m_invalid_cached_tags;
+
+    // notify listeners that particle identities changed; this also updates the GPU
+    // partition to the new local particle number
+    notifyParticleSort();
+    }
+
 //! take a particle data snapshot
 /* \param snapshot The snapshot to write to
    \returns a map to lookup the snapshot index from a particle tag
@@ -1443,61 +1601,23 @@ template<class Real> void ParticleData::takeSnapshot(SnapshotParticleData<Real>&
             rtag_map.insert(std::pair<unsigned int, unsigned int>(h_tag.data[idx], idx));
             }
 
-        std::vector<std::vector<Scalar3>> pos_proc;       // Position array of every processor
-        std::vector<std::vector<Scalar3>> vel_proc;       // Velocities array of every processor
-        std::vector<std::vector<Scalar3>> accel_proc;     // Accelerations array of every processor
-        std::vector<std::vector<unsigned int>> type_proc; // Particle types array of every processor
-        std::vector<std::vector<Scalar>> mass_proc;   // Particle masses array of every processor
-        std::vector<std::vector<Scalar>> charge_proc; // Particle charges array of every processor
-        std::vector<std::vector<Scalar>>
-            diameter_proc;                         // Particle diameters array of every processor
-        std::vector<std::vector<int3>> image_proc; // Particle images array of every processor
-        std::vector<std::vector<unsigned int>> body_proc;   // Body ids of every processor
-        std::vector<std::vector<Scalar4>> orientation_proc; // Orientations of every processor
-        std::vector<std::vector<Scalar4>> angmom_proc;      // Angular momenta of every processor
-        std::vector<std::vector<Scalar3>> inertia_proc;     // Moments of inertia of every processor
-
-        std::vector<std::map<unsigned int, unsigned int>>
-            rtag_map_proc; // List of reverse-lookup maps
-
         const MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
         unsigned int size = m_exec_conf->getNRanks();
         unsigned int rank = m_exec_conf->getRank();
 
-        // resize to number of ranks in communicator
-        pos_proc.resize(size);
-        vel_proc.resize(size);
-        accel_proc.resize(size);
-        type_proc.resize(size);
-        mass_proc.resize(size);
-        charge_proc.resize(size);
-        diameter_proc.resize(size);
-        image_proc.resize(size);
-        body_proc.resize(size);
-        orientation_proc.resize(size);
-        angmom_proc.resize(size);
-        inertia_proc.resize(size);
-        rtag_map_proc.resize(size);
-
         unsigned int root = 0;
 
-        // collect all particle data on the root processor
-        gather_v(pos, pos_proc, root, mpi_comm);
-        gather_v(vel, vel_proc, root, mpi_comm);
-        gather_v(accel, accel_proc, root, mpi_comm);
-        gather_v(type, type_proc, root, mpi_comm);
-        gather_v(mass, mass_proc, root, mpi_comm);
-        gather_v(charge, charge_proc, root, mpi_comm);
-        gather_v(diameter, diameter_proc, root, mpi_comm);
-        gather_v(image, image_proc, root, mpi_comm);
-        gather_v(body, body_proc, root, mpi_comm);
-        gather_v(orientation, orientation_proc, root, mpi_comm);
-        gather_v(angmom, angmom_proc, root, mpi_comm);
-        gather_v(inertia, inertia_proc, root, mpi_comm);
-
-        // gather the reverse-lookup maps
-        gather_v(rtag_map, rtag_map_proc, root, mpi_comm);
+        // gather the reverse-lookup maps first, up a tree so that the root does not handshake
+        // with every rank individually
+        std::vector<std::map<unsigned int, unsigned int>>
+            rtag_map_proc; // List of reverse-lookup maps
+        rtag_map_proc.resize(size);
+        gather_v_tree(rtag_map, rtag_map_proc, root, mpi_comm);
 
+        // on the root, translate the reverse-lookup maps into the snapshot index of every local
+        // particle of every rank, so that each field can be scattered into the snapshot as soon
+        // as it arrives
+        std::vector<std::vector<unsigned int>> snap_id_proc;
         if (rank == root)
             {
             // allocate memory in snapshot
@@ -1516,7 +1636,10 @@ template<class Real> void ParticleData::takeSnapshot(SnapshotParticleData<Real>&
                             it->first,
                             std::pair<unsigned int, unsigned int>(irank, it->second)));
 
-            // add particles to snapshot
+            snap_id_proc.resize(n_ranks);
+            for (unsigned int irank = 0; irank < n_ranks; ++irank)
+                snap_id_proc[irank].resize(rtag_map_proc[irank].size());
+
             assert(m_tag_set.size() == getNGlobal());
             std::set<unsigned int>::const_iterator tag_set_it = m_tag_set.begin();
 
@@ -1535,30 +1658,72 @@ template<class Real> void ParticleData::takeSnapshot(SnapshotParticleData<Real>&
                     throw std::runtime_error(o.str());
                     }
 
-                // rank contains the processor rank on which the particle was found
+                // rank_idx contains the processor rank and local index of the particle
                 std::pair<unsigned int, unsigned int> rank_idx = rank_rtag_it->second;
-                unsigned int rank = rank_idx.first;
-                unsigned int idx = rank_idx.second;
-
-                snapshot.pos[snap_id] = vec3<Real>(pos_proc[rank][idx]);
-                snapshot.vel[snap_id] = vec3<Real>(vel_proc[rank][idx]);
-                snapshot.accel[snap_id] = vec3<Real>(accel_proc[rank][idx]);
-                snapshot.type[snap_id] = type_proc[rank][idx];
-                snapshot.mass[snap_id] = Real(mass_proc[rank][idx]);
-                snapshot.charge[snap_id] = Real(charge_proc[rank][idx]);
-                snapshot.diameter[snap_id] = Real(diameter_proc[rank][idx]);
-                snapshot.image[snap_id] = image_proc[rank][idx];
-                snapshot.body[snap_id] = body_proc[rank][idx];
-                snapshot.orientation[snap_id] = quat<Real>(orientation_proc[rank][idx]);
-                snapshot.angmom[snap_id] = quat<Real>(angmom_proc[rank][idx]);
-                snapshot.inertia[snap_id] = vec3<Real>(inertia_proc[rank][idx]);
-
-                // make sure the position stored in the snapshot is within the boundaries
+                snap_id_proc[rank_idx.first][rank_idx.second] = snap_id;
+
+                std::advance(tag_set_it, 1);
+                }
+            }
+
+        // gather one field at a time and stream it directly into the snapshot array, so that
+        // the peak memory on the root is one gathered field rather than all of them at once
+        auto gather_field = [&](const auto& local, auto&& store)
+            {
+            typedef typename std::decay<decltype(local)>::type::value_type value_type;
+            std::vector<std::vector<value_type>> proc(size);
+            gather_v_tree(local, proc, root, mpi_comm);
+            if (rank == root)
+                {
+                for (unsigned int irank = 0; irank < size; ++irank)
+                    {
+                    assert(proc[irank].size() == snap_id_proc[irank].size());
+                    for (unsigned int idx = 0; idx < proc[irank].size(); ++idx)
+                        store(snap_id_proc[irank][idx], proc[irank][idx]);
+                    }
+                }
+            };
+
+        gather_field(pos,
+                     [&](unsigned int snap_id, const Scalar3& v)
+                     { snapshot.pos[snap_id] = vec3<Real>(v); });
+        gather_field(vel,
+                     [&](unsigned int snap_id, const Scalar3& v)
+                     { snapshot.vel[snap_id] = vec3<Real>(v); });
+        gather_field(accel,
+                     [&](unsigned int snap_id, const Scalar3& v)
+                     { snapshot.accel[snap_id] = vec3<Real>(v); });
+        gather_field(type,
+                     [&](unsigned int snap_id, unsigned int v) { snapshot.type[snap_id] = v; });
+        gather_field(mass,
+                     [&](unsigned int snap_id, Scalar v) { snapshot.mass[snap_id] = Real(v); });
+        gather_field(charge,
+                     [&](unsigned int snap_id, Scalar v) { snapshot.charge[snap_id] = Real(v); });
+        gather_field(diameter,
+                     [&](unsigned int snap_id, Scalar v)
+                     { snapshot.diameter[snap_id] = Real(v); });
+        gather_field(image,
+                     [&](unsigned int snap_id, const int3& v) { snapshot.image[snap_id] = v; });
+        gather_field(body,
+                     [&](unsigned int snap_id, unsigned int v) { snapshot.body[snap_id] = v; });
+        gather_field(orientation,
+                     [&](unsigned int snap_id, const Scalar4& v)
+                     { snapshot.orientation[snap_id] = quat<Real>(v); });
+        gather_field(angmom,
+                     [&](unsigned int snap_id, const Scalar4& v)
+                     { snapshot.angmom[snap_id] = quat<Real>(v); });
+        gather_field(inertia,
+                     [&](unsigned int snap_id, const Scalar3& v)
+                     { snapshot.inertia[snap_id] = vec3<Real>(v); });
+
+        if (rank == root)
+            {
+            // make sure the positions stored in the snapshot are within the boundaries
+            for (unsigned int snap_id = 0; snap_id < getNGlobal(); snap_id++)
+                {
                 Scalar3 tmp = vec_to_scalar3(snapshot.pos[snap_id]);
                 m_global_box->wrap(tmp, snapshot.image[snap_id]);
                 snapshot.pos[snap_id] = vec3<Real>(tmp);
-
-                std::advance(tag_set_it, 1);
                 }
             }
         }
@@ -2374,6 +2539,7 @@ void ParticleData::setOrientation(unsigned int tag, const Scalar4& orientation)
                                            access_mode::readwrite);
         h_orientation.data[idx] = orientation;
         }
+    setAnisotropicDataInUse();
     }
 
 //! Set the angular momentum quaternion of a particle with a given tag
@@ -2392,6 +2558,7 @@ void ParticleData::setAngularMomentum(unsigned int tag, const Scalar4& angmom)
         ArrayHandle<Scalar4> h_angmom(m_angmom, access_location::host, access_mode::readwrite);
         h_angmom.data[idx] = angmom;
         }
+    setAnisotropicDataInUse();
     }
 
 //! Set the angular momentum quaternion of a particle with a given tag
@@ -2410,6 +2577,7 @@ void ParticleData::setMomentsOfInertia(unsigned int tag, const Scalar3& inertia)
         ArrayHandle<Scalar3> h_inertia(m_inertia, access_location::host, access_mode::readwrite);
         h_inertia.data[idx] = inertia;
         }
+    setAnisotropicDataInUse();
     }
 
 /*!
@@ -2567,7 +2735,7 @@ void ParticleData::removeParticle(unsigned int tag)
     bool is_available = is_local;
 
 #ifdef ENABLE_MPI
-    if (getDomainDecomposition())
+    if (isDomainDecomposed())
         {
         int res = is_local ? 1 : 0;
 
@@ -2654,6 +2822,7 @@ void ParticleData::removeParticle(unsigned int tag)
 
     // maintain a stack of deleted group tags for future recycling
     m_recycled_tags.push(tag);
+    m_n_tag_removals++;
 
     // invalidate active tag cache
     m_invalid_cached_tags = true;
@@ -2934,6 +3103,11 @@ void ParticleData::removeParticles(std::vector<detail::pdata_element>& out,
     out.resize(num_remove_ptls);
     comm_flags.resize(num_remove_ptls);
 
+    // nothing leaves this rank: all comm flags are zero and no particle moved, so skip the
+    // compaction pass, the array swaps, the rtag rebuild, and the sort notification
+    if (num_remove_ptls == 0)
+        return;
+
     // resize particle data using amortized O(1) array resizing
     resize(new_nparticles);
 
@@ -3115,6 +3289,10 @@ void ParticleData::addParticles(const std::vector<detail::pdata_element>& in)
     {
     unsigned int num_add_ptls = (unsigned int)in.size();
 
+    // nothing was received: the local arrays are untouched
+    if (num_add_ptls == 0)
+        return;
+
     unsigned int old_nparticles = getN();
     unsigned int new_nparticles = m_nparticles + num_add_ptls;
 
@@ -3188,8 +3366,8 @@ void ParticleData::addParticles(const std::vector<detail::pdata_element>& in)
         // reset communication flags
         std::fill(h_comm_flags.data + old_nparticles, h_comm_flags.data + new_nparticles, 0);
 
-        // recompute rtags
-        for (unsigned int idx = 0; idx < m_nparticles; ++idx)
+        // recompute rtags of the appended particles (existing particles did not move)
+        for (unsigned int idx = old_nparticles; idx < m_nparticles; ++idx)
             {
             // reset rtag of this ptl
             unsigned int tag = h_tag.data[idx];
@@ -3409,6 +3587,11 @@ void ParticleData::addParticlesGPU(const GlobalVector<detail::pdata_element>& in
     {
     unsigned int old_nparticles = getN();
     unsigned int num_add_ptls = (unsigned int)in.size();
+
+    // nothing was received: the local arrays are untouched
+    if (num_add_ptls == 0)
+        return;
+
     unsigned int new_nparticles = old_nparticles + num_add_ptls;
 
     // amortized resizing of particle data
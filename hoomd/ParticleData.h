@@ -41,6 +41,7 @@
 
 #include "DomainDecomposition.h"
 
+#include <atomic>
 #include <bitset>
 #include <stack>
 #include <stdlib.h>
@@ -639,6 +640,47 @@ class PYBIND11_EXPORT ParticleData
         return m_rtag;
         }
 
+    //! Get the epoch counter of the tag->index mapping
+    /*! The epoch increments every time the particles may have been rearranged in memory
+        (sorts, migrations, particle addition/removal). Concurrent readers can compare
+        epochs to detect a stale snapshot without acquiring any array.
+     */
+    uint64_t getRTagEpoch() const
+        {
+        return m_rtag_epoch.load(std::memory_order_acquire);
+        }
+
+    //! Rebuild and atomically publish a snapshot of the rtag array
+    /*! Must be called from the thread that owns the particle data (i.e. the simulation
+        thread), at a point where no reordering is in progress. When the mapping has not
+        changed since the last publication this is a no-op.
+
+        \returns the current snapshot
+     */
+    std::shared_ptr<const std::vector<unsigned int>> updateRTagSnapshot();
+
+    //! Read the last published rtag snapshot without blocking the updater
+    /*! Safe to call from any thread. The snapshot is immutable; it reflects the mapping
+        as of the epoch at which updateRTagSnapshot() last ran and may be stale. Returns
+        an empty pointer if no snapshot has been published yet.
+     */
+    std::shared_ptr<const std::vector<unsigned int>> readRTagSnapshot() const
+        {
+        return std::atomic_load(&m_rtag_snapshot);
+        }
+
+    //! Batched tag->index lookup against the published snapshot
+    /*! \param tags Tags to look up
+        \param indices Output indices, one per tag (NOT_LOCAL for tags that are out of
+               range or not local in the snapshot)
+
+        Resolves all queries against one atomically loaded snapshot, so the result is a
+        consistent view of a single epoch even while the simulation thread reorders
+        particles. If no snapshot has been published, all indices are NOT_LOCAL.
+     */
+    void getRTagsBatched(const std::vector<unsigned int>& tags,
+                         std::vector<unsigned int>& indices) const;
+
     //! Return body ids
     const GlobalArray<unsigned int>& getBodies() const
         {
@@ -867,6 +909,16 @@ class PYBIND11_EXPORT ParticleData
         return m_ghost_particles_removed_signal;
         }
 
+    //! Connects a function to be called when a writable zero-copy view is opened
+    /*! Python code may modify any per-particle quantity (including types) through such a
+        view without any other signal firing: consumers that memoize derived state
+        (e.g. filter-based group membership) must invalidate on this signal.
+    */
+    Nano::Signal<void()>& getLocalWriteSignal()
+        {
+        return m_local_write_signal;
+        }
+
 #ifdef ENABLE_MPI
     //! Connects a function to be called every time a single particle migration is requested
     Nano::Signal<void(unsigned int, unsigned int, unsigned int)>& getSingleParticleMoveSignal()
@@ -1017,6 +1069,18 @@ class PYBIND11_EXPORT ParticleData
             return *m_tag_set.rbegin();
         }
 
+    /*! Return the number of tag invalidations since construction
+
+        The counter increases monotonically whenever existing tags are removed or reassigned
+        (single-particle removal or reinitialization from a snapshot). Consumers that cache
+        per-tag state can compare it against a stored value to prove that all particles added
+        since then were pure insertions with fresh, contiguous tags.
+    */
+    uint64_t getNTagRemovals() const
+        {
+        return m_n_tag_removals;
+        }
+
     //! Get the orientation of a particle with a given tag
     Scalar4 getOrientation(unsigned int tag) const;
 
@@ -1133,6 +1197,9 @@ class PYBIND11_EXPORT ParticleData
     //! Take a snapshot
     template<class Real> void takeSnapshot(SnapshotParticleData<Real>& snapshot);
 
+    //! Copy all particle buffers rank-locally from another particle data
+    void copyParticlesFrom(const ParticleData& other);
+
     //! Add ghost particles at the end of the local particle data
     void addGhostParticles(const unsigned int nghosts);
 
@@ -1156,11 +1223,23 @@ class PYBIND11_EXPORT ParticleData
         }
 
     //! Returns the domain decomin decomposition information
-    std::shared_ptr<DomainDecomposition> getDomainDecomposition()
+    /*! Returned by const reference so that boolean queries on the hot path do not pay
+        shared_ptr reference count traffic every time step.
+    */
+    const std::shared_ptr<DomainDecomposition>& getDomainDecomposition() const
         {
         return m_decomposition;
         }
 
+    //! Check if the particle data is distributed across ranks
+    /*! A plain pointer test, suitable for per-step branches: single-rank runs pay only a
+        predictable not-taken branch for the distributed-mode code paths.
+    */
+    bool isDomainDecomposed() const
+        {
+        return bool(m_decomposition);
+        }
+
     //! Pack particle data into a buffer
     /*! \param out Buffer into which particle data is packed
      *  \param comm_flags Buffer into which communication flags is packed
@@ -1250,6 +1329,24 @@ class PYBIND11_EXPORT ParticleData
         }
 #endif
 
+    //! Mark that anisotropic per-particle quantities are in use
+    /*! Consumers of the orientation, angular momentum, or moment of inertia arrays (anisotropic
+        pair potentials, rigid bodies, HPMC integrators, etc.) call this on construction.
+    */
+    void setAnisotropicDataInUse()
+        {
+        m_aniso_data_in_use = true;
+        }
+
+    //! Check if anisotropic per-particle quantities are in use
+    /*! When false, the orientation, angular momentum, and moment of inertia arrays hold their
+        default values everywhere, and these fields may be excluded from particle migration.
+    */
+    bool isAnisotropicDataInUse() const
+        {
+        return m_aniso_data_in_use;
+        }
+
     private:
     std::shared_ptr<const BoxDim> m_box;                 //!< The simulation box
     std::shared_ptr<const BoxDim> m_global_box;          //!< Global simulation box
@@ -1269,6 +1366,8 @@ class PYBIND11_EXPORT ParticleData
                                                            //!< particles are removed
     Nano::Signal<void()> m_global_particle_num_signal; //!< Signal that is triggered when the global
                                                        //!< number of particles changes
+    Nano::Signal<void()> m_local_write_signal; //!< Signal that is triggered when a writable
+                                               //!< zero-copy view is opened
 
 #ifdef ENABLE_MPI
     Nano::Signal<void(unsigned int, unsigned int, unsigned int)>
@@ -1280,6 +1379,7 @@ class PYBIND11_EXPORT ParticleData
     unsigned int m_max_nparticles; //!< maximum number of particles
     unsigned int m_nglobal;        //!< global number of particles
     bool m_accel_set;              //!< Flag to tell if acceleration data has been set
+    bool m_aniso_data_in_use;      //!< Flag to tell if anisotropic quantities are in use
 
     // per-particle data
     GlobalArray<Scalar4> m_pos;        //!< particle positions and types
@@ -1297,7 +1397,13 @@ class PYBIND11_EXPORT ParticleData
     GlobalArray<Scalar3> m_inertia;         //!< Principal moments of inertia for each particle
     GlobalArray<unsigned int> m_comm_flags; //!< Array of communication flags
 
+    std::atomic<uint64_t> m_rtag_epoch {0}; //!< Incremented whenever the mapping may change
+    uint64_t m_rtag_snapshot_epoch = 0;     //!< Epoch at which the snapshot was last rebuilt
+    std::shared_ptr<const std::vector<unsigned int>>
+        m_rtag_snapshot; //!< Atomically published copy of m_rtag for concurrent readers
+
     std::stack<unsigned int> m_recycled_tags; //!< Global tags of removed particles
+    uint64_t m_n_tag_removals = 0;            //!< Number of tag invalidations, see getNTagRemovals
     std::set<unsigned int> m_tag_set;         //!< Lookup table for tags by active index
     std::vector<unsigned int>
         m_cached_tag_set;       //!< Cached constant-time lookup table for tags by active index
@@ -1386,17 +1492,21 @@ template<class Output>
 class PYBIND11_EXPORT LocalParticleData : public GhostLocalDataAccess<Output, ParticleData>
     {
     public:
-    LocalParticleData(ParticleData& data)
+    LocalParticleData(ParticleData& data, bool force_read_only = false)
         : GhostLocalDataAccess<Output, ParticleData>(data,
                                                      data.getN(),
                                                      data.getNGhosts(),
-                                                     data.getNGlobal()),
+                                                     data.getNGlobal(),
+                                                     force_read_only),
           m_position_handle(), m_orientation_handle(), m_velocities_handle(),
           m_angular_momentum_handle(), m_acceleration_handle(), m_inertia_handle(),
           m_charge_handle(), m_diameter_handle(), m_image_handle(), m_tag_handle(), m_rtag_handle(),
           m_rigid_body_ids_handle(), m_net_force_handle(), m_net_virial_handle(),
           m_net_torque_handle()
         {
+        // any per-particle quantity may be modified in place through this view
+        if (!force_read_only)
+            data.getLocalWriteSignal().emit();
         }
 
     virtual ~LocalParticleData() = default;
@@ -1450,6 +1560,8 @@ class PYBIND11_EXPORT LocalParticleData : public GhostLocalDataAccess<Output, Pa
 
     Output getOrientation(GhostDataFlag flag)
         {
+        // the zero-copy view may write anisotropic data that must survive migration
+        this->m_data.setAnisotropicDataInUse();
         return this->template getLocalBuffer<Scalar4, Scalar>(m_orientation_handle,
                                                               &ParticleData::getOrientationArray,
                                                               flag,
@@ -1459,6 +1571,7 @@ class PYBIND11_EXPORT LocalParticleData : public GhostLocalDataAccess<Output, Pa
 
     Output getAngularMomentum(GhostDataFlag flag)
         {
+        this->m_data.setAnisotropicDataInUse();
         return this->template getLocalBuffer<Scalar4, Scalar>(
             m_angular_momentum_handle,
             &ParticleData::getAngularMomentumArray,
@@ -1469,6 +1582,7 @@ class PYBIND11_EXPORT LocalParticleData : public GhostLocalDataAccess<Output, Pa
 
     Output getMomentsOfInertia(GhostDataFlag flag)
         {
+        this->m_data.setAnisotropicDataInUse();
         return this->template getLocalBuffer<Scalar3, Scalar>(
             m_inertia_handle,
             &ParticleData::getMomentsOfInertiaArray,
@@ -1620,7 +1734,9 @@ template<class Output> void export_LocalParticleData(pybind11::module& m, std::s
     pybind11::class_<LocalParticleData<Output>, std::shared_ptr<LocalParticleData<Output>>>(
         m,
         name.c_str())
-        .def(pybind11::init<ParticleData&>())
+        .def(pybind11::init<ParticleData&, bool>(),
+             pybind11::arg("data"),
+             pybind11::arg("force_read_only") = false)
         .def("getPosition", &LocalParticleData<Output>::getPosition)
         .def("getTypes", &LocalParticleData<Output>::getTypes)
         .def("getVelocities", &LocalParticleData<Output>::getVelocities)
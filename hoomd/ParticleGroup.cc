@@ -32,7 +32,8 @@ ParticleGroup::ParticleGroup(std::shared_ptr<SystemDefinition> sysdef,
                              std::shared_ptr<ParticleFilter> selector,
                              bool update_tags)
     : m_sysdef(sysdef), m_pdata(sysdef->getParticleData()), m_exec_conf(m_pdata->getExecConf()),
-      m_num_local_members(0), m_particles_sorted(true), m_reallocated(false),
+      m_num_local_members(0), m_is_contiguous(false), m_contiguous_start(0),
+      m_particles_sorted(true), m_reallocated(false),
       m_global_ptl_num_change(false), m_selector(selector), m_update_tags(update_tags),
       m_warning_printed(false)
     {
@@ -55,6 +56,9 @@ ParticleGroup::ParticleGroup(std::shared_ptr<SystemDefinition> sysdef,
     m_pdata->getGlobalParticleNumberChangeSignal()
         .connect<ParticleGroup, &ParticleGroup::slotGlobalParticleNumChange>(this);
 
+    // invalidate memoized filter evaluations on writable zero-copy access
+    m_pdata->getLocalWriteSignal().connect<ParticleGroup, &ParticleGroup::slotLocalWrite>(this);
+
     // update GPU memory hints
     updateGPUAdvice();
     }
@@ -67,7 +71,8 @@ ParticleGroup::ParticleGroup(std::shared_ptr<SystemDefinition> sysdef,
 ParticleGroup::ParticleGroup(std::shared_ptr<SystemDefinition> sysdef,
                              const std::vector<unsigned int>& member_tags)
     : m_sysdef(sysdef), m_pdata(sysdef->getParticleData()), m_exec_conf(m_pdata->getExecConf()),
-      m_num_local_members(0), m_particles_sorted(true), m_reallocated(false),
+      m_num_local_members(0), m_is_contiguous(false), m_contiguous_start(0),
+      m_particles_sorted(true), m_reallocated(false),
       m_global_ptl_num_change(false), m_update_tags(false), m_warning_printed(false)
     {
     // check input
@@ -153,6 +158,9 @@ ParticleGroup::ParticleGroup(std::shared_ptr<SystemDefinition> sysdef,
     m_pdata->getGlobalParticleNumberChangeSignal()
         .connect<ParticleGroup, &ParticleGroup::slotGlobalParticleNumChange>(this);
 
+    // invalidate memoized filter evaluations on writable zero-copy access
+    m_pdata->getLocalWriteSignal().connect<ParticleGroup, &ParticleGroup::slotLocalWrite>(this);
+
     // update GPU memory hints
     updateGPUAdvice();
     }
@@ -169,6 +177,8 @@ ParticleGroup::~ParticleGroup()
             .disconnect<ParticleGroup, &ParticleGroup::slotReallocate>(this);
         m_pdata->getGlobalParticleNumberChangeSignal()
             .disconnect<ParticleGroup, &ParticleGroup::slotGlobalParticleNumChange>(this);
+        m_pdata->getLocalWriteSignal().disconnect<ParticleGroup, &ParticleGroup::slotLocalWrite>(
+            this);
         }
     }
 
@@ -186,6 +196,17 @@ void ParticleGroup::updateMemberTags(bool force_update)
         m_warning_printed = true;
         }
 
+    // reuse the memoized evaluation when no particle sort, type, number change, or
+    // writable zero-copy access has occurred since the last one and the filter depends
+    // only on that state
+    if (m_selector && (m_update_tags || force_update) && !m_members_stale
+        && m_selector->isMemoizable())
+        {
+        m_pdata->getExecConf()->msg->notice(7)
+            << "ParticleGroup: reusing memoized members" << std::endl;
+        return;
+        }
+
     if (m_selector && (m_update_tags || force_update))
         {
         // notice message
@@ -236,6 +257,12 @@ void ParticleGroup::updateMemberTags(bool force_update)
         GlobalArray<unsigned int> member_idx(member_tags.size(), m_pdata->getExecConf());
         m_member_idx.swap(member_idx);
         TAG_ALLOCATION(m_member_idx);
+
+        // the member arrays now reflect the current particle data
+        m_members_stale = false;
+
+        // let consumers caching per-member data detect the membership change
+        m_member_generation++;
         }
 
     // one byte per particle to indicate membership in the group, initialize with current number of
@@ -577,6 +604,23 @@ void ParticleGroup::rebuildIndexList()
         assert(m_num_local_members <= m_member_tags.getNumElements());
         }
 
+    // The index list is built in ascending index order on both code paths, so the members
+    // occupy one contiguous range exactly when first and last entry span the member count.
+    // Cache the result; kernels use it to iterate the range directly instead of gathering
+    // through the index list.
+    m_is_contiguous = false;
+    m_contiguous_start = 0;
+    if (m_num_local_members > 0)
+        {
+        ArrayHandle<unsigned int> h_member_idx(m_member_idx,
+                                               access_location::host,
+                                               access_mode::read);
+        unsigned int first = h_member_idx.data[0];
+        unsigned int last = h_member_idx.data[m_num_local_members - 1];
+        m_is_contiguous = (last - first + 1 == m_num_local_members);
+        m_contiguous_start = first;
+        }
+
     // index has been rebuilt
     m_particles_sorted = false;
 
@@ -140,6 +140,18 @@ class PYBIND11_EXPORT ParticleGroup
         return h_member_tags.data[i];
         }
 
+    //! Get the generation counter of the member tag list
+    /*! \returns A counter that is incremented every time the member tag list is rebuilt
+
+        Membership rebuilds (e.g. by hoomd.update.FilterUpdater) do not fire a particle
+        data signal, so consumers caching per-member data compare this counter to detect
+        them.
+    */
+    uint64_t getMemberGeneration() const
+        {
+        return m_member_generation;
+        }
+
     //! Get a member index from the group
     /*! \param j Value from 0 to getNumMembers()-1 of the group member to get
         \returns Index of the member at position \a j
@@ -189,6 +201,43 @@ class PYBIND11_EXPORT ParticleGroup
         return m_member_idx;
         }
 
+    //! Direct access to the membership flags
+    /*! \returns A GPUArray with one element per particle index, == 1 if the index is a local
+       member of the group. Useful as a dense membership predicate on the GPU, avoiding the
+       gather through the index list.
+
+        \note This method CAN access the particle data tag array if the index is rebuilt.
+              Hence, the tag array may not be accessed in the same scope in which this method is
+       called.
+    */
+    const GlobalArray<unsigned int>& getMembershipArray()
+        {
+        checkRebuild();
+
+        return m_is_member;
+        }
+
+    //! Test whether the local members occupy one contiguous range of particle indices
+    /*! \returns true when the member indices are exactly [getContiguousStart(),
+       getContiguousStart() + getNumMembers()). The result is cached and recomputed whenever the
+       index list is rebuilt, i.e. after every particle sort. Kernels may then iterate the range
+       directly with coalesced reads instead of gathering through the index list.
+    */
+    bool isContiguous()
+        {
+        checkRebuild();
+
+        return m_is_contiguous;
+        }
+
+    //! Get the first particle index of the contiguous range (valid when isContiguous())
+    unsigned int getContiguousStart()
+        {
+        checkRebuild();
+
+        return m_contiguous_start;
+        }
+
 #ifdef ENABLE_HIP
     //! Return the load balancing GPU partition
     const GPUPartition& getGPUPartition()
@@ -295,10 +344,18 @@ class PYBIND11_EXPORT ParticleGroup
     mutable GlobalArray<unsigned int> m_member_idx;  //!< List of all particle indices in the group
     mutable GlobalArray<unsigned int> m_member_tags; //!< Lists the tags of the particle members
     mutable unsigned int m_num_local_members;        //!< Number of members on the local processor
+    mutable bool m_is_contiguous; //!< True if the local members occupy one contiguous index range
+    mutable unsigned int m_contiguous_start; //!< First index of the contiguous range
     mutable bool m_particles_sorted;      //!< True if particle have been sorted since last rebuild
     mutable bool m_reallocated;           //!< True if particle data arrays have been reallocated
     mutable bool m_global_ptl_num_change; //!< True if the global particle number changed
 
+    /// True when the memoized filter evaluation may be out of date
+    mutable bool m_members_stale = true;
+
+    /// Incremented every time the member tag list is rebuilt
+    uint64_t m_member_generation = 0;
+
     mutable GlobalArray<unsigned int>
         m_is_member_tag; //!< One byte per particle, == 1 if tag is a member of the group
     std::shared_ptr<ParticleFilter> m_selector; //!< The associated particle selector
@@ -363,6 +420,14 @@ class PYBIND11_EXPORT ParticleGroup
     void slotParticleSort()
         {
         m_particles_sorted = true;
+        // type changes are notified through the sort signal
+        m_members_stale = true;
+        }
+
+    //! Helper function to be called when a writable zero-copy view is opened
+    void slotLocalWrite()
+        {
+        m_members_stale = true;
         }
 
     //! Update the GPU memory advice
@@ -372,6 +437,7 @@ class PYBIND11_EXPORT ParticleGroup
     void slotGlobalParticleNumChange()
         {
         m_global_ptl_num_change = true;
+        m_members_stale = true;
         }
 
     //! Helper function to build the 1:1 hash for tag membership
@@ -19,12 +19,14 @@ PythonAnalyzer::PythonAnalyzer(std::shared_ptr<SystemDefinition> sysdef,
 void PythonAnalyzer::analyze(uint64_t timestep)
     {
     Analyzer::analyze(timestep);
-    m_analyzer.attr("act")(timestep);
+    m_act(timestep);
     }
 
 void PythonAnalyzer::setAnalyzer(pybind11::object analyzer)
     {
     m_analyzer = analyzer;
+    // look the bound method up once instead of on every triggered step
+    m_act = analyzer.attr("act");
     auto flags = PDataFlags();
     for (auto flag : analyzer.attr("flags"))
         {
@@ -29,6 +29,7 @@ class PYBIND11_EXPORT PythonAnalyzer : public Analyzer
 
     protected:
     pybind11::object m_analyzer;
+    pybind11::object m_act; //!< Cached bound act method of the analyzer
     PDataFlags m_flags;
     };
 
@@ -196,7 +196,16 @@ template<class Output, class Data> class LocalDataAccess
         "Output template parameter for LocalDataAccess must be a subclass of HOOMDBuffer.");
 
     public:
-    inline LocalDataAccess(Data& data) : m_data(data), m_in_manager(false) { }
+    /** \param data Object to expose arrays from
+        \param force_read_only When true, expose every buffer read-only and acquire the
+        underlying arrays with access_mode::read. Read acquisitions do not invalidate the
+        copy on the other device: analysis that only reads state through a read-only view
+        does not force a host-device transfer on the next simulation step.
+    */
+    inline LocalDataAccess(Data& data, bool force_read_only = false)
+        : m_data(data), m_in_manager(false), m_force_read_only(force_read_only)
+        {
+        }
 
     virtual ~LocalDataAccess() = default;
 
@@ -249,7 +258,7 @@ template<class Output, class Data> class LocalDataAccess
         {
         checkManager();
 
-        bool read_only = !bufferWriteable;
+        bool read_only = !bufferWriteable || m_force_read_only;
         updateHandle(handle, get_array_func, read_only);
 
         T* _data = handle.get()->data;
@@ -302,6 +311,8 @@ template<class Output, class Data> class LocalDataAccess
     Data& m_data;
     /// flag for being inside Python context manager
     bool m_in_manager;
+    /// when true, expose all buffers read-only and never acquire arrays for writing
+    bool m_force_read_only;
     };
 
 enum class GhostDataFlag
@@ -327,8 +338,13 @@ enum class GhostDataFlag
 template<class Output, class Data> class GhostLocalDataAccess : public LocalDataAccess<Output, Data>
     {
     public:
-    inline GhostLocalDataAccess(Data& data, size_t n, size_t n_ghosts, size_t n_global)
-        : LocalDataAccess<Output, Data>(data), m_n(n), m_n_ghosts(n_ghosts), m_n_global(n_global)
+    inline GhostLocalDataAccess(Data& data,
+                                size_t n,
+                                size_t n_ghosts,
+                                size_t n_global,
+                                bool force_read_only = false)
+        : LocalDataAccess<Output, Data>(data, force_read_only), m_n(n), m_n_ghosts(n_ghosts),
+          m_n_global(n_global)
         {
         }
 
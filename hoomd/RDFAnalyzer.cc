@@ -0,0 +1,253 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "RDFAnalyzer.h"
+
+#include <pybind11/stl.h>
+
+#include <cmath>
+#include <stdexcept>
+
+namespace hoomd
+    {
+RDFAnalyzer::RDFAnalyzer(std::shared_ptr<SystemDefinition> sysdef,
+                         std::shared_ptr<Trigger> trigger,
+                         unsigned int bins,
+                         Scalar r_max)
+    : Analyzer(sysdef, trigger), m_bins(bins), m_r_max(r_max), m_pair_norm(0.0), m_density(0.0),
+      m_n_samples(0)
+    {
+    if (m_bins == 0)
+        {
+        throw std::invalid_argument("bins must be >= 1.");
+        }
+    if (m_r_max <= Scalar(0.0))
+        {
+        throw std::invalid_argument("r_max must be positive.");
+        }
+    m_counts.assign(m_bins, 0);
+    }
+
+/*! \param timestep Current time step of the simulation
+
+    Bins the particles into a cell grid of width >= r_max and histograms the minimum-image
+    distance of every pair in adjacent cells. When the box is too small for a 3x3(x3) cell
+    sweep the sample falls back to the all-pairs double loop.
+*/
+void RDFAnalyzer::analyze(uint64_t timestep)
+    {
+    Analyzer::analyze(timestep);
+
+    SnapshotParticleData<Scalar> snapshot;
+    m_pdata->takeSnapshot(snapshot);
+
+#ifdef ENABLE_MPI
+    // the snapshot is gathered to the root rank, only accumulate there
+    if (m_sysdef->isDomainDecomposed() && !m_exec_conf->isRoot())
+        {
+        return;
+        }
+#endif
+
+    const unsigned int n_global = static_cast<unsigned int>(snapshot.size);
+    if (n_global < 2)
+        {
+        return;
+        }
+
+    const BoxDim& box = m_pdata->getGlobalBox();
+    const bool twod = (m_sysdef->getNDimensions() == 2);
+
+    const Scalar r_max_sq = m_r_max * m_r_max;
+    const double bin_width = double(m_r_max) / double(m_bins);
+
+    // size the cell grid to the analysis cutoff
+    const Scalar3 L = box.getNearestPlaneDistance();
+    uint3 dim = make_uint3(static_cast<unsigned int>(L.x / m_r_max),
+                           static_cast<unsigned int>(L.y / m_r_max),
+                           twod ? 1 : static_cast<unsigned int>(L.z / m_r_max));
+    if (dim.x == 0)
+        dim.x = 1;
+    if (dim.y == 0)
+        dim.y = 1;
+    if (dim.z == 0)
+        dim.z = 1;
+
+    auto accumulate_pair = [&](const vec3<Scalar>& pos_i, const vec3<Scalar>& pos_j)
+    {
+        Scalar3 dx = box.minImage(vec_to_scalar3(pos_i - pos_j));
+        Scalar dr_sq = dot(dx, dx);
+        if (dr_sq < r_max_sq)
+            {
+            unsigned int bin = static_cast<unsigned int>(std::sqrt(double(dr_sq)) / bin_width);
+            if (bin >= m_bins)
+                bin = m_bins - 1;
+            m_counts[bin]++;
+            }
+    };
+
+    // a 3x3(x3) sweep only visits each pair once per periodic image when there are at
+    // least three cells per direction
+    const bool use_cells = dim.x >= 3 && dim.y >= 3 && (twod || dim.z >= 3);
+
+    if (use_cells)
+        {
+        Index3D ci(dim.x, dim.y, dim.z);
+
+        // counting sort of the particles into the cells
+        std::vector<unsigned int> cell_size(ci.getNumElements(), 0);
+        std::vector<unsigned int> particle_cell(n_global);
+        for (unsigned int i = 0; i < n_global; i++)
+            {
+            Scalar3 f = box.makeFraction(vec_to_scalar3(snapshot.pos[i]));
+            int ib = std::min(static_cast<int>(f.x * dim.x), static_cast<int>(dim.x) - 1);
+            int jb = std::min(static_cast<int>(f.y * dim.y), static_cast<int>(dim.y) - 1);
+            int kb = std::min(static_cast<int>(f.z * dim.z), static_cast<int>(dim.z) - 1);
+            if (ib < 0)
+                ib = 0;
+            if (jb < 0)
+                jb = 0;
+            if (kb < 0)
+                kb = 0;
+            particle_cell[i] = ci(ib, jb, kb);
+            cell_size[particle_cell[i]]++;
+            }
+
+        std::vector<unsigned int> cell_head(ci.getNumElements());
+        unsigned int total = 0;
+        for (unsigned int cell = 0; cell < ci.getNumElements(); cell++)
+            {
+            cell_head[cell] = total;
+            total += cell_size[cell];
+            }
+        std::vector<unsigned int> cell_fill = cell_head;
+        std::vector<unsigned int> sorted_idx(n_global);
+        for (unsigned int i = 0; i < n_global; i++)
+            {
+            sorted_idx[cell_fill[particle_cell[i]]++] = i;
+            }
+
+        // sweep each particle against its own and the adjacent cells
+        for (unsigned int i = 0; i < n_global; i++)
+            {
+            const vec3<Scalar> pos_i = snapshot.pos[i];
+            const unsigned int my_cell = particle_cell[i];
+            const uint3 my_coord = ci.getTriple(my_cell);
+
+            const int kmin = twod ? 0 : -1;
+            const int kmax = twod ? 0 : 1;
+            for (int di = -1; di <= 1; di++)
+                for (int dj = -1; dj <= 1; dj++)
+                    for (int dk = kmin; dk <= kmax; dk++)
+                        {
+                        int ib = (int(my_coord.x) + di + int(dim.x)) % int(dim.x);
+                        int jb = (int(my_coord.y) + dj + int(dim.y)) % int(dim.y);
+                        int kb = (int(my_coord.z) + dk + int(dim.z)) % int(dim.z);
+                        unsigned int neigh_cell = ci(ib, jb, kb);
+
+                        const unsigned int start = cell_head[neigh_cell];
+                        const unsigned int end = start + cell_size[neigh_cell];
+                        for (unsigned int slot = start; slot < end; slot++)
+                            {
+                            unsigned int j = sorted_idx[slot];
+                            if (j == i)
+                                continue;
+                            accumulate_pair(pos_i, snapshot.pos[j]);
+                            }
+                        }
+            }
+        }
+    else
+        {
+        // small box: all-pairs double loop
+        for (unsigned int i = 0; i < n_global; i++)
+            for (unsigned int j = 0; j < n_global; j++)
+                {
+                if (j == i)
+                    continue;
+                accumulate_pair(snapshot.pos[i], snapshot.pos[j]);
+                }
+        }
+
+    const double volume = box.getVolume(twod);
+    m_pair_norm += double(n_global) * double(n_global - 1) / volume;
+    m_density += double(n_global) / volume;
+    m_n_samples++;
+    }
+
+void RDFAnalyzer::reset()
+    {
+    m_counts.assign(m_bins, 0);
+    m_pair_norm = 0.0;
+    m_density = 0.0;
+    m_n_samples = 0;
+    }
+
+std::vector<double> RDFAnalyzer::getBinCenters() const
+    {
+    const double bin_width = double(m_r_max) / double(m_bins);
+    std::vector<double> centers(m_bins);
+    for (unsigned int bin = 0; bin < m_bins; bin++)
+        {
+        centers[bin] = (double(bin) + 0.5) * bin_width;
+        }
+    return centers;
+    }
+
+std::vector<double> RDFAnalyzer::getRDF() const
+    {
+    const bool twod = (m_sysdef->getNDimensions() == 2);
+    const double bin_width = double(m_r_max) / double(m_bins);
+
+    std::vector<double> rdf(m_bins, 0.0);
+    if (m_pair_norm == 0.0)
+        {
+        return rdf;
+        }
+
+    for (unsigned int bin = 0; bin < m_bins; bin++)
+        {
+        const double r_in = double(bin) * bin_width;
+        const double r_out = r_in + bin_width;
+        double shell;
+        if (twod)
+            {
+            shell = M_PI * (r_out * r_out - r_in * r_in);
+            }
+        else
+            {
+            shell = 4.0 * M_PI / 3.0 * (r_out * r_out * r_out - r_in * r_in * r_in);
+            }
+        rdf[bin] = double(m_counts[bin]) / (m_pair_norm * shell);
+        }
+    return rdf;
+    }
+
+double RDFAnalyzer::getAverageDensity() const
+    {
+    if (m_n_samples == 0)
+        {
+        return 0.0;
+        }
+    return m_density / double(m_n_samples);
+    }
+
+namespace detail
+    {
+void export_RDFAnalyzer(pybind11::module& m)
+    {
+    pybind11::class_<RDFAnalyzer, Analyzer, std::shared_ptr<RDFAnalyzer>>(m, "RDFAnalyzer")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            unsigned int,
+                            Scalar>())
+        .def_property_readonly("bins", &RDFAnalyzer::getBins)
+        .def_property_readonly("r_max", &RDFAnalyzer::getRMax)
+        .def_property_readonly("num_samples", &RDFAnalyzer::getNumSamples)
+        .def("getBinCenters", &RDFAnalyzer::getBinCenters)
+        .def("getRDF", &RDFAnalyzer::getRDF)
+        .def("getAverageDensity", &RDFAnalyzer::getAverageDensity)
+        .def("reset", &RDFAnalyzer::reset);
+    }
+    } // namespace detail
+    } // namespace hoomd
@@ -0,0 +1,82 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+#include "Analyzer.h"
+
+namespace hoomd
+    {
+//! Accumulates the radial distribution function in-engine
+/*! RDFAnalyzer histograms all pair distances up to a cutoff each time it triggers and
+    keeps running accumulators, so g(r) (and S(k) derived from it) is available during the
+    run without dumping trajectory frames. Pairs are counted with a cell sweep over a grid
+    sized to the analysis cutoff, giving an O(N) sample cost at liquid densities.
+
+    Samples are taken from a particle data snapshot; in MPI simulations the snapshot is
+    gathered to rank 0 and the accumulators are valid on rank 0 only.
+
+    \ingroup analyzers
+*/
+class PYBIND11_EXPORT RDFAnalyzer : public Analyzer
+    {
+    public:
+    RDFAnalyzer(std::shared_ptr<SystemDefinition> sysdef,
+                std::shared_ptr<Trigger> trigger,
+                unsigned int bins,
+                Scalar r_max);
+    ~RDFAnalyzer() = default;
+
+    //! Sample the particle data and accumulate the pair histogram
+    void analyze(uint64_t timestep) override;
+
+    //! Discard all accumulated samples
+    void reset();
+
+    unsigned int getBins() const
+        {
+        return m_bins;
+        }
+
+    Scalar getRMax() const
+        {
+        return m_r_max;
+        }
+
+    uint64_t getNumSamples() const
+        {
+        return m_n_samples;
+        }
+
+    //! Get the center of each histogram bin
+    std::vector<double> getBinCenters() const;
+
+    //! Get the accumulated radial distribution function
+    std::vector<double> getRDF() const;
+
+    //! Get the number density averaged over the accumulated samples
+    double getAverageDensity() const;
+
+    protected:
+    unsigned int m_bins; //!< Number of histogram bins
+    Scalar m_r_max;      //!< Analysis cutoff
+
+    std::vector<uint64_t> m_counts; //!< Ordered pair counts per bin
+    double m_pair_norm;             //!< Accumulated N(N-1)/V over samples
+    double m_density;               //!< Accumulated N/V over samples
+    uint64_t m_n_samples;           //!< Number of accumulated samples
+    };
+
+namespace detail
+    {
+void export_RDFAnalyzer(pybind11::module& m);
+    } // namespace detail
+    } // namespace hoomd
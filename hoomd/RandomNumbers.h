@@ -234,6 +234,12 @@ class RandomGenerator
     /// Generate uniformly distributed 128-bit values
     DEVICE inline r123::Philox4x32::ctr_type operator()();
 
+    /// Generate a uniformly distributed 32-bit value
+    DEVICE inline uint32_t u32();
+
+    /// Generate a uniformly distributed 64-bit value
+    DEVICE inline uint64_t u64();
+
     /// Get the key
     DEVICE inline r123::Philox4x32::key_type getKey()
         {
@@ -247,14 +253,17 @@ class RandomGenerator
         }
 
     private:
-    r123::Philox4x32::key_type m_key; //!< RNG key
-    r123::Philox4x32::ctr_type m_ctr; //!< RNG counter
+    r123::Philox4x32::key_type m_key;   //!< RNG key
+    r123::Philox4x32::ctr_type m_ctr;   //!< RNG counter
+    r123::Philox4x32::ctr_type m_cache; //!< Unconsumed words of the last generated block
+    unsigned int m_avail;               //!< Number of unconsumed 32-bit words in m_cache
     };
 
 DEVICE inline RandomGenerator::RandomGenerator(const Seed& seed, const Counter& counter)
     {
     m_key = seed.getKey();
     m_ctr = counter.getCounter();
+    m_avail = 0;
     }
 
 /*! \returns A random uniform 128-bit unsigned integer.
@@ -269,6 +278,42 @@ DEVICE inline r123::Philox4x32::ctr_type RandomGenerator::operator()()
     return u;
     }
 
+/*! \returns A random uniform 32-bit unsigned integer.
+
+    Words are served from the most recently generated 128-bit block; a new block is generated
+    (advancing the counter) only when all cached words have been consumed. This avoids discarding
+    three quarters of the Philox output when drawing scalar values one at a time.
+ */
+DEVICE inline uint32_t RandomGenerator::u32()
+    {
+    if (m_avail == 0)
+        {
+        m_cache = (*this)();
+        m_avail = 4;
+        }
+    const uint32_t u = m_cache.v[4 - m_avail];
+    m_avail--;
+    return u;
+    }
+
+/*! \returns A random uniform 64-bit unsigned integer.
+
+    Consumes two words of the cached block, generating a new block first when fewer than two
+    unconsumed words remain.
+ */
+DEVICE inline uint64_t RandomGenerator::u64()
+    {
+    if (m_avail < 2)
+        {
+        m_cache = (*this)();
+        m_avail = 4;
+        }
+    const uint64_t hi = m_cache.v[4 - m_avail];
+    const uint64_t lo = m_cache.v[5 - m_avail];
+    m_avail -= 2;
+    return hi << 32 | lo;
+    }
+
 namespace detail
     {
 //! Generate a uniform random uint32_t
@@ -278,6 +323,12 @@ template<class RNG> DEVICE inline uint32_t generate_u32(RNG& rng)
     return u.v[0];
     }
 
+//! Generate a uniform random uint32_t, reusing cached words of the last generated block
+DEVICE inline uint32_t generate_u32(RandomGenerator& rng)
+    {
+    return rng.u32();
+    }
+
 //! Generate a uniform random uint64_t
 template<class RNG> DEVICE inline uint64_t generate_u64(RNG& rng)
     {
@@ -285,6 +336,12 @@ template<class RNG> DEVICE inline uint64_t generate_u64(RNG& rng)
     return uint64_t(u.v[0]) << 32 | u.v[1];
     }
 
+//! Generate a uniform random uint64_t, reusing cached words of the last generated block
+DEVICE inline uint64_t generate_u64(RandomGenerator& rng)
+    {
+    return rng.u64();
+    }
+
 //! Generate two uniform random uint64_t
 /*! \param out1 [out] A random uniform 64-bit unsigned integer.
     \param out2 [out] A random uniform 64-bit unsigned integer.
@@ -11,13 +11,18 @@
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <math.h>
 #include <stdexcept>
+#include <tuple>
 
 using namespace std;
 
 namespace hoomd
     {
+//! Sentinel molecule id marking particles that are not part of any molecule
+static const unsigned int SORT_NO_MOLECULE = 0xffffffff;
+
 /*! \param sysdef System to perform sorts on
  */
 SFCPackTuner::SFCPackTuner(std::shared_ptr<SystemDefinition> sysdef,
@@ -31,6 +36,7 @@ SFCPackTuner::SFCPackTuner(std::shared_ptr<SystemDefinition> sysdef,
 
     m_sort_order.resize(m_pdata->getMaxN());
     m_particle_bins.resize(m_pdata->getMaxN());
+    m_particle_types.resize(m_pdata->getMaxN());
 
     // set the default grid
     // Grid dimension must always be a power of 2 and determines the memory usage for
@@ -61,6 +67,7 @@ void SFCPackTuner::reallocate()
     {
     m_sort_order.resize(m_pdata->getMaxN());
     m_particle_bins.resize(m_pdata->getMaxN());
+    m_particle_types.resize(m_pdata->getMaxN());
     }
 
 /*! Destructor
@@ -95,11 +102,27 @@ void SFCPackTuner::update(uint64_t timestep)
         }
 #endif
 
+    // reuse the binned build of an attached cell list as the sort order when available.
+    // The GPU tuner applies its own device-resident order, so the reuse path is limited to
+    // host execution where the cell list fills the counting sort scratch arrays. Molecule
+    // grouping and type sorting re-key the particles and cannot reuse the plain
+    // per-particle order.
+    bool have_order = false;
+    if (m_cell_list && !m_exec_conf->isCUDAEnabled() && m_molecule_tags.empty()
+        && !m_sort_by_type)
+        {
+        m_cell_list->compute(timestep);
+        have_order = m_cell_list->getCurveSortedOrder(m_sort_order);
+        }
+
     // figure out the sort order we need to apply
-    if (m_sysdef->getNDimensions() == 2)
-        getSortedOrder2D();
-    else
-        getSortedOrder3D();
+    if (!have_order)
+        {
+        if (m_sysdef->getNDimensions() == 2)
+            getSortedOrder2D();
+        else
+            getSortedOrder3D();
+        }
 
     // apply that sort order to the particles
     applySortOrder();
@@ -525,9 +548,25 @@ void SFCPackTuner::getSortedOrder2D()
             unsigned int bin = ib * m_grid + jb;
 
             m_particle_bins[n] = std::pair<unsigned int, unsigned int>(bin, n);
+            if (m_sort_by_type)
+                m_particle_types[n] = __scalar_as_int(h_pos.data[n].w);
             }
         }
 
+    // keep molecule members adjacent when molecule ids are available
+    if (!m_molecule_tags.empty())
+        {
+        groupSortedOrderByMolecule();
+        return;
+        }
+
+    // order by type within each curve bin when requested
+    if (m_sort_by_type)
+        {
+        sortSortedOrderByType();
+        return;
+        }
+
     // sort the tuples
     sort(m_particle_bins.begin(), m_particle_bins.begin() + m_pdata->getN());
 
@@ -637,6 +676,22 @@ void SFCPackTuner::getSortedOrder3D()
         unsigned int bin = ib * (m_grid * m_grid) + jb * m_grid + kb;
 
         m_particle_bins[n] = std::pair<unsigned int, unsigned int>(h_traversal_order.data[bin], n);
+        if (m_sort_by_type)
+            m_particle_types[n] = __scalar_as_int(h_pos.data[n].w);
+        }
+
+    // keep molecule members adjacent when molecule ids are available
+    if (!m_molecule_tags.empty())
+        {
+        groupSortedOrderByMolecule();
+        return;
+        }
+
+    // order by type within each curve bin when requested
+    if (m_sort_by_type)
+        {
+        sortSortedOrderByType();
+        return;
         }
 
     // sort the tuples
@@ -649,6 +704,92 @@ void SFCPackTuner::getSortedOrder3D()
         }
     }
 
+/*! Replaces the plain per-particle sort of the curve keys when molecule ids have been
+    provided with setMoleculeTags(). Every member of a molecule is re-keyed to the curve
+    position of the member that appears earliest on the curve, with the molecule id and the
+    particle tag as tie breakers. A molecule therefore occupies one contiguous index range
+    ordered by tag -- the same constituent order MolecularForceCompute uses in its molecule
+    lists -- while molecules and free particles stay ordered along the curve.
+
+    \pre m_particle_bins[n] holds the curve key of particle \a n
+ */
+void SFCPackTuner::groupSortedOrderByMolecule()
+    {
+    assert(!m_molecule_tags.empty());
+
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+
+    // find the earliest curve position among the members of each molecule
+    std::map<unsigned int, unsigned int> min_bin_by_molecule;
+    for (unsigned int n = 0; n < m_pdata->getN(); n++)
+        {
+        unsigned int tag = h_tag.data[n];
+        unsigned int mol_tag
+            = tag < m_molecule_tags.size() ? m_molecule_tags[tag] : SORT_NO_MOLECULE;
+        if (mol_tag == SORT_NO_MOLECULE)
+            continue;
+
+        auto it = min_bin_by_molecule.find(mol_tag);
+        if (it == min_bin_by_molecule.end() || m_particle_bins[n].first < it->second)
+            min_bin_by_molecule[mol_tag] = m_particle_bins[n].first;
+        }
+
+    // sort by (molecule curve position, molecule id, particle tag); free particles keep
+    // their own curve position and sort behind the molecules that share it
+    std::vector<std::tuple<unsigned int, unsigned int, unsigned int, unsigned int>> keys(
+        m_pdata->getN());
+    for (unsigned int n = 0; n < m_pdata->getN(); n++)
+        {
+        unsigned int tag = h_tag.data[n];
+        unsigned int mol_tag
+            = tag < m_molecule_tags.size() ? m_molecule_tags[tag] : SORT_NO_MOLECULE;
+        unsigned int bin = m_particle_bins[n].first;
+        if (mol_tag != SORT_NO_MOLECULE)
+            bin = min_bin_by_molecule[mol_tag];
+        keys[n] = std::make_tuple(bin, mol_tag, tag, n);
+        }
+    sort(keys.begin(), keys.end());
+
+    // translate the sorted order
+    for (unsigned int j = 0; j < m_pdata->getN(); j++)
+        {
+        m_sort_order[j] = std::get<3>(keys[j]);
+        }
+    }
+
+/*! Replaces the plain per-particle sort of the curve keys when setSortByType() has enabled
+    type sorting. Particles sort by (curve bin, type id, index), so each bin becomes a short
+    run of each type it contains. In systems where the types are spatially segregated this
+    produces long contiguous type runs, keeping the pair parameter reads of neighboring
+    threads on the same cache lines, while the bin order -- and with it the spatial
+    locality of the curve -- is untouched.
+
+    \pre m_particle_bins[n] holds the curve key and m_particle_types[n] the type of particle
+    \a n
+ */
+void SFCPackTuner::sortSortedOrderByType()
+    {
+    sort(m_particle_bins.begin(),
+         m_particle_bins.begin() + m_pdata->getN(),
+         [this](const std::pair<unsigned int, unsigned int>& a,
+                const std::pair<unsigned int, unsigned int>& b)
+         {
+             if (a.first != b.first)
+                 return a.first < b.first;
+             const unsigned int type_a = m_particle_types[a.second];
+             const unsigned int type_b = m_particle_types[b.second];
+             if (type_a != type_b)
+                 return type_a < type_b;
+             return a.second < b.second;
+         });
+
+    // translate the sorted order
+    for (unsigned int j = 0; j < m_pdata->getN(); j++)
+        {
+        m_sort_order[j] = m_particle_bins[j].second;
+        }
+    }
+
 void SFCPackTuner::writeTraversalOrder(const std::string& fname,
                                        const vector<unsigned int>& reverse_order)
     {
@@ -689,7 +830,10 @@ void export_SFCPackTuner(pybind11::module& m)
     {
     pybind11::class_<SFCPackTuner, Tuner, std::shared_ptr<SFCPackTuner>>(m, "SFCPackTuner")
         .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<Trigger>>())
-        .def_property("grid", &SFCPackTuner::getGrid, &SFCPackTuner::setGridPython);
+        .def_property("grid", &SFCPackTuner::getGrid, &SFCPackTuner::setGridPython)
+        .def("setCellList", &SFCPackTuner::setCellList)
+        .def("setMoleculeTags", &SFCPackTuner::setMoleculeTags)
+        .def("setSortByType", &SFCPackTuner::setSortByType);
     }
 
     } // end namespace detail
@@ -9,11 +9,13 @@
 #error This header cannot be compiled by nvcc
 #endif
 
+#include "CellList.h"
 #include "GPUVector.h"
 #include "Tuner.h"
 
 #include <memory>
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 #include <utility>
 #include <vector>
 
@@ -80,12 +82,69 @@ class PYBIND11_EXPORT SFCPackTuner : public Tuner
         return m_grid;
         }
 
+    //! Attach a cell list whose binned build supplies the sort order
+    /*! When set, the tuner reuses the cell-sorted particle indices produced as a byproduct
+        of the cell list's host build, walked in curve order of the cells, instead of running
+        its own binning and sorting pass. The standalone pass remains the fallback when the
+        cell list cannot provide an ordering (e.g. GPU builds).
+    */
+    void setCellList(std::shared_ptr<CellList> cl)
+        {
+        m_cell_list = cl;
+        }
+
+    //! Set per-tag molecule ids to keep molecule members contiguous in memory
+    /*! \param molecule_tag Molecule id for every particle tag (0xffffffff for free particles)
+
+        When set, particles that share a molecule id are kept adjacent in the generated sort
+        order. Each molecule is placed on the curve at the position of its member that appears
+        earliest, so the spatial locality of the curve is preserved while rigid body and
+        constraint kernels read their constituents from contiguous indices. Pass an empty
+        list to restore the plain per-particle curve order.
+    */
+    void setMoleculeTags(const std::vector<unsigned int>& molecule_tag)
+        {
+        m_molecule_tags = molecule_tag;
+        }
+
+    //! Order particles by type within each curve bin
+    /*! \param sort_by_type When true, particles in the same grid bin sort by type id
+
+        Systems whose types are spatially segregated spend most pair interactions between
+        particles of the same type. Sorting by type within each bin turns those regions
+        into long runs of a single type, so neighboring threads read the same pair
+        parameters and type-dependent branches stay coherent. The spatial locality of
+        the curve is unchanged because particles only reorder within their own bin.
+    */
+    void setSortByType(bool sort_by_type)
+        {
+        m_sort_by_type = sort_by_type;
+        }
+
+    bool getSortByType()
+        {
+        return m_sort_by_type;
+        }
+
     protected:
+    std::shared_ptr<CellList> m_cell_list; //!< Optional source of a pre-binned sort order
     unsigned int m_grid;                      //!< Grid dimension to use
     unsigned int m_last_grid;                 //!< The last value of MMax
     unsigned int m_last_dim;                  //!< Check the last dimension we ran at
     GPUArray<unsigned int> m_traversal_order; //!< Generated traversal order of bins
 
+    /// Molecule id per particle tag, empty when molecules are not grouped
+    std::vector<unsigned int> m_molecule_tags;
+
+    /// When true, order particles by type within each curve bin
+    bool m_sort_by_type = false;
+
+    /// Type id per particle index, filled during binning when sorting by type
+    std::vector<unsigned int> m_particle_types;
+
+    /// Generated sort order of the particles
+    std::vector<unsigned int> m_sort_order;
+
     //! Helper function that actually performs the sort
     virtual void getSortedOrder2D();
     //! Helper function that actually performs the sort
@@ -111,7 +170,12 @@ class PYBIND11_EXPORT SFCPackTuner : public Tuner
     virtual void reallocate();
 
     private:
-    std::vector<unsigned int> m_sort_order; //!< Generated sort order of the particles
+    //! Re-key the binned particles so that molecule members sort into contiguous indices
+    void groupSortedOrderByMolecule();
+
+    //! Sort the binned particles by type within each bin
+    void sortSortedOrderByType();
+
     std::vector<std::pair<unsigned int, unsigned int>> m_particle_bins; //!< Binned particles
     std::shared_ptr<Trigger> m_trigger;
 
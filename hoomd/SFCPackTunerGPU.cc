@@ -45,6 +45,9 @@ SFCPackTunerGPU::SFCPackTunerGPU(std::shared_ptr<SystemDefinition> sysdef,
  */
 void SFCPackTunerGPU::reallocate()
     {
+    // keep the host arrays sized as well, the molecule grouping fallback uses them
+    SFCPackTuner::reallocate();
+
     m_gpu_sort_order.resize(m_pdata->getMaxN());
     m_gpu_particle_bins.resize(m_pdata->getMaxN());
     }
@@ -68,6 +71,24 @@ void SFCPackTunerGPU::getSortedOrder3D()
     assert(m_pdata);
     assert(m_gpu_sort_order.getNumElements() >= m_pdata->getN());
 
+    // molecule grouping and type sorting re-key the particles with host-side tables, so fall
+    // back to the host sort and upload the result; the sort only runs every few hundred steps
+    if (!m_molecule_tags.empty() || m_sort_by_type)
+        {
+        if (m_sysdef->getNDimensions() == 2)
+            SFCPackTuner::getSortedOrder2D();
+        else
+            SFCPackTuner::getSortedOrder3D();
+
+        ArrayHandle<unsigned int> h_gpu_sort_order(m_gpu_sort_order,
+                                                   access_location::host,
+                                                   access_mode::overwrite);
+        std::copy(m_sort_order.begin(),
+                  m_sort_order.begin() + m_pdata->getN(),
+                  h_gpu_sort_order.data);
+        return;
+        }
+
     // make even bin dimensions
     const BoxDim& box = m_pdata->getBox();
 
@@ -6,8 +6,16 @@
  */
 
 #include "SnapshotSystemData.h"
+#include "RNGIdentifiers.h"
+#include "RandomNumbers.h"
+#include <algorithm>
 #include <pybind11/pybind11.h>
 
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 namespace hoomd
     {
 template<class Real>
@@ -74,6 +82,157 @@ template<class Real> void SnapshotSystemData<Real>::wrap()
 #endif
     }
 
+template<class Real>
+void SnapshotSystemData<Real>::fillLattice(unsigned int nx, unsigned int ny, unsigned int nz)
+    {
+    if (nx == 0 || ny == 0 || nz == 0)
+        throw std::runtime_error("All lattice dimensions must be nonzero.");
+    if (dimensions == 2 && nz != 1)
+        throw std::runtime_error("nz must be 1 in 2D snapshots.");
+
+    const BoxDim box = *global_box;
+    particle_data.resize(nx * ny * nz);
+    if (particle_data.type_mapping.empty())
+        particle_data.type_mapping.push_back("A");
+
+    // place one particle at the center of each unit cell
+    auto place_particle = [&](unsigned int idx)
+    {
+        const unsigned int iz = idx % nz;
+        const unsigned int iy = (idx / nz) % ny;
+        const unsigned int ix = idx / (nz * ny);
+
+        Scalar3 f;
+        f.x = ((Scalar)ix + Scalar(0.5)) / (Scalar)nx;
+        f.y = ((Scalar)iy + Scalar(0.5)) / (Scalar)ny;
+        f.z = (dimensions == 2) ? Scalar(0.5) : ((Scalar)iz + Scalar(0.5)) / (Scalar)nz;
+
+        particle_data.pos[idx] = vec3<Real>(box.makeCoordinates(f));
+    };
+
+#ifdef ENABLE_TBB
+    // each particle writes only its own row, so the fill runs in parallel; snapshots carry no
+    // execution configuration, so the default arena is used
+    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, particle_data.size),
+                      [&](const tbb::blocked_range<unsigned int>& r)
+                      {
+                          for (unsigned int idx = r.begin(); idx != r.end(); ++idx)
+                              place_particle(idx);
+                      });
+#else
+    for (unsigned int idx = 0; idx < particle_data.size; ++idx)
+        place_particle(idx);
+#endif
+    }
+
+template<class Real>
+void SnapshotSystemData<Real>::fillRandom(unsigned int N, Real min_dist, uint16_t seed)
+    {
+    const BoxDim box = *global_box;
+    const Scalar3 npd = box.getNearestPlaneDistance();
+
+    if (min_dist > Real(0.0))
+        {
+        Scalar npd_min = (npd.x < npd.y) ? npd.x : npd.y;
+        if (dimensions == 3)
+            npd_min = (npd_min < npd.z) ? npd_min : npd.z;
+        if (Scalar(min_dist) > npd_min / Scalar(2.0))
+            throw std::runtime_error("min_dist too large for the box.");
+        }
+
+    particle_data.resize(N);
+    if (particle_data.type_mapping.empty())
+        particle_data.type_mapping.push_back("A");
+
+    // bin placed particles on a temporary cell grid with cells at least min_dist wide, so only
+    // the neighboring cells need to be searched when testing a candidate position
+    unsigned int ncx = 1, ncy = 1, ncz = 1;
+    if (min_dist > Real(0.0))
+        {
+        ncx = std::max(1u, (unsigned int)(npd.x / Scalar(min_dist)));
+        ncy = std::max(1u, (unsigned int)(npd.y / Scalar(min_dist)));
+        if (dimensions == 3)
+            ncz = std::max(1u, (unsigned int)(npd.z / Scalar(min_dist)));
+        }
+    std::vector<std::vector<unsigned int>> cells(size_t(ncx) * ncy * ncz);
+
+    // unique wrapped neighbor offsets per axis (collapses to fewer than three with few cells)
+    auto neighbor_bins = [](unsigned int bin, unsigned int nbins)
+    {
+        std::vector<unsigned int> result;
+        for (int offset = -1; offset <= 1; offset++)
+            {
+            const unsigned int neighbor = (unsigned int)((int)(bin + nbins) + offset) % nbins;
+            if (std::find(result.begin(), result.end(), neighbor) == result.end())
+                result.push_back(neighbor);
+            }
+        return result;
+    };
+
+    auto bin_index = [&](const Scalar3& f, unsigned int& bx, unsigned int& by, unsigned int& bz)
+    {
+        bx = std::min(ncx - 1, (unsigned int)(f.x * (Scalar)ncx));
+        by = std::min(ncy - 1, (unsigned int)(f.y * (Scalar)ncy));
+        bz = std::min(ncz - 1, (unsigned int)(f.z * (Scalar)ncz));
+    };
+
+    const Real min_dist_sq = min_dist * min_dist;
+    const unsigned int max_attempts = 1000;
+
+    for (unsigned int i = 0; i < N; i++)
+        {
+        bool placed = false;
+        for (unsigned int attempt = 0; attempt < max_attempts && !placed; attempt++)
+            {
+            RandomGenerator rng(Seed(RNGIdentifier::SnapshotFill, 0, seed), Counter(i, attempt));
+            UniformDistribution<Scalar> u01(Scalar(0.0), Scalar(1.0));
+
+            Scalar3 f;
+            f.x = u01(rng);
+            f.y = u01(rng);
+            f.z = (dimensions == 2) ? Scalar(0.5) : u01(rng);
+
+            const vec3<Real> pos = vec3<Real>(box.makeCoordinates(f));
+
+            unsigned int bx, by, bz;
+            bin_index(f, bx, by, bz);
+
+            // reject the candidate if any particle in the neighboring cells is too close
+            bool overlap = false;
+            if (min_dist > Real(0.0))
+                {
+                const auto bins_x = neighbor_bins(bx, ncx);
+                const auto bins_y = neighbor_bins(by, ncy);
+                const auto bins_z = neighbor_bins(bz, ncz);
+                for (unsigned int cx : bins_x)
+                    for (unsigned int cy : bins_y)
+                        for (unsigned int cz : bins_z)
+                            for (unsigned int j : cells[(size_t(cx) * ncy + cy) * ncz + cz])
+                                {
+                                const vec3<Real> dx = vec3<Real>(
+                                    box.minImage(vec3<Scalar>(pos - particle_data.pos[j])));
+                                if (dot(dx, dx) < min_dist_sq)
+                                    overlap = true;
+                                }
+                }
+
+            if (!overlap)
+                {
+                particle_data.pos[i] = pos;
+                cells[(size_t(bx) * ncy + by) * ncz + bz].push_back(i);
+                placed = true;
+                }
+            }
+
+        if (!placed)
+            {
+            throw std::runtime_error("Unable to place particle " + std::to_string(i)
+                                     + " after " + std::to_string(max_attempts)
+                                     + " attempts. Lower the density or min_dist.");
+            }
+        }
+    }
+
 template<class Real>
 void SnapshotSystemData<Real>::broadcast_box(std::shared_ptr<MPIConfiguration> mpi_conf)
     {
@@ -162,6 +321,8 @@ void export_SnapshotSystemData(pybind11::module& m)
 #endif
         .def("replicate", &SnapshotSystemData<float>::replicate)
         .def("wrap", &SnapshotSystemData<float>::wrap)
+        .def("fillLattice", &SnapshotSystemData<float>::fillLattice)
+        .def("fillRandom", &SnapshotSystemData<float>::fillRandom)
         .def("_broadcast_box", &SnapshotSystemData<float>::broadcast_box)
         .def("_broadcast", &SnapshotSystemData<float>::broadcast)
         .def("_broadcast_all", &SnapshotSystemData<float>::broadcast_all);
@@ -184,6 +345,8 @@ void export_SnapshotSystemData(pybind11::module& m)
 #endif
         .def("replicate", &SnapshotSystemData<double>::replicate)
         .def("wrap", &SnapshotSystemData<double>::wrap)
+        .def("fillLattice", &SnapshotSystemData<double>::fillLattice)
+        .def("fillRandom", &SnapshotSystemData<double>::fillRandom)
         .def("_broadcast_box", &SnapshotSystemData<double>::broadcast_box)
         .def("_broadcast", &SnapshotSystemData<double>::broadcast)
         .def("_broadcast_all", &SnapshotSystemData<double>::broadcast_all);
@@ -71,6 +71,27 @@ template<class Real> struct SnapshotSystemData
     //! the number of wrapped images.
     void wrap();
 
+    // Fill the snapshot with particles on a simple cubic lattice
+    /*! \param nx Number of unit cells along the x direction
+     *  \param ny Number of unit cells along the y direction
+     *  \param nz Number of unit cells along the z direction
+
+        Replaces the particle data with nx*ny*nz particles of type id 0, one at the center of
+        each unit cell of a grid spanning the current global box.
+    */
+    void fillLattice(unsigned int nx, unsigned int ny, unsigned int nz);
+
+    // Fill the snapshot with randomly placed particles
+    /*! \param N Number of particles to place
+     *  \param min_dist Minimum allowed distance between any two particles
+     *  \param seed Random number seed
+
+        Replaces the particle data with N particles of type id 0 placed uniformly at random in
+        the current global box. Candidate positions closer than min_dist to an already placed
+        particle are rejected using a temporary cell grid.
+    */
+    void fillRandom(unsigned int N, Real min_dist, uint16_t seed);
+
     // Broadcast information from rank 0 to all ranks
     /*! \param mpi_conf The MPI configuration
         Broadcasts the box and other metadata. Large particle data arrays are left on rank 0.
@@ -75,6 +75,17 @@ void System::setCommunicator(std::shared_ptr<Communicator> comm)
     }
 #endif
 
+double System::getCommunicationTime()
+    {
+#ifdef ENABLE_MPI
+    if (m_comm)
+        {
+        return m_comm->getCommunicateTime();
+        }
+#endif
+    return 0.0;
+    }
+
 // -------------- Methods for running the simulation
 
 void System::run(uint64_t nsteps, bool write_at_start)
@@ -112,6 +123,12 @@ void System::run(uint64_t nsteps, bool write_at_start)
         m_integrator->prepRun(m_cur_tstep);
         }
 
+    // schedule every operation as due now; from here on the triggers report when they are
+    // next due and idle operations are not touched
+    m_analyzer_schedule.reset(m_analyzers.size(), m_cur_tstep);
+    m_updater_schedule.reset(m_updaters.size(), m_cur_tstep);
+    m_tuner_schedule.reset(m_tuners.size(), m_cur_tstep);
+
     // preset the flags before the run loop so that any analyzers/updaters run on step 0 have the
     // info they need but set the flags before prepRun, as prepRun may remove some flags that it
     // cannot generate on the first step
@@ -120,31 +137,41 @@ void System::run(uint64_t nsteps, bool write_at_start)
     // execute analyzers on initial step if requested
     if (write_at_start)
         {
-        for (auto& analyzer : m_analyzers)
-            {
-            if ((*analyzer->getTrigger())(m_cur_tstep))
-                analyzer->analyze(m_cur_tstep);
-            }
+        m_analyzer_schedule.advance(m_cur_tstep,
+                                    [&](size_t i)
+                                    {
+                                        auto& analyzer = m_analyzers[i];
+                                        if ((*analyzer->getTrigger())(m_cur_tstep))
+                                            analyzer->analyze(m_cur_tstep);
+                                        return analyzer->getTrigger()->nextStep(m_cur_tstep + 1);
+                                    });
         }
 
     // run the steps
     for (uint64_t count = 0; count < nsteps; count++)
         {
-        for (auto& tuner : m_tuners)
-            {
-            if ((*tuner->getTrigger())(m_cur_tstep))
-                tuner->update(m_cur_tstep);
-            }
+        m_tuner_schedule.advance(m_cur_tstep,
+                                 [&](size_t i)
+                                 {
+                                     auto& tuner = m_tuners[i];
+                                     if ((*tuner->getTrigger())(m_cur_tstep))
+                                         tuner->update(m_cur_tstep);
+                                     return tuner->getTrigger()->nextStep(m_cur_tstep + 1);
+                                 });
 
         // execute updaters
-        for (auto& updater : m_updaters)
+        m_updater_schedule.advance(
+            m_cur_tstep,
+            [&](size_t i)
             {
-            if ((*updater->getTrigger())(m_cur_tstep))
-                {
-                updater->update(m_cur_tstep);
-                m_update_group_dof_next_step |= updater->mayChangeDegreesOfFreedom(m_cur_tstep);
-                }
-            }
+                auto& updater = m_updaters[i];
+                if ((*updater->getTrigger())(m_cur_tstep))
+                    {
+                    updater->update(m_cur_tstep);
+                    m_update_group_dof_next_step |= updater->mayChangeDegreesOfFreedom(m_cur_tstep);
+                    }
+                return updater->getTrigger()->nextStep(m_cur_tstep + 1);
+            });
 
         if (m_update_group_dof_next_step)
             {
@@ -159,16 +186,23 @@ void System::run(uint64_t nsteps, bool write_at_start)
 
         // execute the integrator
         if (m_integrator)
+            {
+            int64_t start = m_clk.getTime();
             m_integrator->update(m_cur_tstep);
+            m_integrator_time += m_clk.getTime() - start;
+            }
 
         m_cur_tstep++;
 
         // execute analyzers after incrementing the step counter
-        for (auto& analyzer : m_analyzers)
-            {
-            if ((*analyzer->getTrigger())(m_cur_tstep))
-                analyzer->analyze(m_cur_tstep);
-            }
+        m_analyzer_schedule.advance(m_cur_tstep,
+                                    [&](size_t i)
+                                    {
+                                        auto& analyzer = m_analyzers[i];
+                                        if ((*analyzer->getTrigger())(m_cur_tstep))
+                                            analyzer->analyze(m_cur_tstep);
+                                        return analyzer->getTrigger()->nextStep(m_cur_tstep + 1);
+                                    });
 
         updateTPS();
 
@@ -211,7 +245,8 @@ void System::resetStats()
 /*! \param tstep Time step for which to determine the flags
 
     The flags needed are determined by peeking to \a tstep and then using bitwise or to combine all
-   of the flags from the analyzers and updaters that are to be executed on that step.
+   of the flags from the analyzers and updaters that are to be executed on that step. Only the
+   operations scheduled as due at \a tstep are consulted; their triggers make the final decision.
 */
 PDataFlags System::determineFlags(uint64_t tstep)
     {
@@ -219,22 +254,22 @@ PDataFlags System::determineFlags(uint64_t tstep)
     if (m_integrator)
         flags |= m_integrator->getRequestedPDataFlags();
 
-    for (auto& analyzer : m_analyzers)
+    for (size_t i : m_analyzer_schedule.peekDue(tstep))
         {
-        if ((*analyzer->getTrigger())(tstep))
-            flags |= analyzer->getRequestedPDataFlags();
+        if ((*m_analyzers[i]->getTrigger())(tstep))
+            flags |= m_analyzers[i]->getRequestedPDataFlags();
         }
 
-    for (auto& updater : m_updaters)
+    for (size_t i : m_updater_schedule.peekDue(tstep))
         {
-        if ((*updater->getTrigger())(tstep))
-            flags |= updater->getRequestedPDataFlags();
+        if ((*m_updaters[i]->getTrigger())(tstep))
+            flags |= m_updaters[i]->getRequestedPDataFlags();
         }
 
-    for (auto& tuner : m_tuners)
+    for (size_t i : m_tuner_schedule.peekDue(tstep))
         {
-        if ((*tuner->getTrigger())(tstep))
-            flags |= tuner->getRequestedPDataFlags();
+        if ((*m_tuners[i]->getTrigger())(tstep))
+            flags |= m_tuners[i]->getRequestedPDataFlags();
         }
 
     return flags;
@@ -280,6 +315,8 @@ void export_System(pybind11::module& m)
         .def("setPressureFlag", &System::setPressureFlag)
         .def("getPressureFlag", &System::getPressureFlag)
         .def_property_readonly("walltime", &System::getCurrentWalltime)
+        .def_property_readonly("integrator_time", &System::getIntegratorTime)
+        .def_property_readonly("communication_time", &System::getCommunicationTime)
         .def_property_readonly("final_timestep", &System::getEndStep)
         .def_property_readonly("initial_timestep", &System::getStartStep)
         .def_property_readonly("analyzers", &System::getAnalyzers)
@@ -7,8 +7,10 @@
 #include "Tuner.h"
 #include "Updater.h"
 
+#include <algorithm>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #ifndef __SYSTEM_H__
@@ -130,6 +132,16 @@ class PYBIND11_EXPORT System
         return m_end_tstep;
         }
 
+    /// Get the wall time spent in Integrator::update() since creation, in seconds
+    double getIntegratorTime()
+        {
+        return double(m_integrator_time) / 1e9;
+        }
+
+    /// Get the wall time the communicator spent communicating since creation, in seconds
+    /*! Returns 0 when the simulation is not domain decomposed. */
+    double getCommunicationTime();
+
     /// Get the end time step
     uint64_t getStartStep()
         {
@@ -192,6 +204,85 @@ class PYBIND11_EXPORT System
     /// Update the number of degrees of freedom in cached groups
     void updateGroupDOF();
 
+    //! Min-heap schedule of the steps at which triggered operations are next due
+    /*! Entries pair the earliest step an operation may fire (reported by Trigger::nextStep())
+        with its index in the operation list. Triggers that do not implement nextStep() report
+        the current step and are polled every step, preserving their behavior. The trigger
+        itself still decides whether an operation fires; the schedule only skips operations
+        that cannot be due.
+     */
+    class TriggerSchedule
+        {
+        public:
+        //! Schedule all of \a n operations as due at \a tstep
+        void reset(size_t n, uint64_t tstep)
+            {
+            m_heap.resize(n);
+            for (size_t i = 0; i < n; i++)
+                m_heap[i] = std::make_pair(tstep, i);
+            m_due.reserve(n);
+            }
+
+        //! Collect the indices of all operations that may be due at \a tstep
+        /*! Entries remain scheduled at \a tstep until advance() moves them past it, so flags
+            may be peeked ahead of the step on which the operations execute.
+         */
+        const std::vector<size_t>& peekDue(uint64_t tstep)
+            {
+            popDue(tstep);
+            for (size_t i : m_due)
+                {
+                m_heap.push_back(std::make_pair(tstep, i));
+                std::push_heap(m_heap.begin(), m_heap.end(), later);
+                }
+            return m_due;
+            }
+
+        //! Execute and reschedule all operations due at \a tstep
+        /*! Calls \a visit(i) for every due operation, which evaluates the trigger (and fires
+            the operation when it is active) and returns the step the operation is next due.
+         */
+        template<class Visitor> void advance(uint64_t tstep, Visitor&& visit)
+            {
+            popDue(tstep);
+            for (size_t i : m_due)
+                {
+                uint64_t next = visit(i);
+                if (next <= tstep)
+                    next = tstep + 1;
+                m_heap.push_back(std::make_pair(next, i));
+                std::push_heap(m_heap.begin(), m_heap.end(), later);
+                }
+            }
+
+        private:
+        //! Min-heap ordering on the due step
+        static bool later(const std::pair<uint64_t, size_t>& a,
+                          const std::pair<uint64_t, size_t>& b)
+            {
+            return a.first > b.first;
+            }
+
+        //! Pop every entry due at or before \a tstep into m_due
+        void popDue(uint64_t tstep)
+            {
+            m_due.clear();
+            while (!m_heap.empty() && m_heap.front().first <= tstep)
+                {
+                std::pop_heap(m_heap.begin(), m_heap.end(), later);
+                m_due.push_back(m_heap.back().second);
+                m_heap.pop_back();
+                }
+
+            // the heap pops entries sharing a due step in arbitrary order; operations that
+            // fire on the same step must run in list order, as they always have
+            std::sort(m_due.begin(), m_due.end());
+            }
+
+        std::vector<std::pair<uint64_t, size_t>> m_heap; //!< Heap of (due step, index) pairs
+        std::vector<size_t> m_due;                       //!< Indices collected by popDue()
+        };
+
     std::vector<std::shared_ptr<Analyzer>>
         m_analyzers; //!< List of analyzers belonging to this System
 
@@ -201,6 +292,10 @@ class PYBIND11_EXPORT System
 
     std::vector<std::shared_ptr<Compute>> m_computes; //!< list of Computes belonging to this System
 
+    TriggerSchedule m_analyzer_schedule; //!< Steps at which the analyzers are next due
+    TriggerSchedule m_updater_schedule;  //!< Steps at which the updaters are next due
+    TriggerSchedule m_tuner_schedule;    //!< Steps at which the tuners are next due
+
     std::shared_ptr<Integrator> m_integrator;   //!< Integrator that advances time in this System
     std::shared_ptr<SystemDefinition> m_sysdef; //!< SystemDefinition for this System
 
@@ -215,6 +310,9 @@ class PYBIND11_EXPORT System
 
     ClockSource m_clk; //!< A clock counting time from the beginning of the run
 
+    /// Total wall time spent in Integrator::update(), in nanoseconds
+    int64_t m_integrator_time = 0;
+
     /// Particle data flags to always set
     PDataFlags m_default_flags;
 
@@ -7,6 +7,7 @@
 
 #include "SystemDefinition.h"
 
+#include "MetricRegistry.h"
 #include "SnapshotSystemData.h"
 
 #ifdef ENABLE_MPI
@@ -235,6 +236,76 @@ void SystemDefinition::initializeFromSnapshot(std::shared_ptr<SnapshotSystemData
 #endif
     }
 
+/*! \param exec_conf Execution configuration the copy lives on (typically the same device)
+    \returns A new system definition holding a copy of the current state
+
+    Duplicates the system for replica spawning without going through a global snapshot: the
+    particle buffers are copied rank-locally and the (comparatively small) topology data are
+    transferred through their snapshot path. The copy uses the same domain decomposition, so
+    it can be driven by a communicator right away.
+*/
+std::shared_ptr<SystemDefinition>
+SystemDefinition::fastClone(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+#ifdef BUILD_MPCD
+    if (m_mpcd_data)
+        {
+        throw runtime_error("Cannot fast-clone a system with MPCD particle data.");
+        }
+#endif
+
+    std::shared_ptr<SystemDefinition> clone(new SystemDefinition());
+    clone->m_n_dimensions = m_n_dimensions;
+    clone->m_seed = m_seed;
+
+    // allocate a particle data of matching extent and copy the buffers directly
+    clone->m_particle_data = std::make_shared<ParticleData>(
+        m_particle_data->getNGlobal(),
+        std::make_shared<const BoxDim>(m_particle_data->getGlobalBox()),
+        m_particle_data->getNTypes(),
+        exec_conf,
+        m_particle_data->getDomainDecomposition());
+    clone->m_particle_data->copyParticlesFrom(*m_particle_data);
+
+    BondData::Snapshot bond_snap;
+    m_bond_data->takeSnapshot(bond_snap);
+    clone->m_bond_data = std::make_shared<BondData>(clone->m_particle_data, bond_snap);
+
+    AngleData::Snapshot angle_snap;
+    m_angle_data->takeSnapshot(angle_snap);
+    clone->m_angle_data = std::make_shared<AngleData>(clone->m_particle_data, angle_snap);
+
+    DihedralData::Snapshot dihedral_snap;
+    m_dihedral_data->takeSnapshot(dihedral_snap);
+    clone->m_dihedral_data = std::make_shared<DihedralData>(clone->m_particle_data, dihedral_snap);
+
+    ImproperData::Snapshot improper_snap;
+    m_improper_data->takeSnapshot(improper_snap);
+    clone->m_improper_data = std::make_shared<ImproperData>(clone->m_particle_data, improper_snap);
+
+    ConstraintData::Snapshot constraint_snap;
+    m_constraint_data->takeSnapshot(constraint_snap);
+    clone->m_constraint_data
+        = std::make_shared<ConstraintData>(clone->m_particle_data, constraint_snap);
+
+    PairData::Snapshot pair_snap;
+    m_pair_data->takeSnapshot(pair_snap);
+    clone->m_pair_data = std::make_shared<PairData>(clone->m_particle_data, pair_snap);
+
+    return clone;
+    }
+
+/*! The registry is created lazily so that systems that never publish metrics pay nothing.
+ */
+std::shared_ptr<MetricRegistry> SystemDefinition::getMetricRegistry()
+    {
+    if (!m_metric_registry)
+        {
+        m_metric_registry = std::make_shared<MetricRegistry>();
+        }
+    return m_metric_registry;
+    }
+
 // instantiate both float and double methods
 template SystemDefinition::SystemDefinition(std::shared_ptr<SnapshotSystemData<float>> snapshot,
                                             std::shared_ptr<ExecutionConfiguration> exec_conf,
@@ -283,6 +354,7 @@ void export_SystemDefinition(pybind11::module& m)
                             std::shared_ptr<DomainDecomposition>>())
         .def(pybind11::init<std::shared_ptr<SnapshotSystemData<double>>,
                             std::shared_ptr<ExecutionConfiguration>>())
+        .def("fastClone", &SystemDefinition::fastClone)
         .def("setNDimensions", &SystemDefinition::setNDimensions)
         .def("getNDimensions", &SystemDefinition::getNDimensions)
         .def("getParticleData", &SystemDefinition::getParticleData)
@@ -301,6 +373,7 @@ void export_SystemDefinition(pybind11::module& m)
         .def("initializeFromSnapshot", &SystemDefinition::initializeFromSnapshot<double>)
         .def("getSeed", &SystemDefinition::getSeed)
         .def("setSeed", &SystemDefinition::setSeed)
+        .def("getMetricRegistry", &SystemDefinition::getMetricRegistry)
 #ifdef ENABLE_MPI
         .def("setCommunicator", &SystemDefinition::setCommunicator)
 #endif
@@ -31,6 +31,9 @@ class Communicator;
 //! Forward declaration of SnapshotSystemData
 template<class Real> struct SnapshotSystemData;
 
+//! Forward declaration of MetricRegistry
+class MetricRegistry;
+
 //! Container class for all data needed to define the MD system
 /*! SystemDefinition is a big bucket where all of the data defining the MD system goes.
     Everything is stored as a shared pointer for quick and easy access from within C++
@@ -110,6 +113,9 @@ class PYBIND11_EXPORT SystemDefinition
                      std::shared_ptr<DomainDecomposition> decomposition
                      = std::shared_ptr<DomainDecomposition>());
 
+    //! Duplicate the system without gathering a global snapshot
+    std::shared_ptr<SystemDefinition> fastClone(std::shared_ptr<ExecutionConfiguration> exec_conf);
+
     //! Set the dimensionality of the system
     void setNDimensions(unsigned int);
 
@@ -123,7 +129,7 @@ class PYBIND11_EXPORT SystemDefinition
     bool isDomainDecomposed()
         {
 #ifdef ENABLE_MPI
-        return bool(this->m_particle_data->getDomainDecomposition());
+        return this->m_particle_data->isDomainDecomposed();
 #else
         return false;
 #endif
@@ -202,6 +208,9 @@ class PYBIND11_EXPORT SystemDefinition
         return m_pair_data;
         }
 
+    //! Get the scalar metric registry, creating it on first access
+    std::shared_ptr<MetricRegistry> getMetricRegistry();
+
 #ifdef BUILD_MPCD
     //! Get the MPCD particle data
     std::shared_ptr<mpcd::ParticleData> getMPCDParticleData() const
@@ -233,6 +242,7 @@ class PYBIND11_EXPORT SystemDefinition
     std::shared_ptr<ImproperData> m_improper_data;     //!< Improper data for the system
     std::shared_ptr<ConstraintData> m_constraint_data; //!< Improper data for the system
     std::shared_ptr<PairData> m_pair_data;             //!< Special pairs data for the system
+    std::shared_ptr<MetricRegistry> m_metric_registry; //!< Scalar metrics published by operations
 #ifdef BUILD_MPCD
     std::shared_ptr<mpcd::ParticleData> m_mpcd_data; //!< MPCD particle data
 #endif
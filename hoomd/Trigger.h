@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <pybind11/iostream.h>
 #include <pybind11/pybind11.h>
@@ -50,6 +51,22 @@ class PYBIND11_EXPORT Trigger
 
     virtual bool compute(uint64_t timestep) = 0;
 
+    /** Return the earliest time step at or after `timestep` on which the trigger may fire
+     *
+     *  Schedulers use this to skip querying triggers on steps where they cannot fire. The
+     *  returned step is a lower bound only: the trigger is still consulted through
+     *  operator() when that step arrives, so returning `timestep` (the default) keeps a
+     *  trigger polled every step. Subclasses with a known schedule (e.g. periodic) override
+     *  this to let idle steps be skipped entirely.
+     *
+     *  @param timestep First time step to consider
+     *  @returns The next time step at which compute() may return `true`
+     */
+    virtual uint64_t nextStep(uint64_t timestep)
+        {
+        return timestep;
+        }
+
     private:
     /// Caches the last time step at which the trigger was computed
     uint64_t m_last_timestep;
@@ -83,6 +100,13 @@ class PYBIND11_EXPORT PeriodicTrigger : public Trigger
         return (timestep - m_phase) % m_period == 0;
         }
 
+    uint64_t nextStep(uint64_t timestep)
+        {
+        // next multiple of the period (offset by phase) at or after timestep
+        uint64_t delta = (timestep - m_phase) % m_period;
+        return delta ? timestep + (m_period - delta) : timestep;
+        }
+
     /// Set the period
     void setPeriod(uint64_t period)
         {
@@ -128,6 +152,12 @@ class PYBIND11_EXPORT BeforeTrigger : public Trigger
         return timestep < m_timestep;
         }
 
+    uint64_t nextStep(uint64_t timestep)
+        {
+        // fires every step while active, never again afterwards
+        return timestep < m_timestep ? timestep : std::numeric_limits<uint64_t>::max();
+        }
+
     /// Get the timestep before which the trigger is active.
     uint64_t getTimestep() const
         {
@@ -160,6 +190,11 @@ class PYBIND11_EXPORT OnTrigger : public Trigger
         return timestep == m_timestep;
         }
 
+    uint64_t nextStep(uint64_t timestep)
+        {
+        return timestep <= m_timestep ? m_timestep : std::numeric_limits<uint64_t>::max();
+        }
+
     /// Get the timestep when the trigger is active.
     uint64_t getTimestep() const
         {
@@ -192,6 +227,11 @@ class PYBIND11_EXPORT AfterTrigger : public Trigger
         return timestep > m_timestep;
         }
 
+    uint64_t nextStep(uint64_t timestep)
+        {
+        return timestep > m_timestep ? timestep : m_timestep + 1;
+        }
+
     /// Get the timestep after which the trigger is active.
     uint64_t getTimestep() const
         {
@@ -266,6 +306,17 @@ class PYBIND11_EXPORT AndTrigger : public Trigger
                            { return t->operator()(timestep); });
         }
 
+    uint64_t nextStep(uint64_t timestep)
+        {
+        // every trigger must be able to fire, so the latest lower bound applies
+        uint64_t next = timestep;
+        for (const auto& t : m_triggers)
+            {
+            next = std::max(next, t->nextStep(timestep));
+            }
+        return next;
+        }
+
     const std::vector<std::shared_ptr<Trigger>>& getTriggers() const
         {
         return m_triggers;
@@ -302,6 +353,19 @@ class PYBIND11_EXPORT OrTrigger : public Trigger
                            { return t->operator()(timestep); });
         }
 
+    uint64_t nextStep(uint64_t timestep)
+        {
+        // any one trigger firing suffices, so the earliest lower bound applies
+        if (m_triggers.empty())
+            return timestep;
+        uint64_t next = std::numeric_limits<uint64_t>::max();
+        for (const auto& t : m_triggers)
+            {
+            next = std::min(next, t->nextStep(timestep));
+            }
+        return next;
+        }
+
     const std::vector<std::shared_ptr<Trigger>>& getTriggers() const
         {
         return m_triggers;
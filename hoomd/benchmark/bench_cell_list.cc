@@ -0,0 +1,78 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "bench_utils.h"
+
+#include "hoomd/CellList.h"
+
+#ifdef ENABLE_HIP
+#include "hoomd/CellListGPU.h"
+#endif
+
+#include <iostream>
+
+using namespace hoomd;
+using namespace hoomd::bench;
+
+/*! \file bench_cell_list.cc
+    \brief Benchmarks the CellList (and CellListGPU) build rate
+*/
+
+//! Time repeated cell list builds on \a exec_conf
+template<class CL>
+void bench_cell_list(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                     const Options& opts,
+                     const std::string& device)
+    {
+    auto sysdef = makeCubicSystem(opts.N, Scalar(1.2), exec_conf);
+    unsigned int N = sysdef->getParticleData()->getNGlobal();
+
+    std::shared_ptr<CellList> cl(new CL(sysdef));
+    cl->setNominalWidth(Scalar(3.0));
+
+    uint64_t timestep = 0;
+    for (unsigned int i = 0; i < opts.warmup; i++)
+        cl->compute(timestep++);
+    synchronize(exec_conf);
+
+    ClockSource clk;
+    int64_t start = clk.getTime();
+    for (unsigned int i = 0; i < opts.steps; i++)
+        cl->compute(timestep++);
+    synchronize(exec_conf);
+    double elapsed = double(clk.getTime() - start) / 1e9;
+
+    report("cell_list", device, N, opts.steps, elapsed);
+    }
+
+int main(int argc, char** argv)
+    {
+#ifdef ENABLE_MPI
+    MPI_Init(&argc, &argv);
+#endif
+    Options opts = parseOptions(argc, argv);
+
+        {
+        std::shared_ptr<ExecutionConfiguration> exec_conf(
+            new ExecutionConfiguration(ExecutionConfiguration::CPU));
+        bench_cell_list<CellList>(exec_conf, opts, "cpu");
+        }
+
+#ifdef ENABLE_HIP
+    try
+        {
+        std::shared_ptr<ExecutionConfiguration> exec_conf(
+            new ExecutionConfiguration(ExecutionConfiguration::GPU));
+        bench_cell_list<CellListGPU>(exec_conf, opts, "gpu");
+        }
+    catch (const std::exception& e)
+        {
+        std::cerr << "Skipping GPU benchmark: " << e.what() << std::endl;
+        }
+#endif
+
+#ifdef ENABLE_MPI
+    MPI_Finalize();
+#endif
+    return 0;
+    }
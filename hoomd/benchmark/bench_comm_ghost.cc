@@ -0,0 +1,129 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "bench_utils.h"
+
+#ifdef ENABLE_MPI
+
+#include "hoomd/Communicator.h"
+#include "hoomd/DomainDecomposition.h"
+
+#ifdef ENABLE_HIP
+#include "hoomd/CommunicatorGPU.h"
+#endif
+
+#include <iostream>
+
+using namespace hoomd;
+using namespace hoomd::bench;
+
+/*! \file bench_comm_ghost.cc
+    \brief Benchmarks the per-step ghost exchange of Communicator and CommunicatorGPU
+
+    Run under mpirun with more than one rank, e.g.:
+
+        mpirun -n 8 bench_comm_ghost -N 256000
+*/
+
+//! Request a fixed ghost layer width
+struct ghost_layer_width
+    {
+    ghost_layer_width(Scalar width) : m_width(width) { }
+    Scalar get(unsigned int type)
+        {
+        return m_width;
+        }
+    Scalar m_width;
+    };
+
+//! Time repeated ghost updates on \a exec_conf
+template<class COMM>
+void bench_comm_ghost(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                      const Options& opts,
+                      const std::string& device)
+    {
+    auto sysdef = makeCubicSystem(opts.N, Scalar(1.2), exec_conf);
+    auto pdata = sysdef->getParticleData();
+    unsigned int N = pdata->getNGlobal();
+
+    // distribute the replicated configuration over the domains
+    SnapshotParticleData<Scalar> snap(N);
+    pdata->takeSnapshot(snap);
+    auto decomposition
+        = std::make_shared<DomainDecomposition>(exec_conf, pdata->getBox().getL());
+    pdata->setDomainDecomposition(decomposition);
+    pdata->initializeFromSnapshot(snap);
+
+    std::shared_ptr<Communicator> comm(new COMM(sysdef, decomposition));
+    ghost_layer_width g(Scalar(2.9));
+    comm->getGhostLayerWidthRequestSignal().connect<ghost_layer_width, &ghost_layer_width::get>(g);
+
+    CommFlags flags(0);
+    flags[comm_flag::position] = 1;
+    comm->setFlags(flags);
+
+    comm->migrateParticles();
+    comm->exchangeGhosts();
+
+    uint64_t timestep = 0;
+    for (unsigned int i = 0; i < opts.warmup; i++)
+        {
+        comm->beginUpdateGhosts(timestep);
+        comm->finishUpdateGhosts(timestep);
+        timestep++;
+        }
+    synchronize(exec_conf);
+    MPI_Barrier(exec_conf->getMPICommunicator());
+
+    ClockSource clk;
+    int64_t start = clk.getTime();
+    for (unsigned int i = 0; i < opts.steps; i++)
+        {
+        comm->beginUpdateGhosts(timestep);
+        comm->finishUpdateGhosts(timestep);
+        timestep++;
+        }
+    synchronize(exec_conf);
+    MPI_Barrier(exec_conf->getMPICommunicator());
+    double elapsed = double(clk.getTime() - start) / 1e9;
+
+    if (exec_conf->getRank() == 0)
+        report("comm_ghost", device, N, opts.steps, elapsed);
+    }
+
+int main(int argc, char** argv)
+    {
+    MPI_Init(&argc, &argv);
+    Options opts = parseOptions(argc, argv);
+
+        {
+        std::shared_ptr<ExecutionConfiguration> exec_conf(
+            new ExecutionConfiguration(ExecutionConfiguration::CPU));
+        bench_comm_ghost<Communicator>(exec_conf, opts, "cpu");
+        }
+
+#ifdef ENABLE_HIP
+    try
+        {
+        std::shared_ptr<ExecutionConfiguration> exec_conf(
+            new ExecutionConfiguration(ExecutionConfiguration::GPU));
+        bench_comm_ghost<CommunicatorGPU>(exec_conf, opts, "gpu");
+        }
+    catch (const std::exception& e)
+        {
+        std::cerr << "Skipping GPU benchmark: " << e.what() << std::endl;
+        }
+#endif
+
+    MPI_Finalize();
+    return 0;
+    }
+
+#else // ENABLE_MPI
+
+int main(int, char**)
+    {
+    return 0;
+    }
+
+#endif // ENABLE_MPI
@@ -0,0 +1,66 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "bench_utils.h"
+
+#include "hoomd/hpmc/IntegratorHPMCMono.h"
+#include "hoomd/hpmc/ShapeSphere.h"
+
+using namespace hoomd;
+using namespace hoomd::hpmc;
+using namespace hoomd::bench;
+
+/*! \file bench_hpmc_sphere.cc
+    \brief Benchmarks the IntegratorHPMCMono<ShapeSphere> sweep rate
+
+    Reports trial moves per second: the items_per_second column counts the
+    trial moves actually attempted (read back from the acceptance counters),
+    not particles times steps.
+*/
+
+int main(int argc, char** argv)
+    {
+#ifdef ENABLE_MPI
+    MPI_Init(&argc, &argv);
+#endif
+    Options opts = parseOptions(argc, argv);
+
+        {
+        std::shared_ptr<ExecutionConfiguration> exec_conf(
+            new ExecutionConfiguration(ExecutionConfiguration::CPU));
+
+        auto sysdef = makeCubicSystem(opts.N, Scalar(1.5), exec_conf);
+
+        auto mc = std::make_shared<IntegratorHPMCMono<ShapeSphere>>(sysdef);
+        ShapeSphere::param_type param;
+        param.radius = ShortReal(0.5);
+        param.ignore = 0;
+        param.isOriented = false;
+        mc->setParam(0, param);
+        mc->setD("A", Scalar(0.3));
+
+        uint64_t timestep = 0;
+        mc->prepRun(timestep);
+        for (unsigned int i = 0; i < opts.warmup; i++)
+            mc->update(timestep++);
+
+        hpmc_counters_t counters_start = mc->getCounters();
+        ClockSource clk;
+        int64_t start = clk.getTime();
+        for (unsigned int i = 0; i < opts.steps; i++)
+            mc->update(timestep++);
+        double elapsed = double(clk.getTime() - start) / 1e9;
+        hpmc_counters_t counters_end = mc->getCounters();
+
+        unsigned long long int moves
+            = counters_end.getNMoves() - counters_start.getNMoves();
+        unsigned int moves_per_step = (unsigned int)(moves / opts.steps);
+
+        report("hpmc_sphere", "cpu", moves_per_step, opts.steps, elapsed);
+        }
+
+#ifdef ENABLE_MPI
+    MPI_Finalize();
+#endif
+    return 0;
+    }
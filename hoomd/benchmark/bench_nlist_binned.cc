@@ -0,0 +1,92 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "bench_utils.h"
+
+#include "hoomd/md/NeighborListBinned.h"
+
+#ifdef ENABLE_HIP
+#include "hoomd/md/NeighborListGPUBinned.h"
+#endif
+
+#include <iostream>
+
+using namespace hoomd;
+using namespace hoomd::md;
+using namespace hoomd::bench;
+
+/*! \file bench_nlist_binned.cc
+    \brief Benchmarks the NeighborListBinned (and NeighborListGPUBinned) build rate
+*/
+
+//! Time repeated neighbor list builds on \a exec_conf
+template<class NL>
+void bench_nlist(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                 const Options& opts,
+                 const std::string& device)
+    {
+    auto sysdef = makeCubicSystem(opts.N, Scalar(1.2), exec_conf);
+    unsigned int N = sysdef->getParticleData()->getNGlobal();
+
+    std::shared_ptr<NeighborList> nlist(new NL(sysdef, Scalar(0.4)));
+    auto r_cut = std::make_shared<GlobalArray<Scalar>>(1, exec_conf);
+        {
+        ArrayHandle<Scalar> h_r_cut(*r_cut, access_location::host, access_mode::overwrite);
+        h_r_cut.data[0] = Scalar(2.5);
+        }
+    nlist->addRCutMatrix(r_cut);
+    nlist->setStorageMode(NeighborList::full);
+
+    // force a rebuild on every call so the build itself is measured, not the distance check
+    uint64_t timestep = 0;
+    for (unsigned int i = 0; i < opts.warmup; i++)
+        {
+        nlist->forceUpdate();
+        nlist->compute(timestep++);
+        }
+    synchronize(exec_conf);
+
+    ClockSource clk;
+    int64_t start = clk.getTime();
+    for (unsigned int i = 0; i < opts.steps; i++)
+        {
+        nlist->forceUpdate();
+        nlist->compute(timestep++);
+        }
+    synchronize(exec_conf);
+    double elapsed = double(clk.getTime() - start) / 1e9;
+
+    report("nlist_binned", device, N, opts.steps, elapsed);
+    }
+
+int main(int argc, char** argv)
+    {
+#ifdef ENABLE_MPI
+    MPI_Init(&argc, &argv);
+#endif
+    Options opts = parseOptions(argc, argv);
+
+        {
+        std::shared_ptr<ExecutionConfiguration> exec_conf(
+            new ExecutionConfiguration(ExecutionConfiguration::CPU));
+        bench_nlist<NeighborListBinned>(exec_conf, opts, "cpu");
+        }
+
+#ifdef ENABLE_HIP
+    try
+        {
+        std::shared_ptr<ExecutionConfiguration> exec_conf(
+            new ExecutionConfiguration(ExecutionConfiguration::GPU));
+        bench_nlist<NeighborListGPUBinned>(exec_conf, opts, "gpu");
+        }
+    catch (const std::exception& e)
+        {
+        std::cerr << "Skipping GPU benchmark: " << e.what() << std::endl;
+        }
+#endif
+
+#ifdef ENABLE_MPI
+    MPI_Finalize();
+#endif
+    return 0;
+    }
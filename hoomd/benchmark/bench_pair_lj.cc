@@ -0,0 +1,94 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "bench_utils.h"
+
+#include "hoomd/md/EvaluatorPairLJ.h"
+#include "hoomd/md/NeighborListBinned.h"
+#include "hoomd/md/PotentialPair.h"
+
+#ifdef ENABLE_HIP
+#include "hoomd/md/NeighborListGPUBinned.h"
+#include "hoomd/md/PotentialPairGPU.h"
+#endif
+
+#include <iostream>
+
+using namespace hoomd;
+using namespace hoomd::md;
+using namespace hoomd::bench;
+
+/*! \file bench_pair_lj.cc
+    \brief Benchmarks PotentialPair<EvaluatorPairLJ> force evaluation
+
+    The neighbor list is built once before the timed loop and the particles do
+    not move, so steady-state iterations measure the pair evaluation alone.
+*/
+
+//! Time repeated LJ force evaluations on \a exec_conf
+template<class NL, class PP>
+void bench_pair_lj(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                   const Options& opts,
+                   const std::string& device)
+    {
+    auto sysdef = makeCubicSystem(opts.N, Scalar(1.2), exec_conf);
+    unsigned int N = sysdef->getParticleData()->getNGlobal();
+
+    std::shared_ptr<NeighborList> nlist(new NL(sysdef, Scalar(0.4)));
+    std::shared_ptr<PP> fc(new PP(sysdef, nlist));
+
+    // sigma = 1, epsilon = 1
+    typename PP::param_type param;
+    param.sigma_6 = Scalar(1.0);
+    param.epsilon_x_4 = Scalar(4.0);
+    fc->setParams(0, 0, param);
+    fc->setRcut(0, 0, Scalar(2.5));
+
+    uint64_t timestep = 0;
+    for (unsigned int i = 0; i < opts.warmup; i++)
+        fc->compute(timestep++);
+    synchronize(exec_conf);
+
+    ClockSource clk;
+    int64_t start = clk.getTime();
+    for (unsigned int i = 0; i < opts.steps; i++)
+        fc->compute(timestep++);
+    synchronize(exec_conf);
+    double elapsed = double(clk.getTime() - start) / 1e9;
+
+    report("pair_lj", device, N, opts.steps, elapsed);
+    }
+
+int main(int argc, char** argv)
+    {
+#ifdef ENABLE_MPI
+    MPI_Init(&argc, &argv);
+#endif
+    Options opts = parseOptions(argc, argv);
+
+        {
+        std::shared_ptr<ExecutionConfiguration> exec_conf(
+            new ExecutionConfiguration(ExecutionConfiguration::CPU));
+        bench_pair_lj<NeighborListBinned, PotentialPair<EvaluatorPairLJ>>(exec_conf, opts, "cpu");
+        }
+
+#ifdef ENABLE_HIP
+    try
+        {
+        std::shared_ptr<ExecutionConfiguration> exec_conf(
+            new ExecutionConfiguration(ExecutionConfiguration::GPU));
+        bench_pair_lj<NeighborListGPUBinned, PotentialPairGPU<EvaluatorPairLJ>>(exec_conf,
+                                                                                opts,
+                                                                                "gpu");
+        }
+    catch (const std::exception& e)
+        {
+        std::cerr << "Skipping GPU benchmark: " << e.what() << std::endl;
+        }
+#endif
+
+#ifdef ENABLE_MPI
+    MPI_Finalize();
+#endif
+    return 0;
+    }
@@ -0,0 +1,121 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __BENCH_UTILS_H__
+#define __BENCH_UTILS_H__
+
+/*! \file bench_utils.h
+    \brief Shared helpers for the hoomd-bench performance benchmarks
+
+    Every benchmark prints one machine-readable CSV row per measurement to stdout:
+
+        hoomd-bench,<name>,<device>,<N>,<steps>,<total_seconds>,<ms_per_step>,<items_per_second>
+
+    The ``hoomd-bench,`` prefix lets scripts filter the data rows from status
+    output. Timings cover a steady-state loop after a warm up phase so that
+    one-time allocations and autotuning do not pollute the numbers.
+*/
+
+// this include is necessary to get MPI included before anything else to support intel MPI
+#include "hoomd/ExecutionConfiguration.h"
+
+#include "hoomd/ClockSource.h"
+#include "hoomd/Initializers.h"
+#include "hoomd/SnapshotSystemData.h"
+#include "hoomd/SystemDefinition.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+namespace hoomd
+    {
+namespace bench
+    {
+//! Command line options common to all benchmarks
+struct Options
+    {
+    unsigned int N = 64000;     //!< Target number of particles
+    unsigned int warmup = 20;   //!< Iterations to run before timing starts
+    unsigned int steps = 200;   //!< Iterations to time
+    };
+
+//! Parse the common benchmark command line
+/*! Supported arguments: ``-N <n>``, ``--warmup <n>``, and ``--steps <n>``.
+    Unknown arguments terminate the benchmark with a usage message.
+*/
+inline Options parseOptions(int argc, char** argv)
+    {
+    Options opts;
+    for (int i = 1; i < argc; i++)
+        {
+        std::string arg(argv[i]);
+        if (arg == "-N" && i + 1 < argc)
+            opts.N = (unsigned int)atoi(argv[++i]);
+        else if (arg == "--warmup" && i + 1 < argc)
+            opts.warmup = (unsigned int)atoi(argv[++i]);
+        else if (arg == "--steps" && i + 1 < argc)
+            opts.steps = (unsigned int)atoi(argv[++i]);
+        else
+            {
+            fprintf(stderr,
+                    "Usage: %s [-N <particles>] [--warmup <iters>] [--steps <iters>]\n",
+                    argv[0]);
+            exit(1);
+            }
+        }
+    return opts;
+    }
+
+//! Build a simple cubic system with at least \a N particles
+/*! \param N Minimum number of particles to place
+    \param spacing Lattice constant of the cubic lattice
+    \param exec_conf Execution configuration for the system
+
+    The actual particle count is the smallest perfect cube >= \a N; read it back
+    from the returned system's particle data when reporting.
+*/
+inline std::shared_ptr<SystemDefinition>
+makeCubicSystem(unsigned int N, Scalar spacing, std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    unsigned int M = (unsigned int)ceil(pow(double(N), 1.0 / 3.0));
+    SimpleCubicInitializer init(M, spacing, "A");
+    return std::make_shared<SystemDefinition>(init.getSnapshot(), exec_conf);
+    }
+
+//! Wait for all pending device work to complete
+inline void synchronize(std::shared_ptr<const ExecutionConfiguration> exec_conf)
+    {
+#ifdef ENABLE_HIP
+    if (exec_conf->isCUDAEnabled())
+        hipDeviceSynchronize();
+#endif
+    }
+
+//! Print one machine-readable result row
+/*! \param name Benchmark name
+    \param device ``cpu`` or ``gpu``
+    \param N Number of particles (or items) processed per step
+    \param steps Number of timed iterations
+    \param elapsed Wall time of the timed loop, in seconds
+*/
+inline void
+report(const std::string& name, const std::string& device, unsigned int N, unsigned int steps, double elapsed)
+    {
+    printf("hoomd-bench,%s,%s,%u,%u,%.6f,%.6f,%.6g\n",
+           name.c_str(),
+           device.c_str(),
+           N,
+           steps,
+           elapsed,
+           elapsed / double(steps) * 1e3,
+           double(N) * double(steps) / elapsed);
+    fflush(stdout);
+    }
+
+    } // end namespace bench
+    } // end namespace hoomd
+
+#endif // __BENCH_UTILS_H__
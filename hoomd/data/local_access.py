@@ -170,9 +170,10 @@ class ParticleLocalAccessBase(_LocalAccess):
         'net_energy': 'getNetEnergy'
     }
 
-    def __init__(self, state):
+    def __init__(self, state, force_read_only=False):
         super().__init__()
-        self._cpp_obj = self._cpp_cls(state._cpp_sys_def.getParticleData())
+        self._cpp_obj = self._cpp_cls(state._cpp_sys_def.getParticleData(),
+                                      force_read_only)
 
 
 class _GroupLocalAccess(_LocalAccess):
@@ -194,10 +195,11 @@ class _GroupLocalAccess(_LocalAccess):
         'rtag': 'getRTags'
     }
 
-    def __init__(self, state):
+    def __init__(self, state, force_read_only=False):
         super().__init__()
         self._cpp_obj = self._cpp_cls(
-            getattr(state._cpp_sys_def, self._cpp_get_data_method_name)())
+            getattr(state._cpp_sys_def, self._cpp_get_data_method_name)(),
+            force_read_only)
 
 
 class BondLocalAccessBase(_GroupLocalAccess):
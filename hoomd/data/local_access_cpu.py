@@ -82,12 +82,12 @@ class LocalSnapshot(_LocalSnapshot):
         after the regular data.
     """
 
-    def __init__(self, state):
+    def __init__(self, state, force_read_only=False):
         super().__init__(state)
-        self._particles = ParticleLocalAccessCPU(state)
-        self._bonds = BondLocalAccessCPU(state)
-        self._angles = AngleLocalAccessCPU(state)
-        self._dihedrals = DihedralLocalAccessCPU(state)
-        self._impropers = ImproperLocalAccessCPU(state)
-        self._pairs = PairLocalAccessCPU(state)
-        self._constraints = ConstraintLocalAccessCPU(state)
+        self._particles = ParticleLocalAccessCPU(state, force_read_only)
+        self._bonds = BondLocalAccessCPU(state, force_read_only)
+        self._angles = AngleLocalAccessCPU(state, force_read_only)
+        self._dihedrals = DihedralLocalAccessCPU(state, force_read_only)
+        self._impropers = ImproperLocalAccessCPU(state, force_read_only)
+        self._pairs = PairLocalAccessCPU(state, force_read_only)
+        self._constraints = ConstraintLocalAccessCPU(state, force_read_only)
@@ -52,15 +52,15 @@ if hoomd.version.gpu_enabled:
     class LocalSnapshotGPU(_LocalSnapshot):
         """Access system state data on the GPU."""
 
-        def __init__(self, state):
+        def __init__(self, state, force_read_only=False):
             super().__init__(state)
-            self._particles = ParticleLocalAccessGPU(state)
-            self._bonds = BondLocalAccessGPU(state)
-            self._angles = AngleLocalAccessGPU(state)
-            self._dihedrals = DihedralLocalAccessGPU(state)
-            self._impropers = ImproperLocalAccessGPU(state)
-            self._pairs = PairLocalAccessGPU(state)
-            self._constraints = ConstraintLocalAccessGPU(state)
+            self._particles = ParticleLocalAccessGPU(state, force_read_only)
+            self._bonds = BondLocalAccessGPU(state, force_read_only)
+            self._angles = AngleLocalAccessGPU(state, force_read_only)
+            self._dihedrals = DihedralLocalAccessGPU(state, force_read_only)
+            self._impropers = ImproperLocalAccessGPU(state, force_read_only)
+            self._pairs = PairLocalAccessGPU(state, force_read_only)
+            self._constraints = ConstraintLocalAccessGPU(state, force_read_only)
 
 else:
     from hoomd.util import _NoGPU
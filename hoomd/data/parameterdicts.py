@@ -13,7 +13,7 @@ import numpy as np
 from hoomd.data.collections import (_HOOMDSyncedCollection, _to_hoomd_data,
                                     _to_base)
 from hoomd.error import MutabilityError, TypeConversionError
-from hoomd.util import _to_camel_case, _is_iterable
+from hoomd.util import _to_camel_case, _is_data_trusted, _is_iterable
 from hoomd.data.typeconverter import (to_type_converter, RequiredArg,
                                       TypeConverterMapping, OnlyIf, Either)
 from hoomd.data.smart_default import (_to_base_defaults, _to_default,
@@ -312,6 +312,10 @@ class _ValidatedDefaultDict(MutableMapping):
             self.__setitem__(set_keys, default)
 
     def _validate_values(self, value):
+        # Trusted values (e.g. re-used from a prior validated run via
+        # to_base()) are assumed complete and correctly typed already.
+        if _is_data_trusted():
+            return value
         validated_value = self._type_converter(value)
         # We can check the validated_value is a dict here since if it passed the
         # type validation it is of a form we expect.
@@ -447,6 +451,15 @@ class TypeParameterDict(_ValidatedDefaultDict):
 
         Assumes value to be validated already.
         """
+        self._store_value(key, item)
+        if not self._attached:
+            return
+        # We don't need to set the _dict yet since we will query C++ when
+        # retreiving the key the next time.
+        getattr(self._cpp_obj, self._setter)(key, item)
+
+    def _store_value(self, key, item):
+        """Update the Python side mirror of the mapping without touching C++."""
         if isinstance(self._dict.get(key), _HOOMDSyncedCollection):
             self._dict[key]._isolate()
         self._dict[key] = _to_hoomd_data(root=self,
@@ -454,11 +467,6 @@ class TypeParameterDict(_ValidatedDefaultDict):
                                          data=item,
                                          parent=None,
                                          identity=key)
-        if not self._attached:
-            return
-        # We don't need to set the _dict yet since we will query C++ when
-        # retreiving the key the next time.
-        getattr(self._cpp_obj, self._setter)(key, item)
 
     def __iter__(self):
         """Get the keys in the mapping."""
@@ -482,7 +490,7 @@ class TypeParameterDict(_ValidatedDefaultDict):
 
     def _validate_values(self, val):
         val = super()._validate_values(val)
-        if self._attached:
+        if self._attached and not _is_data_trusted():
             _raise_if_required_arg(val)
         return val
 
@@ -498,6 +506,10 @@ class TypeParameterDict(_ValidatedDefaultDict):
                 and setter.
             types (list[str]): The str names of the available types for the type
                 parameter.
+
+        When the C++ object additionally exposes the batched setter
+        ``set<ParamName>Batch``, all keys are pushed through it in a single
+        call instead of one pybind11 call per key.
         """
         # store info to communicate with c++
         self._setter = "set" + _to_camel_case(param_name)
@@ -509,13 +521,25 @@ class TypeParameterDict(_ValidatedDefaultDict):
             for key in self._indexer.yield_all_keys()
         }
         self._cpp_obj = cpp_obj
-        for key in self:
-            try:
-                _raise_if_required_arg(parameters[key])
-            except IncompleteSpecificationError as err:
-                self._cpp_obj = None
-                raise IncompleteSpecificationError(f"for key {key} {str(err)}")
-            self._single_setitem(key, parameters[key])
+        if not _is_data_trusted():
+            for key in self:
+                try:
+                    _raise_if_required_arg(parameters[key])
+                except IncompleteSpecificationError as err:
+                    self._cpp_obj = None
+                    raise IncompleteSpecificationError(
+                        f"for key {key} {str(err)}")
+
+        # Operations that expose a batched setter take the full matrix of
+        # parameters in a single C++ call; the rest are pushed per key.
+        batch_setter = getattr(cpp_obj, self._setter + "Batch", None)
+        if batch_setter is None:
+            for key in self:
+                self._single_setitem(key, parameters[key])
+        else:
+            for key in self:
+                self._store_value(key, parameters[key])
+            batch_setter([(key, parameters[key]) for key in self])
 
     def _detach(self):
         """Convert to a detached parameter dict."""
@@ -639,7 +663,10 @@ class ParameterDict(MutableMapping):
             if self._attached:
                 raise KeyError("Keys cannot be added after Simulation.run().")
             self._type_converter[key] = to_type_converter(value)
-        validated_value = self._type_converter[key](value)
+        if _is_data_trusted():
+            validated_value = value
+        else:
+            validated_value = self._type_converter[key](value)
         if self._attached:
             try:
                 self._cpp_setting(key, validated_value)
@@ -217,6 +217,56 @@ class Device:
         """list[str]: Descriptions of the active hardware devices."""
         return self._cpp_exec_conf.getActiveDevices()
 
+    @property
+    def memory_budget(self):
+        """int: Device memory budget in bytes (0 disables the budget).
+
+        When non-zero, array growth requests that would push the total device
+        memory owned by HOOMD past the budget raise an error naming the
+        requesting array and the largest consumers instead of aborting with an
+        out of memory error mid-run.
+        """
+        return self._cpp_exec_conf.getMemoryTracker().getBudget()
+
+    @memory_budget.setter
+    def memory_budget(self, budget):
+        self._cpp_exec_conf.getMemoryTracker().setBudget(int(budget))
+
+    @property
+    def memory_usage(self):
+        """list[tuple[str, int]]: Current array memory usage by allocation tag.
+
+        Entries are (tag, bytes) pairs sorted by decreasing size. Allocations
+        without a tag are aggregated under ``"(untagged)"``.
+        """
+        return self._cpp_exec_conf.getMemoryTracker().getUsageByTag()
+
+    @property
+    def allocation_tracing(self):
+        """bool: Whether array allocation tracing is active.
+
+        Enable after warming up a simulation to flag allocations that still
+        occur during steady-state stepping: run a few more steps and inspect
+        `allocation_trace` — a steady state with bounded per-step latency
+        leaves the trace empty. Enabling clears any previously recorded trace.
+        """
+        return self._cpp_exec_conf.getMemoryTracker().getTracing()
+
+    @allocation_tracing.setter
+    def allocation_tracing(self, enable):
+        self._cpp_exec_conf.getMemoryTracker().setTracing(bool(enable))
+
+    @property
+    def allocation_trace(self):
+        """list[tuple[str, str, int]]: Array allocations recorded while \
+        `allocation_tracing` was enabled.
+
+        Entries are (tag, kind, bytes) tuples in allocation order, where kind
+        is one of ``"host"``, ``"device"`` or ``"managed"``. Allocations
+        without a tag are reported as ``"(untagged)"``.
+        """
+        return self._cpp_exec_conf.getMemoryTracker().getTrace()
+
     @property
     def num_cpu_threads(self):
         """int: Number of TBB threads to use."""
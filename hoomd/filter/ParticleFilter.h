@@ -47,6 +47,17 @@ class PYBIND11_EXPORT ParticleFilter
         {
         return std::vector<unsigned int>();
         }
+
+    /** True when the selection depends only on particle tags, types, and the particle
+     *  count. ParticleGroup memoizes the evaluation of such filters and reuses the
+     *  cached member list until a particle sort, type, number change, or writable
+     *  zero-copy access invalidates it. Filters that read positions or other per-step
+     *  state must return false (the default).
+     */
+    virtual bool isMemoizable() const
+        {
+        return false;
+        }
     };
 
     } // end namespace hoomd
@@ -38,6 +38,12 @@ class PYBIND11_EXPORT ParticleFilterAll : public ParticleFilter
         std::copy_n(h_tag.data, N, member_tags.begin());
         return member_tags;
         }
+
+    /// The selection depends only on the particle count
+    virtual bool isMemoizable() const
+        {
+        return true;
+        }
     };
 
     } // end namespace hoomd
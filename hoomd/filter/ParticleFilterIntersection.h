@@ -50,6 +50,12 @@ class PYBIND11_EXPORT ParticleFilterIntersection : public ParticleFilter
         return tags;
         }
 
+    /// Memoizable when both operands are
+    virtual bool isMemoizable() const
+        {
+        return m_f->isMemoizable() && m_g->isMemoizable();
+        }
+
     protected:
     std::shared_ptr<ParticleFilter> m_f;
     std::shared_ptr<ParticleFilter> m_g;
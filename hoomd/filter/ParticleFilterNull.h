@@ -27,6 +27,12 @@ class PYBIND11_EXPORT ParticleFilterNull : public ParticleFilter
         std::vector<unsigned int> member_tags;
         return member_tags;
         }
+
+    /// The selection is always empty
+    virtual bool isMemoizable() const
+        {
+        return true;
+        }
     };
 
     } // end namespace hoomd
@@ -43,6 +43,12 @@ class PYBIND11_EXPORT ParticleFilterTags : public ParticleFilter
         return m_tags;
         }
 
+    /// The selection is a fixed tag list
+    virtual bool isMemoizable() const
+        {
+        return true;
+        }
+
     protected:
     std::vector<unsigned int> m_tags; //< Tags to use for filter
     };
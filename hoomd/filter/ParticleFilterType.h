@@ -69,6 +69,12 @@ class PYBIND11_EXPORT ParticleFilterType : public ParticleFilter
         return member_tags;
         }
 
+    /// The selection depends only on particle types
+    virtual bool isMemoizable() const
+        {
+        return true;
+        }
+
     protected:
     std::unordered_set<std::string> m_types; ///< Set of types to select
     };
@@ -2,6 +2,7 @@
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 #include "ClangCompiler.h"
+#include "HOOMDVersion.h"
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wconversion"
@@ -17,10 +18,14 @@
 #include <clang/Lex/HeaderSearch.h>
 #include <clang/Lex/PreprocessorOptions.h>
 #include <clang/Tooling/Tooling.h>
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
 #include <llvm/InitializePasses.h>
 #include <llvm/PassRegistry.h>
+#include <llvm/Support/FileSystem.h>
 #include <llvm/Support/Host.h>
 #include <llvm/Support/MemoryBuffer.h>
 #include <llvm/Support/TargetSelect.h>
@@ -28,6 +33,8 @@
 
 #pragma GCC diagnostic pop
 
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
 #include <sstream>
 #include <sys/stat.h>
@@ -73,9 +80,69 @@ ClangCompiler::ClangCompiler()
     llvm::initializeTarget(Registry);
     }
 
+namespace
+    {
+/** Determine the directory holding the on disk cache of compiled modules.
+
+    The cache location may be overridden with the environment variable HOOMD_CACHE_DIR.
+    Setting it to an empty string disables the cache. The default follows the XDG base
+    directory convention.
+
+    @returns The cache directory, or an empty string when caching is disabled.
+*/
+std::string getModuleCacheDir()
+    {
+    const char* env = getenv("HOOMD_CACHE_DIR");
+    if (env)
+        {
+        if (*env == 0)
+            return std::string();
+        return std::string(env) + "/llvm-jit";
+        }
+
+    env = getenv("XDG_CACHE_HOME");
+    if (env && *env != 0)
+        return std::string(env) + "/hoomd/llvm-jit";
+
+    env = getenv("HOME");
+    if (env && *env != 0)
+        return std::string(env) + "/.cache/hoomd/llvm-jit";
+
+    return std::string();
+    }
+
+/** Compute a hash string identifying a compilation.
+
+    Uses two 64-bit FNV-1a passes with different offset bases, which is more than
+    sufficient to key a compilation cache.
+
+    @param s The string to hash (code, arguments and toolchain identification).
+    @returns A 32 character hex digest.
+*/
+std::string hashCompilation(const std::string& s)
+    {
+    uint64_t h1 = 14695981039346656037ull;
+    uint64_t h2 = 1099511628211ull * 31ull + 14695981039346656037ull;
+    for (char c : s)
+        {
+        h1 = (h1 ^ (unsigned char)c) * 1099511628211ull;
+        h2 = (h2 ^ (unsigned char)c) * 1099511628211ull;
+        }
+
+    char buf[33];
+    snprintf(buf, sizeof(buf), "%016llx%016llx", (unsigned long long)h1, (unsigned long long)h2);
+    return std::string(buf);
+    }
+
+    } // end anonymous namespace
+
 /** @param code The C++ code to compile.
     @param user_args The arguments to pass to the compiler.
 
+    Compiled modules are cached on disk keyed by the code, the compiler arguments, the
+    HOOMD version and the toolchain, so repeated runs with identical potentials load the
+    stored bitcode instead of invoking the compiler.
+
     @returns The LLVM module with the code compiled.
 */
 std::unique_ptr<llvm::Module> ClangCompiler::compileCode(const std::string& code,
@@ -133,6 +200,41 @@ std::unique_ptr<llvm::Module> ClangCompiler::compileCode(const std::string& code
     clang_args.insert(clang_args.end(), user_args.begin(), user_args.end());
     clang_args.push_back("_hoomd_llvm_code.cc");
 
+    // look up the compiled module in the on disk cache
+    std::string cache_dir = getModuleCacheDir();
+    std::string cache_path;
+    if (!cache_dir.empty())
+        {
+        std::string key = code;
+        for (const auto& arg : clang_args)
+            {
+            key += '\0';
+            key += arg;
+            }
+        key += '\0';
+        key += HOOMD_VERSION;
+        key += '\0';
+        key += CLANG_VERSION_STRING;
+        key += '\0';
+        key += llvm::sys::getDefaultTargetTriple();
+
+        cache_path = cache_dir + "/" + hashCompilation(key) + ".bc";
+
+        auto buffer = llvm::MemoryBuffer::getFile(cache_path);
+        if (buffer)
+            {
+            auto cached_module = llvm::parseBitcodeFile((*buffer)->getMemBufferRef(), context);
+            if (cached_module)
+                {
+                out << "Loaded cached compiled module from " << cache_path << std::endl;
+                return std::move(*cached_module);
+                }
+
+            // ignore the error and recompile, overwriting the stale entry
+            llvm::consumeError(cached_module.takeError());
+            }
+        }
+
     // convert arguments to a char** array.
     std::vector<const char*> clang_arg_c_strings;
     clang_arg_c_strings.push_back("clang");
@@ -224,6 +326,35 @@ std::unique_ptr<llvm::Module> ClangCompiler::compileCode(const std::string& code
         return nullptr;
         }
 
+    // store the compiled module for future processes
+    if (!cache_path.empty())
+        {
+        std::error_code ec = llvm::sys::fs::create_directories(cache_dir);
+        if (!ec)
+            {
+            // write through a unique temporary file so that concurrent jobs never observe
+            // partially written cache entries
+            llvm::SmallString<128> tmp_path;
+            int tmp_fd = -1;
+            ec = llvm::sys::fs::createUniqueFile(cache_path + ".tmp%%%%%%", tmp_fd, tmp_path);
+            if (!ec)
+                {
+                llvm::raw_fd_ostream tmp_os(tmp_fd, true);
+                llvm::WriteBitcodeToFile(*module, tmp_os);
+                tmp_os.close();
+
+                if (tmp_os.has_error() || llvm::sys::fs::rename(tmp_path, cache_path))
+                    llvm::sys::fs::remove(tmp_path);
+                else
+                    out << "Cached compiled module as " << cache_path << std::endl;
+                }
+            }
+
+        if (ec)
+            out << "Warning: unable to write to module cache directory " << cache_dir
+                << std::endl;
+        }
+
     return module;
     }
 
@@ -56,7 +56,7 @@ template<class Shape> class ComputeFreeVolume : public Compute
     //! Get the type of depletant particle
     std::string getTestParticleType()
         {
-        std::string type = m_sysdef->getParticleData()->getNameByType(m_type);
+        std::string type = m_sysdef->getParticleData()->getNameByType(m_types[0]);
         return type;
         }
 
@@ -65,7 +65,34 @@ template<class Shape> class ComputeFreeVolume : public Compute
     void setTestParticleType(std::string type)
         {
         unsigned int type_int = m_sysdef->getParticleData()->getTypeByName(type);
-        m_type = type_int;
+        m_types.assign(1, type_int);
+        resizeOverlapCounts();
+        }
+
+    //! Get the list of test particle types sampled in one pass
+    std::vector<std::string> getTestParticleTypes()
+        {
+        std::vector<std::string> types;
+        for (unsigned int type : m_types)
+            types.push_back(m_sysdef->getParticleData()->getNameByType(type));
+        return types;
+        }
+
+    //! Set the list of test particle types sampled in one pass
+    /*! All types share the same sample positions and orientations, so every test shape is
+        checked with a single tree traversal per sample point.
+        \param types particle types to set the test particles to
+    */
+    void setTestParticleTypes(std::vector<std::string> types)
+        {
+        if (types.empty())
+            {
+            throw std::runtime_error("At least one test particle type is required.");
+            }
+        m_types.clear();
+        for (const auto& type : types)
+            m_types.push_back(m_sysdef->getParticleData()->getTypeByName(type));
+        resizeOverlapCounts();
         }
 
     //! Analyze the current configuration
@@ -74,24 +101,38 @@ template<class Shape> class ComputeFreeVolume : public Compute
     //! Return an estimate of the overlap volume
     virtual Scalar getFreeVolume();
 
+    //! Return the free volume estimates for all test particle types
+    virtual std::vector<Scalar> getFreeVolumes();
+
     protected:
     std::shared_ptr<IntegratorHPMCMono<Shape>> m_mc; //!< The parent integrator
     std::shared_ptr<CellList> m_cl;                  //!< The cell list
 
-    unsigned int m_type;     //!< Type of depletant particle to generate
-    unsigned int m_n_sample; //!< Number of sampling depletants to generate
+    std::vector<unsigned int> m_types; //!< Types of depletant particle to generate
+    unsigned int m_n_sample;           //!< Number of sampling depletants to generate
 
-    GPUArray<unsigned int> m_n_overlap_all; //!< Number of overlap volume particles in box
+    GPUArray<unsigned int> m_n_overlap_all; //!< Number of overlapping samples, per test type
 
     //! Return an estimate of the overlap volume
     virtual void computeFreeVolume(uint64_t timestep);
+
+    private:
+    //! Keep one overlap counter per test type
+    void resizeOverlapCounts()
+        {
+        if (m_types.size() != m_n_overlap_all.getNumElements())
+            {
+            GPUArray<unsigned int> n_overlap_all((unsigned int)m_types.size(), this->m_exec_conf);
+            m_n_overlap_all.swap(n_overlap_all);
+            }
+        }
     };
 
 template<class Shape>
 ComputeFreeVolume<Shape>::ComputeFreeVolume(std::shared_ptr<SystemDefinition> sysdef,
                                             std::shared_ptr<IntegratorHPMCMono<Shape>> mc,
                                             std::shared_ptr<CellList> cl)
-    : Compute(sysdef), m_mc(mc), m_cl(cl), m_type(0), m_n_sample(0)
+    : Compute(sysdef), m_mc(mc), m_cl(cl), m_types(1, 0), m_n_sample(0)
     {
     this->m_exec_conf->msg->notice(5) << "Constructing ComputeFreeVolume" << std::endl;
 
@@ -121,7 +162,8 @@ template<class Shape> void ComputeFreeVolume<Shape>::compute(uint64_t timestep)
  */
 template<class Shape> void ComputeFreeVolume<Shape>::computeFreeVolume(uint64_t timestep)
     {
-    unsigned int overlap_count = 0;
+    const unsigned int n_types = (unsigned int)m_types.size();
+    std::vector<unsigned int> overlap_counts(n_types, 0);
     unsigned int err_count = 0;
     unsigned int ndim = this->m_sysdef->getNDimensions();
 
@@ -181,15 +223,33 @@ template<class Shape> void ComputeFreeVolume<Shape>::computeFreeVolume(uint64_t
             Scalar3 f = make_scalar3(xrand, yrand, zrand);
             vec3<Scalar> pos_i = vec3<Scalar>(box.makeCoordinates(f));
 
-            Shape shape_i(quat<Scalar>(), params[m_type]);
-            if (shape_i.hasOrientation())
+            // All test types share the sample position and orientation so that one tree
+            // traversal per sample point serves every test shape.
+            std::vector<Shape> test_shapes;
+            test_shapes.reserve(n_types);
+            hoomd::detail::AABB aabb_i_local;
+            bool have_orientation = false;
+            quat<Scalar> orientation_i;
+            for (unsigned int t = 0; t < n_types; t++)
                 {
-                shape_i.orientation = generateRandomOrientation(rng_i, ndim);
+                Shape shape_t(quat<Scalar>(), params[m_types[t]]);
+                if (shape_t.hasOrientation())
+                    {
+                    if (!have_orientation)
+                        {
+                        orientation_i = generateRandomOrientation(rng_i, ndim);
+                        have_orientation = true;
+                        }
+                    shape_t.orientation = orientation_i;
+                    }
+                hoomd::detail::AABB aabb_t = shape_t.getAABB(vec3<Scalar>(0, 0, 0));
+                aabb_i_local = (t == 0) ? aabb_t : hoomd::detail::merge(aabb_i_local, aabb_t);
+                test_shapes.push_back(shape_t);
                 }
 
             // check for overlaps with particles in the system state
-            bool overlap = false;
-            hoomd::detail::AABB aabb_i_local = shape_i.getAABB(vec3<Scalar>(0, 0, 0));
+            std::vector<bool> overlap(n_types, false);
+            unsigned int n_remaining = n_types;
 
             // All image boxes (including the primary)
             const unsigned int n_images = (unsigned int)image_list.size();
@@ -227,13 +287,23 @@ template<class Shape> void ComputeFreeVolume<Shape>::computeFreeVolume(uint64_t
                                 unsigned int typ_j = __scalar_as_int(postype_j.w);
                                 Shape shape_j(quat<Scalar>(orientation_j), params[typ_j]);
 
-                                if (h_overlaps.data[overlap_idx(m_type, typ_j)]
-                                    && check_circumsphere_overlap(r_ij, shape_i, shape_j)
-                                    && test_overlap(r_ij, shape_i, shape_j, err_count))
+                                // test every type that has not already overlapped
+                                for (unsigned int t = 0; t < n_types; t++)
                                     {
-                                    overlap = true;
-                                    break;
+                                    if (!overlap[t]
+                                        && h_overlaps.data[overlap_idx(m_types[t], typ_j)]
+                                        && check_circumsphere_overlap(r_ij,
+                                                                      test_shapes[t],
+                                                                      shape_j)
+                                        && test_overlap(r_ij, test_shapes[t], shape_j, err_count))
+                                        {
+                                        overlap[t] = true;
+                                        overlap_counts[t]++;
+                                        n_remaining--;
+                                        }
                                     }
+                                if (n_remaining == 0)
+                                    break;
                                 }
                             }
                         }
@@ -243,19 +313,14 @@ template<class Shape> void ComputeFreeVolume<Shape>::computeFreeVolume(uint64_t
                         cur_node_idx += aabb_tree.getNodeSkip(cur_node_idx);
                         }
 
-                    if (overlap)
+                    if (n_remaining == 0)
                         break;
                     } // end loop over AABB nodes
 
-                if (overlap)
+                if (n_remaining == 0)
                     break;
                 } // end loop over images
-
-            if (overlap)
-                {
-                overlap_count++;
-                }
-            } // end loop through all particles
+            }     // end loop through all particles
 
         } // end lexical scope
 
@@ -263,8 +328,8 @@ template<class Shape> void ComputeFreeVolume<Shape>::computeFreeVolume(uint64_t
     if (m_sysdef->isDomainDecomposed())
         {
         MPI_Allreduce(MPI_IN_PLACE,
-                      &overlap_count,
-                      1,
+                      overlap_counts.data(),
+                      n_types,
                       MPI_UNSIGNED,
                       MPI_SUM,
                       m_exec_conf->getMPICommunicator());
@@ -274,11 +339,17 @@ template<class Shape> void ComputeFreeVolume<Shape>::computeFreeVolume(uint64_t
     ArrayHandle<unsigned int> h_n_overlap_all(m_n_overlap_all,
                                               access_location::host,
                                               access_mode::overwrite);
-    *h_n_overlap_all.data = overlap_count;
+    std::copy(overlap_counts.begin(), overlap_counts.end(), h_n_overlap_all.data);
     }
 
 // \return the free volume.
 template<class Shape> Scalar ComputeFreeVolume<Shape>::getFreeVolume()
+    {
+    return getFreeVolumes()[0];
+    }
+
+// \return the free volume per test particle type.
+template<class Shape> std::vector<Scalar> ComputeFreeVolume<Shape>::getFreeVolumes()
     {
     // access counters
     ArrayHandle<unsigned int> h_n_overlap_all(m_n_overlap_all,
@@ -294,10 +365,15 @@ template<class Shape> Scalar ComputeFreeVolume<Shape>::getFreeVolume()
     n_sample = (n_sample / n_ranks) * n_ranks;
 #endif
 
-    // total free volume
+    // total free volume per test type
     const BoxDim global_box = this->m_pdata->getGlobalBox();
-    Scalar V_free = (Scalar)(n_sample - *h_n_overlap_all.data) / (Scalar)n_sample
-                    * global_box.getVolume(this->m_sysdef->getNDimensions() == 2);
+    const Scalar V_box = global_box.getVolume(this->m_sysdef->getNDimensions() == 2);
+
+    std::vector<Scalar> V_free(m_types.size());
+    for (size_t t = 0; t < m_types.size(); t++)
+        {
+        V_free[t] = (Scalar)(n_sample - h_n_overlap_all.data[t]) / (Scalar)n_sample * V_box;
+        }
 
     return V_free;
     }
@@ -322,7 +398,11 @@ template<class Shape> void export_ComputeFreeVolume(pybind11::module& m, const s
         .def_property("test_particle_type",
                       &ComputeFreeVolume<Shape>::getTestParticleType,
                       &ComputeFreeVolume<Shape>::setTestParticleType)
-        .def_property_readonly("free_volume", &ComputeFreeVolume<Shape>::getFreeVolume);
+        .def_property("test_particle_types",
+                      &ComputeFreeVolume<Shape>::getTestParticleTypes,
+                      &ComputeFreeVolume<Shape>::setTestParticleTypes)
+        .def_property_readonly("free_volume", &ComputeFreeVolume<Shape>::getFreeVolume)
+        .def_property_readonly("free_volumes", &ComputeFreeVolume<Shape>::getFreeVolumes);
     }
 
     } // end namespace detail
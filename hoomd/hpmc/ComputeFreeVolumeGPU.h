@@ -246,41 +246,46 @@ template<class Shape> void ComputeFreeVolumeGPU<Shape>::computeFreeVolume(uint64
         n_sample /= this->m_exec_conf->getNRanks();
 #endif
 
-        detail::hpmc_free_volume_args_t free_volume_args(n_sample,
-                                                         this->m_type,
-                                                         d_postype.data,
-                                                         d_orientation.data,
-                                                         d_cell_idx.data,
-                                                         d_cell_size.data,
-                                                         this->m_cl->getCellIndexer(),
-                                                         this->m_cl->getCellListIndexer(),
-                                                         d_excell_idx.data,
-                                                         d_excell_size.data,
-                                                         this->m_excell_list_indexer,
-                                                         this->m_cl->getDim(),
-                                                         this->m_pdata->getN(),
-                                                         this->m_pdata->getNTypes(),
-                                                         this->m_sysdef->getSeed(),
-                                                         this->m_exec_conf->getRank(),
-                                                         0,
-                                                         timestep,
-                                                         this->m_sysdef->getNDimensions(),
-                                                         box,
-                                                         block_size,
-                                                         stride,
-                                                         group_size,
-                                                         this->m_pdata->getMaxN(),
-                                                         d_n_overlap_all.data,
-                                                         this->m_cl->getGhostWidth(),
-                                                         d_overlaps.data,
-                                                         overlap_idx,
-                                                         this->m_exec_conf->dev_prop);
-
-        // invoke kernel for counting total overlap volume
-        detail::gpu_hpmc_free_volume<Shape>(free_volume_args, params.data());
-
-        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
-            CHECK_CUDA_ERROR();
+        // one kernel launch per test type; the RNG counters are identical between launches so
+        // that all types sample the same set of test positions
+        for (size_t t = 0; t < this->m_types.size(); t++)
+            {
+            detail::hpmc_free_volume_args_t free_volume_args(n_sample,
+                                                             this->m_types[t],
+                                                             d_postype.data,
+                                                             d_orientation.data,
+                                                             d_cell_idx.data,
+                                                             d_cell_size.data,
+                                                             this->m_cl->getCellIndexer(),
+                                                             this->m_cl->getCellListIndexer(),
+                                                             d_excell_idx.data,
+                                                             d_excell_size.data,
+                                                             this->m_excell_list_indexer,
+                                                             this->m_cl->getDim(),
+                                                             this->m_pdata->getN(),
+                                                             this->m_pdata->getNTypes(),
+                                                             this->m_sysdef->getSeed(),
+                                                             this->m_exec_conf->getRank(),
+                                                             0,
+                                                             timestep,
+                                                             this->m_sysdef->getNDimensions(),
+                                                             box,
+                                                             block_size,
+                                                             stride,
+                                                             group_size,
+                                                             this->m_pdata->getMaxN(),
+                                                             d_n_overlap_all.data + t,
+                                                             this->m_cl->getGhostWidth(),
+                                                             d_overlaps.data,
+                                                             overlap_idx,
+                                                             this->m_exec_conf->dev_prop);
+
+            // invoke kernel for counting total overlap volume
+            detail::gpu_hpmc_free_volume<Shape>(free_volume_args, params.data());
+
+            if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+            }
 
         m_tuner_free_volume->end();
         }
@@ -293,7 +298,7 @@ template<class Shape> void ComputeFreeVolumeGPU<Shape>::computeFreeVolume(uint64
                                                   access_mode::readwrite);
         MPI_Allreduce(MPI_IN_PLACE,
                       h_n_overlap_all.data,
-                      1,
+                      (unsigned int)this->m_types.size(),
                       MPI_UNSIGNED,
                       MPI_SUM,
                       this->m_exec_conf->getMPICommunicator());
@@ -22,6 +22,9 @@ IntegratorHPMC::IntegratorHPMC(std::shared_ptr<SystemDefinition> sysdef)
     {
     m_exec_conf->msg->notice(5) << "Constructing IntegratorHPMC" << endl;
 
+    // HPMC trial moves consume particle orientations
+    m_pdata->setAnisotropicDataInUse();
+
     GlobalArray<hpmc_counters_t> counters(1, this->m_exec_conf);
     m_count_total.swap(counters);
 
@@ -233,6 +236,36 @@ hpmc_counters_t IntegratorHPMC::getCounters(unsigned int mode)
     return result;
     }
 
+/*! Rescale the per-cell move size factors from the acceptance statistics accumulated since the
+    last adaptation. Cells with few trials are left unchanged so sparsely populated regions do
+    not adapt on noise. The scale factors are clamped to keep the trial moves within the range
+    assumed when sizing the ghost layer and cell list.
+*/
+void IntegratorHPMC::updateMoveGridScales()
+    {
+    // require enough samples for the acceptance estimate to be meaningful
+    const unsigned int min_trials = 100;
+
+    for (unsigned int cell = 0; cell < m_move_grid_scale.size(); cell++)
+        {
+        if (m_move_grid_trial[cell] < min_trials)
+            continue;
+
+        Scalar acceptance = Scalar(m_move_grid_accept[cell]) / Scalar(m_move_grid_trial[cell]);
+
+        // regularized multiplicative update: larger moves where acceptance is high, smaller
+        // where it is low, damped so a single adaptation cannot overshoot
+        Scalar factor = (acceptance + Scalar(0.1)) / (m_move_grid_target + Scalar(0.1));
+        factor = min(max(factor, Scalar(0.5)), Scalar(2.0));
+
+        m_move_grid_scale[cell]
+            = min(max(m_move_grid_scale[cell] * factor, move_grid_scale_min), move_grid_scale_max);
+
+        m_move_grid_accept[cell] = 0;
+        m_move_grid_trial[cell] = 0;
+        }
+    }
+
 namespace detail
     {
 void export_IntegratorHPMC(pybind11::module& m)
@@ -255,6 +288,12 @@ void export_IntegratorHPMC(pybind11::module& m)
         .def("getCounters", &IntegratorHPMC::getCounters)
         .def("communicate", &IntegratorHPMC::communicate)
         .def_property("nselect", &IntegratorHPMC::getNSelect, &IntegratorHPMC::setNSelect)
+        .def_property("move_size_grid",
+                      &IntegratorHPMC::getMoveSizeGrid,
+                      &IntegratorHPMC::setMoveSizeGrid)
+        .def_property("move_size_grid_target",
+                      &IntegratorHPMC::getMoveSizeGridTarget,
+                      &IntegratorHPMC::setMoveSizeGridTarget)
         .def_property("translation_move_probability",
                       &IntegratorHPMC::getTranslationMoveProbability,
                       &IntegratorHPMC::setTranslationMoveProbability);
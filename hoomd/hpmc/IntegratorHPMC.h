@@ -19,6 +19,8 @@
 #include "ExternalField.h"
 #include "HPMCCounters.h"
 
+#include <cmath>
+
 #ifndef __HIPCC__
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -206,6 +208,10 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
     //! Take one timestep forward
     virtual void update(uint64_t timestep)
         {
+        // adapt between sweeps so the scale field is frozen while moves are proposed
+        if (m_move_grid_dim != 0)
+            updateMoveGridScales();
+
         ArrayHandle<hpmc_counters_t> h_counters(m_count_total,
                                                 access_location::host,
                                                 access_mode::read);
@@ -330,6 +336,49 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
         return m_nselect;
         }
 
+    //! Enable free-volume-adaptive move sizes on a coarse spatial grid
+    /*! \param dim Number of grid cells along each edge of the global box (0 disables the grid)
+
+        Systems with a density gradient have no single good move size: the global optimum is
+        too small in the dilute regions and too large in the dense ones. With a grid enabled,
+        acceptance statistics are kept per cell and each cell scales the per-type move sizes
+        toward the target acceptance. The proposal asymmetry of a position-dependent
+        displacement size is removed with a Metropolis-Hastings correction in the trial loop.
+    */
+    void setMoveSizeGrid(unsigned int dim)
+        {
+        m_move_grid_dim = dim;
+        unsigned int ncells = dim * dim;
+        if (m_sysdef->getNDimensions() == 3)
+            ncells *= dim;
+        m_move_grid_scale.assign(ncells, Scalar(1.0));
+        m_move_grid_accept.assign(ncells, 0);
+        m_move_grid_trial.assign(ncells, 0);
+        updateCellWidth();
+        }
+
+    //! Get the adaptive move size grid dimension (0 when disabled)
+    unsigned int getMoveSizeGrid() const
+        {
+        return m_move_grid_dim;
+        }
+
+    //! Set the target acceptance ratio of the adaptive move size grid
+    void setMoveSizeGridTarget(Scalar target)
+        {
+        if (target <= Scalar(0.0) || target >= Scalar(1.0))
+            {
+            throw std::invalid_argument("move_size_grid_target must be in (0, 1)");
+            }
+        m_move_grid_target = target;
+        }
+
+    //! Get the target acceptance ratio of the adaptive move size grid
+    Scalar getMoveSizeGridTarget() const
+        {
+        return m_move_grid_target;
+        }
+
     //! Get performance in moves per second
     virtual double getMPS()
         {
@@ -480,6 +529,67 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
 
     std::shared_ptr<PatchEnergy> m_patch; //!< Patchy Interaction
 
+    /// Cells per edge of the adaptive move size grid (0 = disabled)
+    unsigned int m_move_grid_dim = 0;
+
+    /// Target acceptance ratio of the adaptive move size grid
+    Scalar m_move_grid_target = Scalar(0.2);
+
+    /// Per-cell move size scale factor
+    std::vector<Scalar> m_move_grid_scale;
+
+    /// Accepted moves per cell since the last adaptation
+    std::vector<unsigned int> m_move_grid_accept;
+
+    /// Trial moves per cell since the last adaptation
+    std::vector<unsigned int> m_move_grid_trial;
+
+    /// Bounds on the per-cell scale factor
+    static constexpr Scalar move_grid_scale_min = Scalar(0.1);
+    static constexpr Scalar move_grid_scale_max = Scalar(4.0);
+
+    //! Grid cell holding a position (valid only when the grid is enabled)
+    /*! Positions just outside the global box (unwrapped trial positions) map to the
+        periodic image of their cell.
+    */
+    unsigned int moveGridCell(const Scalar3& pos) const
+        {
+        const BoxDim& box = m_pdata->getGlobalBox();
+        Scalar3 f = box.makeFraction(pos);
+        const int dim = (int)m_move_grid_dim;
+        // floor before the modulo: truncation would map the first cell width below the
+        // box face to cell 0 instead of the periodic image of cell dim-1
+        int ib = (((int)std::floor(f.x * (Scalar)dim)) % dim + dim) % dim;
+        int jb = (((int)std::floor(f.y * (Scalar)dim)) % dim + dim) % dim;
+        if (m_sysdef->getNDimensions() == 2)
+            return ib * dim + jb;
+        int kb = (((int)std::floor(f.z * (Scalar)dim)) % dim + dim) % dim;
+        return (ib * dim + jb) * dim + kb;
+        }
+
+    //! Get the move size scale factor of a grid cell
+    Scalar getMoveGridScale(unsigned int cell) const
+        {
+        return m_move_grid_scale[cell];
+        }
+
+    //! The largest scale the grid can apply to a move size
+    Scalar getMaxMoveGridScale() const
+        {
+        return m_move_grid_dim != 0 ? move_grid_scale_max : Scalar(1.0);
+        }
+
+    //! Record the outcome of one trial move
+    void recordMoveGridTrial(unsigned int cell, bool accept)
+        {
+        m_move_grid_trial[cell]++;
+        if (accept)
+            m_move_grid_accept[cell]++;
+        }
+
+    //! Adapt the per-cell scale factors from the accumulated acceptance statistics
+    void updateMoveGridScales();
+
     private:
     hpmc_counters_t m_count_run_start;  //!< Count saved at run() start
     hpmc_counters_t m_count_step_start; //!< Count saved at the start of the last step
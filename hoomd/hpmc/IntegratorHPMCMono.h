@@ -233,6 +233,13 @@ class IntegratorHPMCMono : public IntegratorHPMC
         //! Set the pair parameters for a single type
         virtual void setParam(unsigned int typ, const param_type& param);
 
+        //! Set the patch energy and refresh the per-type query radii
+        virtual void setPatchEnergy(std::shared_ptr<PatchEnergy> patch)
+            {
+            IntegratorHPMC::setPatchEnergy(patch);
+            updateCellWidth();
+            }
+
         //! Set shape parameters from python
         void setShape(std::string typ, pybind11::dict v);
 
@@ -274,6 +281,9 @@ class IntegratorHPMCMono : public IntegratorHPMC
         //! Count overlaps with the option to exit early at the first detected overlap
         virtual unsigned int countOverlaps(bool early_exit);
 
+        //! Count overlaps involving particles of one type only
+        virtual unsigned int countOverlapsType(unsigned int typ, bool early_exit);
+
         //! Return a vector that is an unwrapped overlap map
         virtual std::vector<std::pair<unsigned int, unsigned int> > mapOverlaps();
 
@@ -417,6 +427,23 @@ class IntegratorHPMCMono : public IntegratorHPMC
             return type_shapes;
             }
 
+        //! Enable or disable batched trial moves
+        /*! \param batch_moves True to attempt trial moves in waves of non-interacting particles
+
+            Batched moves only take effect on the CPU when no depletants, patch energies or
+            external fields are in use; otherwise moves are attempted one at a time as usual.
+        */
+        void setBatchedMoves(bool batch_moves)
+            {
+            m_batch_moves = batch_moves;
+            }
+
+        //! Get whether batched trial moves are enabled
+        bool getBatchedMoves() const
+            {
+            return m_batch_moves;
+            }
+
     protected:
         std::vector<param_type, hoomd::detail::managed_allocator<param_type> > m_params;   //!< Parameters for each particle type on GPU
         GlobalArray<unsigned int> m_overlaps;          //!< Interaction matrix (0/1) for overlap checks
@@ -438,8 +465,18 @@ class IntegratorHPMCMono : public IntegratorHPMC
 
         Scalar m_extra_image_width;                 //! Extra width to extend the image list
 
+        std::vector<ShortReal> m_patch_query_radius; //!< Patch AABB query radius per type, set in updateCellWidth()
+
         Index2D m_overlap_idx;                      //!!< Indexer for interaction matrix
 
+        bool m_batch_moves;                         //!< True when trial moves are attempted in batched waves
+
+        /* Cache of old-configuration patch energies, valid within one call to update() */
+
+        std::vector<double> m_patch_energy_cache;          //!< Local patch energy per particle
+        std::vector<char> m_patch_energy_cache_valid;      //!< Nonzero when the cached energy is current
+        std::vector<unsigned int> m_patch_cache_neighbors; //!< Scratch list of neighbors to invalidate
+
         /* Depletants related data members */
 
         GlobalVector<Scalar> m_fugacity;            //!< Average depletant number density in free volume, per type
@@ -456,6 +493,14 @@ class IntegratorHPMCMono : public IntegratorHPMC
             uint64_t timestep, hoomd::RandomGenerator& rng_depletants,
             unsigned int seed_i_old, unsigned int seed_i_new);
 
+        //! Attempt the trial moves of one nselect sweep in batched waves
+        inline bool attemptMovesBatched(uint64_t timestep, unsigned int i_nselect,
+            const unsigned int *h_overlaps, hpmc_counters_t& counters);
+
+        //! Invalidate the cached patch energies of the neighbors of a particle
+        inline void invalidatePatchEnergyCacheNeighbors(unsigned int i, const vec3<Scalar>& pos_i,
+            const hoomd::detail::AABB& aabb_i_local, ShortReal r_cut_patch, const Scalar4 *h_postype);
+
         //! Set the nominal width appropriate for looped moves
         virtual void updateCellWidth();
 
@@ -520,6 +565,8 @@ IntegratorHPMCMono<Shape>::IntegratorHPMCMono(std::shared_ptr<SystemDefinition>
     m_aabbs_capacity = 0;
     m_aabb_tree_invalid = true;
 
+    m_batch_moves = false;
+
     m_fugacity.resize(this->m_pdata->getNTypes(), 0.0);
     m_ntrial.resize(m_fugacity.getNumElements(), 1);
     TAG_ALLOCATION(m_fugacity);
@@ -585,6 +632,410 @@ void IntegratorHPMCMono<Shape>::resetStats()
         m_implicit_count_run_start[i] = h_counters.data[i];
     }
 
+/*! \param i particle whose neighborhood is traversed
+    \param pos_i center of the query (the old position of particle i)
+    \param aabb_i_local the query AABB of particle i, centered at the origin
+    \param r_cut_patch patch cutoff of particle i, including its additive contribution
+    \param h_postype pointer to the particle positions and types
+
+    Mark the cached patch energies of all particles interacting with particle i at
+    \a pos_i as stale. Used when a move is accepted but the old-configuration energy
+    came from the cache, so the old neighborhood was never traversed.
+*/
+template <class Shape>
+inline void IntegratorHPMCMono<Shape>::invalidatePatchEnergyCacheNeighbors(unsigned int i,
+    const vec3<Scalar>& pos_i, const hoomd::detail::AABB& aabb_i_local, ShortReal r_cut_patch,
+    const Scalar4 *h_postype)
+    {
+    const unsigned int n_images = (unsigned int)m_image_list.size();
+    for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
+        {
+        vec3<Scalar> pos_i_image = pos_i + m_image_list[cur_image];
+        hoomd::detail::AABB aabb = aabb_i_local;
+        aabb.translate(pos_i_image);
+
+        // stackless search
+        for (unsigned int cur_node_idx = 0; cur_node_idx < m_aabb_tree.getNumNodes(); cur_node_idx++)
+            {
+            if (detail::overlap(m_aabb_tree.getNodeAABB(cur_node_idx), aabb))
+                {
+                if (m_aabb_tree.isNodeLeaf(cur_node_idx))
+                    {
+                    for (unsigned int cur_p = 0; cur_p < m_aabb_tree.getNodeNumParticles(cur_node_idx); cur_p++)
+                        {
+                        unsigned int j = m_aabb_tree.getNodeParticle(cur_node_idx, cur_p);
+
+                        // only local particles carry a cache entry
+                        if (j == i || j >= m_pdata->getN())
+                            continue;
+
+                        Scalar4 postype_j = h_postype[j];
+                        vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
+                        unsigned int typ_j = __scalar_as_int(postype_j.w);
+                        Scalar rcut = r_cut_patch + 0.5 * m_patch->getAdditiveCutoff(typ_j);
+
+                        if (dot(r_ij,r_ij) <= rcut*rcut)
+                            m_patch_energy_cache_valid[j] = 0;
+                        }
+                    }
+                }
+            else
+                {
+                // skip ahead
+                cur_node_idx += m_aabb_tree.getNodeSkip(cur_node_idx);
+                }
+            }  // end loop over AABB nodes
+        } // end loop over images
+    }
+
+/*! \param timestep current step
+    \param i_nselect index of the current nselect sweep
+    \param h_overlaps the interaction matrix
+    \param counters the move counters to update
+    \returns true when the sweep has been performed, false when batching is not applicable
+
+    Attempt the trial moves of one sweep in waves of mutually non-interacting particles.
+    Each wave is a prefix of the shuffled update order: particles are added until one is
+    found whose move could interact with a move already in the wave, so the sequence in
+    which moves are attempted is identical to the sequential path. Two moves cannot
+    interact when the old positions are separated by more than the sum of the particles'
+    circumsphere radii plus maximum displacements, hence the moves within a wave commute
+    and may be evaluated in any order.
+
+    For every wave member the AABB tree traversal only gathers the candidate neighbors
+    into contiguous buffers; the circumsphere prefilter and the narrow phase overlap
+    tests then run as tight loops over those buffers.
+
+    The independence test relies on the minimum image convention, so this method declines
+    (returns false) when the interaction reach is too large relative to the box. Trial
+    moves are drawn from the same per-particle RNG streams as the sequential path; the
+    particle that ends one wave regenerates its move unchanged at the start of the next.
+*/
+template <class Shape>
+inline bool IntegratorHPMCMono<Shape>::attemptMovesBatched(uint64_t timestep,
+    unsigned int i_nselect, const unsigned int *h_overlaps, hpmc_counters_t& counters)
+    {
+    const BoxDim box = m_pdata->getBox();
+    unsigned int ndim = this->m_sysdef->getNDimensions();
+
+    #ifdef ENABLE_MPI
+    // compute the width of the active region
+    Scalar3 npd = box.getNearestPlaneDistance();
+    Scalar3 ghost_fraction = m_nominal_width / npd;
+    #else
+    Scalar3 npd = box.getNearestPlaneDistance();
+    #endif
+
+    uint16_t seed = m_sysdef->getSeed();
+
+    // access particle data and move sizes
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar> h_d(m_d, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_a(m_a, access_location::host, access_mode::read);
+
+    // reach of a trial move per type: the circumsphere radius plus the maximum displacement
+    std::vector<Scalar> r_interact(m_pdata->getNTypes());
+    Scalar max_interact(0.0);
+    for (unsigned int typ = 0; typ < m_pdata->getNTypes(); typ++)
+        {
+        Shape shape_typ(quat<Scalar>(), m_params[typ]);
+        r_interact[typ] = Scalar(0.5)*shape_typ.getCircumsphereDiameter() + h_d.data[typ];
+        max_interact = std::max(max_interact, r_interact[typ]);
+        }
+
+    // the independence test below uses the minimum image convention, which requires that
+    // the combined reach of two moves fits within half the box
+    Scalar min_npd = std::min(npd.x, npd.y);
+    if (ndim == 3)
+        min_npd = std::min(min_npd, npd.z);
+    if (Scalar(4.0)*max_interact >= min_npd)
+        return false;
+
+    // a trial move staged for the current wave
+    struct trial_move
+        {
+        unsigned int idx;                //!< Particle index
+        unsigned int type;               //!< Particle type
+        bool translate;                  //!< True when this is a translation move
+        vec3<Scalar> pos_old;            //!< Position before the move
+        vec3<Scalar> pos_new;            //!< Position after the move
+        quat<Scalar> orientation_new;    //!< Orientation after the move
+        Scalar4 postype_old;             //!< Position and type before the move
+        };
+
+    // cap the wave size to bound the cost of the pairwise independence checks
+    const unsigned int max_wave = 64;
+
+    std::vector<trial_move> wave;
+    wave.reserve(max_wave);
+
+    // contiguous candidate buffers, reused across wave members
+    std::vector<vec3<Scalar> > cand_rij;
+    std::vector<unsigned int> cand_type;
+    std::vector<quat<Scalar> > cand_orientation;
+    std::vector<unsigned int> cand_pass;
+
+    const unsigned int n_images = (unsigned int)m_image_list.size();
+
+    unsigned int cur_particle = 0;
+    while (cur_particle < m_pdata->getN())
+        {
+        wave.clear();
+
+        // build a wave: consume particles from the shuffled order until one conflicts
+        // with a move already staged (or the wave is full)
+        while (cur_particle < m_pdata->getN() && (unsigned int)wave.size() < max_wave)
+            {
+            unsigned int i = m_update_order[cur_particle];
+
+            // read in the current position and orientation
+            Scalar4 postype_i = h_postype.data[i];
+            Scalar4 orientation_i = h_orientation.data[i];
+            vec3<Scalar> pos_i = vec3<Scalar>(postype_i);
+
+            #ifdef ENABLE_MPI
+            if (m_sysdef->isDomainDecomposed())
+                {
+                // only move particle if active
+                if (!isActive(make_scalar3(postype_i.x, postype_i.y, postype_i.z), box, ghost_fraction))
+                    {
+                    cur_particle++;
+                    continue;
+                    }
+                }
+            #endif
+
+            // make a trial move for i, drawing from the same per-particle RNG stream as
+            // the sequential path
+            hoomd::RandomGenerator rng_i(hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoTrialMove, timestep, seed),
+                                         hoomd::Counter(i, m_exec_conf->getRank(), i_nselect));
+            int typ_i = __scalar_as_int(postype_i.w);
+            Shape shape_i(quat<Scalar>(orientation_i), m_params[typ_i]);
+            unsigned int move_type_select = hoomd::UniformIntDistribution(0xffff)(rng_i);
+            bool move_type_translate = !shape_i.hasOrientation() || (move_type_select < m_translation_move_probability);
+
+            vec3<Scalar> pos_old = pos_i;
+
+            if (move_type_translate)
+                {
+                // skip if no overlap check is required
+                if (h_d.data[typ_i] == 0.0)
+                    {
+                    if (!shape_i.ignoreStatistics())
+                        counters.translate_accept_count++;
+                    cur_particle++;
+                    continue;
+                    }
+
+                move_translate(pos_i, rng_i, h_d.data[typ_i], ndim);
+
+                #ifdef ENABLE_MPI
+                if (m_sysdef->isDomainDecomposed())
+                    {
+                    // check if particle has moved into the ghost layer, and skip if it is
+                    if (!isActive(vec_to_scalar3(pos_i), box, ghost_fraction))
+                        {
+                        cur_particle++;
+                        continue;
+                        }
+                    }
+                #endif
+                }
+            else
+                {
+                if (h_a.data[typ_i] == 0.0)
+                    {
+                    if (!shape_i.ignoreStatistics())
+                        counters.rotate_accept_count++;
+                    cur_particle++;
+                    continue;
+                    }
+
+                if (ndim == 2)
+                    move_rotate<2>(shape_i.orientation, rng_i, h_a.data[typ_i]);
+                else
+                    move_rotate<3>(shape_i.orientation, rng_i, h_a.data[typ_i]);
+                }
+
+            // the move is independent of the staged wave when the old positions are
+            // farther apart than the combined reach of both moves
+            bool independent = true;
+            for (unsigned int m = 0; m < (unsigned int)wave.size(); m++)
+                {
+                Scalar3 dr = box.minImage(vec_to_scalar3(pos_old - wave[m].pos_old));
+                Scalar reach = r_interact[typ_i] + r_interact[wave[m].type];
+                if (dr.x*dr.x + dr.y*dr.y + dr.z*dr.z <= reach*reach)
+                    {
+                    independent = false;
+                    break;
+                    }
+                }
+
+            if (!independent)
+                {
+                // i starts the next wave; its RNG stream regenerates the same move
+                break;
+                }
+
+            trial_move move;
+            move.idx = i;
+            move.type = (unsigned int)typ_i;
+            move.translate = move_type_translate;
+            move.pos_old = pos_old;
+            move.pos_new = pos_i;
+            move.orientation_new = shape_i.orientation;
+            move.postype_old = postype_i;
+            wave.push_back(move);
+            cur_particle++;
+            }
+
+        // evaluate the staged moves; wave members cannot interact, so the outcome does
+        // not depend on the order within the wave
+        for (unsigned int m = 0; m < (unsigned int)wave.size(); m++)
+            {
+            const trial_move& move = wave[m];
+            Shape shape_i(move.orientation_new, m_params[move.type]);
+
+            ShortReal R_query = shape_i.getCircumsphereDiameter()/ShortReal(2.0);
+            hoomd::detail::AABB aabb_i_local = hoomd::detail::AABB(vec3<Scalar>(0,0,0), R_query);
+
+            // gather the candidate neighbors into contiguous buffers
+            cand_rij.clear();
+            cand_type.clear();
+            cand_orientation.clear();
+
+            // All image boxes (including the primary)
+            for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
+                {
+                vec3<Scalar> pos_i_image = move.pos_new + m_image_list[cur_image];
+                hoomd::detail::AABB aabb = aabb_i_local;
+                aabb.translate(pos_i_image);
+
+                // stackless search
+                for (unsigned int cur_node_idx = 0; cur_node_idx < m_aabb_tree.getNumNodes(); cur_node_idx++)
+                    {
+                    if (detail::overlap(m_aabb_tree.getNodeAABB(cur_node_idx), aabb))
+                        {
+                        if (m_aabb_tree.isNodeLeaf(cur_node_idx))
+                            {
+                            for (unsigned int cur_p = 0; cur_p < m_aabb_tree.getNodeNumParticles(cur_node_idx); cur_p++)
+                                {
+                                // read in its position and orientation
+                                unsigned int j = m_aabb_tree.getNodeParticle(cur_node_idx, cur_p);
+
+                                Scalar4 postype_j;
+                                Scalar4 orientation_j;
+
+                                // handle j==i situations
+                                if (j != move.idx)
+                                    {
+                                    // load the position and orientation of the j particle
+                                    postype_j = h_postype.data[j];
+                                    orientation_j = h_orientation.data[j];
+                                    }
+                                else
+                                    {
+                                    if (cur_image == 0)
+                                        {
+                                        // in the first image, skip i == j
+                                        continue;
+                                        }
+                                    else
+                                        {
+                                        // If this is particle i and we are in an outside image, use the translated position and orientation
+                                        postype_j = make_scalar4(move.pos_new.x, move.pos_new.y, move.pos_new.z, move.postype_old.w);
+                                        orientation_j = quat_to_scalar4(move.orientation_new);
+                                        }
+                                    }
+
+                                unsigned int typ_j = __scalar_as_int(postype_j.w);
+
+                                counters.overlap_checks++;
+                                if (!h_overlaps[m_overlap_idx(move.type, typ_j)])
+                                    continue;
+
+                                // put particles in coordinate system of particle i
+                                cand_rij.push_back(vec3<Scalar>(postype_j) - pos_i_image);
+                                cand_type.push_back(typ_j);
+                                cand_orientation.push_back(quat<Scalar>(orientation_j));
+                                }
+                            }
+                        }
+                    else
+                        {
+                        // skip ahead
+                        cur_node_idx += m_aabb_tree.getNodeSkip(cur_node_idx);
+                        }
+                    }  // end loop over AABB nodes
+                } // end loop over images
+
+            // circumsphere prefilter as a tight loop over the contiguous buffers
+            cand_pass.clear();
+            for (unsigned int k = 0; k < (unsigned int)cand_rij.size(); k++)
+                {
+                Shape shape_j(cand_orientation[k], m_params[cand_type[k]]);
+                if (check_circumsphere_overlap(cand_rij[k], shape_i, shape_j))
+                    cand_pass.push_back(k);
+                }
+
+            // narrow phase on the survivors only
+            bool overlap = false;
+            for (unsigned int p = 0; p < (unsigned int)cand_pass.size(); p++)
+                {
+                unsigned int k = cand_pass[p];
+                Shape shape_j(cand_orientation[k], m_params[cand_type[k]]);
+                if (test_overlap(cand_rij[k], shape_i, shape_j, counters.overlap_err_count))
+                    {
+                    overlap = true;
+                    break;
+                    }
+                }
+
+            // If there are no overlaps, accept the trial move and update the position
+            // and/or orientation (without depletants, patch energies and external fields
+            // the Metropolis factor is exactly one)
+            if (!overlap)
+                {
+                // increment accept counter and assign new position
+                if (!shape_i.ignoreStatistics())
+                    {
+                    if (move.translate)
+                        counters.translate_accept_count++;
+                    else
+                        counters.rotate_accept_count++;
+                    }
+
+                // update the position of the particle in the tree for future updates
+                hoomd::detail::AABB aabb = aabb_i_local;
+                aabb.translate(move.pos_new);
+                m_aabb_tree.update(move.idx, aabb);
+
+                // update position of particle
+                h_postype.data[move.idx] = make_scalar4(move.pos_new.x, move.pos_new.y, move.pos_new.z, move.postype_old.w);
+
+                if (shape_i.hasOrientation())
+                    {
+                    h_orientation.data[move.idx] = quat_to_scalar4(move.orientation_new);
+                    }
+                }
+            else
+                {
+                if (!shape_i.ignoreStatistics())
+                    {
+                    // increment reject counter
+                    if (move.translate)
+                        counters.translate_reject_count++;
+                    else
+                        counters.rotate_reject_count++;
+                    }
+                }
+            } // end loop over the wave
+        } // end loop over waves
+
+    return true;
+    }
+
 template <class Shape>
 void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
     {
@@ -619,6 +1070,14 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
     // update the image list
     updateImageList();
 
+    if (m_patch)
+        {
+        // old-configuration patch energies are cached across the sweeps of this call only,
+        // as ghosts, the box and the particle order may all change between calls
+        m_patch_energy_cache.resize(m_pdata->getN());
+        m_patch_energy_cache_valid.assign(m_pdata->getN(), 0);
+        }
+
     bool has_depletants = false;
     for (unsigned int i = 0; i < m_fugacity.getNumElements(); ++i)
         {
@@ -640,9 +1099,18 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
     // access interaction matrix
     ArrayHandle<unsigned int> h_overlaps(m_overlaps, access_location::host, access_mode::read);
 
+    // batched moves only apply when the acceptance criterion is a pure overlap check; the
+    // wave construction also sizes its interaction reach from the unscaled per-type move
+    // sizes, so it does not apply when the adaptive move size grid is active
+    const bool batch_moves
+        = m_batch_moves && !has_depletants && !m_patch && !m_external && m_move_grid_dim == 0;
+
     // loop over local particles nselect times
     for (unsigned int i_nselect = 0; i_nselect < m_nselect; i_nselect++)
         {
+        if (batch_moves && attemptMovesBatched(timestep, i_nselect, h_overlaps.data, counters))
+            continue;
+
         // access particle data and system box
         ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::readwrite);
         ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::readwrite);
@@ -685,6 +1153,16 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
             Shape shape_old(quat<Scalar>(orientation_i), m_params[typ_i]);
             vec3<Scalar> pos_old = pos_i;
 
+            // look up the local move size scale factor (frozen for the whole sweep)
+            const bool use_move_grid = m_move_grid_dim != 0;
+            unsigned int move_grid_cell = 0;
+            Scalar move_scale = Scalar(1.0);
+            if (use_move_grid)
+                {
+                move_grid_cell = moveGridCell(vec_to_scalar3(pos_old));
+                move_scale = getMoveGridScale(move_grid_cell);
+                }
+
             if (move_type_translate)
                 {
                 // skip if no overlap check is required
@@ -695,7 +1173,7 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                     continue;
                     }
 
-                move_translate(pos_i, rng_i, h_d.data[typ_i], ndim);
+                move_translate(pos_i, rng_i, h_d.data[typ_i] * move_scale, ndim);
 
                 #ifdef ENABLE_MPI
                 if (m_sysdef->isDomainDecomposed())
@@ -716,9 +1194,9 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                     }
 
                 if (ndim == 2)
-                    move_rotate<2>(shape_i.orientation, rng_i, h_a.data[typ_i]);
+                    move_rotate<2>(shape_i.orientation, rng_i, h_a.data[typ_i] * move_scale);
                 else
-                    move_rotate<3>(shape_i.orientation, rng_i, h_a.data[typ_i]);
+                    move_rotate<3>(shape_i.orientation, rng_i, h_a.data[typ_i] * move_scale);
                 }
 
 
@@ -731,13 +1209,21 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                     static_cast<ShortReal>(m_patch->getAdditiveCutoff(typ_i));
                 }
 
-            // subtract minimum AABB extent from search radius
-            ShortReal R_query = std::max(shape_i.getCircumsphereDiameter()/ShortReal(2.0),
-                r_cut_patch-getMinCoreDiameter()/(ShortReal)2.0);
+            // use the tight per-type-pair search radius precomputed in updateCellWidth()
+            ShortReal R_query = shape_i.getCircumsphereDiameter()/ShortReal(2.0);
+            if (m_patch && typ_i < m_patch_query_radius.size())
+                R_query = std::max(R_query, m_patch_query_radius[typ_i]);
             hoomd::detail::AABB aabb_i_local = hoomd::detail::AABB(vec3<Scalar>(0,0,0),R_query);
 
             // patch + field interaction deltaU
             double patch_field_energy_diff = 0;
+            double patch_energy_new = 0;
+            double patch_energy_old = 0;
+
+            // reuse the cached old-configuration energy when it is still current
+            bool patch_energy_old_cached = m_patch && m_patch_energy_cache_valid[i];
+            if (m_patch)
+                m_patch_cache_neighbors.clear();
 
             // check for overlaps with neighboring particle's positions (also calculate the new energy)
             // All image boxes (including the primary)
@@ -806,16 +1292,20 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                                     }
                                 else if (m_patch && dot(r_ij,r_ij) <= rcut*rcut) // If there is no overlap and m_patch is not NULL, calculate energy
                                     {
-                                    // deltaU = U_old - U_new: subtract energy of new configuration
-                                    patch_field_energy_diff -= m_patch->energy(r_ij, typ_i,
-                                                               quat<float>(shape_i.orientation),
-                                                               float(h_diameter.data[i]),
-                                                               float(h_charge.data[i]),
-                                                               typ_j,
-                                                               quat<float>(orientation_j),
-                                                               float(h_diameter.data[j]),
-                                                               float(h_charge.data[j])
-                                                               );
+                                    // deltaU = U_old - U_new: accumulate energy of new configuration
+                                    patch_energy_new += m_patch->energy(r_ij, typ_i,
+                                                        quat<float>(shape_i.orientation),
+                                                        float(h_diameter.data[i]),
+                                                        float(h_charge.data[i]),
+                                                        typ_j,
+                                                        quat<float>(orientation_j),
+                                                        float(h_diameter.data[j]),
+                                                        float(h_charge.data[j])
+                                                        );
+
+                                    // the cached energy of j goes stale if the move is accepted
+                                    if (j != i && j < m_pdata->getN())
+                                        m_patch_cache_neighbors.push_back(j);
                                     }
                                 }
                             }
@@ -834,8 +1324,12 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                     break;
                 } // end loop over images
 
-            // calculate old patch energy only if m_patch not NULL and no overlaps
-            if (m_patch && !overlap)
+            // look up or calculate the old patch energy only if m_patch not NULL and no overlaps
+            if (m_patch && !overlap && patch_energy_old_cached)
+                {
+                patch_energy_old = m_patch_energy_cache[i];
+                }
+            else if (m_patch && !overlap)
                 {
                 for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
                     {
@@ -887,17 +1381,23 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
 
                                     Scalar rcut = r_cut_patch + 0.5 * m_patch->getAdditiveCutoff(typ_j);
 
-                                    // deltaU = U_old - U_new: add energy of old configuration
+                                    // deltaU = U_old - U_new: accumulate energy of old configuration
                                     if (dot(r_ij,r_ij) <= rcut*rcut)
-                                        patch_field_energy_diff += m_patch->energy(r_ij,
-                                                                   typ_i,
-                                                                   quat<float>(orientation_i),
-                                                                   float(h_diameter.data[i]),
-                                                                   float(h_charge.data[i]),
-                                                                   typ_j,
-                                                                   quat<float>(orientation_j),
-                                                                   float(h_diameter.data[j]),
-                                                                   float(h_charge.data[j]));
+                                        {
+                                        patch_energy_old += m_patch->energy(r_ij,
+                                                            typ_i,
+                                                            quat<float>(orientation_i),
+                                                            float(h_diameter.data[i]),
+                                                            float(h_charge.data[i]),
+                                                            typ_j,
+                                                            quat<float>(orientation_j),
+                                                            float(h_diameter.data[j]),
+                                                            float(h_charge.data[j]));
+
+                                        // the cached energy of j goes stale if the move is accepted
+                                        if (j != i && j < m_pdata->getN())
+                                            m_patch_cache_neighbors.push_back(j);
+                                        }
                                     }
                                 }
                             }
@@ -910,13 +1410,32 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                     } // end loop over images
                 } // end if (m_patch)
 
+            if (m_patch && !overlap)
+                patch_field_energy_diff = patch_energy_old - patch_energy_new;
+
             // Add external energetic contribution if there are no overlaps
             if (m_external && !overlap)
                 {
                 patch_field_energy_diff -= m_external->energydiff(timestep, i, pos_old, shape_old, pos_i, shape_i);
                 }
 
-            bool accept = !overlap && hoomd::detail::generate_canonical<double>(rng_i) < slow::exp(patch_field_energy_diff);
+            // Metropolis-Hastings correction for the position dependent translation size: the
+            // forward move was drawn with the scale at the old position, so weight by the ratio
+            // of reverse to forward proposal densities and reject outright when the reverse
+            // move could not have been proposed at all
+            double proposal_ratio = 1.0;
+            if (use_move_grid && move_type_translate)
+                {
+                Scalar d_old = h_d.data[typ_i] * move_scale;
+                Scalar d_new = h_d.data[typ_i] * getMoveGridScale(moveGridCell(vec_to_scalar3(pos_i)));
+                vec3<Scalar> dr = pos_i - pos_old;
+                if (dot(dr, dr) > d_new * d_new)
+                    proposal_ratio = 0.0;
+                else if (d_old != d_new)
+                    proposal_ratio = slow::pow(double(d_old) / double(d_new), double(ndim));
+                }
+
+            bool accept = !overlap && hoomd::detail::generate_canonical<double>(rng_i) < slow::exp(patch_field_energy_diff) * proposal_ratio;
 
             // The trial move is valid, so check if it is invalidated by depletants
             unsigned int seed_i_new = hoomd::detail::generate_u32(rng_i);
@@ -940,6 +1459,9 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                         counters.translate_accept_count++;
                     else
                         counters.rotate_accept_count++;
+
+                    if (use_move_grid)
+                        recordMoveGridTrial(move_grid_cell, true);
                     }
 
                 // update the position of the particle in the tree for future updates
@@ -955,6 +1477,21 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                     h_orientation.data[i] = quat_to_scalar4(shape_i.orientation);
                     }
 
+                if (m_patch)
+                    {
+                    // the local energies of the old and new neighbors are now stale; when the
+                    // old energy came from the cache the old neighborhood was never traversed
+                    if (patch_energy_old_cached)
+                        invalidatePatchEnergyCacheNeighbors(i, pos_old, aabb_i_local, r_cut_patch, h_postype.data);
+
+                    for (unsigned int n = 0; n < (unsigned int)m_patch_cache_neighbors.size(); n++)
+                        m_patch_energy_cache_valid[m_patch_cache_neighbors[n]] = 0;
+
+                    // the new-configuration energy is the local energy of i from now on
+                    m_patch_energy_cache[i] = patch_energy_new;
+                    m_patch_energy_cache_valid[i] = 1;
+                    }
+
                 // store new seed
                 if (has_depletants)
                     h_vel.data[i].x = __int_as_scalar(seed_i_new);
@@ -968,6 +1505,16 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                         counters.translate_reject_count++;
                     else
                         counters.rotate_reject_count++;
+
+                    if (use_move_grid)
+                        recordMoveGridTrial(move_grid_cell, false);
+                    }
+
+                // a rejected move leaves the old local energy of i intact
+                if (m_patch && !overlap)
+                    {
+                    m_patch_energy_cache[i] = patch_energy_old;
+                    m_patch_energy_cache_valid[i] = 1;
                     }
                 }
             } // end loop over all particles
@@ -1146,6 +1693,137 @@ unsigned int IntegratorHPMCMono<Shape>::countOverlaps(bool early_exit)
     return overlap_count;
     }
 
+/*! \param typ Type id whose pair overlaps are checked
+    \param early_exit exit at first overlap found if true
+    \returns number of overlaps involving type \a typ if early_exit=false, 1 if early_exit=true
+
+    Only pairs with at least one particle of type \a typ are tested. When a trial modifies the
+    shape parameters of a single type (e.g. in UpdaterShape), the overlap status of all other
+    pairs is unchanged, so a check restricted to the modified type decides acceptance at a
+    fraction of the cost of countOverlaps(). The configuration is assumed to be free of
+    overlaps among the unmodified types.
+*/
+template <class Shape>
+unsigned int IntegratorHPMCMono<Shape>::countOverlapsType(unsigned int typ, bool early_exit)
+    {
+    unsigned int overlap_count = 0;
+    unsigned int err_count = 0;
+
+    // build an up to date AABB tree
+    buildAABBTree();
+    // update the image list
+    updateImageList();
+
+    // access particle data and system box
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+
+    // access parameters and interaction matrix
+    ArrayHandle<unsigned int> h_overlaps(m_overlaps, access_location::host, access_mode::read);
+
+    // Loop over all particles of the requested type
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        {
+        // read in the current position and orientation
+        Scalar4 postype_i = h_postype.data[i];
+        unsigned int typ_i = __scalar_as_int(postype_i.w);
+        if (typ_i != typ)
+            continue;
+
+        Scalar4 orientation_i = h_orientation.data[i];
+        Shape shape_i(quat<Scalar>(orientation_i), m_params[typ_i]);
+        vec3<Scalar> pos_i = vec3<Scalar>(postype_i);
+
+        // Check particle against AABB tree for neighbors
+        hoomd::detail::AABB aabb_i_local = shape_i.getAABB(vec3<Scalar>(0,0,0));
+
+        const unsigned int n_images = (unsigned int)m_image_list.size();
+        for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
+            {
+            vec3<Scalar> pos_i_image = pos_i + m_image_list[cur_image];
+            hoomd::detail::AABB aabb = aabb_i_local;
+            aabb.translate(pos_i_image);
+
+            // stackless search
+            for (unsigned int cur_node_idx = 0; cur_node_idx < m_aabb_tree.getNumNodes(); cur_node_idx++)
+                {
+                if (detail::overlap(m_aabb_tree.getNodeAABB(cur_node_idx), aabb))
+                    {
+                    if (m_aabb_tree.isNodeLeaf(cur_node_idx))
+                        {
+                        for (unsigned int cur_p = 0; cur_p < m_aabb_tree.getNodeNumParticles(cur_node_idx); cur_p++)
+                            {
+                            // read in its position and orientation
+                            unsigned int j = m_aabb_tree.getNodeParticle(cur_node_idx, cur_p);
+
+                            // skip i==j in the 0 image
+                            if (cur_image == 0 && i == j)
+                                continue;
+
+                            Scalar4 postype_j = h_postype.data[j];
+                            Scalar4 orientation_j = h_orientation.data[j];
+
+                            // put particles in coordinate system of particle i
+                            vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
+
+                            unsigned int typ_j = __scalar_as_int(postype_j.w);
+                            Shape shape_j(quat<Scalar>(orientation_j), m_params[typ_j]);
+
+                            // dedupe same-type pairs by tag; pairs with other types are only
+                            // visited from the particle of the requested type
+                            if ((typ_j != typ || h_tag.data[i] <= h_tag.data[j])
+                                && h_overlaps.data[m_overlap_idx(typ_i,typ_j)]
+                                && check_circumsphere_overlap(r_ij, shape_i, shape_j)
+                                && test_overlap(r_ij, shape_i, shape_j, err_count)
+                                && test_overlap(-r_ij, shape_j, shape_i, err_count))
+                                {
+                                overlap_count++;
+                                if (early_exit)
+                                    {
+                                    // exit early from loop over neighbor particles
+                                    break;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                else
+                    {
+                    // skip ahead
+                    cur_node_idx += m_aabb_tree.getNodeSkip(cur_node_idx);
+                    }
+
+                if (overlap_count && early_exit)
+                    {
+                    break;
+                    }
+                } // end loop over AABB nodes
+
+            if (overlap_count && early_exit)
+                {
+                break;
+                }
+            } // end loop over images
+
+        if (overlap_count && early_exit)
+            {
+            break;
+            }
+        } // end loop over particles
+
+    #ifdef ENABLE_MPI
+    if (this->m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE, &overlap_count, 1, MPI_UNSIGNED, MPI_SUM, m_exec_conf->getMPICommunicator());
+        if (early_exit && overlap_count > 1)
+            overlap_count = 1;
+        }
+    #endif
+
+    return overlap_count;
+    }
+
 template<class Shape>
 float IntegratorHPMCMono<Shape>::computePatchEnergy(uint64_t timestep)
     {
@@ -1193,9 +1871,10 @@ float IntegratorHPMCMono<Shape>::computePatchEnergy(uint64_t timestep)
         // the cut-off
         ShortReal r_cut = ShortReal(m_patch->getRCut() + 0.5*m_patch->getAdditiveCutoff(typ_i));
 
-        // subtract minimum AABB extent from search radius
-        ShortReal R_query = std::max(shape_i.getCircumsphereDiameter()/ShortReal(2.0),
-            r_cut-getMinCoreDiameter()/(ShortReal)2.0);
+        // use the tight per-type-pair search radius precomputed in updateCellWidth()
+        ShortReal R_query = shape_i.getCircumsphereDiameter()/ShortReal(2.0);
+        if (typ_i < m_patch_query_radius.size())
+            R_query = std::max(R_query, m_patch_query_radius[typ_i]);
         hoomd::detail::AABB aabb_i_local = hoomd::detail::AABB(vec3<Scalar>(0,0,0),R_query);
 
         const unsigned int n_images = (unsigned int)m_image_list.size();
@@ -1450,7 +2129,9 @@ inline const std::vector<vec3<Scalar> >& IntegratorHPMCMono<Shape>::updateImageL
                 Scalar range_ij = detail::max(r_cut_shape,r_cut_patch_ij);
                 range_i = detail::max(range_i,range_ij);
                 }
-            max_trans_d_and_diam = detail::max(max_trans_d_and_diam, range_i+Scalar(m_nselect)*h_d.data[typ_i]);
+            // the adaptive move size grid can enlarge trial moves up to its maximum scale
+            max_trans_d_and_diam = detail::max(max_trans_d_and_diam,
+                range_i+Scalar(m_nselect)*h_d.data[typ_i]*getMaxMoveGridScale());
             }
         }
 
@@ -1620,6 +2301,30 @@ void IntegratorHPMCMono<Shape>::updateCellWidth()
 
         this->m_nominal_width = std::max(this->m_nominal_width, this->m_patch->getRCut() + max_extent);
         }
+
+    // precompute the per-type patch query radius: the AABB tree holds the neighbor cores, so a
+    // query from type i only needs to reach the closest possible core surface of each type j,
+    // max over j of (r_cut + 0.5*(additive_i + additive_j) - 0.5*D_core_j)
+    this->m_patch_query_radius.assign(this->m_pdata->getNTypes(), ShortReal(0.0));
+    if (this->m_patch)
+        {
+        for (unsigned int typ_i = 0; typ_i < this->m_pdata->getNTypes(); typ_i++)
+            {
+            ShortReal r_cut_i = static_cast<ShortReal>(this->m_patch->getRCut())
+                + static_cast<ShortReal>(0.5) * static_cast<ShortReal>(this->m_patch->getAdditiveCutoff(typ_i));
+
+            ShortReal radius(0.0);
+            for (unsigned int typ_j = 0; typ_j < this->m_pdata->getNTypes(); typ_j++)
+                {
+                Shape tmp_shape(quat<Scalar>(), this->m_params[typ_j]);
+                ShortReal r = r_cut_i
+                    + static_cast<ShortReal>(0.5) * static_cast<ShortReal>(this->m_patch->getAdditiveCutoff(typ_j))
+                    - tmp_shape.getCircumsphereDiameter() / ShortReal(2.0);
+                radius = std::max(radius, r);
+                }
+            this->m_patch_query_radius[typ_i] = radius;
+            }
+        }
     this->m_image_list_valid = false;
     this->m_aabb_tree_invalid = true;
 
@@ -1717,9 +2422,9 @@ void IntegratorHPMCMono<Shape>::limitMoveDistances()
     ArrayHandle<Scalar> h_d(m_d, access_location::host, access_mode::readwrite);
     for (unsigned int typ = 0; typ < this->m_pdata->getNTypes(); typ++)
         {
-        if (m_nselect * h_d.data[typ] > min_npd)
+        if (m_nselect * h_d.data[typ] * getMaxMoveGridScale() > min_npd)
             {
-            h_d.data[typ] = min_npd / Scalar(m_nselect);
+            h_d.data[typ] = min_npd / (Scalar(m_nselect) * getMaxMoveGridScale());
             m_exec_conf->msg->warning() << "Move distance or nselect too big, reducing move distance to "
                                         << h_d.data[typ] << " for type " << m_pdata->getNameByType(typ) << std::endl;
             m_image_list_valid = false;
@@ -2669,6 +3374,9 @@ template < class Shape > void export_IntegratorHPMCMono(pybind11::module& m, con
           .def("getShape", &IntegratorHPMCMono<Shape>::getShape)
           .def("setShape", &IntegratorHPMCMono<Shape>::setShape)
           .def("computePatchEnergy", &IntegratorHPMCMono<Shape>::computePatchEnergy)
+          .def_property("batch_moves",
+                        &IntegratorHPMCMono<Shape>::getBatchedMoves,
+                        &IntegratorHPMCMono<Shape>::setBatchedMoves)
           ;
     }
 
@@ -41,6 +41,17 @@ namespace gpu
 #ifdef __HIPCC__
 namespace kernel
     {
+//! Maximum number of shape parameter bytes held in the constant memory cache
+const unsigned int max_param_cache_bytes = 32768;
+
+//! Constant memory cache for the shape parameters
+/*! Each kernel template is instantiated in its own compilation unit per shape class, so every
+    instantiation owns a private copy of this cache. When the parameters fit and carry no
+    attached managed arrays, the narrow phase launcher uploads them here once per parameter
+    change instead of re-staging them in shared memory for every block.
+*/
+__constant__ char g_param_cache[max_param_cache_bytes];
+
 //! Check narrow-phase overlaps
 template<class Shape, unsigned int max_threads>
 #ifdef __HIP_PLATFORM_NVCC__
@@ -71,7 +82,8 @@ __launch_bounds__(max_threads)
                                       const unsigned int max_extra_bytes,
                                       const unsigned int max_queue_size,
                                       const unsigned int work_offset,
-                                      const unsigned int nwork)
+                                      const unsigned int nwork,
+                                      const bool use_param_cache)
     {
     __shared__ unsigned int s_overlap_checks;
     __shared__ unsigned int s_overlap_err_count;
@@ -87,13 +99,28 @@ __launch_bounds__(max_threads)
     // load the per type pair parameters into shared memory
     HIP_DYNAMIC_SHARED(char, s_data)
 
+    // size of the auxiliary arrays used to sort the queue by type pair (zero when there is
+    // only one type and sorting cannot help), rounded up to a power of two for the bitonic
+    // sort
+    unsigned int max_queue_size_pow2 = 1;
+    while (max_queue_size_pow2 < max_queue_size)
+        max_queue_size_pow2 <<= 1;
+    const unsigned int queue_sort_size = (num_types > 1) ? max_queue_size_pow2 : 0;
+
+    // the shape parameters come either from the constant memory cache or from a copy staged
+    // in shared memory; the shared memory slab for them is only allocated in the latter case
     typename Shape::param_type* s_params = (typename Shape::param_type*)(&s_data[0]);
-    Scalar4* s_orientation_group = (Scalar4*)(s_params + num_types);
+    const typename Shape::param_type* params
+        = use_param_cache ? (const typename Shape::param_type*)g_param_cache : s_params;
+    Scalar4* s_orientation_group
+        = use_param_cache ? (Scalar4*)(&s_data[0]) : (Scalar4*)(s_params + num_types);
     Scalar3* s_pos_group = (Scalar3*)(s_orientation_group + n_groups);
     unsigned int* s_check_overlaps = (unsigned int*)(s_pos_group + n_groups);
     unsigned int* s_queue_j = (unsigned int*)(s_check_overlaps + overlap_idx.getNumElements());
     unsigned int* s_queue_gid = (unsigned int*)(s_queue_j + max_queue_size);
-    unsigned int* s_type_group = (unsigned int*)(s_queue_gid + max_queue_size);
+    unsigned int* s_queue_key = (unsigned int*)(s_queue_gid + max_queue_size);
+    unsigned int* s_queue_perm = (unsigned int*)(s_queue_key + queue_sort_size);
+    unsigned int* s_type_group = (unsigned int*)(s_queue_perm + queue_sort_size);
     unsigned int* s_reject_group = (unsigned int*)(s_type_group + n_groups);
 
         {
@@ -101,13 +128,17 @@ __launch_bounds__(max_threads)
         unsigned int tidx
             = threadIdx.x + blockDim.x * threadIdx.y + blockDim.x * blockDim.y * threadIdx.z;
         unsigned int block_size = blockDim.x * blockDim.y * blockDim.z;
-        unsigned int param_size = num_types * sizeof(typename Shape::param_type) / sizeof(int);
-
-        for (unsigned int cur_offset = 0; cur_offset < param_size; cur_offset += block_size)
+        if (!use_param_cache)
             {
-            if (cur_offset + tidx < param_size)
+            unsigned int param_size
+                = num_types * sizeof(typename Shape::param_type) / sizeof(int);
+
+            for (unsigned int cur_offset = 0; cur_offset < param_size; cur_offset += block_size)
                 {
-                ((int*)s_params)[cur_offset + tidx] = ((int*)d_params)[cur_offset + tidx];
+                if (cur_offset + tidx < param_size)
+                    {
+                    ((int*)s_params)[cur_offset + tidx] = ((int*)d_params)[cur_offset + tidx];
+                    }
                 }
             }
 
@@ -127,9 +158,13 @@ __launch_bounds__(max_threads)
     // initialize extra shared mem
     char* s_extra = (char*)(s_reject_group + n_groups);
 
-    unsigned int available_bytes = max_extra_bytes;
-    for (unsigned int cur_type = 0; cur_type < num_types; ++cur_type)
-        s_params[cur_type].load_shared(s_extra, available_bytes);
+    // cached parameters have no attached managed arrays to relocate
+    if (!use_param_cache)
+        {
+        unsigned int available_bytes = max_extra_bytes;
+        for (unsigned int cur_type = 0; cur_type < num_types; ++cur_type)
+            s_params[cur_type].load_shared(s_extra, available_bytes);
+        }
     __syncthreads();
 
     if (master && group == 0)
@@ -228,7 +263,7 @@ __launch_bounds__(max_threads)
                 // build some shapes, but we only need them to get diameters, so don't load
                 // orientations build shape i from shared memory
                 vec3<Scalar> pos_i(s_pos_group[group]);
-                Shape shape_i(quat<Scalar>(), s_params[s_type_group[group]]);
+                Shape shape_i(quat<Scalar>(), params[s_type_group[group]]);
 
                 // prefetch next j
                 j = next_j;
@@ -253,7 +288,7 @@ __launch_bounds__(max_threads)
                 const Scalar4 postype_j = (old || j >= N_local) ? d_postype[j] : d_trial_postype[j];
                 unsigned int type_j = __scalar_as_int(postype_j.w);
                 vec3<Scalar> pos_j(postype_j);
-                Shape shape_j(quat<Scalar>(), s_params[type_j]);
+                Shape shape_j(quat<Scalar>(), params[type_j]);
 
                 // place ourselves into the minimum image
                 vec3<Scalar> r_ij = pos_j - pos_i;
@@ -291,12 +326,72 @@ __launch_bounds__(max_threads)
 
         unsigned int tidx_1d = offset + group_size * group;
 
+        if (num_types > 1)
+            {
+            // sort the queue by (type_i, type_j) so that adjacent threads process runs of
+            // identical type pairs; with mixed shape definitions test_overlap takes very
+            // different code paths per pair and an unsorted queue leaves warps divergent.
+            // Sort a permutation alongside the keys instead of moving the queue entries.
+            const unsigned int n_queue = min(s_queue_size, max_queue_size);
+
+            if (threadIdx.x == 0)
+                {
+                for (unsigned int n = tidx_1d; n < max_queue_size_pow2; n += max_queue_size)
+                    {
+                    unsigned int key = 0xffffffffu;
+                    if (n < n_queue)
+                        {
+                        const unsigned int qj = s_queue_j[n] >> 1;
+                        const Scalar4 postype_qj
+                            = (s_queue_j[n] & 1) ? d_postype[qj] : d_trial_postype[qj];
+                        key = s_type_group[s_queue_gid[n]] * num_types
+                              + __scalar_as_int(postype_qj.w);
+                        }
+                    s_queue_key[n] = key;
+                    s_queue_perm[n] = n;
+                    }
+                }
+            __syncthreads();
+
+            // bitonic sort of the (key, permutation) pairs, padded entries carry the
+            // maximum key and sink to the end
+            for (unsigned int length = 2; length <= max_queue_size_pow2; length <<= 1)
+                {
+                for (unsigned int stride = length >> 1; stride > 0; stride >>= 1)
+                    {
+                    if (threadIdx.x == 0)
+                        {
+                        for (unsigned int n = tidx_1d; n < max_queue_size_pow2;
+                             n += max_queue_size)
+                            {
+                            const unsigned int partner = n ^ stride;
+                            if (partner > n)
+                                {
+                                const bool ascending = ((n & length) == 0);
+                                if (ascending == (s_queue_key[n] > s_queue_key[partner]))
+                                    {
+                                    const unsigned int tmp_key = s_queue_key[n];
+                                    s_queue_key[n] = s_queue_key[partner];
+                                    s_queue_key[partner] = tmp_key;
+                                    const unsigned int tmp_perm = s_queue_perm[n];
+                                    s_queue_perm[n] = s_queue_perm[partner];
+                                    s_queue_perm[partner] = tmp_perm;
+                                    }
+                                }
+                            }
+                        }
+                    __syncthreads();
+                    }
+                }
+            }
+
         // max_queue_size is always <= block size, so we just need an if here
         if (tidx_1d < min(s_queue_size, max_queue_size))
             {
             // need to extract the overlap check to perform out of the shared mem queue
-            unsigned int check_group = s_queue_gid[tidx_1d];
-            unsigned int check_j_flag = s_queue_j[tidx_1d];
+            const unsigned int queue_idx = (num_types > 1) ? s_queue_perm[tidx_1d] : tidx_1d;
+            unsigned int check_group = s_queue_gid[queue_idx];
+            unsigned int check_j_flag = s_queue_j[queue_idx];
             bool check_old = check_j_flag & 1;
             unsigned int check_j = check_j_flag >> 1;
 
@@ -307,13 +402,13 @@ __launch_bounds__(max_threads)
             // build shape i from shared memory
             Scalar3 pos_i = s_pos_group[check_group];
             unsigned int type_i = s_type_group[check_group];
-            Shape shape_i(quat<Scalar>(s_orientation_group[check_group]), s_params[type_i]);
+            Shape shape_i(quat<Scalar>(s_orientation_group[check_group]), params[type_i]);
 
             // build shape j from global memory
             postype_j = check_old ? d_postype[check_j] : d_trial_postype[check_j];
             orientation_j = make_scalar4(1, 0, 0, 0);
             unsigned int type_j = __scalar_as_int(postype_j.w);
-            Shape shape_j(quat<Scalar>(orientation_j), s_params[type_j]);
+            Shape shape_j(quat<Scalar>(orientation_j), params[type_j]);
             if (shape_j.hasOrientation())
                 shape_j.orientation = check_old ? quat<Scalar>(d_orientation[check_j])
                                                 : quat<Scalar>(d_trial_orientation[check_j]);
@@ -407,13 +502,45 @@ void narrow_phase_launcher(const hpmc_args_t& args,
         unsigned int n_groups = run_block_size / (tpp * overlap_threads);
         unsigned int max_queue_size = n_groups * tpp;
 
+        // the parameters are cached in constant memory when they fit and carry no attached
+        // managed arrays, which load_shared() could only relocate into shared memory; a dry
+        // run of allocate_shared() detects attached data without touching device memory
+        char* param_scratch_ptr = (char*)nullptr;
+        unsigned int param_scratch_avail = 0xffffffff;
+        for (unsigned int i = 0; i < args.num_types; ++i)
+            {
+            params[i].allocate_shared(param_scratch_ptr, param_scratch_avail);
+            }
+        const bool use_param_cache
+            = param_scratch_ptr == (char*)nullptr
+              && args.num_types * sizeof(typename Shape::param_type) <= max_param_cache_bytes;
+
+        // with the constant memory cache, no shared memory is reserved for the parameters
+        const unsigned int param_shared_bytes
+            = use_param_cache ? 0
+                              : static_cast<unsigned int>(args.num_types
+                                                          * sizeof(typename Shape::param_type));
+
         const unsigned int min_shared_bytes
-            = static_cast<unsigned int>(args.num_types * sizeof(typename Shape::param_type)
+            = static_cast<unsigned int>(param_shared_bytes
                                         + args.overlap_idx.getNumElements() * sizeof(unsigned int));
 
+        // extra storage for the type-pair sort of the queue (keys and a permutation,
+        // rounded up to a power of two); unused and unallocated with a single type
+        auto queue_sort_size = [&args](unsigned int queue_size) -> unsigned int
+            {
+            if (args.num_types == 1)
+                return 0;
+            unsigned int pow2 = 1;
+            while (pow2 < queue_size)
+                pow2 <<= 1;
+            return pow2;
+            };
+
         size_t shared_bytes
             = n_groups * (2 * sizeof(unsigned int) + sizeof(Scalar4) + sizeof(Scalar3))
-              + max_queue_size * 2 * sizeof(unsigned int) + min_shared_bytes;
+              + (max_queue_size * 2 + queue_sort_size(max_queue_size) * 2) * sizeof(unsigned int)
+              + min_shared_bytes;
 
         if (min_shared_bytes >= args.devprop.sharedMemPerBlock)
             throw std::runtime_error("Insufficient shared memory for HPMC kernel: reduce number of "
@@ -437,7 +564,9 @@ void narrow_phase_launcher(const hpmc_args_t& args,
             max_queue_size = n_groups * tpp;
 
             shared_bytes = n_groups * (2 * sizeof(unsigned int) + sizeof(Scalar4) + sizeof(Scalar3))
-                           + max_queue_size * 2 * sizeof(unsigned int) + min_shared_bytes;
+                           + (max_queue_size * 2 + queue_sort_size(max_queue_size) * 2)
+                                 * sizeof(unsigned int)
+                           + min_shared_bytes;
             }
 
         // determine dynamically allocated shared memory size
@@ -445,14 +574,17 @@ void narrow_phase_launcher(const hpmc_args_t& args,
             = static_cast<unsigned int>(shared_bytes + attr.sharedSizeBytes);
         unsigned int max_extra_bytes
             = static_cast<unsigned int>(args.devprop.sharedMemPerBlock - base_shared_bytes);
-        char* ptr = (char*)nullptr;
-        unsigned int available_bytes = max_extra_bytes;
-        for (unsigned int i = 0; i < args.num_types; ++i)
+        if (!use_param_cache)
             {
-            params[i].allocate_shared(ptr, available_bytes);
+            char* ptr = (char*)nullptr;
+            unsigned int available_bytes = max_extra_bytes;
+            for (unsigned int i = 0; i < args.num_types; ++i)
+                {
+                params[i].allocate_shared(ptr, available_bytes);
+                }
+            unsigned int extra_bytes = max_extra_bytes - available_bytes;
+            shared_bytes += extra_bytes;
             }
-        unsigned int extra_bytes = max_extra_bytes - available_bytes;
-        shared_bytes += extra_bytes;
 
         dim3 thread(overlap_threads, n_groups, tpp);
 
@@ -477,6 +609,17 @@ void narrow_phase_launcher(const hpmc_args_t& args,
             assert(args.d_reject_out);
             assert(args.d_reject_out_of_cell);
 
+            // refresh the constant memory cache on each device when the parameters changed
+            if (use_param_cache && args.update_shape_param)
+                {
+                hipMemcpyToSymbolAsync(HIP_SYMBOL(g_param_cache),
+                                       params,
+                                       args.num_types * sizeof(typename Shape::param_type),
+                                       0,
+                                       hipMemcpyDefault,
+                                       args.streams[idev]);
+                }
+
             hipLaunchKernelGGL((hpmc_narrow_phase<Shape, launch_bounds_nonzero * MIN_BLOCK_SIZE>),
                                grid,
                                thread,
@@ -507,7 +650,8 @@ void narrow_phase_launcher(const hpmc_args_t& args,
                                max_extra_bytes,
                                max_queue_size,
                                range.first,
-                               nwork);
+                               nwork,
+                               use_param_cache);
             }
         }
     else
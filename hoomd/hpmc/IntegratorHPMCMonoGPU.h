@@ -272,6 +272,9 @@ template<class Shape> class IntegratorHPMCMonoGPU : public IntegratorHPMCMono<Sh
     //!< Variables for implicit depletants
     GlobalArray<Scalar> m_lambda; //!< Poisson means, per type pair
 
+    bool m_update_shape_param; //!< True when the shape parameters changed since the last
+                               //!< narrow phase launch
+
     //! Set up excell_list
     virtual void initializeExcellMem();
 
@@ -285,7 +288,8 @@ template<class Shape> class IntegratorHPMCMonoGPU : public IntegratorHPMCMono<Sh
 template<class Shape>
 IntegratorHPMCMonoGPU<Shape>::IntegratorHPMCMonoGPU(std::shared_ptr<SystemDefinition> sysdef,
                                                     std::shared_ptr<CellList> cl)
-    : IntegratorHPMCMono<Shape>(sysdef), m_cl(cl), m_update_order(this->m_exec_conf)
+    : IntegratorHPMCMono<Shape>(sysdef), m_cl(cl), m_update_order(this->m_exec_conf),
+      m_update_shape_param(true)
     {
     this->m_cl->setRadius(1);
     this->m_cl->setComputeTypeBody(false);
@@ -1379,6 +1383,8 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
                     args.block_size = param[0];
                     args.tpp = param[1];
                     args.overlap_threads = param[2];
+                    args.update_shape_param = m_update_shape_param;
+                    m_update_shape_param = false;
                     gpu::hpmc_narrow_phase<Shape>(args, params.data());
                     if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
                         CHECK_CUDA_ERROR();
@@ -2019,6 +2025,9 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::updateCellWidth()
     // call base class method
     IntegratorHPMCMono<Shape>::updateCellWidth();
 
+    // the shape parameters changed, refresh the constant memory cache on the next launch
+    m_update_shape_param = true;
+
     // update the cell list
     this->m_cl->setNominalWidth(this->m_nominal_width);
 
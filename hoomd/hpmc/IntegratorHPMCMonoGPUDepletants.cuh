@@ -248,7 +248,7 @@ __launch_bounds__(max_threads)
                 hoomd::Seed(hoomd::RNGIdentifier::HPMCDepletants, timestep, seed),
                 hoomd::Counter(i, i_dep, depletant_type_a, static_cast<uint16_t>(select)));
 
-            overlap_checks += 2;
+            overlap_checks++;
 
             // test depletant position and orientation
             vec3<Scalar> pos_test = vec3<Scalar>(generatePositionInOBB(rng, obb_i, dim));
@@ -270,12 +270,21 @@ __launch_bounds__(max_threads)
                                   && check_circumsphere_overlap(r_ij, shape_test_a, shape_i)
                                   && test_overlap(r_ij, shape_test_a, shape_i, err_count));
 
-            if (shape_i.hasOrientation())
-                shape_i.orientation = quat<Scalar>(s_orientation_i_new);
-            r_ij = vec3<Scalar>(s_pos_i_new) - pos_test;
-            bool overlap_new_a = (s_check_overlaps[overlap_idx(s_type_i, depletant_type_a)]
-                                  && check_circumsphere_overlap(r_ij, shape_test_a, shape_i)
-                                  && test_overlap(r_ij, shape_test_a, shape_i, err_count));
+            // an insertion only matters when it lands in the excluded volume of exactly one
+            // of the two configurations of i: with attractive depletants it has to overlap
+            // with the old configuration, with repulsive ones it must not. Skip the second
+            // narrow phase test when the first one already decides the outcome.
+            bool overlap_new_a = false;
+            if (overlap_old_a != repulsive)
+                {
+                overlap_checks++;
+                if (shape_i.hasOrientation())
+                    shape_i.orientation = quat<Scalar>(s_orientation_i_new);
+                r_ij = vec3<Scalar>(s_pos_i_new) - pos_test;
+                overlap_new_a = (s_check_overlaps[overlap_idx(s_type_i, depletant_type_a)]
+                                 && check_circumsphere_overlap(r_ij, shape_test_a, shape_i)
+                                 && test_overlap(r_ij, shape_test_a, shape_i, err_count));
+                }
 
             bool add_to_queue = (!repulsive && (overlap_old_a && !overlap_new_a))
                                 || (repulsive && (overlap_new_a && !overlap_old_a));
@@ -121,6 +121,8 @@ struct hpmc_args_t
     const hipDeviceProp_t& devprop;            //!< CUDA device properties
     const GPUPartition& gpu_partition;         //!< Multi-GPU partition
     const hipStream_t* streams;                //!< kernel streams
+    bool update_shape_param = false; //!< True when the shape parameters changed since the last
+                                     //!< narrow phase launch
     };
 
 //! Wraps arguments for hpmc_update_pdata
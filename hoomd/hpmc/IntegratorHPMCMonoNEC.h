@@ -767,6 +767,9 @@ double IntegratorHPMCMonoNEC<Shape>::sweepDistance(vec3<Scalar>& direction,
 
     hoomd::detail::AABB aabb_i_test = hoomd::detail::merge(aabb_i_current, aabb_i_future);
 
+    // length of the sweep covered by aabb_i_test; shrunk along with sweepableDistance
+    double sweep_covered = maxSweep;
+
     vec3<Scalar> newCollisionPlaneVector;
 
     // All image boxes (including the primary)
@@ -869,6 +872,18 @@ double IntegratorHPMCMonoNEC<Shape>::sweepDistance(vec3<Scalar>& direction,
                                 }
                             }
                         }
+
+                    // a collision closer than the covered sweep lets the remaining traversal
+                    // (and the remaining images) test against a tighter swept volume
+                    if (sweepableDistance < sweep_covered)
+                        {
+                        sweep_covered = sweepableDistance;
+                        aabb_i_future = aabb_i_current;
+                        aabb_i_future.translate(sweep_covered * direction);
+                        aabb_i_test = hoomd::detail::merge(aabb_i_current, aabb_i_future);
+                        aabb = aabb_i_test;
+                        aabb.translate(pos_i_image);
+                        }
                     }
                 }
             else
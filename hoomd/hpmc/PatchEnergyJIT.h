@@ -96,6 +96,10 @@ class PYBIND11_EXPORT PatchEnergyJIT : public hpmc::PatchEnergy
                          float d_j,
                          float charge_j)
         {
+        // skip the compiled kernel entirely for pairs beyond the isotropic cutoff
+        const float r_cut = static_cast<float>(m_r_cut_isotropic);
+        if (dot(r_ij, r_ij) > r_cut * r_cut)
+            return 0.0f;
         return m_eval(r_ij, type_i, q_i, d_i, charge_i, type_j, q_j, d_j, charge_j);
         }
 
@@ -796,6 +796,18 @@ DEVICE inline bool test_overlap(const vec3<Scalar>& r_ab,
     {
     vec3<ShortReal> dr(r_ab);
 
+    // For high vertex count shapes, reject clearly separated pairs with a cheap separating axis
+    // test on the tight OBBs before entering the iterative narrow phase. Every XenoCollide
+    // iteration scans all vertices in the support functions, so the fixed cost filter pays off
+    // once the combined vertex count is large. exact=false tests only the face axes of the two
+    // OBBs: false positives fall through to the exact test below.
+    constexpr unsigned int obb_prefilter_min_verts = 16;
+    if (a.verts.N + b.verts.N >= obb_prefilter_min_verts
+        && !detail::overlap(a.getOBB(vec3<Scalar>(0, 0, 0)), b.getOBB(r_ab), false))
+        {
+        return false;
+        }
+
     ShortReal DaDb = a.getCircumsphereDiameter() + b.getCircumsphereDiameter();
 
     return detail::xenocollide_3d(detail::SupportFuncConvexPolyhedron(a.verts),
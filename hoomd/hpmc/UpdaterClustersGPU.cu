@@ -12,6 +12,7 @@
 #include <thrust/copy.h>
 #include <thrust/device_ptr.h>
 #include <thrust/execution_policy.h>
+#include <thrust/fill.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
@@ -23,10 +24,6 @@
 #include <thrust/unique.h>
 #pragma GCC diagnostic pop
 
-#ifdef __HIP_PLATFORM_NVCC__
-#include <cusparse.h>
-#endif
-
 #include "hoomd/extern/ECL.cuh"
 
 /*! \file UpdaterClustersGPU.cu
@@ -39,18 +36,6 @@ namespace hpmc
     {
 namespace gpu
     {
-#ifdef __HIP_PLATFORM_NVCC__
-#define check_cusparse(a)                                                                 \
-        {                                                                                 \
-        cusparseStatus_t status = (a);                                                    \
-        if ((int)status != CUSPARSE_STATUS_SUCCESS)                                       \
-            {                                                                             \
-            printf("cusparse ERROR %d in file %s line %d\n", status, __FILE__, __LINE__); \
-            throw std::runtime_error("Error during clusters update");                     \
-            }                                                                             \
-        }
-#endif
-
 struct get_source : public thrust::unary_function<uint2, unsigned int>
     {
     __host__ __device__ unsigned int operator()(const uint2& u) const
@@ -297,38 +282,41 @@ void connected_components(uint2* d_adj,
                           const hipDeviceProp_t& dev_prop,
                           CachedAllocator& alloc)
     {
-#ifdef __HIP_PLATFORM_NVCC__
+#ifdef __HIP_PLATFORM_HCC__
+    auto exec_policy = thrust::hip::par(alloc);
+#else
+    auto exec_policy = thrust::cuda::par(alloc);
+#endif
+
     thrust::device_ptr<uint2> adj(d_adj);
 
     // sort the list of pairs
-    thrust::sort(thrust::cuda::par(alloc), adj, adj + n_elements, pair_less());
+    thrust::sort(exec_policy, adj, adj + n_elements, pair_less());
 
     // remove duplicates
-    auto new_last = thrust::unique(thrust::cuda::par(alloc), adj, adj + n_elements);
+    auto new_last = thrust::unique(exec_policy, adj, adj + n_elements);
     unsigned int nnz = static_cast<unsigned int>(new_last - adj);
 
     auto source = thrust::make_transform_iterator(adj, get_source());
     auto destination = thrust::make_transform_iterator(adj, get_destination());
 
-    // input matrix in COO format
     unsigned int nverts = N;
 
-    int* d_rowidx = alloc.getTemporaryBuffer<int>(nnz);
     int* d_colidx = alloc.getTemporaryBuffer<int>(nnz);
-
-    thrust::device_ptr<int> rowidx(d_rowidx);
     thrust::device_ptr<int> colidx(d_colidx);
+    thrust::copy(exec_policy, destination, destination + nnz, colidx);
 
-    thrust::copy(source, source + nnz, rowidx);
-    thrust::copy(destination, destination + nnz, colidx);
-
-    cusparseHandle_t handle;
-    cusparseCreate(&handle);
-
-    // allocate CSR matrix topology
+    // build the CSR row pointer by binary searching the sorted edge sources: the number of
+    // edges with source <= v is the start of row v + 1
     int* d_csr_rowptr = alloc.getTemporaryBuffer<int>(nverts + 1);
-    check_cusparse(
-        cusparseXcoo2csr(handle, d_rowidx, nnz, nverts, d_csr_rowptr, CUSPARSE_INDEX_BASE_ZERO));
+    thrust::device_ptr<int> csr_rowptr(d_csr_rowptr);
+    thrust::fill(exec_policy, csr_rowptr, csr_rowptr + 1, 0);
+    thrust::upper_bound(exec_policy,
+                        source,
+                        source + nnz,
+                        thrust::counting_iterator<unsigned int>(0),
+                        thrust::counting_iterator<unsigned int>(nverts),
+                        csr_rowptr + 1);
 
     int* d_work = alloc.getTemporaryBuffer<int>(nverts);
 
@@ -339,13 +327,13 @@ void connected_components(uint2* d_adj,
     thrust::device_ptr<int> components(d_components);
     thrust::device_ptr<int> work(d_work);
 
-    thrust::copy(thrust::cuda::par(alloc), components, components + nverts, work);
-    thrust::sort(thrust::cuda::par(alloc), work, work + nverts);
+    thrust::copy(exec_policy, components, components + nverts, work);
+    thrust::sort(exec_policy, work, work + nverts);
 
     int* d_unique = alloc.getTemporaryBuffer<int>(nverts);
     thrust::device_ptr<int> unique(d_unique);
 
-    auto it = thrust::reduce_by_key(thrust::cuda::par(alloc),
+    auto it = thrust::reduce_by_key(exec_policy,
                                     work,
                                     work + nverts,
                                     thrust::constant_iterator<int>(1),
@@ -355,7 +343,7 @@ void connected_components(uint2* d_adj,
     num_components = static_cast<unsigned int>(it.first - unique);
 
     // make contiguous
-    thrust::lower_bound(thrust::cuda::par(alloc),
+    thrust::lower_bound(exec_policy,
                         unique,
                         unique + num_components,
                         components,
@@ -363,15 +351,10 @@ void connected_components(uint2* d_adj,
                         components);
 
     // free temporary storage
-    alloc.deallocate((char*)d_rowidx);
     alloc.deallocate((char*)d_colidx);
     alloc.deallocate((char*)d_csr_rowptr);
     alloc.deallocate((char*)d_work);
     alloc.deallocate((char*)d_unique);
-
-    // clean cusparse
-    cusparseDestroy(handle);
-#endif
     }
 
     } // end namespace gpu
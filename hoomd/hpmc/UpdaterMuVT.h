@@ -1954,20 +1954,8 @@ bool UpdaterMuVT<Shape>::tryInsertParticle(uint64_t timestep,
         unsigned int err_count = 0;
 
             {
-            // check for overlaps
-            ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
-                                           access_location::host,
-                                           access_mode::read);
-            ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
-                                               access_location::host,
-                                               access_mode::read);
-            ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(),
-                                           access_location::host,
-                                           access_mode::read);
-            ArrayHandle<Scalar> h_charge(m_pdata->getCharges(),
-                                         access_location::host,
-                                         access_mode::read);
-
+            // check for self-overlaps between periodic images; this only involves the inserted
+            // particle, so do not touch (and potentially transfer) the particle data here
             ArrayHandle<unsigned int> h_overlaps(m_mc->getInteractionMatrix(),
                                                  access_location::host,
                                                  access_mode::read);
@@ -2339,9 +2327,6 @@ bool UpdaterMuVT<Shape>::moveDepletantsIntoNewPosition(uint64_t timestep,
         ArrayHandle<Scalar4> h_orientation(this->m_pdata->getOrientationArray(),
                                            access_location::host,
                                            access_mode::read);
-        ArrayHandle<unsigned int> h_tag(this->m_pdata->getTags(),
-                                        access_location::host,
-                                        access_mode::read);
         ArrayHandle<unsigned int> h_overlaps(this->m_mc->getInteractionMatrix(),
                                              access_location::host,
                                              access_mode::read);
@@ -2766,10 +2751,6 @@ unsigned int UpdaterMuVT<Shape>::countDepletantOverlapsInNewPosition(uint64_t ti
         ArrayHandle<Scalar4> h_orientation(this->m_pdata->getOrientationArray(),
                                            access_location::host,
                                            access_mode::read);
-        ArrayHandle<unsigned int> h_tag(this->m_pdata->getTags(),
-                                        access_location::host,
-                                        access_mode::read);
-
         auto& params = this->m_mc->getParams();
 
         ArrayHandle<unsigned int> h_overlaps(this->m_mc->getInteractionMatrix(),
@@ -2952,10 +2933,6 @@ unsigned int UpdaterMuVT<Shape>::countDepletantOverlaps(uint64_t timestep,
         ArrayHandle<Scalar4> h_orientation(this->m_pdata->getOrientationArray(),
                                            access_location::host,
                                            access_mode::read);
-        ArrayHandle<unsigned int> h_tag(this->m_pdata->getTags(),
-                                        access_location::host,
-                                        access_mode::read);
-
         auto& params = this->m_mc->getParams();
 
         ArrayHandle<unsigned int> h_overlaps(this->m_mc->getInteractionMatrix(),
@@ -314,8 +314,9 @@ template<class Shape> void UpdaterShape<Shape>::update(uint64_t timestep)
             // actually update the shape parameter in the integrator
             m_mc->setParam(typ_i, shape_param_new);
 
-            // check if at least one overlap was caused
-            bool overlaps = static_cast<bool>(m_mc->countOverlaps(true));
+            // check if at least one overlap was caused; only pairs involving the modified type
+            // can change, so the check is restricted to them
+            bool overlaps = static_cast<bool>(m_mc->countOverlapsType(typ_i, true));
             // automatically reject if there are overlaps
             if (overlaps)
                 {
@@ -28,6 +28,8 @@ class FreeVolume(Compute):
     Args:
         test_particle_type (str): Test particle type.
         num_samples (int): Number of samples to evaluate.
+        test_particle_types (list[str]): All test particle types. Defaults to
+            ``[test_particle_type]`` when not given.
 
     `FreeVolume` computes the free volume in the simulation state available to a
     given test particle shape using Monte Carlo integration. Use it in
@@ -87,6 +89,15 @@ class FreeVolume(Compute):
     other particles, including self overlap. On GPU devices, `FreeVolume`
     applies the minimum image convention.
 
+    .. rubric:: Multiple test types
+
+    Set ``test_particle_types`` to measure the free volume available to
+    several test particle shapes in one pass. All types share the same set of
+    trial positions and orientations and the overlap checks share a single
+    traversal of the particle data per sample, which is much faster than
+    creating one `FreeVolume` compute per test type. Access the per-type
+    results with `free_volumes`.
+
     Examples::
 
         fv = hoomd.hpmc.compute.FreeVolume(test_particle_type='B',
@@ -98,13 +109,21 @@ class FreeVolume(Compute):
 
         num_samples (int): Number of samples to evaluate.
 
+        test_particle_types (list[str]): All test particle types.
+
     """
 
-    def __init__(self, test_particle_type, num_samples):
+    def __init__(self, test_particle_type, num_samples,
+                 test_particle_types=None):
         # store metadata
-        param_dict = ParameterDict(test_particle_type=str, num_samples=int)
+        param_dict = ParameterDict(test_particle_type=str,
+                                   test_particle_types=[str],
+                                   num_samples=int)
+        if test_particle_types is None:
+            test_particle_types = [test_particle_type]
         param_dict.update(
             dict(test_particle_type=test_particle_type,
+                 test_particle_types=test_particle_types,
                  num_samples=num_samples))
         self._param_dict.update(param_dict)
 
@@ -136,6 +155,17 @@ class FreeVolume(Compute):
         self._cpp_obj.compute(self._simulation.timestep)
         return self._cpp_obj.free_volume
 
+    @log(category='sequence', requires_run=True)
+    def free_volumes(self):
+        """Free volume available to each test particle type \
+        :math:`[\\mathrm{length}^{2}]` in 2D and \
+        :math:`[\\mathrm{length}^{3}]` in 3D.
+
+        The entries correspond to the types in `test_particle_types`.
+        """
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.free_volumes
+
 
 class SDF(Compute):
     r"""Compute the scale distribution function via volume perturbations.
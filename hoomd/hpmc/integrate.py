@@ -344,6 +344,24 @@ class HPMCIntegrator(Integrator):
         nselect (int): Number of trial moves to perform per particle per
             timestep.
 
+        batch_moves (bool): When `True`, attempt trial moves in batches of
+            non-interacting particles on the CPU (**default:** `False`).
+            Batching improves cache utilization and only engages when there
+            are no depletants, pair potentials, or external fields; sampling
+            is unchanged either way.
+
+        move_size_grid (int): Number of cells per box dimension in the
+            adaptive move size grid (**default:** 0, disabled). When
+            non-zero, the CPU integrator scales the trial move sizes ``d``
+            and ``a`` per spatial cell based on the local acceptance ratio,
+            so dense and dilute regions of inhomogeneous systems (e.g.
+            sedimentation profiles) each use an efficient move size. A
+            Metropolis-Hastings factor corrects the acceptance criterion, so
+            sampling remains exact.
+
+        move_size_grid_target (float): Target acceptance ratio for the
+            adaptive move size grid (**default:** 0.2).
+
     .. rubric:: Attributes
     """
     _ext_module = _hpmc
@@ -358,7 +376,10 @@ class HPMCIntegrator(Integrator):
         # Set base parameter dict for hpmc integrators
         param_dict = ParameterDict(
             translation_move_probability=float(translation_move_probability),
-            nselect=int(nselect))
+            nselect=int(nselect),
+            batch_moves=bool(False),
+            move_size_grid=int(0),
+            move_size_grid_target=float(0.2))
         self._param_dict.update(param_dict)
         self._pair_potential = None
         self._external_potential = None
@@ -87,13 +87,50 @@ def test_validation_systems(simulation_factory, lattice_snapshot_factory,
                                      activate=activate_tuner)
 
 
+def test_multiple_test_types(simulation_factory, lattice_snapshot_factory):
+    snap = lattice_snapshot_factory(particle_types=['A', 'B', 'C'])
+    sim = simulation_factory(snap)
+    mc = hoomd.hpmc.integrate.Sphere()
+    mc.shape["A"] = {'diameter': 1.0}
+    mc.shape["B"] = {'diameter': 0.2}
+    mc.shape["C"] = {'diameter': 0.5}
+    sim.operations.add(mc)
+
+    free_volume = hoomd.hpmc.compute.FreeVolume(
+        test_particle_type='B',
+        num_samples=1000,
+        test_particle_types=['B', 'C'])
+    reference = hoomd.hpmc.compute.FreeVolume(test_particle_type='C',
+                                              num_samples=1000)
+
+    sim.operations.add(free_volume)
+    sim.operations.add(reference)
+    sim.run(0)
+
+    assert free_volume.test_particle_types == ['B', 'C']
+
+    # both computes draw the same sample points, so the batched estimate for
+    # 'C' matches the single-type one exactly
+    free_volumes = free_volume.free_volumes
+    assert len(free_volumes) == 2
+    np.testing.assert_allclose(free_volumes[1], reference.free_volume)
+
+    # the first entry corresponds to the scalar log quantity
+    np.testing.assert_allclose(free_volumes[0], free_volume.free_volume)
+
+
 def test_logging():
     logging_check(
-        hoomd.hpmc.compute.FreeVolume, ('hpmc', 'compute'),
-        {'free_volume': {
-            'category': LoggerCategories.scalar,
-            'default': True
-        }})
+        hoomd.hpmc.compute.FreeVolume, ('hpmc', 'compute'), {
+            'free_volume': {
+                'category': LoggerCategories.scalar,
+                'default': True
+            },
+            'free_volumes': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            }
+        })
 
 
 def test_2d_free_volume(simulation_factory):
@@ -14,6 +14,10 @@
 #include <iostream>
 #include <memory>
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 namespace hoomd
     {
 namespace detail
@@ -32,6 +36,66 @@ template<class T> class managed_allocator
     using propagate_on_container_move_assignment = std::true_type;
     using propagate_on_container_swap = std::true_type;
 
+    //! Size of a host huge page
+    static constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+
+    //! Request huge page backing for host allocations of at least this many bytes
+    static constexpr std::size_t huge_page_threshold = huge_page_size;
+
+    //! Allocate host memory, requesting 2M huge page backing for large allocations
+    /*! \param bytes Number of bytes to allocate
+        \param align_size Number of bytes to align the allocation to (0 for no alignment)
+        \param allocation_bytes (Return value) Size of the total allocation
+
+        Allocations of at least huge_page_threshold bytes are aligned to a huge page boundary
+        and padded to a whole number of huge pages, then advised with MADV_HUGEPAGE so that the
+        kernel backs them with 2M pages independent of the system-wide transparent huge page
+        setting. When huge pages are unavailable the advice is silently ignored and the
+        allocation falls back to standard 4k pages, so deallocation is free() in all cases.
+     */
+    static void* allocate_host(std::size_t bytes, std::size_t align_size, std::size_t& allocation_bytes)
+        {
+        void* result = nullptr;
+        allocation_bytes = bytes;
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        if (bytes >= huge_page_threshold)
+            {
+            allocation_bytes = ((bytes + huge_page_size - 1) / huge_page_size) * huge_page_size;
+            if (align_size < huge_page_size)
+                align_size = huge_page_size;
+
+            int retval = posix_memalign(&result, align_size, allocation_bytes);
+            if (retval != 0)
+                {
+                throw std::bad_alloc();
+                }
+
+            // best effort: fall back to 4k pages when huge pages cannot be provided
+            madvise(result, allocation_bytes, MADV_HUGEPAGE);
+
+            return result;
+            }
+#endif
+
+        if (align_size > 0)
+            {
+            int retval = posix_memalign(&result, align_size, bytes);
+            if (retval != 0)
+                {
+                throw std::bad_alloc();
+                }
+            }
+        else
+            {
+            result = malloc(bytes);
+            if (!result)
+                throw std::bad_alloc();
+            }
+
+        return result;
+        }
+
     value_type* allocate(std::size_t n)
         {
         void* result = nullptr;
@@ -61,11 +125,8 @@ template<class T> class managed_allocator
         else
 #endif
             {
-            int retval = posix_memalign(&result, 32, n * sizeof(T));
-            if (retval != 0)
-                {
-                throw std::bad_alloc();
-                }
+            std::size_t allocation_bytes;
+            result = allocate_host(n * sizeof(T), 32, allocation_bytes);
             }
 
         return (value_type*)result;
@@ -129,23 +190,9 @@ template<class T> class managed_allocator
         else
 #endif
             {
-            if (align_size > 0)
-                {
-                int retval = posix_memalign((void**)&result, align_size, n * sizeof(T));
-                if (retval != 0)
-                    {
-                    throw std::bad_alloc();
-                    }
-                }
-            else
-                {
-                result = malloc(n * sizeof(T));
-                if (!result)
-                    throw std::bad_alloc();
-                }
+            result = allocate_host(n * sizeof(T), align_size, allocation_bytes);
 
             memset(result, 0, n * sizeof(T));
-            allocation_bytes = n * sizeof(T);
             allocation_ptr = result;
             }
 
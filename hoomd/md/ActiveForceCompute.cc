@@ -22,6 +22,9 @@ ActiveForceCompute::ActiveForceCompute(std::shared_ptr<SystemDefinition> sysdef,
 
     : ForceCompute(sysdef), m_group(group)
     {
+    // active forces consume particle orientations
+    m_pdata->setAnisotropicDataInUse();
+
     // allocate memory for the per-type active_force storage and initialize them to (1.0,0,0)
     GlobalVector<Scalar4> tmp_f_activeVec(m_pdata->getNTypes(), m_exec_conf);
 
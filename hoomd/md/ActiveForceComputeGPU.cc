@@ -69,6 +69,16 @@ ActiveForceComputeGPU::ActiveForceComputeGPU(std::shared_ptr<SystemDefinition> s
 
     m_f_activeVec.swap(tmp_f_activeVec);
     m_t_activeVec.swap(tmp_t_activeVec);
+
+    // the force kernel reads only per-type vectors and writes only this compute's output
+    // arrays: give it a private stream so it overlaps with other small force kernels
+    // instead of serializing on the default stream
+    hipStreamCreate(&m_stream);
+    }
+
+ActiveForceComputeGPU::~ActiveForceComputeGPU()
+    {
+    hipStreamDestroy(m_stream);
     }
 
 /*! This function sets appropriate active forces and torques on all active particles.
@@ -86,9 +96,9 @@ void ActiveForceComputeGPU::setForces()
     ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
                                        access_location::device,
                                        access_mode::read);
-    ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
-                                            access_location::device,
-                                            access_mode::read);
+    ArrayHandle<unsigned int> d_is_member(m_group->getMembershipArray(),
+                                          access_location::device,
+                                          access_mode::read);
 
     // sanity check
     assert(d_force.data != NULL);
@@ -96,23 +106,24 @@ void ActiveForceComputeGPU::setForces()
     assert(d_t_actVec.data != NULL);
     assert(d_pos.data != NULL);
     assert(d_orientation.data != NULL);
-    assert(d_index_array.data != NULL);
-    unsigned int group_size = m_group->getNumMembers();
+    assert(d_is_member.data != NULL);
     unsigned int N = m_pdata->getN();
 
-    // compute the forces on the GPU
+    // compute the forces on the GPU in one coalesced pass over the particles, zeroing
+    // non-members instead of clearing the whole force array up front
     m_tuner_force->begin();
 
-    kernel::gpu_compute_active_force_set_forces(group_size,
-                                                d_index_array.data,
+    kernel::gpu_compute_active_force_set_forces(N,
+                                                d_is_member.data,
                                                 d_force.data,
                                                 d_torque.data,
                                                 d_pos.data,
                                                 d_orientation.data,
                                                 d_f_actVec.data,
                                                 d_t_actVec.data,
-                                                N,
-                                                m_tuner_force->getParam()[0]);
+                                                m_tuner_force->getParam()[0],
+                                                m_exec_conf->getNumActiveGPUs() == 1 ? m_stream
+                                                                                     : 0);
 
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
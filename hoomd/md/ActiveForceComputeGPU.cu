@@ -20,30 +20,38 @@ namespace md
 namespace kernel
     {
 //! Kernel for setting active force vectors on the GPU
-/*! \param group_size number of particles
-    \param d_index_array stores list to convert group index to global tag
+/*! \param N number of local particles
+    \param d_is_member dense membership flags, one per particle index
     \param d_force particle force on device
     \param d_torque particle torque on device
     \param d_orientation particle orientation on device
     \param d_f_act particle active force unit vector
     \param d_t_act particle active torque unit vector
-    \param orientationLink check if particle orientation is linked to active force vector
+
+    One thread runs per particle index so all reads and writes are coalesced. Non-members are
+    zeroed in the same pass, which replaces the separate memset over the force array and makes
+    sure no stale forces or torques remain for indices that left the group.
 */
-__global__ void gpu_compute_active_force_set_forces_kernel(const unsigned int group_size,
-                                                           unsigned int* d_index_array,
+__global__ void gpu_compute_active_force_set_forces_kernel(const unsigned int N,
+                                                           const unsigned int* d_is_member,
                                                            Scalar4* d_force,
                                                            Scalar4* d_torque,
                                                            const Scalar4* d_pos,
                                                            const Scalar4* d_orientation,
                                                            const Scalar4* d_f_act,
-                                                           const Scalar4* d_t_act,
-                                                           const unsigned int N)
+                                                           const Scalar4* d_t_act)
     {
-    unsigned int group_idx = blockIdx.x * blockDim.x + threadIdx.x;
-    if (group_idx >= group_size)
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N)
         return;
 
-    unsigned int idx = d_index_array[group_idx];
+    if (!d_is_member[idx])
+        {
+        d_force[idx] = make_scalar4(0, 0, 0, 0);
+        d_torque[idx] = make_scalar4(0, 0, 0, 0);
+        return;
+        }
+
     Scalar4 posidx = __ldg(d_pos + idx);
     unsigned int type = __scalar_as_int(posidx.w);
 
@@ -68,7 +76,7 @@ __global__ void gpu_compute_active_force_set_forces_kernel(const unsigned int gr
     \param d_f_act particle active force unit vector
     \param is2D check if simulation is 2D or 3D
     \param rotationConst particle rotational diffusion constant
-    \param seed seed for random number generator
+    \param rng_seed Philox key for this timestep, precomputed once on the host
 */
 __global__ void gpu_compute_active_force_rotational_diffusion_kernel(const unsigned int group_size,
                                                                      unsigned int* d_tag,
@@ -78,8 +86,7 @@ __global__ void gpu_compute_active_force_rotational_diffusion_kernel(const unsig
                                                                      const Scalar4* d_f_act,
                                                                      bool is2D,
                                                                      const Scalar rotationConst,
-                                                                     const uint64_t timestep,
-                                                                     const uint16_t seed)
+                                                                     const hoomd::Seed rng_seed)
     {
     unsigned int group_idx = blockIdx.x * blockDim.x + threadIdx.x;
     if (group_idx >= group_size)
@@ -93,13 +100,11 @@ __global__ void gpu_compute_active_force_rotational_diffusion_kernel(const unsig
 
     if (fact.w != 0)
         {
-        unsigned int ptag = d_tag[group_idx];
+        unsigned int ptag = d_tag[idx];
 
         quat<Scalar> quati(__ldg(d_orientation + idx));
 
-        hoomd::RandomGenerator rng(
-            hoomd::Seed(hoomd::RNGIdentifier::ActiveForceCompute, timestep, seed),
-            hoomd::Counter(ptag));
+        hoomd::RandomGenerator rng(rng_seed, hoomd::Counter(ptag));
 
         if (is2D) // 2D
             {
@@ -136,37 +141,36 @@ __global__ void gpu_compute_active_force_rotational_diffusion_kernel(const unsig
         }
     }
 
-hipError_t gpu_compute_active_force_set_forces(const unsigned int group_size,
-                                               unsigned int* d_index_array,
+hipError_t gpu_compute_active_force_set_forces(const unsigned int N,
+                                               const unsigned int* d_is_member,
                                                Scalar4* d_force,
                                                Scalar4* d_torque,
                                                const Scalar4* d_pos,
                                                const Scalar4* d_orientation,
                                                const Scalar4* d_f_act,
                                                const Scalar4* d_t_act,
-                                               const unsigned int N,
-                                               unsigned int block_size)
+                                               unsigned int block_size,
+                                               hipStream_t stream)
     {
-    // setup the grid to run the kernel
-    dim3 grid(group_size / block_size + 1, 1, 1);
+    // setup the grid to run the kernel over all local particles, zeroing non-members in the
+    // same pass
+    dim3 grid(N / block_size + 1, 1, 1);
     dim3 threads(block_size, 1, 1);
 
     // run the kernel
-    hipMemset(d_force, 0, sizeof(Scalar4) * N);
     hipLaunchKernelGGL((gpu_compute_active_force_set_forces_kernel),
                        dim3(grid),
                        dim3(threads),
                        0,
-                       0,
-                       group_size,
-                       d_index_array,
+                       stream,
+                       N,
+                       d_is_member,
                        d_force,
                        d_torque,
                        d_pos,
                        d_orientation,
                        d_f_act,
-                       d_t_act,
-                       N);
+                       d_t_act);
     return hipSuccess;
     }
 
@@ -186,6 +190,9 @@ hipError_t gpu_compute_active_force_rotational_diffusion(const unsigned int grou
     dim3 grid(group_size / block_size + 1, 1, 1);
     dim3 threads(block_size, 1, 1);
 
+    // derive the Philox key once per launch instead of in every thread
+    const hoomd::Seed rng_seed(hoomd::RNGIdentifier::ActiveForceCompute, timestep, seed);
+
     // run the kernel
     hipLaunchKernelGGL((gpu_compute_active_force_rotational_diffusion_kernel),
                        dim3(grid),
@@ -200,8 +207,7 @@ hipError_t gpu_compute_active_force_rotational_diffusion(const unsigned int grou
                        d_f_act,
                        is2D,
                        rotationConst,
-                       timestep,
-                       seed);
+                       rng_seed);
     return hipSuccess;
     }
 
@@ -19,16 +19,16 @@ namespace md
     {
 namespace kernel
     {
-hipError_t gpu_compute_active_force_set_forces(const unsigned int group_size,
-                                               unsigned int* d_index_array,
+hipError_t gpu_compute_active_force_set_forces(const unsigned int N,
+                                               const unsigned int* d_is_member,
                                                Scalar4* d_force,
                                                Scalar4* d_torque,
                                                const Scalar4* d_pos,
                                                const Scalar4* d_orientation,
                                                const Scalar4* d_f_act,
                                                const Scalar4* d_t_act,
-                                               const unsigned int N,
-                                               unsigned int block_size);
+                                               unsigned int block_size,
+                                               hipStream_t stream);
 
 hipError_t gpu_compute_active_force_rotational_diffusion(const unsigned int group_size,
                                                          unsigned int* d_tag,
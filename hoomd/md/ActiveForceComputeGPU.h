@@ -31,9 +31,13 @@ class PYBIND11_EXPORT ActiveForceComputeGPU : public ActiveForceCompute
     ActiveForceComputeGPU(std::shared_ptr<SystemDefinition> sysdef,
                           std::shared_ptr<ParticleGroup> group);
 
+    //! Destructor
+    virtual ~ActiveForceComputeGPU();
+
     protected:
     std::shared_ptr<Autotuner<1>> m_tuner_force;     //!< Autotuner for block size (force kernel)
     std::shared_ptr<Autotuner<1>> m_tuner_diffusion; //!< Autotuner for block size (diff kernel)
+    hipStream_t m_stream = 0; //!< Private launch stream so the force kernel can overlap
 
     //! Set forces for particles
     virtual void setForces();
@@ -140,9 +140,9 @@ template<class Manifold> void ActiveForceConstraintComputeGPU<Manifold>::setForc
     ArrayHandle<Scalar4> d_orientation(this->m_pdata->getOrientationArray(),
                                        access_location::device,
                                        access_mode::read);
-    ArrayHandle<unsigned int> d_index_array(this->m_group->getIndexArray(),
-                                            access_location::device,
-                                            access_mode::read);
+    ArrayHandle<unsigned int> d_is_member(this->m_group->getMembershipArray(),
+                                          access_location::device,
+                                          access_mode::read);
 
     // sanity check
     assert(d_force.data != NULL);
@@ -150,22 +150,22 @@ template<class Manifold> void ActiveForceConstraintComputeGPU<Manifold>::setForc
     assert(d_t_actVec.data != NULL);
     assert(d_pos.data != NULL);
     assert(d_orientation.data != NULL);
-    assert(d_index_array.data != NULL);
-    unsigned int group_size = this->m_group->getNumMembers();
+    assert(d_is_member.data != NULL);
     unsigned int N = this->m_pdata->getN();
 
-    // compute the forces on the GPU
+    // compute the forces on the GPU in one coalesced pass over the particles, zeroing
+    // non-members instead of clearing the whole force array up front
     this->m_tuner_force->begin();
-    kernel::gpu_compute_active_force_set_forces(group_size,
-                                                d_index_array.data,
+    kernel::gpu_compute_active_force_set_forces(N,
+                                                d_is_member.data,
                                                 d_force.data,
                                                 d_torque.data,
                                                 d_pos.data,
                                                 d_orientation.data,
                                                 d_f_actVec.data,
                                                 d_t_actVec.data,
-                                                N,
-                                                this->m_tuner_force->getParam()[0]);
+                                                this->m_tuner_force->getParam()[0],
+                                                0);
 
     if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
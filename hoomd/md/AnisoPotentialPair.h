@@ -107,6 +107,15 @@ template<class aniso_evaluator> class AnisoPotentialPair : public ForceCompute
     //! Set the shape parameters for a single type through Python
     virtual void setShapePython(std::string typ, const pybind11::object shape_param);
 
+    //! Set whether torques are computed for a single type
+    virtual void setTorqueMask(unsigned int typ, bool mask);
+
+    //! Set whether torques are computed for a single type through Python
+    virtual void setTorqueMaskPython(std::string typ, bool mask);
+
+    //! Get whether torques are computed for a single type
+    virtual bool getTorqueMaskPython(std::string typ);
+
     std::vector<std::string> getTypeShapeMapping(
         const std::vector<param_type, hoomd::detail::managed_allocator<param_type>>& params,
         const std::vector<shape_type, hoomd::detail::managed_allocator<shape_type>>& shape_params)
@@ -226,7 +235,8 @@ template<class aniso_evaluator> class AnisoPotentialPair : public ForceCompute
     std::vector<param_type, hoomd::detail::managed_allocator<param_type>>
         m_params; //!< Pair parameters per type pair
     std::vector<shape_type, hoomd::detail::managed_allocator<shape_type>>
-        m_shape_params; //!< Shape paramters per type
+        m_shape_params;                      //!< Shape paramters per type
+    GlobalArray<unsigned int> m_torque_mask; //!< Per type flag whether torques are computed
 
     /// Track whether we have attached to the Simulation object
     bool m_attached = true;
@@ -252,6 +262,9 @@ AnisoPotentialPair<aniso_evaluator>::AnisoPotentialPair(std::shared_ptr<SystemDe
     assert(m_pdata);
     assert(m_nlist);
 
+    // anisotropic pair potentials consume particle orientations
+    m_pdata->setAnisotropicDataInUse();
+
     GlobalArray<Scalar> rcutsq(m_typpair_idx.getNumElements(), m_exec_conf);
     m_rcutsq.swap(rcutsq);
     GlobalArray<Scalar> ronsq(m_typpair_idx.getNumElements(), m_exec_conf);
@@ -267,6 +280,17 @@ AnisoPotentialPair<aniso_evaluator>::AnisoPotentialPair(std::shared_ptr<SystemDe
         hoomd::detail::managed_allocator<shape_type>(m_exec_conf->isCUDAEnabled()));
     m_shape_params.swap(shape_params);
 
+    // torques are computed for all types by default
+    GlobalArray<unsigned int> torque_mask(m_pdata->getNTypes(), m_exec_conf);
+    m_torque_mask.swap(torque_mask);
+        {
+        ArrayHandle<unsigned int> h_torque_mask(m_torque_mask,
+                                                access_location::host,
+                                                access_mode::overwrite);
+        for (unsigned int i = 0; i < m_pdata->getNTypes(); i++)
+            h_torque_mask.data[i] = 1;
+        }
+
     m_r_cut_nlist
         = std::make_shared<GlobalArray<Scalar>>(m_typpair_idx.getNumElements(), m_exec_conf);
     nlist->addRCutMatrix(m_r_cut_nlist);
@@ -418,6 +442,47 @@ pybind11::object AnisoPotentialPair<aniso_evaluator>::getShapePython(std::string
     return m_shape_params[typ_].toPython();
     }
 
+/*! \param typ The type index.
+    \param mask True if torques are computed for particles of this type
+    \note Particles of a masked type receive zero torque from this potential. Potentials whose
+          evaluator implements the torque mask additionally skip the torque math for masked pairs.
+*/
+template<class aniso_evaluator>
+void AnisoPotentialPair<aniso_evaluator>::setTorqueMask(unsigned int typ, bool mask)
+    {
+    if (typ >= m_pdata->getNTypes())
+        {
+        throw std::runtime_error("Error setting torque mask in AnisoPotentialPair");
+        }
+
+    ArrayHandle<unsigned int> h_torque_mask(m_torque_mask,
+                                            access_location::host,
+                                            access_mode::readwrite);
+    h_torque_mask.data[typ] = mask ? 1 : 0;
+    }
+
+/*! \param typ The type name.
+    \param mask True if torques are computed for particles of this type
+*/
+template<class aniso_evaluator>
+void AnisoPotentialPair<aniso_evaluator>::setTorqueMaskPython(std::string typ, bool mask)
+    {
+    auto typ_ = m_pdata->getTypeByName(typ);
+    setTorqueMask(typ_, mask);
+    }
+
+/*! \param typ The type name.
+ */
+template<class aniso_evaluator>
+bool AnisoPotentialPair<aniso_evaluator>::getTorqueMaskPython(std::string typ)
+    {
+    auto typ_ = m_pdata->getTypeByName(typ);
+    ArrayHandle<unsigned int> h_torque_mask(m_torque_mask,
+                                            access_location::host,
+                                            access_mode::read);
+    return h_torque_mask.data[typ_] != 0;
+    }
+
 /*! \param typ1 First type index in the pair
     \param typ2 Second type index in the pair
     \param rcut Cutoff radius to set
@@ -504,6 +569,9 @@ void AnisoPotentialPair<aniso_evaluator>::computeForces(uint64_t timestep)
 
     const BoxDim box = m_pdata->getBox();
     ArrayHandle<Scalar> h_rcutsq(m_rcutsq, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_torque_mask(m_torque_mask,
+                                            access_location::host,
+                                            access_mode::read);
         {
         // need to start from a zero force, energy and virial
         memset(&h_force.data[0], 0, sizeof(Scalar4) * m_pdata->getN());
@@ -529,6 +597,9 @@ void AnisoPotentialPair<aniso_evaluator>::computeForces(uint64_t timestep)
             if (aniso_evaluator::needsCharge())
                 qi = h_charge.data[i];
 
+            // check if the torque on this particle is needed (see setTorqueMask())
+            bool torque_mask_i = h_torque_mask.data[typei] != 0;
+
             // initialize current particle force, torque, potential energy, and virial to 0
             Scalar fxi = Scalar(0.0);
             Scalar fyi = Scalar(0.0);
@@ -567,6 +638,8 @@ void AnisoPotentialPair<aniso_evaluator>::computeForces(uint64_t timestep)
                 if (aniso_evaluator::needsCharge())
                     qj = h_charge.data[j];
 
+                bool torque_mask_j = h_torque_mask.data[typej] != 0;
+
                 // apply periodic boundary conditions
                 dx = box.minImage(dx);
 
@@ -596,6 +669,8 @@ void AnisoPotentialPair<aniso_evaluator>::computeForces(uint64_t timestep)
                     eval.setShape(&m_shape_params[typei], &m_shape_params[typej]);
                 if (aniso_evaluator::needsTags())
                     eval.setTags(h_tag.data[i], h_tag.data[j]);
+                if (aniso_evaluator::implementsTorqueMask())
+                    eval.setTorqueMask(torque_mask_i, torque_mask_j);
 
                 bool evaluated = eval.evaluate(force, pair_eng, energy_shift, torque_i, torque_j);
 
@@ -608,9 +683,12 @@ void AnisoPotentialPair<aniso_evaluator>::computeForces(uint64_t timestep)
                     fxi += force.x;
                     fyi += force.y;
                     fzi += force.z;
-                    txi += torque_i.x;
-                    tyi += torque_i.y;
-                    tzi += torque_i.z;
+                    if (torque_mask_i)
+                        {
+                        txi += torque_i.x;
+                        tyi += torque_i.y;
+                        tzi += torque_i.z;
+                        }
                     pei += pair_eng * Scalar(0.5);
 
                     if (compute_virial)
@@ -630,9 +708,12 @@ void AnisoPotentialPair<aniso_evaluator>::computeForces(uint64_t timestep)
                         h_force.data[j].x -= force.x;
                         h_force.data[j].y -= force.y;
                         h_force.data[j].z -= force.z;
-                        h_torque.data[j].x += torque_j.x;
-                        h_torque.data[j].y += torque_j.y;
-                        h_torque.data[j].z += torque_j.z;
+                        if (torque_mask_j)
+                            {
+                            h_torque.data[j].x += torque_j.x;
+                            h_torque.data[j].y += torque_j.y;
+                            h_torque.data[j].z += torque_j.z;
+                            }
                         h_force.data[j].w += pair_eng * Scalar(0.5);
                         if (compute_virial)
                             {
@@ -707,6 +788,8 @@ template<class T> void export_AnisoPotentialPair(pybind11::module& m, const std:
         .def("getParams", &AnisoPotentialPair<T>::getParamsPython)
         .def("setShape", &AnisoPotentialPair<T>::setShapePython)
         .def("getShape", &AnisoPotentialPair<T>::getShapePython)
+        .def("setTorqueMask", &AnisoPotentialPair<T>::setTorqueMaskPython)
+        .def("getTorqueMask", &AnisoPotentialPair<T>::getTorqueMaskPython)
         .def("setRCut", &AnisoPotentialPair<T>::setRCutPython)
         .def("getRCut", &AnisoPotentialPair<T>::getRCut)
         .def_property("mode",
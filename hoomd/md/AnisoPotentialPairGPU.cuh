@@ -56,6 +56,7 @@ struct a_pair_args_t
                   const unsigned int* _d_nlist,
                   const size_t* _d_head_list,
                   const Scalar* _d_rcutsq,
+                  const unsigned int* _d_torque_mask,
                   const unsigned int _ntypes,
                   const unsigned int _block_size,
                   const unsigned int _shift_mode,
@@ -67,7 +68,8 @@ struct a_pair_args_t
         : d_force(_d_force), d_torque(_d_torque), d_virial(_d_virial), virial_pitch(_virial_pitch),
           N(_N), n_max(_n_max), d_pos(_d_pos), d_charge(_d_charge), d_orientation(_d_orientation),
           d_tag(_d_tag), box(_box), d_n_neigh(_d_n_neigh), d_nlist(_d_nlist),
-          d_head_list(_d_head_list), d_rcutsq(_d_rcutsq), ntypes(_ntypes), block_size(_block_size),
+          d_head_list(_d_head_list), d_rcutsq(_d_rcutsq), d_torque_mask(_d_torque_mask),
+          ntypes(_ntypes), block_size(_block_size),
           shift_mode(_shift_mode), compute_virial(_compute_virial),
           threads_per_particle(_threads_per_particle), gpu_partition(_gpu_partition),
           devprop(_devprop), update_shape_param(_update_shape_param) {};
@@ -88,7 +90,8 @@ struct a_pair_args_t
     const unsigned int* d_nlist; //!< Device array listing the neighbors of each particle
     const size_t* d_head_list;   //!< Device array listing beginning of each particle's neighbors
     const Scalar* d_rcutsq;      //!< Device array listing r_cut squared per particle type pair
-    const unsigned int ntypes;   //!< Number of particle types in the simulation
+    const unsigned int* d_torque_mask; //!< Device array listing the torque mask per particle type
+    const unsigned int ntypes;         //!< Number of particle types in the simulation
     const unsigned int block_size;           //!< Block size to execute
     const unsigned int shift_mode;           //!< The potential energy shift mode
     const unsigned int compute_virial;       //!< Flag to indicate if virials should be computed
@@ -120,6 +123,7 @@ struct a_pair_args_t
     \param d_head_list Device memory array listing beginning of each particle's neighbors
     \param d_params Parameters for the potential, stored per type pair
     \param d_rcutsq rcut squared, stored per type pair
+    \param d_torque_mask Flag whether torques are computed, stored per type
     \param ntypes Number of types in the simulation
     \param tpp Number of threads per particle
 
@@ -158,6 +162,7 @@ gpu_compute_pair_aniso_forces_kernel(Scalar4* d_force,
                                      const typename evaluator::param_type* d_params,
                                      const typename evaluator::shape_type* d_shape_params,
                                      const Scalar* d_rcutsq,
+                                     const unsigned int* d_torque_mask,
                                      const unsigned int ntypes,
                                      const unsigned int offset,
                                      unsigned int max_extra_bytes)
@@ -250,6 +255,9 @@ gpu_compute_pair_aniso_forces_kernel(Scalar4* d_force,
         if (evaluator::needsCharge())
             qi = __ldg(d_charge + idx);
 
+        // check if the torque on this particle is needed
+        bool torque_mask_i = __ldg(d_torque_mask + __scalar_as_int(postypei.w)) != 0;
+
         size_t my_head = d_head_list[idx];
         unsigned int cur_j = 0;
 
@@ -313,6 +321,11 @@ gpu_compute_pair_aniso_forces_kernel(Scalar4* d_force,
                                   &(s_shape_params[__scalar_as_int(postypej.w)]));
                 if (evaluator::needsTags())
                     eval.setTags(__ldg(d_tag + idx), __ldg(d_tag + cur_j));
+                if (evaluator::implementsTorqueMask())
+                    {
+                    // the torque on j is accumulated by j's own thread
+                    eval.setTorqueMask(torque_mask_i, false);
+                    }
 
                 // call evaluator
                 eval.evaluate(jforce, pair_eng, energy_shift, torquei, torquej);
@@ -333,9 +346,12 @@ gpu_compute_pair_aniso_forces_kernel(Scalar4* d_force,
                 force.x += jforce.x;
                 force.y += jforce.y;
                 force.z += jforce.z;
-                torque.x += torquei.x;
-                torque.y += torquei.y;
-                torque.z += torquei.z;
+                if (torque_mask_i)
+                    {
+                    torque.x += torquei.x;
+                    torque.y += torquei.y;
+                    torque.z += torquei.z;
+                    }
 
                 force.w += pair_eng;
                 }
@@ -488,6 +504,7 @@ struct AnisoPairForceComputeKernel
                 params,
                 shape_params,
                 pair_args.d_rcutsq,
+                pair_args.d_torque_mask,
                 pair_args.ntypes,
                 offset,
                 max_extra_bytes);
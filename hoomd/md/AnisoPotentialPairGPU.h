@@ -128,6 +128,9 @@ template<class evaluator> void AnisoPotentialPairGPU<evaluator>::computeForces(u
 
     // access parameters
     ArrayHandle<Scalar> d_rcutsq(this->m_rcutsq, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_torque_mask(this->m_torque_mask,
+                                            access_location::device,
+                                            access_mode::read);
     ArrayHandle<Scalar4> d_force(this->m_force, access_location::device, access_mode::overwrite);
     ArrayHandle<Scalar4> d_torque(this->m_torque, access_location::device, access_mode::overwrite);
     ArrayHandle<Scalar> d_virial(this->m_virial, access_location::device, access_mode::overwrite);
@@ -161,6 +164,7 @@ template<class evaluator> void AnisoPotentialPairGPU<evaluator>::computeForces(u
                               d_nlist.data,
                               d_head_list.data,
                               d_rcutsq.data,
+                              d_torque_mask.data,
                               this->m_pdata->getNTypes(),
                               block_size,
                               this->m_shift_mode,
@@ -0,0 +1,249 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "COMDistanceBias.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#ifdef ENABLE_MPI
+#include "hoomd/HOOMDMPI.h"
+#endif
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \file COMDistanceBias.cc
+    \brief Contains code for the COMDistanceBias class
+*/
+
+/*! \param sysdef SystemDefinition this compute acts on
+    \param group_a First group defining the collective variable
+    \param group_b Second group defining the collective variable
+*/
+COMDistanceBias::COMDistanceBias(std::shared_ptr<SystemDefinition> sysdef,
+                                 std::shared_ptr<ParticleGroup> group_a,
+                                 std::shared_ptr<ParticleGroup> group_b)
+    : ForceCompute(sysdef), m_group_a(group_a), m_group_b(group_b), m_kappa(0), m_r0(0),
+      m_hill_height(0), m_hill_width(0), m_hill_period(0), m_multi_walker(false), m_last_cv(0)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing COMDistanceBias" << endl;
+
+    if (m_group_a->getNumMembersGlobal() == 0 || m_group_b->getNumMembersGlobal() == 0)
+        {
+        throw std::runtime_error("COMDistanceBias requires two non-empty groups.");
+        }
+    }
+
+COMDistanceBias::~COMDistanceBias()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying COMDistanceBias" << endl;
+    }
+
+pybind11::list COMDistanceBias::getHills() const
+    {
+    pybind11::list hills;
+    for (const Scalar2& hill : m_hills)
+        {
+        hills.append(pybind11::make_tuple(hill.x, hill.y));
+        }
+    return hills;
+    }
+
+void COMDistanceBias::setHills(pybind11::list hills)
+    {
+    m_hills.clear();
+    for (const auto& entry : hills)
+        {
+        pybind11::tuple t = pybind11::cast<pybind11::tuple>(entry);
+        if (pybind11::len(t) != 2)
+            {
+            throw std::invalid_argument("hills must be (center, height) 2-tuples");
+            }
+        m_hills.push_back(
+            make_scalar2(pybind11::cast<Scalar>(t[0]), pybind11::cast<Scalar>(t[1])));
+        }
+    }
+
+/*! Sums the mass-weighted, image-unwrapped positions of the group members on this rank and
+    reduces the partial sums across the domain decomposition.
+
+    \param group Group to average over
+    \param total_mass [out] Total mass of the group
+    \returns The center of mass of the group in unwrapped coordinates
+*/
+Scalar3 COMDistanceBias::computeGroupCOM(const std::shared_ptr<ParticleGroup>& group,
+                                         Scalar& total_mass)
+    {
+    const BoxDim& box = m_pdata->getGlobalBox();
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::read);
+    ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+
+    Scalar3 weighted_sum = make_scalar3(0, 0, 0);
+    total_mass = Scalar(0);
+
+    for (unsigned int group_idx = 0; group_idx < group->getNumMembers(); group_idx++)
+        {
+        const unsigned int j = group->getMemberIndex(group_idx);
+        Scalar3 pos = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+        pos = box.shift(pos, h_image.data[j]);
+        const Scalar mass = h_vel.data[j].w;
+        weighted_sum += mass * pos;
+        total_mass += mass;
+        }
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        Scalar buf[4] = {weighted_sum.x, weighted_sum.y, weighted_sum.z, total_mass};
+        MPI_Allreduce(MPI_IN_PLACE, buf, 4, MPI_HOOMD_SCALAR, MPI_SUM, m_exec_conf->getMPICommunicator());
+        weighted_sum = make_scalar3(buf[0], buf[1], buf[2]);
+        total_mass = buf[3];
+        }
+#endif
+
+    return weighted_sum / total_mass;
+    }
+
+/*! Appends a Gaussian hill centered at the current collective variable value. With
+    multi_walker enabled, the values of all partitions are gathered and one hill per
+    partition is appended, so every walker records the same set of hills. This requires
+    all partitions to execute the deposition at the same timestep.
+
+    \param s Value of the collective variable
+*/
+void COMDistanceBias::depositHill(Scalar s)
+    {
+#ifdef ENABLE_MPI
+    auto mpi_conf = m_exec_conf->getMPIConfig();
+    if (m_multi_walker && mpi_conf->getNRanksGlobal() > mpi_conf->getNRanks())
+        {
+        std::vector<Scalar> all_s(mpi_conf->getNRanksGlobal());
+        MPI_Allgather(&s,
+                      1,
+                      MPI_HOOMD_SCALAR,
+                      all_s.data(),
+                      1,
+                      MPI_HOOMD_SCALAR,
+                      m_exec_conf->getHOOMDWorldMPICommunicator());
+
+        // keep one hill per partition: the value of each partition's root rank
+        const unsigned int ranks_per_partition = mpi_conf->getNRanks();
+        const unsigned int n_partitions = mpi_conf->getNRanksGlobal() / ranks_per_partition;
+        for (unsigned int p = 0; p < n_partitions; p++)
+            {
+            m_hills.push_back(make_scalar2(all_s[p * ranks_per_partition], m_hill_height));
+            }
+        return;
+        }
+#endif
+
+    m_hills.push_back(make_scalar2(s, m_hill_height));
+    }
+
+/*! Computes the bias force at the given timestep and deposits a hill when due.
+
+    \param timestep Current timestep
+*/
+void COMDistanceBias::computeForces(uint64_t timestep)
+    {
+    Scalar mass_a, mass_b;
+    const Scalar3 com_a = computeGroupCOM(m_group_a, mass_a);
+    const Scalar3 com_b = computeGroupCOM(m_group_b, mass_b);
+
+    const Scalar3 dr = com_a - com_b;
+    const Scalar s = slow::sqrt(dot(dr, dr));
+    m_last_cv = s;
+
+    if (m_hill_height != Scalar(0) && m_hill_width != Scalar(0) && m_hill_period != 0
+        && timestep % m_hill_period == 0)
+        {
+        depositHill(s);
+        }
+
+    // evaluate the bias potential and its derivative along the collective variable
+    Scalar energy = Scalar(0.5) * m_kappa * (s - m_r0) * (s - m_r0);
+    Scalar dU_ds = m_kappa * (s - m_r0);
+    const Scalar sigma_sq = m_hill_width * m_hill_width;
+    for (const Scalar2& hill : m_hills)
+        {
+        const Scalar delta = s - hill.x;
+        const Scalar gauss = hill.y * slow::exp(-delta * delta / (Scalar(2.0) * sigma_sq));
+        energy += gauss;
+        dU_ds += -delta / sigma_sq * gauss;
+        }
+
+    // unit vector along the collective variable: when the centers of mass coincide the
+    // derivative direction is undefined and no force is applied
+    Scalar3 unit_dr = make_scalar3(0, 0, 0);
+    if (s > Scalar(0))
+        unit_dr = dr / s;
+
+    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::read);
+    memset((void*)h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+
+    // split the potential energy evenly over all members of both groups so that it sums to
+    // the bias energy across ranks
+    const Scalar energy_per_particle
+        = energy / Scalar(m_group_a->getNumMembersGlobal() + m_group_b->getNumMembersGlobal());
+
+    // the bias force on each member is the chain rule through its group's center of mass:
+    // the total force -dU/ds along the unit vector, distributed by mass fraction
+    for (unsigned int group_idx = 0; group_idx < m_group_a->getNumMembers(); group_idx++)
+        {
+        const unsigned int j = m_group_a->getMemberIndex(group_idx);
+        const Scalar prefactor = -dU_ds * h_vel.data[j].w / mass_a;
+        h_force.data[j].x = prefactor * unit_dr.x;
+        h_force.data[j].y = prefactor * unit_dr.y;
+        h_force.data[j].z = prefactor * unit_dr.z;
+        h_force.data[j].w = energy_per_particle;
+        }
+    for (unsigned int group_idx = 0; group_idx < m_group_b->getNumMembers(); group_idx++)
+        {
+        const unsigned int j = m_group_b->getMemberIndex(group_idx);
+        const Scalar prefactor = dU_ds * h_vel.data[j].w / mass_b;
+        h_force.data[j].x = prefactor * unit_dr.x;
+        h_force.data[j].y = prefactor * unit_dr.y;
+        h_force.data[j].z = prefactor * unit_dr.z;
+        h_force.data[j].w = energy_per_particle;
+        }
+    }
+
+namespace detail
+    {
+void export_COMDistanceBias(pybind11::module& m)
+    {
+    pybind11::class_<COMDistanceBias, ForceCompute, std::shared_ptr<COMDistanceBias>>(
+        m,
+        "COMDistanceBias")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<ParticleGroup>,
+                            std::shared_ptr<ParticleGroup>>())
+        .def_property("kappa", &COMDistanceBias::getKappa, &COMDistanceBias::setKappa)
+        .def_property("r0", &COMDistanceBias::getR0, &COMDistanceBias::setR0)
+        .def_property("hill_height",
+                      &COMDistanceBias::getHillHeight,
+                      &COMDistanceBias::setHillHeight)
+        .def_property("hill_width",
+                      &COMDistanceBias::getHillWidth,
+                      &COMDistanceBias::setHillWidth)
+        .def_property("hill_period",
+                      &COMDistanceBias::getHillPeriod,
+                      &COMDistanceBias::setHillPeriod)
+        .def_property("multi_walker",
+                      &COMDistanceBias::getMultiWalker,
+                      &COMDistanceBias::setMultiWalker)
+        .def_property_readonly("collective_variable", &COMDistanceBias::getCollectiveVariable)
+        .def("getHills", &COMDistanceBias::getHills)
+        .def("setHills", &COMDistanceBias::setHills);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,165 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/ForceCompute.h"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/ParticleGroup.h"
+#include <memory>
+#include <vector>
+
+/*! \file COMDistanceBias.h
+    \brief Declares a bias force on the distance between two group centers of mass
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#ifndef __COMDISTANCEBIAS_H__
+#define __COMDISTANCEBIAS_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Biases the distance between the centers of mass of two particle groups
+/*! The collective variable is the distance s between the unwrapped centers of mass of two
+    groups. The bias potential is a harmonic umbrella plus accumulated Gaussian hills:
+
+    U(s) = kappa/2 (s - r0)^2 + sum_i h exp(-(s - s_i)^2 / (2 sigma^2))
+
+    With a zero hill height the force reduces to plain umbrella sampling; with a nonzero
+    height a hill is deposited every hill_period steps, giving metadynamics along s. When
+    multi_walker is enabled, hills deposited by every partition of the MPI world are shared,
+    so walkers running in separate partitions fill the free energy surface together.
+
+    The bias force on each group member is the center of mass derivative, i.e. the total
+    force on the group distributed by mass fraction. The bias does not contribute to the
+    virial.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT COMDistanceBias : public ForceCompute
+    {
+    public:
+    //! Constructs the compute
+    COMDistanceBias(std::shared_ptr<SystemDefinition> sysdef,
+                    std::shared_ptr<ParticleGroup> group_a,
+                    std::shared_ptr<ParticleGroup> group_b);
+
+    //! Destructor
+    virtual ~COMDistanceBias();
+
+    /// Set the umbrella spring constant
+    void setKappa(Scalar kappa)
+        {
+        m_kappa = kappa;
+        }
+
+    /// Get the umbrella spring constant
+    Scalar getKappa() const
+        {
+        return m_kappa;
+        }
+
+    /// Set the umbrella minimum
+    void setR0(Scalar r0)
+        {
+        m_r0 = r0;
+        }
+
+    /// Get the umbrella minimum
+    Scalar getR0() const
+        {
+        return m_r0;
+        }
+
+    /// Set the hill height (0 disables hill deposition)
+    void setHillHeight(Scalar height)
+        {
+        m_hill_height = height;
+        }
+
+    /// Get the hill height
+    Scalar getHillHeight() const
+        {
+        return m_hill_height;
+        }
+
+    /// Set the hill width
+    void setHillWidth(Scalar width)
+        {
+        m_hill_width = width;
+        }
+
+    /// Get the hill width
+    Scalar getHillWidth() const
+        {
+        return m_hill_width;
+        }
+
+    /// Set the number of steps between hill depositions (0 disables hill deposition)
+    void setHillPeriod(uint64_t period)
+        {
+        m_hill_period = period;
+        }
+
+    /// Get the number of steps between hill depositions
+    uint64_t getHillPeriod() const
+        {
+        return m_hill_period;
+        }
+
+    /// Set whether hills are shared across the partitions of the MPI world
+    void setMultiWalker(bool multi_walker)
+        {
+        m_multi_walker = multi_walker;
+        }
+
+    /// Get whether hills are shared across the partitions of the MPI world
+    bool getMultiWalker() const
+        {
+        return m_multi_walker;
+        }
+
+    /// Get the value of the collective variable at the last force computation
+    Scalar getCollectiveVariable() const
+        {
+        return m_last_cv;
+        }
+
+    /// Get the accumulated hills as a list of (center, height) tuples
+    pybind11::list getHills() const;
+
+    /// Replace the accumulated hills (restores a previous run's state)
+    void setHills(pybind11::list hills);
+
+    protected:
+    //! Actually compute the forces
+    virtual void computeForces(uint64_t timestep);
+
+    //! Compute the unwrapped center of mass of a group, reduced over the partition
+    Scalar3 computeGroupCOM(const std::shared_ptr<ParticleGroup>& group, Scalar& total_mass);
+
+    //! Deposit a hill at the current collective variable value
+    void depositHill(Scalar s);
+
+    std::shared_ptr<ParticleGroup> m_group_a; //!< First group defining the distance
+    std::shared_ptr<ParticleGroup> m_group_b; //!< Second group defining the distance
+
+    Scalar m_kappa;          //!< Umbrella spring constant
+    Scalar m_r0;             //!< Umbrella minimum
+    Scalar m_hill_height;    //!< Gaussian hill height (0 disables deposition)
+    Scalar m_hill_width;     //!< Gaussian hill width
+    uint64_t m_hill_period;  //!< Steps between hill depositions (0 disables deposition)
+    bool m_multi_walker;     //!< Share hills across MPI world partitions
+    Scalar m_last_cv;        //!< Collective variable at the last computation
+
+    std::vector<Scalar2> m_hills; //!< Deposited hills as (center, height)
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+#endif
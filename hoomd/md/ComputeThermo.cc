@@ -6,6 +6,7 @@
 */
 
 #include "ComputeThermo.h"
+#include "hoomd/MetricRegistry.h"
 #include "hoomd/VectorMath.h"
 
 #ifdef ENABLE_MPI
@@ -56,6 +57,82 @@ ComputeThermo::ComputeThermo(std::shared_ptr<SystemDefinition> sysdef,
 ComputeThermo::~ComputeThermo()
     {
     m_exec_conf->msg->notice(5) << "Destroying ComputeThermo" << endl;
+    disconnectMetrics();
+    }
+
+/*! \param prefix Namespace prefix prepended (with a '.') to the metric names
+
+    Registers all scalar quantities this compute provides in the system MetricRegistry under
+    names matching the Python loggable names. The registry passes this compute so that
+    MetricRegistry::collect() brings the properties up to date before reading them. Re-connecting
+    with a new prefix replaces the previous registration.
+*/
+void ComputeThermo::connectMetrics(const std::string& prefix)
+    {
+    auto registry = m_sysdef->getMetricRegistry();
+    registry->removeMetrics(this);
+
+    registry->registerMetric(
+        this,
+        prefix + ".kinetic_temperature",
+        [this] { return double(getTemperature()); },
+        this);
+    registry->registerMetric(
+        this,
+        prefix + ".pressure",
+        [this] { return double(getPressure()); },
+        this);
+    registry->registerMetric(
+        this,
+        prefix + ".kinetic_energy",
+        [this] { return double(getKineticEnergy()); },
+        this);
+    registry->registerMetric(
+        this,
+        prefix + ".translational_kinetic_energy",
+        [this] { return double(getTranslationalKineticEnergy()); },
+        this);
+    registry->registerMetric(
+        this,
+        prefix + ".rotational_kinetic_energy",
+        [this] { return double(getRotationalKineticEnergy()); },
+        this);
+    registry->registerMetric(
+        this,
+        prefix + ".potential_energy",
+        [this] { return double(getPotentialEnergy()); },
+        this);
+    registry->registerMetric(this,
+                             prefix + ".degrees_of_freedom",
+                             [this] { return getNDOF(); },
+                             this);
+    registry->registerMetric(this,
+                             prefix + ".translational_degrees_of_freedom",
+                             [this] { return getTranslationalDOF(); },
+                             this);
+    registry->registerMetric(this,
+                             prefix + ".rotational_degrees_of_freedom",
+                             [this] { return getRotationalDOF(); },
+                             this);
+    registry->registerMetric(this,
+                             prefix + ".num_particles",
+                             [this] { return double(getNumParticles()); },
+                             this);
+    registry->registerMetric(this,
+                             prefix + ".volume",
+                             [this] { return double(getVolume()); },
+                             this);
+
+    m_metrics_connected = true;
+    }
+
+void ComputeThermo::disconnectMetrics()
+    {
+    if (m_metrics_connected)
+        {
+        m_sysdef->getMetricRegistry()->removeMetrics(this);
+        m_metrics_connected = false;
+        }
     }
 
 /*! Calls computeProperties if the properties need updating
@@ -100,6 +177,7 @@ void ComputeThermo::computeProperties()
     double ke_trans_total = 0.0;
 
     PDataFlags flags = m_pdata->getFlags();
+    const bool compute_pressure_tensor = flags[pdata_flag::pressure_tensor];
 
     double pressure_kinetic_xx = 0.0;
     double pressure_kinetic_xy = 0.0;
@@ -108,44 +186,68 @@ void ComputeThermo::computeProperties()
     double pressure_kinetic_yz = 0.0;
     double pressure_kinetic_zz = 0.0;
 
-    if (flags[pdata_flag::pressure_tensor])
+    // total potential energy
+    double pe_total = 0.0;
+
+    double virial_xx = m_pdata->getExternalVirial(0);
+    double virial_xy = m_pdata->getExternalVirial(1);
+    double virial_xz = m_pdata->getExternalVirial(2);
+    double virial_yy = m_pdata->getExternalVirial(3);
+    double virial_yz = m_pdata->getExternalVirial(4);
+    double virial_zz = m_pdata->getExternalVirial(5);
+
+    size_t virial_pitch = net_virial.getPitch();
+
+    // accumulate the translational kinetic energy, potential energy, and virial contributions
+    // in a single pass over the group so that the rigid body eligibility of each member is
+    // evaluated only once per call
+    for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
         {
-        // Calculate kinetic part of pressure tensor
-        for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+        unsigned int j = m_group->getMemberIndex(group_idx);
+        // ignore rigid body constituent particles in the sum
+        if (h_body.data[j] < MIN_FLOPPY && h_body.data[j] != h_tag.data[j])
             {
-            unsigned int j = m_group->getMemberIndex(group_idx);
-            // ignore rigid body constituent particles in the sum
-            if (h_body.data[j] >= MIN_FLOPPY || h_body.data[j] == h_tag.data[j])
-                {
-                double mass = h_vel.data[j].w;
-                pressure_kinetic_xx += mass * ((double)h_vel.data[j].x * (double)h_vel.data[j].x);
-                pressure_kinetic_xy += mass * ((double)h_vel.data[j].x * (double)h_vel.data[j].y);
-                pressure_kinetic_xz += mass * ((double)h_vel.data[j].x * (double)h_vel.data[j].z);
-                pressure_kinetic_yy += mass * ((double)h_vel.data[j].y * (double)h_vel.data[j].y);
-                pressure_kinetic_yz += mass * ((double)h_vel.data[j].y * (double)h_vel.data[j].z);
-                pressure_kinetic_zz += mass * ((double)h_vel.data[j].z * (double)h_vel.data[j].z);
-                }
+            continue;
             }
+
+        if (compute_pressure_tensor)
+            {
+            // Calculate kinetic part of pressure tensor
+            double mass = h_vel.data[j].w;
+            pressure_kinetic_xx += mass * ((double)h_vel.data[j].x * (double)h_vel.data[j].x);
+            pressure_kinetic_xy += mass * ((double)h_vel.data[j].x * (double)h_vel.data[j].y);
+            pressure_kinetic_xz += mass * ((double)h_vel.data[j].x * (double)h_vel.data[j].z);
+            pressure_kinetic_yy += mass * ((double)h_vel.data[j].y * (double)h_vel.data[j].y);
+            pressure_kinetic_yz += mass * ((double)h_vel.data[j].y * (double)h_vel.data[j].z);
+            pressure_kinetic_zz += mass * ((double)h_vel.data[j].z * (double)h_vel.data[j].z);
+
+            // Calculate upper triangular virial tensor
+            virial_xx += (double)h_net_virial.data[j + 0 * virial_pitch];
+            virial_xy += (double)h_net_virial.data[j + 1 * virial_pitch];
+            virial_xz += (double)h_net_virial.data[j + 2 * virial_pitch];
+            virial_yy += (double)h_net_virial.data[j + 3 * virial_pitch];
+            virial_yz += (double)h_net_virial.data[j + 4 * virial_pitch];
+            virial_zz += (double)h_net_virial.data[j + 5 * virial_pitch];
+            }
+        else
+            {
+            ke_trans_total += (double)h_vel.data[j].w
+                              * ((double)h_vel.data[j].x * (double)h_vel.data[j].x
+                                 + (double)h_vel.data[j].y * (double)h_vel.data[j].y
+                                 + (double)h_vel.data[j].z * (double)h_vel.data[j].z);
+            }
+
+        pe_total += (double)h_net_force.data[j].w;
+        }
+
+    if (compute_pressure_tensor)
+        {
         // kinetic energy = 1/2 trace of kinetic part of pressure tensor
         ke_trans_total
             = Scalar(0.5) * (pressure_kinetic_xx + pressure_kinetic_yy + pressure_kinetic_zz);
         }
     else
         {
-        // total kinetic energy
-        for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
-            {
-            unsigned int j = m_group->getMemberIndex(group_idx);
-            // ignore rigid body constituent particles in the sum
-            if (h_body.data[j] >= MIN_FLOPPY || h_body.data[j] == h_tag.data[j])
-                {
-                ke_trans_total += (double)h_vel.data[j].w
-                                  * ((double)h_vel.data[j].x * (double)h_vel.data[j].x
-                                     + (double)h_vel.data[j].y * (double)h_vel.data[j].y
-                                     + (double)h_vel.data[j].z * (double)h_vel.data[j].z);
-                }
-            }
-
         ke_trans_total *= Scalar(0.5);
         }
 
@@ -180,15 +282,15 @@ void ComputeThermo::computeProperties()
                 // carries angular momentum
                 if (I.x > 0)
                     {
-                    ke_rot_total += s.v.x * s.v.x / I.x;
+                    ke_rot_total += (double)s.v.x * (double)s.v.x / (double)I.x;
                     }
                 if (I.y > 0)
                     {
-                    ke_rot_total += s.v.y * s.v.y / I.y;
+                    ke_rot_total += (double)s.v.y * (double)s.v.y / (double)I.y;
                     }
                 if (I.z > 0)
                     {
-                    ke_rot_total += s.v.z * s.v.z / I.z;
+                    ke_rot_total += (double)s.v.z * (double)s.v.z / (double)I.z;
                     }
                 }
             }
@@ -196,48 +298,11 @@ void ComputeThermo::computeProperties()
         ke_rot_total /= Scalar(2.0);
         }
 
-    // total potential energy
-    double pe_total = 0.0;
-    for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
-        {
-        unsigned int j = m_group->getMemberIndex(group_idx);
-
-        // ignore rigid body constituent particles in the sum
-        if (h_body.data[j] >= MIN_FLOPPY || h_body.data[j] == h_tag.data[j])
-            {
-            pe_total += (double)h_net_force.data[j].w;
-            }
-        }
-
     pe_total += m_pdata->getExternalEnergy();
 
     double W = 0.0;
-    double virial_xx = m_pdata->getExternalVirial(0);
-    double virial_xy = m_pdata->getExternalVirial(1);
-    double virial_xz = m_pdata->getExternalVirial(2);
-    double virial_yy = m_pdata->getExternalVirial(3);
-    double virial_yz = m_pdata->getExternalVirial(4);
-    double virial_zz = m_pdata->getExternalVirial(5);
-
-    if (flags[pdata_flag::pressure_tensor])
+    if (compute_pressure_tensor)
         {
-        // Calculate upper triangular virial tensor
-        size_t virial_pitch = net_virial.getPitch();
-        for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
-            {
-            unsigned int j = m_group->getMemberIndex(group_idx);
-            // ignore rigid body constituent particles in the sum
-            if (h_body.data[j] >= MIN_FLOPPY || h_body.data[j] == h_tag.data[j])
-                {
-                virial_xx += (double)h_net_virial.data[j + 0 * virial_pitch];
-                virial_xy += (double)h_net_virial.data[j + 1 * virial_pitch];
-                virial_xz += (double)h_net_virial.data[j + 2 * virial_pitch];
-                virial_yy += (double)h_net_virial.data[j + 3 * virial_pitch];
-                virial_yz += (double)h_net_virial.data[j + 4 * virial_pitch];
-                virial_zz += (double)h_net_virial.data[j + 5 * virial_pitch];
-                }
-            }
-
         // isotropic virial = 1/3 trace of virial tensor
         W = Scalar(1. / 3.) * (virial_xx + virial_yy + virial_zz);
         }
@@ -330,7 +395,9 @@ void export_ComputeThermo(pybind11::module& m)
         .def_property_readonly("rotational_kinetic_energy",
                                &ComputeThermo::getRotationalKineticEnergy)
         .def_property_readonly("potential_energy", &ComputeThermo::getPotentialEnergy)
-        .def_property_readonly("volume", &ComputeThermo::getVolume);
+        .def_property_readonly("volume", &ComputeThermo::getVolume)
+        .def("connectMetrics", &ComputeThermo::connectMetrics)
+        .def("disconnectMetrics", &ComputeThermo::disconnectMetrics);
     }
 
     } // end namespace detail
@@ -329,6 +329,12 @@ class PYBIND11_EXPORT ComputeThermo : public Compute
         return m_sysdef->getParticleData()->getGlobalBox().getVolume(two_d);
         }
 
+    //! Publish the scalar thermodynamic quantities to the system metric registry
+    void connectMetrics(const std::string& prefix);
+
+    //! Remove this compute's metrics from the system metric registry
+    void disconnectMetrics();
+
     protected:
     std::shared_ptr<ParticleGroup> m_group; //!< Group to compute properties for
     GlobalArray<Scalar> m_properties;       //!< Stores the computed properties
@@ -336,6 +342,9 @@ class PYBIND11_EXPORT ComputeThermo : public Compute
     /// Store the particle data flags used during the last computation
     PDataFlags m_computed_flags;
 
+    /// True while metrics are registered in the system metric registry
+    bool m_metrics_connected = false;
+
     //! Does the actual computation
     virtual void computeProperties();
 
@@ -59,9 +59,18 @@ void ComputeThermoGPU::computeProperties()
 
     assert(m_pdata);
 
+    // Choose how the partial sum kernels iterate the group. When the members occupy one
+    // contiguous index range (e.g. the all group, or a spatially coherent group after a sort)
+    // the kernels walk the range directly. A non-contiguous group covering most of the system
+    // is scanned densely with the membership flags as predicate instead. Both variants replace
+    // the scattered gather through the member index list with coalesced reads.
+    bool contiguous = m_group->isContiguous();
+    bool use_bitmap = !contiguous && 2 * group_size >= m_pdata->getN();
+
+    unsigned int nwork_total = use_bitmap ? m_pdata->getN() : group_size;
+
     // number of blocks in reduction (round up for every GPU)
-    unsigned int num_blocks
-        = m_group->getNumMembers() / m_block_size + m_exec_conf->getNumActiveGPUs();
+    unsigned int num_blocks = nwork_total / m_block_size + m_exec_conf->getNumActiveGPUs();
 
     // resize work space
     size_t old_size = m_scratch.size();
@@ -155,6 +164,9 @@ void ComputeThermoGPU::computeProperties()
         ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
                                                 access_location::device,
                                                 access_mode::read);
+        ArrayHandle<unsigned int> d_is_member(m_group->getMembershipArray(),
+                                              access_location::device,
+                                              access_mode::read);
 
         m_exec_conf->beginMultiGPU();
 
@@ -186,13 +198,16 @@ void ComputeThermoGPU::computeProperties()
                                    d_vel.data,
                                    d_body.data,
                                    d_tag.data,
-                                   d_index_array.data,
+                                   (contiguous || use_bitmap) ? nullptr : d_index_array.data,
+                                   use_bitmap ? d_is_member.data : nullptr,
+                                   contiguous ? m_group->getContiguousStart() : 0,
                                    group_size,
                                    box,
                                    args,
                                    flags[pdata_flag::pressure_tensor],
                                    flags[pdata_flag::rotational_kinetic_energy],
-                                   m_group->getGPUPartition());
+                                   use_bitmap ? m_pdata->getGPUPartition()
+                                              : m_group->getGPUPartition());
 
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
@@ -27,11 +27,20 @@ namespace kernel
     \param d_velocity Particle velocity and mass array from ParticleData
     \param d_body Particle body id
     \param d_tag Particle tag
-    \param d_group_members List of group members for which to sum properties
+    \param d_group_members List of group members for which to sum properties, or NULL to iterate
+           the contiguous index range starting at range_start
+    \param d_is_member Dense membership flags, one per particle index. Only read when
+           d_group_members is NULL; a NULL value means every index in the range is a member
+    \param range_start First particle index of the range when d_group_members is NULL
     \param work_size Number of particles in the group this GPU processes
     \param offset Offset of this GPU in list of group members
     \param block_offset Offset of this GPU in the array of partial sums
 
+    When d_group_members is NULL, threads map one-to-one onto particle indices and all reads are
+    coalesced: either the group is known to occupy one contiguous index range, or d_is_member
+    predicates a dense scan over all local particles. Both variants avoid the scattered gather
+    through the member index list.
+
     All partial sums are packaged up in a Scalar4 to keep pointer management down.
      - 2*Kinetic energy is summed in .x
      - Potential energy is summed in .y
@@ -51,6 +60,8 @@ __global__ void gpu_compute_thermo_partial_sums(Scalar4* d_scratch,
                                                 unsigned int* d_body,
                                                 unsigned int* d_tag,
                                                 unsigned int* d_group_members,
+                                                const unsigned int* d_is_member,
+                                                unsigned int range_start,
                                                 unsigned int work_size,
                                                 unsigned int offset,
                                                 unsigned int block_offset)
@@ -67,12 +78,22 @@ __global__ void gpu_compute_thermo_partial_sums(Scalar4* d_scratch,
 
     if (group_idx < work_size)
         {
-        unsigned int idx = d_group_members[group_idx + offset];
+        unsigned int idx;
+        bool member = true;
+        if (d_group_members != NULL)
+            {
+            idx = d_group_members[group_idx + offset];
+            }
+        else
+            {
+            idx = range_start + offset + group_idx;
+            member = (d_is_member == NULL) || d_is_member[idx];
+            }
 
-        // ignore rigid body constituent particles in the sum
+        // ignore non-members and rigid body constituent particles in the sum
         unsigned int body = d_body[idx];
         unsigned int tag = d_tag[idx];
-        if (body >= MIN_FLOPPY || body == tag)
+        if (member && (body >= MIN_FLOPPY || body == tag))
             {
             // update positions to the next timestep and update velocities to the next half step
             Scalar4 net_force = d_net_force[idx];
@@ -125,7 +146,10 @@ __global__ void gpu_compute_thermo_partial_sums(Scalar4* d_scratch,
     \param d_velocity Particle velocity and mass array from ParticleData
     \param d_body Particle body id
     \param d_tag Particle tag
-    \param d_group_members List of group members for which to sum properties
+    \param d_group_members List of group members for which to sum properties, or NULL to iterate
+           the contiguous index range starting at range_start
+    \param d_is_member Dense membership flags, only read when d_group_members is NULL
+    \param range_start First particle index of the range when d_group_members is NULL
     \param work_size Number of particles in the group
     \param offset Offset of this GPU in the list of group members
     \param block_offset Offset of this GPU in the array of partial sums
@@ -146,6 +170,8 @@ __global__ void gpu_compute_pressure_tensor_partial_sums(Scalar* d_scratch,
                                                          unsigned int* d_body,
                                                          unsigned int* d_tag,
                                                          unsigned int* d_group_members,
+                                                         const unsigned int* d_is_member,
+                                                         unsigned int range_start,
                                                          unsigned int work_size,
                                                          unsigned int offset,
                                                          unsigned int block_offset,
@@ -168,12 +194,22 @@ __global__ void gpu_compute_pressure_tensor_partial_sums(Scalar* d_scratch,
 
     if (group_idx < work_size)
         {
-        unsigned int idx = d_group_members[group_idx + offset];
+        unsigned int idx;
+        bool member = true;
+        if (d_group_members != NULL)
+            {
+            idx = d_group_members[group_idx + offset];
+            }
+        else
+            {
+            idx = range_start + offset + group_idx;
+            member = (d_is_member == NULL) || d_is_member[idx];
+            }
 
-        // ignore rigid body constituent particles in the sum
+        // ignore non-members and rigid body constituent particles in the sum
         unsigned int body = d_body[idx];
         unsigned int tag = d_tag[idx];
-        if (body >= MIN_FLOPPY || body == tag)
+        if (member && (body >= MIN_FLOPPY || body == tag))
             {
             // compute contribution to pressure tensor and store it in my_element
             Scalar4 vel = d_velocity[idx];
@@ -222,7 +258,10 @@ __global__ void gpu_compute_pressure_tensor_partial_sums(Scalar* d_scratch,
     \param d_inertia Moments of inertia from ParticleData
     \param d_body Particle body id
     \param d_tag Particle tag
-    \param d_group_members List of group members for which to sum properties
+    \param d_group_members List of group members for which to sum properties, or NULL to iterate
+           the contiguous index range starting at range_start
+    \param d_is_member Dense membership flags, only read when d_group_members is NULL
+    \param range_start First particle index of the range when d_group_members is NULL
     \param work_size Number of particles in the group processed by this GPU
     \param offset Offset of this GPU in the list of group members
     \param block_offset Output offset of this GPU
@@ -235,6 +274,8 @@ __global__ void gpu_compute_rotational_ke_partial_sums(Scalar* d_scratch,
                                                        unsigned int* d_body,
                                                        unsigned int* d_tag,
                                                        unsigned int* d_group_members,
+                                                       const unsigned int* d_is_member,
+                                                       unsigned int range_start,
                                                        unsigned int work_size,
                                                        unsigned int offset,
                                                        unsigned int block_offset)
@@ -250,12 +291,22 @@ __global__ void gpu_compute_rotational_ke_partial_sums(Scalar* d_scratch,
 
     if (group_idx < work_size)
         {
-        unsigned int idx = d_group_members[group_idx + offset];
+        unsigned int idx;
+        bool member = true;
+        if (d_group_members != NULL)
+            {
+            idx = d_group_members[group_idx + offset];
+            }
+        else
+            {
+            idx = range_start + offset + group_idx;
+            member = (d_is_member == NULL) || d_is_member[idx];
+            }
 
-        // ignore rigid body constituent particles in the sum
+        // ignore non-members and rigid body constituent particles in the sum
         unsigned int body = d_body[idx];
         unsigned int tag = d_tag[idx];
-        if (body >= MIN_FLOPPY || body == tag)
+        if (member && (body >= MIN_FLOPPY || body == tag))
             {
             quat<Scalar> q(d_orientation[idx]);
             quat<Scalar> p(d_angmom[idx]);
@@ -520,13 +571,17 @@ __global__ void gpu_compute_pressure_tensor_final_sums(Scalar* d_properties,
     \param d_vel particle velocities and masses on the GPU
     \param d_body Particle body id
     \param d_tag Particle tag
-    \param d_group_members List of group members
+    \param d_group_members List of group members, or NULL to iterate particle indices directly
+    \param d_is_member Dense membership flags, only read when d_group_members is NULL
+    \param range_start First particle index of the range when d_group_members is NULL
     \param group_size Number of group members
     \param box Box the particles are in
     \param args Additional arguments
     \param compute_pressure_tensor whether to compute the full pressure tensor
     \param compute_rotational_energy whether to compute the rotational kinetic energy
-    \param gpu_partition Load balancing info for multi-GPU reduction
+    \param gpu_partition Load balancing info for multi-GPU reduction. Must partition the group
+           members when gathering through d_group_members, or the iterated index range when
+           d_group_members is NULL
 
     This function drives gpu_compute_thermo_partial_sums and gpu_compute_thermo_final_sums, see them
    for details.
@@ -537,6 +592,8 @@ hipError_t gpu_compute_thermo_partial(Scalar* d_properties,
                                       unsigned int* d_body,
                                       unsigned int* d_tag,
                                       unsigned int* d_group_members,
+                                      const unsigned int* d_is_member,
+                                      unsigned int range_start,
                                       unsigned int group_size,
                                       const BoxDim& box,
                                       const compute_thermo_args& args,
@@ -546,7 +603,6 @@ hipError_t gpu_compute_thermo_partial(Scalar* d_properties,
     {
     assert(d_properties);
     assert(d_vel);
-    assert(d_group_members);
     assert(args.d_net_force);
     assert(args.d_net_virial);
     assert(args.d_scratch);
@@ -578,6 +634,8 @@ hipError_t gpu_compute_thermo_partial(Scalar* d_properties,
                            d_body,
                            d_tag,
                            d_group_members,
+                           d_is_member,
+                           range_start,
                            nwork,
                            range.first,
                            block_offset);
@@ -602,6 +660,8 @@ hipError_t gpu_compute_thermo_partial(Scalar* d_properties,
                                d_body,
                                d_tag,
                                d_group_members,
+                               d_is_member,
+                               range_start,
                                nwork,
                                range.first,
                                block_offset,
@@ -627,6 +687,8 @@ hipError_t gpu_compute_thermo_partial(Scalar* d_properties,
                                d_body,
                                d_tag,
                                d_group_members,
+                               d_is_member,
+                               range_start,
                                nwork,
                                range.first,
                                block_offset);
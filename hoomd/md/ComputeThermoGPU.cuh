@@ -51,6 +51,8 @@ hipError_t gpu_compute_thermo_partial(Scalar* d_properties,
                                       unsigned int* d_body,
                                       unsigned int* d_tag,
                                       unsigned int* d_group_members,
+                                      const unsigned int* d_is_member,
+                                      unsigned int range_start,
                                       unsigned int group_size,
                                       const BoxDim& box,
                                       const compute_thermo_args& args,
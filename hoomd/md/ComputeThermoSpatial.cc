@@ -0,0 +1,241 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ComputeThermoSpatial.cc
+    \brief Contains code for the ComputeThermoSpatial class
+*/
+
+#include "ComputeThermoSpatial.h"
+
+#ifdef ENABLE_MPI
+#include "hoomd/Communicator.h"
+#include "hoomd/HOOMDMPI.h"
+#endif
+
+#include <cmath>
+#include <iostream>
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System for which to compute thermodynamic properties
+    \param group Subset of the system over which properties are calculated
+    \param nx Number of bins along x
+    \param ny Number of bins along y
+    \param nz Number of bins along z
+*/
+ComputeThermoSpatial::ComputeThermoSpatial(std::shared_ptr<SystemDefinition> sysdef,
+                                           std::shared_ptr<ParticleGroup> group,
+                                           unsigned int nx,
+                                           unsigned int ny,
+                                           unsigned int nz)
+    : Compute(sysdef), m_group(group), m_nx(nx), m_ny(ny), m_nz(nz)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing ComputeThermoSpatial" << endl;
+
+    if (nx == 0 || ny == 0 || nz == 0)
+        throw std::invalid_argument("The grid dimensions must be nonzero.");
+
+    assert(m_pdata);
+    m_nbins = m_nx * m_ny * m_nz;
+    GPUArray<Scalar> bins(num_quantities * m_nbins, m_exec_conf);
+    m_bins.swap(bins);
+
+#ifdef ENABLE_MPI
+    m_properties_reduced = true;
+#endif
+    }
+
+ComputeThermoSpatial::~ComputeThermoSpatial()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying ComputeThermoSpatial" << endl;
+    }
+
+/*! Calls computeProperties if the properties need updating
+    \param timestep Current time step of the simulation
+*/
+void ComputeThermoSpatial::compute(uint64_t timestep)
+    {
+    Compute::compute(timestep);
+    if (!shouldCompute(timestep))
+        return;
+
+    computeProperties();
+    }
+
+Scalar ComputeThermoSpatial::getBinVolume()
+    {
+    const BoxDim& box = m_pdata->getGlobalBox();
+    Scalar3 L = box.getL();
+    Scalar volume;
+    if (m_sysdef->getNDimensions() == 2)
+        {
+        // "volume" is area in 2D
+        volume = L.x * L.y;
+        }
+    else
+        {
+        volume = L.x * L.y * L.z;
+        }
+    return volume / Scalar(m_nbins);
+    }
+
+/*! Bins all per-particle quantities of the group in one pass.
+ */
+void ComputeThermoSpatial::computeProperties()
+    {
+    unsigned int group_size = m_group->getNumMembers();
+
+    assert(m_pdata);
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                               access_location::host,
+                               access_mode::read);
+    const GlobalArray<Scalar>& net_virial = m_pdata->getNetVirial();
+    ArrayHandle<Scalar> h_net_virial(net_virial, access_location::host, access_mode::read);
+    size_t virial_pitch = net_virial.getPitch();
+
+    const BoxDim& box = m_pdata->getGlobalBox();
+
+    PDataFlags flags = m_pdata->getFlags();
+    bool compute_virial = flags[pdata_flag::pressure_tensor];
+
+    ArrayHandle<Scalar> h_bins(m_bins, access_location::host, access_mode::overwrite);
+    memset(h_bins.data, 0, sizeof(Scalar) * num_quantities * m_nbins);
+
+    for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+        {
+        unsigned int j = m_group->getMemberIndex(group_idx);
+
+        // locate the bin from the fractional coordinate in the global box
+        Scalar3 pos = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+        Scalar3 f = box.makeFraction(pos);
+        int ix = std::min((int)(f.x * (Scalar)m_nx), (int)m_nx - 1);
+        int iy = std::min((int)(f.y * (Scalar)m_ny), (int)m_ny - 1);
+        int iz = std::min((int)(f.z * (Scalar)m_nz), (int)m_nz - 1);
+        ix = std::max(ix, 0);
+        iy = std::max(iy, 0);
+        iz = std::max(iz, 0);
+        unsigned int bin = ((unsigned int)ix * m_ny + (unsigned int)iy) * m_nz + (unsigned int)iz;
+
+        h_bins.data[0 * m_nbins + bin] += Scalar(1.0);
+
+        Scalar mass = h_vel.data[j].w;
+        Scalar vsq = h_vel.data[j].x * h_vel.data[j].x + h_vel.data[j].y * h_vel.data[j].y
+                     + h_vel.data[j].z * h_vel.data[j].z;
+        h_bins.data[1 * m_nbins + bin] += Scalar(0.5) * mass * vsq;
+
+        if (compute_virial)
+            {
+            for (unsigned int c = 0; c < 6; c++)
+                h_bins.data[(2 + c) * m_nbins + bin] += h_net_virial.data[j + c * virial_pitch];
+            }
+        }
+
+#ifdef ENABLE_MPI
+    // in MPI, reduce extensive quantities only when they're needed
+    m_properties_reduced = !m_pdata->getDomainDecomposition();
+#endif
+    }
+
+#ifdef ENABLE_MPI
+void ComputeThermoSpatial::reduceProperties()
+    {
+    if (m_properties_reduced)
+        return;
+
+    // reduce properties
+    ArrayHandle<Scalar> h_bins(m_bins, access_location::host, access_mode::readwrite);
+    MPI_Allreduce(MPI_IN_PLACE,
+                  h_bins.data,
+                  num_quantities * m_nbins,
+                  MPI_HOOMD_SCALAR,
+                  MPI_SUM,
+                  m_exec_conf->getMPICommunicator());
+
+    m_properties_reduced = true;
+    }
+#endif
+
+pybind11::array_t<double> ComputeThermoSpatial::getDensityProfile()
+    {
+#ifdef ENABLE_MPI
+    if (!m_properties_reduced)
+        reduceProperties();
+#endif
+
+    double bin_volume = getBinVolume();
+    ArrayHandle<Scalar> h_bins(m_bins, access_location::host, access_mode::read);
+    pybind11::array_t<double> result(m_nbins);
+    double* data = result.mutable_data();
+    for (unsigned int bin = 0; bin < m_nbins; bin++)
+        data[bin] = double(h_bins.data[bin]) / bin_volume;
+    return result;
+    }
+
+pybind11::array_t<double> ComputeThermoSpatial::getKineticEnergyProfile()
+    {
+#ifdef ENABLE_MPI
+    if (!m_properties_reduced)
+        reduceProperties();
+#endif
+
+    ArrayHandle<Scalar> h_bins(m_bins, access_location::host, access_mode::read);
+    pybind11::array_t<double> result(m_nbins);
+    double* data = result.mutable_data();
+    for (unsigned int bin = 0; bin < m_nbins; bin++)
+        data[bin] = double(h_bins.data[m_nbins + bin]);
+    return result;
+    }
+
+pybind11::array_t<double> ComputeThermoSpatial::getVirialProfile()
+    {
+    PDataFlags flags = m_pdata->getFlags();
+    if (!flags[pdata_flag::pressure_tensor])
+        {
+        pybind11::array_t<double> result({(size_t)m_nbins, (size_t)6});
+        double* data = result.mutable_data();
+        for (unsigned int i = 0; i < 6 * m_nbins; i++)
+            data[i] = std::numeric_limits<double>::quiet_NaN();
+        return result;
+        }
+
+#ifdef ENABLE_MPI
+    if (!m_properties_reduced)
+        reduceProperties();
+#endif
+
+    ArrayHandle<Scalar> h_bins(m_bins, access_location::host, access_mode::read);
+    pybind11::array_t<double> result({(size_t)m_nbins, (size_t)6});
+    double* data = result.mutable_data();
+    for (unsigned int bin = 0; bin < m_nbins; bin++)
+        for (unsigned int c = 0; c < 6; c++)
+            data[bin * 6 + c] = double(h_bins.data[(2 + c) * m_nbins + bin]);
+    return result;
+    }
+
+namespace detail
+    {
+void export_ComputeThermoSpatial(pybind11::module& m)
+    {
+    pybind11::class_<ComputeThermoSpatial, Compute, std::shared_ptr<ComputeThermoSpatial>>(
+        m,
+        "ComputeThermoSpatial")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<ParticleGroup>,
+                            unsigned int,
+                            unsigned int,
+                            unsigned int>())
+        .def_property_readonly("grid", &ComputeThermoSpatial::getGrid)
+        .def_property_readonly("density_profile", &ComputeThermoSpatial::getDensityProfile)
+        .def_property_readonly("kinetic_energy_profile",
+                               &ComputeThermoSpatial::getKineticEnergyProfile)
+        .def_property_readonly("virial_profile", &ComputeThermoSpatial::getVirialProfile);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,108 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/Compute.h"
+#include "hoomd/GPUArray.h"
+#include "hoomd/ParticleGroup.h"
+
+#include <limits>
+#include <memory>
+
+/*! \file ComputeThermoSpatial.h
+    \brief Declares a class for computing spatially binned thermodynamic quantities
+*/
+
+#ifdef NVCC
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#ifndef __COMPUTE_THERMO_SPATIAL_H__
+#define __COMPUTE_THERMO_SPATIAL_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Computes spatially binned thermodynamic properties of a group of particles
+/*! ComputeThermoSpatial accumulates per-particle quantities into a regular grid of bins spanning
+    the global simulation box, producing local profiles of the particle count, the translational
+    kinetic energy, and the virial tensor components. The grid is defined in fractional
+    coordinates of the (possibly triclinic) global box, so bins track the box under NPT.
+
+    All bins are stored in a single flat array with the layout
+    [count][kinetic_energy][virial_xx][virial_xy][virial_xz][virial_yy][virial_yz][virial_zz],
+    each segment holding nx*ny*nz values with the bin index (ix*ny + iy)*nz + iz. Accumulating
+    into one array lets the CPU and GPU implementations share the MPI reduction and the
+    Python-facing getters.
+
+    The virial profile is only valid when the pressure tensor flag is active; it is returned as
+    NaN otherwise, matching ComputeThermo::getPressure().
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT ComputeThermoSpatial : public Compute
+    {
+    public:
+    //! Number of per-bin quantities stored in the flat bin array
+    static constexpr unsigned int num_quantities = 8;
+
+    //! Constructs the compute
+    ComputeThermoSpatial(std::shared_ptr<SystemDefinition> sysdef,
+                         std::shared_ptr<ParticleGroup> group,
+                         unsigned int nx,
+                         unsigned int ny,
+                         unsigned int nz);
+
+    //! Destructor
+    virtual ~ComputeThermoSpatial();
+
+    //! Compute the profiles
+    virtual void compute(uint64_t timestep);
+
+    //! Returns the grid dimensions
+    pybind11::tuple getGrid()
+        {
+        return pybind11::make_tuple(m_nx, m_ny, m_nz);
+        }
+
+    //! Returns the number density profile last computed by compute()
+    pybind11::array_t<double> getDensityProfile();
+
+    //! Returns the translational kinetic energy profile last computed by compute()
+    pybind11::array_t<double> getKineticEnergyProfile();
+
+    //! Returns the virial tensor profile last computed by compute()
+    /*! \returns An (nbins, 6) array of the virial components, or NaN if the pressure tensor
+        flag is inactive
+     */
+    pybind11::array_t<double> getVirialProfile();
+
+    protected:
+    std::shared_ptr<ParticleGroup> m_group; //!< Group to compute properties for
+    unsigned int m_nx;                      //!< Number of bins along x
+    unsigned int m_ny;                      //!< Number of bins along y
+    unsigned int m_nz;                      //!< Number of bins along z
+    unsigned int m_nbins;                   //!< Total number of bins
+    GPUArray<Scalar> m_bins;                //!< Flat per-bin accumulators
+
+    //! Does the actual computation
+    virtual void computeProperties();
+
+#ifdef ENABLE_MPI
+    bool m_properties_reduced; //!< True if properties have been reduced across MPI
+
+    //! Reduce properties over MPI
+    virtual void reduceProperties();
+#endif
+
+    //! Volume of a single bin
+    Scalar getBinVolume();
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
@@ -0,0 +1,124 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ComputeThermoSpatialGPU.cc
+    \brief Contains code for the ComputeThermoSpatialGPU class
+*/
+
+#include "ComputeThermoSpatialGPU.cuh"
+#include "ComputeThermoSpatialGPU.h"
+#include "hoomd/GPUPartition.cuh"
+
+#include <iostream>
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System for which to compute thermodynamic properties
+    \param group Subset of the system over which properties are calculated
+    \param nx Number of bins along x
+    \param ny Number of bins along y
+    \param nz Number of bins along z
+*/
+ComputeThermoSpatialGPU::ComputeThermoSpatialGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                                 std::shared_ptr<ParticleGroup> group,
+                                                 unsigned int nx,
+                                                 unsigned int ny,
+                                                 unsigned int nz)
+    : ComputeThermoSpatial(sysdef, group, nx, ny, nz)
+    {
+    if (!m_exec_conf->isCUDAEnabled())
+        {
+        m_exec_conf->msg->error()
+            << "Creating a ComputeThermoSpatialGPU with no GPU in the execution configuration"
+            << endl;
+        throw std::runtime_error("Error initializing ComputeThermoSpatialGPU");
+        }
+
+    m_block_size = 256;
+    }
+
+ComputeThermoSpatialGPU::~ComputeThermoSpatialGPU() { }
+
+/*! Bins all per-particle quantities of the group in one pass, on the GPU.
+ */
+void ComputeThermoSpatialGPU::computeProperties()
+    {
+    unsigned int group_size = m_group->getNumMembers();
+
+    assert(m_pdata);
+
+    // access the particle data
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
+                               access_location::device,
+                               access_mode::read);
+    const GlobalArray<Scalar>& net_virial = m_pdata->getNetVirial();
+    ArrayHandle<Scalar> d_net_virial(net_virial, access_location::device, access_mode::read);
+
+    BoxDim box = m_pdata->getGlobalBox();
+
+    PDataFlags flags = m_pdata->getFlags();
+
+    ArrayHandle<Scalar> d_bins(m_bins, access_location::device, access_mode::overwrite);
+    hipMemset(d_bins.data, 0, sizeof(Scalar) * num_quantities * m_nbins);
+
+    // access the group
+    ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
+                                            access_location::device,
+                                            access_mode::read);
+
+    m_exec_conf->beginMultiGPU();
+
+    // build up args list
+    kernel::compute_thermo_spatial_args args;
+    args.d_bins = d_bins.data;
+    args.nx = m_nx;
+    args.ny = m_ny;
+    args.nz = m_nz;
+    args.nbins = m_nbins;
+    args.d_net_virial = d_net_virial.data;
+    args.virial_pitch = net_virial.getPitch();
+    args.compute_virial = flags[pdata_flag::pressure_tensor];
+    args.block_size = m_block_size;
+
+    // perform the computation on the GPU(s)
+    gpu_compute_thermo_spatial(d_pos.data,
+                               d_vel.data,
+                               d_index_array.data,
+                               group_size,
+                               box,
+                               args,
+                               m_group->getGPUPartition());
+
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+
+    // converge GPUs
+    m_exec_conf->endMultiGPU();
+
+#ifdef ENABLE_MPI
+    // in MPI, reduce extensive quantities only when they're needed
+    m_properties_reduced = !m_pdata->getDomainDecomposition();
+#endif // ENABLE_MPI
+    }
+
+namespace detail
+    {
+void export_ComputeThermoSpatialGPU(pybind11::module& m)
+    {
+    pybind11::class_<ComputeThermoSpatialGPU,
+                     ComputeThermoSpatial,
+                     std::shared_ptr<ComputeThermoSpatialGPU>>(m, "ComputeThermoSpatialGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<ParticleGroup>,
+                            unsigned int,
+                            unsigned int,
+                            unsigned int>());
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
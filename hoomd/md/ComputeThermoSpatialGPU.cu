@@ -0,0 +1,141 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "ComputeThermoSpatialGPU.cuh"
+
+#include <hip/hip_runtime.h>
+
+#include <assert.h>
+
+/*! \file ComputeThermoSpatialGPU.cu
+    \brief Defines GPU kernel code for computing spatially binned thermodynamic properties
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Accumulates per-particle quantities into the spatial bins
+/*! \param d_bins Flat per-bin accumulators
+    \param box Global simulation box the bins span
+    \param d_net_virial Net virial / pe array to bin
+    \param virial_pitch Pitch of 2D net_virial array
+    \param d_pos Particle position array
+    \param d_vel Particle velocity array
+    \param d_group_members List of group members for which to bin properties
+    \param work_size Number of particles in the group this GPU processes
+    \param offset Offset of this GPU in the list of group members
+    \param nx Number of bins along x
+    \param ny Number of bins along y
+    \param nz Number of bins along z
+    \param nbins Total number of bins
+    \param compute_virial True if the virial components should be accumulated
+
+    One thread per group member: each thread locates its particle's bin from the fractional
+    coordinate in the global box and accumulates into the bin with atomicAdd. The bins are
+    cleared before launch, so the kernel only ever adds.
+*/
+__global__ void gpu_compute_thermo_spatial_bins(Scalar* d_bins,
+                                                BoxDim box,
+                                                Scalar* d_net_virial,
+                                                const size_t virial_pitch,
+                                                Scalar4* d_pos,
+                                                Scalar4* d_vel,
+                                                unsigned int* d_group_members,
+                                                unsigned int work_size,
+                                                unsigned int offset,
+                                                unsigned int nx,
+                                                unsigned int ny,
+                                                unsigned int nz,
+                                                unsigned int nbins,
+                                                bool compute_virial)
+    {
+    int group_idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (group_idx >= (int)work_size)
+        return;
+
+    unsigned int idx = d_group_members[group_idx + offset];
+
+    Scalar4 pos4 = d_pos[idx];
+    Scalar3 pos = make_scalar3(pos4.x, pos4.y, pos4.z);
+    Scalar3 f = box.makeFraction(pos);
+    int ix = min((int)(f.x * (Scalar)nx), (int)nx - 1);
+    int iy = min((int)(f.y * (Scalar)ny), (int)ny - 1);
+    int iz = min((int)(f.z * (Scalar)nz), (int)nz - 1);
+    ix = max(ix, 0);
+    iy = max(iy, 0);
+    iz = max(iz, 0);
+    unsigned int bin = ((unsigned int)ix * ny + (unsigned int)iy) * nz + (unsigned int)iz;
+
+    atomicAdd(&d_bins[bin], Scalar(1.0));
+
+    Scalar4 vel = d_vel[idx];
+    Scalar mass = vel.w;
+    Scalar vsq = vel.x * vel.x + vel.y * vel.y + vel.z * vel.z;
+    atomicAdd(&d_bins[nbins + bin], Scalar(0.5) * mass * vsq);
+
+    if (compute_virial)
+        {
+        for (unsigned int c = 0; c < 6; c++)
+            atomicAdd(&d_bins[(2 + c) * nbins + bin], d_net_virial[idx + c * virial_pitch]);
+        }
+    }
+
+/*! \param d_pos Particle position array
+    \param d_vel Particle velocity array
+    \param d_group_members List of group members
+    \param group_size Size of the group
+    \param box Global simulation box the bins span
+    \param args Additional arguments
+    \param gpu_partition Load balancing info for multi-GPU binning
+
+    This function drives gpu_compute_thermo_spatial_bins, see it for details.
+*/
+hipError_t gpu_compute_thermo_spatial(Scalar4* d_pos,
+                                      Scalar4* d_vel,
+                                      unsigned int* d_group_members,
+                                      unsigned int group_size,
+                                      const BoxDim& box,
+                                      const compute_thermo_spatial_args& args,
+                                      const GPUPartition& gpu_partition)
+    {
+    assert(d_pos);
+    assert(d_vel);
+    assert(d_group_members);
+    assert(args.d_bins);
+
+    // iterate over active GPUs in reverse, to end up on first GPU when returning from this function
+    for (int idev = gpu_partition.getNumActiveGPUs() - 1; idev >= 0; --idev)
+        {
+        auto range = gpu_partition.getRangeAndSetGPU(idev);
+
+        unsigned int nwork = range.second - range.first;
+
+        dim3 grid(nwork / args.block_size + 1, 1, 1);
+        dim3 threads(args.block_size, 1, 1);
+
+        gpu_compute_thermo_spatial_bins<<<grid, threads>>>(args.d_bins,
+                                                           box,
+                                                           args.d_net_virial,
+                                                           args.virial_pitch,
+                                                           d_pos,
+                                                           d_vel,
+                                                           d_group_members,
+                                                           nwork,
+                                                           range.first,
+                                                           args.nx,
+                                                           args.ny,
+                                                           args.nz,
+                                                           args.nbins,
+                                                           args.compute_virial);
+        }
+
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
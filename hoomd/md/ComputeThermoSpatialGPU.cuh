@@ -0,0 +1,51 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef _COMPUTE_THERMO_SPATIAL_GPU_CUH_
+#define _COMPUTE_THERMO_SPATIAL_GPU_CUH_
+
+#include <hip/hip_runtime.h>
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/GPUPartition.cuh"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/ParticleData.cuh"
+
+/*! \file ComputeThermoSpatialGPU.cuh
+    \brief Kernel driver function declarations for ComputeThermoSpatialGPU
+    */
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Holder for arguments to gpu_compute_thermo_spatial
+struct compute_thermo_spatial_args
+    {
+    Scalar* d_bins;          //!< Flat per-bin accumulators (count, KE, 6 virial components)
+    unsigned int nx;         //!< Number of bins along x
+    unsigned int ny;         //!< Number of bins along y
+    unsigned int nz;         //!< Number of bins along z
+    unsigned int nbins;      //!< Total number of bins (nx*ny*nz)
+    Scalar* d_net_virial;    //!< Net virial array to bin
+    size_t virial_pitch;     //!< Pitch of 2D net_virial array
+    bool compute_virial;     //!< True if the virial components should be accumulated
+    unsigned int block_size; //!< Block size to execute on the GPU
+    };
+
+//! Accumulates per-particle quantities of the group into the spatial bins
+hipError_t gpu_compute_thermo_spatial(Scalar4* d_pos,
+                                      Scalar4* d_vel,
+                                      unsigned int* d_group_members,
+                                      unsigned int group_size,
+                                      const BoxDim& box,
+                                      const compute_thermo_spatial_args& args,
+                                      const GPUPartition& gpu_partition);
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
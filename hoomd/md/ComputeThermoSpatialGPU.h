@@ -0,0 +1,48 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "ComputeThermoSpatial.h"
+
+/*! \file ComputeThermoSpatialGPU.h
+    \brief Declares a class for computing spatially binned thermodynamic quantities on the GPU
+*/
+
+#ifdef NVCC
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#ifndef __COMPUTE_THERMO_SPATIAL_GPU_H__
+#define __COMPUTE_THERMO_SPATIAL_GPU_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Computes spatially binned thermodynamic properties of a group of particles on the GPU
+/*! ComputeThermoSpatialGPU is a GPU accelerated implementation of ComputeThermoSpatial
+    \ingroup computes
+*/
+class PYBIND11_EXPORT ComputeThermoSpatialGPU : public ComputeThermoSpatial
+    {
+    public:
+    //! Constructs the compute
+    ComputeThermoSpatialGPU(std::shared_ptr<SystemDefinition> sysdef,
+                            std::shared_ptr<ParticleGroup> group,
+                            unsigned int nx,
+                            unsigned int ny,
+                            unsigned int nz);
+    virtual ~ComputeThermoSpatialGPU();
+
+    protected:
+    unsigned int m_block_size; //!< Block size executed
+
+    //! Does the actual computation
+    virtual void computeProperties();
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
@@ -102,6 +102,12 @@ class EvaluatorExternalPeriodic
         {
         return false;
         }
+
+    //! Number of bytes of the field that the evaluator reads
+    DEVICE static size_t getFieldBytes(const field_type& field)
+        {
+        return sizeof(field_type);
+        }
     //! Accept the optional charge value.
     /*! \param qi Charge of particle i
      */
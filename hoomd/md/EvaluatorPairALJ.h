@@ -474,6 +474,12 @@ template<unsigned int ndim> class EvaluatorPairALJ
         return false;
         }
 
+    /// Whether the potential implements the per-type torque mask
+    HOSTDEVICE static bool constexpr implementsTorqueMask()
+        {
+        return false;
+        }
+
     //! Accept the optional shape values
     /*! \param shape_i Shape of particle i
         \param shape_j Shape of particle j
@@ -500,6 +506,12 @@ template<unsigned int ndim> class EvaluatorPairALJ
     */
     HOSTDEVICE void setCharge(Scalar qi, Scalar qj) { }
 
+    //! Accept the optional torque mask
+    /*! \param mask_i True if the torque on particle i is needed
+        \param mask_j True if the torque on particle j is needed
+    */
+    HOSTDEVICE void setTorqueMask(bool mask_i, bool mask_j) { }
+
     //! Evaluate the force and energy.
     /*! \param force Output parameter to write the computed force.
         \param pair_eng Output parameter to write the computed pair energy.
@@ -0,0 +1,276 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __PAIR_EVALUATOR_DPD_COUPLED_H__
+#define __PAIR_EVALUATOR_DPD_COUPLED_H__
+
+#ifndef __HIPCC__
+#include <string>
+#endif
+
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/RNGIdentifiers.h"
+#include "hoomd/RandomNumbers.h"
+
+/*! \file EvaluatorPairDPDThermoCoupled.h
+    \brief Defines a template that couples any conservative pair evaluator to the DPD thermostat
+*/
+
+// need to declare these class methods with __device__ qualifiers when building in nvcc
+// DEVICE is __host__ __device__ when included in nvcc and blank when included into the host
+// compiler
+#ifdef __HIPCC__
+#define DEVICE __device__
+#define HOSTDEVICE __host__ __device__
+#else
+#define DEVICE
+#define HOSTDEVICE
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Class for evaluating the DPD thermostat with an arbitrary conservative pair potential
+/*! <b>General Overview</b>
+
+    EvaluatorPairDPDThermoCoupled fuses the DPD dissipative and random forces with the
+    conservative force of any standard pair evaluator in a single evaluation, so that the
+    thermostatted and conservative contributions share one neighbor list traversal and one force
+    write. Use it instead of attaching a separate PotentialPair over the same neighbor list.
+
+    The wrapped \a evaluator provides the conservative force and energy through its
+    evalForceAndEnergy method and its parameters through its param_type; the coupled parameter
+    dictionary is the conservative dictionary plus the ``gamma`` key. The dissipative and random
+    contributions use the standard DPD weight function \f$ w(r_{ij}) = 1 - r/r_{\mathrm{cut}} \f$
+    and match EvaluatorPairDPDThermoDPD (see that class and EvaluatorPairDPDThermoLJ for the
+    functional forms). The thermostat acts on every pair within the cutoff, including those for
+    which the conservative force is zero.
+*/
+template<class evaluator> class EvaluatorPairDPDThermoCoupled
+    {
+    public:
+    //! Define the parameter type used by this pair potential evaluator
+    struct param_type
+        {
+        typename evaluator::param_type conservative;
+        Scalar gamma;
+
+        DEVICE void load_shared(char*& ptr, unsigned int& available_bytes)
+            {
+            conservative.load_shared(ptr, available_bytes);
+            }
+
+        HOSTDEVICE void allocate_shared(char*& ptr, unsigned int& available_bytes) const
+            {
+            conservative.allocate_shared(ptr, available_bytes);
+            }
+
+#ifdef ENABLE_HIP
+        //! Set CUDA memory hints
+        void set_memory_hint() const
+            {
+            conservative.set_memory_hint();
+            }
+#endif
+
+#ifndef __HIPCC__
+        param_type() : gamma(0) { }
+
+        param_type(pybind11::dict v, bool managed = false) : conservative(v, managed)
+            {
+            gamma = v["gamma"].cast<Scalar>();
+            if (gamma == 0)
+                throw std::invalid_argument(
+                    "Cannot set gamma to 0, use the plain conservative potential instead.");
+            }
+
+        pybind11::dict asDict()
+            {
+            pybind11::dict v = conservative.asDict();
+            v["gamma"] = gamma;
+            return v;
+            }
+#endif
+        } __attribute__((aligned(16)));
+
+    //! Constructs the pair potential evaluator
+    /*! \param _rsq Squared distance between the particles
+        \param _rcutsq Squared distance at which the potential goes to 0
+        \param _params Per type pair parameters of this potential
+    */
+    DEVICE EvaluatorPairDPDThermoCoupled(Scalar _rsq, Scalar _rcutsq, const param_type& _params)
+        : cons(_rsq, _rcutsq, _params.conservative), rsq(_rsq), rcutsq(_rcutsq),
+          gamma(_params.gamma)
+        {
+        }
+
+    //! Set i and j, (particle tags), and the timestep
+    DEVICE void
+    set_seed_ij_timestep(uint16_t seed, unsigned int i, unsigned int j, uint64_t timestep)
+        {
+        m_seed = seed;
+        m_i = i;
+        m_j = j;
+        m_timestep = timestep;
+        }
+
+    //! Set the timestep size
+    DEVICE void setDeltaT(Scalar dt)
+        {
+        m_deltaT = dt;
+        }
+
+    //! Set the velocity term
+    DEVICE void setRDotV(Scalar dot)
+        {
+        m_dot = dot;
+        }
+
+    //! Set the temperature
+    DEVICE void setT(Scalar Temp)
+        {
+        m_T = Temp;
+        }
+
+    //! Charge use is determined by the conservative evaluator
+    DEVICE static bool needsCharge()
+        {
+        return evaluator::needsCharge();
+        }
+    //! Accept the optional charge values
+    /*! \param qi Charge of particle i
+        \param qj Charge of particle j
+    */
+    DEVICE void setCharge(Scalar qi, Scalar qj)
+        {
+        cons.setCharge(qi, qj);
+        }
+
+    //! Evaluate the force and energy using the conservative force only
+    /*! \param force_divr Output parameter to write the computed force divided by r.
+        \param pair_eng Output parameter to write the computed pair energy
+        \param energy_shift If true, the potential must be shifted so that V(r) is continuous at
+       the cutoff
+
+        \return True if they are evaluated or false if they are not because we are beyond the
+       cutoff
+    */
+    DEVICE bool evalForceAndEnergy(Scalar& force_divr, Scalar& pair_eng, bool energy_shift)
+        {
+        return cons.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
+        }
+
+    //! Evaluate the force and energy using the thermostat
+    /*! \param force_divr Output parameter to write the computed total force divided by r.
+        \param force_divr_cons Output parameter to write the computed conservative force divided
+       by r. \param pair_eng Output parameter to write the computed pair energy \param energy_shift
+       If true, the potential must be shifted so that V(r) is continuous at the cutoff
+
+        \note The conservative part \b only must be output to \a force_divr_cons so that the
+       virial may be computed correctly.
+
+        \return True if they are evaluated or false if they are not because we are beyond the
+       cutoff
+    */
+    DEVICE bool evalForceEnergyThermo(Scalar& force_divr,
+                                      Scalar& force_divr_cons,
+                                      Scalar& pair_eng,
+                                      bool energy_shift)
+        {
+        if (rsq < rcutsq)
+            {
+            Scalar rinv = fast::rsqrt(rsq);
+            Scalar rcutinv = fast::rsqrt(rcutsq);
+
+            // conservative contribution from the wrapped evaluator: the thermostat still acts
+            // on pairs for which the conservative force is zero
+            Scalar cons_divr = Scalar(0.0);
+            Scalar cons_eng = Scalar(0.0);
+            cons.evalForceAndEnergy(cons_divr, cons_eng, energy_shift);
+
+            unsigned int m_oi, m_oj;
+            // initialize the RNG
+            if (m_i > m_j)
+                {
+                m_oi = m_j;
+                m_oj = m_i;
+                }
+            else
+                {
+                m_oi = m_i;
+                m_oj = m_j;
+                }
+
+            hoomd::RandomGenerator rng(
+                hoomd::Seed(hoomd::RNGIdentifier::EvaluatorPairDPDThermo, m_timestep, m_seed),
+                hoomd::Counter(m_oi, m_oj));
+
+            // Generate a single random number
+            Scalar alpha = hoomd::UniformDistribution<Scalar>(-1, 1)(rng);
+
+            force_divr = cons_divr;
+            force_divr_cons = cons_divr;
+
+            //  Drag Term
+            force_divr -= gamma * m_dot * (rinv - rcutinv) * (rinv - rcutinv);
+
+            //  Random Force
+            force_divr
+                += fast::rsqrt(m_deltaT / (m_T * gamma * Scalar(6.0))) * (rinv - rcutinv) * alpha;
+
+            // conservative energy only
+            pair_eng = cons_eng;
+
+            return true;
+            }
+        else
+            return false;
+        }
+
+    DEVICE Scalar evalPressureLRCIntegral()
+        {
+        return 0;
+        }
+
+    DEVICE Scalar evalEnergyLRCIntegral()
+        {
+        return 0;
+        }
+
+#ifndef __HIPCC__
+    //! Get the name of this potential
+    /*! \returns The potential name.
+     */
+    static std::string getName()
+        {
+        return std::string("dpd_") + evaluator::getName();
+        }
+
+    std::string getShapeSpec() const
+        {
+        throw std::runtime_error("Shape definition not supported for this pair potential.");
+        }
+#endif
+
+    protected:
+    evaluator cons;      //!< Conservative evaluator for this pair
+    Scalar rsq;          //!< Stored rsq from the constructor
+    Scalar rcutsq;       //!< Stored rcutsq from the constructor
+    Scalar gamma;        //!< gamma parameter for potential extracted from params by constructor
+    uint16_t m_seed;     //!< User set seed for thermostat PRNG
+    unsigned int m_i;    //!< index of first particle (should it be tag?).  For use in PRNG
+    unsigned int m_j;    //!< index of second particle (should it be tag?). For use in PRNG
+    uint64_t m_timestep; //!< timestep for use in PRNG
+    Scalar m_T;          //!< Temperature for Themostat
+    Scalar m_dot;        //!< Velocity difference dotted with displacement vector
+    Scalar m_deltaT;     //!<  timestep size stored from constructor
+    };
+
+#undef DEVICE
+#undef HOSTDEVICE
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __PAIR_EVALUATOR_DPD_COUPLED_H__
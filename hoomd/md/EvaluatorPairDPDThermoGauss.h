@@ -0,0 +1,25 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __PAIR_EVALUATOR_DPDGAUSS_H__
+#define __PAIR_EVALUATOR_DPDGAUSS_H__
+
+#include "EvaluatorPairDPDThermoCoupled.h"
+#include "EvaluatorPairGauss.h"
+
+/*! \file EvaluatorPairDPDThermoGauss.h
+    \brief Defines the pair evaluator class for the DPD Thermostat with a Gaussian conservative
+   potential
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+//! DPD thermostat coupled to the Gaussian conservative potential (see EvaluatorPairGauss)
+typedef EvaluatorPairDPDThermoCoupled<EvaluatorPairGauss> EvaluatorPairDPDThermoGauss;
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __PAIR_EVALUATOR_DPDGAUSS_H__
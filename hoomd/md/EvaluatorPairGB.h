@@ -142,7 +142,7 @@ class EvaluatorPairGB
                                const Scalar _rcutsq,
                                const param_type& _params)
         : dr(_dr), rcutsq(_rcutsq), qi(_qi), qj(_qj), epsilon(_params.epsilon),
-          lperp(_params.lperp), lpar(_params.lpar)
+          lperp(_params.lperp), lpar(_params.lpar), compute_torque_i(true), compute_torque_j(true)
         {
         }
 
@@ -170,6 +170,12 @@ class EvaluatorPairGB
         return true;
         }
 
+    /// Whether the potential implements the per-type torque mask
+    HOSTDEVICE static bool constexpr implementsTorqueMask()
+        {
+        return true;
+        }
+
     //! Accept the optional shape values
     /*! \param shape_i Shape of particle i
         \param shape_j Shape of particle j
@@ -188,6 +194,16 @@ class EvaluatorPairGB
     */
     HOSTDEVICE void setCharge(Scalar qi, Scalar qj) { }
 
+    //! Accept the optional torque mask
+    /*! \param mask_i True if the torque on particle i is needed
+        \param mask_j True if the torque on particle j is needed
+    */
+    HOSTDEVICE void setTorqueMask(bool mask_i, bool mask_j)
+        {
+        compute_torque_i = mask_i;
+        compute_torque_j = mask_j;
+        }
+
     //! Evaluate the force and energy
     /*! \param force Output parameter to write the computed force.
         \param pair_eng Output parameter to write the computed pair energy.
@@ -270,11 +286,19 @@ class EvaluatorPairGB
         vec3<Scalar> f = -dUdr * unitr + fK + r2inv * dUdphi * unitr * dot(kappa, unitr);
         force = vec_to_scalar3(f);
 
-        vec3<Scalar> rca = Scalar(1.0 / 2.0)
-                           * (-dr - r * chi_fact * ((ca - chic * cb) * a3 - (cb - chic * ca) * b3));
-        vec3<Scalar> rcb = rca + dr;
-        torque_i = vec_to_scalar3(cross(rca, fK));
-        torque_j = -vec_to_scalar3(cross(rcb, fK));
+        // skip the torque arms when neither particle of the pair integrates rotational
+        // degrees of freedom, see setTorqueMask()
+        if (compute_torque_i || compute_torque_j)
+            {
+            vec3<Scalar> rca
+                = Scalar(1.0 / 2.0)
+                  * (-dr - r * chi_fact * ((ca - chic * cb) * a3 - (cb - chic * ca) * b3));
+            vec3<Scalar> rcb = rca + dr;
+            if (compute_torque_i)
+                torque_i = vec_to_scalar3(cross(rca, fK));
+            if (compute_torque_j)
+                torque_j = -vec_to_scalar3(cross(rcb, fK));
+            }
 
         return true;
         }
@@ -315,6 +339,8 @@ class EvaluatorPairGB
     Scalar epsilon;
     Scalar lperp;
     Scalar lpar;
+    bool compute_torque_i; //!< True if the torque on particle i is needed
+    bool compute_torque_j; //!< True if the torque on particle j is needed
     // const param_type &params;  //!< The pair potential parameters
     };
 
@@ -0,0 +1,25 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __PAIR_EVALUATOR_LJ_YUKAWA_H__
+#define __PAIR_EVALUATOR_LJ_YUKAWA_H__
+
+#include "EvaluatorPairLJ.h"
+#include "EvaluatorPairSum.h"
+#include "EvaluatorPairYukawa.h"
+
+/*! \file EvaluatorPairLJYukawa.h
+    \brief Defines the fused Lennard-Jones plus Yukawa pair evaluator
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Fused evaluator computing the sum of the LJ and Yukawa pair potentials in one pass
+using EvaluatorPairLJYukawa = EvaluatorPairSum<EvaluatorPairLJ, EvaluatorPairYukawa>;
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __PAIR_EVALUATOR_LJ_YUKAWA_H__
@@ -0,0 +1,187 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __PAIR_EVALUATOR_SUM_H__
+#define __PAIR_EVALUATOR_SUM_H__
+
+#ifndef __HIPCC__
+#include <string>
+#endif
+
+#include "hoomd/HOOMDMath.h"
+
+/*! \file EvaluatorPairSum.h
+    \brief Defines a pair evaluator that sums two component pair evaluators
+*/
+
+// need to declare these class methods with __device__ qualifiers when building in nvcc
+// DEVICE is __host__ __device__ when included in nvcc and blank when included into the host
+// compiler
+#ifdef __HIPCC__
+#define DEVICE __device__
+#define HOSTDEVICE __host__ __device__
+#else
+#define DEVICE
+#define HOSTDEVICE
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Class for evaluating the sum of two pair potentials
+/*! <b>General Overview</b>
+
+    See EvaluatorPairLJ
+
+    <b>Sum specifics</b>
+
+    EvaluatorPairSum evaluates the function:
+    \f[ V(r) = V_1(r) + V_2(r) \f]
+    where \f$ V_1 \f$ and \f$ V_2 \f$ are the potentials of the two component evaluators.
+
+    Stacking two PotentialPair instances on the same neighbor list traverses the list twice.
+    Fusing the evaluators computes both terms per neighbor in one traversal, sharing the
+    distance computation, cutoff test, and force accumulation between them.
+
+    Both components see the same r_cut(i,j) and energy shift mode. The two component evaluators
+    must be distinct types: the per-term parameter dictionaries are keyed by the component
+    potential names.
+*/
+template<class evaluator1, class evaluator2> class EvaluatorPairSum
+    {
+    public:
+    //! Define the parameter type used by this pair potential evaluator
+    struct param_type
+        {
+        typename evaluator1::param_type params1; //!< Parameters of the first component
+        typename evaluator2::param_type params2; //!< Parameters of the second component
+
+        DEVICE void load_shared(char*& ptr, unsigned int& available_bytes)
+            {
+            params1.load_shared(ptr, available_bytes);
+            params2.load_shared(ptr, available_bytes);
+            }
+
+        HOSTDEVICE void allocate_shared(char*& ptr, unsigned int& available_bytes) const
+            {
+            params1.allocate_shared(ptr, available_bytes);
+            params2.allocate_shared(ptr, available_bytes);
+            }
+
+#ifdef ENABLE_HIP
+        //! Set CUDA memory hints
+        void set_memory_hint() const
+            {
+            params1.set_memory_hint();
+            params2.set_memory_hint();
+            }
+#endif
+
+#ifndef __HIPCC__
+        param_type() : params1(), params2() { }
+
+        param_type(pybind11::dict v, bool managed = false)
+            : params1(v[evaluator1::getName().c_str()].cast<pybind11::dict>(), managed),
+              params2(v[evaluator2::getName().c_str()].cast<pybind11::dict>(), managed)
+            {
+            }
+
+        pybind11::dict asDict()
+            {
+            pybind11::dict v;
+            v[evaluator1::getName().c_str()] = params1.asDict();
+            v[evaluator2::getName().c_str()] = params2.asDict();
+            return v;
+            }
+#endif
+        };
+
+    //! Constructs the pair potential evaluator
+    /*! \param _rsq Squared distance between the particles
+        \param _rcutsq Squared distance at which the potential goes to 0
+        \param _params Per type pair parameters of this potential
+    */
+    DEVICE EvaluatorPairSum(Scalar _rsq, Scalar _rcutsq, const param_type& _params)
+        : eval1(_rsq, _rcutsq, _params.params1), eval2(_rsq, _rcutsq, _params.params2)
+        {
+        }
+
+    //! The sum uses charge when either component does
+    DEVICE static bool needsCharge()
+        {
+        return evaluator1::needsCharge() || evaluator2::needsCharge();
+        }
+    //! Accept the optional charge values.
+    /*! \param qi Charge of particle i
+        \param qj Charge of particle j
+    */
+    DEVICE void setCharge(Scalar qi, Scalar qj)
+        {
+        eval1.setCharge(qi, qj);
+        eval2.setCharge(qi, qj);
+        }
+
+    //! Evaluate the force and energy
+    /*! \param force_divr Output parameter to write the computed force divided by r.
+        \param pair_eng Output parameter to write the computed pair energy
+        \param energy_shift If true, the potential must be shifted so that
+        V(r) is continuous at the cutoff
+        \note There is no need to check if rsq < rcutsq in this method.
+        Cutoff tests are performed in PotentialPair.
+
+        \return True if they are evaluated or false if they are not because
+        we are beyond the cutoff
+    */
+    DEVICE bool evalForceAndEnergy(Scalar& force_divr, Scalar& pair_eng, bool energy_shift)
+        {
+        Scalar force_divr1 = Scalar(0.0);
+        Scalar pair_eng1 = Scalar(0.0);
+        bool evaluated1 = eval1.evalForceAndEnergy(force_divr1, pair_eng1, energy_shift);
+
+        Scalar force_divr2 = Scalar(0.0);
+        Scalar pair_eng2 = Scalar(0.0);
+        bool evaluated2 = eval2.evalForceAndEnergy(force_divr2, pair_eng2, energy_shift);
+
+        if (!evaluated1 && !evaluated2)
+            return false;
+
+        force_divr = force_divr1 + force_divr2;
+        pair_eng = pair_eng1 + pair_eng2;
+        return true;
+        }
+
+    DEVICE Scalar evalPressureLRCIntegral()
+        {
+        return eval1.evalPressureLRCIntegral() + eval2.evalPressureLRCIntegral();
+        }
+
+    DEVICE Scalar evalEnergyLRCIntegral()
+        {
+        return eval1.evalEnergyLRCIntegral() + eval2.evalEnergyLRCIntegral();
+        }
+
+#ifndef __HIPCC__
+    //! Get the name of this potential
+    /*! \returns The potential name.
+     */
+    static std::string getName()
+        {
+        return evaluator1::getName() + "_" + evaluator2::getName();
+        }
+
+    std::string getShapeSpec() const
+        {
+        throw std::runtime_error("Shape definition not supported for this pair potential.");
+        }
+#endif
+
+    protected:
+    evaluator1 eval1; //!< Evaluator for the first component potential
+    evaluator2 eval2; //!< Evaluator for the second component potential
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __PAIR_EVALUATOR_SUM_H__
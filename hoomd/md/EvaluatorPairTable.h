@@ -3,6 +3,7 @@
 
 #include "hoomd/ManagedArray.h"
 #include <memory>
+#include <vector>
 
 // need to declare these class methods with __device__ qualifiers when building in nvcc
 #ifdef __HIPCC__
@@ -44,9 +45,10 @@ class EvaluatorPairTable
     //! Define the parameter type used by this pair potential evaluator
     struct param_type
         {
-        Scalar rmin;                  //!< the distance of the first index of the table potential
-        ManagedArray<Scalar> V_table; //!< the tabulated energy
-        ManagedArray<Scalar> F_table; //!< the tabulated force specifically - (dV / dr)
+        Scalar rmin; //!< the distance of the first index of the table potential
+        //! the tabulated energy and force - (dV / dr), interleaved so that one interpolation
+        //! interval touches adjacent memory instead of four reads scattered over two arrays
+        ManagedArray<Scalar2> VF_table;
 
         //! Load dynamic data members into shared memory and increase pointer
         /*! \param ptr Pointer to load data to (will be incremented)
@@ -54,22 +56,19 @@ class EvaluatorPairTable
          */
         DEVICE void load_shared(char*& ptr, unsigned int& available_bytes)
             {
-            V_table.load_shared(ptr, available_bytes);
-            F_table.load_shared(ptr, available_bytes);
+            VF_table.load_shared(ptr, available_bytes);
             }
 
         HOSTDEVICE void allocate_shared(char*& ptr, unsigned int& available_bytes) const
             {
-            V_table.allocate_shared(ptr, available_bytes);
-            F_table.allocate_shared(ptr, available_bytes);
+            VF_table.allocate_shared(ptr, available_bytes);
             }
 
 #ifdef ENABLE_HIP
         //! Attach managed memory to CUDA stream
         void set_memory_hint() const
             {
-            V_table.set_memory_hint();
-            F_table.set_memory_hint();
+            VF_table.set_memory_hint();
             }
 #endif
 
@@ -93,16 +92,24 @@ class EvaluatorPairTable
 
             size_t width = V_py.size();
             rmin = v["r_min"].cast<Scalar>();
-            V_table = ManagedArray<Scalar>(static_cast<unsigned int>(width), managed);
-            F_table = ManagedArray<Scalar>(static_cast<unsigned int>(width), managed);
-            std::copy(V_py.data(0), V_py.data(0) + width, V_table.get());
-            std::copy(F_py.data(0), F_py.data(0) + width, F_table.get());
+            VF_table = ManagedArray<Scalar2>(static_cast<unsigned int>(width), managed);
+            for (size_t i = 0; i < width; i++)
+                {
+                VF_table.get()[i] = make_scalar2(V_py(i), F_py(i));
+                }
             }
 
         pybind11::dict asDict() const
             {
-            const auto V = pybind11::array_t<Scalar>(V_table.size(), V_table.get());
-            const auto F = pybind11::array_t<Scalar>(F_table.size(), F_table.get());
+            std::vector<Scalar> V_vec(VF_table.size());
+            std::vector<Scalar> F_vec(VF_table.size());
+            for (unsigned int i = 0; i < VF_table.size(); i++)
+                {
+                V_vec[i] = VF_table[i].x;
+                F_vec[i] = VF_table[i].y;
+                }
+            const auto V = pybind11::array_t<Scalar>(V_vec.size(), V_vec.data());
+            const auto F = pybind11::array_t<Scalar>(F_vec.size(), F_vec.data());
             auto params = pybind11::dict();
             params["U"] = V;
             params["F"] = F;
@@ -123,8 +130,7 @@ class EvaluatorPairTable
         \param _params Per type pair parameters of this potential
     */
     DEVICE EvaluatorPairTable(Scalar _rsq, Scalar _rcutsq, const param_type& _params)
-        : rsq(_rsq), rcutsq(_rcutsq), rmin(_params.rmin), V_table(_params.V_table),
-          F_table(_params.F_table)
+        : rsq(_rsq), rcutsq(_rcutsq), rmin(_params.rmin), VF_table(_params.VF_table)
         {
         }
 
@@ -151,7 +157,7 @@ class EvaluatorPairTable
     DEVICE bool
     evalForceAndEnergy(Scalar& force_divr, Scalar& pair_eng, const bool energy_shift) const
         {
-        unsigned int width = V_table.size();
+        unsigned int width = VF_table.size();
 
         const Scalar r = fast::sqrt(rsq);
         // compute the force divided by r in force_divr
@@ -167,22 +173,19 @@ class EvaluatorPairTable
         // compute index into the table and read in values
         unsigned int value_i = static_cast<unsigned int>(slow::floor(value_f));
         // unpack the data
-        const Scalar V0 = V_table[value_i];
-        const Scalar F0 = F_table[value_i];
-        Scalar V1 = 0;
-        Scalar F1 = 0;
+        const Scalar2 VF0 = VF_table[value_i];
+        Scalar2 VF1 = make_scalar2(0, 0);
         if (value_i + 1 < width)
             {
-            V1 = V_table[value_i + 1];
-            F1 = F_table[value_i + 1];
+            VF1 = VF_table[value_i + 1];
             }
 
         // compute the linear interpolation coefficient
         const Scalar f = value_f - Scalar(value_i);
 
         // interpolate to get V and F;
-        const Scalar V = V0 + f * (V1 - V0);
-        const Scalar F = F0 + f * (F1 - F0);
+        const Scalar V = VF0.x + f * (VF1.x - VF0.x);
+        const Scalar F = VF0.y + f * (VF1.y - VF0.y);
 
         // return the force divided by r
         if (rsq > Scalar(0.0))
@@ -221,10 +224,9 @@ class EvaluatorPairTable
     protected:
     Scalar rsq;                          //!< distance squared
     Scalar rcutsq;                       //!< the potential cuttoff distance squared
-    size_t width;                        //!< the distance between table indices
-    Scalar rmin;                         //!< the distance of the first index of the table potential
-    const ManagedArray<Scalar>& V_table; //!< the tabulated energy
-    const ManagedArray<Scalar>& F_table; //!< the tabulated force specifically - (dV / dr)
+    size_t width; //!< the distance between table indices
+    Scalar rmin;  //!< the distance of the first index of the table potential
+    const ManagedArray<Scalar2>& VF_table; //!< the interleaved tabulated energy and force
     };
 
     } // end namespace md
@@ -18,6 +18,8 @@
 #include "hoomd/HOOMDMath.h"
 #include "hoomd/VectorMath.h"
 
+#include <cstddef>
+
 #undef DEVICE
 #ifdef __HIPCC__
 #define DEVICE __device__
@@ -41,9 +43,12 @@ struct HOOMD_PYBIND11_EXPORT wall_type
     unsigned int numSpheres; // these data types come first, since the structs are aligned already
     unsigned int numCylinders;
     unsigned int numPlanes;
+    // planes come first in the layout because they are the most common wall type, which keeps
+    // the active extent of the struct (see EvaluatorWalls::getFieldBytes) small for plane-only
+    // systems
+    PlaneWall Planes[MAX_N_PWALLS];
     SphereWall Spheres[MAX_N_SWALLS];
     CylinderWall Cylinders[MAX_N_CWALLS];
-    PlaneWall Planes[MAX_N_PWALLS];
 
     wall_type() : numSpheres(0), numCylinders(0), numPlanes(0) { }
 
@@ -151,6 +156,22 @@ template<class evaluator> class EvaluatorWalls
         return false; // volume change dependence is not currently defined
         }
 
+    //! Number of bytes of the field that the evaluator reads
+    /*! The wall slots are filled from the front of each fixed-capacity array, so nothing past
+        the end of the last occupied slot is ever read. The GPU kernel stages only this many
+        bytes of the field into shared memory, so a single-plane system copies a few tens of
+        bytes instead of the full maximum-capacity struct.
+    */
+    DEVICE static size_t getFieldBytes(const field_type& field)
+        {
+        size_t bytes = offsetof(wall_type, Planes) + field.numPlanes * sizeof(PlaneWall);
+        if (field.numSpheres > 0)
+            bytes = offsetof(wall_type, Spheres) + field.numSpheres * sizeof(SphereWall);
+        if (field.numCylinders > 0)
+            bytes = offsetof(wall_type, Cylinders) + field.numCylinders * sizeof(CylinderWall);
+        return bytes;
+        }
+
     //! Accept the optional charge value
     /*! \param qi Charge of particle i
     Walls charge currently assigns a charge of 0 to the walls. It is however unused by implemented
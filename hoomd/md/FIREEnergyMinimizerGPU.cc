@@ -14,6 +14,9 @@ namespace hoomd
     {
 namespace md
     {
+//! Number of reduced scalars stored per integration method: pe, Pt, vsq, fsq, Pr, wsq, tsq
+static constexpr size_t s_sums_per_method = 7;
+
 /*! \param sysdef SystemDefinition this method will act on. Must not be NULL.
     \param group The group of particles this integration method is to work on
     \param dt Default step size
@@ -27,13 +30,8 @@ FIREEnergyMinimizerGPU::FIREEnergyMinimizerGPU(std::shared_ptr<SystemDefinition>
         throw std::runtime_error("FIREEnergyMinimizerGPU requires a GPU device.");
         }
 
-    // allocate the sum arrays
-    GPUArray<Scalar> sum(1, m_exec_conf);
-    m_sum.swap(sum);
-    GPUArray<Scalar> sum3(3, m_exec_conf);
-    m_sum3.swap(sum3);
-
-    // initialize the partial sum arrays
+    // initialize the sum arrays
+    m_sum_all = GPUVector<Scalar>(m_exec_conf);
     m_partial_sum1 = GPUVector<Scalar>(m_exec_conf);
     m_partial_sum2 = GPUVector<Scalar>(m_exec_conf);
     m_partial_sum3 = GPUVector<Scalar>(m_exec_conf);
@@ -64,6 +62,13 @@ void FIREEnergyMinimizerGPU::resizePartialSumArrays()
         m_partial_sum2.resize(num_blocks);
         m_partial_sum3.resize(num_blocks);
         }
+
+    // one slice of sums (pe, Pt, vsq, fsq, Pr, wsq, tsq) per integration method
+    const size_t n_sums = s_sums_per_method * m_methods.size();
+    if (n_sums != m_sum_all.size())
+        {
+        m_sum_all.resize(n_sums);
+        }
     }
 
 /*! \param timesteps is the iteration number
@@ -87,136 +92,84 @@ void FIREEnergyMinimizerGPU::update(uint64_t timestep)
     // update partial sum memory space if needed
     resizePartialSumArrays();
 
-    // compute the total energy on the GPU
-    // CPU version is Scalar energy = computePotentialEnergy(timesteps)/Scalar(group_size);
+    // Launch all reduction kernels (energy, translational, and rotational sums) for all methods,
+    // writing each method's results into its own slice of m_sum_all. The results are copied back
+    // to the host with a single synchronization below rather than one copy per quantity per
+    // method, which would serialize every iteration on the transfer latency.
     unsigned int total_group_size = 0;
 
-    for (auto method = m_methods.begin(); method != m_methods.end(); ++method)
         {
-        std::shared_ptr<ParticleGroup> current_group = (*method)->getGroup();
-
-        unsigned int group_size = current_group->getNumMembers();
-        total_group_size += group_size;
-
-        ArrayHandle<unsigned int> d_index_array(current_group->getIndexArray(),
-                                                access_location::device,
-                                                access_mode::read);
+        ArrayHandle<Scalar> d_sum_all(m_sum_all, access_location::device, access_mode::overwrite);
 
+        size_t cur_method = 0;
+        for (auto method = m_methods.begin(); method != m_methods.end(); ++method, ++cur_method)
             {
-            ArrayHandle<Scalar4> d_net_force(m_pdata->getNetForce(),
-                                             access_location::device,
-                                             access_mode::read);
-            ArrayHandle<Scalar> d_partial_sumE(m_partial_sum1,
-                                               access_location::device,
-                                               access_mode::overwrite);
-            ArrayHandle<Scalar> d_sumE(m_sum, access_location::device, access_mode::overwrite);
-
-            unsigned int num_blocks = group_size / m_block_size + 1;
-            kernel::gpu_fire_compute_sum_pe(d_index_array.data,
-                                            group_size,
-                                            d_net_force.data,
-                                            d_sumE.data,
-                                            d_partial_sumE.data,
-                                            m_block_size,
-                                            num_blocks);
-
-            if (m_exec_conf->isCUDAErrorCheckingEnabled())
-                CHECK_CUDA_ERROR();
-            }
-
-        ArrayHandle<Scalar> h_sumE(m_sum, access_location::host, access_mode::read);
-        energy += h_sumE.data[0];
-        }
-
-#ifdef ENABLE_MPI
-    if (m_pdata->getDomainDecomposition())
-        {
-        MPI_Allreduce(MPI_IN_PLACE,
-                      &energy,
-                      1,
-                      MPI_HOOMD_SCALAR,
-                      MPI_SUM,
-                      m_exec_conf->getMPICommunicator());
-        MPI_Allreduce(MPI_IN_PLACE,
-                      &total_group_size,
-                      1,
-                      MPI_INT,
-                      MPI_SUM,
-                      m_exec_conf->getMPICommunicator());
-        }
-#endif
-
-    m_energy_total = energy;
-    energy /= (Scalar)total_group_size;
-
-    if (m_was_reset)
-        {
-        m_was_reset = false;
-        m_old_energy = energy + Scalar(100000) * m_etol;
-        }
-
-    // sum P, vnorm, fnorm
+            std::shared_ptr<ParticleGroup> current_group = (*method)->getGroup();
 
-#ifdef ENABLE_MPI
-    bool aniso = false;
-#endif
+            unsigned int group_size = current_group->getNumMembers();
+            total_group_size += group_size;
 
-    for (auto method = m_methods.begin(); method != m_methods.end(); ++method)
-        {
-        std::shared_ptr<ParticleGroup> current_group = (*method)->getGroup();
+            ArrayHandle<unsigned int> d_index_array(current_group->getIndexArray(),
+                                                    access_location::device,
+                                                    access_mode::read);
 
-        unsigned int group_size = current_group->getNumMembers();
-        ArrayHandle<unsigned int> d_index_array(current_group->getIndexArray(),
-                                                access_location::device,
-                                                access_mode::read);
+            Scalar* d_sums = d_sum_all.data + s_sums_per_method * cur_method;
+            unsigned int num_blocks = group_size / m_block_size + 1;
 
-            {
-            ArrayHandle<Scalar> d_partial_sum_P(m_partial_sum1,
-                                                access_location::device,
-                                                access_mode::overwrite);
-            ArrayHandle<Scalar> d_partial_sum_vsq(m_partial_sum2,
-                                                  access_location::device,
-                                                  access_mode::overwrite);
-            ArrayHandle<Scalar> d_partial_sum_fsq(m_partial_sum3,
-                                                  access_location::device,
-                                                  access_mode::overwrite);
-            ArrayHandle<Scalar> d_sum(m_sum3, access_location::device, access_mode::overwrite);
-            ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
-                                       access_location::device,
-                                       access_mode::read);
-            ArrayHandle<Scalar3> d_accel(m_pdata->getAccelerations(),
-                                         access_location::device,
-                                         access_mode::read);
+                {
+                ArrayHandle<Scalar4> d_net_force(m_pdata->getNetForce(),
+                                                 access_location::device,
+                                                 access_mode::read);
+                ArrayHandle<Scalar> d_partial_sumE(m_partial_sum1,
+                                                   access_location::device,
+                                                   access_mode::overwrite);
 
-            unsigned int num_blocks = group_size / m_block_size + 1;
+                kernel::gpu_fire_compute_sum_pe(d_index_array.data,
+                                                group_size,
+                                                d_net_force.data,
+                                                d_sums,
+                                                d_partial_sumE.data,
+                                                m_block_size,
+                                                num_blocks);
 
-            kernel::gpu_fire_compute_sum_all(m_pdata->getN(),
-                                             d_vel.data,
-                                             d_accel.data,
-                                             d_index_array.data,
-                                             group_size,
-                                             d_sum.data,
-                                             d_partial_sum_P.data,
-                                             d_partial_sum_vsq.data,
-                                             d_partial_sum_fsq.data,
-                                             m_block_size,
-                                             num_blocks);
+                if (m_exec_conf->isCUDAErrorCheckingEnabled())
+                    CHECK_CUDA_ERROR();
+                }
 
-            if (m_exec_conf->isCUDAErrorCheckingEnabled())
-                CHECK_CUDA_ERROR();
-            }
+                {
+                ArrayHandle<Scalar> d_partial_sum_P(m_partial_sum1,
+                                                    access_location::device,
+                                                    access_mode::overwrite);
+                ArrayHandle<Scalar> d_partial_sum_vsq(m_partial_sum2,
+                                                      access_location::device,
+                                                      access_mode::overwrite);
+                ArrayHandle<Scalar> d_partial_sum_fsq(m_partial_sum3,
+                                                      access_location::device,
+                                                      access_mode::overwrite);
+                ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
+                                           access_location::device,
+                                           access_mode::read);
+                ArrayHandle<Scalar3> d_accel(m_pdata->getAccelerations(),
+                                             access_location::device,
+                                             access_mode::read);
 
-        ArrayHandle<Scalar> h_sum(m_sum3, access_location::host, access_mode::read);
-        Pt += h_sum.data[0];
-        vnorm += h_sum.data[1];
-        fnorm += h_sum.data[2];
+                kernel::gpu_fire_compute_sum_all(m_pdata->getN(),
+                                                 d_vel.data,
+                                                 d_accel.data,
+                                                 d_index_array.data,
+                                                 group_size,
+                                                 d_sums + 1,
+                                                 d_partial_sum_P.data,
+                                                 d_partial_sum_vsq.data,
+                                                 d_partial_sum_fsq.data,
+                                                 m_block_size,
+                                                 num_blocks);
 
-        if ((*method)->getAnisotropic())
-            {
-#ifdef ENABLE_MPI
-            aniso = true;
-#endif
+                if (m_exec_conf->isCUDAErrorCheckingEnabled())
+                    CHECK_CUDA_ERROR();
+                }
 
+            if ((*method)->getAnisotropic())
                 {
                 ArrayHandle<Scalar> d_partial_sum_Pr(m_partial_sum1,
                                                      access_location::device,
@@ -227,7 +180,6 @@ void FIREEnergyMinimizerGPU::update(uint64_t timestep)
                 ArrayHandle<Scalar> d_partial_sum_tsq(m_partial_sum3,
                                                       access_location::device,
                                                       access_mode::overwrite);
-                ArrayHandle<Scalar> d_sum(m_sum3, access_location::device, access_mode::overwrite);
                 ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
                                                    access_location::device,
                                                    access_mode::read);
@@ -241,8 +193,6 @@ void FIREEnergyMinimizerGPU::update(uint64_t timestep)
                                                access_location::device,
                                                access_mode::read);
 
-                unsigned int num_blocks = group_size / m_block_size + 1;
-
                 kernel::gpu_fire_compute_sum_all_angular(m_pdata->getN(),
                                                          d_orientation.data,
                                                          d_inertia.data,
@@ -250,7 +200,7 @@ void FIREEnergyMinimizerGPU::update(uint64_t timestep)
                                                          d_net_torque.data,
                                                          d_index_array.data,
                                                          group_size,
-                                                         d_sum.data,
+                                                         d_sums + 4,
                                                          d_partial_sum_Pr.data,
                                                          d_partial_sum_wnorm.data,
                                                          d_partial_sum_tsq.data,
@@ -260,59 +210,67 @@ void FIREEnergyMinimizerGPU::update(uint64_t timestep)
                 if (m_exec_conf->isCUDAErrorCheckingEnabled())
                     CHECK_CUDA_ERROR();
                 }
-            ArrayHandle<Scalar> h_sum(m_sum3, access_location::host, access_mode::read);
-            Pr += h_sum.data[0];
-            wnorm += h_sum.data[1];
-            tnorm += h_sum.data[2];
+            }
+        }
+
+        // read all of the sums back from the device in a single copy
+        {
+        ArrayHandle<Scalar> h_sum_all(m_sum_all, access_location::host, access_mode::read);
+
+        size_t cur_method = 0;
+        for (auto method = m_methods.begin(); method != m_methods.end(); ++method, ++cur_method)
+            {
+            const Scalar* sums = h_sum_all.data + s_sums_per_method * cur_method;
+            energy += sums[0];
+            Pt += sums[1];
+            vnorm += sums[2];
+            fnorm += sums[3];
+
+            if ((*method)->getAnisotropic())
+                {
+                Pr += sums[4];
+                wnorm += sums[5];
+                tnorm += sums[6];
+                }
             }
         }
 
 #ifdef ENABLE_MPI
     if (m_pdata->getDomainDecomposition())
         {
+        // combine all quantities into a single allreduce
+        Scalar sums[7] = {energy, Pt, vnorm, fnorm, Pr, wnorm, tnorm};
         MPI_Allreduce(MPI_IN_PLACE,
-                      &fnorm,
-                      1,
+                      sums,
+                      7,
                       MPI_HOOMD_SCALAR,
                       MPI_SUM,
                       m_exec_conf->getMPICommunicator());
         MPI_Allreduce(MPI_IN_PLACE,
-                      &vnorm,
-                      1,
-                      MPI_HOOMD_SCALAR,
-                      MPI_SUM,
-                      m_exec_conf->getMPICommunicator());
-        MPI_Allreduce(MPI_IN_PLACE,
-                      &Pt,
+                      &total_group_size,
                       1,
-                      MPI_HOOMD_SCALAR,
+                      MPI_INT,
                       MPI_SUM,
                       m_exec_conf->getMPICommunicator());
-
-        if (aniso)
-            {
-            MPI_Allreduce(MPI_IN_PLACE,
-                          &tnorm,
-                          1,
-                          MPI_HOOMD_SCALAR,
-                          MPI_SUM,
-                          m_exec_conf->getMPICommunicator());
-            MPI_Allreduce(MPI_IN_PLACE,
-                          &wnorm,
-                          1,
-                          MPI_HOOMD_SCALAR,
-                          MPI_SUM,
-                          m_exec_conf->getMPICommunicator());
-            MPI_Allreduce(MPI_IN_PLACE,
-                          &Pr,
-                          1,
-                          MPI_HOOMD_SCALAR,
-                          MPI_SUM,
-                          m_exec_conf->getMPICommunicator());
-            }
+        energy = sums[0];
+        Pt = sums[1];
+        vnorm = sums[2];
+        fnorm = sums[3];
+        Pr = sums[4];
+        wnorm = sums[5];
+        tnorm = sums[6];
         }
 #endif
 
+    m_energy_total = energy;
+    energy /= (Scalar)total_group_size;
+
+    if (m_was_reset)
+        {
+        m_was_reset = false;
+        m_old_energy = energy + Scalar(100000) * m_etol;
+        }
+
     vnorm = sqrt(vnorm);
     fnorm = sqrt(fnorm);
     wnorm = sqrt(wnorm);
@@ -26,6 +26,9 @@ ForceComposite::ForceComposite(std::shared_ptr<SystemDefinition> sysdef)
     m_pdata->getGlobalParticleNumberChangeSignal()
         .connect<ForceComposite, &ForceComposite::slotPtlsAddedRemoved>(this);
 
+    // rigid bodies consume orientations and moments of inertia
+    m_pdata->setAnisotropicDataInUse();
+
     m_exec_conf->msg->notice(7) << "ForceComposite initialize memory" << std::endl;
 
     GlobalArray<unsigned int> body_types(m_pdata->getNTypes(), 1, m_exec_conf);
@@ -269,6 +272,141 @@ Scalar ForceComposite::requestBodyGhostLayerWidth(unsigned int type, Scalar* h_r
     return m_d_max[type];
     }
 
+/*! Record the tag state covered by a completed full validation, for use by
+    tryIncrementalValidate().
+*/
+void ForceComposite::recordValidatedTagState()
+    {
+    m_n_validated_global = m_pdata->getNGlobal();
+    m_n_tag_removals_validated = m_pdata->getNTagRemovals();
+    m_validated_tags_contiguous = (m_pdata->getNGlobal() > 0
+                                   && m_pdata->getMaximumTag() + 1 == m_pdata->getNGlobal());
+    }
+
+/*! Validate only the particles added since the last full validation and append them to the
+    global molecule table.
+
+    \returns true when the incremental update was applied
+
+    Only pure insertions of fresh tags can be handled this way: the tags must have been
+    contiguous at the last full validation and no tag may have been removed or reassigned
+    since, because removal recycles tags and silently changes the identity of entries already
+    in the table. In that case the added particles occupy exactly the tag range
+    [m_n_validated_global, getNGlobal()) and validating them is O(additions) instead of
+    O(system), which keeps single-molecule deposition cheap in large systems. The
+    single-particle lookups used below are collective, so all ranks arrive at identical
+    results without taking a global snapshot or broadcasting the full table.
+*/
+bool ForceComposite::tryIncrementalValidate()
+    {
+    const unsigned int nglobal = m_pdata->getNGlobal();
+
+    if (!m_validated_tags_contiguous || m_pdata->getNTagRemovals() != m_n_tag_removals_validated
+        || nglobal <= m_n_validated_global || m_pdata->getMaximumTag() + 1 != nglobal)
+        {
+        return false;
+        }
+
+    const unsigned int start = m_n_validated_global;
+
+    ArrayHandle<unsigned int> h_body_len(m_body_len, access_location::host, access_mode::read);
+
+    std::vector<unsigned int> new_molecule_tag(nglobal - start, NO_MOLECULE);
+
+    // per added central particle: type and number of validated constituents
+    std::map<unsigned int, std::pair<unsigned int, unsigned int>> body_particle_count;
+
+    unsigned int nbodies_added = 0;
+    unsigned int n_free_added = 0;
+
+    for (unsigned int tag = start; tag < nglobal; ++tag)
+        {
+        unsigned int type = m_pdata->getType(tag);
+        unsigned int body = m_pdata->getBody(tag);
+        assert(type < m_pdata->getNTypes());
+
+        if (h_body_len.data[type] != 0)
+            {
+            if (body != tag)
+                {
+                throw std::runtime_error(
+                    "Error validating rigid bodies: Particles of types defining rigid bodies "
+                    "must have a body tag identical to their particle tag to be considered a "
+                    "central particle.");
+                }
+
+            body_particle_count.insert(std::make_pair(tag, std::make_pair(type, 0)));
+            new_molecule_tag[tag - start] = m_n_molecules_global + nbodies_added++;
+            }
+        else if (body < MIN_FLOPPY)
+            {
+            if (body < start)
+                {
+                // bodies covered by the last validation are complete, so a freshly added
+                // constituent can only make one of them too long
+                throw std::runtime_error(
+                    "Error validating rigid bodies: Too many constituent particles for "
+                    "rigid body.");
+                }
+
+            auto it = body_particle_count.find(body);
+            if (body >= nglobal || it == body_particle_count.end())
+                {
+                throw std::runtime_error(
+                    "Error validating rigid bodies: Central particle must have a lower "
+                    "tag than all constituent particles.");
+                }
+
+            if (it->second.second == h_body_len.data[it->second.first])
+                {
+                throw std::runtime_error(
+                    "Error validating rigid bodies: Too many constituent particles for "
+                    "rigid body.");
+                }
+            it->second.second++;
+            new_molecule_tag[tag - start] = new_molecule_tag[body - start];
+            }
+        else
+            {
+            n_free_added++;
+            }
+        }
+
+    for (auto it = body_particle_count.begin(); it != body_particle_count.end(); ++it)
+        {
+        const auto central_particle_tag = it->first;
+        const auto molecule_size = it->second.second;
+        if (molecule_size != h_body_len.data[it->second.first])
+            {
+            std::ostringstream error_msg;
+            error_msg << "Error validating rigid bodies: Incomplete rigid body with only "
+                      << molecule_size << " constituent particles "
+                      << "instead of " << h_body_len.data[it->second.first] << " for body "
+                      << central_particle_tag;
+            throw std::runtime_error(error_msg.str());
+            }
+        }
+
+    m_exec_conf->msg->notice(7) << "ForceComposite incremental validation of " << nglobal - start
+                                << " added particles, " << nbodies_added << " molecules"
+                                << std::endl;
+
+    // append the new entries to the global molecule table
+    m_molecule_tag.resize(nglobal);
+        {
+        ArrayHandle<unsigned int> h_molecule_tag(m_molecule_tag,
+                                                 access_location::host,
+                                                 access_mode::readwrite);
+        std::copy(new_molecule_tag.begin(), new_molecule_tag.end(), h_molecule_tag.data + start);
+        }
+
+    m_n_molecules_global += nbodies_added;
+    m_n_free_particles_global += n_free_added;
+    m_n_validated_global = nglobal;
+
+    return true;
+    }
+
 void ForceComposite::validateRigidBodies()
     {
     if (!(m_bodies_changed || m_particles_added_removed))
@@ -276,6 +414,14 @@ void ForceComposite::validateRigidBodies()
         return;
         }
 
+    // pure insertions of fresh tags against unchanged body definitions (e.g. deposition of a
+    // molecule) only need the added tag range validated
+    if (!m_bodies_changed && tryIncrementalValidate())
+        {
+        m_particles_added_removed = false;
+        return;
+        }
+
     // check validity of rigid body types: no nested rigid bodies
     unsigned int ntypes = m_pdata->getNTypes();
     assert(m_body_types.getPitch() >= ntypes);
@@ -427,6 +573,8 @@ void ForceComposite::validateRigidBodies()
     // store number of molecules in all ranks
     m_n_molecules_global = nbodies;
 
+    recordValidatedTagState();
+
     // reset flags
     m_bodies_changed = false;
     m_particles_added_removed = false;
@@ -616,6 +764,8 @@ void ForceComposite::createRigidBodies(
     m_n_molecules_global = n_central_particles;
     m_n_free_particles_global = n_free_particles;
 
+    recordValidatedTagState();
+
     m_bodies_changed = false;
     m_particles_added_removed = false;
     }
@@ -216,6 +216,15 @@ class PYBIND11_EXPORT ForceComposite : public MolecularForceCompute
     /// The number of free particles in the simulation box.
     unsigned int m_n_free_particles_global;
 
+    /// Global particle count covered by the last full validation
+    unsigned int m_n_validated_global = 0;
+
+    /// ParticleData tag removal counter at the last full validation
+    uint64_t m_n_tag_removals_validated = 0;
+
+    /// True when the tags were contiguous at the last full validation
+    bool m_validated_tags_contiguous = false;
+
     GlobalArray<unsigned int> m_body_types;  //!< Constituent particle types per type id (2D)
     GlobalArray<Scalar3> m_body_pos;         //!< Constituent particle offsets per type id (2D)
     GlobalArray<Scalar4> m_body_orientation; //!< Constituent particle orientations per type id (2D)
@@ -240,6 +249,12 @@ class PYBIND11_EXPORT ForceComposite : public MolecularForceCompute
     /// Return the requested minimum ghost layer width for a body's central particle.
     virtual Scalar requestBodyGhostLayerWidth(unsigned int type, Scalar* h_r_ghost);
 
+    //! Validate only the particles added since the last full validation
+    bool tryIncrementalValidate();
+
+    //! Record the tag state covered by a completed full validation
+    void recordValidatedTagState();
+
     //! Compute the forces and torques on the central particle
     virtual void computeForces(uint64_t timestep);
     };
@@ -19,21 +19,26 @@ namespace md
 ForceCompositeGPU::ForceCompositeGPU(std::shared_ptr<SystemDefinition> sysdef)
     : ForceComposite(sysdef)
     {
-    // Initialize autotuners.
+    // Initialize autotuners. The two reduction tuners are optional because only one of them
+    // runs, depending on whether the virial is requested.
     m_tuner_force.reset(new Autotuner<2>({AutotunerBase::makeBlockSizeRange(m_exec_conf),
                                           AutotunerBase::getTppListPow2(m_exec_conf)},
                                          m_exec_conf,
-                                         "force_composite"));
+                                         "force_composite",
+                                         5,
+                                         true));
 
-    m_tuner_virial.reset(new Autotuner<2>({AutotunerBase::makeBlockSizeRange(m_exec_conf),
-                                           AutotunerBase::getTppListPow2(m_exec_conf)},
-                                          m_exec_conf,
-                                          "virial_composite"));
+    m_tuner_force_virial.reset(new Autotuner<2>({AutotunerBase::makeBlockSizeRange(m_exec_conf),
+                                                 AutotunerBase::getTppListPow2(m_exec_conf)},
+                                                m_exec_conf,
+                                                "force_virial_composite",
+                                                5,
+                                                true));
 
     m_tuner_update.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
                                           m_exec_conf,
                                           "update_composite"));
-    m_autotuners.insert(m_autotuners.end(), {m_tuner_force, m_tuner_virial, m_tuner_update});
+    m_autotuners.insert(m_autotuners.end(), {m_tuner_force, m_tuner_force_virial, m_tuner_update});
 
     GlobalArray<uint2> flag(1, m_exec_conf);
     std::swap(m_flag, flag);
@@ -150,7 +155,7 @@ void ForceCompositeGPU::computeForces(uint64_t timestep)
         {
         ArrayHandle<uint2> d_flag(m_flag, access_location::device, access_mode::overwrite);
 
-        // reset force and torque
+        // reset force, torque and virial
         m_exec_conf->beginMultiGPU();
 
         for (int idev = m_exec_conf->getNumActiveGPUs() - 1; idev >= 0; idev--)
@@ -165,6 +170,16 @@ void ForceCompositeGPU::computeForces(uint64_t timestep)
             hipMemsetAsync(d_force.data + range.first, 0, sizeof(Scalar4) * nelem);
             hipMemsetAsync(d_torque.data + range.first, 0, sizeof(Scalar4) * nelem);
 
+            if (compute_virial)
+                {
+                for (unsigned int i = 0; i < 6; i++)
+                    {
+                    hipMemsetAsync(d_virial.data + i * m_virial_pitch + range.first,
+                                   0,
+                                   sizeof(Scalar) * nelem);
+                    }
+                }
+
             if (m_exec_conf->isCUDAErrorCheckingEnabled())
                 CHECK_CUDA_ERROR();
             }
@@ -172,37 +187,79 @@ void ForceCompositeGPU::computeForces(uint64_t timestep)
 
         m_exec_conf->beginMultiGPU();
 
-        m_tuner_force->begin();
-        auto param = m_tuner_force->getParam();
-        unsigned int block_size = param[0];
-        unsigned int n_bodies_per_block = param[1];
-
-        // launch GPU kernel
-        kernel::gpu_rigid_force(d_force.data,
-                                d_torque.data,
-                                d_molecule_length.data,
-                                d_molecule_list.data,
-                                d_molecule_idx.data,
-                                d_rigid_center.data,
-                                molecule_indexer,
-                                d_postype.data,
-                                d_orientation.data,
-                                m_body_idx,
-                                d_body_pos.data,
-                                d_body_orientation.data,
-                                d_body_len.data,
-                                d_body.data,
-                                d_tag.data,
-                                d_flag.data,
-                                d_net_force.data,
-                                d_net_torque.data,
-                                nmol,
-                                m_pdata->getN(),
-                                n_bodies_per_block,
-                                block_size,
-                                m_exec_conf->dev_prop,
-                                !compute_virial,
-                                m_gpu_partition);
+        if (compute_virial)
+            {
+            // sum forces, torques and virials onto the central particles in a single fused
+            // pass instead of launching separate force and virial reduction kernels
+            m_tuner_force_virial->begin();
+            auto param = m_tuner_force_virial->getParam();
+            unsigned int block_size = param[0];
+            unsigned int n_bodies_per_block = param[1];
+
+            // launch GPU kernel
+            kernel::gpu_rigid_force_virial(d_force.data,
+                                           d_torque.data,
+                                           d_virial.data,
+                                           d_molecule_length.data,
+                                           d_molecule_list.data,
+                                           d_molecule_idx.data,
+                                           d_rigid_center.data,
+                                           molecule_indexer,
+                                           d_postype.data,
+                                           d_orientation.data,
+                                           m_body_idx,
+                                           d_body_pos.data,
+                                           d_body_orientation.data,
+                                           d_body_len.data,
+                                           d_body.data,
+                                           d_tag.data,
+                                           d_flag.data,
+                                           d_net_force.data,
+                                           d_net_torque.data,
+                                           d_net_virial.data,
+                                           nmol,
+                                           m_pdata->getN(),
+                                           n_bodies_per_block,
+                                           m_pdata->getNetVirial().getPitch(),
+                                           m_virial_pitch,
+                                           block_size,
+                                           m_exec_conf->dev_prop,
+                                           m_gpu_partition);
+            }
+        else
+            {
+            m_tuner_force->begin();
+            auto param = m_tuner_force->getParam();
+            unsigned int block_size = param[0];
+            unsigned int n_bodies_per_block = param[1];
+
+            // launch GPU kernel
+            kernel::gpu_rigid_force(d_force.data,
+                                    d_torque.data,
+                                    d_molecule_length.data,
+                                    d_molecule_list.data,
+                                    d_molecule_idx.data,
+                                    d_rigid_center.data,
+                                    molecule_indexer,
+                                    d_postype.data,
+                                    d_orientation.data,
+                                    m_body_idx,
+                                    d_body_pos.data,
+                                    d_body_orientation.data,
+                                    d_body_len.data,
+                                    d_body.data,
+                                    d_tag.data,
+                                    d_flag.data,
+                                    d_net_force.data,
+                                    d_net_torque.data,
+                                    nmol,
+                                    m_pdata->getN(),
+                                    n_bodies_per_block,
+                                    block_size,
+                                    m_exec_conf->dev_prop,
+                                    true,
+                                    m_gpu_partition);
+            }
 
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
@@ -224,71 +281,10 @@ void ForceCompositeGPU::computeForces(uint64_t timestep)
         throw std::runtime_error(s.str());
         }
 
-    m_tuner_force->end();
-
     if (compute_virial)
-        {
-        // reset virial
-        m_exec_conf->beginMultiGPU();
-
-        for (int idev = m_exec_conf->getNumActiveGPUs() - 1; idev >= 0; idev--)
-            {
-            std::pair<unsigned int, unsigned int> range
-                = m_pdata->getGPUPartition().getRangeAndSetGPU(idev);
-            unsigned int nelem = range.second - range.first;
-
-            if (nelem == 0)
-                continue;
-
-            for (unsigned int i = 0; i < 6; i++)
-                {
-                hipMemsetAsync(d_virial.data + i * m_virial_pitch + range.first,
-                               0,
-                               sizeof(Scalar) * nelem);
-                }
-
-            if (m_exec_conf->isCUDAErrorCheckingEnabled())
-                CHECK_CUDA_ERROR();
-            }
-        m_exec_conf->endMultiGPU();
-
-        m_exec_conf->beginMultiGPU();
-        m_tuner_virial->begin();
-        auto param = m_tuner_virial->getParam();
-        unsigned int block_size = param[0];
-        unsigned int n_bodies_per_block = param[1];
-
-        // launch GPU kernel
-        kernel::gpu_rigid_virial(d_virial.data,
-                                 d_molecule_length.data,
-                                 d_molecule_list.data,
-                                 d_molecule_idx.data,
-                                 d_rigid_center.data,
-                                 molecule_indexer,
-                                 d_postype.data,
-                                 d_orientation.data,
-                                 m_body_idx,
-                                 d_body_pos.data,
-                                 d_body_orientation.data,
-                                 d_net_force.data,
-                                 d_net_virial.data,
-                                 d_body.data,
-                                 d_tag.data,
-                                 nmol,
-                                 m_pdata->getN(),
-                                 n_bodies_per_block,
-                                 m_pdata->getNetVirial().getPitch(),
-                                 m_virial_pitch,
-                                 block_size,
-                                 m_exec_conf->dev_prop,
-                                 m_gpu_partition);
-
-        if (m_exec_conf->isCUDAErrorCheckingEnabled())
-            CHECK_CUDA_ERROR();
-
-        m_tuner_virial->end();
-        m_exec_conf->endMultiGPU();
-        }
+        m_tuner_force_virial->end();
+    else
+        m_tuner_force->end();
     }
 
 void ForceCompositeGPU::updateCompositeParticles(uint64_t timestep)
@@ -252,30 +252,40 @@ __global__ void gpu_rigid_force_sliding_kernel(Scalar4* d_force,
         }
     }
 
-__global__ void gpu_rigid_virial_sliding_kernel(Scalar* d_virial,
-                                                const unsigned int* d_molecule_len,
-                                                const unsigned int* d_molecule_list,
-                                                const unsigned int* d_molecule_idx,
-                                                const unsigned int* d_rigid_center,
-                                                Index2D molecule_indexer,
-                                                const Scalar4* d_postype,
-                                                const Scalar4* d_orientation,
-                                                Index2D body_indexer,
-                                                Scalar3* d_body_pos,
-                                                Scalar4* d_body_orientation,
-                                                Scalar4* d_net_force,
-                                                Scalar* d_net_virial,
-                                                const unsigned int* d_body,
-                                                const unsigned int* d_tag,
-                                                unsigned int n_mol,
-                                                unsigned int N,
-                                                size_t net_virial_pitch,
-                                                size_t virial_pitch,
-                                                unsigned int window_size,
-                                                unsigned int thread_mask,
-                                                unsigned int n_bodies_per_block,
-                                                unsigned int first_body,
-                                                unsigned int nwork)
+//! Fused version of the force and virial sliding kernels
+/*! Sums constituent forces, torques and virials onto the central particle in a single pass
+    so that pressure runs launch one reduction kernel per step instead of two. The net
+    force, torque and virial on the constituents are read once and zeroed immediately.
+ */
+__global__ void gpu_rigid_force_virial_sliding_kernel(Scalar4* d_force,
+                                                      Scalar4* d_torque,
+                                                      Scalar* d_virial,
+                                                      const unsigned int* d_molecule_len,
+                                                      const unsigned int* d_molecule_list,
+                                                      const unsigned int* d_molecule_idx,
+                                                      const unsigned int* d_rigid_center,
+                                                      Index2D molecule_indexer,
+                                                      const Scalar4* d_postype,
+                                                      const Scalar4* d_orientation,
+                                                      Index2D body_indexer,
+                                                      Scalar3* d_body_pos,
+                                                      Scalar4* d_body_orientation,
+                                                      const unsigned int* d_body_len,
+                                                      const unsigned int* d_body,
+                                                      const unsigned int* d_tag,
+                                                      uint2* d_flag,
+                                                      Scalar4* d_net_force,
+                                                      Scalar4* d_net_torque,
+                                                      Scalar* d_net_virial,
+                                                      unsigned int n_mol,
+                                                      unsigned int N,
+                                                      size_t net_virial_pitch,
+                                                      size_t virial_pitch,
+                                                      unsigned int window_size,
+                                                      unsigned int thread_mask,
+                                                      unsigned int n_bodies_per_block,
+                                                      unsigned int first_body,
+                                                      unsigned int nwork)
     {
     extern __shared__ char sum[];
 
@@ -284,14 +294,15 @@ __global__ void gpu_rigid_virial_sliding_kernel(Scalar* d_virial,
     unsigned int m = threadIdx.x / (blockDim.x / n_bodies_per_block);
 
     // arrays in shared memory
-    Scalar4* body_orientation = (Scalar4*)sum; // n_bodies_per_block elements
-    Scalar* sum_virial = (Scalar*)(body_orientation + n_bodies_per_block); // 6*blockDim.x elements
+    Scalar4* body_force = (Scalar4*)sum;                 // blockDim.x elements
+    Scalar4* body_orientation = body_force + blockDim.x; // n_bodies_per_block elements
+    Scalar3* body_torque = (Scalar3*)(body_orientation + n_bodies_per_block); // blockDim.x elements
+    Scalar* sum_virial = (Scalar*)(body_torque + blockDim.x); // 6*blockDim.x elements
     unsigned int* body_type
         = (unsigned int*)(sum_virial + 6 * blockDim.x);       // n_bodies_per_block elements
     unsigned int* mol_idx = body_type + n_bodies_per_block;   // n_bodies_per_block elements
     unsigned int* central_idx = mol_idx + n_bodies_per_block; // n_bodies_per_block elements
 
-    // body_force and body_torque are each shared memory arrays with 1 element per threads
     Scalar* body_virial_xx = sum_virial;
     Scalar* body_virial_xy = &sum_virial[1 * blockDim.x];
     Scalar* body_virial_xz = &sum_virial[2 * blockDim.x];
@@ -299,7 +310,10 @@ __global__ void gpu_rigid_virial_sliding_kernel(Scalar* d_virial,
     Scalar* body_virial_yz = &sum_virial[4 * blockDim.x];
     Scalar* body_virial_zz = &sum_virial[5 * blockDim.x];
 
-    // each thread makes partial sums of the virial of all the particles that this thread loops over
+    // each thread makes partial sums of force, torque and virial of all the particles that
+    // this thread loops over
+    Scalar4 sum_force = make_scalar4(Scalar(0.0), Scalar(0.0), Scalar(0.0), Scalar(0.0));
+    Scalar3 sum_torque = make_scalar3(Scalar(0.0), Scalar(0.0), Scalar(0.0));
     Scalar sum_virial_xx(0.0);
     Scalar sum_virial_xy(0.0);
     Scalar sum_virial_xz(0.0);
@@ -307,9 +321,6 @@ __global__ void gpu_rigid_virial_sliding_kernel(Scalar* d_virial,
     Scalar sum_virial_yz(0.0);
     Scalar sum_virial_zz(0.0);
 
-    // thread_mask is a bitmask that masks out the high bits in threadIdx.x.
-    // threadIdx.x & thread_mask is an index from 0 to block_size/n_bodies_per_block-1 and
-    // determines what offset this thread is to use when accessing the particles in the body
     if ((threadIdx.x & thread_mask) == 0)
         {
         // thread 0 for this body reads in the body id and orientation and stores them in shared
@@ -323,7 +334,7 @@ __global__ void gpu_rigid_virial_sliding_kernel(Scalar* d_virial,
             if (d_tag[central_idx[m]] != d_body[central_idx[m]])
                 {
                 // this is not the central ptl, molecule is incomplete - mark as such
-                body_type[m] = NO_BODY;
+                body_type[m] = 0xffffffff;
                 body_orientation[m] = make_scalar4(1, 0, 0, 0);
                 }
             else
@@ -358,12 +369,14 @@ __global__ void gpu_rigid_virial_sliding_kernel(Scalar* d_virial,
                 // determine the particle idx of the particle
                 unsigned int pidx = d_molecule_list[molecule_indexer(k, mol_idx[m])];
 
-                if (body_type[m] < MIN_FLOPPY && pidx != central_idx[m])
+                // if this particle is not the central particle
+                if (body_type[m] != 0xffffffff && pidx != central_idx[m])
                     {
-                    // calculate body force and torques
                     Scalar4 fi = d_net_force[pidx];
 
-                    // sum up virial
+                    // will likely need to rotate these components too
+                    vec3<Scalar> ti(d_net_torque[pidx]);
+
                     Scalar virialxx = d_net_virial[0 * net_virial_pitch + pidx];
                     Scalar virialxy = d_net_virial[1 * net_virial_pitch + pidx];
                     Scalar virialxz = d_net_virial[2 * net_virial_pitch + pidx];
@@ -371,8 +384,10 @@ __global__ void gpu_rigid_virial_sliding_kernel(Scalar* d_virial,
                     Scalar virialyz = d_net_virial[4 * net_virial_pitch + pidx];
                     Scalar virialzz = d_net_virial[5 * net_virial_pitch + pidx];
 
-                    // zero force and virial on constituent particles
+                    // zero net force, energy, torque and virial on constituent ptls to avoid
+                    // double counting
                     d_net_force[pidx] = make_scalar4(0.0, 0.0, 0.0, 0.0);
+                    d_net_torque[pidx] = make_scalar4(0.0, 0.0, 0.0, 0.0);
 
                     d_net_virial[0 * net_virial_pitch + pidx] = Scalar(0.0);
                     d_net_virial[1 * net_virial_pitch + pidx] = Scalar(0.0);
@@ -381,13 +396,36 @@ __global__ void gpu_rigid_virial_sliding_kernel(Scalar* d_virial,
                     d_net_virial[4 * net_virial_pitch + pidx] = Scalar(0.0);
                     d_net_virial[5 * net_virial_pitch + pidx] = Scalar(0.0);
 
-                    // if this particle is not the central particle (incomplete molecules can't have
-                    // local members)
                     if (central_idx[m] < N)
                         {
+                        // at this point, the molecule needs to be complete
+                        if (mol_len != d_body_len[body_type[m]] + 1)
+                            {
+                            // incomplete molecule
+                            atomicMax(&(d_flag->x), d_body[central_idx[m]] + 1);
+                            }
+
+                        // calculate body force and torques
                         vec3<Scalar> particle_pos(d_body_pos[body_indexer(body_type[m], k - 1)]);
+
+                        // tally the force in the per thread counter
+                        sum_force.x += fi.x;
+                        sum_force.y += fi.y;
+                        sum_force.z += fi.z;
+
+                        // sum up energy
+                        sum_force.w += fi.w;
+
                         vec3<Scalar> ri = rotate(quat<Scalar>(body_orientation[m]), particle_pos);
 
+                        // torque = r x f
+                        vec3<Scalar> del_torque(cross(ri, vec3<Scalar>(fi)));
+
+                        // tally the torque in the per thread counter
+                        sum_torque.x += ti.x + del_torque.x;
+                        sum_torque.y += ti.y + del_torque.y;
+                        sum_torque.z += ti.z + del_torque.z;
+
                         // subtract intra-body virial prt
                         sum_virial_xx += virialxx - fi.x * ri.x;
                         sum_virial_xy += virialxy - fi.x * ri.y;
@@ -404,6 +442,8 @@ __global__ void gpu_rigid_virial_sliding_kernel(Scalar* d_virial,
     __syncthreads();
 
     // put the partial sums into shared memory
+    body_force[threadIdx.x] = sum_force;
+    body_torque[threadIdx.x] = sum_torque;
     body_virial_xx[threadIdx.x] = sum_virial_xx;
     body_virial_xy[threadIdx.x] = sum_virial_xy;
     body_virial_xz[threadIdx.x] = sum_virial_xz;
@@ -420,6 +460,15 @@ __global__ void gpu_rigid_virial_sliding_kernel(Scalar* d_virial,
         {
         if ((threadIdx.x & thread_mask) < offset)
             {
+            body_force[threadIdx.x].x += body_force[threadIdx.x + offset].x;
+            body_force[threadIdx.x].y += body_force[threadIdx.x + offset].y;
+            body_force[threadIdx.x].z += body_force[threadIdx.x + offset].z;
+            body_force[threadIdx.x].w += body_force[threadIdx.x + offset].w;
+
+            body_torque[threadIdx.x].x += body_torque[threadIdx.x + offset].x;
+            body_torque[threadIdx.x].y += body_torque[threadIdx.x + offset].y;
+            body_torque[threadIdx.x].z += body_torque[threadIdx.x + offset].z;
+
             body_virial_xx[threadIdx.x] += body_virial_xx[threadIdx.x + offset];
             body_virial_xy[threadIdx.x] += body_virial_xy[threadIdx.x + offset];
             body_virial_xz[threadIdx.x] += body_virial_xz[threadIdx.x + offset];
@@ -433,9 +482,15 @@ __global__ void gpu_rigid_virial_sliding_kernel(Scalar* d_virial,
         __syncthreads();
         }
 
-    // thread 0 within this body writes out the total virial for the body
+    // thread 0 within this body writes out the totals for the body
     if ((threadIdx.x & thread_mask) == 0 && mol_idx[m] < MIN_FLOPPY && central_idx[m] < N)
         {
+        d_force[central_idx[m]] = body_force[threadIdx.x];
+        d_torque[central_idx[m]] = make_scalar4(body_torque[threadIdx.x].x,
+                                                body_torque[threadIdx.x].y,
+                                                body_torque[threadIdx.x].z,
+                                                0.0f);
+
         d_virial[0 * virial_pitch + central_idx[m]] = body_virial_xx[threadIdx.x];
         d_virial[1 * virial_pitch + central_idx[m]] = body_virial_xy[threadIdx.x];
         d_virial[2 * virial_pitch + central_idx[m]] = body_virial_xz[threadIdx.x];
@@ -549,29 +604,36 @@ hipError_t gpu_rigid_force(Scalar4* d_force,
     return hipSuccess;
     }
 
-hipError_t gpu_rigid_virial(Scalar* d_virial,
-                            const unsigned int* d_molecule_len,
-                            const unsigned int* d_molecule_list,
-                            const unsigned int* d_molecule_idx,
-                            const unsigned int* d_rigid_center,
-                            Index2D molecule_indexer,
-                            const Scalar4* d_postype,
-                            const Scalar4* d_orientation,
-                            Index2D body_indexer,
-                            Scalar3* d_body_pos,
-                            Scalar4* d_body_orientation,
-                            Scalar4* d_net_force,
-                            Scalar* d_net_virial,
-                            const unsigned int* d_body,
-                            const unsigned int* d_tag,
-                            unsigned int n_mol,
-                            unsigned int N,
-                            unsigned int n_bodies_per_block,
-                            size_t net_virial_pitch,
-                            size_t virial_pitch,
-                            unsigned int block_size,
-                            const hipDeviceProp_t& dev_prop,
-                            const GPUPartition& gpu_partition)
+/*!
+ */
+hipError_t gpu_rigid_force_virial(Scalar4* d_force,
+                                  Scalar4* d_torque,
+                                  Scalar* d_virial,
+                                  const unsigned int* d_molecule_len,
+                                  const unsigned int* d_molecule_list,
+                                  const unsigned int* d_molecule_idx,
+                                  const unsigned int* d_rigid_center,
+                                  Index2D molecule_indexer,
+                                  const Scalar4* d_postype,
+                                  const Scalar4* d_orientation,
+                                  Index2D body_indexer,
+                                  Scalar3* d_body_pos,
+                                  Scalar4* d_body_orientation,
+                                  const unsigned int* d_body_len,
+                                  const unsigned int* d_body,
+                                  const unsigned int* d_tag,
+                                  uint2* d_flag,
+                                  Scalar4* d_net_force,
+                                  Scalar4* d_net_torque,
+                                  Scalar* d_net_virial,
+                                  unsigned int n_mol,
+                                  unsigned int N,
+                                  unsigned int n_bodies_per_block,
+                                  size_t net_virial_pitch,
+                                  size_t virial_pitch,
+                                  unsigned int block_size,
+                                  const hipDeviceProp_t& dev_prop,
+                                  const GPUPartition& gpu_partition)
     {
     for (int idev = gpu_partition.getNumActiveGPUs() - 1; idev >= 0; --idev)
         {
@@ -583,7 +645,7 @@ hipError_t gpu_rigid_virial(Scalar* d_virial,
 
         unsigned int max_block_size;
         hipFuncAttributes attr;
-        hipFuncGetAttributes(&attr, (const void*)gpu_rigid_virial_sliding_kernel);
+        hipFuncGetAttributes(&attr, (const void*)gpu_rigid_force_virial_sliding_kernel);
         max_block_size = attr.maxThreadsPerBlock;
 
         unsigned int run_block_size = max_block_size < block_size ? max_block_size : block_size;
@@ -599,26 +661,29 @@ hipError_t gpu_rigid_virial(Scalar* d_virial,
         unsigned int window_size = run_block_size / n_bodies_per_block;
         unsigned int thread_mask = window_size - 1;
 
-        size_t shared_bytes = 6 * run_block_size * sizeof(Scalar)
-                              + n_bodies_per_block * (sizeof(Scalar4) + 3 * sizeof(unsigned int));
+        size_t shared_bytes
+            = run_block_size * (sizeof(Scalar4) + sizeof(Scalar3) + 6 * sizeof(Scalar))
+              + n_bodies_per_block * (sizeof(Scalar4) + 3 * sizeof(unsigned int));
 
         while (shared_bytes + attr.sharedSizeBytes >= dev_prop.sharedMemPerBlock)
             {
             // block size is power of two
             run_block_size /= 2;
 
-            shared_bytes = 6 * run_block_size * sizeof(Scalar)
+            shared_bytes = run_block_size * (sizeof(Scalar4) + sizeof(Scalar3) + 6 * sizeof(Scalar))
                            + n_bodies_per_block * (sizeof(Scalar4) + 3 * sizeof(unsigned int));
 
             window_size = run_block_size / n_bodies_per_block;
             thread_mask = window_size - 1;
             }
 
-        hipLaunchKernelGGL((gpu_rigid_virial_sliding_kernel),
+        hipLaunchKernelGGL((gpu_rigid_force_virial_sliding_kernel),
                            dim3(force_grid),
                            dim3(run_block_size),
                            shared_bytes,
                            0,
+                           d_force,
+                           d_torque,
                            d_virial,
                            d_molecule_len,
                            d_molecule_list,
@@ -630,10 +695,13 @@ hipError_t gpu_rigid_virial(Scalar* d_virial,
                            body_indexer,
                            d_body_pos,
                            d_body_orientation,
-                           d_net_force,
-                           d_net_virial,
+                           d_body_len,
                            d_body,
                            d_tag,
+                           d_flag,
+                           d_net_force,
+                           d_net_torque,
+                           d_net_virial,
                            n_mol,
                            N,
                            net_virial_pitch,
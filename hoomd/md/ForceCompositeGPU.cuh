@@ -40,29 +40,34 @@ hipError_t gpu_rigid_force(Scalar4* d_force,
                            bool zero_force,
                            const GPUPartition& gpu_partition);
 
-hipError_t gpu_rigid_virial(Scalar* d_virial,
-                            const unsigned int* d_molecule_len,
-                            const unsigned int* d_molecule_list,
-                            const unsigned int* d_molecule_idx,
-                            const unsigned int* d_rigid_center,
-                            Index2D molecule_indexer,
-                            const Scalar4* d_postype,
-                            const Scalar4* d_orientation,
-                            Index2D body_indexer,
-                            Scalar3* d_body_pos,
-                            Scalar4* d_body_orientation,
-                            Scalar4* d_net_force,
-                            Scalar* d_net_virial,
-                            const unsigned int* d_body,
-                            const unsigned int* d_tag,
-                            unsigned int n_mol,
-                            unsigned int N,
-                            unsigned int n_bodies_per_block,
-                            size_t net_virial_pitch,
-                            size_t virial_pitch,
-                            unsigned int block_size,
-                            const hipDeviceProp_t& dev_prop,
-                            const GPUPartition& gpu_partition);
+hipError_t gpu_rigid_force_virial(Scalar4* d_force,
+                                  Scalar4* d_torque,
+                                  Scalar* d_virial,
+                                  const unsigned int* d_molecule_len,
+                                  const unsigned int* d_molecule_list,
+                                  const unsigned int* d_molecule_idx,
+                                  const unsigned int* d_rigid_center,
+                                  Index2D molecule_indexer,
+                                  const Scalar4* d_postype,
+                                  const Scalar4* d_orientation,
+                                  Index2D body_indexer,
+                                  Scalar3* d_body_pos,
+                                  Scalar4* d_body_orientation,
+                                  const unsigned int* d_body_len,
+                                  const unsigned int* d_body,
+                                  const unsigned int* d_tag,
+                                  uint2* d_flag,
+                                  Scalar4* d_net_force,
+                                  Scalar4* d_net_torque,
+                                  Scalar* d_net_virial,
+                                  unsigned int n_mol,
+                                  unsigned int N,
+                                  unsigned int n_bodies_per_block,
+                                  size_t net_virial_pitch,
+                                  size_t virial_pitch,
+                                  unsigned int block_size,
+                                  const hipDeviceProp_t& dev_prop,
+                                  const GPUPartition& gpu_partition);
 
 void gpu_update_composite(unsigned int N,
                           unsigned int n_ghost,
@@ -60,8 +60,8 @@ class PYBIND11_EXPORT ForceCompositeGPU : public ForceComposite
     /// Autotuner for block size and threads per body.
     std::shared_ptr<Autotuner<2>> m_tuner_force;
 
-    /// Autotuner for block size and threads per body.
-    std::shared_ptr<Autotuner<2>> m_tuner_virial;
+    /// Autotuner for block size and threads per body of the fused force/virial kernel.
+    std::shared_ptr<Autotuner<2>> m_tuner_force_virial;
 
     /// Autotuner for block size of update kernel.
     std::shared_ptr<Autotuner<1>> m_tuner_update;
@@ -166,16 +166,25 @@ void ForceDistanceConstraint::fillMatrixVector(uint64_t timestep)
                                     access_location::host,
                                     access_mode::read);
 
-    // access matrix elements
-    ArrayHandle<double> h_cmatrix(m_cmatrix, access_location::host, access_mode::overwrite);
+    // access vector elements
     ArrayHandle<double> h_cvec(m_cvec, access_location::host, access_mode::overwrite);
 
-    // clear matrix
-    memset(h_cmatrix.data, 0, sizeof(double) * m_cmatrix.size());
-
     const BoxDim& box = m_pdata->getBox();
 
     unsigned int max_local = m_pdata->getN() + m_pdata->getNGhosts();
+
+    // build the reverse lookup from local particle index to member constraints, so that
+    // matrix assembly only visits pairs of constraints sharing a particle (all other
+    // matrix elements are structurally zero)
+    if (m_ptl_constraints.size() < max_local)
+        {
+        m_ptl_constraints.resize(max_local);
+        }
+    for (unsigned int i = 0; i < max_local; ++i)
+        {
+        m_ptl_constraints[i].clear();
+        }
+
     for (unsigned int n = 0; n < n_constraint; ++n)
         {
         // lookup the tag of each of the particles participating in the constraint
@@ -197,6 +206,24 @@ void ForceDistanceConstraint::fillMatrixVector(uint64_t timestep)
             throw std::runtime_error("Error in constraint calculation");
             }
 
+        m_ptl_constraints[idx_a].push_back(n);
+        m_ptl_constraints[idx_b].push_back(n);
+        }
+
+    // collect the nonzero coefficients of this step, so that the dense matrix only needs
+    // to be scattered to when the sparsity pattern has to be rebuilt
+    m_coeffs.clear();
+
+    for (unsigned int n = 0; n < n_constraint; ++n)
+        {
+        // lookup the tag of each of the particles participating in the constraint
+        const ConstraintData::members_t constraint = m_cdata->getMembersByIndex(n);
+
+        // transform a and b into indices into the particle data arrays
+        // (MEM TRANSFER: 4 integers)
+        unsigned int idx_a = h_rtag.data[constraint.tag[0]];
+        unsigned int idx_b = h_rtag.data[constraint.tag[1]];
+
         vec3<Scalar> ra(h_pos.data[idx_a]);
         vec3<Scalar> rb(h_pos.data[idx_b]);
         vec3<Scalar> rn(ra - rb);
@@ -212,8 +239,8 @@ void ForceDistanceConstraint::fillMatrixVector(uint64_t timestep)
         vec3<Scalar> rndot(va - vb);
         vec3<Scalar> qn(rn + rndot * m_deltaT);
 
-        // fill matrix row
-        for (unsigned int m = 0; m < n_constraint; ++m)
+        // fill matrix row element for a constraint sharing a particle with constraint n
+        auto fill_element = [&](const unsigned int m)
             {
             // lookup the tag of each of the particles participating in the constraint
             const ConstraintData::members_t constraint_m = m_cdata->getMembersByIndex(m);
@@ -227,15 +254,6 @@ void ForceDistanceConstraint::fillMatrixVector(uint64_t timestep)
             assert(idx_m_a <= m_pdata->getN() + m_pdata->getNGhosts());
             assert(idx_m_b <= m_pdata->getN() + m_pdata->getNGhosts());
 
-            if (idx_m_a >= max_local || idx_m_b >= max_local)
-                {
-                this->m_exec_conf->msg->error()
-                    << "constrain.distance(): constraint " << constraint_m.tag[0] << " "
-                    << constraint_m.tag[1] << " incomplete." << std::endl
-                    << std::endl;
-                throw std::runtime_error("Error in constraint calculation");
-                }
-
             vec3<Scalar> rm_a(h_pos.data[idx_m_a]);
             vec3<Scalar> rm_b(h_pos.data[idx_m_b]);
             vec3<Scalar> rm(rm_a - rm_b);
@@ -261,7 +279,8 @@ void ForceDistanceConstraint::fillMatrixVector(uint64_t timestep)
                 delta += double(4.0) * dot(qn, rm) / mb;
                 }
 
-            h_cmatrix.data[m * n_constraint + n] += delta;
+            // store in column-major order (column m, row n)
+            m_coeffs.push_back(Eigen::Triplet<double>(n, m, delta));
 
             // update sparse matrix
             int k = m_sparse_idxlookup[m * n_constraint + n];
@@ -276,6 +295,24 @@ void ForceDistanceConstraint::fillMatrixVector(uint64_t timestep)
                 // update sparse matrix value directly
                 m_sparse.valuePtr()[k] = delta;
                 }
+            };
+
+        for (unsigned int m : m_ptl_constraints[idx_a])
+            {
+            fill_element(m);
+            }
+        for (unsigned int m : m_ptl_constraints[idx_b])
+            {
+            const ConstraintData::members_t constraint_m = m_cdata->getMembersByIndex(m);
+
+            // skip constraints already visited through particle a
+            if (h_rtag.data[constraint_m.tag[0]] == idx_a
+                || h_rtag.data[constraint_m.tag[1]] == idx_a)
+                {
+                continue;
+                }
+
+            fill_element(m);
             }
 
         // get constraint distance
@@ -294,6 +331,21 @@ void ForceDistanceConstraint::fillMatrixVector(uint64_t timestep)
                                 vec3<Scalar>(h_netforce.data[idx_a]) / ma
                                     - vec3<Scalar>(h_netforce.data[idx_b]) / mb);
         }
+
+    // when the sparsity pattern changed the solver rebuilds the sparse matrix from the
+    // dense one, so scatter the collected coefficients into it
+    if (m_condition.readFlags())
+        {
+        ArrayHandle<double> h_cmatrix(m_cmatrix, access_location::host, access_mode::overwrite);
+
+        // clear matrix
+        memset(h_cmatrix.data, 0, sizeof(double) * m_cmatrix.size());
+
+        for (const auto& coeff : m_coeffs)
+            {
+            h_cmatrix.data[coeff.col() * n_constraint + coeff.row()] += coeff.value();
+            }
+        }
     }
 
 void ForceDistanceConstraint::checkConstraints(uint64_t timestep)
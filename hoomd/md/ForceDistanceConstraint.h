@@ -93,6 +93,11 @@ class PYBIND11_EXPORT ForceDistanceConstraint : public MolecularForceCompute
     bool m_constraint_reorder;        //!< True if groups have changed
     bool m_constraints_added_removed; //!< True if global constraint topology has changed
 
+    std::vector<std::vector<unsigned int>>
+        m_ptl_constraints; //!< Reverse lookup from local particle index to member constraints
+    std::vector<Eigen::Triplet<double>>
+        m_coeffs; //!< Nonzero matrix coefficients of the current step
+
     Scalar m_d_max; //!< Maximum constraint extension
 
     //! Compute the forces
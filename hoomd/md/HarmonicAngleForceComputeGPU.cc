@@ -34,9 +34,16 @@ HarmonicAngleForceComputeGPU::HarmonicAngleForceComputeGPU(std::shared_ptr<Syste
                                    m_exec_conf,
                                    "harmonic_angle"));
     m_autotuners.push_back(m_tuner);
+
+    // bonded force kernels are tiny and independent of each other: give each compute its
+    // own blocking stream so they overlap instead of serializing on the default stream
+    hipStreamCreate(&m_stream);
     }
 
-HarmonicAngleForceComputeGPU::~HarmonicAngleForceComputeGPU() { }
+HarmonicAngleForceComputeGPU::~HarmonicAngleForceComputeGPU()
+    {
+    hipStreamDestroy(m_stream);
+    }
 
 /*! \param type Type of the angle to set parameters for
     \param K Stiffness parameter for the force computation
@@ -96,7 +103,9 @@ void HarmonicAngleForceComputeGPU::computeForces(uint64_t timestep)
                                               d_gpu_n_angles.data,
                                               d_params.data,
                                               m_angle_data->getNTypes(),
-                                              m_tuner->getParam()[0]);
+                                              m_tuner->getParam()[0],
+                                              m_exec_conf->getNumActiveGPUs() == 1 ? m_stream
+                                                                                   : 0);
 
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
@@ -234,7 +234,8 @@ hipError_t gpu_compute_harmonic_angle_forces(Scalar4* d_force,
                                              const unsigned int* n_angles_list,
                                              Scalar2* d_params,
                                              unsigned int n_angle_types,
-                                             int block_size)
+                                             int block_size,
+                                             hipStream_t stream)
     {
     assert(d_params);
 
@@ -254,7 +255,7 @@ hipError_t gpu_compute_harmonic_angle_forces(Scalar4* d_force,
                        dim3(grid),
                        dim3(threads),
                        0,
-                       0,
+                       stream,
                        d_force,
                        d_virial,
                        virial_pitch,
@@ -32,7 +32,8 @@ hipError_t gpu_compute_harmonic_angle_forces(Scalar4* d_force,
                                              const unsigned int* n_angles_list,
                                              Scalar2* d_params,
                                              unsigned int n_angle_types,
-                                             int block_size);
+                                             int block_size,
+                                             hipStream_t stream);
 
     } // end namespace kernel
     } // end namespace md
@@ -36,9 +36,15 @@ HarmonicDihedralForceComputeGPU::HarmonicDihedralForceComputeGPU(
                                    m_exec_conf,
                                    "harmonic_dihedral"));
     m_autotuners.push_back(m_tuner);
+
+    // launch on a private blocking stream so the bonded force kernels overlap
+    hipStreamCreate(&m_stream);
     }
 
-HarmonicDihedralForceComputeGPU::~HarmonicDihedralForceComputeGPU() { }
+HarmonicDihedralForceComputeGPU::~HarmonicDihedralForceComputeGPU()
+    {
+    hipStreamDestroy(m_stream);
+    }
 
 /*! \param type Type of the dihedral to set parameters for
     \param K Stiffness parameter for the force computation
@@ -105,7 +111,10 @@ void HarmonicDihedralForceComputeGPU::computeForces(uint64_t timestep)
                                                  d_params.data,
                                                  m_dihedral_data->getNTypes(),
                                                  this->m_tuner->getParam()[0],
-                                                 this->m_exec_conf->dev_prop.warpSize);
+                                                 this->m_exec_conf->dev_prop.warpSize,
+                                                 this->m_exec_conf->getNumActiveGPUs() == 1
+                                                     ? m_stream
+                                                     : 0);
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
     this->m_tuner->end();
@@ -45,6 +45,7 @@ class PYBIND11_EXPORT HarmonicDihedralForceComputeGPU : public HarmonicDihedralF
 
     protected:
     std::shared_ptr<Autotuner<1>> m_tuner; //!< Autotuner for block size
+    hipStream_t m_stream = 0; //!< Private launch stream so bonded kernels can overlap
     GPUArray<Scalar4> m_params;            //!< Parameters stored on the GPU (k,sign,m)
 
     //! Actually compute the forces
@@ -336,7 +336,8 @@ hipError_t gpu_compute_harmonic_dihedral_forces(Scalar4* d_force,
                                                 Scalar4* d_params,
                                                 unsigned int n_dihedral_types,
                                                 int block_size,
-                                                int warp_size)
+                                                int warp_size,
+                                                hipStream_t stream)
     {
     assert(d_params);
 
@@ -359,7 +360,7 @@ hipError_t gpu_compute_harmonic_dihedral_forces(Scalar4* d_force,
                        grid,
                        threads,
                        0,
-                       0,
+                       stream,
                        d_force,
                        d_virial,
                        virial_pitch,
@@ -34,7 +34,8 @@ hipError_t gpu_compute_harmonic_dihedral_forces(Scalar4* d_force,
                                                 Scalar4* d_params,
                                                 unsigned int n_dihedral_types,
                                                 int block_size,
-                                                int warp_size);
+                                                int warp_size,
+                                                hipStream_t stream);
 
     } // end namespace kernel
     } // end namespace md
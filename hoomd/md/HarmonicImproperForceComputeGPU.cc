@@ -35,9 +35,15 @@ HarmonicImproperForceComputeGPU::HarmonicImproperForceComputeGPU(
                                    m_exec_conf,
                                    "harmonic_improper"));
     m_autotuners.push_back(m_tuner);
+
+    // launch on a private blocking stream so the bonded force kernels overlap
+    hipStreamCreate(&m_stream);
     }
 
-HarmonicImproperForceComputeGPU::~HarmonicImproperForceComputeGPU() { }
+HarmonicImproperForceComputeGPU::~HarmonicImproperForceComputeGPU()
+    {
+    hipStreamDestroy(m_stream);
+    }
 
 /*! \param type Type of the improper to set parameters for
     \param K Stiffness parameter for the force computation.
@@ -97,7 +103,9 @@ void HarmonicImproperForceComputeGPU::computeForces(uint64_t timestep)
                                                  d_params.data,
                                                  m_improper_data->getNTypes(),
                                                  m_tuner->getParam()[0],
-                                                 m_exec_conf->dev_prop.warpSize);
+                                                 m_exec_conf->dev_prop.warpSize,
+                                                 m_exec_conf->getNumActiveGPUs() == 1 ? m_stream
+                                                                                      : 0);
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
     m_tuner->end();
@@ -48,6 +48,7 @@ class PYBIND11_EXPORT HarmonicImproperForceComputeGPU : public HarmonicImproperF
 
     protected:
     std::shared_ptr<Autotuner<1>> m_tuner; //!< Autotuner for block size
+    hipStream_t m_stream = 0; //!< Private launch stream so bonded kernels can overlap
     GPUArray<Scalar2> m_params;            //!< Parameters stored on the GPU (k,chi)
 
     //! Actually compute the forces
@@ -298,7 +298,8 @@ hipError_t gpu_compute_harmonic_improper_forces(Scalar4* d_force,
                                                 Scalar2* d_params,
                                                 unsigned int n_improper_types,
                                                 int block_size,
-                                                int warp_size)
+                                                int warp_size,
+                                                hipStream_t stream)
     {
     assert(d_params);
 
@@ -324,7 +325,7 @@ hipError_t gpu_compute_harmonic_improper_forces(Scalar4* d_force,
                        dim3(grid),
                        dim3(threads),
                        0,
-                       0,
+                       stream,
                        d_force,
                        d_virial,
                        virial_pitch,
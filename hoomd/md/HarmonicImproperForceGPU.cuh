@@ -33,7 +33,8 @@ hipError_t gpu_compute_harmonic_improper_forces(Scalar4* d_force,
                                                 Scalar2* d_params,
                                                 unsigned int n_improper_types,
                                                 int block_size,
-                                                int warp_size);
+                                                int warp_size,
+                                                hipStream_t stream);
 
     } // end namespace kernel
     } // end namespace md
@@ -0,0 +1,94 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "IntegratorRESPA.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+IntegratorRESPA::IntegratorRESPA(std::shared_ptr<SystemDefinition> sysdef,
+                                 Scalar deltaT,
+                                 unsigned int outer_interval)
+    : IntegratorTwoStep(sysdef, deltaT)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing IntegratorRESPA" << endl;
+
+    setOuterInterval(outer_interval);
+    }
+
+IntegratorRESPA::~IntegratorRESPA()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying IntegratorRESPA" << endl;
+    }
+
+/*! \param outer_interval Number of time steps between outer force evaluations
+ */
+void IntegratorRESPA::setOuterInterval(unsigned int outer_interval)
+    {
+    if (outer_interval == 0)
+        {
+        throw std::invalid_argument("outer_interval must be at least 1.");
+        }
+    m_outer_interval = outer_interval;
+
+    // apply the new interval to any outer forces already registered with m_forces
+    for (auto& force : m_registered_outer_forces)
+        force->setEvaluationInterval(m_outer_interval);
+    }
+
+/*! Registers the outer forces with the main force list so that they contribute to the net
+    force, and applies the evaluation interval to them. Forces removed from the outer list
+    since the previous run are unregistered and reset to per-step evaluation.
+*/
+void IntegratorRESPA::prepRun(uint64_t timestep)
+    {
+    // unregister the outer forces from the previous run
+    for (auto& force : m_registered_outer_forces)
+        {
+        force->setEvaluationInterval(1);
+        auto it = std::find(m_forces.begin(), m_forces.end(), force);
+        if (it != m_forces.end())
+            m_forces.erase(it);
+        }
+    m_registered_outer_forces.clear();
+
+    for (auto& force : m_outer_forces)
+        {
+        if (std::find(m_forces.begin(), m_forces.end(), force) != m_forces.end())
+            {
+            throw std::runtime_error(
+                "An outer force must not also be in the per-step force list.");
+            }
+        force->setEvaluationInterval(m_outer_interval);
+        m_forces.push_back(force);
+        m_registered_outer_forces.push_back(force);
+        }
+
+    IntegratorTwoStep::prepRun(timestep);
+    }
+
+namespace detail
+    {
+void export_IntegratorRESPA(pybind11::module& m)
+    {
+    pybind11::class_<IntegratorRESPA, IntegratorTwoStep, std::shared_ptr<IntegratorRESPA>>(
+        m,
+        "IntegratorRESPA")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar, unsigned int>())
+        .def_property_readonly("outer_forces",
+                               &IntegratorRESPA::getOuterForces,
+                               pybind11::return_value_policy::reference_internal)
+        .def_property("outer_interval",
+                      &IntegratorRESPA::getOuterInterval,
+                      &IntegratorRESPA::setOuterInterval);
+    }
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
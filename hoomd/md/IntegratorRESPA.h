@@ -0,0 +1,77 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "IntegratorTwoStep.h"
+
+#pragma once
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+namespace md
+    {
+/// Two-step integrator with multiple time stepping for slowly varying forces
+/** IntegratorRESPA separates the force computes into two classes: the inner forces inherited
+    from IntegratorTwoStep (evaluated every time step) and a second list of outer forces that
+    are only evaluated every m_outer_interval time steps. On intermediate steps the outer
+    forces are held constant at their last evaluated values, which amortizes the cost of
+    expensive long-range computes (e.g. PPPM or large r_cut pair potentials) over many steps.
+
+    This is the constant-force extrapolation variant of multiple time stepping. Unlike impulse
+    r-RESPA, it requires no changes to the integration methods: the outer forces simply
+    contribute their cached values to the net force on every step.
+
+    \ingroup updaters
+*/
+class PYBIND11_EXPORT IntegratorRESPA : public IntegratorTwoStep
+    {
+    public:
+    /// Constructor
+    IntegratorRESPA(std::shared_ptr<SystemDefinition> sysdef,
+                    Scalar deltaT,
+                    unsigned int outer_interval);
+
+    /// Destructor
+    virtual ~IntegratorRESPA();
+
+    /// Get the list of outer force computes
+    std::vector<std::shared_ptr<ForceCompute>>& getOuterForces()
+        {
+        return m_outer_forces;
+        }
+
+    /// Set the number of time steps between outer force evaluations
+    void setOuterInterval(unsigned int outer_interval);
+
+    /// Get the number of time steps between outer force evaluations
+    unsigned int getOuterInterval() const
+        {
+        return m_outer_interval;
+        }
+
+    /// Prepare for the run
+    virtual void prepRun(uint64_t timestep);
+
+    protected:
+    /// Force computes evaluated every m_outer_interval time steps
+    std::vector<std::shared_ptr<ForceCompute>> m_outer_forces;
+
+    /// Outer forces registered with m_forces during the previous prepRun()
+    std::vector<std::shared_ptr<ForceCompute>> m_registered_outer_forces;
+
+    /// Number of time steps between outer force evaluations
+    unsigned int m_outer_interval;
+    };
+
+namespace detail
+    {
+/// Exports the IntegratorRESPA class to python
+void export_IntegratorRESPA(pybind11::module& m);
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
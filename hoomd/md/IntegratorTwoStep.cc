@@ -3,6 +3,8 @@
 
 #include "IntegratorTwoStep.h"
 
+#include "PPPMForceCompute.h"
+
 #ifdef ENABLE_MPI
 #include "hoomd/Communicator.h"
 #endif
@@ -83,7 +85,21 @@ void IntegratorTwoStep::update(uint64_t timestep)
         // a) that particles have migrated to the correct domains
         // b) that forces are calculated correctly, if ghost atom positions are updated every time
         // step
-        m_comm->communicate(timestep + 1);
+        //
+        // When only a ghost position update is needed, overlap the non-blocking exchange
+        // with the forces that do not read ghost data, and complete it before the rest.
+        if (m_comm->startGhostUpdate(timestep + 1))
+            {
+            for (auto& force : m_forces)
+                {
+                if (!force->getRequestedCommFlags(timestep + 1).any())
+                    {
+                    force->compute(timestep + 1);
+                    }
+                }
+
+            m_comm->finishGhostUpdate(timestep + 1);
+            }
 
         // Communicator uses a compute callback to trigger updateRigidBodies again and ensure that
         // all ghost constituent particle positions are set in accordance with any just communicated
@@ -96,6 +112,34 @@ void IntegratorTwoStep::update(uint64_t timestep)
         updateRigidBodies(timestep + 1);
         }
 
+    // When requested, start the k-space solve of any PPPM force first and evaluate the
+    // remaining forces while the mesh kernels and FFTs execute on their private stream.
+    // The solve is joined in the force pass below, before integration.
+    if (m_pipeline_kspace)
+        {
+        bool started = false;
+        for (auto& force : m_forces)
+            {
+            auto pppm = std::dynamic_pointer_cast<PPPMForceCompute>(force);
+            if (pppm)
+                {
+                pppm->startKSpaceSolve(timestep + 1);
+                started = true;
+                }
+            }
+
+        if (started)
+            {
+            for (auto& force : m_forces)
+                {
+                if (!std::dynamic_pointer_cast<PPPMForceCompute>(force))
+                    {
+                    force->compute(timestep + 1);
+                    }
+                }
+            }
+        }
+
     // compute the net force on all particles
 #ifdef ENABLE_HIP
     if (m_exec_conf->isCUDAEnabled())
@@ -430,6 +474,9 @@ void export_IntegratorTwoStep(pybind11::module& m)
         .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>())
         .def_property_readonly("methods", &IntegratorTwoStep::getIntegrationMethods)
         .def_property("rigid", &IntegratorTwoStep::getRigid, &IntegratorTwoStep::setRigid)
+        .def_property("pipeline_kspace",
+                      &IntegratorTwoStep::getPipelineKSpace,
+                      &IntegratorTwoStep::setPipelineKSpace)
         .def_property("integrate_rotational_dof",
                       &IntegratorTwoStep::getIntegrateRotationalDOF,
                       &IntegratorTwoStep::setIntegrateRotationalDOF)
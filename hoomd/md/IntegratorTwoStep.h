@@ -110,6 +110,18 @@ class PYBIND11_EXPORT IntegratorTwoStep : public Integrator
         m_rigid_bodies = new_rigid;
         }
 
+    /// Set whether PPPM k-space solves are started ahead of the other force computes
+    void setPipelineKSpace(bool pipeline)
+        {
+        m_pipeline_kspace = pipeline;
+        }
+
+    /// Get whether PPPM k-space solves are started ahead of the other force computes
+    bool getPipelineKSpace() const
+        {
+        return m_pipeline_kspace;
+        }
+
     /// Validate method groups.
     void validateGroups();
 
@@ -124,6 +136,9 @@ class PYBIND11_EXPORT IntegratorTwoStep : public Integrator
 
     /// True when orientation degrees of freedom should be integrated
     bool m_integrate_rotational_dof = false;
+
+    /// True when PPPM k-space solves overlap the real space force pass
+    bool m_pipeline_kspace = false;
     };
 
     } // end namespace md
@@ -11,6 +11,7 @@
 #endif
 
 #include <map>
+#include <pybind11/stl.h>
 #include <string.h>
 
 /*! \file MolecularForceCompute.cc
@@ -433,7 +434,8 @@ void export_MolecularForceCompute(pybind11::module& m)
     pybind11::class_<MolecularForceCompute,
                      ForceConstraint,
                      std::shared_ptr<MolecularForceCompute>>(m, "MolecularForceCompute")
-        .def(pybind11::init<std::shared_ptr<SystemDefinition>>());
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>>())
+        .def("getMoleculeTags", &MolecularForceCompute::getMoleculeTagsPerParticleTag);
     }
 
     } // end namespace detail
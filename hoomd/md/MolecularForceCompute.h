@@ -120,6 +120,20 @@ class PYBIND11_EXPORT MolecularForceCompute : public ForceConstraint
         return m_n_molecules_global;
         }
 
+    //! Return the molecule ids keyed by particle tag
+    /*! Intended for coordination with the particle sorter, which can keep the members of a
+        molecule contiguous in index space. Particles outside any molecule report
+        NO_MOLECULE.
+    */
+    std::vector<unsigned int> getMoleculeTagsPerParticleTag()
+        {
+        ArrayHandle<unsigned int> h_molecule_tag(m_molecule_tag,
+                                                 access_location::host,
+                                                 access_mode::read);
+        return std::vector<unsigned int>(h_molecule_tag.data,
+                                         h_molecule_tag.data + m_molecule_tag.size());
+        }
+
     protected:
     GlobalVector<unsigned int> m_molecule_tag; //!< Molecule tag per particle tag
     unsigned int m_n_molecules_global;         //!< Global number of molecules
@@ -52,6 +52,12 @@ MuellerPlatheFlowGPU::MuellerPlatheFlowGPU(std::shared_ptr<SystemDefinition> sys
                                    5,
                                    true));
     m_autotuners.push_back(m_tuner);
+
+    GPUArray<Scalar3> extrema(2, m_exec_conf);
+    m_extrema.swap(extrema);
+
+    GPUArray<Scalar3> partial_extrema(2, m_exec_conf);
+    m_partial_extrema.swap(partial_extrema);
     }
 
 MuellerPlatheFlowGPU::~MuellerPlatheFlowGPU(void)
@@ -66,46 +72,73 @@ void MuellerPlatheFlowGPU::searchMinMaxVelocity(void)
         return;
     if (!this->hasMaxSlab() and !this->hasMinSlab())
         return;
-    const ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
-                                     access_location::device,
-                                     access_mode::read);
-    const ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
-                                     access_location::device,
-                                     access_mode::read);
-    const ArrayHandle<unsigned int> d_tag(m_pdata->getTags(),
-                                          access_location::device,
-                                          access_mode::read);
-    const ArrayHandle<unsigned int> d_rtag(m_pdata->getRTags(),
-                                           access_location::device,
-                                           access_mode::read);
-    const GlobalArray<unsigned int>& group_members = m_group->getIndexArray();
-    const ArrayHandle<unsigned int> d_group_members(group_members,
-                                                    access_location::device,
-                                                    access_mode::read);
 
     const BoxDim& gl_box = m_pdata->getGlobalBox();
 
     m_tuner->begin();
-    kernel::gpu_search_min_max_velocity(group_size,
-                                        d_vel.data,
-                                        d_pos.data,
-                                        d_tag.data,
-                                        d_rtag.data,
-                                        d_group_members.data,
-                                        gl_box,
-                                        this->getNSlabs(),
-                                        this->getMaxSlab(),
-                                        this->getMinSlab(),
-                                        &m_last_max_vel,
-                                        &m_last_min_vel,
-                                        this->hasMaxSlab(),
-                                        this->hasMinSlab(),
-                                        m_tuner->getParam()[0],
-                                        m_flow_direction,
-                                        m_slab_direction);
+    const unsigned int blocksize = m_tuner->getParam()[0];
+    const unsigned int num_blocks = group_size / blocksize + 1;
+
+    // reserve space for one max and one min candidate per block
+    if (2 * num_blocks > m_partial_extrema.getNumElements())
+        {
+        m_partial_extrema.resize(2 * num_blocks);
+        }
+
+        {
+        const ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
+                                         access_location::device,
+                                         access_mode::read);
+        const ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                         access_location::device,
+                                         access_mode::read);
+        const ArrayHandle<unsigned int> d_tag(m_pdata->getTags(),
+                                              access_location::device,
+                                              access_mode::read);
+        const GlobalArray<unsigned int>& group_members = m_group->getIndexArray();
+        const ArrayHandle<unsigned int> d_group_members(group_members,
+                                                        access_location::device,
+                                                        access_mode::read);
+        ArrayHandle<Scalar3> d_extrema(m_extrema,
+                                       access_location::device,
+                                       access_mode::overwrite);
+        ArrayHandle<Scalar3> d_partial_extrema(m_partial_extrema,
+                                               access_location::device,
+                                               access_mode::overwrite);
+
+        kernel::gpu_search_min_max_velocity(group_size,
+                                            d_vel.data,
+                                            d_pos.data,
+                                            d_tag.data,
+                                            d_group_members.data,
+                                            gl_box,
+                                            this->getNSlabs(),
+                                            this->getMaxSlab(),
+                                            this->getMinSlab(),
+                                            m_last_max_vel,
+                                            m_last_min_vel,
+                                            d_extrema.data,
+                                            d_partial_extrema.data,
+                                            num_blocks,
+                                            this->hasMaxSlab(),
+                                            this->hasMinSlab(),
+                                            blocksize,
+                                            m_flow_direction,
+                                            m_slab_direction);
+        }
     m_tuner->end();
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
+
+    // the winners come back to the host in one copy: the MPI exchange and the momentum tally
+    // in the base class read them there
+        {
+        const ArrayHandle<Scalar3> h_extrema(m_extrema,
+                                             access_location::host,
+                                             access_mode::read);
+        m_last_max_vel = h_extrema.data[0];
+        m_last_min_vel = h_extrema.data[1];
+        }
     }
 
 void MuellerPlatheFlowGPU::updateMinMaxVelocity(void)
@@ -2,183 +2,261 @@
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 #include "hip/hip_runtime.h"
-// Copyright (c) 2009-2021 The Regents of the University of Michigan
-// This file is part of the HOOMD-blue project, released under the BSD 3-Clause License.
 
 #include "MuellerPlatheFlowGPU.cuh"
-#include "MuellerPlatheFlowGPU.h"
 #include "hoomd/HOOMDMath.h"
 #include <assert.h>
 
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wconversion"
-#include <thrust/device_ptr.h>
-#include <thrust/functional.h>
-#include <thrust/transform_reduce.h>
-#pragma GCC diagnostic pop
-
 namespace hoomd
     {
 namespace md
     {
 namespace kernel
     {
-struct vel_search_un_opt : public thrust::unary_function<const unsigned int, Scalar3>
+//! Extract the momentum component driving the flow from a velocity element
+__device__ inline Scalar flow_momentum(const Scalar4& vel,
+                                       const flow_enum::Direction flow_direction)
+    {
+    Scalar v(0);
+    switch (flow_direction)
+        {
+    case flow_enum::X:
+        v = vel.x;
+        break;
+    case flow_enum::Y:
+        v = vel.y;
+        break;
+    case flow_enum::Z:
+        v = vel.z;
+        break;
+        }
+    return v * vel.w;
+    }
+
+//! Compute the slab a particle belongs to from its position
+__device__ inline unsigned int slab_index(const Scalar4& pos,
+                                          const BoxDim& gl_box,
+                                          const unsigned int Nslabs,
+                                          const flow_enum::Direction slab_direction)
     {
-    vel_search_un_opt(const Scalar4* const d_vel,
-                      const unsigned int* const d_tag,
-                      flow_enum::Direction flow_direction)
-        : m_vel(d_vel), m_tag(d_tag), m_flow_direction(flow_direction)
+    unsigned int index(0);
+    switch (slab_direction)
         {
+    case flow_enum::X:
+        index = (unsigned int)((pos.x / gl_box.getL().x + .5) * Nslabs);
+        break;
+    case flow_enum::Y:
+        index = (unsigned int)((pos.y / gl_box.getL().y + .5) * Nslabs);
+        break;
+    case flow_enum::Z:
+        index = (unsigned int)((pos.z / gl_box.getL().z + .5) * Nslabs);
+        break;
         }
-    const Scalar4* const m_vel;
-    const unsigned int* const m_tag;
-    const flow_enum::Direction m_flow_direction;
-    __host__ __device__ Scalar3 operator()(const unsigned int idx) const
+    return index % Nslabs;
+    }
+
+//! Search the min and max slab for extremal momentum candidates within each block
+/*! Each thread classifies one group member into its slab exactly once, from the particle's
+    own position, and keeps it as a candidate when it falls into the min or max slab. The
+    candidates then reduce in shared memory: the max slab keeps the largest momentum and the
+    min slab the smallest, both carried as (momentum, mass, tag) triplets. One candidate pair
+    per block is written out, the max candidates in the first \a num_blocks elements of
+    \a d_partial_extrema and the min candidates in the second.
+*/
+__global__ void gpu_mueller_plathe_partial_extrema_kernel(const Scalar4* const d_vel,
+                                                          const Scalar4* const d_pos,
+                                                          const unsigned int* const d_tag,
+                                                          const unsigned int* const d_group_members,
+                                                          const unsigned int group_size,
+                                                          const BoxDim gl_box,
+                                                          const unsigned int Nslabs,
+                                                          const unsigned int max_slab,
+                                                          const unsigned int min_slab,
+                                                          const Scalar3 init_max_vel,
+                                                          const Scalar3 init_min_vel,
+                                                          const bool has_max_slab,
+                                                          const bool has_min_slab,
+                                                          const flow_enum::Direction flow_direction,
+                                                          const flow_enum::Direction slab_direction,
+                                                          Scalar3* const d_partial_extrema,
+                                                          const unsigned int num_blocks)
+    {
+    HIP_DYNAMIC_SHARED(char, s_data)
+    Scalar3* max_sdata = (Scalar3*)&s_data[0];
+    Scalar3* min_sdata = max_sdata + blockDim.x;
+
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    Scalar3 my_max = init_max_vel;
+    Scalar3 my_min = init_min_vel;
+
+    if (idx < group_size)
         {
-        const unsigned int tag = m_tag[idx];
-        Scalar vel;
-        switch (m_flow_direction)
+        const unsigned int j = __ldg(d_group_members + idx);
+        const unsigned int index = slab_index(__ldg(d_pos + j), gl_box, Nslabs, slab_direction);
+
+        if ((has_max_slab && index == max_slab) || (has_min_slab && index == min_slab))
             {
-        case flow_enum::X:
-            vel = m_vel[idx].x;
-            break;
-        case flow_enum::Y:
-            vel = m_vel[idx].y;
-            break;
-        case flow_enum::Z:
-            vel = m_vel[idx].z;
-            break;
+            const Scalar4 vel = __ldg(d_vel + j);
+            Scalar3 candidate;
+            candidate.x = flow_momentum(vel, flow_direction);
+            candidate.y = vel.w;
+            candidate.z = __int_as_scalar(__ldg(d_tag + j));
+
+            if (has_max_slab && index == max_slab && candidate.x > my_max.x)
+                my_max = candidate;
+            if (has_min_slab && index == min_slab && candidate.x < my_min.x)
+                my_min = candidate;
             }
-        const Scalar mass = m_vel[idx].w;
-        vel *= mass;
-        Scalar3 result;
-        result.x = vel;
-        result.y = mass;
-        result.z = __int_as_scalar(tag);
-        return result;
         }
-    };
-template<typename CMP>
-struct vel_search_binary_opt : public thrust::binary_function<Scalar3, Scalar3, Scalar3>
-    {
-    vel_search_binary_opt(const unsigned int* const d_rtag,
-                          const Scalar4* const d_pos,
-                          const BoxDim gl_box,
-                          const unsigned int Nslabs,
-                          const unsigned int slab_index,
-                          const Scalar3 invalid,
-                          const flow_enum::Direction slab_direction)
-        : m_rtag(d_rtag), m_pos(d_pos), m_gl_box(gl_box), m_Nslabs(Nslabs),
-          m_slab_index(slab_index), m_invalid(invalid), m_slab_direction(slab_direction)
+
+    max_sdata[threadIdx.x] = my_max;
+    min_sdata[threadIdx.x] = my_min;
+    __syncthreads();
+
+    // reduce the candidates in parallel
+    int offs = blockDim.x >> 1;
+    while (offs > 0)
         {
+        if (threadIdx.x < offs)
+            {
+            if (max_sdata[threadIdx.x + offs].x > max_sdata[threadIdx.x].x)
+                max_sdata[threadIdx.x] = max_sdata[threadIdx.x + offs];
+            if (min_sdata[threadIdx.x + offs].x < min_sdata[threadIdx.x].x)
+                min_sdata[threadIdx.x] = min_sdata[threadIdx.x + offs];
+            }
+        offs >>= 1;
+        __syncthreads();
         }
-    const unsigned int* const m_rtag;
-    const Scalar4* const m_pos;
-    const BoxDim m_gl_box;
-    const unsigned int m_Nslabs;
-    const unsigned int m_slab_index;
-    const Scalar3 m_invalid;
-    const flow_enum::Direction m_slab_direction;
 
-    __host__ __device__ Scalar3 operator()(const Scalar3& a, const Scalar3& b) const
+    // write out our partial candidates
+    if (threadIdx.x == 0)
         {
-        Scalar3 result = m_invalid;
-        // Early exit, if invalid args involved.
-        if (a.z == m_invalid.z)
-            return b;
-        if (b.z == m_invalid.z)
-            return a;
+        d_partial_extrema[blockIdx.x] = max_sdata[0];
+        d_partial_extrema[num_blocks + blockIdx.x] = min_sdata[0];
+        }
+    }
 
-        const unsigned int idx_a = m_rtag[__scalar_as_int(a.z)];
-        const unsigned int idx_b = m_rtag[__scalar_as_int(b.z)];
+//! Completes the extremum search over all blocks
+/*! Only one block is run on the device. It reduces the per-block candidate pairs, writing
+    the max slab winner to d_extrema[0] and the min slab winner to d_extrema[1].
+*/
+__global__ void gpu_mueller_plathe_reduce_extrema_kernel(Scalar3* const d_extrema,
+                                                         const Scalar3* const d_partial_extrema,
+                                                         const unsigned int num_blocks,
+                                                         const Scalar3 init_max_vel,
+                                                         const Scalar3 init_min_vel)
+    {
+    HIP_DYNAMIC_SHARED(char, s_data)
+    Scalar3* max_sdata = (Scalar3*)&s_data[0];
+    Scalar3* min_sdata = max_sdata + blockDim.x;
 
-        unsigned int index_a, index_b;
-        switch (m_slab_direction)
-            {
-        case flow_enum::X:
-            index_a = (m_pos[idx_a].x / m_gl_box.getL().x + .5) * m_Nslabs;
-            index_b = (m_pos[idx_b].x / m_gl_box.getL().x + .5) * m_Nslabs;
-            break;
-        case flow_enum::Y:
-            index_a = (m_pos[idx_a].y / m_gl_box.getL().y + .5) * m_Nslabs;
-            index_b = (m_pos[idx_b].y / m_gl_box.getL().y + .5) * m_Nslabs;
-            break;
-        case flow_enum::Z:
-            index_a = (m_pos[idx_a].z / m_gl_box.getL().z + .5) * m_Nslabs;
-            index_b = (m_pos[idx_b].z / m_gl_box.getL().z + .5) * m_Nslabs;
-            break;
-            }
-        index_a %= m_Nslabs;
-        index_b %= m_Nslabs;
+    Scalar3 my_max = init_max_vel;
+    Scalar3 my_min = init_min_vel;
 
-        if (index_a == index_b)
+    // scan the partial candidates via a sliding window
+    for (unsigned int start = 0; start < num_blocks; start += blockDim.x)
+        {
+        if (start + threadIdx.x < num_blocks)
             {
-            if (index_a == m_slab_index)
-                {
-                CMP cmp;
-                if (cmp(a.x, b.x))
-                    result = a;
-                else
-                    result = b;
-                }
+            const Scalar3 cand_max = d_partial_extrema[start + threadIdx.x];
+            const Scalar3 cand_min = d_partial_extrema[num_blocks + start + threadIdx.x];
+            if (cand_max.x > my_max.x)
+                my_max = cand_max;
+            if (cand_min.x < my_min.x)
+                my_min = cand_min;
             }
-        else
+        }
+
+    max_sdata[threadIdx.x] = my_max;
+    min_sdata[threadIdx.x] = my_min;
+    __syncthreads();
+
+    int offs = blockDim.x >> 1;
+    while (offs > 0)
+        {
+        if (threadIdx.x < offs)
             {
-            if (index_a == m_slab_index)
-                result = a;
-            if (index_b == m_slab_index)
-                result = b;
+            if (max_sdata[threadIdx.x + offs].x > max_sdata[threadIdx.x].x)
+                max_sdata[threadIdx.x] = max_sdata[threadIdx.x + offs];
+            if (min_sdata[threadIdx.x + offs].x < min_sdata[threadIdx.x].x)
+                min_sdata[threadIdx.x] = min_sdata[threadIdx.x + offs];
             }
-        return result;
+        offs >>= 1;
+        __syncthreads();
         }
-    };
 
+    if (threadIdx.x == 0)
+        {
+        d_extrema[0] = max_sdata[0];
+        d_extrema[1] = min_sdata[0];
+        }
+    }
+
+/*! This is a driver for gpu_mueller_plathe_partial_extrema_kernel() and
+    gpu_mueller_plathe_reduce_extrema_kernel(), see them for details. Both slabs are searched
+    in a single pass over the group; the caller copies the two reduced candidates back once
+    per swap.
+*/
 hipError_t gpu_search_min_max_velocity(const unsigned int group_size,
                                        const Scalar4* const d_vel,
                                        const Scalar4* const d_pos,
                                        const unsigned int* const d_tag,
-                                       const unsigned int* const d_rtag,
                                        const unsigned int* const d_group_members,
                                        const BoxDim gl_box,
                                        const unsigned int Nslabs,
                                        const unsigned int max_slab,
                                        const unsigned int min_slab,
-                                       Scalar3* const last_max_vel,
-                                       Scalar3* const last_min_vel,
+                                       const Scalar3 init_max_vel,
+                                       const Scalar3 init_min_vel,
+                                       Scalar3* const d_extrema,
+                                       Scalar3* const d_partial_extrema,
+                                       const unsigned int num_blocks,
                                        const bool has_max_slab,
                                        const bool has_min_slab,
                                        const unsigned int blocksize,
                                        const flow_enum::Direction flow_direction,
                                        const flow_enum::Direction slab_direction)
     {
-    thrust::device_ptr<const unsigned int> member_ptr(d_group_members);
+    assert(num_blocks > 0);
 
-    vel_search_un_opt un_opt(d_vel, d_tag, flow_direction);
+    dim3 grid(num_blocks, 1, 1);
+    dim3 threads(blocksize, 1, 1);
 
-    if (has_max_slab)
-        {
-        vel_search_binary_opt<thrust::greater<const Scalar>>
-            max_bin_opt(d_rtag, d_pos, gl_box, Nslabs, max_slab, *last_max_vel, slab_direction);
-        Scalar3 init = *last_max_vel;
-        *last_max_vel = thrust::transform_reduce(member_ptr,
-                                                 member_ptr + group_size,
-                                                 un_opt,
-                                                 init,
-                                                 max_bin_opt);
-        }
+    hipLaunchKernelGGL((gpu_mueller_plathe_partial_extrema_kernel),
+                       grid,
+                       threads,
+                       2 * blocksize * sizeof(Scalar3),
+                       0,
+                       d_vel,
+                       d_pos,
+                       d_tag,
+                       d_group_members,
+                       group_size,
+                       gl_box,
+                       Nslabs,
+                       max_slab,
+                       min_slab,
+                       init_max_vel,
+                       init_min_vel,
+                       has_max_slab,
+                       has_min_slab,
+                       flow_direction,
+                       slab_direction,
+                       d_partial_extrema,
+                       num_blocks);
 
-    if (has_min_slab)
-        {
-        vel_search_binary_opt<thrust::less<const Scalar>>
-            min_bin_opt(d_rtag, d_pos, gl_box, Nslabs, min_slab, *last_min_vel, slab_direction);
-        Scalar3 init = *last_min_vel;
-        *last_min_vel = thrust::transform_reduce(member_ptr,
-                                                 member_ptr + group_size,
-                                                 un_opt,
-                                                 init,
-                                                 min_bin_opt);
-        }
+    const unsigned int final_block_size = 256;
+    hipLaunchKernelGGL((gpu_mueller_plathe_reduce_extrema_kernel),
+                       dim3(1, 1, 1),
+                       dim3(final_block_size, 1, 1),
+                       2 * final_block_size * sizeof(Scalar3),
+                       0,
+                       d_extrema,
+                       d_partial_extrema,
+                       num_blocks,
+                       init_max_vel,
+                       init_min_vel);
 
     return hipPeekAtLastError();
     }
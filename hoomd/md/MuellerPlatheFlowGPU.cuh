@@ -22,19 +22,21 @@ hipError_t gpu_search_min_max_velocity(const unsigned int group_size,
                                        const Scalar4* const d_vel,
                                        const Scalar4* const d_pos,
                                        const unsigned int* const d_tag,
-                                       const unsigned int* const d_rtag,
                                        const unsigned int* const d_group_members,
                                        const BoxDim gl_box,
                                        const unsigned int Nslabs,
                                        const unsigned int max_slab,
                                        const unsigned int min_slab,
-                                       Scalar3* const last_max_vel,
-                                       Scalar3* const last_min_vel,
+                                       const Scalar3 init_max_vel,
+                                       const Scalar3 init_min_vel,
+                                       Scalar3* const d_extrema,
+                                       Scalar3* const d_partial_extrema,
+                                       const unsigned int num_blocks,
                                        const bool has_max_slab,
                                        const bool has_min_slab,
                                        const unsigned int blocksize,
-                                       flow_enum::Direction flow_direction,
-                                       flow_enum::Direction slab_direction);
+                                       const flow_enum::Direction flow_direction,
+                                       const flow_enum::Direction slab_direction);
 
 hipError_t gpu_update_min_max_velocity(const unsigned int* const d_rtag,
                                        Scalar4* const d_vel,
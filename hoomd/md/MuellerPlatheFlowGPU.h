@@ -13,6 +13,7 @@
 #ifndef __HIPCC__
 #include "MuellerPlatheFlow.h"
 #include "hoomd/Autotuner.h"
+#include "hoomd/GPUArray.h"
 #include "hoomd/ParticleGroup.h"
 #include "hoomd/Updater.h"
 #include "hoomd/Variant.h"
@@ -60,6 +61,9 @@ class MuellerPlatheFlowGPU : public MuellerPlatheFlow
     protected:
     std::shared_ptr<Autotuner<1>> m_tuner; //!< Autotuner for block size
 
+    GPUArray<Scalar3> m_partial_extrema; //!< per-block extremum candidates (max half, min half)
+    GPUArray<Scalar3> m_extrema;         //!< reduced max (element 0) and min (element 1) candidate
+
     virtual void searchMinMaxVelocity(void);
     virtual void updateMinMaxVelocity(void);
     };
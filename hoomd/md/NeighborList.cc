@@ -8,8 +8,11 @@
 #include "NeighborList.h"
 #include "hoomd/BondedGroupData.h"
 
+#include <algorithm>
 #include <iostream>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 using namespace std;
 
@@ -31,7 +34,8 @@ namespace md
 */
 NeighborList::NeighborList(std::shared_ptr<SystemDefinition> sysdef, Scalar r_buff)
     : Compute(sysdef), m_typpair_idx(m_pdata->getNTypes()), m_rcut_max_max(0.0), m_rcut_min(0.0),
-      m_r_buff(r_buff), m_filter_body(false), m_storage_mode(half), m_meshbond_data(NULL),
+      m_r_buff(r_buff), m_comm_buff(r_buff), m_filter_body(false), m_storage_mode(half),
+      m_requested_storage_mode(half), m_meshbond_data(NULL),
       m_rcut_changed(true), m_updates(0), m_forced_updates(0), m_dangerous_updates(0),
       m_force_update(true), m_dist_check(true), m_has_been_updated_once(false)
     {
@@ -405,6 +409,8 @@ void NeighborList::compute(uint64_t timestep)
     // check if the list needs to be updated and update it
     if (needsUpdating(timestep))
         {
+        int64_t start = m_clock.getTime();
+
         // check simulation box size is OK
         checkBoxSize();
 
@@ -429,8 +435,13 @@ void NeighborList::compute(uint64_t timestep)
         if (m_exclusions_set)
             filterNlist();
 
+        if (m_sorted_by_distance)
+            sortNlistByDistance();
+
         setLastUpdatedPos();
         m_has_been_updated_once = true;
+
+        m_compute_time += m_clock.getTime() - start;
         }
     }
 
@@ -445,6 +456,7 @@ void NeighborList::setRBuff(Scalar r_buff)
         {
         throw runtime_error("Requested buffer radius is less than zero.");
         }
+    m_comm_buff = m_r_buff;
     notifyRCutMatrixChange();
     forceUpdate();
     }
@@ -822,7 +834,7 @@ void NeighborList::addExclusionsFromBonds()
     std::vector<BondData::members_t> bonds;
 
 #ifdef ENABLE_MPI
-    if (m_pdata->getDomainDecomposition())
+    if (m_pdata->isDomainDecomposed())
         {
         if (m_exec_conf->getRank() == 0)
             bonds = snapshot.groups;
@@ -855,7 +867,7 @@ void NeighborList::addExclusionsFromMeshBonds()
     std::vector<BondData::members_t> bonds;
 
 #ifdef ENABLE_MPI
-    if (m_pdata->getDomainDecomposition())
+    if (m_pdata->isDomainDecomposed())
         {
         if (m_exec_conf->getRank() == 0)
             bonds = snapshot.groups;
@@ -890,7 +902,7 @@ void NeighborList::addExclusionsFromAngles()
     std::vector<AngleData::members_t> angles;
 
 #ifdef ENABLE_MPI
-    if (m_pdata->getDomainDecomposition())
+    if (m_pdata->isDomainDecomposed())
         {
         if (m_exec_conf->getRank() == 0)
             angles = snapshot.groups;
@@ -924,7 +936,7 @@ void NeighborList::addExclusionsFromDihedrals()
     std::vector<DihedralData::members_t> dihedrals;
 
 #ifdef ENABLE_MPI
-    if (m_pdata->getDomainDecomposition())
+    if (m_pdata->isDomainDecomposed())
         {
         if (m_exec_conf->getRank() == 0)
             dihedrals = snapshot.groups;
@@ -958,7 +970,7 @@ void NeighborList::addExclusionsFromConstraints()
     std::vector<ConstraintData::members_t> constraints;
 
 #ifdef ENABLE_MPI
-    if (m_pdata->getDomainDecomposition())
+    if (m_pdata->isDomainDecomposed())
         {
         if (m_exec_conf->getRank() == 0)
             constraints = snapshot.groups;
@@ -993,7 +1005,7 @@ void NeighborList::addExclusionsFromPairs()
     std::vector<PairData::members_t> pairs;
 
 #ifdef ENABLE_MPI
-    if (m_pdata->getDomainDecomposition())
+    if (m_pdata->isDomainDecomposed())
         {
         if (m_exec_conf->getRank() == 0)
             pairs = snapshot.groups;
@@ -1219,57 +1231,65 @@ void NeighborList::addOneFourExclusionsFromTopology()
 */
 bool NeighborList::distanceCheck(uint64_t timestep)
     {
-    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
-
-    // sanity check
-    assert(h_pos.data);
-
     // temporary storage for the result
     bool result = false;
 
-    // get a local copy of the simulation box too
-    const BoxDim& box = m_pdata->getBox();
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
 
-    // get current nearest plane distances
-    Scalar3 L_g = m_pdata->getGlobalBox().getNearestPlaneDistance();
+        // sanity check
+        assert(h_pos.data);
 
-    // Find direction of maximum box length contraction (smallest eigenvalue of deformation tensor)
-    Scalar3 lambda = L_g / m_last_L;
-    Scalar lambda_min = (lambda.x < lambda.y) ? lambda.x : lambda.y;
-    lambda_min = (lambda_min < lambda.z) ? lambda_min : (Scalar)lambda.z;
+        // get a local copy of the simulation box too
+        const BoxDim& box = m_pdata->getBox();
 
-    ArrayHandle<Scalar4> h_last_pos(m_last_pos, access_location::host, access_mode::read);
-    ArrayHandle<Scalar> h_rcut_max(m_rcut_max, access_location::host, access_mode::read);
+        // get current nearest plane distances
+        Scalar3 L_g = m_pdata->getGlobalBox().getNearestPlaneDistance();
 
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        {
-        const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
+        // Find direction of maximum box length contraction (smallest eigenvalue of deformation
+        // tensor)
+        Scalar3 lambda = L_g / m_last_L;
+        Scalar lambda_min = (lambda.x < lambda.y) ? lambda.x : lambda.y;
+        lambda_min = (lambda_min < lambda.z) ? lambda_min : (Scalar)lambda.z;
 
-        // minimum distance within which all particles should be included
-        Scalar old_rmin = h_rcut_max.data[type_i];
+        ArrayHandle<Scalar4> h_last_pos(m_last_pos, access_location::host, access_mode::read);
+        ArrayHandle<Scalar> h_rcut_max(m_rcut_max, access_location::host, access_mode::read);
 
-        // maximum value we have checked for neighbors, defined by the buffer layer
-        Scalar rmax = old_rmin + m_r_buff;
+        // with adaptive ghost sizing the rebuild criterion tightens to the communicated width
+        const Scalar r_check_buff = getCommBuff();
 
-        // max displacement for each particle (after subtraction of homogeneous dilations)
-        const Scalar delta_max = (rmax * lambda_min - old_rmin) / Scalar(2.0);
-        Scalar maxsq = (delta_max > 0) ? delta_max * delta_max : 0;
+        for (unsigned int i = 0; i < m_pdata->getN(); i++)
+            {
+            const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
 
-        Scalar3 dx = make_scalar3(h_pos.data[i].x - lambda.x * h_last_pos.data[i].x,
-                                  h_pos.data[i].y - lambda.y * h_last_pos.data[i].y,
-                                  h_pos.data[i].z - lambda.z * h_last_pos.data[i].z);
+            // minimum distance within which all particles should be included
+            Scalar old_rmin = h_rcut_max.data[type_i];
 
-        dx = box.minImage(dx);
+            // maximum value we have checked for neighbors, defined by the buffer layer
+            Scalar rmax = old_rmin + r_check_buff;
 
-        if (dot(dx, dx) >= maxsq)
-            {
-            result = true;
-            break;
+            // max displacement for each particle (after subtraction of homogeneous dilations)
+            const Scalar delta_max = (rmax * lambda_min - old_rmin) / Scalar(2.0);
+            Scalar maxsq = (delta_max > 0) ? delta_max * delta_max : 0;
+
+            Scalar3 dx = make_scalar3(h_pos.data[i].x - lambda.x * h_last_pos.data[i].x,
+                                      h_pos.data[i].y - lambda.y * h_last_pos.data[i].y,
+                                      h_pos.data[i].z - lambda.z * h_last_pos.data[i].z);
+
+            dx = box.minImage(dx);
+
+            if (dot(dx, dx) >= maxsq)
+                {
+                result = true;
+                break;
+                }
             }
         }
 
 #ifdef ENABLE_MPI
-    if (m_pdata->getDomainDecomposition())
+    if (m_pdata->isDomainDecomposed())
         {
         // check if migrate criterion is fulfilled on any rank
         int local_result = result ? 1 : 0;
@@ -1284,10 +1304,102 @@ bool NeighborList::distanceCheck(uint64_t timestep)
         }
 #endif
 
+    adaptCommBuff(timestep, result);
+
     // don't worry about computing flops here, this is fast
     return result;
     }
 
+/*! \returns The largest distance any particle has moved since the last rebuild, maximized
+    over all ranks.
+
+    Homogeneous box dilations are subtracted in the same way as in distanceCheck() so that
+    affine rescaling does not count as displacement.
+*/
+Scalar NeighborList::measureMaxDisplacement()
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_last_pos(m_last_pos, access_location::host, access_mode::read);
+
+    const BoxDim& box = m_pdata->getBox();
+
+    Scalar3 L_g = m_pdata->getGlobalBox().getNearestPlaneDistance();
+    Scalar3 lambda = L_g / m_last_L;
+
+    Scalar max_sq = Scalar(0.0);
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        {
+        Scalar3 dx = make_scalar3(h_pos.data[i].x - lambda.x * h_last_pos.data[i].x,
+                                  h_pos.data[i].y - lambda.y * h_last_pos.data[i].y,
+                                  h_pos.data[i].z - lambda.z * h_last_pos.data[i].z);
+        dx = box.minImage(dx);
+
+        const Scalar dr_sq = dot(dx, dx);
+        if (dr_sq > max_sq)
+            max_sq = dr_sq;
+        }
+
+#ifdef ENABLE_MPI
+    if (m_pdata->isDomainDecomposed())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &max_sq,
+                      1,
+                      MPI_HOOMD_SCALAR,
+                      MPI_MAX,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    return slow::sqrt(max_sq);
+    }
+
+/*! \param timestep Current time step
+    \param rebuild True if the distance check triggered a rebuild on this step
+
+    When adaptive ghost sizing is active, sets the communicated buffer width to a safe
+    bound on the displacement extrema actually observed between rebuilds: twice the
+    measured maximum displacement plus headroom, clamped to
+    [comm_buff_min_fraction * r_buff, r_buff].
+
+    Width increases are applied at rebuild steps only, when the ghost layer is about to be
+    re-exchanged with the wider layer. Shrinks also happen on sparse probe steps within a
+    rebuild interval so that systems which never exhaust the buffer (and therefore rarely
+    trigger distance rebuilds) still converge to a thin layer; tightening the rebuild
+    criterion mid-interval only rebuilds earlier and is always safe.
+*/
+void NeighborList::adaptCommBuff(uint64_t timestep, bool rebuild)
+    {
+#ifdef ENABLE_MPI
+    if (!m_adaptive_ghost_width || !m_pdata->isDomainDecomposed() || !m_has_been_updated_once)
+        return;
+
+    // the measurement makes a host pass over the positions and a collective reduction,
+    // only pay for it on rebuild steps and on sparse probe steps
+    const uint64_t elapsed = timestep - m_last_updated_tstep;
+    const bool probe
+        = elapsed >= comm_buff_probe_period && (elapsed % comm_buff_probe_period == 0);
+    if (!rebuild && !probe)
+        return;
+
+    const Scalar measured = Scalar(2.0) * comm_buff_margin * measureMaxDisplacement();
+    const Scalar bound
+        = std::min(m_r_buff, std::max(measured, m_r_buff * comm_buff_min_fraction));
+
+    if (rebuild)
+        {
+        // the ghost layer is re-exchanged right after this rebuild: adopt the bound
+        m_comm_buff = bound;
+        }
+    else if (bound < comm_buff_shrink_hysteresis * m_comm_buff)
+        {
+        // the tighter criterion applies immediately; the narrower ghost layer is
+        // communicated on the next exchange
+        m_comm_buff = bound;
+        }
+#endif
+    }
+
 /*! Copies the current positions of all particles over to m_last_x etc...
  */
 void NeighborList::setLastUpdatedPos()
@@ -1535,6 +1647,56 @@ void NeighborList::filterNlist()
         }
     }
 
+/*!
+ * Reorders each particle's neighbors in ascending order of distance at build time. Consumers
+ * can then stop traversing a row at the first neighbor beyond their own cutoff, which lets
+ * several pair potentials with different cutoffs share one list built at the maximum cutoff.
+ * The sort runs only on rebuild steps, so its cost is amortized over the steps a list is
+ * reused.
+ */
+void NeighborList::sortNlistByDistance()
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::readwrite);
+
+    const BoxDim& box = m_pdata->getBox();
+
+    std::vector<std::pair<Scalar, unsigned int>> row;
+    for (unsigned int idx = 0; idx < m_pdata->getN(); idx++)
+        {
+        const unsigned int n_neigh = h_n_neigh.data[idx];
+        if (n_neigh < 2)
+            continue;
+
+        const size_t myHead = h_head_list.data[idx];
+        const Scalar3 pi
+            = make_scalar3(h_pos.data[idx].x, h_pos.data[idx].y, h_pos.data[idx].z);
+
+        row.clear();
+        for (unsigned int cur_neigh_idx = 0; cur_neigh_idx < n_neigh; cur_neigh_idx++)
+            {
+            const unsigned int j = h_nlist.data[myHead + cur_neigh_idx];
+            const Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+            const Scalar3 dx = box.minImage(pi - pj);
+            row.push_back(std::make_pair(dot(dx, dx), j));
+            }
+
+        // stable so that equidistant neighbors keep the build order
+        std::stable_sort(row.begin(),
+                         row.end(),
+                         [](const std::pair<Scalar, unsigned int>& a,
+                            const std::pair<Scalar, unsigned int>& b)
+                         { return a.first < b.first; });
+
+        for (unsigned int cur_neigh_idx = 0; cur_neigh_idx < n_neigh; cur_neigh_idx++)
+            {
+            h_nlist.data[myHead + cur_neigh_idx] = row[cur_neigh_idx].second;
+            }
+        }
+    }
+
 /*!
  * Iterates through each particle, and calculates a running sum of the starting index for that
  * particle in the flat array of neighbors.
@@ -1587,7 +1749,33 @@ void NeighborList::resizeNlist(size_t size)
         // round up to nearest multiple of 4
         alloc_size = (alloc_size > 4) ? (alloc_size + 3) & ~3 : 4;
 
-        m_nlist.resize(alloc_size);
+        // the list is rebuilt from scratch immediately after every resize, so swap in a
+        // fresh allocation instead of resizing in place and copying the stale contents
+        // (as CellList does for its per-cell arrays)
+        GlobalArray<unsigned int> nlist(alloc_size, m_exec_conf);
+        m_nlist.swap(nlist);
+        TAG_ALLOCATION(m_nlist);
+        }
+    }
+
+/*!
+ * \param alignment New row alignment in neighbor list elements, must be a power of two
+ *
+ * Every per-type Nmax value is kept a multiple of the alignment. The head addresses are sums of
+ * per-type Nmax values, so this aligns the start of every row in the flat neighbor list. The GPU
+ * neighbor lists align rows to full warps (32 elements, 128 bytes) so that warp-wide neighbor
+ * reads are fully coalesced; the padding is bounded out by m_n_neigh and never read.
+ */
+void NeighborList::setNmaxAlignment(unsigned int alignment)
+    {
+    assert(alignment >= 1 && (alignment & (alignment - 1)) == 0);
+    m_nmax_alignment = alignment;
+
+    // round the current allocations up to the new alignment
+    ArrayHandle<unsigned int> h_Nmax(m_Nmax, access_location::host, access_mode::readwrite);
+    for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+        {
+        h_Nmax.data[i] = (h_Nmax.data[i] + alignment - 1) & ~(alignment - 1);
         }
     }
 
@@ -1595,8 +1783,8 @@ void NeighborList::resizeNlist(size_t size)
  * \returns true if an overflow is detected for any particle type
  * \returns false if all particle types have enough memory for their neighbors
  *
- * The maximum number of neighbors per particle (rounded up to the nearest 4, min of 4) is
- * recomputed when an overflow happens.
+ * The maximum number of neighbors per particle (rounded up to the row alignment, min of one
+ * aligned row) is recomputed when an overflow happens.
  */
 bool NeighborList::checkConditions()
     {
@@ -1604,11 +1792,16 @@ bool NeighborList::checkConditions()
 
     ArrayHandle<unsigned int> h_conditions(m_conditions, access_location::host, access_mode::read);
     ArrayHandle<unsigned int> h_Nmax(m_Nmax, access_location::host, access_mode::readwrite);
+    const unsigned int align = m_nmax_alignment;
     for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
         {
         if (h_conditions.data[i] > h_Nmax.data[i])
             {
-            h_Nmax.data[i] = (h_conditions.data[i] > 4) ? (h_conditions.data[i] + 3) & ~3 : 4;
+            // grow with amortized headroom (9/8, as for GPUVector resizes) so that a
+            // slowly densifying system does not overflow and build twice on every
+            // rebuild; keep multiples of the row alignment for coalescing
+            unsigned int needed = h_conditions.data[i] + h_conditions.data[i] / 8;
+            h_Nmax.data[i] = (needed > align) ? (needed + align - 1) & ~(align - 1) : align;
             result = true;
             }
         }
@@ -1996,7 +2189,15 @@ void export_NeighborList(pybind11::module& m)
                       &NeighborList::getRebuildCheckDelay,
                       &NeighborList::setRebuildCheckDelay)
         .def_property("check_dist", &NeighborList::getDistCheck, &NeighborList::setDistCheck)
+        .def_property("adaptive_ghost_width",
+                      &NeighborList::getAdaptiveGhostWidth,
+                      &NeighborList::setAdaptiveGhostWidth)
+        .def_property("sort_by_distance",
+                      &NeighborList::getSortedByDistance,
+                      &NeighborList::setSortedByDistance)
         .def("setStorageMode", &NeighborList::setStorageMode)
+        .def("addFullStorageRequest", &NeighborList::addFullStorageRequest)
+        .def("removeFullStorageRequest", &NeighborList::removeFullStorageRequest)
         .def_property("exclusions", &NeighborList::getExclusions, &NeighborList::setExclusions)
         .def("addMesh", &NeighborList::AddMesh)
         .def("getMaxRCut", &NeighborList::getMaxRCut)
@@ -2008,6 +2209,7 @@ void export_NeighborList(pybind11::module& m)
         .def("getNumUpdates", &NeighborList::getNumUpdates)
         .def("getNumExclusions", &NeighborList::getNumExclusions)
         .def_property_readonly("num_builds", &NeighborList::getNumUpdates)
+        .def_property_readonly("compute_time", &NeighborList::getComputeTime)
         .def("getLocalPairList", &NeighborList::getLocalPairListPython)
         .def("getPairList", &NeighborList::getPairListPython)
         .def("setRCut", &NeighborList::setRCutPython)
@@ -1,6 +1,7 @@
 // Copyright (c) 2009-2023 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+#include "hoomd/ClockSource.h"
 #include "hoomd/Compute.h"
 #include "hoomd/GPUFlags.h"
 #include "hoomd/GPUVector.h"
@@ -231,8 +232,29 @@ class PYBIND11_EXPORT NeighborList : public Compute
     */
     void setStorageMode(storageMode mode)
         {
-        m_storage_mode = mode;
-        forceUpdate();
+        m_requested_storage_mode = mode;
+        updateStorageMode();
+        }
+
+    //! Register a consumer that requires full storage
+    /*! Multiple potentials may share one neighbor list: pair potentials prefer half
+        storage on the CPU, while multi-body potentials and the GPU pair kernels require
+        full storage. Consumers that cannot use Newton's third law register here so that
+        a later setStorageMode(half) from another consumer does not downgrade the list
+        out from under them.
+    */
+    void addFullStorageRequest()
+        {
+        m_n_full_storage_requests++;
+        updateStorageMode();
+        }
+
+    //! Remove a full storage request
+    void removeFullStorageRequest()
+        {
+        assert(m_n_full_storage_requests > 0);
+        m_n_full_storage_requests--;
+        updateStorageMode();
         }
 
     // @}
@@ -245,6 +267,46 @@ class PYBIND11_EXPORT NeighborList : public Compute
         return m_storage_mode;
         }
 
+    //! Enable / disable distance ordered neighbor storage
+    /*! When enabled, each particle's neighbors are reordered by ascending distance after
+        every rebuild. Consumers with cutoffs smaller than the largest requested cutoff can
+        then stop traversing a row early, which lets several pair potentials with different
+        cutoffs share one list built at the maximum cutoff.
+    */
+    void setSortedByDistance(bool sort)
+        {
+        m_sorted_by_distance = sort;
+        forceUpdate();
+        }
+
+    //! Get whether neighbors are stored in distance order
+    bool getSortedByDistance()
+        {
+        return m_sorted_by_distance;
+        }
+
+    //! Enable / disable adaptive ghost layer sizing
+    /*! When enabled, the communicated ghost layer width is shrunk from the full
+        r_cut + buffer to a bound measured from the displacement extrema actually observed
+        between rebuilds, and the distance check rebuild criterion is tightened to match.
+        This reduces ghost volume substantially when particles move much less than the
+        buffer allows (e.g. low temperature or stiff systems); in systems that exhaust the
+        full buffer between rebuilds the width stays at r_cut + buffer. Only has an effect
+        in domain decomposed simulations.
+    */
+    void setAdaptiveGhostWidth(bool adaptive)
+        {
+        m_adaptive_ghost_width = adaptive;
+        m_comm_buff = m_r_buff;
+        forceUpdate();
+        }
+
+    //! Get whether adaptive ghost layer sizing is enabled
+    bool getAdaptiveGhostWidth()
+        {
+        return m_adaptive_ghost_width;
+        }
+
     //! Get the maximum of all rcut
     Scalar getMaxRCut()
         {
@@ -388,7 +450,7 @@ class PYBIND11_EXPORT NeighborList : public Compute
 
         if (rcut_max_i > Scalar(0.0)) // ensure communication is required
             {
-            return rcut_max_i + m_r_buff;
+            return rcut_max_i + getCommBuff();
             }
         else
             {
@@ -413,6 +475,15 @@ class PYBIND11_EXPORT NeighborList : public Compute
         return m_updates + m_forced_updates;
         }
 
+    //! Get the wall time spent building the neighbor list since creation, in seconds
+    /*! On the GPU, kernel launches are asynchronous: the reported time covers the host side
+        of the build only, unless a later operation synchronizes with the device.
+    */
+    double getComputeTime() const
+        {
+        return double(m_compute_time) / 1e9;
+        }
+
 #ifdef ENABLE_MPI
     //! Returns true if the particle migration criterion is fulfilled
     /*! \param timestep The current timestep
@@ -482,8 +553,12 @@ class PYBIND11_EXPORT NeighborList : public Compute
     Scalar m_rcut_max_max;      //!< The maximum cutoff radius of any pair
     Scalar m_rcut_min;          //!< The smallest cutoff radius of any pair (that is > 0)
     Scalar m_r_buff;            //!< The buffer around the cutoff
+    Scalar m_comm_buff;         //!< Adaptively sized communication buffer width
     bool m_filter_body;         //!< Set to true if particles in the same body are to be filtered
-    storageMode m_storage_mode; //!< The storage mode
+    storageMode m_storage_mode; //!< The effective storage mode used when building
+    storageMode m_requested_storage_mode; //!< The storage mode requested via setStorageMode
+    unsigned int m_n_full_storage_requests = 0; //!< Number of consumers requiring full storage
+    bool m_sorted_by_distance = false; //!< True when rows are reordered by ascending distance
 
     GlobalArray<unsigned int> m_nlist;   //!< Neighbor list data
     GlobalArray<unsigned int> m_n_neigh; //!< Number of neighbors for each particle
@@ -494,6 +569,9 @@ class PYBIND11_EXPORT NeighborList : public Compute
     GlobalArray<size_t> m_head_list; //!< Indexes for particles to read from the neighbor list
     GlobalArray<unsigned int>
         m_Nmax; //!< Holds the maximum number of neighbors for each particle type
+
+    /// Alignment (in elements) of the per-type row allocations in m_Nmax
+    unsigned int m_nmax_alignment = 4;
     GlobalArray<unsigned int>
         m_conditions; //!< Holds the max number of computed particles by type for resizing
 
@@ -518,6 +596,38 @@ class PYBIND11_EXPORT NeighborList : public Compute
     std::shared_ptr<Communicator> m_comm;
 #endif
 
+    bool m_adaptive_ghost_width = false; //!< True when the ghost layer is sized adaptively
+
+    /// Headroom factor applied to the measured displacement bound
+    static constexpr Scalar comm_buff_margin = Scalar(1.2);
+    /// Smallest fraction of the full buffer the adaptive width may shrink to
+    static constexpr Scalar comm_buff_min_fraction = Scalar(0.25);
+    /// Shrink only when the measured bound undercuts the current width by this factor
+    static constexpr Scalar comm_buff_shrink_hysteresis = Scalar(0.75);
+    /// Steps between displacement probes within one rebuild interval
+    static constexpr uint64_t comm_buff_probe_period = 100;
+
+    //! Get the buffer width used for the distance check and the ghost layer
+    /*! Equal to the full buffer unless adaptive ghost sizing is active, in which case it
+        is the measured bound maintained by adaptCommBuff().
+    */
+    Scalar getCommBuff()
+        {
+#ifdef ENABLE_MPI
+        if (m_adaptive_ghost_width && m_pdata->isDomainDecomposed())
+            {
+            return m_comm_buff;
+            }
+#endif
+        return m_r_buff;
+        }
+
+    //! Measure the maximum displacement since the last rebuild over all ranks
+    Scalar measureMaxDisplacement();
+
+    //! Update the adaptive communication buffer width from measured displacements
+    void adaptCommBuff(uint64_t timestep, bool rebuild);
+
     //! Return true if we are supposed to do a distance check in this time step
     bool shouldCheckDistance(uint64_t timestep);
 
@@ -542,12 +652,29 @@ class PYBIND11_EXPORT NeighborList : public Compute
     //! Filter the neighbor list of excluded particles
     virtual void filterNlist();
 
+    //! Reorder each particle's neighbors by ascending distance
+    virtual void sortNlistByDistance();
+
     //! Build the head list to allocated memory
     virtual void buildHeadList();
 
     //! Amortized resizing of the neighborlist
     void resizeNlist(size_t size);
 
+    //! Set the alignment of the per-type row allocations
+    void setNmaxAlignment(unsigned int alignment);
+
+    //! Recompute the effective storage mode from the requested mode and full requests
+    void updateStorageMode()
+        {
+        storageMode mode = (m_n_full_storage_requests > 0) ? full : m_requested_storage_mode;
+        if (mode != m_storage_mode)
+            {
+            m_storage_mode = mode;
+            forceUpdate();
+            }
+        }
+
 #ifdef ENABLE_MPI
     CommFlags getRequestedCommFlags(uint64_t timestep)
         {
@@ -583,6 +710,8 @@ class PYBIND11_EXPORT NeighborList : public Compute
     uint64_t m_updates;           //!< Number of times the neighbor list has been updated
     uint64_t m_forced_updates;    //!< Number of times the neighbor list has been forcibly updated
     uint64_t m_dangerous_updates; //!< Number of dangerous builds counted
+    ClockSource m_clock;          //!< Clock used to time neighbor list builds
+    int64_t m_compute_time = 0;   //!< Total wall time spent building the list, in nanoseconds
     bool m_force_update;          //!< Flag to handle the forcing of neighborlist updates
     bool m_dist_check;            //!< Set to false to disable distance checks (nlist always built
                                   //!< m_rebuild_check_delay steps)
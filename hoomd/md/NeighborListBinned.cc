@@ -11,6 +11,13 @@
 #include "hoomd/Communicator.h"
 #endif
 
+#ifdef ENABLE_TBB
+#include <mutex>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
 using namespace std;
 
 namespace hoomd
@@ -23,7 +30,9 @@ NeighborListBinned::NeighborListBinned(std::shared_ptr<SystemDefinition> sysdef,
     m_exec_conf->msg->notice(5) << "Constructing NeighborListBinned" << endl;
 
     m_cl->setRadius(1);
-    m_cl->setComputeXYZF(true);
+    // the host build streams candidate cells lane-by-lane, use the SoA layout
+    m_cl->setComputeXYZF(false);
+    m_cl->setComputeXYZFSoA(true);
     m_cl->setComputeTypeBody(false);
     m_cl->setFlagIndex();
     }
@@ -57,17 +66,24 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
 
     const BoxDim& box = m_pdata->getBox();
 
+    // particles must be binned against the same box the cell list used, which is the
+    // lattice-reduced box when the tilt factors have accumulated beyond 1/2
+    const BoxDim& bin_box = m_cl->getBinningBox();
+    const bool bin_reduced = m_cl->isBinningReduced();
+
     // access the rlist data
     ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
     ArrayHandle<Scalar> h_r_listsq(m_r_listsq, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_rcut_max(m_rcut_max, access_location::host, access_mode::read);
 
     // access the cell list data arrays
     ArrayHandle<unsigned int> h_cell_size(m_cl->getCellSizeArray(),
                                           access_location::host,
                                           access_mode::read);
-    ArrayHandle<Scalar4> h_cell_xyzf(m_cl->getXYZFArray(),
-                                     access_location::host,
-                                     access_mode::read);
+    ArrayHandle<Scalar> h_cell_xyzf(m_cl->getXYZFSoAArray(),
+                                    access_location::host,
+                                    access_mode::read);
+    const size_t soa_pitch = m_cl->getXYZFSoAPitch();
     ArrayHandle<unsigned int> h_cell_adj(m_cl->getCellAdjArray(),
                                          access_location::host,
                                          access_mode::read);
@@ -89,10 +105,50 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
     // get periodic flags
     uchar3 periodic = box.getPeriodic();
 
+    // The cell width is set by the largest pair cutoff of any type. With strongly
+    // asymmetric cutoffs (e.g. colloid/solvent mixtures), particles of small-cutoff types
+    // then scan many candidates that can never fall within their own list range. Skip
+    // adjacent cells that lie entirely outside the per-type list radius. The per-axis
+    // minimum-image distance test is only valid when the box is not tilted.
+    const bool prune_cells = (box.getTiltFactorXY() == Scalar(0.0)
+                              && box.getTiltFactorXZ() == Scalar(0.0)
+                              && box.getTiltFactorYZ() == Scalar(0.0));
+
+    std::vector<Scalar3> cell_center;
+    Scalar3 cell_half = make_scalar3(0, 0, 0);
+    if (prune_cells)
+        {
+        const Scalar3 lo = box.getLo();
+        const Scalar3 L = box.getL();
+        cell_half
+            = make_scalar3(Scalar(0.5) * (L.x + Scalar(2.0) * ghost_width.x) / (Scalar)dim.x,
+                           Scalar(0.5) * (L.y + Scalar(2.0) * ghost_width.y) / (Scalar)dim.y,
+                           Scalar(0.5) * (L.z + Scalar(2.0) * ghost_width.z) / (Scalar)dim.z);
+
+        cell_center.resize(ci.getNumElements());
+        for (unsigned int i = 0; i < dim.x; i++)
+            for (unsigned int j = 0; j < dim.y; j++)
+                for (unsigned int k = 0; k < dim.z; k++)
+                    {
+                    cell_center[ci(i, j, k)] = make_scalar3(
+                        lo.x - ghost_width.x + Scalar(2 * i + 1) * cell_half.x,
+                        lo.y - ghost_width.y + Scalar(2 * j + 1) * cell_half.y,
+                        lo.z - ghost_width.z + Scalar(2 * k + 1) * cell_half.z);
+                    }
+        }
+
     // for each local particle
     unsigned int nparticles = m_pdata->getN();
 
-    for (int i = 0; i < (int)nparticles; i++)
+#ifdef ENABLE_TBB
+    // the overflow conditions are shared between particles: serialize the (rare) updates
+    std::mutex condition_mutex;
+#endif
+
+    // Each particle writes only its own neighbor list segment, so the per-particle
+    // work is wrapped in a lambda and run in parallel on the task arena when TBB is
+    // enabled.
+    auto bin_particle = [&](const int i)
         {
         unsigned int cur_n_neigh = 0;
 
@@ -104,7 +160,17 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
         const size_t head_idx_i = h_head_list.data[i];
 
         // find the bin each particle belongs in
-        Scalar3 f = box.makeFraction(my_pos, ghost_width);
+        Scalar3 f = bin_box.makeFraction(my_pos, ghost_width);
+        if (bin_reduced)
+            {
+            // positions are wrapped into the global box, fold them into the reduced one
+            if (periodic.x)
+                f.x -= std::floor(f.x);
+            if (periodic.y)
+                f.y -= std::floor(f.y);
+            if (periodic.z)
+                f.z -= std::floor(f.z);
+            }
         int ib = (unsigned int)(f.x * dim.x);
         int jb = (unsigned int)(f.y * dim.y);
         int kb = (unsigned int)(f.z * dim.z);
@@ -120,17 +186,42 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
         // identify the bin
         unsigned int my_cell = ci(ib, jb, kb);
 
+        // largest list radius this particle type can reach
+        const Scalar r_list_max_i = (h_rcut_max.data[type_i] > Scalar(0.0))
+                                        ? h_rcut_max.data[type_i] + m_r_buff
+                                        : Scalar(0.0);
+        const Scalar r_list_max_i_sq = r_list_max_i * r_list_max_i;
+
         // loop through all neighboring bins
         for (unsigned int cur_adj = 0; cur_adj < cadji.getW(); cur_adj++)
             {
             unsigned int neigh_cell = h_cell_adj.data[cadji(cur_adj, my_cell)];
 
+            // skip cells entirely out of range of this particle type's list radius
+            if (prune_cells && neigh_cell != my_cell)
+                {
+                Scalar3 dc = box.minImage(my_pos - cell_center[neigh_cell]);
+                Scalar ddx = max(fabs(dc.x) - cell_half.x, Scalar(0.0));
+                Scalar ddy = max(fabs(dc.y) - cell_half.y, Scalar(0.0));
+                Scalar ddz = max(fabs(dc.z) - cell_half.z, Scalar(0.0));
+                if (ddx * ddx + ddy * ddy + ddz * ddz > r_list_max_i_sq)
+                    continue;
+                }
+
             // check against all the particles in that neighboring bin to see if it is a neighbor
             unsigned int size = h_cell_size.data[neigh_cell];
+
+            // the entries of a cell are contiguous within each SoA plane, stream them
+            // with unit stride
+            const size_t cell_start = cli(0, neigh_cell);
+            const Scalar* x_plane = h_cell_xyzf.data + cell_start;
+            const Scalar* y_plane = h_cell_xyzf.data + soa_pitch + cell_start;
+            const Scalar* z_plane = h_cell_xyzf.data + 2 * soa_pitch + cell_start;
+            const Scalar* f_plane = h_cell_xyzf.data + 3 * soa_pitch + cell_start;
+
             for (unsigned int cur_offset = 0; cur_offset < size; cur_offset++)
                 {
-                Scalar4& cur_xyzf = h_cell_xyzf.data[cli(cur_offset, neigh_cell)];
-                unsigned int cur_neigh = __scalar_as_int(cur_xyzf.w);
+                unsigned int cur_neigh = __scalar_as_int(f_plane[cur_offset]);
 
                 // get the current neighbor type from the position data (will use TypeBody on the
                 // GPU)
@@ -147,7 +238,9 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
                 if (excluded)
                     continue;
 
-                Scalar3 neigh_pos = make_scalar3(cur_xyzf.x, cur_xyzf.y, cur_xyzf.z);
+                Scalar3 neigh_pos = make_scalar3(x_plane[cur_offset],
+                                                 y_plane[cur_offset],
+                                                 z_plane[cur_offset]);
                 Scalar3 dx = my_pos - neigh_pos;
                 dx = box.minImage(dx);
 
@@ -165,8 +258,13 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
                             h_nlist.data[head_idx_i + cur_n_neigh] = cur_neigh;
                             }
                         else
+                            {
+#ifdef ENABLE_TBB
+                            std::lock_guard<std::mutex> lock(condition_mutex);
+#endif
                             h_conditions.data[type_i]
                                 = max(h_conditions.data[type_i], cur_n_neigh + 1);
+                            }
 
                         cur_n_neigh++;
                         }
@@ -175,7 +273,29 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
             }
 
         h_n_neigh.data[i] = cur_n_neigh;
-        }
+        };
+
+#ifdef ENABLE_TBB
+    // fixed-size chunks with a simple partitioner keep every chunk an independently
+    // stealable task, so threads finishing dilute regions pull work from dense ones
+    // instead of waiting on an unbalanced static split
+    m_exec_conf->getTaskArena()->execute(
+        [&]
+        {
+            tbb::parallel_for(tbb::blocked_range<int>(0,
+                                                      (int)nparticles,
+                                                      ExecutionConfiguration::work_stealing_chunk_size),
+                              [&](const tbb::blocked_range<int>& r)
+                              {
+                                  for (int i = r.begin(); i != r.end(); ++i)
+                                      bin_particle(i);
+                              },
+                              tbb::simple_partitioner());
+        });
+#else
+    for (int i = 0; i < (int)nparticles; i++)
+        bin_particle(i);
+#endif
     }
 
 namespace detail
@@ -192,7 +312,8 @@ void export_NeighborListBinned(pybind11::module& m)
         .def("getDim",
              &NeighborListBinned::getDim,
              pybind11::return_value_policy::reference_internal)
-        .def("getNmax", &NeighborListBinned::getNmax);
+        .def("getNmax", &NeighborListBinned::getNmax)
+        .def("getCellList", &NeighborListBinned::getCellList);
     }
 
     } // end namespace detail
@@ -54,6 +54,12 @@ class PYBIND11_EXPORT NeighborListBinned : public NeighborList
         return m_cl->getSortCellList();
         }
 
+    /// Get the cell list used to build the neighbor list
+    std::shared_ptr<CellList> getCellList()
+        {
+        return m_cl;
+        }
+
     /// Get the dimensions of the cell list
     const uint3& getDim() const
         {
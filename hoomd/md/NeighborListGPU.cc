@@ -34,23 +34,26 @@ bool NeighborListGPU::distanceCheck(uint64_t timestep)
         return false;
         }
 
-    // scan through the particle data arrays and calculate distances
-    // access data
-    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
-    BoxDim box = m_pdata->getBox();
-    ArrayHandle<Scalar4> d_last_pos(m_last_pos, access_location::device, access_mode::read);
+        {
+        // scan through the particle data arrays and calculate distances
+        // access data
+        ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+        BoxDim box = m_pdata->getBox();
+        ArrayHandle<Scalar4> d_last_pos(m_last_pos, access_location::device, access_mode::read);
 
-    // get current global nearest plane distance
-    Scalar3 L_g = m_pdata->getGlobalBox().getNearestPlaneDistance();
+        // get current global nearest plane distance
+        Scalar3 L_g = m_pdata->getGlobalBox().getNearestPlaneDistance();
 
-    // Find direction of maximum box length contraction (smallest eigenvalue of deformation tensor)
-    Scalar3 lambda = L_g / m_last_L;
-    Scalar lambda_min = (lambda.x < lambda.y) ? lambda.x : lambda.y;
-    lambda_min = (lambda_min < lambda.z) ? lambda_min : lambda.z;
+        // Find direction of maximum box length contraction (smallest eigenvalue of deformation
+        // tensor)
+        Scalar3 lambda = L_g / m_last_L;
+        Scalar lambda_min = (lambda.x < lambda.y) ? lambda.x : lambda.y;
+        lambda_min = (lambda_min < lambda.z) ? lambda_min : lambda.z;
 
-    ArrayHandle<Scalar> d_rcut_max(m_rcut_max, access_location::device, access_mode::read);
+        ArrayHandle<Scalar> d_rcut_max(m_rcut_max, access_location::device, access_mode::read);
 
-        {
         ArrayHandle<unsigned int> d_flags(m_flags, access_location::device, access_mode::readwrite);
 
         m_exec_conf->beginMultiGPU();
@@ -61,7 +64,7 @@ bool NeighborListGPU::distanceCheck(uint64_t timestep)
                                                  m_pdata->getN(),
                                                  box,
                                                  d_rcut_max.data,
-                                                 m_r_buff,
+                                                 getCommBuff(),
                                                  m_pdata->getNTypes(),
                                                  lambda_min,
                                                  lambda,
@@ -97,6 +100,8 @@ bool NeighborListGPU::distanceCheck(uint64_t timestep)
         }
 #endif
 
+    adaptCommBuff(timestep, result);
+
     return result;
     }
 
@@ -128,6 +133,36 @@ void NeighborListGPU::filterNlist()
     m_tuner_filter->end();
     }
 
+/*! Calls gpu_nlist_sort_by_distance() to reorder each row of the neighbor list in ascending
+    order of distance on the GPU. See NeighborList::sortNlistByDistance() for the rationale; the
+    distance scratch space is drawn from the cached allocator since it is only needed on rebuild
+    steps.
+ */
+void NeighborListGPU::sortNlistByDistance()
+    {
+    // access data
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_n_neigh(m_n_neigh, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_nlist(m_nlist, access_location::device, access_mode::readwrite);
+    ArrayHandle<size_t> d_head_list(m_head_list, access_location::device, access_mode::read);
+
+    // scratch space for one distance per neighbor list entry
+    ScopedAllocation<Scalar> d_rsq(m_exec_conf->getCachedAllocator(), m_nlist.getNumElements());
+
+    m_tuner_sort->begin();
+    kernel::gpu_nlist_sort_by_distance(d_nlist.data,
+                                       d_rsq.data,
+                                       d_head_list.data,
+                                       d_n_neigh.data,
+                                       d_pos.data,
+                                       m_pdata->getBox(),
+                                       m_pdata->getN(),
+                                       m_tuner_sort->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner_sort->end();
+    }
+
 //! Update the exclusion list on the GPU
 void NeighborListGPU::updateExListIdx()
     {
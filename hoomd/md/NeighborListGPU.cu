@@ -55,15 +55,17 @@ __global__ void gpu_nlist_needs_update_check_new_kernel(unsigned int* d_result,
     // each thread will compare vs it's old position to see if the list needs updating
     int idx = blockIdx.x * blockDim.x + threadIdx.x;
 
+    bool moved = false;
+
     if (idx < nwork)
         {
         // get particle index
         idx += offset;
 
-        Scalar4 cur_postype = d_pos[idx];
+        Scalar4 cur_postype = __ldg(d_pos + idx);
         Scalar3 cur_pos = make_scalar3(cur_postype.x, cur_postype.y, cur_postype.z);
         const unsigned int cur_type = __scalar_as_int(cur_postype.w);
-        Scalar4 last_postype = d_last_pos[idx];
+        Scalar4 last_postype = __ldg(d_last_pos + idx);
         Scalar3 last_pos = make_scalar3(last_postype.x, last_postype.y, last_postype.z);
 
         Scalar3 dx = cur_pos - lambda * last_pos;
@@ -74,13 +76,26 @@ __global__ void gpu_nlist_needs_update_check_new_kernel(unsigned int* d_result,
         const Scalar delta_max = (rmax * lambda_min - rmin) / Scalar(2.0);
         Scalar maxshiftsq = (delta_max > 0) ? delta_max * delta_max : 0.0f;
 
-        if (dot(dx, dx) >= maxshiftsq)
+        moved = dot(dx, dx) >= maxshiftsq;
+        }
+
+    // reduce the result over the block so that at most one system-scope atomic is issued
+    // per block (the flag lives in host-resident managed memory)
+    __shared__ int s_moved;
+    if (threadIdx.x == 0)
+        s_moved = 0;
+    __syncthreads();
+
+    if (moved)
+        s_moved = 1;
+    __syncthreads();
+
+    if (threadIdx.x == 0 && s_moved)
 #if (__CUDA_ARCH__ >= 600)
-            atomicMax_system(d_result, checkn);
+        atomicMax_system(d_result, checkn);
 #else
-            atomicMax(d_result, checkn);
+        atomicMax(d_result, checkn);
 #endif
-        }
     }
 
 hipError_t gpu_nlist_needs_update_check_new(unsigned int* d_result,
@@ -171,8 +186,8 @@ __global__ void gpu_nlist_filter_kernel(unsigned int* d_n_neigh,
     if (idx >= N)
         return;
 
-    const unsigned int n_neigh = d_n_neigh[idx];
-    const unsigned int n_ex = d_n_ex[idx];
+    const unsigned int n_neigh = __ldg(d_n_neigh + idx);
+    const unsigned int n_ex = __ldg(d_n_ex + idx);
     unsigned int new_n_neigh = 0;
 
     // quit now if the ex_start flag is past the end of n_ex
@@ -267,6 +282,115 @@ hipError_t gpu_nlist_filter(unsigned int* d_n_neigh,
     }
 
 //! GPU kernel to update the exclusions list
+/*! \param d_nlist Neighbor list to sort
+    \param d_rsq Scratch space for one distance per neighbor list entry
+    \param d_head_list Indexes of the first neighbor of each particle in \a d_nlist
+    \param d_n_neigh Number of neighbors of each particle
+    \param d_pos Particle positions
+    \param box Simulation box
+    \param N Number of particles
+
+    gpu_nlist_sort_by_distance_kernel() reorders each row of \a d_nlist in ascending order of
+   build-time distance. Ordered rows cluster the entries beyond a consumer's cutoff at the tail of
+   the row, so the threads cooperating on one particle in the pair force kernels pass or fail the
+   cutoff test together instead of diverging, and consumers with a cutoff smaller than the list
+   radius can stop at the first out-of-range entry.
+
+    \b Implementation
+
+    One thread is run for each particle. The minimum image distance of every neighbor is computed
+   once into the \a d_rsq scratch row, then the row is insertion sorted in place with the distances
+   carried alongside. The shift uses a strict comparison so that equidistant neighbors keep the
+   build order, matching the stable host sort. The quadratic sort is acceptable here because rows
+   are short and the kernel only runs on rebuild steps.
+*/
+__global__ void gpu_nlist_sort_by_distance_kernel(unsigned int* d_nlist,
+                                                  Scalar* d_rsq,
+                                                  const size_t* d_head_list,
+                                                  const unsigned int* d_n_neigh,
+                                                  const Scalar4* d_pos,
+                                                  const BoxDim box,
+                                                  const unsigned int N)
+    {
+    // compute the particle index this thread operates on
+    const unsigned int idx = blockDim.x * blockIdx.x + threadIdx.x;
+
+    // quit now if this thread is processing past the end of the particle list
+    if (idx >= N)
+        return;
+
+    const unsigned int n_neigh = __ldg(d_n_neigh + idx);
+    if (n_neigh < 2)
+        return;
+
+    const size_t my_head = d_head_list[idx];
+    const Scalar4 postype_i = __ldg(d_pos + idx);
+    const Scalar3 pos_i = make_scalar3(postype_i.x, postype_i.y, postype_i.z);
+
+    // compute each neighbor's distance once
+    for (unsigned int cur_neigh_idx = 0; cur_neigh_idx < n_neigh; cur_neigh_idx++)
+        {
+        const unsigned int cur_neigh = d_nlist[my_head + cur_neigh_idx];
+        const Scalar4 postype_j = __ldg(d_pos + cur_neigh);
+        const Scalar3 pos_j = make_scalar3(postype_j.x, postype_j.y, postype_j.z);
+        const Scalar3 dx = box.minImage(pos_i - pos_j);
+        d_rsq[my_head + cur_neigh_idx] = dot(dx, dx);
+        }
+
+    // insertion sort the row by distance, carrying the neighbor indices along
+    for (unsigned int cur_neigh_idx = 1; cur_neigh_idx < n_neigh; cur_neigh_idx++)
+        {
+        const Scalar rsq = d_rsq[my_head + cur_neigh_idx];
+        const unsigned int cur_neigh = d_nlist[my_head + cur_neigh_idx];
+
+        unsigned int insert_idx = cur_neigh_idx;
+        while (insert_idx > 0 && rsq < d_rsq[my_head + insert_idx - 1])
+            {
+            d_rsq[my_head + insert_idx] = d_rsq[my_head + insert_idx - 1];
+            d_nlist[my_head + insert_idx] = d_nlist[my_head + insert_idx - 1];
+            insert_idx--;
+            }
+
+        d_rsq[my_head + insert_idx] = rsq;
+        d_nlist[my_head + insert_idx] = cur_neigh;
+        }
+    }
+
+hipError_t gpu_nlist_sort_by_distance(unsigned int* d_nlist,
+                                      Scalar* d_rsq,
+                                      const size_t* d_head_list,
+                                      const unsigned int* d_n_neigh,
+                                      const Scalar4* d_pos,
+                                      const BoxDim& box,
+                                      const unsigned int N,
+                                      const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_nlist_sort_by_distance_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+
+    // determine parameters for kernel launch
+    int n_blocks = N / run_block_size + 1;
+
+    hipLaunchKernelGGL((gpu_nlist_sort_by_distance_kernel),
+                       dim3(n_blocks),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       d_nlist,
+                       d_rsq,
+                       d_head_list,
+                       d_n_neigh,
+                       d_pos,
+                       box,
+                       N);
+
+    return hipSuccess;
+    }
+
 __global__ void gpu_update_exclusion_list_kernel(const unsigned int* tags,
                                                  const unsigned int* rtags,
                                                  const unsigned int* n_ex_tag,
@@ -366,7 +490,7 @@ __global__ void gpu_nlist_init_head_list_kernel(size_t* d_head_list,
     if (idx >= N)
         return;
 
-    const Scalar4 postype_i = d_pos[idx];
+    const Scalar4 postype_i = __ldg(d_pos + idx);
     const unsigned int type_i = __scalar_as_int(postype_i.w);
     const unsigned int Nmax_i = __ldg(d_Nmax + type_i);
 
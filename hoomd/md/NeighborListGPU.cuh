@@ -45,6 +45,16 @@ hipError_t gpu_nlist_filter(unsigned int* d_n_neigh,
                             const unsigned int N,
                             const unsigned int block_size);
 
+//! Kernel driver for gpu_nlist_sort_by_distance_kernel()
+hipError_t gpu_nlist_sort_by_distance(unsigned int* d_nlist,
+                                      Scalar* d_rsq,
+                                      const size_t* d_head_list,
+                                      const unsigned int* d_n_neigh,
+                                      const Scalar4* d_pos,
+                                      const BoxDim& box,
+                                      const unsigned int N,
+                                      const unsigned int block_size);
+
 //! Kernel driver to build head list on gpu
 hipError_t gpu_nlist_build_head_list(size_t* d_head_list,
                                      size_t* d_req_size_nlist,
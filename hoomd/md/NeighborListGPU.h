@@ -66,6 +66,10 @@ class PYBIND11_EXPORT NeighborListGPU : public NeighborList
         m_storage_mode = full;
         m_checkn = 1;
 
+        // pad every per-type row allocation to a full warp (32 elements, 128 bytes) so that
+        // warp-wide neighbor reads in the pair force kernels are fully coalesced
+        setNmaxAlignment(32);
+
         // flag to say how big to resize
         GlobalArray<size_t> req_size_nlist(1, m_exec_conf);
         std::swap(m_req_size_nlist, req_size_nlist);
@@ -89,6 +93,13 @@ class PYBIND11_EXPORT NeighborListGPU : public NeighborList
                                               5,
                                               true));
         m_autotuners.push_back(m_tuner_filter);
+
+        m_tuner_sort.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                            m_exec_conf,
+                                            "nlist_sort_by_distance",
+                                            5,
+                                            true));
+        m_autotuners.push_back(m_tuner_sort);
         }
 
     //! Destructor
@@ -119,6 +130,9 @@ class PYBIND11_EXPORT NeighborListGPU : public NeighborList
     //! Filter the neighbor list of excluded particles
     virtual void filterNlist();
 
+    //! Sort each particle's neighbors by distance on the GPU
+    virtual void sortNlistByDistance();
+
     //! Build the head list for neighbor list indexing on the GPU
     virtual void buildHeadList();
 
@@ -130,6 +144,7 @@ class PYBIND11_EXPORT NeighborListGPU : public NeighborList
 
     private:
     std::shared_ptr<Autotuner<1>> m_tuner_filter; //!< Autotuner for filter block size
+    std::shared_ptr<Autotuner<1>> m_tuner_sort;   //!< Autotuner for distance sort block size
 
     GlobalArray<unsigned int>
         m_alt_head_list; //!< Alternate array to hold the head list from prefix sum
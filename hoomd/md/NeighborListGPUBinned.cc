@@ -42,6 +42,17 @@ NeighborListGPUBinned::NeighborListGPUBinned(std::shared_ptr<SystemDefinition> s
                                    "nlist_binned",
                                    3));
     m_autotuners.push_back(m_tuner);
+
+    // Tune the nominal cell width over 1x, 2/3x, and 1/2x of r_cut_max + r_buff (the
+    // parameter is the width in sixths of that distance). Narrower cells trade more
+    // cells for smaller candidate volumes, which can win in dense systems. The timed
+    // region spans the cell list build and the traversal kernel, so both costs enter
+    // the decision.
+    m_width_tuner.reset(new Autotuner<1>({std::vector<unsigned int>{6, 4, 3}},
+                                         m_exec_conf,
+                                         "nlist_binned_cell_width",
+                                         3));
+    m_autotuners.push_back(m_width_tuner);
     }
 
 NeighborListGPUBinned::~NeighborListGPUBinned() { }
@@ -54,11 +65,20 @@ void NeighborListGPUBinned::buildNlist(uint64_t timestep)
         }
 
     // update the cell list size if needed
-    if (m_update_cell_size)
+    m_width_tuner->begin();
+    unsigned int width_sixths = m_width_tuner->getParam()[0];
+
+    if (m_update_cell_size || width_sixths != m_width_sixths)
         {
         Scalar rmax = getMaxRCut() + m_r_buff;
 
-        m_cl->setNominalWidth(rmax);
+        m_cl->setNominalWidth(rmax * Scalar(width_sixths) / Scalar(6));
+
+        // widen the adjacency stencil so that its coverage stays at rmax when the
+        // cells shrink below the interaction range
+        m_cl->setRadius((6 + width_sixths - 1) / width_sixths);
+
+        m_width_sixths = width_sixths;
         m_update_cell_size = false;
         }
 
@@ -79,6 +99,9 @@ void NeighborListGPUBinned::buildNlist(uint64_t timestep)
     ArrayHandle<Scalar4> d_cell_xyzf(m_cl->getXYZFArray(),
                                      access_location::device,
                                      access_mode::read);
+    ArrayHandle<uint2> d_cell_xyzf_q(m_cl->getXYZFQArray(),
+                                     access_location::device,
+                                     access_mode::read);
     ArrayHandle<unsigned int> d_cell_idx(m_cl->getIndexArray(),
                                          access_location::device,
                                          access_mode::read);
@@ -135,6 +158,34 @@ void NeighborListGPUBinned::buildNlist(uint64_t timestep)
         CHECK_CUDA_ERROR();
 #endif
 
+    // traversal mode: 0 reads the xyzf entries, 1 reads the particle data through the
+    // index list, 2 reads the quantized compact entries
+    const unsigned int mode = m_use_index ? 1 : (m_compact_cell_data ? 2 : 0);
+
+    // decode constants and error bound for the quantized compact entries
+    Scalar3 q_scale = make_scalar3(0, 0, 0);
+    Scalar3 q_shift = make_scalar3(0, 0, 0);
+    Scalar q_slack(0.0);
+    if (mode == 2)
+        {
+        // the entries hold q = round(f * 65535) of the ghost-layer expanded fraction
+        // f = (f_global + ghost_frac) / (1 + 2 ghost_frac); fold the expansion into the
+        // decode so the kernel reconstructs the global fraction in one fma per axis
+        const Scalar3 ghost_frac = m_cl->getGhostWidth() / box.getNearestPlaneDistance();
+        q_scale = (make_scalar3(1, 1, 1) + Scalar(2.0) * ghost_frac) / Scalar(65535.0);
+        q_shift = ghost_frac;
+
+        // one-sided Cartesian bound on the quantization error: half a quantum per
+        // fractional axis mapped through the (possibly tilted) box, with headroom for
+        // the roundoff of the decode arithmetic
+        const Scalar3 eps = Scalar(0.5) * q_scale * box.getL();
+        const Scalar ex = eps.x + std::fabs(box.getTiltFactorXY()) * eps.y
+                          + std::fabs(box.getTiltFactorXZ()) * eps.z;
+        const Scalar ey = eps.y + std::fabs(box.getTiltFactorYZ()) * eps.z;
+        const Scalar ez = eps.z;
+        q_slack = Scalar(1.05) * slow::sqrt(ex * ex + ey * ey + ez * ez);
+        }
+
     m_exec_conf->beginMultiGPU();
 
     m_tuner->begin();
@@ -154,6 +205,7 @@ void NeighborListGPUBinned::buildNlist(uint64_t timestep)
         m_pdata->getN(),
         m_cl->getPerDevice() ? d_cell_size_per_device.data : d_cell_size.data,
         d_cell_xyzf.data,
+        d_cell_xyzf_q.data,
         m_cl->getPerDevice() ? d_cell_idx_per_device.data : d_cell_idx.data,
         d_cell_type_body.data,
         d_cell_adj.data,
@@ -168,8 +220,12 @@ void NeighborListGPUBinned::buildNlist(uint64_t timestep)
         block_size,
         m_filter_body,
         m_cl->getGhostWidth(),
+        q_scale,
+        q_shift,
+        q_slack,
         m_pdata->getGPUPartition(),
-        m_use_index,
+        mode,
+        m_sysdef->getNDimensions() == 2,
         m_exec_conf->dev_prop);
 
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
@@ -177,6 +233,8 @@ void NeighborListGPUBinned::buildNlist(uint64_t timestep)
     m_tuner->end();
 
     m_exec_conf->endMultiGPU();
+
+    m_width_tuner->end();
     }
 
 namespace detail
@@ -190,6 +248,9 @@ void export_NeighborListGPUBinned(pybind11::module& m)
         .def_property("deterministic",
                       &NeighborListGPUBinned::getDeterministic,
                       &NeighborListGPUBinned::setDeterministic)
+        .def_property("compact_cell_data",
+                      &NeighborListGPUBinned::getCompactCellData,
+                      &NeighborListGPUBinned::setCompactCellData)
         .def("getDim",
              &NeighborListGPUBinned::getDim,
              pybind11::return_value_policy::reference_internal)
@@ -22,6 +22,10 @@ namespace kernel
 //! Kernel call for generating neighbor list on the GPU (Kepler optimized version)
 /*! \tparam filter_body true when body filtering is enabled.
     \tparam enable_shared_cache true when the shared memory cache should be used.
+    \tparam two_d true when the system is 2D: the z cell dimension and z distance
+            arithmetic are eliminated at compile time.
+    \tparam use_index 0 to read the xyzf entries, 1 for indirect lookup of the particle
+            data through the index list, 2 to read the quantized compact entries.
     \param d_nlist Neighbor list data structure to write
     \param d_n_neigh Number of neighbors to write
     \param d_last_updated_pos Particle positions at this update are written to this array
@@ -33,6 +37,7 @@ namespace kernel
     \param N Number of particles
     \param d_cell_size Number of particles in each cell
     \param d_cell_xyzf Cell contents (xyzf array from CellList with flag=type)
+    \param d_cell_xyzf_q Cell contents quantized to 16-bit fractions plus type
     \param d_cell_idx Cell contents (particle indices)
     \param d_cell_type_body Cell contents (TypeBody array from CellList with)
     \param d_cell_adj Cell adjacency list
@@ -44,6 +49,9 @@ namespace kernel
     \param r_buff The maximum radius for which to include particles as neighbors
     \param ntypes Number of particle types
     \param ghost_width Width of ghost cell layer
+    \param q_scale Per-axis scale decoding the quantized fractions to box fractions
+    \param q_shift Per-axis shift decoding the quantized fractions to box fractions
+    \param q_slack Upper bound on the Cartesian quantization error of a decoded position
     \param offset Starting particle index
     \param nwork Number of particles to process
 
@@ -52,6 +60,7 @@ namespace kernel
 template<unsigned char filter_body,
          unsigned char enable_shared_cache,
          int use_index,
+         unsigned char two_d,
          int threads_per_particle>
 __global__ void gpu_compute_nlist_binned_kernel(unsigned int* d_nlist,
                                                 unsigned int* d_n_neigh,
@@ -64,6 +73,7 @@ __global__ void gpu_compute_nlist_binned_kernel(unsigned int* d_nlist,
                                                 const unsigned int N,
                                                 const unsigned int* d_cell_size,
                                                 const Scalar4* d_cell_xyzf,
+                                                const uint2* d_cell_xyzf_q,
                                                 const unsigned int* d_cell_idx,
                                                 const uint2* d_cell_type_body,
                                                 const unsigned int* d_cell_adj,
@@ -75,6 +85,9 @@ __global__ void gpu_compute_nlist_binned_kernel(unsigned int* d_nlist,
                                                 const Scalar r_buff,
                                                 const unsigned int ntypes,
                                                 const Scalar3 ghost_width,
+                                                const Scalar3 q_scale,
+                                                const Scalar3 q_shift,
+                                                const Scalar q_slack,
                                                 const unsigned int offset,
                                                 const unsigned int nwork,
                                                 const unsigned int ngpu)
@@ -96,7 +109,7 @@ __global__ void gpu_compute_nlist_binned_kernel(unsigned int* d_nlist,
             {
             if (cur_offset + threadIdx.x < num_typ_parameters)
                 {
-                Scalar r_cut = d_r_cut[cur_offset + threadIdx.x];
+                Scalar r_cut = __ldg(d_r_cut + cur_offset + threadIdx.x);
                 // force the r_list(i,j) to a skippable value if r_cut(i,j) is skippable
                 s_r_list[cur_offset + threadIdx.x]
                     = (r_cut > Scalar(0.0)) ? r_cut + r_buff : Scalar(-1.0);
@@ -117,19 +130,19 @@ __global__ void gpu_compute_nlist_binned_kernel(unsigned int* d_nlist,
     // get particle index
     my_pidx += offset;
 
-    Scalar4 my_postype = d_pos[my_pidx];
+    Scalar4 my_postype = __ldg(d_pos + my_pidx);
     Scalar3 my_pos = make_scalar3(my_postype.x, my_postype.y, my_postype.z);
 
     unsigned int my_type = __scalar_as_int(my_postype.w);
-    unsigned int my_body = d_body[my_pidx];
+    unsigned int my_body = __ldg(d_body + my_pidx);
     size_t my_head = d_head_list[my_pidx];
 
     Scalar3 f = box.makeFraction(my_pos, ghost_width);
 
-    // find the bin each particle belongs in
+    // find the bin each particle belongs in (2D has a single cell along z)
     int ib = (int)(f.x * ci.getW());
     int jb = (int)(f.y * ci.getH());
-    int kb = (int)(f.z * ci.getD());
+    int kb = two_d ? 0 : (int)(f.z * ci.getD());
 
     uchar3 periodic = box.getPeriodic();
 
@@ -138,7 +151,7 @@ __global__ void gpu_compute_nlist_binned_kernel(unsigned int* d_nlist,
         ib = 0;
     if (jb == ci.getH() && periodic.y)
         jb = 0;
-    if (kb == ci.getD() && periodic.z)
+    if (!two_d && kb == ci.getD() && periodic.z)
         kb = 0;
 
     int my_cell = ci(ib, jb, kb);
@@ -163,6 +176,9 @@ __global__ void gpu_compute_nlist_binned_kernel(unsigned int* d_nlist,
     // total number of neighbors
     unsigned int nneigh = 0;
 
+    // register stack for coalescing writes into chunks of 4 (used when threads_per_particle == 1)
+    unsigned int stack[4];
+
     unsigned int my_n_max = __ldg(d_Nmax + my_type);
 
     while (!done)
@@ -201,20 +217,30 @@ __global__ void gpu_compute_nlist_binned_kernel(unsigned int* d_nlist,
             Scalar4 cur_xyzf;
             unsigned int j;
             Scalar4 postype_j;
+            uint2 cur_q;
+            const unsigned int cell_slot = cli(cur_offset, neigh_cell);
             if (!use_index)
-                cur_xyzf = __ldg(d_cell_xyzf + cli(cur_offset, neigh_cell));
-            else
+                cur_xyzf = __ldg(d_cell_xyzf + cell_slot);
+            else if (use_index == 1)
                 {
-                j = __ldg(d_cell_idx + cli(cur_offset, neigh_cell) + igpu * cli.getNumElements());
-                postype_j = d_pos[j];
+                j = __ldg(d_cell_idx + cell_slot + igpu * cli.getNumElements());
+                postype_j = __ldg(d_pos + j);
                 cur_xyzf = make_scalar4(postype_j.x, postype_j.y, postype_j.z, __int_as_scalar(j));
                 }
+            else
+                {
+                // compact mode: 8 bytes of quantized fractional coordinates plus the type;
+                // the particle index is resolved only for accepted candidates
+                cur_q = __ldg(d_cell_xyzf_q + cell_slot);
+                }
 
             uint2 cur_type_body;
             if (!use_index)
-                cur_type_body = __ldg(d_cell_type_body + cli(cur_offset, neigh_cell));
-            else
+                cur_type_body = __ldg(d_cell_type_body + cell_slot);
+            else if (use_index == 1)
                 cur_type_body = make_uint2(__scalar_as_int(postype_j.w), __ldg(d_body + j));
+            else
+                cur_type_body = make_uint2(cur_q.y >> 16, 0);
 
             // advance cur_offset
             cur_offset += threads_per_particle;
@@ -230,7 +256,7 @@ __global__ void gpu_compute_nlist_binned_kernel(unsigned int* d_nlist,
                 }
             else
                 {
-                Scalar r_cut = d_r_cut[typpair_idx(my_type, neigh_type)];
+                Scalar r_cut = __ldg(d_r_cut + typpair_idx(my_type, neigh_type));
                 // force the r_list(i,j) to a skippable value if r_cut(i,j) is skippable
                 r_list = (r_cut > Scalar(0.0)) ? r_cut + r_buff : Scalar(-1.0);
                 }
@@ -239,53 +265,119 @@ __global__ void gpu_compute_nlist_binned_kernel(unsigned int* d_nlist,
                 {
                 unsigned int neigh_body = cur_type_body.y;
 
-                Scalar3 neigh_pos = make_scalar3(cur_xyzf.x, cur_xyzf.y, cur_xyzf.z);
-                int cur_neigh = __scalar_as_int(cur_xyzf.w);
+                Scalar3 neigh_pos;
+                if (use_index == 2)
+                    {
+                    // reconstruct the position from the quantized fractions;
+                    // makeCoordinates() inverts the makeFraction() value the entries
+                    // were encoded from
+                    const Scalar3 fq
+                        = make_scalar3(Scalar(cur_q.x & 0xffff) * q_scale.x - q_shift.x,
+                                       Scalar(cur_q.x >> 16) * q_scale.y - q_shift.y,
+                                       Scalar(cur_q.y & 0xffff) * q_scale.z - q_shift.z);
+                    neigh_pos = box.makeCoordinates(fq);
+                    }
+                else
+                    neigh_pos = make_scalar3(cur_xyzf.x, cur_xyzf.y, cur_xyzf.z);
 
                 // compute the distance between the two particles
                 Scalar3 dx = my_pos - neigh_pos;
 
+                // all particles sit at z=0 in 2D, so the z terms fold away
+                if (two_d)
+                    dx.z = Scalar(0.0);
+
                 // wrap the periodic boundary conditions
                 dx = box.minImage(dx);
 
                 // compute dr squared
                 Scalar drsq = dot(dx, dx);
 
-                bool excluded = (my_pidx == cur_neigh);
-
-                if (filter_body && my_body != 0xffffffff)
-                    excluded = excluded | (my_body == neigh_body);
+                // the quantization error is covered by widening the acceptance radius;
+                // the list is a conservative superset either way and the pair potentials
+                // apply the exact cutoff
+                Scalar r_check = (use_index == 2) ? r_list + q_slack : r_list;
 
-                // store result in shared memory
-                if (drsq <= r_list * r_list && !excluded)
+                if (drsq <= r_check * r_check)
                     {
-                    neighbor = cur_neigh;
-                    has_neighbor = 1;
+                    // resolve the candidate identity; in compact mode this read happens
+                    // only for accepted candidates
+                    int cur_neigh;
+                    if (use_index == 2)
+                        cur_neigh = (int)__ldg(d_cell_idx + cell_slot);
+                    else
+                        cur_neigh = __scalar_as_int(cur_xyzf.w);
+
+                    bool excluded = (my_pidx == cur_neigh);
+
+                    if (filter_body && my_body != 0xffffffff)
+                        {
+                        if (use_index == 2)
+                            neigh_body = __ldg(d_body + cur_neigh);
+                        excluded = excluded | (my_body == neigh_body);
+                        }
+
+                    // store result in shared memory
+                    if (!excluded)
+                        {
+                        neighbor = cur_neigh;
+                        has_neighbor = 1;
+                        }
                     }
                 }
             }
 
-        // now that possible neighbor checks are finished, done (for the cta) depends only on first
-        // thread neighbor list only needs to get written into if thread 0 is not done
-        done = hoomd::detail::WarpScan<bool, threads_per_particle>().Broadcast(done, 0);
-        if (!done)
+        if (threads_per_particle == 1)
+            {
+            // serial append: stage neighbors in the register stack and write them out in
+            // 128-bit chunks, as in NeighborListGPUTree.cu. Nmax is kept at a multiple of 4,
+            // so every row of d_nlist starts on a 16-byte boundary.
+            if (has_neighbor)
+                {
+                if (nneigh < my_n_max)
+                    {
+                    const unsigned int offset = nneigh % 4;
+                    stack[offset] = neighbor;
+                    if (offset == 3)
+                        {
+                        reinterpret_cast<uint4*>(d_nlist)[(my_head + nneigh) / 4]
+                            = make_uint4(stack[0], stack[1], stack[2], stack[3]);
+                        }
+                    }
+                nneigh++;
+                }
+            }
+        else
             {
-            // scan over flags
-            unsigned char k(0), n(0);
-            hoomd::detail::WarpScan<unsigned char, threads_per_particle>().ExclusiveSum(
-                has_neighbor,
-                k,
-                n);
-
-            // write neighbor if it fits in list
-            if (has_neighbor && (nneigh + k) < my_n_max)
-                d_nlist[my_head + nneigh + k] = neighbor;
-
-            // increment total neighbor count
-            nneigh += n;
+            // now that possible neighbor checks are finished, done (for the cta) depends only on
+            // first thread neighbor list only needs to get written into if thread 0 is not done
+            done = hoomd::detail::WarpScan<bool, threads_per_particle>().Broadcast(done, 0);
+            if (!done)
+                {
+                // scan over flags
+                unsigned char k(0), n(0);
+                hoomd::detail::WarpScan<unsigned char, threads_per_particle>().ExclusiveSum(
+                    has_neighbor,
+                    k,
+                    n);
+
+                // write neighbor if it fits in list
+                if (has_neighbor && (nneigh + k) < my_n_max)
+                    d_nlist[my_head + nneigh + k] = neighbor;
+
+                // increment total neighbor count
+                nneigh += n;
+                }
             }
         } // end while
 
+    // write the partial (leftover) stack; entries past nneigh are never read
+    if (threads_per_particle == 1 && nneigh < my_n_max && nneigh % 4 != 0)
+        {
+        reinterpret_cast<uint4*>(d_nlist)[(my_head + nneigh - 1) / 4]
+            = make_uint4(stack[0], stack[1], stack[2], stack[3]);
+        }
+
     if (threadIdx.x % threads_per_particle == 0)
         {
         // flag if we need to grow the neighbor list
@@ -309,8 +401,9 @@ template<typename T> int get_max_block_size(T func)
     }
 
 //! recursive template to launch neighborlist with given template parameters
-/* \tparam cur_tpp Number of threads per particle (assumed to be power of two) */
-template<int cur_tpp>
+/* \tparam cur_tpp Number of threads per particle (assumed to be power of two)
+   \tparam two_d 1 when the system is 2D */
+template<int cur_tpp, unsigned char two_d>
 inline void launcher(unsigned int* d_nlist,
                      unsigned int* d_n_neigh,
                      Scalar4* d_last_updated_pos,
@@ -322,6 +415,7 @@ inline void launcher(unsigned int* d_nlist,
                      const unsigned int N,
                      const unsigned int* d_cell_size,
                      const Scalar4* d_cell_xyzf,
+                     const uint2* d_cell_xyzf_q,
                      const unsigned int* d_cell_idx,
                      const uint2* d_cell_type_body,
                      const unsigned int* d_cell_adj,
@@ -333,11 +427,14 @@ inline void launcher(unsigned int* d_nlist,
                      const Scalar r_buff,
                      const unsigned int ntypes,
                      const Scalar3 ghost_width,
+                     const Scalar3 q_scale,
+                     const Scalar3 q_shift,
+                     const Scalar q_slack,
                      unsigned int tpp,
                      bool filter_body,
                      unsigned int block_size,
                      std::pair<unsigned int, unsigned int> range,
-                     bool use_index,
+                     unsigned int mode,
                      const unsigned int ngpu,
                      const hipDeviceProp_t& devprop)
     {
@@ -358,18 +455,18 @@ inline void launcher(unsigned int* d_nlist,
 
     if (tpp == cur_tpp && cur_tpp != 0)
         {
-        if (!use_index)
+        if (mode == 0)
             {
             if (!filter_body && !enable_shared)
                 {
                 unsigned int max_block_size;
                 max_block_size
-                    = get_max_block_size(gpu_compute_nlist_binned_kernel<0, 0, 0, cur_tpp>);
+                    = get_max_block_size(gpu_compute_nlist_binned_kernel<0, 0, 0, two_d, cur_tpp>);
 
                 block_size = block_size < max_block_size ? block_size : max_block_size;
                 dim3 grid(nwork / (block_size / tpp) + 1);
 
-                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<0, 0, 0, cur_tpp>),
+                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<0, 0, 0, two_d, cur_tpp>),
                                    dim3(grid),
                                    dim3(block_size),
                                    shared_size,
@@ -385,6 +482,7 @@ inline void launcher(unsigned int* d_nlist,
                                    N,
                                    d_cell_size,
                                    d_cell_xyzf,
+                                   d_cell_xyzf_q,
                                    d_cell_idx,
                                    d_cell_type_body,
                                    d_cell_adj,
@@ -396,6 +494,9 @@ inline void launcher(unsigned int* d_nlist,
                                    r_buff,
                                    ntypes,
                                    ghost_width,
+                                   q_scale,
+                                   q_shift,
+                                   q_slack,
                                    offset,
                                    nwork,
                                    ngpu);
@@ -404,12 +505,12 @@ inline void launcher(unsigned int* d_nlist,
                 {
                 unsigned int max_block_size;
                 max_block_size
-                    = get_max_block_size(gpu_compute_nlist_binned_kernel<1, 0, 0, cur_tpp>);
+                    = get_max_block_size(gpu_compute_nlist_binned_kernel<1, 0, 0, two_d, cur_tpp>);
 
                 block_size = block_size < max_block_size ? block_size : max_block_size;
                 dim3 grid(nwork / (block_size / tpp) + 1);
 
-                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<1, 0, 0, cur_tpp>),
+                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<1, 0, 0, two_d, cur_tpp>),
                                    dim3(grid),
                                    dim3(block_size),
                                    shared_size,
@@ -425,6 +526,7 @@ inline void launcher(unsigned int* d_nlist,
                                    N,
                                    d_cell_size,
                                    d_cell_xyzf,
+                                   d_cell_xyzf_q,
                                    d_cell_idx,
                                    d_cell_type_body,
                                    d_cell_adj,
@@ -436,6 +538,9 @@ inline void launcher(unsigned int* d_nlist,
                                    r_buff,
                                    ntypes,
                                    ghost_width,
+                                   q_scale,
+                                   q_shift,
+                                   q_slack,
                                    offset,
                                    nwork,
                                    ngpu);
@@ -444,12 +549,12 @@ inline void launcher(unsigned int* d_nlist,
                 {
                 unsigned int max_block_size;
                 max_block_size
-                    = get_max_block_size(gpu_compute_nlist_binned_kernel<0, 1, 0, cur_tpp>);
+                    = get_max_block_size(gpu_compute_nlist_binned_kernel<0, 1, 0, two_d, cur_tpp>);
 
                 block_size = block_size < max_block_size ? block_size : max_block_size;
                 dim3 grid(nwork / (block_size / tpp) + 1);
 
-                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<0, 1, 0, cur_tpp>),
+                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<0, 1, 0, two_d, cur_tpp>),
                                    dim3(grid),
                                    dim3(block_size),
                                    shared_size,
@@ -465,6 +570,7 @@ inline void launcher(unsigned int* d_nlist,
                                    N,
                                    d_cell_size,
                                    d_cell_xyzf,
+                                   d_cell_xyzf_q,
                                    d_cell_idx,
                                    d_cell_type_body,
                                    d_cell_adj,
@@ -476,6 +582,9 @@ inline void launcher(unsigned int* d_nlist,
                                    r_buff,
                                    ntypes,
                                    ghost_width,
+                                   q_scale,
+                                   q_shift,
+                                   q_slack,
                                    offset,
                                    nwork,
                                    ngpu);
@@ -484,12 +593,12 @@ inline void launcher(unsigned int* d_nlist,
                 {
                 unsigned int max_block_size;
                 max_block_size
-                    = get_max_block_size(gpu_compute_nlist_binned_kernel<1, 1, 0, cur_tpp>);
+                    = get_max_block_size(gpu_compute_nlist_binned_kernel<1, 1, 0, two_d, cur_tpp>);
 
                 block_size = block_size < max_block_size ? block_size : max_block_size;
                 dim3 grid(nwork / (block_size / tpp) + 1);
 
-                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<1, 1, 0, cur_tpp>),
+                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<1, 1, 0, two_d, cur_tpp>),
                                    dim3(grid),
                                    dim3(block_size),
                                    shared_size,
@@ -505,6 +614,7 @@ inline void launcher(unsigned int* d_nlist,
                                    N,
                                    d_cell_size,
                                    d_cell_xyzf,
+                                   d_cell_xyzf_q,
                                    d_cell_idx,
                                    d_cell_type_body,
                                    d_cell_adj,
@@ -516,23 +626,26 @@ inline void launcher(unsigned int* d_nlist,
                                    r_buff,
                                    ntypes,
                                    ghost_width,
+                                   q_scale,
+                                   q_shift,
+                                   q_slack,
                                    offset,
                                    nwork,
                                    ngpu);
                 }
             }
-        else // use_index
+        else if (mode == 1)
             {
             if (!filter_body && !enable_shared)
                 {
                 unsigned int max_block_size;
                 max_block_size
-                    = get_max_block_size(gpu_compute_nlist_binned_kernel<0, 0, 1, cur_tpp>);
+                    = get_max_block_size(gpu_compute_nlist_binned_kernel<0, 0, 1, two_d, cur_tpp>);
 
                 block_size = block_size < max_block_size ? block_size : max_block_size;
                 dim3 grid(nwork / (block_size / tpp) + 1);
 
-                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<0, 0, 1, cur_tpp>),
+                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<0, 0, 1, two_d, cur_tpp>),
                                    dim3(grid),
                                    dim3(block_size),
                                    shared_size,
@@ -548,6 +661,7 @@ inline void launcher(unsigned int* d_nlist,
                                    N,
                                    d_cell_size,
                                    d_cell_xyzf,
+                                   d_cell_xyzf_q,
                                    d_cell_idx,
                                    d_cell_type_body,
                                    d_cell_adj,
@@ -559,6 +673,9 @@ inline void launcher(unsigned int* d_nlist,
                                    r_buff,
                                    ntypes,
                                    ghost_width,
+                                   q_scale,
+                                   q_shift,
+                                   q_slack,
                                    offset,
                                    nwork,
                                    ngpu);
@@ -567,12 +684,12 @@ inline void launcher(unsigned int* d_nlist,
                 {
                 unsigned int max_block_size;
                 max_block_size
-                    = get_max_block_size(gpu_compute_nlist_binned_kernel<1, 0, 1, cur_tpp>);
+                    = get_max_block_size(gpu_compute_nlist_binned_kernel<1, 0, 1, two_d, cur_tpp>);
 
                 block_size = block_size < max_block_size ? block_size : max_block_size;
                 dim3 grid(nwork / (block_size / tpp) + 1);
 
-                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<1, 0, 1, cur_tpp>),
+                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<1, 0, 1, two_d, cur_tpp>),
                                    dim3(grid),
                                    dim3(block_size),
                                    shared_size,
@@ -588,6 +705,7 @@ inline void launcher(unsigned int* d_nlist,
                                    N,
                                    d_cell_size,
                                    d_cell_xyzf,
+                                   d_cell_xyzf_q,
                                    d_cell_idx,
                                    d_cell_type_body,
                                    d_cell_adj,
@@ -599,6 +717,9 @@ inline void launcher(unsigned int* d_nlist,
                                    r_buff,
                                    ntypes,
                                    ghost_width,
+                                   q_scale,
+                                   q_shift,
+                                   q_slack,
                                    offset,
                                    nwork,
                                    ngpu);
@@ -607,12 +728,12 @@ inline void launcher(unsigned int* d_nlist,
                 {
                 unsigned int max_block_size;
                 max_block_size
-                    = get_max_block_size(gpu_compute_nlist_binned_kernel<0, 1, 1, cur_tpp>);
+                    = get_max_block_size(gpu_compute_nlist_binned_kernel<0, 1, 1, two_d, cur_tpp>);
 
                 block_size = block_size < max_block_size ? block_size : max_block_size;
                 dim3 grid(nwork / (block_size / tpp) + 1);
 
-                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<0, 1, 1, cur_tpp>),
+                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<0, 1, 1, two_d, cur_tpp>),
                                    dim3(grid),
                                    dim3(block_size),
                                    shared_size,
@@ -628,6 +749,7 @@ inline void launcher(unsigned int* d_nlist,
                                    N,
                                    d_cell_size,
                                    d_cell_xyzf,
+                                   d_cell_xyzf_q,
                                    d_cell_idx,
                                    d_cell_type_body,
                                    d_cell_adj,
@@ -639,6 +761,9 @@ inline void launcher(unsigned int* d_nlist,
                                    r_buff,
                                    ntypes,
                                    ghost_width,
+                                   q_scale,
+                                   q_shift,
+                                   q_slack,
                                    offset,
                                    nwork,
                                    ngpu);
@@ -647,12 +772,12 @@ inline void launcher(unsigned int* d_nlist,
                 {
                 unsigned int max_block_size;
                 max_block_size
-                    = get_max_block_size(gpu_compute_nlist_binned_kernel<1, 1, 1, cur_tpp>);
+                    = get_max_block_size(gpu_compute_nlist_binned_kernel<1, 1, 1, two_d, cur_tpp>);
 
                 block_size = block_size < max_block_size ? block_size : max_block_size;
                 dim3 grid(nwork / (block_size / tpp) + 1);
 
-                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<1, 1, 1, cur_tpp>),
+                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<1, 1, 1, two_d, cur_tpp>),
                                    dim3(grid),
                                    dim3(block_size),
                                    shared_size,
@@ -668,6 +793,7 @@ inline void launcher(unsigned int* d_nlist,
                                    N,
                                    d_cell_size,
                                    d_cell_xyzf,
+                                   d_cell_xyzf_q,
                                    d_cell_idx,
                                    d_cell_type_body,
                                    d_cell_adj,
@@ -679,6 +805,188 @@ inline void launcher(unsigned int* d_nlist,
                                    r_buff,
                                    ntypes,
                                    ghost_width,
+                                   q_scale,
+                                   q_shift,
+                                   q_slack,
+                                   offset,
+                                   nwork,
+                                   ngpu);
+                }
+            }
+        else // quantized compact entries (mode == 2)
+            {
+            if (!filter_body && !enable_shared)
+                {
+                unsigned int max_block_size;
+                max_block_size
+                    = get_max_block_size(gpu_compute_nlist_binned_kernel<0, 0, 2, two_d, cur_tpp>);
+
+                block_size = block_size < max_block_size ? block_size : max_block_size;
+                dim3 grid(nwork / (block_size / tpp) + 1);
+
+                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<0, 0, 2, two_d, cur_tpp>),
+                                   dim3(grid),
+                                   dim3(block_size),
+                                   shared_size,
+                                   0,
+                                   d_nlist,
+                                   d_n_neigh,
+                                   d_last_updated_pos,
+                                   d_conditions,
+                                   d_Nmax,
+                                   d_head_list,
+                                   d_pos,
+                                   d_body,
+                                   N,
+                                   d_cell_size,
+                                   d_cell_xyzf,
+                                   d_cell_xyzf_q,
+                                   d_cell_idx,
+                                   d_cell_type_body,
+                                   d_cell_adj,
+                                   ci,
+                                   cli,
+                                   cadji,
+                                   box,
+                                   d_r_cut,
+                                   r_buff,
+                                   ntypes,
+                                   ghost_width,
+                                   q_scale,
+                                   q_shift,
+                                   q_slack,
+                                   offset,
+                                   nwork,
+                                   ngpu);
+                }
+            else if (filter_body && !enable_shared)
+                {
+                unsigned int max_block_size;
+                max_block_size
+                    = get_max_block_size(gpu_compute_nlist_binned_kernel<1, 0, 2, two_d, cur_tpp>);
+
+                block_size = block_size < max_block_size ? block_size : max_block_size;
+                dim3 grid(nwork / (block_size / tpp) + 1);
+
+                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<1, 0, 2, two_d, cur_tpp>),
+                                   dim3(grid),
+                                   dim3(block_size),
+                                   shared_size,
+                                   0,
+                                   d_nlist,
+                                   d_n_neigh,
+                                   d_last_updated_pos,
+                                   d_conditions,
+                                   d_Nmax,
+                                   d_head_list,
+                                   d_pos,
+                                   d_body,
+                                   N,
+                                   d_cell_size,
+                                   d_cell_xyzf,
+                                   d_cell_xyzf_q,
+                                   d_cell_idx,
+                                   d_cell_type_body,
+                                   d_cell_adj,
+                                   ci,
+                                   cli,
+                                   cadji,
+                                   box,
+                                   d_r_cut,
+                                   r_buff,
+                                   ntypes,
+                                   ghost_width,
+                                   q_scale,
+                                   q_shift,
+                                   q_slack,
+                                   offset,
+                                   nwork,
+                                   ngpu);
+                }
+            else if (!filter_body && enable_shared)
+                {
+                unsigned int max_block_size;
+                max_block_size
+                    = get_max_block_size(gpu_compute_nlist_binned_kernel<0, 1, 2, two_d, cur_tpp>);
+
+                block_size = block_size < max_block_size ? block_size : max_block_size;
+                dim3 grid(nwork / (block_size / tpp) + 1);
+
+                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<0, 1, 2, two_d, cur_tpp>),
+                                   dim3(grid),
+                                   dim3(block_size),
+                                   shared_size,
+                                   0,
+                                   d_nlist,
+                                   d_n_neigh,
+                                   d_last_updated_pos,
+                                   d_conditions,
+                                   d_Nmax,
+                                   d_head_list,
+                                   d_pos,
+                                   d_body,
+                                   N,
+                                   d_cell_size,
+                                   d_cell_xyzf,
+                                   d_cell_xyzf_q,
+                                   d_cell_idx,
+                                   d_cell_type_body,
+                                   d_cell_adj,
+                                   ci,
+                                   cli,
+                                   cadji,
+                                   box,
+                                   d_r_cut,
+                                   r_buff,
+                                   ntypes,
+                                   ghost_width,
+                                   q_scale,
+                                   q_shift,
+                                   q_slack,
+                                   offset,
+                                   nwork,
+                                   ngpu);
+                }
+            else if (filter_body && enable_shared)
+                {
+                unsigned int max_block_size;
+                max_block_size
+                    = get_max_block_size(gpu_compute_nlist_binned_kernel<1, 1, 2, two_d, cur_tpp>);
+
+                block_size = block_size < max_block_size ? block_size : max_block_size;
+                dim3 grid(nwork / (block_size / tpp) + 1);
+
+                hipLaunchKernelGGL((gpu_compute_nlist_binned_kernel<1, 1, 2, two_d, cur_tpp>),
+                                   dim3(grid),
+                                   dim3(block_size),
+                                   shared_size,
+                                   0,
+                                   d_nlist,
+                                   d_n_neigh,
+                                   d_last_updated_pos,
+                                   d_conditions,
+                                   d_Nmax,
+                                   d_head_list,
+                                   d_pos,
+                                   d_body,
+                                   N,
+                                   d_cell_size,
+                                   d_cell_xyzf,
+                                   d_cell_xyzf_q,
+                                   d_cell_idx,
+                                   d_cell_type_body,
+                                   d_cell_adj,
+                                   ci,
+                                   cli,
+                                   cadji,
+                                   box,
+                                   d_r_cut,
+                                   r_buff,
+                                   ntypes,
+                                   ghost_width,
+                                   q_scale,
+                                   q_shift,
+                                   q_slack,
                                    offset,
                                    nwork,
                                    ngpu);
@@ -687,7 +995,7 @@ inline void launcher(unsigned int* d_nlist,
         }
     else
         {
-        launcher<cur_tpp / 2>(d_nlist,
+        launcher<cur_tpp / 2, two_d>(d_nlist,
                               d_n_neigh,
                               d_last_updated_pos,
                               d_conditions,
@@ -698,6 +1006,7 @@ inline void launcher(unsigned int* d_nlist,
                               N,
                               d_cell_size,
                               d_cell_xyzf,
+                              d_cell_xyzf_q,
                               d_cell_idx,
                               d_cell_type_body,
                               d_cell_adj,
@@ -709,11 +1018,14 @@ inline void launcher(unsigned int* d_nlist,
                               r_buff,
                               ntypes,
                               ghost_width,
+                              q_scale,
+                              q_shift,
+                              q_slack,
                               tpp,
                               filter_body,
                               block_size,
                               range,
-                              use_index,
+                              mode,
                               ngpu,
                               devprop);
         }
@@ -721,35 +1033,76 @@ inline void launcher(unsigned int* d_nlist,
 
 //! template specialization to terminate recursion
 template<>
-inline void launcher<min_threads_per_particle / 2>(unsigned int* d_nlist,
-                                                   unsigned int* d_n_neigh,
-                                                   Scalar4* d_last_updated_pos,
-                                                   unsigned int* d_conditions,
-                                                   const unsigned int* d_Nmax,
-                                                   const size_t* d_head_list,
-                                                   const Scalar4* d_pos,
-                                                   const unsigned int* d_body,
-                                                   const unsigned int N,
-                                                   const unsigned int* d_cell_size,
-                                                   const Scalar4* d_cell_xyzf,
-                                                   const unsigned int* d_cell_idx,
-                                                   const uint2* d_cell_type_body,
-                                                   const unsigned int* d_cell_adj,
-                                                   const Index3D ci,
-                                                   const Index2D cli,
-                                                   const Index2D cadji,
-                                                   const BoxDim box,
-                                                   const Scalar* d_r_cut,
-                                                   const Scalar r_buff,
-                                                   const unsigned int ntypes,
-                                                   const Scalar3 ghost_width,
-                                                   unsigned int tpp,
-                                                   bool filter_body,
-                                                   unsigned int block_size,
-                                                   std::pair<unsigned int, unsigned int> range,
-                                                   bool use_index,
-                                                   const unsigned int ngpu,
-                                                   const hipDeviceProp_t& devprop)
+inline void launcher<min_threads_per_particle / 2, 0>(unsigned int* d_nlist,
+                                                      unsigned int* d_n_neigh,
+                                                      Scalar4* d_last_updated_pos,
+                                                      unsigned int* d_conditions,
+                                                      const unsigned int* d_Nmax,
+                                                      const size_t* d_head_list,
+                                                      const Scalar4* d_pos,
+                                                      const unsigned int* d_body,
+                                                      const unsigned int N,
+                                                      const unsigned int* d_cell_size,
+                                                      const Scalar4* d_cell_xyzf,
+                                                      const uint2* d_cell_xyzf_q,
+                                                      const unsigned int* d_cell_idx,
+                                                      const uint2* d_cell_type_body,
+                                                      const unsigned int* d_cell_adj,
+                                                      const Index3D ci,
+                                                      const Index2D cli,
+                                                      const Index2D cadji,
+                                                      const BoxDim box,
+                                                      const Scalar* d_r_cut,
+                                                      const Scalar r_buff,
+                                                      const unsigned int ntypes,
+                                                      const Scalar3 ghost_width,
+                                                      const Scalar3 q_scale,
+                                                      const Scalar3 q_shift,
+                                                      const Scalar q_slack,
+                                                      unsigned int tpp,
+                                                      bool filter_body,
+                                                      unsigned int block_size,
+                                                      std::pair<unsigned int, unsigned int> range,
+                                                      unsigned int mode,
+                                                      const unsigned int ngpu,
+                                                      const hipDeviceProp_t& devprop)
+    {
+    }
+
+template<>
+inline void launcher<min_threads_per_particle / 2, 1>(unsigned int* d_nlist,
+                                                      unsigned int* d_n_neigh,
+                                                      Scalar4* d_last_updated_pos,
+                                                      unsigned int* d_conditions,
+                                                      const unsigned int* d_Nmax,
+                                                      const size_t* d_head_list,
+                                                      const Scalar4* d_pos,
+                                                      const unsigned int* d_body,
+                                                      const unsigned int N,
+                                                      const unsigned int* d_cell_size,
+                                                      const Scalar4* d_cell_xyzf,
+                                                      const uint2* d_cell_xyzf_q,
+                                                      const unsigned int* d_cell_idx,
+                                                      const uint2* d_cell_type_body,
+                                                      const unsigned int* d_cell_adj,
+                                                      const Index3D ci,
+                                                      const Index2D cli,
+                                                      const Index2D cadji,
+                                                      const BoxDim box,
+                                                      const Scalar* d_r_cut,
+                                                      const Scalar r_buff,
+                                                      const unsigned int ntypes,
+                                                      const Scalar3 ghost_width,
+                                                      const Scalar3 q_scale,
+                                                      const Scalar3 q_shift,
+                                                      const Scalar q_slack,
+                                                      unsigned int tpp,
+                                                      bool filter_body,
+                                                      unsigned int block_size,
+                                                      std::pair<unsigned int, unsigned int> range,
+                                                      unsigned int mode,
+                                                      const unsigned int ngpu,
+                                                      const hipDeviceProp_t& devprop)
     {
     }
 
@@ -764,6 +1117,7 @@ hipError_t gpu_compute_nlist_binned(unsigned int* d_nlist,
                                     const unsigned int N,
                                     const unsigned int* d_cell_size,
                                     const Scalar4* d_cell_xyzf,
+                                    const uint2* d_cell_xyzf_q,
                                     const unsigned int* d_cell_idx,
                                     const uint2* d_cell_type_body,
                                     const unsigned int* d_cell_adj,
@@ -778,8 +1132,12 @@ hipError_t gpu_compute_nlist_binned(unsigned int* d_nlist,
                                     const unsigned int block_size,
                                     bool filter_body,
                                     const Scalar3& ghost_width,
+                                    const Scalar3& q_scale,
+                                    const Scalar3& q_shift,
+                                    const Scalar q_slack,
                                     const GPUPartition& gpu_partition,
-                                    bool use_index,
+                                    unsigned int mode,
+                                    bool two_d,
                                     const hipDeviceProp_t& devprop)
     {
     unsigned int ngpu = gpu_partition.getNumActiveGPUs();
@@ -789,35 +1147,78 @@ hipError_t gpu_compute_nlist_binned(unsigned int* d_nlist,
         {
         auto range = gpu_partition.getRangeAndSetGPU(idev);
 
-        launcher<max_threads_per_particle>(d_nlist,
-                                           d_n_neigh,
-                                           d_last_updated_pos,
-                                           d_conditions,
-                                           d_Nmax,
-                                           d_head_list,
-                                           d_pos,
-                                           d_body,
-                                           N,
-                                           d_cell_size,
-                                           d_cell_xyzf,
-                                           d_cell_idx,
-                                           d_cell_type_body,
-                                           d_cell_adj,
-                                           ci,
-                                           cli,
-                                           cadji,
-                                           box,
-                                           d_r_cut,
-                                           r_buff,
-                                           ntypes,
-                                           ghost_width,
-                                           threads_per_particle,
-                                           filter_body,
-                                           block_size,
-                                           range,
-                                           use_index,
-                                           ngpu,
-                                           devprop);
+        if (two_d)
+            {
+            launcher<max_threads_per_particle, 1>(d_nlist,
+                                                  d_n_neigh,
+                                                  d_last_updated_pos,
+                                                  d_conditions,
+                                                  d_Nmax,
+                                                  d_head_list,
+                                                  d_pos,
+                                                  d_body,
+                                                  N,
+                                                  d_cell_size,
+                                                  d_cell_xyzf,
+                                                  d_cell_xyzf_q,
+                                                  d_cell_idx,
+                                                  d_cell_type_body,
+                                                  d_cell_adj,
+                                                  ci,
+                                                  cli,
+                                                  cadji,
+                                                  box,
+                                                  d_r_cut,
+                                                  r_buff,
+                                                  ntypes,
+                                                  ghost_width,
+                                                  q_scale,
+                                                  q_shift,
+                                                  q_slack,
+                                                  threads_per_particle,
+                                                  filter_body,
+                                                  block_size,
+                                                  range,
+                                                  mode,
+                                                  ngpu,
+                                                  devprop);
+            }
+        else
+            {
+            launcher<max_threads_per_particle, 0>(d_nlist,
+                                                  d_n_neigh,
+                                                  d_last_updated_pos,
+                                                  d_conditions,
+                                                  d_Nmax,
+                                                  d_head_list,
+                                                  d_pos,
+                                                  d_body,
+                                                  N,
+                                                  d_cell_size,
+                                                  d_cell_xyzf,
+                                                  d_cell_xyzf_q,
+                                                  d_cell_idx,
+                                                  d_cell_type_body,
+                                                  d_cell_adj,
+                                                  ci,
+                                                  cli,
+                                                  cadji,
+                                                  box,
+                                                  d_r_cut,
+                                                  r_buff,
+                                                  ntypes,
+                                                  ghost_width,
+                                                  q_scale,
+                                                  q_shift,
+                                                  q_slack,
+                                                  threads_per_particle,
+                                                  filter_body,
+                                                  block_size,
+                                                  range,
+                                                  mode,
+                                                  ngpu,
+                                                  devprop);
+            }
         }
     return hipSuccess;
     }
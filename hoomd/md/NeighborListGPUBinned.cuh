@@ -43,6 +43,7 @@ hipError_t gpu_compute_nlist_binned(unsigned int* d_nlist,
                                     const unsigned int N,
                                     const unsigned int* d_cell_size,
                                     const Scalar4* d_cell_xyzf,
+                                    const uint2* d_cell_xyzf_q,
                                     const unsigned int* d_cell_idx,
                                     const uint2* d_cell_type_body,
                                     const unsigned int* d_cell_adj,
@@ -57,8 +58,12 @@ hipError_t gpu_compute_nlist_binned(unsigned int* d_nlist,
                                     const unsigned int block_size,
                                     bool filter_body,
                                     const Scalar3& ghost_width,
+                                    const Scalar3& q_scale,
+                                    const Scalar3& q_shift,
+                                    const Scalar q_slack,
                                     const GPUPartition& gpu_partition,
-                                    bool use_index,
+                                    unsigned int mode,
+                                    bool two_d,
                                     const hipDeviceProp_t& devprop);
 
     } // end namespace kernel
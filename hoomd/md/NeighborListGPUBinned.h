@@ -58,6 +58,28 @@ class PYBIND11_EXPORT NeighborListGPUBinned : public NeighborListGPU
         return m_cl->getSortCellList();
         }
 
+    /// Request that the traversal read quantized compact cell data
+    /*! The compact entries hold 16-bit fixed-point coordinates plus the type in 8
+        bytes, halving the bytes streamed per candidate; the quantization error is
+        absorbed by widening the acceptance radius, so the list stays a conservative
+        superset. Takes effect only in the xyzf configuration; with unified memory
+        the build reads the particle data directly and the flag is ignored.
+    */
+    void setCompactCellData(bool compact)
+        {
+        m_compact_cell_data = compact;
+        m_cl->setComputeXYZFQ(compact && !m_use_index);
+
+        // accepted candidates are resolved through the index list
+        m_cl->setComputeIdx(m_use_index || compact);
+        }
+
+    /// Get the compact cell data flag
+    bool getCompactCellData()
+        {
+        return m_compact_cell_data;
+        }
+
     /// Get the dimensions of the cell list
     const uint3& getDim() const
         {
@@ -94,8 +116,17 @@ class PYBIND11_EXPORT NeighborListGPUBinned : public NeighborListGPU
     /// Track when the cell size needs to be updated
     bool m_update_cell_size = true;
 
+    /// True when the traversal should read the quantized compact cell data
+    bool m_compact_cell_data = false;
+
     std::shared_ptr<Autotuner<2>> m_tuner; //!< Autotuner for block size and threads per particle
 
+    /// Autotuner for the nominal cell width, in sixths of r_cut_max + r_buff
+    std::shared_ptr<Autotuner<1>> m_width_tuner;
+
+    /// Cell width currently applied to the cell list, in sixths of r_cut_max + r_buff
+    unsigned int m_width_sixths = 6;
+
     //! Builds the neighbor list
     virtual void buildNlist(uint64_t timestep);
     };
@@ -91,7 +91,7 @@ __global__ void gpu_compute_nlist_stencil_kernel(unsigned int* d_nlist,
         {
         if (cur_offset + threadIdx.x < num_typ_parameters)
             {
-            Scalar r_cut = d_r_cut[cur_offset + threadIdx.x];
+            Scalar r_cut = __ldg(d_r_cut + cur_offset + threadIdx.x);
             // force the r_list(i,j) to a skippable value if r_cut(i,j) is skippable
             s_r_list[cur_offset + threadIdx.x]
                 = (r_cut > Scalar(0.0)) ? r_cut + r_buff : Scalar(-1.0);
@@ -115,11 +115,11 @@ __global__ void gpu_compute_nlist_stencil_kernel(unsigned int* d_nlist,
     // get the write particle id
     int my_pidx = d_pid_map[idx];
 
-    Scalar4 my_postype = d_pos[my_pidx];
+    Scalar4 my_postype = __ldg(d_pos + my_pidx);
     Scalar3 my_pos = make_scalar3(my_postype.x, my_postype.y, my_postype.z);
 
     unsigned int my_type = __scalar_as_int(my_postype.w);
-    unsigned int my_body = d_body[my_pidx];
+    unsigned int my_body = __ldg(d_body + my_pidx);
     size_t my_head = d_head_list[my_pidx];
 
     Scalar3 f = box.makeFraction(my_pos, ghost_width);
@@ -564,7 +564,7 @@ __global__ void gpu_compute_nlist_stencil_fill_types_kernel(unsigned int* d_pids
     if (idx >= N)
         return;
 
-    Scalar4 pos_i = d_pos[idx];
+    Scalar4 pos_i = __ldg(d_pos + idx);
     unsigned int type = __scalar_as_int(pos_i.w);
     d_types[idx] = type;
     d_pids[idx] = idx;
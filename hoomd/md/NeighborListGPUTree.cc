@@ -107,6 +107,9 @@ void NeighborListGPUTree::buildNlist(uint64_t timestep)
             GPUArray<unsigned int> type_last(m_pdata->getNTypes(), m_exec_conf);
             m_type_last.swap(type_last);
 
+            GPUArray<const unsigned int*> type_primitives(m_pdata->getNTypes(), m_exec_conf);
+            m_type_primitives.swap(type_primitives);
+
             m_lbvhs.resize(m_pdata->getNTypes());
             m_traversers.resize(m_pdata->getNTypes());
             m_streams.resize(m_pdata->getNTypes());
@@ -416,37 +419,58 @@ void NeighborListGPUTree::buildTree()
         // put particles in primitive order for traversal and compress the lbvhs so that the data is
         // ready for traversal
         {
+            // gather the per-type primitive pointers so a single launch can reorder all types
+            {
+            ArrayHandle<const unsigned int*> h_type_primitives(m_type_primitives,
+                                                               access_location::host,
+                                                               access_mode::overwrite);
+            for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+                {
+                h_type_primitives.data[i]
+                    = (m_lbvhs[i]->getN() > 0) ? m_lbvhs[i]->getPrimitives() : NULL;
+                }
+            }
+
+            {
+            ArrayHandle<unsigned int> d_traverse_order(m_traverse_order,
+                                                       access_location::device,
+                                                       access_mode::overwrite);
+            ArrayHandle<unsigned int> d_sorted_indexes(m_sorted_indexes,
+                                                       access_location::device,
+                                                       access_mode::read);
+            ArrayHandle<const unsigned int*> d_type_primitives(m_type_primitives,
+                                                               access_location::device,
+                                                               access_mode::read);
+            ArrayHandle<unsigned int> d_type_first(m_type_first,
+                                                   access_location::device,
+                                                   access_mode::read);
+            ArrayHandle<unsigned int> d_sorted_types(m_sorted_types,
+                                                     access_location::device,
+                                                     access_mode::read);
+
+            // each thread resolves its type segment from the sorted types, so the number of
+            // launches here is independent of the number of types
+            m_copy_tuner->begin();
+            kernel::gpu_nlist_copy_primitives_batched(d_traverse_order.data,
+                                                      d_sorted_indexes.data,
+                                                      d_type_primitives.data,
+                                                      d_type_first.data,
+                                                      d_sorted_types.data,
+                                                      m_pdata->getNTypes(),
+                                                      m_pdata->getN() + m_pdata->getNGhosts(),
+                                                      m_copy_tuner->getParam()[0]);
+            if (m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+            m_copy_tuner->end();
+            }
+
         ArrayHandle<unsigned int> h_type_first(m_type_first,
                                                access_location::host,
                                                access_mode::read);
-        ArrayHandle<unsigned int> d_traverse_order(m_traverse_order,
-                                                   access_location::device,
-                                                   access_mode::overwrite);
         ArrayHandle<unsigned int> d_sorted_indexes(m_sorted_indexes,
                                                    access_location::device,
                                                    access_mode::read);
 
-        for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
-            {
-            const unsigned int Ni = m_lbvhs[i]->getN();
-            if (Ni > 0)
-                {
-                const unsigned int first = h_type_first.data[i];
-                auto d_primitives = m_lbvhs[i]->getPrimitives();
-                m_copy_tuner->begin();
-                kernel::gpu_nlist_copy_primitives(d_traverse_order.data + first,
-                                                  d_sorted_indexes.data + first,
-                                                  d_primitives,
-                                                  Ni,
-                                                  m_copy_tuner->getParam()[0]);
-                if (m_exec_conf->isCUDAErrorCheckingEnabled())
-                    CHECK_CUDA_ERROR();
-                m_copy_tuner->end();
-                }
-            }
-
-        // loops are not fused to avoid streams or syncing in kernel loop above, but could be done
-        // if necessary
         hipDeviceSynchronize();
         for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
             {
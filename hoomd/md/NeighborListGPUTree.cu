@@ -337,6 +337,89 @@ hipError_t gpu_nlist_copy_primitives(unsigned int* d_traverse_order,
     return hipSuccess;
     }
 
+//! Kernel to rearrange the primitives of all types in one launch
+/*!
+ * \param d_traverse_order List of particle indexes in traversal order.
+ * \param d_indexes Original indexes of the sorted primitives.
+ * \param d_primitives_by_type Per-type pointers to the primitives (NULL for empty types).
+ * \param d_type_first First index of each type in the sorted arrays.
+ * \param d_types Sorted particle types.
+ * \param ntypes Number of particle types.
+ * \param N Total number of sorted particles, including ghosts.
+ *
+ * One thread per sorted particle. Each thread resolves its type segment from the sorted
+ * type array, so all per-type copies complete in a single launch regardless of the number
+ * of types. Out-of-bounds ghosts carry the type sentinel and are skipped.
+ */
+__global__ void gpu_nlist_copy_primitives_batched_kernel(unsigned int* d_traverse_order,
+                                                         const unsigned int* d_indexes,
+                                                         const unsigned int* const* d_primitives_by_type,
+                                                         const unsigned int* d_type_first,
+                                                         const unsigned int* d_types,
+                                                         const unsigned int ntypes,
+                                                         const unsigned int N)
+    {
+    // one thread per particle
+    const unsigned int idx = blockDim.x * blockIdx.x + threadIdx.x;
+    if (idx >= N)
+        return;
+
+    const unsigned int type = d_types[idx];
+    if (type >= ntypes)
+        return;
+
+    const unsigned int* d_primitives = d_primitives_by_type[type];
+    if (d_primitives == NULL)
+        return;
+
+    const unsigned int first = __ldg(d_type_first + type);
+    const unsigned int primitive = d_primitives[idx - first];
+    d_traverse_order[idx] = __ldg(d_indexes + first + primitive);
+    }
+
+/*!
+ * \param d_traverse_order List of particle indexes in traversal order.
+ * \param d_indexes Original indexes of the sorted primitives.
+ * \param d_primitives_by_type Per-type pointers to the primitives (NULL for empty types).
+ * \param d_type_first First index of each type in the sorted arrays.
+ * \param d_types Sorted particle types.
+ * \param ntypes Number of particle types.
+ * \param N Total number of sorted particles, including ghosts.
+ * \param block_size Number of CUDA threads per block.
+ *
+ * \sa gpu_nlist_copy_primitives_batched_kernel
+ */
+hipError_t gpu_nlist_copy_primitives_batched(unsigned int* d_traverse_order,
+                                             const unsigned int* d_indexes,
+                                             const unsigned int* const* d_primitives_by_type,
+                                             const unsigned int* d_type_first,
+                                             const unsigned int* d_types,
+                                             const unsigned int ntypes,
+                                             const unsigned int N,
+                                             const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr,
+                         reinterpret_cast<const void*>(gpu_nlist_copy_primitives_batched_kernel));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    int run_block_size = min(block_size, max_block_size);
+    hipLaunchKernelGGL(gpu_nlist_copy_primitives_batched_kernel,
+                       dim3(N / run_block_size + 1),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       d_traverse_order,
+                       d_indexes,
+                       d_primitives_by_type,
+                       d_type_first,
+                       d_types,
+                       ntypes,
+                       N);
+    return hipSuccess;
+    }
+
 /////////////////////////////////////
 // neighbor program and wrappers
 /////////////////////////////////////
@@ -67,6 +67,16 @@ hipError_t gpu_nlist_copy_primitives(unsigned int* d_traverse_order,
                                      const unsigned int N,
                                      const unsigned int block_size);
 
+//! Kernel driver to rearrange the primitives of all types in one launch
+hipError_t gpu_nlist_copy_primitives_batched(unsigned int* d_traverse_order,
+                                             const unsigned int* d_indexes,
+                                             const unsigned int* const* d_primitives_by_type,
+                                             const unsigned int* d_type_first,
+                                             const unsigned int* d_types,
+                                             const unsigned int ntypes,
+                                             const unsigned int N,
+                                             const unsigned int block_size);
+
 //! Wrapper around the neighbor::LBVH class
 /*!
  * This wrapper only exposes data types that are natively supported in HOOMD
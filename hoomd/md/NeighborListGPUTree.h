@@ -66,6 +66,8 @@ class PYBIND11_EXPORT NeighborListGPUTree : public NeighborListGPU
     unsigned int m_type_bits;            //!< Number of bits to sort based on largest type index
     GPUArray<unsigned int> m_type_first; //!< First index of each particle type in sorted list
     GPUArray<unsigned int> m_type_last;  //!< Last index of each particle type in sorted list
+    GPUArray<const unsigned int*>
+        m_type_primitives; //!< Per-type primitive pointers for the batched reorder kernel
 
     GPUFlags<unsigned int> m_lbvh_errors; //!< Error flags during particle marking (e.g., off rank)
     std::vector<std::unique_ptr<kernel::LBVHWrapper>> m_lbvhs; //!< Array of LBVHs per-type
@@ -45,11 +45,54 @@ NeighborListStencil::~NeighborListStencil()
 
 void NeighborListStencil::updateRStencil()
     {
+    ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
     ArrayHandle<Scalar> h_rcut_max(m_rcut_max, access_location::host, access_mode::read);
-    std::vector<Scalar> rstencil(m_pdata->getNTypes(), -1.0);
-    for (unsigned int cur_type = 0; cur_type < m_pdata->getNTypes(); ++cur_type)
+    const unsigned int ntypes = m_pdata->getNTypes();
+
+    // Classify the types into size classes, using the self cutoff as a proxy for the particle
+    // size. In strongly asymmetric mixtures (e.g. nanoparticles in solvent) the cross cutoff
+    // would otherwise force a huge stencil onto the abundant small types. Pairs that span the
+    // classes are searched only from the large partner (see buildNlist()), so each type only
+    // needs a stencil that reaches its partners of the same or a smaller class.
+    m_type_class.assign(ntypes, 0);
+    m_asymmetric = false;
+    Scalar min_self = Scalar(-1.0);
+    Scalar max_self = Scalar(-1.0);
+    for (unsigned int cur_type = 0; cur_type < ntypes; ++cur_type)
+        {
+        Scalar rcut_ii = h_r_cut.data[m_typpair_idx(cur_type, cur_type)];
+        if (rcut_ii <= Scalar(0.0))
+            continue;
+        if (min_self < Scalar(0.0) || rcut_ii < min_self)
+            min_self = rcut_ii;
+        if (rcut_ii > max_self)
+            max_self = rcut_ii;
+        }
+    if (min_self > Scalar(0.0) && max_self > asymmetry_ratio * min_self)
+        {
+        m_asymmetric = true;
+        for (unsigned int cur_type = 0; cur_type < ntypes; ++cur_type)
+            {
+            Scalar rcut_ii = h_r_cut.data[m_typpair_idx(cur_type, cur_type)];
+            m_type_class[cur_type] = (rcut_ii > asymmetry_ratio * min_self) ? 1 : 0;
+            }
+        }
+
+    std::vector<Scalar> rstencil(ntypes, -1.0);
+    for (unsigned int cur_type = 0; cur_type < ntypes; ++cur_type)
         {
         Scalar rcut = h_rcut_max.data[cur_type];
+        if (m_asymmetric)
+            {
+            // only reach the pairs this type searches itself
+            rcut = Scalar(-1.0);
+            for (unsigned int other_type = 0; other_type < ntypes; ++other_type)
+                {
+                if (m_type_class[other_type] > m_type_class[cur_type])
+                    continue;
+                rcut = std::max(rcut, h_r_cut.data[m_typpair_idx(cur_type, other_type)]);
+                }
+            }
         if (rcut > Scalar(0.0))
             {
             Scalar rlist = rcut + m_r_buff;
@@ -96,6 +139,11 @@ void NeighborListStencil::buildNlist(uint64_t timestep)
     const BoxDim& box = m_pdata->getBox();
     Scalar3 nearest_plane_distance = box.getNearestPlaneDistance();
 
+    // particles must be binned against the same box the cell list used, which is the
+    // lattice-reduced box when the tilt factors have accumulated beyond 1/2
+    const BoxDim& bin_box = m_cl->getBinningBox();
+    const bool bin_reduced = m_cl->isBinningReduced();
+
     // validate that the cutoff fits inside the box
     Scalar rmax = getMaxRCut() + m_r_buff;
 
@@ -155,19 +203,44 @@ void NeighborListStencil::buildNlist(uint64_t timestep)
     // for each local particle
     unsigned int nparticles = m_pdata->getN();
 
-    for (int i = 0; i < (int)nparticles; i++)
+    // neighbor counts double as append cursors because cross-class pairs are written into the
+    // lists of both partners as they are found
+    memset(h_n_neigh.data, 0, sizeof(unsigned int) * nparticles);
+
+    // in asymmetric mode ghost particles of the large class also search, so that cross-class
+    // pairs with a local small particle are found even though the small partner does not reach
+    unsigned int n_search = nparticles;
+    if (m_asymmetric)
+        n_search += m_pdata->getNGhosts();
+
+    for (int i = 0; i < (int)n_search; i++)
         {
-        unsigned int cur_n_neigh = 0;
+        const bool local_i = i < (int)nparticles;
 
         const Scalar3 my_pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
         const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
         const unsigned int body_i = h_body.data[i];
+        const unsigned int class_i = m_asymmetric ? m_type_class[type_i] : 0;
+
+        // ghosts of the small class never store into a local list, skip them entirely
+        if (!local_i && class_i == 0)
+            continue;
 
         const unsigned int Nmax_i = h_Nmax.data[type_i];
-        const size_t head_idx_i = h_head_list.data[i];
+        const size_t head_idx_i = local_i ? h_head_list.data[i] : 0;
 
         // find the bin each particle belongs in
-        Scalar3 f = box.makeFraction(my_pos, ghost_width);
+        Scalar3 f = bin_box.makeFraction(my_pos, ghost_width);
+        if (bin_reduced)
+            {
+            // positions are wrapped into the global box, fold them into the reduced one
+            if (periodic.x)
+                f.x -= std::floor(f.x);
+            if (periodic.y)
+                f.y -= std::floor(f.y);
+            if (periodic.z)
+                f.z -= std::floor(f.z);
+            }
         int ib = (unsigned int)(f.x * dim.x);
         int jb = (unsigned int)(f.y * dim.y);
         int kb = (unsigned int)(f.z * dim.z);
@@ -180,6 +253,20 @@ void NeighborListStencil::buildNlist(uint64_t timestep)
         if (kb == (int)dim.z && periodic.z)
             kb = 0;
 
+        // ghost particles at the outer edge of the ghost layer can round just past the grid
+        if (ib < 0)
+            ib = 0;
+        else if (ib >= (int)dim.x)
+            ib = dim.x - 1;
+        if (jb < 0)
+            jb = 0;
+        else if (jb >= (int)dim.y)
+            jb = dim.y - 1;
+        if (kb < 0)
+            kb = 0;
+        else if (kb >= (int)dim.z)
+            kb = dim.z - 1;
+
         // loop through all neighboring bins
         unsigned int n_stencil = h_n_stencil.data[type_i];
         for (unsigned int cur_stencil = 0; cur_stencil < n_stencil; ++cur_stencil)
@@ -251,6 +338,19 @@ void NeighborListStencil::buildNlist(uint64_t timestep)
                 if (m_filter_body && body_i != NO_BODY && body_i == body_j)
                     continue;
 
+                // pairs that span the size classes are searched only by the large partner
+                bool cross = false;
+                if (m_asymmetric)
+                    {
+                    const unsigned int class_j = m_type_class[type_j];
+                    if (class_j > class_i)
+                        continue;
+                    cross = class_j < class_i;
+                    // ghost searchers only contribute cross pairs with local particles
+                    if (!local_i && !cross)
+                        continue;
+                    }
+
                 // read cutoff and skip if pair is inactive
                 Scalar r_cut = h_r_cut.data[m_typpair_idx(type_i, type_j)];
                 if (r_cut <= Scalar(0.0))
@@ -281,24 +381,44 @@ void NeighborListStencil::buildNlist(uint64_t timestep)
 
                 if (dr_sq <= r_listsq)
                     {
-                    if (m_storage_mode == full || i < (int)cur_neigh)
+                    if (cross)
+                        {
+                        // the small partner never finds this pair itself, store it for both
+                        if (local_i)
+                            {
+                            const unsigned int slot = h_n_neigh.data[i]++;
+                            if (slot < Nmax_i)
+                                h_nlist.data[head_idx_i + slot] = cur_neigh;
+                            else
+                                h_conditions.data[type_i]
+                                    = max(h_conditions.data[type_i], slot + 1);
+                            }
+                        if (cur_neigh < nparticles
+                            && (m_storage_mode == full || !local_i))
+                            {
+                            const unsigned int slot = h_n_neigh.data[cur_neigh]++;
+                            if (slot < h_Nmax.data[type_j])
+                                h_nlist.data[h_head_list.data[cur_neigh] + slot]
+                                    = (unsigned int)i;
+                            else
+                                h_conditions.data[type_j]
+                                    = max(h_conditions.data[type_j], slot + 1);
+                            }
+                        }
+                    else if (m_storage_mode == full || i < (int)cur_neigh)
                         {
                         // local neighbor
-                        if (cur_n_neigh < Nmax_i)
+                        const unsigned int slot = h_n_neigh.data[i]++;
+                        if (slot < Nmax_i)
                             {
-                            h_nlist.data[head_idx_i + cur_n_neigh] = cur_neigh;
+                            h_nlist.data[head_idx_i + slot] = cur_neigh;
                             }
                         else
-                            h_conditions.data[type_i]
-                                = max(h_conditions.data[type_i], cur_n_neigh + 1);
-
-                        ++cur_n_neigh;
+                            h_conditions.data[type_i] = max(h_conditions.data[type_i], slot + 1);
                         }
                     }
                 }
             }
-
-        h_n_neigh.data[i] = cur_n_neigh;
         }
     }
 
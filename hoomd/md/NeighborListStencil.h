@@ -25,6 +25,11 @@ namespace md
 //! Efficient neighbor list build on the CPU with multiple bin stencils
 /*! Implements the O(N) neighbor list build on the CPU using a cell list with multiple bin stencils.
 
+    When the self cutoffs of the types span more than a factor of asymmetry_ratio, the types are
+    split into two size classes and pairs that span the classes are searched only from the large
+    partner. Abundant small types then keep the small stencil of their own class instead of
+    inheriting the huge search volume of the large types.
+
     \sa CellListStencil
     \ingroup computes
 */
@@ -82,6 +87,12 @@ class PYBIND11_EXPORT NeighborListStencil : public NeighborList
     /// Track when the cell size needs to be updated
     bool m_update_cell_size = true;
 
+    std::vector<unsigned int> m_type_class; //!< Size class of each type (0 = small, 1 = large)
+    bool m_asymmetric = false;              //!< True when the types span two size classes
+
+    /// Types form two size classes when their self cutoffs differ by more than this factor
+    static constexpr Scalar asymmetry_ratio = Scalar(3.0);
+
     //! Update the stencil radius
     void updateRStencil();
     };
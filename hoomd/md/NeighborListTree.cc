@@ -63,6 +63,7 @@ void NeighborListTree::setupTree()
         m_map_pid_tree.resize(m_pdata->getMaxN());
 
         m_max_num_changed = false;
+        m_refit_allowed = false;
         }
 
     if (!m_types_allocated)
@@ -75,6 +76,7 @@ void NeighborListTree::setupTree()
 
         m_num_per_type.resize(m_pdata->getNTypes(), 0);
         m_type_head.resize(m_pdata->getNTypes(), 0);
+        m_build_surface_area.resize(m_pdata->getNTypes(), Scalar(0.0));
 
         slotRemapParticles();
 
@@ -85,6 +87,9 @@ void NeighborListTree::setupTree()
         {
         mapParticlesByType();
         m_remap_particles = false;
+
+        // the leaf particle assignments reference the old mapping, a refit would be incorrect
+        m_refit_allowed = false;
         }
 
     if (m_box_changed)
@@ -256,14 +261,31 @@ void NeighborListTree::buildTree()
         h_aabbs.data[my_aabb_idx] = hoomd::detail::AABB(my_pos, i);
         }
 
-    // call the tree build routine, one tree per type
+    // refit or rebuild each tree, one tree per type
+    //
+    // between sorts the particle-to-slot mapping is stable, so the node AABBs can be refit in
+    // place from the new particle positions without re-sorting the topology. The build-time
+    // partitioning degrades as particles mix, which shows up as node surface area growth; when
+    // the growth exceeds the quality threshold the topology is rebuilt from scratch.
     for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
         {
-        if (m_num_per_type[i] > 0)
+        if (m_num_per_type[i] == 0)
+            continue;
+
+        if (m_refit_allowed)
             {
-            m_aabb_trees[i].buildTree(&(h_aabbs.data[0]) + m_type_head[i], m_num_per_type[i]);
+            m_aabb_trees[i].refit(&(h_aabbs.data[0]) + m_type_head[i]);
+
+            if (m_aabb_trees[i].getTotalSurfaceArea()
+                <= m_max_quality_degradation * m_build_surface_area[i])
+                continue;
             }
+
+        m_aabb_trees[i].buildTree(&(h_aabbs.data[0]) + m_type_head[i], m_num_per_type[i]);
+        m_build_surface_area[i] = m_aabb_trees[i].getTotalSurfaceArea();
         }
+
+    m_refit_allowed = true;
     }
 
 /*!
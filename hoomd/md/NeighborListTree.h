@@ -79,6 +79,15 @@ class PYBIND11_EXPORT NeighborListTree : public NeighborList
     /// set to true when the type data has been allocated
     bool m_types_allocated;
 
+    /// set to true when the trees may be refit in place instead of rebuilt
+    bool m_refit_allowed = false;
+
+    /// node surface area of each tree at its last full (re)build
+    std::vector<Scalar> m_build_surface_area;
+
+    /// refit surface area growth ratio above which a tree topology is rebuilt
+    Scalar m_max_quality_degradation = Scalar(1.25);
+
     // we use stl vectors here because these tree data structures should *never* be
     // accessed on the GPU, they were optimized for the CPU with SIMD support
     std::vector<hoomd::detail::AABBTree> m_aabb_trees; //!< Flat array of AABB trees of all types
@@ -39,7 +39,8 @@ PPPMForceCompute::PPPMForceCompute(std::shared_ptr<SystemDefinition> sysdef,
       m_grid_dim(make_uint3(0, 0, 0)), m_ghost_width(make_scalar3(0, 0, 0)), m_ghost_offset(0),
       m_n_cells(0), m_radius(1), m_n_inner_cells(0), m_need_initialize(true), m_params_set(false),
       m_box_changed(false), m_q(0.0), m_q2(0.0), m_body_energy(0.0), m_ptls_added_removed(false),
-      m_kiss_fft_initialized(false), m_dfft_initialized(false)
+      m_kspace_solved(false), m_kspace_solve_timestep(0), m_kiss_fft_initialized(false),
+      m_dfft_initialized(false)
     {
     m_pdata->getBoxChangeSignal().connect<PPPMForceCompute, &PPPMForceCompute::setBoxChange>(this);
     // reset virial
@@ -1258,7 +1259,9 @@ Scalar PPPMForceCompute::computePE()
                                              access_mode::read);
     ArrayHandle<Scalar> h_inf_f(m_inf_f, access_location::host, access_mode::read);
 
-    Scalar sum(0.0);
+    // accumulate the single precision mesh values in double precision so that the mesh
+    // resolution, not the summation, limits the accuracy of the energy
+    double sum(0.0);
 
     bool exclude_dc = true;
 #ifdef ENABLE_MPI
@@ -1284,9 +1287,9 @@ Scalar PPPMForceCompute::computePE()
             }
         }
 
-    Scalar V = m_pdata->getGlobalBox().getVolume();
-    Scalar scale = Scalar(1.0) / ((Scalar)(m_global_dim.x * m_global_dim.y * m_global_dim.z));
-    sum *= Scalar(0.5) * V * scale * scale;
+    double V = m_pdata->getGlobalBox().getVolume();
+    double scale = 1.0 / ((double)(m_global_dim.x * m_global_dim.y * m_global_dim.z));
+    sum *= 0.5 * V * scale * scale;
 
     if (m_exec_conf->getRank() == 0)
         {
@@ -1304,25 +1307,25 @@ Scalar PPPMForceCompute::computePE()
     sum += m_body_energy;
 
     // store this rank's contribution as external potential energy
-    m_external_energy = sum;
+    m_external_energy = Scalar(sum);
 
 #ifdef ENABLE_MPI
     if (m_pdata->getDomainDecomposition())
         {
-        // reduce sum
+        // reduce sum in double precision
         MPI_Allreduce(MPI_IN_PLACE,
                       &sum,
                       1,
-                      MPI_HOOMD_SCALAR,
+                      MPI_DOUBLE,
                       MPI_SUM,
                       m_exec_conf->getMPICommunicator());
         }
 #endif
 
-    return sum;
+    return Scalar(sum);
     }
 
-void PPPMForceCompute::computeForces(uint64_t timestep)
+void PPPMForceCompute::solveKSpace()
     {
     if (m_need_initialize || m_ptls_added_removed)
         {
@@ -1372,6 +1375,37 @@ void PPPMForceCompute::computeForces(uint64_t timestep)
     assignParticles();
 
     updateMeshes();
+    }
+
+/*! \param timestep The time step the solve is started for
+ */
+void PPPMForceCompute::startKSpaceSolve(uint64_t timestep)
+    {
+    // only start once per step, and only when the matching compute() will actually run
+    if ((m_kspace_solved && m_kspace_solve_timestep == timestep) || !peekCompute(timestep))
+        return;
+
+    // respect the evaluation interval, as compute() does
+    if (m_eval_interval > 1 && !m_first_compute && !m_force_compute && !m_particles_sorted
+        && (timestep % m_eval_interval) != 0 && m_pdata->getFlags() == m_computed_flags)
+        return;
+
+    // account the solve to this compute's timer, as compute() does
+    int64_t start = m_clock.getTime();
+    solveKSpace();
+    m_compute_time += m_clock.getTime() - start;
+
+    m_kspace_solved = true;
+    m_kspace_solve_timestep = timestep;
+    }
+
+void PPPMForceCompute::computeForces(uint64_t timestep)
+    {
+    // pick up a solve started earlier this step, otherwise run it now
+    bool solved = m_kspace_solved && m_kspace_solve_timestep == timestep;
+    m_kspace_solved = false;
+    if (!solved)
+        solveKSpace();
 
     PDataFlags flags = this->m_pdata->getFlags();
     computePE();
@@ -1396,6 +1430,32 @@ void PPPMForceCompute::computeForces(uint64_t timestep)
         }
     }
 
+/*! \param timestep Current time step
+
+    On intermediate steps of the evaluation interval the k-space solve - and with it the
+    distributed FFT communication - is skipped, but the force meshes from the last solve are
+    re-interpolated at the current particle positions so that the slowly varying k-space field
+    follows the particles. The k-space energy and virial are held from the last solve.
+*/
+void PPPMForceCompute::refreshHeldForces(uint64_t timestep)
+    {
+    // without an up-to-date mesh there is nothing to interpolate from, keep the held forces
+    if (m_need_initialize || m_ptls_added_removed || m_box_changed)
+        return;
+
+    interpolateForces();
+
+    // the exclusion correction is position dependent, recompute it
+    if (m_nlist->getExclusionsSet())
+        {
+        m_nlist->compute(timestep);
+        fixExclusions();
+        }
+
+    // the per-particle energies changed with the re-interpolation
+    m_energy_sum_valid = false;
+    }
+
 void PPPMForceCompute::computeVirial()
     {
     ArrayHandle<kiss_fft_cpx> h_fourier_mesh(m_fourier_mesh,
@@ -1405,9 +1465,10 @@ void PPPMForceCompute::computeVirial()
     ArrayHandle<Scalar> h_inf_f(m_inf_f, access_location::host, access_mode::read);
     ArrayHandle<Scalar3> h_k(m_k, access_location::host, access_mode::read);
 
-    Scalar virial[6];
+    // accumulate in double precision, as in computePE()
+    double virial[6];
     for (unsigned int i = 0; i < 6; ++i)
-        virial[i] = Scalar(0.0);
+        virial[i] = 0.0;
 
     bool exclude_dc = true;
 #ifdef ENABLE_MPI
@@ -1445,13 +1506,13 @@ void PPPMForceCompute::computeVirial()
             }
         }
 
-    Scalar V = m_pdata->getGlobalBox().getVolume();
-    Scalar scale = Scalar(1.0) / ((Scalar)(m_global_dim.x * m_global_dim.y * m_global_dim.z));
+    double V = m_pdata->getGlobalBox().getVolume();
+    double scale = 1.0 / ((double)(m_global_dim.x * m_global_dim.y * m_global_dim.z));
 
     for (unsigned int k = 0; k < 6; ++k)
         {
         // store this rank's contribution in m_external_virial
-        m_external_virial[k] = Scalar(0.5) * virial[k] * V * scale * scale;
+        m_external_virial[k] = Scalar(0.5 * virial[k] * V * scale * scale);
         }
     }
 
@@ -47,6 +47,17 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
 
     void computeForces(uint64_t timestep);
 
+    //! Start the k-space solve ahead of the force pass
+    /*! \param timestep Time step the solve is requested for
+
+        Runs charge assignment, the FFTs and the reciprocal space update now so that the
+        asynchronous portion of the work (mesh kernels and local FFTs on the GPU) executes
+        while the caller evaluates other forces. The matching compute() call at the same
+        \a timestep picks up the solved meshes and only performs the energy read-back and
+        force interpolation. When the solve was not started, compute() is unchanged.
+     */
+    void startKSpaceSolve(uint64_t timestep);
+
     //! Get sum of charges
     Scalar getQSum();
 
@@ -152,6 +163,9 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
     Scalar m_body_energy;      //!< Energy correction due to rigid body exclusions
     bool m_ptls_added_removed; //!< True if global particle number changed
 
+    bool m_kspace_solved;              //!< True if a started k-space solve is pending
+    uint64_t m_kspace_solve_timestep;  //!< Time step the pending solve was started for
+
     //! Helper function to be called when particle number changes
     void slotGlobalParticleNumberChange()
         {
@@ -167,6 +181,12 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
     //! Helper function to setup the mesh indices
     void setupMesh();
 
+    //! Run the k-space half of the computation: charge assignment, FFTs and mesh update
+    void solveKSpace();
+
+    //! Re-interpolate forces from the held mesh on intermediate steps
+    virtual void refreshHeldForces(uint64_t timestep);
+
     //! Helper function to setup FFT and allocate the mesh arrays
     virtual void initializeFFT();
 
@@ -42,10 +42,15 @@ PPPMForceComputeGPU::PPPMForceComputeGPU(std::shared_ptr<SystemDefinition> sysde
 
     m_cufft_initialized = false;
     m_cuda_dfft_initialized = false;
+
+    // the mesh kernels and local FFTs run on a private blocking stream so that a k-space
+    // solve started ahead of the force pass overlaps with the real space kernels
+    hipStreamCreate(&m_stream);
     }
 
 PPPMForceComputeGPU::~PPPMForceComputeGPU()
     {
+    hipStreamDestroy(m_stream);
     if (m_local_fft && m_cufft_initialized)
         {
 #ifdef __HIP_PLATFORM_HCC__
@@ -201,6 +206,15 @@ void PPPMForceComputeGPU::initializeFFT()
                                        m_mesh_points.x,
                                        CUFFT_C2C));
 #endif
+        if (m_exec_conf->getNumActiveGPUs() == 1)
+            {
+            // keep the transforms on the private stream, in order with the mesh kernels
+#ifdef __HIP_PLATFORM_HCC__
+            CHECK_HIPFFT_ERROR(hipfftSetStream(m_hipfft_plan, m_stream));
+#else
+            CHECK_HIPFFT_ERROR(cufftSetStream(m_hipfft_plan, m_stream));
+#endif
+            }
         m_cufft_initialized = true;
         }
 
@@ -277,13 +291,14 @@ void PPPMForceComputeGPU::initializeFFT()
 
     unsigned int n_blocks
         = (m_mesh_points.x * m_mesh_points.y * m_mesh_points.z) / m_block_size + 1;
-    GlobalArray<Scalar> sum_partial(n_blocks, m_exec_conf);
+    // the reductions over the single precision mesh accumulate in double precision
+    GlobalArray<double> sum_partial(n_blocks, m_exec_conf);
     m_sum_partial.swap(sum_partial);
 
-    GlobalArray<Scalar> sum_virial_partial(6 * n_blocks, m_exec_conf);
+    GlobalArray<double> sum_virial_partial(6 * n_blocks, m_exec_conf);
     m_sum_virial_partial.swap(sum_virial_partial);
 
-    GlobalArray<Scalar> sum_virial(6, m_exec_conf);
+    GlobalArray<double> sum_virial(6, m_exec_conf);
     m_sum_virial.swap(sum_virial);
     }
 
@@ -330,7 +345,8 @@ void PPPMForceComputeGPU::assignParticles()
                                  block_size,
                                  d_rho_coeff.data,
                                  m_exec_conf->dev_prop,
-                                 m_group->getGPUPartition());
+                                 m_group->getGPUPartition(),
+                                 m_exec_conf->getNumActiveGPUs() == 1 ? m_stream : 0);
 
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
@@ -423,7 +439,8 @@ void PPPMForceComputeGPU::updateMeshes()
                                   d_inf_f.data,
                                   d_k.data,
                                   m_global_dim.x * m_global_dim.y * m_global_dim.z,
-                                  block_size);
+                                  block_size,
+                                  m_exec_conf->getNumActiveGPUs() == 1 ? m_stream : 0);
 
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
@@ -595,7 +612,8 @@ void PPPMForceComputeGPU::interpolateForces()
                                d_rho_coeff.data,
                                block_size,
                                m_local_fft,
-                               m_n_cells + m_ghost_offset);
+                               m_n_cells + m_ghost_offset,
+                               m_exec_conf->dev_prop);
 
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
@@ -634,10 +652,10 @@ void PPPMForceComputeGPU::computeVirial()
         CHECK_CUDA_ERROR();
 
         {
-        ArrayHandle<Scalar> d_sum_virial(m_sum_virial,
+        ArrayHandle<double> d_sum_virial(m_sum_virial,
                                          access_location::device,
                                          access_mode::overwrite);
-        ArrayHandle<Scalar> d_sum_virial_partial(m_sum_virial_partial,
+        ArrayHandle<double> d_sum_virial_partial(m_sum_virial_partial,
                                                  access_location::device,
                                                  access_mode::overwrite);
 
@@ -651,13 +669,13 @@ void PPPMForceComputeGPU::computeVirial()
             CHECK_CUDA_ERROR();
         }
 
-    ArrayHandle<Scalar> h_sum_virial(m_sum_virial, access_location::host, access_mode::read);
+    ArrayHandle<double> h_sum_virial(m_sum_virial, access_location::host, access_mode::read);
 
-    Scalar V = m_pdata->getGlobalBox().getVolume();
-    Scalar scale = Scalar(1.0) / ((Scalar)(m_global_dim.x * m_global_dim.y * m_global_dim.z));
+    double V = m_pdata->getGlobalBox().getVolume();
+    double scale = 1.0 / ((double)(m_global_dim.x * m_global_dim.y * m_global_dim.z));
 
     for (unsigned int i = 0; i < 6; ++i)
-        m_external_virial[i] = Scalar(0.5) * V * scale * scale * h_sum_virial.data[i];
+        m_external_virial[i] = Scalar(0.5 * V * scale * scale * h_sum_virial.data[i]);
     }
 
 Scalar PPPMForceComputeGPU::computePE()
@@ -665,7 +683,7 @@ Scalar PPPMForceComputeGPU::computePE()
     ArrayHandle<hipfftComplex> d_mesh(m_mesh, access_location::device, access_mode::read);
     ArrayHandle<Scalar> d_inf_f(m_inf_f, access_location::device, access_mode::read);
 
-    ArrayHandle<Scalar> d_sum_partial(m_sum_partial,
+    ArrayHandle<double> d_sum_partial(m_sum_partial,
                                       access_location::device,
                                       access_mode::overwrite);
 
@@ -690,11 +708,11 @@ Scalar PPPMForceComputeGPU::computePE()
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
 
-    Scalar sum = m_sum.readFlags();
+    double sum = m_sum.readFlags();
 
-    Scalar V = m_pdata->getGlobalBox().getVolume();
-    Scalar scale = Scalar(1.0) / ((Scalar)(m_global_dim.x * m_global_dim.y * m_global_dim.z));
-    sum *= Scalar(0.5) * V * scale * scale;
+    double V = m_pdata->getGlobalBox().getVolume();
+    double scale = 1.0 / ((double)(m_global_dim.x * m_global_dim.y * m_global_dim.z));
+    sum *= 0.5 * V * scale * scale;
 
     if (m_exec_conf->getRank() == 0)
         {
@@ -712,22 +730,22 @@ Scalar PPPMForceComputeGPU::computePE()
     sum += m_body_energy;
 
     // store this rank's contribution as external potential energy
-    m_external_energy = sum;
+    m_external_energy = Scalar(sum);
 
 #ifdef ENABLE_MPI
     if (m_pdata->getDomainDecomposition())
         {
-        // reduce sum
+        // reduce sum in double precision
         MPI_Allreduce(MPI_IN_PLACE,
                       &sum,
                       1,
-                      MPI_HOOMD_SCALAR,
+                      MPI_DOUBLE,
                       MPI_SUM,
                       m_exec_conf->getMPICommunicator());
         }
 #endif
 
-    return sum;
+    return Scalar(sum);
     }
 
 //! Compute the optimal influence function
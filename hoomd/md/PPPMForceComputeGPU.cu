@@ -4,6 +4,8 @@
 #include "PPPMForceComputeGPU.cuh"
 #include "hoomd/TextureTools.h"
 
+#include <climits>
+
 // __scalar2int_rd is __float2int_rd in single, __double2int_rd in double
 #if HOOMD_LONGREAL_SIZE == 32
 #define __scalar2int_rd __float2int_rd
@@ -291,6 +293,315 @@ __global__ void gpu_assign_particles_kernel(const uint3 mesh_dim,
         } // end of loop over neighboring bins
     }
 
+//! Assign particles to the mesh, accumulating each block's charges in a shared memory tile
+/*! Particles arrive in space filling curve order from the particle sorter, so the stencils of
+    one block typically cover a small contiguous brick of the mesh. The block reduces the
+    bounding box of its stencils, and when the brick fits into the tile the charge fractions
+    are accumulated with cheap shared memory atomics and every covered cell is written back
+    with one global atomic per cell, instead of one per particle and stencil point. Blocks
+    whose particles spread over a larger brick fall back to direct global atomics.
+
+    The tile is indexed in unwrapped bin coordinates; the periodic wrap (or the ghost bin
+    clipping) is applied once per tile cell during write back.
+*/
+__global__ void gpu_assign_particles_tiled_kernel(const uint3 mesh_dim,
+                                                  const uint3 n_ghost_bins,
+                                                  unsigned int work_size,
+                                                  const unsigned int* d_index_array,
+                                                  const Scalar4* d_postype,
+                                                  const Scalar* d_charge,
+                                                  hipfftComplex* d_mesh,
+                                                  Scalar V_cell,
+                                                  int order,
+                                                  unsigned int offset,
+                                                  BoxDim box,
+                                                  const Scalar* d_rho_coeff,
+                                                  unsigned int tile_capacity)
+    {
+    extern __shared__ Scalar s_coeff[];
+    float* s_tile = (float*)(s_coeff + order * (2 * order + 1));
+
+    __shared__ int s_bbox_lo[3];
+    __shared__ int s_bbox_hi[3];
+
+    // load in interpolation coefficients
+    unsigned int ncoeffs = order * (2 * order + 1);
+    for (unsigned int cur_offset = 0; cur_offset < ncoeffs; cur_offset += blockDim.x)
+        {
+        if (cur_offset + threadIdx.x < ncoeffs)
+            {
+            s_coeff[cur_offset + threadIdx.x] = d_rho_coeff[cur_offset + threadIdx.x];
+            }
+        }
+
+    if (threadIdx.x == 0)
+        {
+        s_bbox_lo[0] = s_bbox_lo[1] = s_bbox_lo[2] = INT_MAX;
+        s_bbox_hi[0] = s_bbox_hi[1] = s_bbox_hi[2] = INT_MIN;
+        }
+    __syncthreads();
+
+    unsigned int work_idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    int3 bin_dim = make_int3(mesh_dim.x + 2 * n_ghost_bins.x,
+                             mesh_dim.y + 2 * n_ghost_bins.y,
+                             mesh_dim.z + 2 * n_ghost_bins.z);
+
+    // inactive threads still take part in the block wide reductions and barriers below
+    bool active = work_idx < work_size;
+
+    Scalar qi(0);
+    Scalar3 dr = make_scalar3(0, 0, 0);
+    int3 bin_coord = make_int3(0, 0, 0);
+
+    if (active)
+        {
+        unsigned int idx = d_index_array[work_idx + offset];
+        Scalar4 postype = d_postype[idx];
+        Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
+        qi = d_charge[idx];
+
+        bin_coord
+            = find_cell(pos, mesh_dim.x, mesh_dim.y, mesh_dim.z, n_ghost_bins, box, order, dr);
+
+        // ignore particles that are not within our domain (the error should be caught by
+        // HOOMD's cell list)
+        if (bin_coord.x < 0 || bin_coord.x >= bin_dim.x || bin_coord.y < 0
+            || bin_coord.y >= bin_dim.y || bin_coord.z < 0 || bin_coord.z >= bin_dim.z)
+            {
+            active = false;
+            }
+        }
+
+    if (active)
+        {
+        atomicMin(&s_bbox_lo[0], bin_coord.x);
+        atomicMin(&s_bbox_lo[1], bin_coord.y);
+        atomicMin(&s_bbox_lo[2], bin_coord.z);
+        atomicMax(&s_bbox_hi[0], bin_coord.x);
+        atomicMax(&s_bbox_hi[1], bin_coord.y);
+        atomicMax(&s_bbox_hi[2], bin_coord.z);
+        }
+    __syncthreads();
+
+    int nlower = -(order - 1) / 2;
+    int nupper = order / 2;
+
+    int3 tile_lo
+        = make_int3(s_bbox_lo[0] + nlower, s_bbox_lo[1] + nlower, s_bbox_lo[2] + nlower);
+    int3 tile_ext = make_int3(s_bbox_hi[0] - s_bbox_lo[0] + order,
+                              s_bbox_hi[1] - s_bbox_lo[1] + order,
+                              s_bbox_hi[2] - s_bbox_lo[2] + order);
+
+    unsigned long long tile_cells = 0;
+    if (s_bbox_lo[0] <= s_bbox_hi[0])
+        tile_cells = (unsigned long long)tile_ext.x * (unsigned long long)tile_ext.y
+                     * (unsigned long long)tile_ext.z;
+
+    // every thread arrives at the same decision, keeping the barriers below uniform
+    bool use_tile = tile_cells > 0 && tile_cells <= (unsigned long long)tile_capacity;
+
+    if (use_tile)
+        {
+        for (unsigned int t = threadIdx.x; t < (unsigned int)tile_cells; t += blockDim.x)
+            s_tile[t] = 0.0f;
+        }
+    __syncthreads();
+
+    if (active)
+        {
+        int i = bin_coord.x;
+        int j = bin_coord.y;
+        int k = bin_coord.z;
+
+        Scalar result;
+        int mult_fact = 2 * order + 1;
+        Scalar x0 = qi;
+
+        bool ignore_x = false;
+        bool ignore_y = false;
+        bool ignore_z = false;
+
+        // loop over neighboring bins
+        for (int l = nlower; l <= nupper; ++l)
+            {
+            // precalculate assignment factor
+            result = Scalar(0.0);
+            for (int iorder = order - 1; iorder >= 0; iorder--)
+                {
+                result = s_coeff[l - nlower + iorder * mult_fact] + result * dr.x;
+                }
+            Scalar y0 = x0 * result;
+
+            int neighi = i + l;
+            if (!use_tile)
+                {
+                if (neighi >= bin_dim.x)
+                    {
+                    if (!n_ghost_bins.x)
+                        neighi -= bin_dim.x;
+                    else
+                        ignore_x = true;
+                    }
+                else if (neighi < 0)
+                    {
+                    if (!n_ghost_bins.x)
+                        neighi += bin_dim.x;
+                    else
+                        ignore_x = true;
+                    }
+                }
+
+            for (int m = nlower; m <= nupper; ++m)
+                {
+                result = Scalar(0.0);
+                for (int iorder = order - 1; iorder >= 0; iorder--)
+                    {
+                    result = s_coeff[m - nlower + iorder * mult_fact] + result * dr.y;
+                    }
+                Scalar z0 = y0 * result;
+
+                int neighj = j + m;
+                if (!use_tile)
+                    {
+                    if (neighj >= bin_dim.y)
+                        {
+                        if (!n_ghost_bins.y)
+                            neighj -= bin_dim.y;
+                        else
+                            ignore_y = true;
+                        }
+                    else if (neighj < 0)
+                        {
+                        if (!n_ghost_bins.y)
+                            neighj += bin_dim.y;
+                        else
+                            ignore_y = true;
+                        }
+                    }
+
+                for (int n = nlower; n <= nupper; ++n)
+                    {
+                    result = Scalar(0.0);
+                    for (int iorder = order - 1; iorder >= 0; iorder--)
+                        {
+                        result = s_coeff[n - nlower + iorder * mult_fact] + result * dr.z;
+                        }
+
+                    int neighk = k + n;
+                    if (!use_tile)
+                        {
+                        if (neighk >= bin_dim.z)
+                            {
+                            if (!n_ghost_bins.z)
+                                neighk -= bin_dim.z;
+                            else
+                                ignore_z = true;
+                            }
+                        else if (neighk < 0)
+                            {
+                            if (!n_ghost_bins.z)
+                                neighk += bin_dim.z;
+                            else
+                                ignore_z = true;
+                            }
+                        }
+
+                    if (use_tile)
+                        {
+                        unsigned int tile_idx
+                            = (unsigned int)(neighi - tile_lo.x)
+                              + (unsigned int)tile_ext.x
+                                    * ((unsigned int)(neighj - tile_lo.y)
+                                       + (unsigned int)tile_ext.y
+                                             * (unsigned int)(neighk - tile_lo.z));
+                        myAtomicAdd(&s_tile[tile_idx], (float)(z0 * result / V_cell));
+                        }
+                    else if (!ignore_x && !ignore_y && !ignore_z)
+                        {
+                        // write out to global memory using row-major
+                        unsigned int cell_idx = neighi + bin_dim.x * (neighj + bin_dim.y * neighk);
+
+                        // compute fraction of particle density assigned to cell
+                        // from particles in this bin
+                        myAtomicAdd(&d_mesh[cell_idx].x, z0 * result / V_cell);
+                        }
+
+                    ignore_z = false;
+                    }
+                ignore_y = false;
+                }
+            ignore_x = false;
+            } // end of loop over neighboring bins
+        }
+
+    __syncthreads();
+
+    if (use_tile)
+        {
+        // write the tile back with one global atomic per covered cell
+        for (unsigned int t = threadIdx.x; t < (unsigned int)tile_cells; t += blockDim.x)
+            {
+            float val = s_tile[t];
+            if (val == 0.0f)
+                continue;
+
+            int gx = tile_lo.x + (int)(t % (unsigned int)tile_ext.x);
+            unsigned int rem = t / (unsigned int)tile_ext.x;
+            int gy = tile_lo.y + (int)(rem % (unsigned int)tile_ext.y);
+            int gz = tile_lo.z + (int)(rem / (unsigned int)tile_ext.y);
+
+            if (gx >= bin_dim.x)
+                {
+                if (!n_ghost_bins.x)
+                    gx -= bin_dim.x;
+                else
+                    continue;
+                }
+            else if (gx < 0)
+                {
+                if (!n_ghost_bins.x)
+                    gx += bin_dim.x;
+                else
+                    continue;
+                }
+
+            if (gy >= bin_dim.y)
+                {
+                if (!n_ghost_bins.y)
+                    gy -= bin_dim.y;
+                else
+                    continue;
+                }
+            else if (gy < 0)
+                {
+                if (!n_ghost_bins.y)
+                    gy += bin_dim.y;
+                else
+                    continue;
+                }
+
+            if (gz >= bin_dim.z)
+                {
+                if (!n_ghost_bins.z)
+                    gz -= bin_dim.z;
+                else
+                    continue;
+                }
+            else if (gz < 0)
+                {
+                if (!n_ghost_bins.z)
+                    gz += bin_dim.z;
+                else
+                    continue;
+                }
+
+            unsigned int cell_idx = gx + bin_dim.x * (gy + bin_dim.y * gz);
+            myAtomicAdd(&d_mesh[cell_idx].x, val);
+            }
+        }
+    }
+
 __global__ void gpu_reduce_meshes(const unsigned int mesh_elements,
                                   const hipfftComplex* d_mesh_scratch,
                                   hipfftComplex* d_mesh,
@@ -330,9 +641,13 @@ void gpu_assign_particles(const uint3 mesh_dim,
                           unsigned int block_size,
                           const Scalar* d_rho_coeff,
                           const hipDeviceProp_t& dev_prop,
-                          const GPUPartition& gpu_partition)
+                          const GPUPartition& gpu_partition,
+                          hipStream_t stream)
     {
-    hipMemsetAsync(d_mesh, 0, sizeof(hipfftComplex) * grid_dim.x * grid_dim.y * grid_dim.z);
+    hipMemsetAsync(d_mesh,
+                   0,
+                   sizeof(hipfftComplex) * grid_dim.x * grid_dim.y * grid_dim.z,
+                   stream);
     Scalar V_cell = box.getVolume() / (Scalar)(mesh_dim.x * mesh_dim.y * mesh_dim.z);
 
     unsigned int max_block_size;
@@ -347,6 +662,26 @@ void gpu_assign_particles(const uint3 mesh_dim,
         run_block_size -= dev_prop.warpSize;
         }
 
+    // use the tiled kernel when enough shared memory is available for a useful tile
+    hipFuncAttributes attr_tiled;
+    hipFuncGetAttributes(&attr_tiled, (const void*)gpu_assign_particles_tiled_kernel);
+
+    const size_t coeff_bytes = order * (2 * order + 1) * sizeof(Scalar);
+    unsigned int tile_capacity = 0;
+    if (dev_prop.sharedMemPerBlock > attr_tiled.sharedSizeBytes + coeff_bytes)
+        {
+        tile_capacity = (unsigned int)((dev_prop.sharedMemPerBlock - attr_tiled.sharedSizeBytes
+                                        - coeff_bytes)
+                                       / sizeof(float));
+        }
+
+    // cap the tile so that two blocks can stay resident per multiprocessor
+    tile_capacity = min(tile_capacity, 6144u);
+    bool use_tiled = tile_capacity >= (unsigned int)(8 * order * order * order);
+
+    if (use_tiled)
+        run_block_size = min(run_block_size, (unsigned int)attr_tiled.maxThreadsPerBlock);
+
     // iterate over active GPUs in reverse, to end up on first GPU when returning from this function
     unsigned int ngpu = gpu_partition.getNumActiveGPUs();
     for (int idev = ngpu - 1; idev >= 0; --idev)
@@ -363,25 +698,52 @@ void gpu_assign_particles(const uint3 mesh_dim,
 
         unsigned int nwork = range.second - range.first;
         unsigned int n_blocks = nwork / run_block_size + 1;
-        const size_t shared_bytes = order * (2 * order + 1) * sizeof(Scalar);
 
-        hipLaunchKernelGGL((gpu_assign_particles_kernel),
-                           dim3(n_blocks),
-                           dim3(run_block_size),
-                           shared_bytes,
-                           0,
-                           mesh_dim,
-                           n_ghost_bins,
-                           nwork,
-                           d_index_array,
-                           d_postype,
-                           d_charge,
-                           ngpu > 1 ? d_mesh_scratch + idev * mesh_elements : d_mesh,
-                           V_cell,
-                           order,
-                           range.first,
-                           box,
-                           d_rho_coeff);
+        if (use_tiled)
+            {
+            const size_t shared_bytes = coeff_bytes + tile_capacity * sizeof(float);
+
+            hipLaunchKernelGGL((gpu_assign_particles_tiled_kernel),
+                               dim3(n_blocks),
+                               dim3(run_block_size),
+                               shared_bytes,
+                               stream,
+                               mesh_dim,
+                               n_ghost_bins,
+                               nwork,
+                               d_index_array,
+                               d_postype,
+                               d_charge,
+                               ngpu > 1 ? d_mesh_scratch + idev * mesh_elements : d_mesh,
+                               V_cell,
+                               order,
+                               range.first,
+                               box,
+                               d_rho_coeff,
+                               tile_capacity);
+            }
+        else
+            {
+            const size_t shared_bytes = coeff_bytes;
+
+            hipLaunchKernelGGL((gpu_assign_particles_kernel),
+                               dim3(n_blocks),
+                               dim3(run_block_size),
+                               shared_bytes,
+                               stream,
+                               mesh_dim,
+                               n_ghost_bins,
+                               nwork,
+                               d_index_array,
+                               d_postype,
+                               d_charge,
+                               ngpu > 1 ? d_mesh_scratch + idev * mesh_elements : d_mesh,
+                               V_cell,
+                               order,
+                               range.first,
+                               box,
+                               d_rho_coeff);
+            }
         }
     }
 
@@ -523,7 +885,8 @@ void gpu_update_meshes(const unsigned int n_wave_vectors,
                        const Scalar* d_inf_f,
                        const Scalar3* d_k,
                        unsigned int NNN,
-                       unsigned int block_size)
+                       unsigned int block_size,
+                       hipStream_t stream)
 
     {
     unsigned int max_block_size;
@@ -538,7 +901,7 @@ void gpu_update_meshes(const unsigned int n_wave_vectors,
                        dim3(grid),
                        dim3(run_block_size),
                        0,
-                       0,
+                       stream,
                        n_wave_vectors,
                        d_fourier_mesh,
                        d_fourier_mesh_G_x,
@@ -691,6 +1054,266 @@ __global__ void gpu_compute_forces_kernel(const unsigned int work_size,
     d_force[idx] = make_scalar4(force.x, force.y, force.z, 0.0);
     }
 
+//! Back-interpolate forces, staging the mesh brick covered by the block in shared memory
+/*! Mirror of gpu_assign_particles_tiled_kernel: the block reduces the bounding box of its
+    interpolation stencils, loads the covered brick of the three inverse FFT meshes into
+    shared memory once, and every thread gathers from the tile instead of issuing redundant
+    global reads. Blocks whose particles spread over a larger brick fall back to direct
+    global reads.
+*/
+__global__ void gpu_compute_forces_tiled_kernel(const unsigned int work_size,
+                                                const Scalar4* d_postype,
+                                                Scalar4* d_force,
+                                                const uint3 grid_dim,
+                                                const uint3 n_ghost_cells,
+                                                const Scalar* d_charge,
+                                                const BoxDim box,
+                                                int order,
+                                                const unsigned int* d_index_array,
+                                                const hipfftComplex* inv_fourier_mesh_x,
+                                                const hipfftComplex* inv_fourier_mesh_y,
+                                                const hipfftComplex* inv_fourier_mesh_z,
+                                                const Scalar* d_rho_coeff,
+                                                const unsigned int offset,
+                                                unsigned int tile_capacity)
+    {
+    extern __shared__ Scalar s_coeff[];
+    float* s_tile_x = (float*)(s_coeff + order * (2 * order + 1));
+    float* s_tile_y = s_tile_x + tile_capacity;
+    float* s_tile_z = s_tile_y + tile_capacity;
+
+    __shared__ int s_bbox_lo[3];
+    __shared__ int s_bbox_hi[3];
+
+    // load in interpolation coefficients
+    unsigned int ncoeffs = order * (2 * order + 1);
+    for (unsigned int cur_offset = 0; cur_offset < ncoeffs; cur_offset += blockDim.x)
+        {
+        if (cur_offset + threadIdx.x < ncoeffs)
+            {
+            s_coeff[cur_offset + threadIdx.x] = d_rho_coeff[cur_offset + threadIdx.x];
+            }
+        }
+
+    if (threadIdx.x == 0)
+        {
+        s_bbox_lo[0] = s_bbox_lo[1] = s_bbox_lo[2] = INT_MAX;
+        s_bbox_hi[0] = s_bbox_hi[1] = s_bbox_hi[2] = INT_MIN;
+        }
+    __syncthreads();
+
+    unsigned int work_idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    int3 inner_dim = make_int3(grid_dim.x - 2 * n_ghost_cells.x,
+                               grid_dim.y - 2 * n_ghost_cells.y,
+                               grid_dim.z - 2 * n_ghost_cells.z);
+
+    // inactive threads still take part in the block wide reductions and barriers below
+    bool active = work_idx < work_size;
+
+    unsigned int idx = 0;
+    Scalar qi(0);
+    Scalar3 dr = make_scalar3(0, 0, 0);
+    int3 cell_coord = make_int3(0, 0, 0);
+
+    if (active)
+        {
+        idx = d_index_array[work_idx + offset];
+        Scalar4 postype = d_postype[idx];
+        Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
+        qi = d_charge[idx];
+
+        // find cell the particle is in
+        cell_coord
+            = find_cell(pos, inner_dim.x, inner_dim.y, inner_dim.z, n_ghost_cells, box, order, dr);
+
+        // ignore particles that are not within our domain (the error should be caught by
+        // HOOMD's cell list)
+        if (cell_coord.x < 0 || cell_coord.x >= (int)grid_dim.x || cell_coord.y < 0
+            || cell_coord.y >= (int)grid_dim.y || cell_coord.z < 0
+            || cell_coord.z >= (int)grid_dim.z)
+            {
+            active = false;
+            }
+        }
+
+    if (active)
+        {
+        atomicMin(&s_bbox_lo[0], cell_coord.x);
+        atomicMin(&s_bbox_lo[1], cell_coord.y);
+        atomicMin(&s_bbox_lo[2], cell_coord.z);
+        atomicMax(&s_bbox_hi[0], cell_coord.x);
+        atomicMax(&s_bbox_hi[1], cell_coord.y);
+        atomicMax(&s_bbox_hi[2], cell_coord.z);
+        }
+    __syncthreads();
+
+    int nlower = -(order - 1) / 2;
+    int nupper = order / 2;
+
+    int3 tile_lo
+        = make_int3(s_bbox_lo[0] + nlower, s_bbox_lo[1] + nlower, s_bbox_lo[2] + nlower);
+    int3 tile_ext = make_int3(s_bbox_hi[0] - s_bbox_lo[0] + order,
+                              s_bbox_hi[1] - s_bbox_lo[1] + order,
+                              s_bbox_hi[2] - s_bbox_lo[2] + order);
+
+    unsigned long long tile_cells = 0;
+    if (s_bbox_lo[0] <= s_bbox_hi[0])
+        tile_cells = (unsigned long long)tile_ext.x * (unsigned long long)tile_ext.y
+                     * (unsigned long long)tile_ext.z;
+
+    // every thread arrives at the same decision, keeping the barriers below uniform
+    bool use_tile = tile_cells > 0 && tile_cells <= (unsigned long long)tile_capacity;
+
+    if (use_tile)
+        {
+        // stage the covered brick of the three inverse meshes, wrapping once per tile cell
+        for (unsigned int t = threadIdx.x; t < (unsigned int)tile_cells; t += blockDim.x)
+            {
+            int gx = tile_lo.x + (int)(t % (unsigned int)tile_ext.x);
+            unsigned int rem = t / (unsigned int)tile_ext.x;
+            int gy = tile_lo.y + (int)(rem % (unsigned int)tile_ext.y);
+            int gz = tile_lo.z + (int)(rem / (unsigned int)tile_ext.y);
+
+            if (!n_ghost_cells.x)
+                {
+                if (gx >= (int)grid_dim.x)
+                    gx -= grid_dim.x;
+                else if (gx < 0)
+                    gx += grid_dim.x;
+                }
+
+            if (!n_ghost_cells.y)
+                {
+                if (gy >= (int)grid_dim.y)
+                    gy -= grid_dim.y;
+                else if (gy < 0)
+                    gy += grid_dim.y;
+                }
+
+            if (!n_ghost_cells.z)
+                {
+                if (gz >= (int)grid_dim.z)
+                    gz -= grid_dim.z;
+                else if (gz < 0)
+                    gz += grid_dim.z;
+                }
+
+            float vx = 0.0f;
+            float vy = 0.0f;
+            float vz = 0.0f;
+            if (gx >= 0 && gx < (int)grid_dim.x && gy >= 0 && gy < (int)grid_dim.y && gz >= 0
+                && gz < (int)grid_dim.z)
+                {
+                unsigned int cell_idx = gx + grid_dim.x * (gy + grid_dim.y * gz);
+                vx = inv_fourier_mesh_x[cell_idx].x;
+                vy = inv_fourier_mesh_y[cell_idx].x;
+                vz = inv_fourier_mesh_z[cell_idx].x;
+                }
+            s_tile_x[t] = vx;
+            s_tile_y[t] = vy;
+            s_tile_z[t] = vz;
+            }
+        }
+    __syncthreads();
+
+    if (!active)
+        return;
+
+    Scalar3 force = make_scalar3(0.0, 0.0, 0.0);
+
+    Scalar result;
+    int mult_fact = 2 * order + 1;
+
+    // back-interpolate forces from neighboring mesh points
+    for (int l = nlower; l <= nupper; ++l)
+        {
+        result = Scalar(0.0);
+        for (int k = order - 1; k >= 0; k--)
+            {
+            result = s_coeff[l - nlower + k * mult_fact] + result * dr.x;
+            }
+        Scalar x0 = result;
+
+        for (int m = nlower; m <= nupper; ++m)
+            {
+            result = Scalar(0.0);
+            for (int k = order - 1; k >= 0; k--)
+                {
+                result = s_coeff[m - nlower + k * mult_fact] + result * dr.y;
+                }
+            Scalar y0 = x0 * result;
+
+            for (int n = nlower; n <= nupper; ++n)
+                {
+                result = Scalar(0.0);
+                for (int k = order - 1; k >= 0; k--)
+                    {
+                    result = s_coeff[n - nlower + k * mult_fact] + result * dr.z;
+                    }
+                Scalar z0 = y0 * result;
+
+                int neighl = cell_coord.x + l;
+                int neighm = cell_coord.y + m;
+                int neighn = cell_coord.z + n;
+
+                if (use_tile)
+                    {
+                    unsigned int tile_idx
+                        = (unsigned int)(neighl - tile_lo.x)
+                          + (unsigned int)tile_ext.x
+                                * ((unsigned int)(neighm - tile_lo.y)
+                                   + (unsigned int)tile_ext.y
+                                         * (unsigned int)(neighn - tile_lo.z));
+
+                    force.x += qi * z0 * s_tile_x[tile_idx];
+                    force.y += qi * z0 * s_tile_y[tile_idx];
+                    force.z += qi * z0 * s_tile_z[tile_idx];
+                    }
+                else
+                    {
+                    if (!n_ghost_cells.x)
+                        {
+                        if (neighl >= (int)grid_dim.x)
+                            neighl -= grid_dim.x;
+                        else if (neighl < 0)
+                            neighl += grid_dim.x;
+                        }
+
+                    if (!n_ghost_cells.y)
+                        {
+                        if (neighm >= (int)grid_dim.y)
+                            neighm -= grid_dim.y;
+                        else if (neighm < 0)
+                            neighm += grid_dim.y;
+                        }
+
+                    if (!n_ghost_cells.z)
+                        {
+                        if (neighn >= (int)grid_dim.z)
+                            neighn -= grid_dim.z;
+                        else if (neighn < 0)
+                            neighn += grid_dim.z;
+                        }
+
+                    // use column-major layout
+                    unsigned int cell_idx = neighl + grid_dim.x * (neighm + grid_dim.y * neighn);
+
+                    hipfftComplex inv_mesh_x = inv_fourier_mesh_x[cell_idx];
+                    hipfftComplex inv_mesh_y = inv_fourier_mesh_y[cell_idx];
+                    hipfftComplex inv_mesh_z = inv_fourier_mesh_z[cell_idx];
+
+                    force.x += qi * z0 * inv_mesh_x.x;
+                    force.y += qi * z0 * inv_mesh_y.x;
+                    force.z += qi * z0 * inv_mesh_z.x;
+                    }
+                }
+            }
+        } // end neighbor cells loop
+
+    d_force[idx] = make_scalar4(force.x, force.y, force.z, 0.0);
+    }
+
 void gpu_compute_forces(const unsigned int N,
                         const Scalar4* d_postype,
                         Scalar4* d_force,
@@ -708,7 +1331,8 @@ void gpu_compute_forces(const unsigned int N,
                         const Scalar* d_rho_coeff,
                         unsigned int block_size,
                         bool local_fft,
-                        unsigned int inv_mesh_elements)
+                        unsigned int inv_mesh_elements,
+                        const hipDeviceProp_t& dev_prop)
     {
     unsigned int max_block_size;
     hipFuncAttributes attr;
@@ -717,6 +1341,26 @@ void gpu_compute_forces(const unsigned int N,
 
     unsigned int run_block_size = min(max_block_size, block_size);
 
+    // use the tiled kernel when enough shared memory is available for the three mesh tiles
+    hipFuncAttributes attr_tiled;
+    hipFuncGetAttributes(&attr_tiled, (const void*)gpu_compute_forces_tiled_kernel);
+
+    const size_t coeff_bytes = order * (2 * order + 1) * sizeof(Scalar);
+    unsigned int tile_capacity = 0;
+    if (dev_prop.sharedMemPerBlock > attr_tiled.sharedSizeBytes + coeff_bytes)
+        {
+        tile_capacity = (unsigned int)((dev_prop.sharedMemPerBlock - attr_tiled.sharedSizeBytes
+                                        - coeff_bytes)
+                                       / (3 * sizeof(float)));
+        }
+
+    // cap the tile so that two blocks can stay resident per multiprocessor
+    tile_capacity = min(tile_capacity, 2048u);
+    bool use_tiled = tile_capacity >= (unsigned int)(8 * order * order * order);
+
+    if (use_tiled)
+        run_block_size = min(run_block_size, (unsigned int)attr_tiled.maxThreadsPerBlock);
+
     // iterate over active GPUs in reverse, to end up on first GPU when returning from this function
     for (int idev = all_gpu_partition.getNumActiveGPUs() - 1; idev >= 0; --idev)
         {
@@ -733,38 +1377,70 @@ void gpu_compute_forces(const unsigned int N,
 
         unsigned int nwork = range.second - range.first;
         unsigned int n_blocks = nwork / run_block_size + 1;
-        const size_t shared_bytes = order * (2 * order + 1) * sizeof(Scalar);
-
-        hipLaunchKernelGGL(
-            (gpu_compute_forces_kernel),
-            dim3(n_blocks),
-            dim3(run_block_size),
-            shared_bytes,
-            0,
-            nwork,
-            d_postype,
-            d_force,
-            grid_dim,
-            n_ghost_cells,
-            d_charge,
-            box,
-            order,
-            d_index_array,
-            local_fft ? d_inv_fourier_mesh_x + idev * inv_mesh_elements : d_inv_fourier_mesh_x,
-            local_fft ? d_inv_fourier_mesh_y + idev * inv_mesh_elements : d_inv_fourier_mesh_y,
-            local_fft ? d_inv_fourier_mesh_z + idev * inv_mesh_elements : d_inv_fourier_mesh_z,
-            d_rho_coeff,
-            range.first);
+
+        if (use_tiled)
+            {
+            const size_t shared_bytes = coeff_bytes + 3 * tile_capacity * sizeof(float);
+
+            hipLaunchKernelGGL(
+                (gpu_compute_forces_tiled_kernel),
+                dim3(n_blocks),
+                dim3(run_block_size),
+                shared_bytes,
+                0,
+                nwork,
+                d_postype,
+                d_force,
+                grid_dim,
+                n_ghost_cells,
+                d_charge,
+                box,
+                order,
+                d_index_array,
+                local_fft ? d_inv_fourier_mesh_x + idev * inv_mesh_elements : d_inv_fourier_mesh_x,
+                local_fft ? d_inv_fourier_mesh_y + idev * inv_mesh_elements : d_inv_fourier_mesh_y,
+                local_fft ? d_inv_fourier_mesh_z + idev * inv_mesh_elements : d_inv_fourier_mesh_z,
+                d_rho_coeff,
+                range.first,
+                tile_capacity);
+            }
+        else
+            {
+            const size_t shared_bytes = coeff_bytes;
+
+            hipLaunchKernelGGL(
+                (gpu_compute_forces_kernel),
+                dim3(n_blocks),
+                dim3(run_block_size),
+                shared_bytes,
+                0,
+                nwork,
+                d_postype,
+                d_force,
+                grid_dim,
+                n_ghost_cells,
+                d_charge,
+                box,
+                order,
+                d_index_array,
+                local_fft ? d_inv_fourier_mesh_x + idev * inv_mesh_elements : d_inv_fourier_mesh_x,
+                local_fft ? d_inv_fourier_mesh_y + idev * inv_mesh_elements : d_inv_fourier_mesh_y,
+                local_fft ? d_inv_fourier_mesh_z + idev * inv_mesh_elements : d_inv_fourier_mesh_z,
+                d_rho_coeff,
+                range.first);
+            }
         }
     }
 
+// the single precision mesh values are accumulated in double precision so that the mesh
+// resolution, not the summation, limits the accuracy of the k-space energy and virial
 __global__ void kernel_calculate_pe_partial(int n_wave_vectors,
-                                            Scalar* sum_partial,
+                                            double* sum_partial,
                                             const hipfftComplex* d_fourier_mesh,
                                             const Scalar* d_inf_f,
                                             const bool exclude_dc)
     {
-    HIP_DYNAMIC_SHARED(Scalar, sdata)
+    HIP_DYNAMIC_SHARED(double, sdata)
 
     unsigned int tidx = threadIdx.x;
 
@@ -772,15 +1448,15 @@ __global__ void kernel_calculate_pe_partial(int n_wave_vectors,
 
     j = blockDim.x * blockIdx.x + threadIdx.x;
 
-    Scalar mySum = Scalar(0.0);
+    double mySum = 0.0;
 
     if (j < n_wave_vectors)
         {
         if (!exclude_dc || j != 0)
             {
-            mySum = d_fourier_mesh[j].x * d_fourier_mesh[j].x
-                    + d_fourier_mesh[j].y * d_fourier_mesh[j].y;
-            mySum *= d_inf_f[j];
+            mySum = (double)d_fourier_mesh[j].x * (double)d_fourier_mesh[j].x
+                    + (double)d_fourier_mesh[j].y * (double)d_fourier_mesh[j].y;
+            mySum *= (double)d_inf_f[j];
             }
         }
 
@@ -805,12 +1481,12 @@ __global__ void kernel_calculate_pe_partial(int n_wave_vectors,
         sum_partial[blockIdx.x] = sdata[0];
     }
 
-__global__ void kernel_final_reduce_pe(Scalar* sum_partial, unsigned int nblocks, Scalar* sum)
+__global__ void kernel_final_reduce_pe(double* sum_partial, unsigned int nblocks, double* sum)
     {
-    HIP_DYNAMIC_SHARED(Scalar, smem)
+    HIP_DYNAMIC_SHARED(double, smem)
 
     if (threadIdx.x == 0)
-        *sum = Scalar(0.0);
+        *sum = 0.0;
 
     for (int start = 0; start < nblocks; start += blockDim.x)
         {
@@ -818,7 +1494,7 @@ __global__ void kernel_final_reduce_pe(Scalar* sum_partial, unsigned int nblocks
         if (start + threadIdx.x < nblocks)
             smem[threadIdx.x] = sum_partial[start + threadIdx.x];
         else
-            smem[threadIdx.x] = Scalar(0.0);
+            smem[threadIdx.x] = 0.0;
 
         __syncthreads();
 
@@ -840,8 +1516,8 @@ __global__ void kernel_final_reduce_pe(Scalar* sum_partial, unsigned int nblocks
     }
 
 void gpu_compute_pe(unsigned int n_wave_vectors,
-                    Scalar* d_sum_partial,
-                    Scalar* d_sum,
+                    double* d_sum_partial,
+                    double* d_sum,
                     const hipfftComplex* d_fourier_mesh,
                     const Scalar* d_inf_f,
                     const unsigned int block_size,
@@ -850,7 +1526,7 @@ void gpu_compute_pe(unsigned int n_wave_vectors,
     {
     unsigned int n_blocks = n_wave_vectors / block_size + 1;
 
-    unsigned int shared_size = (unsigned int)(block_size * sizeof(Scalar));
+    unsigned int shared_size = (unsigned int)(block_size * sizeof(double));
 
     dim3 grid(n_blocks, 1, 1);
 
@@ -867,7 +1543,7 @@ void gpu_compute_pe(unsigned int n_wave_vectors,
 
     // calculate final sum of mesh values
     const unsigned int final_block_size = 256;
-    shared_size = final_block_size * sizeof(Scalar);
+    shared_size = final_block_size * sizeof(double);
     hipLaunchKernelGGL((kernel_final_reduce_pe),
                        dim3(1),
                        dim3(final_block_size),
@@ -879,10 +1555,10 @@ void gpu_compute_pe(unsigned int n_wave_vectors,
     }
 
 __global__ void kernel_calculate_virial_partial(int n_wave_vectors,
-                                                Scalar* sum_virial_partial,
+                                                double* sum_virial_partial,
                                                 const Scalar* d_mesh_virial)
     {
-    HIP_DYNAMIC_SHARED(Scalar, sdata)
+    HIP_DYNAMIC_SHARED(double, sdata)
 
     unsigned int j;
 
@@ -890,12 +1566,12 @@ __global__ void kernel_calculate_virial_partial(int n_wave_vectors,
 
     unsigned int tidx = threadIdx.x;
 
-    Scalar mySum_xx = Scalar(0.0);
-    Scalar mySum_xy = Scalar(0.0);
-    Scalar mySum_xz = Scalar(0.0);
-    Scalar mySum_yy = Scalar(0.0);
-    Scalar mySum_yz = Scalar(0.0);
-    Scalar mySum_zz = Scalar(0.0);
+    double mySum_xx = 0.0;
+    double mySum_xy = 0.0;
+    double mySum_xz = 0.0;
+    double mySum_yy = 0.0;
+    double mySum_yz = 0.0;
+    double mySum_zz = 0.0;
 
     if (j < n_wave_vectors)
         {
@@ -946,18 +1622,18 @@ __global__ void kernel_calculate_virial_partial(int n_wave_vectors,
     }
 
 __global__ void
-kernel_final_reduce_virial(Scalar* sum_virial_partial, unsigned int nblocks, Scalar* sum_virial)
+kernel_final_reduce_virial(double* sum_virial_partial, unsigned int nblocks, double* sum_virial)
     {
-    HIP_DYNAMIC_SHARED(Scalar, smem)
+    HIP_DYNAMIC_SHARED(double, smem)
 
     if (threadIdx.x == 0)
         {
-        sum_virial[0] = Scalar(0.0);
-        sum_virial[1] = Scalar(0.0);
-        sum_virial[2] = Scalar(0.0);
-        sum_virial[3] = Scalar(0.0);
-        sum_virial[4] = Scalar(0.0);
-        sum_virial[5] = Scalar(0.0);
+        sum_virial[0] = 0.0;
+        sum_virial[1] = 0.0;
+        sum_virial[2] = 0.0;
+        sum_virial[3] = 0.0;
+        sum_virial[4] = 0.0;
+        sum_virial[5] = 0.0;
         }
 
     for (int start = 0; start < nblocks; start += blockDim.x)
@@ -980,12 +1656,12 @@ kernel_final_reduce_virial(Scalar* sum_virial_partial, unsigned int nblocks, Sca
             }
         else
             {
-            smem[0 * blockDim.x + threadIdx.x] = Scalar(0.0);
-            smem[1 * blockDim.x + threadIdx.x] = Scalar(0.0);
-            smem[2 * blockDim.x + threadIdx.x] = Scalar(0.0);
-            smem[3 * blockDim.x + threadIdx.x] = Scalar(0.0);
-            smem[4 * blockDim.x + threadIdx.x] = Scalar(0.0);
-            smem[5 * blockDim.x + threadIdx.x] = Scalar(0.0);
+            smem[0 * blockDim.x + threadIdx.x] = 0.0;
+            smem[1 * blockDim.x + threadIdx.x] = 0.0;
+            smem[2 * blockDim.x + threadIdx.x] = 0.0;
+            smem[3 * blockDim.x + threadIdx.x] = 0.0;
+            smem[4 * blockDim.x + threadIdx.x] = 0.0;
+            smem[5 * blockDim.x + threadIdx.x] = 0.0;
             }
 
         __syncthreads();
@@ -1020,14 +1696,14 @@ kernel_final_reduce_virial(Scalar* sum_virial_partial, unsigned int nblocks, Sca
     }
 
 void gpu_compute_virial(unsigned int n_wave_vectors,
-                        Scalar* d_sum_virial_partial,
-                        Scalar* d_sum_virial,
+                        double* d_sum_virial_partial,
+                        double* d_sum_virial,
                         const Scalar* d_mesh_virial,
                         const unsigned int block_size)
     {
     unsigned int n_blocks = n_wave_vectors / block_size + 1;
 
-    unsigned int shared_size = (unsigned int)(6 * block_size * sizeof(Scalar));
+    unsigned int shared_size = (unsigned int)(6 * block_size * sizeof(double));
 
     dim3 grid(n_blocks, 1, 1);
 
@@ -1042,7 +1718,7 @@ void gpu_compute_virial(unsigned int n_wave_vectors,
 
     // calculate final virial values
     const unsigned int final_block_size = 256;
-    shared_size = 6 * final_block_size * sizeof(Scalar);
+    shared_size = 6 * final_block_size * sizeof(double);
     hipLaunchKernelGGL((kernel_final_reduce_virial),
                        dim3(1),
                        dim3(final_block_size),
@@ -39,7 +39,8 @@ void gpu_assign_particles(const uint3 mesh_dim,
                           unsigned int block_size,
                           const Scalar* d_rho_coeff,
                           const hipDeviceProp_t& dev_prop,
-                          const GPUPartition& gpu_partition);
+                          const GPUPartition& gpu_partition,
+                          hipStream_t stream);
 
 void gpu_reduce_meshes(const unsigned int mesh_elements,
                        const hipfftComplex* d_mesh_scratch,
@@ -63,7 +64,8 @@ void gpu_update_meshes(const unsigned int n_wave_vectors,
                        const Scalar* d_inf_f,
                        const Scalar3* d_k,
                        unsigned int NNN,
-                       unsigned int block_size);
+                       unsigned int block_size,
+                       hipStream_t stream);
 
 void gpu_compute_forces(const unsigned int N,
                         const Scalar4* d_postype,
@@ -82,11 +84,12 @@ void gpu_compute_forces(const unsigned int N,
                         const Scalar* d_rho_coeff,
                         unsigned int block_size,
                         bool local_fft,
-                        unsigned int inv_mesh_elements);
+                        unsigned int inv_mesh_elements,
+                        const hipDeviceProp_t& dev_prop);
 
 void gpu_compute_pe(unsigned int n_wave_vectors,
-                    Scalar* d_sum_partial,
-                    Scalar* d_sum,
+                    double* d_sum_partial,
+                    double* d_sum,
                     const hipfftComplex* d_fourier_mesh,
                     const Scalar* d_inf_f,
                     const unsigned int block_size,
@@ -94,8 +97,8 @@ void gpu_compute_pe(unsigned int n_wave_vectors,
                     const bool exclude_dc);
 
 void gpu_compute_virial(unsigned int n_wave_vectors,
-                        Scalar* d_sum_virial_partial,
-                        Scalar* d_sum_virial,
+                        double* d_sum_virial_partial,
+                        double* d_sum_virial,
                         const Scalar* d_mesh_virial,
                         const unsigned int block_size);
 
@@ -108,6 +108,7 @@ class PYBIND11_EXPORT PPPMForceComputeGPU : public PPPMForceCompute
     std::shared_ptr<Autotuner<1>> m_tuner_influence;
 
     hipfftHandle m_hipfft_plan;   //!< The FFT plan
+    hipStream_t m_stream = 0;     //!< Private stream so a started k-space solve can overlap
     bool m_local_fft;             //!< True if we are only doing local FFTs (not distributed)
     bool m_cufft_initialized;     //!< True if CUFFT has been initialized
     bool m_cuda_dfft_initialized; //!< True if dfft has been initialized
@@ -128,10 +129,10 @@ class PYBIND11_EXPORT PPPMForceComputeGPU : public PPPMForceCompute
     GlobalArray<hipfftComplex> m_inv_fourier_mesh_y; //!< The inverse-fourier transformed force mesh
     GlobalArray<hipfftComplex> m_inv_fourier_mesh_z; //!< The inverse-fourier transformed force mesh
 
-    GPUFlags<Scalar> m_sum;                   //!< Sum over fourier mesh values
-    GlobalArray<Scalar> m_sum_partial;        //!< Partial sums over fourier mesh values
-    GlobalArray<Scalar> m_sum_virial_partial; //!< Partial sums over virial mesh values
-    GlobalArray<Scalar> m_sum_virial;         //!< Final sum over virial mesh values
+    GPUFlags<double> m_sum;                   //!< Sum over fourier mesh values (in FP64)
+    GlobalArray<double> m_sum_partial;        //!< Partial sums over fourier mesh values
+    GlobalArray<double> m_sum_virial_partial; //!< Partial sums over virial mesh values
+    GlobalArray<double> m_sum_virial;         //!< Final sum over virial mesh values
     unsigned int m_block_size;                //!< Block size for fourier mesh reduction
     };
 
@@ -0,0 +1,164 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#ifdef ENABLE_HIP
+
+#include "hoomd/ExecutionConfiguration.h"
+
+#include <hip/hip_runtime.h>
+
+#ifdef __HIP_PLATFORM_NVCC__
+#include <cuda.h>
+#include <cuda_runtime.h>
+#include <nvrtc.h>
+
+#ifdef ENABLE_DEBUG_JIT
+#define JITIFY_PRINT_LOG 1
+#define JITIFY_PRINT_LINKER_LOG 1
+#define JITIFY_PRINT_LAUNCH 1
+#else
+#define JITIFY_PRINT_LOG 0
+#define JITIFY_PRINT_LAUNCH 0
+#endif
+#define JITIFY_PRINT_INSTANTIATION 0
+#define JITIFY_PRINT_SOURCE 0
+#define JITIFY_PRINT_PTX 0
+#define JITIFY_PRINT_HEADER_PATHS 0
+
+#undef DEVICE
+#include "hoomd/extern/jitify.hpp"
+
+#endif
+
+#include <string>
+#include <vector>
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Compile and launch runtime specialized pair force kernels
+/*! This class encapsulates an NVRTC compiled pair force kernel and provides the API necessary
+    to query kernel attributes and launch the kernel into a stream. It is the MD counterpart of
+    hpmc::GPUEvalFactory, trimmed to the needs of PotentialPairGPUJIT: the kernel is templated
+    over the threads per particle and the launch bounds, and carries no runtime adjustable
+    globals because all parameters are baked into the generated source.
+ */
+class PairJITFactory
+    {
+    public:
+    //! Constructor
+    PairJITFactory(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                   const std::string& code,
+                   const std::string& kernel_name,
+                   const std::vector<std::string>& options,
+                   unsigned int compute_arch)
+        : m_exec_conf(exec_conf), m_kernel_name(kernel_name)
+        {
+        for (unsigned int i = 1; i <= (unsigned int)m_exec_conf->dev_prop.warpSize; i *= 2)
+            m_tpp_list.push_back(i);
+
+        for (unsigned int i = exec_conf->dev_prop.warpSize;
+             i <= (unsigned int)m_exec_conf->dev_prop.maxThreadsPerBlock;
+             i *= 2)
+            m_launch_bounds.push_back(i);
+
+// instantiate jitify cache
+#ifdef __HIP_PLATFORM_NVCC__
+        m_cache.resize(this->m_exec_conf->getNumActiveGPUs());
+#else
+        throw std::runtime_error("JIT specialized pair potentials require the CUDA platform.");
+#endif
+
+        compileGPU(code, options, compute_arch);
+        }
+
+    ~PairJITFactory() { }
+
+    //! Return the list of available launch bounds
+    const std::vector<unsigned int>& getLaunchBounds() const
+        {
+        return m_launch_bounds;
+        }
+
+    //! Return the list of available threads per particle
+    const std::vector<unsigned int>& getTppList() const
+        {
+        return m_tpp_list;
+        }
+
+    //! Return the maximum number of threads per block for this kernel
+    /*! \param idev the logical GPU id
+        \param tpp template parameter
+        \param launch_bounds template parameter
+     */
+    unsigned int
+    getKernelMaxThreads(unsigned int idev, unsigned int tpp, unsigned int launch_bounds)
+        {
+        int max_threads = 0;
+
+#ifdef __HIP_PLATFORM_NVCC__
+        CUresult custatus = cuFuncGetAttribute(
+            &max_threads,
+            CU_FUNC_ATTRIBUTE_MAX_THREADS_PER_BLOCK,
+            m_program[idev].kernel(m_kernel_name).instantiate(tpp, launch_bounds));
+        char* error;
+        if (custatus != CUDA_SUCCESS)
+            {
+            cuGetErrorString(custatus, const_cast<const char**>(&error));
+            throw std::runtime_error("cuFuncGetAttribute: " + std::string(error));
+            }
+#endif
+
+        return max_threads;
+        }
+
+//! Configure the JIT kernel for launch
+/*! \param idev logical GPU id to launch on
+    \param grid The grid dimensions
+    \param threads The thread block dimensions
+    \param sharedMemBytes The size of the dynamic shared mem allocation
+    \param hStream stream to execute on
+    \param tpp template parameter
+    \param launch_bounds template parameter
+    */
+#ifdef __HIP_PLATFORM_NVCC__
+    jitify::KernelLauncher configureKernel(unsigned int idev,
+                                           dim3 grid,
+                                           dim3 threads,
+                                           size_t sharedMemBytes,
+                                           cudaStream_t hStream,
+                                           unsigned int tpp,
+                                           unsigned int launch_bounds)
+        {
+        cudaSetDevice(m_exec_conf->getGPUIds()[idev]);
+
+        return m_program[idev]
+            .kernel(m_kernel_name)
+            .instantiate(tpp, launch_bounds)
+            .configure(grid, threads, static_cast<unsigned int>(sharedMemBytes), hStream);
+        }
+#endif
+
+    private:
+    std::shared_ptr<ExecutionConfiguration> m_exec_conf; //!< The execution configuration
+    std::vector<unsigned int> m_tpp_list;                //!< The threads per particle values
+    std::vector<unsigned int> m_launch_bounds; //!< The number of different __launch_bounds__
+    const std::string m_kernel_name;           //!< The name of the __global__ function
+
+    //! Helper function for RTC
+    void compileGPU(const std::string& code,
+                    const std::vector<std::string>& options,
+                    unsigned int compute_arch);
+
+#ifdef __HIP_PLATFORM_NVCC__
+    std::vector<jitify::JitCache> m_cache;  //!< jitify kernel cache, one per GPU
+    std::vector<jitify::Program> m_program; //!< The kernel object, one per GPU
+#endif
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+#endif
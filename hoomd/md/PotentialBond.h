@@ -8,6 +8,12 @@
 
 #include <vector>
 
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
+
 /*! \file PotentialBond.h
     \brief Declares PotentialBond
 */
@@ -197,10 +203,6 @@ void PotentialBond<evaluator, Bonds>::computeForces(uint64_t timestep)
     PDataFlags flags = this->m_pdata->getFlags();
     bool compute_virial = flags[pdata_flag::pressure_tensor];
 
-    Scalar bond_virial[6];
-    for (unsigned int i = 0; i < 6; i++)
-        bond_virial[i] = Scalar(0.0);
-
     ArrayHandle<typename Bonds::members_t> h_bonds(m_bond_data->getMembersArray(),
                                                    access_location::host,
                                                    access_mode::read);
@@ -210,11 +212,19 @@ void PotentialBond<evaluator, Bonds>::computeForces(uint64_t timestep)
 
     unsigned int max_local = m_pdata->getN() + m_pdata->getNGhosts();
 
+#ifndef ENABLE_TBB
     // for each of the bonds
     const unsigned int size = (unsigned int)m_bond_data->getN();
 
-    for (unsigned int i = 0; i < size; i++)
+    // Per-bond work wrapped in a lambda: each bond scatters directly into the force
+    // and virial entries of both of its particles.
+    auto compute_bond
+        = [&](const unsigned int i, Scalar4* force, Scalar* virial, const size_t virial_pitch)
         {
+        Scalar bond_virial[6];
+        for (unsigned int j = 0; j < 6; j++)
+            bond_virial[j] = Scalar(0.0);
+
         // lookup the tag of each of the particles participating in the bond
         const typename Bonds::members_t& bond = h_bonds.data[i];
         assert(bond.tag[0] < m_pdata->getMaximumTag() + 1);
@@ -284,24 +294,24 @@ void PotentialBond<evaluator, Bonds>::computeForces(uint64_t timestep)
             // add the force to the particles (only for non-ghost particles)
             if (idx_b < m_pdata->getN())
                 {
-                h_force.data[idx_b].x += force_divr * dx.x;
-                h_force.data[idx_b].y += force_divr * dx.y;
-                h_force.data[idx_b].z += force_divr * dx.z;
-                h_force.data[idx_b].w += bond_eng;
+                force[idx_b].x += force_divr * dx.x;
+                force[idx_b].y += force_divr * dx.y;
+                force[idx_b].z += force_divr * dx.z;
+                force[idx_b].w += bond_eng;
                 if (compute_virial)
-                    for (unsigned int i = 0; i < 6; i++)
-                        h_virial.data[i * m_virial_pitch + idx_b] += bond_virial[i];
+                    for (unsigned int j = 0; j < 6; j++)
+                        virial[j * virial_pitch + idx_b] += bond_virial[j];
                 }
 
             if (idx_a < m_pdata->getN())
                 {
-                h_force.data[idx_a].x -= force_divr * dx.x;
-                h_force.data[idx_a].y -= force_divr * dx.y;
-                h_force.data[idx_a].z -= force_divr * dx.z;
-                h_force.data[idx_a].w += bond_eng;
+                force[idx_a].x -= force_divr * dx.x;
+                force[idx_a].y -= force_divr * dx.y;
+                force[idx_a].z -= force_divr * dx.z;
+                force[idx_a].w += bond_eng;
                 if (compute_virial)
-                    for (unsigned int i = 0; i < 6; i++)
-                        h_virial.data[i * m_virial_pitch + idx_a] += bond_virial[i];
+                    for (unsigned int j = 0; j < 6; j++)
+                        virial[j * virial_pitch + idx_a] += bond_virial[j];
                 }
             }
         else
@@ -311,7 +321,130 @@ void PotentialBond<evaluator, Bonds>::computeForces(uint64_t timestep)
                 << std::endl;
             throw std::runtime_error("Error in bond calculation");
             }
-        }
+        };
+
+    for (unsigned int i = 0; i < size; i++)
+        compute_bond(i, h_force.data, h_virial.data, m_virial_pitch);
+#else
+    // Owner-computes traversal of the CSR group table: each thread processes a
+    // contiguous range of particle rows and writes only the force entries of the rows
+    // it owns, so each bond is evaluated once per incident particle but there are no
+    // write conflicts, no per-thread buffers, and no reduction pass.
+    ArrayHandle<unsigned int> h_row_offset(m_bond_data->getCSRRowOffsets(),
+                                           access_location::host,
+                                           access_mode::read);
+    ArrayHandle<unsigned int> h_group_idx(m_bond_data->getCSRGroupIndices(),
+                                          access_location::host,
+                                          access_mode::read);
+
+    const unsigned int num_local = m_pdata->getN();
+
+    auto compute_particle_bonds = [&](const unsigned int idx_me)
+        {
+        Scalar4 f = make_scalar4(Scalar(0.0), Scalar(0.0), Scalar(0.0), Scalar(0.0));
+        Scalar virial_sum[6];
+        for (unsigned int j = 0; j < 6; j++)
+            virial_sum[j] = Scalar(0.0);
+
+        const Scalar4 postype_me = h_pos.data[idx_me];
+        const Scalar3 pos_me = make_scalar3(postype_me.x, postype_me.y, postype_me.z);
+
+        const unsigned int row_end = h_row_offset.data[idx_me + 1];
+        for (unsigned int row = h_row_offset.data[idx_me]; row < row_end; row++)
+            {
+            const unsigned int cur_bond = h_group_idx.data[row];
+            const typename Bonds::members_t& bond = h_bonds.data[cur_bond];
+
+            // identify the other member of the bond; only the first two members of a
+            // group interact (mesh bond groups carry additional triangle members)
+            unsigned int idx_a = h_rtag.data[bond.tag[0]];
+            unsigned int idx_b = h_rtag.data[bond.tag[1]];
+            if (idx_a != idx_me && idx_b != idx_me)
+                continue;
+            unsigned int idx_partner = (idx_a == idx_me) ? idx_b : idx_a;
+
+            // throw an error if this bond is incomplete
+            if (idx_partner >= max_local)
+                {
+                std::ostringstream stream;
+                stream << "Error: bond " << bond.tag[0] << " " << bond.tag[1]
+                       << " is incomplete.";
+                throw std::runtime_error(stream.str());
+                }
+
+            // calculate d\vec{r}
+            Scalar3 dx = make_scalar3(h_pos.data[idx_partner].x,
+                                      h_pos.data[idx_partner].y,
+                                      h_pos.data[idx_partner].z)
+                         - pos_me;
+
+            // access charge (if needed)
+            Scalar charge_me = Scalar(0.0);
+            Scalar charge_partner = Scalar(0.0);
+            if (evaluator::needsCharge())
+                {
+                charge_me = h_charge.data[idx_me];
+                charge_partner = h_charge.data[idx_partner];
+                }
+
+            // if the vector crosses the box, pull it back
+            dx = box.minImage(dx);
+
+            // calculate r_ab squared
+            Scalar rsq = dot(dx, dx);
+
+            // compute the force and potential energy
+            Scalar force_divr = Scalar(0.0);
+            Scalar bond_eng = Scalar(0.0);
+            evaluator eval(rsq, h_params.data[h_typeval.data[cur_bond].type]);
+            if (evaluator::needsCharge())
+                eval.setCharge(charge_me, charge_partner);
+
+            bool evaluated = eval.evalForceAndEnergy(force_divr, bond_eng);
+
+            if (!evaluated)
+                {
+                this->m_exec_conf->msg->error()
+                    << "bond." << evaluator::getName() << ": bond out of bounds" << std::endl
+                    << std::endl;
+                throw std::runtime_error("Error in bond calculation");
+                }
+
+            // each member receives half the bond energy and half the virial
+            f.x -= force_divr * dx.x;
+            f.y -= force_divr * dx.y;
+            f.z -= force_divr * dx.z;
+            f.w += Scalar(0.5) * bond_eng;
+
+            if (compute_virial)
+                {
+                Scalar force_div2r = Scalar(1.0 / 2.0) * force_divr;
+                virial_sum[0] += dx.x * dx.x * force_div2r; // xx
+                virial_sum[1] += dx.x * dx.y * force_div2r; // xy
+                virial_sum[2] += dx.x * dx.z * force_div2r; // xz
+                virial_sum[3] += dx.y * dx.y * force_div2r; // yy
+                virial_sum[4] += dx.y * dx.z * force_div2r; // yz
+                virial_sum[5] += dx.z * dx.z * force_div2r; // zz
+                }
+            }
+
+        h_force.data[idx_me] = f;
+        if (compute_virial)
+            for (unsigned int j = 0; j < 6; j++)
+                h_virial.data[j * m_virial_pitch + idx_me] = virial_sum[j];
+        };
+
+    m_exec_conf->getTaskArena()->execute(
+        [&]
+        {
+            tbb::parallel_for(tbb::blocked_range<unsigned int>(0, num_local),
+                              [&](const tbb::blocked_range<unsigned int>& r)
+                              {
+                                  for (unsigned int i = r.begin(); i != r.end(); ++i)
+                                      compute_particle_bonds(i);
+                              });
+        });
+#endif
     }
 
 #ifdef ENABLE_MPI
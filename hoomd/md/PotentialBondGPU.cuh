@@ -42,12 +42,13 @@ template<int group_size> struct bond_args_t
                 const unsigned int* _d_gpu_n_bonds,
                 const unsigned int _n_bond_types,
                 const unsigned int _block_size,
-                const hipDeviceProp_t& _devprop)
+                const hipDeviceProp_t& _devprop,
+                const hipStream_t _stream = 0)
         : d_force(_d_force), d_virial(_d_virial), virial_pitch(_virial_pitch), N(_N), n_max(_n_max),
           d_pos(_d_pos), d_charge(_d_charge), box(_box), d_gpu_bondlist(_d_gpu_bondlist),
           gpu_table_indexer(_gpu_table_indexer), d_gpu_bond_pos(_d_gpu_bond_pos),
           d_gpu_n_bonds(_d_gpu_n_bonds), n_bond_types(_n_bond_types), block_size(_block_size),
-          devprop(_devprop) {};
+          devprop(_devprop), stream(_stream) {};
 
     Scalar4* d_force;          //!< Force to write out
     Scalar* d_virial;          //!< Virial to write out
@@ -65,6 +66,7 @@ template<int group_size> struct bond_args_t
     const unsigned int n_bond_types;   //!< Number of bond types in the simulation
     const unsigned int block_size;     //!< Block size to execute
     const hipDeviceProp_t& devprop;    //!< CUDA device properties
+    const hipStream_t stream;          //!< Stream to launch the kernel on
     };
 
 #ifdef __HIPCC__
@@ -135,7 +137,7 @@ __global__ void gpu_compute_bond_forces_kernel(Scalar4* d_force,
         return;
 
     // load in the length of the list for this thread (MEM TRANSFER: 4 bytes)
-    int n_bonds = n_bonds_list[idx];
+    int n_bonds = __ldg(n_bonds_list + idx);
 
     // read in the position of our particle. (MEM TRANSFER: 16 bytes)
     Scalar4 postype = __ldg(d_pos + idx);
@@ -159,7 +161,7 @@ __global__ void gpu_compute_bond_forces_kernel(Scalar4* d_force,
     // loop over neighbors
     for (int bond_idx = 0; bond_idx < n_bonds; bond_idx++)
         {
-        int cur_bond_pos = bpos_list[blist_idx(idx, bond_idx)];
+        int cur_bond_pos = __ldg(bpos_list + blist_idx(idx, bond_idx));
 
         if (cur_bond_pos > 1)
             continue;
@@ -288,7 +290,7 @@ gpu_compute_bond_forces(const kernel::bond_args_t<group_size>& bond_args,
                            grid,
                            threads,
                            shared_bytes,
-                           0,
+                           bond_args.stream,
                            bond_args.d_force,
                            bond_args.d_virial,
                            bond_args.virial_pitch,
@@ -310,7 +312,7 @@ gpu_compute_bond_forces(const kernel::bond_args_t<group_size>& bond_args,
                            grid,
                            threads,
                            shared_bytes,
-                           0,
+                           bond_args.stream,
                            bond_args.d_force,
                            bond_args.d_virial,
                            bond_args.virial_pitch,
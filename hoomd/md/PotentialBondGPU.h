@@ -39,10 +39,14 @@ class PotentialBondGPU : public PotentialBond<evaluator, Bonds>
     PotentialBondGPU(std::shared_ptr<SystemDefinition> sysdef,
                      std::shared_ptr<MeshDefinition> meshdef);
     //! Destructor
-    virtual ~PotentialBondGPU() { }
+    virtual ~PotentialBondGPU()
+        {
+        hipStreamDestroy(m_stream);
+        }
 
     protected:
     std::shared_ptr<Autotuner<1>> m_tuner; //!< Autotuner for block size
+    hipStream_t m_stream = 0; //!< Private launch stream so bonded kernels can overlap
     GPUArray<unsigned int> m_flags;        //!< Flags set during the kernel execution
 
     //! Actually compute the forces
@@ -79,6 +83,9 @@ PotentialBondGPU<evaluator, Bonds>::PotentialBondGPU(std::shared_ptr<SystemDefin
                                    this->m_exec_conf,
                                    "bond_" + evaluator::getName()));
     this->m_autotuners.push_back(m_tuner);
+
+    // launch on a private blocking stream so the bonded force kernels overlap
+    hipStreamCreate(&m_stream);
     }
 
 template<class evaluator, class Bonds>
@@ -112,6 +119,9 @@ PotentialBondGPU<evaluator, Bonds>::PotentialBondGPU(std::shared_ptr<SystemDefin
                                    this->m_exec_conf,
                                    "bond_" + evaluator::getName()));
     this->m_autotuners.push_back(m_tuner);
+
+    // launch on a private blocking stream so the bonded force kernels overlap
+    hipStreamCreate(&m_stream);
     }
 
 template<class evaluator, class Bonds>
@@ -173,7 +183,10 @@ void PotentialBondGPU<evaluator, Bonds>::computeForces(uint64_t timestep)
                                              d_gpu_n_bonds.data,
                                              this->m_bond_data->getNTypes(),
                                              this->m_tuner->getParam()[0],
-                                             this->m_exec_conf->dev_prop),
+                                             this->m_exec_conf->dev_prop,
+                                             this->m_exec_conf->getNumActiveGPUs() == 1
+                                                 ? m_stream
+                                                 : 0),
             d_params.data,
             d_flags.data);
         }
@@ -35,9 +35,11 @@ struct external_potential_args_t
                               const Scalar* _d_charge,
                               const BoxDim& _box,
                               const unsigned int _block_size,
-                              const hipDeviceProp_t& _devprop)
+                              const hipDeviceProp_t& _devprop,
+                              const hipStream_t _stream)
         : d_force(_d_force), d_virial(_d_virial), virial_pitch(_virial_pitch), box(_box), N(_N),
-          d_pos(_d_pos), d_charge(_d_charge), block_size(_block_size), devprop(_devprop) {};
+          d_pos(_d_pos), d_charge(_d_charge), block_size(_block_size), devprop(_devprop),
+          stream(_stream) {};
 
     Scalar4* d_force;               //!< Force to write out
     Scalar* d_virial;               //!< Virial to write out
@@ -48,6 +50,7 @@ struct external_potential_args_t
     const Scalar* d_charge;         //!< particle charges
     const unsigned int block_size;  //!< Block size to execute
     const hipDeviceProp_t& devprop; //!< Device properties
+    const hipStream_t stream;       //!< Stream to launch the kernel on
     };
 
 //! Driver function for compute external field kernel
@@ -96,9 +99,20 @@ __global__ void gpu_compute_external_forces_kernel(Scalar4* d_force,
     typename evaluator::field_type* s_field = (typename evaluator::field_type*)(&s_data[0]);
 
         {
+        // only stage the bytes the evaluator actually reads, which can be far less than the
+        // full (maximum-capacity) field struct
+        __shared__ unsigned int s_field_size;
+        if (threadIdx.x == 0)
+            {
+            s_field_size
+                = (unsigned int)((evaluator::getFieldBytes(*d_field) + sizeof(int) - 1)
+                                 / sizeof(int));
+            }
+        __syncthreads();
+
         unsigned int tidx = threadIdx.x;
         unsigned int block_size = blockDim.x;
-        unsigned int field_size = sizeof(typename evaluator::field_type) / sizeof(int);
+        unsigned int field_size = s_field_size;
 
         for (unsigned int cur_offset = 0; cur_offset < field_size; cur_offset += block_size)
             {
@@ -185,7 +199,7 @@ hipError_t gpu_compute_potential_external_forces(
                        dim3(grid),
                        dim3(threads),
                        bytes,
-                       0,
+                       external_potential_args.stream,
                        external_potential_args.d_force,
                        external_potential_args.d_virial,
                        external_potential_args.virial_pitch,
@@ -32,11 +32,18 @@ template<class evaluator> class PotentialExternalGPU : public PotentialExternal<
     //! Constructs the compute
     PotentialExternalGPU(std::shared_ptr<SystemDefinition> sysdef);
 
+    //! Destructor
+    virtual ~PotentialExternalGPU()
+        {
+        hipStreamDestroy(m_stream);
+        }
+
     protected:
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
 
     std::shared_ptr<Autotuner<1>> m_tuner; //!< Autotuner for block size
+    hipStream_t m_stream = 0; //!< Private launch stream so external kernels can overlap
     };
 
 /*! Constructor
@@ -50,6 +57,11 @@ PotentialExternalGPU<evaluator>::PotentialExternalGPU(std::shared_ptr<SystemDefi
                                    this->m_exec_conf,
                                    "external_" + evaluator::getName()));
     this->m_autotuners.push_back(m_tuner);
+
+    // external potentials read only per-type parameters and the field, and write only this
+    // compute's output arrays: give the kernel a private stream so it overlaps with other
+    // small force kernels instead of serializing on the default stream
+    hipStreamCreate(&m_stream);
     }
 
 /*! Computes the specified constraint forces
@@ -83,7 +95,9 @@ template<class evaluator> void PotentialExternalGPU<evaluator>::computeForces(ui
                                           d_charge.data,
                                           box,
                                           m_tuner->getParam()[0],
-                                          this->m_exec_conf->dev_prop),
+                                          this->m_exec_conf->dev_prop,
+                                          this->m_exec_conf->getNumActiveGPUs() == 1 ? m_stream
+                                                                                     : 0),
         d_params.data,
         this->m_field.get());
 
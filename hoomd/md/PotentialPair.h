@@ -4,11 +4,15 @@
 #ifndef __POTENTIAL_PAIR_H__
 #define __POTENTIAL_PAIR_H__
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <memory>
+#include <vector>
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <stdexcept>
+#include <type_traits>
 
 #include "NeighborList.h"
 #include "hoomd/ForceCompute.h"
@@ -26,6 +30,12 @@
 #include "hoomd/Communicator.h"
 #endif
 
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#endif
+
 /*! \file PotentialPair.h
     \brief Defines the template class for standard pair potentials
     \details The heart of the code that computes pair potentials is in this file.
@@ -95,6 +105,8 @@ template<class evaluator> class PotentialPair : public ForceCompute
     //! Set and get the pair parameters for a single type pair
     virtual void setParams(unsigned int typ1, unsigned int typ2, const param_type& param);
     virtual void setParamsPython(pybind11::tuple typ, pybind11::dict params);
+    /// Patch several type pair parameters in one call
+    virtual void setParamsBatchPython(pybind11::list updates);
     /// Get params for a single type pair using a tuple of strings
     virtual pybind11::dict getParams(pybind11::tuple typ);
     //! Set the rcut for a single type pair
@@ -481,6 +493,43 @@ void PotentialPair<evaluator>::setParamsPython(pybind11::tuple typ, pybind11::di
     setParams(typ1, typ2, param_type(params, m_exec_conf->isCUDAEnabled()));
     }
 
+/*! \param updates List of ((type 1 name, type 2 name), parameter dict) tuples
+
+    Fast path for parameter sweeps within a run: all entries are patched in place in the
+    managed parameter table with one call, and device residency of the table is restored
+    with a single asynchronous prefetch per batch instead of demand page faults at the
+    next kernel launch. Nothing else is touched — the cutoff matrix, the neighbor list
+    and the autotuner state are all preserved, so updating coefficients mid-run does not
+    trigger a rebuild or a retune.
+*/
+template<class evaluator>
+void PotentialPair<evaluator>::setParamsBatchPython(pybind11::list updates)
+    {
+    for (auto item : updates)
+        {
+        auto entry = item.cast<pybind11::tuple>();
+        auto typ = entry[0].cast<pybind11::tuple>();
+        auto typ1 = m_pdata->getTypeByName(typ[0].cast<std::string>());
+        auto typ2 = m_pdata->getTypeByName(typ[1].cast<std::string>());
+        setParams(typ1,
+                  typ2,
+                  param_type(entry[1].cast<pybind11::dict>(), m_exec_conf->isCUDAEnabled()));
+        }
+
+#if defined(ENABLE_HIP) && defined(__HIP_PLATFORM_NVCC__)
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        auto& gpu_map = m_exec_conf->getGPUIds();
+        for (unsigned int idev = 0; idev < m_exec_conf->getNumActiveGPUs(); ++idev)
+            {
+            cudaMemPrefetchAsync(m_params.data(),
+                                 sizeof(param_type) * m_params.size(),
+                                 gpu_map[idev]);
+            }
+        }
+#endif
+    }
+
 template<class evaluator> pybind11::dict PotentialPair<evaluator>::getParams(pybind11::tuple typ)
     {
     auto typ1 = m_pdata->getTypeByName(typ[0].cast<std::string>());
@@ -621,11 +670,81 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
 
     // need to start from a zero force, energy and virial
     memset((void*)h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
-    memset((void*)h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
 
-    // for each particle
-    for (int i = 0; i < (int)m_pdata->getN(); i++)
+    // only touch the 6 N virial array on steps that actually accumulate into it; on all
+    // other steps the array keeps its last computed values and no consumer reads it (the
+    // pressure_tensor flag is rearmed by System::determineFlags only when a consumer's
+    // trigger fires)
+    if (compute_virial)
+        memset((void*)h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+
+    // When the neighbor list rows are distance ordered, a row can be abandoned at the first
+    // neighbor beyond the largest cutoff involving the row's type. Particles move at most
+    // r_buff/2 each between rebuilds, so padding the cutoff by twice the buffer makes the
+    // early exit safe against both the build-time and the current distances drifting.
+    const bool nlist_sorted = m_nlist->getSortedByDistance();
+    const unsigned int n_types = m_pdata->getNTypes();
+    std::vector<Scalar> row_stop_sq_by_type;
+    if (nlist_sorted)
         {
+        const Scalar r_buff = m_nlist->getRBuff();
+        row_stop_sq_by_type.resize(n_types);
+        for (unsigned int typei = 0; typei < n_types; typei++)
+            {
+            Scalar r_cut_max(0.0);
+            for (unsigned int typej = 0; typej < n_types; typej++)
+                {
+                r_cut_max = std::max(r_cut_max,
+                                     std::sqrt(h_rcutsq.data[m_typpair_idx(typei, typej)]));
+                }
+            const Scalar r_stop = r_cut_max + Scalar(2.0) * r_buff;
+            row_stop_sq_by_type[typei] = r_stop * r_stop;
+            }
+        }
+
+    // Types with a zero cutoff against every other type contribute nothing to this
+    // potential; a shared neighbor list may still store their rows for other consumers,
+    // so skip those rows wholesale instead of rejecting their neighbors one by one.
+    std::vector<bool> type_is_inert(n_types);
+    for (unsigned int typei = 0; typei < n_types; typei++)
+        {
+        bool inert = true;
+        for (unsigned int typej = 0; typej < n_types; typej++)
+            {
+            if (h_rcutsq.data[m_typpair_idx(typei, typej)] > Scalar(0.0))
+                {
+                inert = false;
+                break;
+                }
+            }
+        type_is_inert[typei] = inert;
+        }
+
+    // Per-particle work wrapped in a lambda so it can run serially, or in parallel on
+    // the task arena when full neighbor list storage makes the writes disjoint.
+    //
+    // Neighbors are processed in fixed-width batches: a gather pass packs the
+    // neighbor separations into contiguous lanes, then the (inlined) evaluator runs
+    // over the lanes in a loop with no cross-lane dependencies so the compiler can
+    // vectorize it, and a final scalar pass applies XPLOR smoothing and scatters the
+    // Newton's third law contributions.
+    //
+    // The lambda is generic over the box periodicity so the fully periodic case (the
+    // overwhelmingly common one) instantiates minImage without the per-axis tests.
+    auto compute_particle = [&](const int i, auto fully_periodic)
+        {
+        constexpr unsigned int batch_size = 16;
+        Scalar b_dx_x[batch_size];
+        Scalar b_dx_y[batch_size];
+        Scalar b_dx_z[batch_size];
+        Scalar b_rsq[batch_size];
+        Scalar b_qj[batch_size];
+        Scalar b_force_divr[batch_size];
+        Scalar b_pair_eng[batch_size];
+        unsigned int b_j[batch_size];
+        unsigned int b_typpair[batch_size];
+        bool b_evaluated[batch_size];
+
         // access the particle's position and type (MEM TRANSFER: 4 scalars)
         Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
         unsigned int typei = __scalar_as_int(h_pos.data[i].w);
@@ -633,6 +752,11 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
         // sanity check
         assert(typei < m_pdata->getNTypes());
 
+        // an inert type has no interacting pairs in either direction, so neither this row
+        // nor its third-law scatter can contribute; the force array is already zeroed
+        if (type_is_inert[typei])
+            return;
+
         // access charge (if needed)
         Scalar qi = Scalar(0.0);
         if (evaluator::needsCharge())
@@ -648,68 +772,114 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
         Scalar virialyzi = 0.0;
         Scalar virialzzi = 0.0;
 
-        // loop over all of the neighbors of this particle
+        // distance ordered rows allow an early exit at this type's stopping distance
+        const Scalar row_stop_sq = nlist_sorted ? row_stop_sq_by_type[typei] : Scalar(0.0);
+
+        // loop over all of the neighbors of this particle in batches
         const size_t myHead = h_head_list.data[i];
         const unsigned int size = (unsigned int)h_n_neigh.data[i];
-        for (unsigned int k = 0; k < size; k++)
+        for (unsigned int k0 = 0; k0 < size; k0 += batch_size)
             {
-            // access the index of this neighbor (MEM TRANSFER: 1 scalar)
-            unsigned int j = h_nlist.data[myHead + k];
-            assert(j < m_pdata->getN() + m_pdata->getNGhosts());
-
-            // calculate dr_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
-            Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
-            Scalar3 dx = pi - pj;
-
-            // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
-            unsigned int typej = __scalar_as_int(h_pos.data[j].w);
-            assert(typej < m_pdata->getNTypes());
-
-            // access charge (if needed)
-            Scalar qj = Scalar(0.0);
-            if (evaluator::needsCharge())
-                qj = h_charge.data[j];
-
-            // apply periodic boundary conditions
-            dx = box.minImage(dx);
+            unsigned int n_lanes = std::min(batch_size, size - k0);
 
-            // calculate r_ij squared (FLOPS: 5)
-            Scalar rsq = dot(dx, dx);
+            // gather pass: pack the neighbor separations and type pairs into lanes
+            for (unsigned int lane = 0; lane < n_lanes; lane++)
+                {
+                // access the index of this neighbor (MEM TRANSFER: 1 scalar)
+                unsigned int j = h_nlist.data[myHead + k0 + lane];
+                assert(j < m_pdata->getN() + m_pdata->getNGhosts());
+
+                // calculate dr_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
+                Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+                Scalar3 dx = pi - pj;
+
+                // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
+                unsigned int typej = __scalar_as_int(h_pos.data[j].w);
+                assert(typej < m_pdata->getNTypes());
+
+                // access charge (if needed)
+                if (evaluator::needsCharge())
+                    b_qj[lane] = h_charge.data[j];
+
+                // apply periodic boundary conditions
+                if constexpr (decltype(fully_periodic)::value)
+                    dx = box.minImage<true, true, true>(dx);
+                else
+                    dx = box.minImage(dx);
+
+                b_j[lane] = j;
+                b_dx_x[lane] = dx.x;
+                b_dx_y[lane] = dx.y;
+                b_dx_z[lane] = dx.z;
+                // calculate r_ij squared (FLOPS: 5)
+                b_rsq[lane] = dot(dx, dx);
+                b_typpair[lane] = m_typpair_idx(typei, typej);
+                }
 
-            // get parameters for this type pair
-            unsigned int typpair_idx = m_typpair_idx(typei, typej);
-            const param_type& param = m_params[typpair_idx];
-            Scalar rcutsq = h_rcutsq.data[typpair_idx];
-            Scalar ronsq = Scalar(0.0);
-            if (m_shift_mode == xplor)
-                ronsq = h_ronsq.data[typpair_idx];
+            // truncate the batch at the first neighbor past the stopping distance and
+            // skip the remainder of the row
+            bool row_done = false;
+            if (nlist_sorted)
+                {
+                unsigned int stop = 0;
+                while (stop < n_lanes && b_rsq[stop] <= row_stop_sq)
+                    stop++;
+                if (stop < n_lanes)
+                    {
+                    n_lanes = stop;
+                    row_done = true;
+                    }
+                }
 
-            // design specifies that energies are shifted if
-            // 1) shift mode is set to shift
-            // or 2) shift mode is explor and ron > rcut
-            bool energy_shift = false;
-            if (m_shift_mode == shift)
-                energy_shift = true;
-            else if (m_shift_mode == xplor)
+            // evaluation pass: lanes are independent, so the inlined evaluator
+            // vectorizes across them
+            for (unsigned int lane = 0; lane < n_lanes; lane++)
                 {
-                if (ronsq > rcutsq)
+                // get parameters for this type pair
+                unsigned int typpair_idx = b_typpair[lane];
+                const param_type& param = m_params[typpair_idx];
+                Scalar rcutsq = h_rcutsq.data[typpair_idx];
+
+                // design specifies that energies are shifted if
+                // 1) shift mode is set to shift
+                // or 2) shift mode is explor and ron > rcut
+                bool energy_shift = false;
+                if (m_shift_mode == shift)
                     energy_shift = true;
-                }
+                else if (m_shift_mode == xplor)
+                    {
+                    if (h_ronsq.data[typpair_idx] > rcutsq)
+                        energy_shift = true;
+                    }
 
-            // compute the force and potential energy
-            Scalar force_divr = Scalar(0.0);
-            Scalar pair_eng = Scalar(0.0);
-            evaluator eval(rsq, rcutsq, param);
-            if (evaluator::needsCharge())
-                eval.setCharge(qi, qj);
+                // compute the force and potential energy
+                Scalar force_divr = Scalar(0.0);
+                Scalar pair_eng = Scalar(0.0);
+                evaluator eval(b_rsq[lane], rcutsq, param);
+                if (evaluator::needsCharge())
+                    eval.setCharge(qi, b_qj[lane]);
 
-            bool evaluated = eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
+                b_evaluated[lane] = eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
+                b_force_divr[lane] = force_divr;
+                b_pair_eng[lane] = pair_eng;
+                }
 
-            if (evaluated)
+            // accumulation pass: XPLOR smoothing and the third law scatter stay scalar
+            for (unsigned int lane = 0; lane < n_lanes; lane++)
                 {
+                if (!b_evaluated[lane])
+                    continue;
+
+                Scalar3 dx = make_scalar3(b_dx_x[lane], b_dx_y[lane], b_dx_z[lane]);
+                Scalar rsq = b_rsq[lane];
+                Scalar force_divr = b_force_divr[lane];
+                Scalar pair_eng = b_pair_eng[lane];
+
                 // modify the potential for xplor shifting
                 if (m_shift_mode == xplor)
                     {
+                    Scalar rcutsq = h_rcutsq.data[b_typpair[lane]];
+                    Scalar ronsq = h_ronsq.data[b_typpair[lane]];
                     if (rsq >= ronsq && rsq < rcutsq)
                         {
                         // Implement XPLOR smoothing (FLOPS: 16)
@@ -753,6 +923,7 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
 
                 // add the force to particle j if we are using the third law (MEM TRANSFER: 10
                 // scalars / FLOPS: 8) only add force to local particles
+                unsigned int j = b_j[lane];
                 if (third_law && j < m_pdata->getN())
                     {
                     unsigned int mem_idx = j;
@@ -771,6 +942,9 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
                         }
                     }
                 }
+
+            if (row_done)
+                break;
             }
 
         // finally, increment the force, potential energy and virial for particle i
@@ -788,7 +962,49 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
             h_virial.data[4 * m_virial_pitch + mem_idx] += virialyzi;
             h_virial.data[5 * m_virial_pitch + mem_idx] += virialzzi;
             }
-        }
+        };
+
+    // dispatch on the periodicity once, outside the per-particle loops
+    const uchar3 periodic = box.getPeriodic();
+    const bool fully_periodic = periodic.x && periodic.y && periodic.z;
+
+    auto compute_all = [&](auto periodic_tag)
+        {
+#ifdef ENABLE_TBB
+        if (!third_law)
+            {
+            // with full storage each particle writes only its own force and virial, so the
+            // per-particle loop runs in parallel on the persistent task arena
+            // fixed-size chunks with a simple partitioner keep every chunk an
+            // independently stealable task, so threads finishing dilute regions pull
+            // work from dense ones instead of waiting on an unbalanced static split
+            m_exec_conf->getTaskArena()->execute(
+                [&]
+                {
+                    tbb::parallel_for(
+                        tbb::blocked_range<int>(0, (int)m_pdata->getN(),
+                                                ExecutionConfiguration::work_stealing_chunk_size),
+                        [&](const tbb::blocked_range<int>& r)
+                        {
+                            for (int i = r.begin(); i != r.end(); ++i)
+                                compute_particle(i, periodic_tag);
+                        },
+                        tbb::simple_partitioner());
+                });
+            }
+        else
+#endif
+            {
+            // for each particle
+            for (int i = 0; i < (int)m_pdata->getN(); i++)
+                compute_particle(i, periodic_tag);
+            }
+        };
+
+    if (fully_periodic)
+        compute_all(std::true_type());
+    else
+        compute_all(std::false_type());
 
     computeTailCorrection();
     }
@@ -1021,6 +1237,7 @@ template<class T> void export_PotentialPair(pybind11::module& m, const std::stri
     potentialpair
         .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<NeighborList>>())
         .def("setParams", &PotentialPair<T>::setParamsPython)
+        .def("setParamsBatch", &PotentialPair<T>::setParamsBatchPython)
         .def("getParams", &PotentialPair<T>::getParams)
         .def("setRCut", &PotentialPair<T>::setRCutPython)
         .def("getRCut", &PotentialPair<T>::getRCut)
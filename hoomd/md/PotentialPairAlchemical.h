@@ -31,6 +31,7 @@ template<class evaluator> struct AlchemyPackage
     std::vector<std::array<Scalar, evaluator::num_alchemical_parameters>> alphas = {};
     std::vector<ArrayHandle<Scalar>> force_handles = {};
     std::vector<std::bitset<evaluator::num_alchemical_parameters>> compute_mask = {};
+    std::vector<typename evaluator::param_type> mod_params = {};
 
     AlchemyPackage(std::nullptr_t) {};
     AlchemyPackage() {};
@@ -231,6 +232,20 @@ inline extra_pkg PotentialPairAlchemical<evaluator, extra_pkg, alpha_particle_ty
                 pkg.force_handles.push_back(ArrayHandle<Scalar>(GlobalArray<Scalar>()));
                 }
         }
+    else
+        {
+        // no derivatives are scheduled this step: pre-scale the pair parameters once per
+        // type pair so the neighbor loop can construct evaluators from them directly and
+        // skip the per-neighbor alchemical parameter update
+        pkg.mod_params.resize(m_typpair_idx.getNumElements());
+        for (unsigned int i = 0; i < m_pdata->getNTypes(); i++)
+            for (unsigned int j = 0; j < m_pdata->getNTypes(); j++)
+                {
+                pkg.mod_params[m_typpair_idx(i, j)]
+                    = evaluator::updateAlchemyParams(m_params[m_typpair_idx(i, j)],
+                                                     pkg.alphas[m_alchemy_index(i, j)]);
+                }
+        }
     return pkg;
     }
 
@@ -244,12 +259,17 @@ inline void PotentialPairAlchemical<evaluator, extra_pkg, alpha_particle_type>::
     evaluator& eval,
     extra_pkg& pkg)
     {
+    // on steps without scheduled derivatives the evaluator was constructed from
+    // pre-scaled parameters, so there is no per-neighbor alchemical work to do
+    if (!pkg.calculate_derivatives)
+        return;
+
     unsigned int alchemy_index = m_alchemy_index(typei, typej);
     mask_type& mask {pkg.compute_mask[alchemy_index]};
     alpha_array_t& alphas {pkg.alphas[alchemy_index]};
 
     // calculate alchemical derivatives if needed
-    if (pkg.calculate_derivatives && in_rcut && mask.any())
+    if (in_rcut && mask.any())
         {
         std::array<Scalar, evaluator::num_alchemical_parameters> alchemical_derivatives = {};
         eval.evalAlchemyDerivatives(alchemical_derivatives, alphas);
@@ -381,9 +401,11 @@ void PotentialPairAlchemical<evaluator, extra_pkg, alpha_particle_type>::compute
             // calculate r_ij squared (FLOPS: 5)
             Scalar rsq = dot(dx, dx);
 
-            // get parameters for this type pair
+            // get parameters for this type pair; on derivative steps the evaluator scales
+            // the base parameters itself, otherwise use the pre-scaled copies
             unsigned int typpair_idx = m_typpair_idx(typei, typej);
-            const auto& param = m_params[typpair_idx];
+            const auto& param = pkg.calculate_derivatives ? m_params[typpair_idx]
+                                                          : pkg.mod_params[typpair_idx];
             Scalar rcutsq = h_rcutsq.data[typpair_idx];
             Scalar ronsq = Scalar(0.0);
             if (m_shift_mode == xplor)
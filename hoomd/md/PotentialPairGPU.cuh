@@ -64,14 +64,16 @@ struct pair_args_t
                 const unsigned int _compute_virial,
                 const unsigned int _threads_per_particle,
                 const GPUPartition& _gpu_partition,
-                const hipDeviceProp_t& _devprop)
+                const hipDeviceProp_t& _devprop,
+                const hipStream_t _stream = 0,
+                const unsigned int* _d_index = nullptr)
         : d_force(_d_force), d_virial(_d_virial), virial_pitch(_virial_pitch), N(_N), n_max(_n_max),
           d_pos(_d_pos), d_charge(_d_charge), box(_box), d_n_neigh(_d_n_neigh), d_nlist(_d_nlist),
           d_head_list(_d_head_list), d_rcutsq(_d_rcutsq), d_ronsq(_d_ronsq),
           size_neigh_list(_size_neigh_list), ntypes(_ntypes), block_size(_block_size),
           shift_mode(_shift_mode), compute_virial(_compute_virial),
           threads_per_particle(_threads_per_particle), gpu_partition(_gpu_partition),
-          devprop(_devprop) {};
+          devprop(_devprop), stream(_stream), d_index(_d_index) {};
 
     Scalar4* d_force;          //!< Force to write out
     Scalar* d_virial;          //!< Virial to write out
@@ -95,6 +97,8 @@ struct pair_args_t
     const unsigned int threads_per_particle; //!< Number of threads per particle (maximum: 1 warp)
     const GPUPartition& gpu_partition; //!< The load balancing partition of particles between GPUs
     const hipDeviceProp_t& devprop;    //!< CUDA device properties
+    const hipStream_t stream;          //!< Stream to launch the kernel on
+    const unsigned int* d_index; //!< Optional map from thread group to particle index (may be null)
     };
 
 #ifdef __HIPCC__
@@ -118,6 +122,9 @@ struct pair_args_t
     \param d_ronsq ron squared, stored per type pair
     \param ntypes Number of types in the simulation
     \param offset Offset of first particle
+    \param d_index Map from thread group to particle index, used to dispatch bins of particles
+        with similar neighbor counts in separate waves. When null, thread groups map directly to
+        particle indices \a offset through \a offset + \a N - 1.
 
     \a d_params, \a d_rcutsq, and \a d_ronsq must be indexed with an Index2DUpperTriangular(typei,
    typej) to access the unique value for that type pair. These values are all cached into shared
@@ -131,6 +138,10 @@ struct pair_args_t
    is enabled (See PotentialPair for a discussion on what that entails) \tparam compute_virial When
    non-zero, the virial tensor is computed. When zero, the virial tensor is not computed. \tparam
    tpp Number of threads to use per particle, must be power of 2 and smaller than warp size
+   \tparam static_ntypes When positive, the number of types baked in at compile time (must equal
+   \a ntypes). The type pair indexing then folds to constants, and for a single type the cutoff
+   and parameters are hoisted into registers ahead of the neighbor loop. 0 keeps the generic
+   runtime indexing.
 
     <b>Implementation details</b>
     Each block will calculate the forces on a block of particles.
@@ -141,7 +152,8 @@ template<class evaluator,
          unsigned int shift_mode,
          unsigned int compute_virial,
          int tpp,
-         bool enable_shared_cache>
+         bool enable_shared_cache,
+         int static_ntypes = 0>
 __global__ void
 gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
                                       Scalar* d_virial,
@@ -158,9 +170,11 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
                                       const Scalar* d_ronsq,
                                       const unsigned int ntypes,
                                       const unsigned int offset,
-                                      unsigned int max_extra_bytes)
+                                      unsigned int max_extra_bytes,
+                                      const unsigned int* d_index)
     {
-    Index2D typpair_idx(ntypes);
+    // when specialized, the type pair indexing is folded at compile time
+    Index2D typpair_idx((static_ntypes > 0) ? (unsigned int)static_ntypes : ntypes);
     const unsigned int num_typ_parameters = typpair_idx.getNumElements();
 
     // shared arrays for per type pair parameters
@@ -216,8 +230,17 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
         active = false;
         }
 
-    // add offset to get actual particle index
-    idx += offset;
+    if (d_index != nullptr)
+        {
+        // look up the particle this thread group handles in the dispatch bin
+        if (active)
+            idx = __ldg(d_index + idx);
+        }
+    else
+        {
+        // add offset to get actual particle index
+        idx += offset;
+        }
 
     // initialize the force to 0
     Scalar4 force = make_scalar4(Scalar(0.0), Scalar(0.0), Scalar(0.0), Scalar(0.0));
@@ -231,7 +254,7 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
     if (active)
         {
         // load in the length of the neighbor list
-        unsigned int n_neigh = d_n_neigh[idx];
+        unsigned int n_neigh = __ldg(d_n_neigh + idx);
 
         // read in the position of our particle.
         Scalar4 postypei = __ldg(d_pos + idx);
@@ -241,6 +264,28 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
         if (evaluator::needsCharge())
             qi = __ldg(d_charge + idx);
 
+        // a single-type simulation has exactly one parameter set, keep it in registers
+        Scalar rcutsq_single(0.0);
+        Scalar ronsq_single(0.0);
+        const typename evaluator::param_type* param_single = nullptr;
+        if (static_ntypes == 1)
+            {
+            if (enable_shared_cache)
+                {
+                rcutsq_single = s_rcutsq[0];
+                param_single = s_params;
+                if (shift_mode == 2)
+                    ronsq_single = s_ronsq[0];
+                }
+            else
+                {
+                rcutsq_single = __ldg(d_rcutsq);
+                param_single = d_params;
+                if (shift_mode == 2)
+                    ronsq_single = __ldg(d_ronsq);
+                }
+            }
+
         size_t my_head = d_head_list[idx];
         unsigned int cur_j = 0;
 
@@ -275,27 +320,39 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
                 Scalar rsq = dot(dx, dx);
 
                 // access the per type pair parameters
-                unsigned int typpair
-                    = typpair_idx(__scalar_as_int(postypei.w), __scalar_as_int(postypej.w));
                 Scalar rcutsq;
                 const typename evaluator::param_type* param = nullptr;
                 Scalar ronsq = Scalar(0.0);
 
-                if (enable_shared_cache)
+                if (static_ntypes == 1)
                     {
-                    rcutsq = s_rcutsq[typpair];
-                    param = s_params + typpair;
+                    rcutsq = rcutsq_single;
+                    param = param_single;
 
                     if (shift_mode == 2)
-                        ronsq = s_ronsq[typpair];
+                        ronsq = ronsq_single;
                     }
                 else
                     {
-                    rcutsq = d_rcutsq[typpair];
-                    param = d_params + typpair;
+                    unsigned int typpair
+                        = typpair_idx(__scalar_as_int(postypei.w), __scalar_as_int(postypej.w));
 
-                    if (shift_mode == 2)
-                        ronsq = d_ronsq[typpair];
+                    if (enable_shared_cache)
+                        {
+                        rcutsq = s_rcutsq[typpair];
+                        param = s_params + typpair;
+
+                        if (shift_mode == 2)
+                            ronsq = s_ronsq[typpair];
+                        }
+                    else
+                        {
+                        rcutsq = __ldg(d_rcutsq + typpair);
+                        param = d_params + typpair;
+
+                        if (shift_mode == 2)
+                            ronsq = __ldg(d_ronsq + typpair);
+                        }
                     }
 
                 // design specifies that energies are shifted if
@@ -403,6 +460,220 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
         }
     }
 
+//! Kernel for calculating pair forces without a neighbor list
+/*! This kernel computes the pair forces on all N particles with a brute force O(N^2) loop,
+    staging tiles of particle data through shared memory in the style of the classic all-pairs
+    N-body kernel. It is profitable for small systems, where building a cell list and traversing
+    a neighbor list costs more than simply evaluating every pair.
+
+    \param d_force Device memory to write computed forces
+    \param d_virial Device memory to write computed virials
+    \param virial_pitch pitch of 2D virial array
+    \param N number of particles in system
+    \param d_pos particle positions
+    \param d_charge particle charges
+    \param box Box dimensions used to implement periodic boundary conditions
+    \param d_params Parameters for the potential, stored per type pair
+    \param d_rcutsq rcut squared, stored per type pair
+    \param d_ronsq ron squared, stored per type pair
+    \param ntypes Number of types in the simulation
+
+    Each thread computes the full force on one particle. The block cooperatively loads tiles of
+    blockDim.x positions (and charges, when the evaluator needs them) into shared memory and every
+    thread interacts its particle with the tile. Per type pair parameters are read through the
+    texture cache: the systems this kernel targets are small, so the parameter reads hit cache
+    after the first tile.
+
+    This kernel does not support neighbor list exclusions; the host code must fall back to the
+    neighbor list kernel when exclusions are set.
+*/
+template<class evaluator, unsigned int shift_mode, unsigned int compute_virial>
+__global__ void gpu_compute_pair_forces_all_pairs_kernel(Scalar4* d_force,
+                                                         Scalar* d_virial,
+                                                         const size_t virial_pitch,
+                                                         const unsigned int N,
+                                                         const Scalar4* d_pos,
+                                                         const Scalar* d_charge,
+                                                         const BoxDim box,
+                                                         const typename evaluator::param_type*
+                                                             d_params,
+                                                         const Scalar* d_rcutsq,
+                                                         const Scalar* d_ronsq,
+                                                         const unsigned int ntypes)
+    {
+    Index2D typpair_idx(ntypes);
+
+    // shared memory tile of particle data
+    HIP_DYNAMIC_SHARED(char, s_data)
+    Scalar4* s_postype = (Scalar4*)(&s_data[0]);
+    Scalar* s_charge = (Scalar*)(s_postype + blockDim.x);
+
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    bool active = idx < N;
+
+    // read in the position of our particle.
+    Scalar4 postypei
+        = active ? __ldg(d_pos + idx) : make_scalar4(Scalar(0.0), Scalar(0.0), Scalar(0.0), Scalar(0.0));
+    Scalar3 posi = make_scalar3(postypei.x, postypei.y, postypei.z);
+
+    Scalar qi = Scalar(0);
+    if (evaluator::needsCharge() && active)
+        qi = __ldg(d_charge + idx);
+
+    // initialize the force to 0
+    Scalar4 force = make_scalar4(Scalar(0.0), Scalar(0.0), Scalar(0.0), Scalar(0.0));
+    Scalar virialxx = Scalar(0.0);
+    Scalar virialxy = Scalar(0.0);
+    Scalar virialxz = Scalar(0.0);
+    Scalar virialyy = Scalar(0.0);
+    Scalar virialyz = Scalar(0.0);
+    Scalar virialzz = Scalar(0.0);
+
+    // loop over all particles in tiles of blockDim.x
+    for (unsigned int tile_start = 0; tile_start < N; tile_start += blockDim.x)
+        {
+        // cooperatively load the tile
+        unsigned int load_idx = tile_start + threadIdx.x;
+        if (load_idx < N)
+            {
+            s_postype[threadIdx.x] = __ldg(d_pos + load_idx);
+            if (evaluator::needsCharge())
+                s_charge[threadIdx.x] = __ldg(d_charge + load_idx);
+            }
+        __syncthreads();
+
+        unsigned int tile_size = min((unsigned int)blockDim.x, N - tile_start);
+
+        if (active)
+            {
+            for (unsigned int cur_tile = 0; cur_tile < tile_size; cur_tile++)
+                {
+                unsigned int cur_j = tile_start + cur_tile;
+
+                // exclude self interactions
+                if (cur_j == idx)
+                    continue;
+
+                // get the neighbor's position
+                Scalar4 postypej = s_postype[cur_tile];
+                Scalar3 posj = make_scalar3(postypej.x, postypej.y, postypej.z);
+
+                Scalar qj = Scalar(0.0);
+                if (evaluator::needsCharge())
+                    qj = s_charge[cur_tile];
+
+                // calculate dr (with periodic boundary conditions)
+                Scalar3 dx = posi - posj;
+
+                // apply periodic boundary conditions
+                dx = box.minImage(dx);
+
+                // calculate r squared
+                Scalar rsq = dot(dx, dx);
+
+                // access the per type pair parameters
+                unsigned int typpair
+                    = typpair_idx(__scalar_as_int(postypei.w), __scalar_as_int(postypej.w));
+                Scalar rcutsq = __ldg(d_rcutsq + typpair);
+                const typename evaluator::param_type* param = d_params + typpair;
+                Scalar ronsq = Scalar(0.0);
+                if (shift_mode == 2)
+                    ronsq = __ldg(d_ronsq + typpair);
+
+                // skip pairs outside the cutoff without constructing the evaluator
+                if (rsq >= rcutsq)
+                    continue;
+
+                // design specifies that energies are shifted if
+                // 1) shift mode is set to shift
+                // or 2) shift mode is explor and ron > rcut
+                bool energy_shift = false;
+                if (shift_mode == 1)
+                    energy_shift = true;
+                else if (shift_mode == 2)
+                    {
+                    if (ronsq > rcutsq)
+                        energy_shift = true;
+                    }
+
+                // evaluate the potential
+                Scalar force_divr = Scalar(0.0);
+                Scalar pair_eng = Scalar(0.0);
+
+                evaluator eval(rsq, rcutsq, *param);
+                if (evaluator::needsCharge())
+                    eval.setCharge(qi, qj);
+
+                eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
+
+                if (shift_mode == 2)
+                    {
+                    if (rsq >= ronsq && rsq < rcutsq)
+                        {
+                        // Implement XPLOR smoothing
+                        Scalar old_pair_eng = pair_eng;
+                        Scalar old_force_divr = force_divr;
+
+                        // calculate 1.0 / (xplor denominator)
+                        Scalar xplor_denom_inv
+                            = Scalar(1.0)
+                              / ((rcutsq - ronsq) * (rcutsq - ronsq) * (rcutsq - ronsq));
+
+                        Scalar rsq_minus_r_cut_sq = rsq - rcutsq;
+                        Scalar s = rsq_minus_r_cut_sq * rsq_minus_r_cut_sq
+                                   * (rcutsq + Scalar(2.0) * rsq - Scalar(3.0) * ronsq)
+                                   * xplor_denom_inv;
+                        Scalar ds_dr_divr
+                            = Scalar(12.0) * (rsq - ronsq) * rsq_minus_r_cut_sq * xplor_denom_inv;
+
+                        // make modifications to the old pair energy and force
+                        pair_eng = old_pair_eng * s;
+                        force_divr = s * old_force_divr - ds_dr_divr * old_pair_eng;
+                        }
+                    }
+                // calculate the virial
+                if (compute_virial)
+                    {
+                    Scalar force_div2r = Scalar(0.5) * force_divr;
+                    virialxx += dx.x * dx.x * force_div2r;
+                    virialxy += dx.x * dx.y * force_div2r;
+                    virialxz += dx.x * dx.z * force_div2r;
+                    virialyy += dx.y * dx.y * force_div2r;
+                    virialyz += dx.y * dx.z * force_div2r;
+                    virialzz += dx.z * dx.z * force_div2r;
+                    }
+
+                // add up the force vector components
+                force.x += dx.x * force_divr;
+                force.y += dx.y * force_divr;
+                force.z += dx.z * force_divr;
+
+                force.w += pair_eng;
+                }
+            }
+        __syncthreads();
+        }
+
+    // potential energy per particle must be halved
+    force.w *= Scalar(0.5);
+
+    // now that the force calculation is complete, write out the result
+    if (active)
+        {
+        d_force[idx] = force;
+
+        if (compute_virial)
+            {
+            d_virial[0 * virial_pitch + idx] = virialxx;
+            d_virial[1 * virial_pitch + idx] = virialxy;
+            d_virial[2 * virial_pitch + idx] = virialxz;
+            d_virial[3 * virial_pitch + idx] = virialyy;
+            d_virial[4 * virial_pitch + idx] = virialyz;
+            d_virial[5 * virial_pitch + idx] = virialzz;
+            }
+        }
+    }
+
 template<typename T> int get_max_block_size(T func)
     {
     hipFuncAttributes attr;
@@ -435,117 +706,150 @@ struct PairForceComputeKernel
      * \param d_params Parameters for the potential, stored per type pair
      */
 
-    static void launch(const pair_args_t& pair_args,
-                       std::pair<unsigned int, unsigned int> range,
-                       const typename evaluator::param_type* d_params)
+    //! Launch the kernel with the number of types baked in at compile time
+    /*! \tparam static_ntypes Compile-time number of types (must equal pair_args.ntypes when
+            positive), 0 falls back to runtime type pair indexing
+     */
+    template<int static_ntypes>
+    static void launch_ntypes(const pair_args_t& pair_args,
+                              std::pair<unsigned int, unsigned int> range,
+                              const typename evaluator::param_type* d_params)
         {
         unsigned int N = range.second - range.first;
         unsigned int offset = range.first;
 
-        if (tpp == pair_args.threads_per_particle)
+        unsigned int block_size = pair_args.block_size;
+        bool enable_shared_cache = true;
+
+        Index2D typpair_idx(pair_args.ntypes);
+        size_t param_shared_bytes = (2 * sizeof(Scalar) + sizeof(typename evaluator::param_type))
+                                    * typpair_idx.getNumElements();
+
+        unsigned int max_block_size;
+        max_block_size
+            = get_max_block_size(gpu_compute_pair_forces_shared_kernel<evaluator,
+                                                                       shift_mode,
+                                                                       compute_virial,
+                                                                       tpp,
+                                                                       true,
+                                                                       static_ntypes>);
+
+        hipFuncAttributes attr;
+        hipFuncGetAttributes(
+            &attr,
+            reinterpret_cast<const void*>(&gpu_compute_pair_forces_shared_kernel<evaluator,
+                                                                                 shift_mode,
+                                                                                 compute_virial,
+                                                                                 tpp,
+                                                                                 true,
+                                                                                 static_ntypes>));
+
+        if (param_shared_bytes + attr.sharedSizeBytes > pair_args.devprop.sharedMemPerBlock)
             {
-            unsigned int block_size = pair_args.block_size;
-            bool enable_shared_cache = true;
-
-            Index2D typpair_idx(pair_args.ntypes);
-            size_t param_shared_bytes
-                = (2 * sizeof(Scalar) + sizeof(typename evaluator::param_type))
-                  * typpair_idx.getNumElements();
-
-            unsigned int max_block_size;
-            max_block_size
-                = get_max_block_size(gpu_compute_pair_forces_shared_kernel<evaluator,
-                                                                           shift_mode,
-                                                                           compute_virial,
-                                                                           tpp,
-                                                                           true>);
-
-            hipFuncAttributes attr;
-            hipFuncGetAttributes(
-                &attr,
-                reinterpret_cast<const void*>(&gpu_compute_pair_forces_shared_kernel<evaluator,
-                                                                                     shift_mode,
-                                                                                     compute_virial,
-                                                                                     tpp,
-                                                                                     true>));
-
-            if (param_shared_bytes + attr.sharedSizeBytes > pair_args.devprop.sharedMemPerBlock)
-                {
-                param_shared_bytes = 0;
-                enable_shared_cache = false;
-                }
+            param_shared_bytes = 0;
+            enable_shared_cache = false;
+            }
 
-            unsigned int max_extra_bytes = static_cast<unsigned int>(
-                pair_args.devprop.sharedMemPerBlock - param_shared_bytes - attr.sharedSizeBytes);
+        unsigned int max_extra_bytes = static_cast<unsigned int>(
+            pair_args.devprop.sharedMemPerBlock - param_shared_bytes - attr.sharedSizeBytes);
 
-            // determine dynamically requested shared memory in nested managed arrays
-            char* ptr = nullptr;
-            unsigned int available_bytes = max_extra_bytes;
-            for (unsigned int i = 0; i < typpair_idx.getNumElements(); ++i)
-                {
-                d_params[i].allocate_shared(ptr, available_bytes);
-                }
+        // determine dynamically requested shared memory in nested managed arrays
+        char* ptr = nullptr;
+        unsigned int available_bytes = max_extra_bytes;
+        for (unsigned int i = 0; i < typpair_idx.getNumElements(); ++i)
+            {
+            d_params[i].allocate_shared(ptr, available_bytes);
+            }
 
-            unsigned int extra_shared_bytes = max_extra_bytes - available_bytes;
+        unsigned int extra_shared_bytes = max_extra_bytes - available_bytes;
 
-            block_size = block_size < max_block_size ? block_size : max_block_size;
-            dim3 grid(N / (block_size / tpp) + 1, 1, 1);
+        block_size = block_size < max_block_size ? block_size : max_block_size;
+        dim3 grid(N / (block_size / tpp) + 1, 1, 1);
 
-            if (enable_shared_cache)
-                {
-                hipLaunchKernelGGL((gpu_compute_pair_forces_shared_kernel<evaluator,
-                                                                          shift_mode,
-                                                                          compute_virial,
-                                                                          tpp,
-                                                                          true>),
-                                   dim3(grid),
-                                   dim3(block_size),
-                                   param_shared_bytes + extra_shared_bytes,
-                                   0,
-                                   pair_args.d_force,
-                                   pair_args.d_virial,
-                                   pair_args.virial_pitch,
-                                   N,
-                                   pair_args.d_pos,
-                                   pair_args.d_charge,
-                                   pair_args.box,
-                                   pair_args.d_n_neigh,
-                                   pair_args.d_nlist,
-                                   pair_args.d_head_list,
-                                   d_params,
-                                   pair_args.d_rcutsq,
-                                   pair_args.d_ronsq,
-                                   pair_args.ntypes,
-                                   offset,
-                                   max_extra_bytes);
-                }
-            else
+        if (enable_shared_cache)
+            {
+            hipLaunchKernelGGL((gpu_compute_pair_forces_shared_kernel<evaluator,
+                                                                      shift_mode,
+                                                                      compute_virial,
+                                                                      tpp,
+                                                                      true,
+                                                                      static_ntypes>),
+                               dim3(grid),
+                               dim3(block_size),
+                               param_shared_bytes + extra_shared_bytes,
+                               pair_args.stream,
+                               pair_args.d_force,
+                               pair_args.d_virial,
+                               pair_args.virial_pitch,
+                               N,
+                               pair_args.d_pos,
+                               pair_args.d_charge,
+                               pair_args.box,
+                               pair_args.d_n_neigh,
+                               pair_args.d_nlist,
+                               pair_args.d_head_list,
+                               d_params,
+                               pair_args.d_rcutsq,
+                               pair_args.d_ronsq,
+                               pair_args.ntypes,
+                               offset,
+                               max_extra_bytes,
+                               pair_args.d_index);
+            }
+        else
+            {
+            hipLaunchKernelGGL((gpu_compute_pair_forces_shared_kernel<evaluator,
+                                                                      shift_mode,
+                                                                      compute_virial,
+                                                                      tpp,
+                                                                      false,
+                                                                      static_ntypes>),
+                               dim3(grid),
+                               dim3(block_size),
+                               param_shared_bytes + extra_shared_bytes,
+                               pair_args.stream,
+                               pair_args.d_force,
+                               pair_args.d_virial,
+                               pair_args.virial_pitch,
+                               N,
+                               pair_args.d_pos,
+                               pair_args.d_charge,
+                               pair_args.box,
+                               pair_args.d_n_neigh,
+                               pair_args.d_nlist,
+                               pair_args.d_head_list,
+                               d_params,
+                               pair_args.d_rcutsq,
+                               pair_args.d_ronsq,
+                               pair_args.ntypes,
+                               offset,
+                               max_extra_bytes,
+                               pair_args.d_index);
+            }
+        }
+
+    static void launch(const pair_args_t& pair_args,
+                       std::pair<unsigned int, unsigned int> range,
+                       const typename evaluator::param_type* d_params)
+        {
+        if (tpp == pair_args.threads_per_particle)
+            {
+            // specialize the kernel for small type counts, single-component systems being the
+            // most common case
+            switch (pair_args.ntypes)
                 {
-                hipLaunchKernelGGL((gpu_compute_pair_forces_shared_kernel<evaluator,
-                                                                          shift_mode,
-                                                                          compute_virial,
-                                                                          tpp,
-                                                                          false>),
-                                   dim3(grid),
-                                   dim3(block_size),
-                                   param_shared_bytes + extra_shared_bytes,
-                                   0,
-                                   pair_args.d_force,
-                                   pair_args.d_virial,
-                                   pair_args.virial_pitch,
-                                   N,
-                                   pair_args.d_pos,
-                                   pair_args.d_charge,
-                                   pair_args.box,
-                                   pair_args.d_n_neigh,
-                                   pair_args.d_nlist,
-                                   pair_args.d_head_list,
-                                   d_params,
-                                   pair_args.d_rcutsq,
-                                   pair_args.d_ronsq,
-                                   pair_args.ntypes,
-                                   offset,
-                                   max_extra_bytes);
+            case 1:
+                launch_ntypes<1>(pair_args, range, d_params);
+                break;
+            case 2:
+                launch_ntypes<2>(pair_args, range, d_params);
+                break;
+            case 3:
+                launch_ntypes<3>(pair_args, range, d_params);
+                break;
+            default:
+                launch_ntypes<0>(pair_args, range, d_params);
+                break;
                 }
             }
         else
@@ -654,11 +958,204 @@ gpu_compute_pair_forces(const pair_args_t& pair_args,
 
     return hipSuccess;
     }
+
+//! Kernel driver that computes pair forces for one neighbor count dispatch bin
+/*! \param pair_args Arguments to pass onto the kernel. \a N is the number of particles in the
+        bin, \a d_index maps thread groups to the particle indices of the bin members, and
+        \a threads_per_particle holds the parallelism chosen for this bin.
+    \param d_params Parameters for the potential, stored per type pair
+
+    Unlike gpu_compute_pair_forces(), this driver does not walk the GPU partition: the caller
+    dispatches bins of particles with similar neighbor counts in separate waves on a single GPU,
+    so the launch covers exactly the \a N thread groups of the bin.
+*/
+template<class evaluator>
+__attribute__((visibility("default"))) hipError_t
+gpu_compute_pair_forces_bin(const pair_args_t& pair_args,
+                            const typename evaluator::param_type* d_params)
+    {
+    assert(d_params);
+    assert(pair_args.d_rcutsq);
+    assert(pair_args.d_ronsq);
+    assert(pair_args.d_index);
+    assert(pair_args.ntypes > 0);
+
+    std::pair<unsigned int, unsigned int> range(0, pair_args.N);
+
+    if (pair_args.compute_virial)
+        {
+        switch (pair_args.shift_mode)
+            {
+        case 0:
+            PairForceComputeKernel<evaluator, 0, 1, gpu_pair_force_max_tpp>::launch(pair_args,
+                                                                                    range,
+                                                                                    d_params);
+            break;
+        case 1:
+            PairForceComputeKernel<evaluator, 1, 1, gpu_pair_force_max_tpp>::launch(pair_args,
+                                                                                    range,
+                                                                                    d_params);
+            break;
+        case 2:
+            PairForceComputeKernel<evaluator, 2, 1, gpu_pair_force_max_tpp>::launch(pair_args,
+                                                                                    range,
+                                                                                    d_params);
+            break;
+        default:
+            break;
+            }
+        }
+    else
+        {
+        switch (pair_args.shift_mode)
+            {
+        case 0:
+            PairForceComputeKernel<evaluator, 0, 0, gpu_pair_force_max_tpp>::launch(pair_args,
+                                                                                    range,
+                                                                                    d_params);
+            break;
+        case 1:
+            PairForceComputeKernel<evaluator, 1, 0, gpu_pair_force_max_tpp>::launch(pair_args,
+                                                                                    range,
+                                                                                    d_params);
+            break;
+        case 2:
+            PairForceComputeKernel<evaluator, 2, 0, gpu_pair_force_max_tpp>::launch(pair_args,
+                                                                                    range,
+                                                                                    d_params);
+            break;
+        default:
+            break;
+            }
+        }
+
+    return hipSuccess;
+    }
+
+//! All-pairs force compute kernel launcher
+/*!
+ * \tparam evaluator EvaluatorPair class to evaluate V(r) and -delta V(r)/r
+ * \tparam shift_mode 0: No energy shifting is done. 1: V(r) is shifted to be 0 at rcut. 2: XPLOR
+ * switching is enabled (See PotentialPair for a discussion on what that entails) \tparam
+ * compute_virial When non-zero, the virial tensor is computed. When zero, the virial tensor is not
+ * computed.
+ */
+template<class evaluator, unsigned int shift_mode, unsigned int compute_virial>
+struct AllPairsForceComputeKernel
+    {
+    //! Launcher for the all-pairs force kernel
+    /*!
+     * \param pair_args Other arguments to pass onto the kernel (the neighbor list members are
+     *        ignored)
+     * \param d_params Parameters for the potential, stored per type pair
+     */
+    static void launch(const pair_args_t& pair_args,
+                       const typename evaluator::param_type* d_params)
+        {
+        unsigned int max_block_size = get_max_block_size(
+            gpu_compute_pair_forces_all_pairs_kernel<evaluator, shift_mode, compute_virial>);
+
+        unsigned int block_size = pair_args.block_size;
+        block_size = block_size < max_block_size ? block_size : max_block_size;
+
+        // shared memory for one tile of positions (and charges when needed)
+        size_t tile_shared_bytes = block_size * sizeof(Scalar4);
+        if (evaluator::needsCharge())
+            tile_shared_bytes += block_size * sizeof(Scalar);
+
+        dim3 grid(pair_args.N / block_size + 1, 1, 1);
+
+        hipLaunchKernelGGL(
+            (gpu_compute_pair_forces_all_pairs_kernel<evaluator, shift_mode, compute_virial>),
+            dim3(grid),
+            dim3(block_size),
+            tile_shared_bytes,
+            pair_args.stream,
+            pair_args.d_force,
+            pair_args.d_virial,
+            pair_args.virial_pitch,
+            pair_args.N,
+            pair_args.d_pos,
+            pair_args.d_charge,
+            pair_args.box,
+            d_params,
+            pair_args.d_rcutsq,
+            pair_args.d_ronsq,
+            pair_args.ntypes);
+        }
+    };
+
+//! Kernel driver that computes pair forces on the GPU without a neighbor list
+/*! \param pair_args Other arguments to pass onto the kernel (the neighbor list members are
+        ignored)
+    \param d_params Parameters for the potential, stored per type pair
+
+    This is just a driver function for gpu_compute_pair_forces_all_pairs_kernel(), see it for
+    details. The caller is responsible for only selecting this path when the system is small,
+    resides on a single GPU, and the neighbor list has no exclusions set.
+*/
+template<class evaluator>
+__attribute__((visibility("default"))) hipError_t
+gpu_compute_pair_forces_all_pairs(const pair_args_t& pair_args,
+                                  const typename evaluator::param_type* d_params)
+    {
+    assert(d_params);
+    assert(pair_args.d_rcutsq);
+    assert(pair_args.d_ronsq);
+    assert(pair_args.ntypes > 0);
+
+    if (pair_args.compute_virial)
+        {
+        switch (pair_args.shift_mode)
+            {
+        case 0:
+            AllPairsForceComputeKernel<evaluator, 0, 1>::launch(pair_args, d_params);
+            break;
+        case 1:
+            AllPairsForceComputeKernel<evaluator, 1, 1>::launch(pair_args, d_params);
+            break;
+        case 2:
+            AllPairsForceComputeKernel<evaluator, 2, 1>::launch(pair_args, d_params);
+            break;
+        default:
+            break;
+            }
+        }
+    else
+        {
+        switch (pair_args.shift_mode)
+            {
+        case 0:
+            AllPairsForceComputeKernel<evaluator, 0, 0>::launch(pair_args, d_params);
+            break;
+        case 1:
+            AllPairsForceComputeKernel<evaluator, 1, 0>::launch(pair_args, d_params);
+            break;
+        case 2:
+            AllPairsForceComputeKernel<evaluator, 2, 0>::launch(pair_args, d_params);
+            break;
+        default:
+            break;
+            }
+        }
+
+    return hipSuccess;
+    }
 #else
 template<class evaluator>
 __attribute__((visibility("default"))) hipError_t
 gpu_compute_pair_forces(const pair_args_t& pair_args,
                         const typename evaluator::param_type* d_params);
+
+template<class evaluator>
+__attribute__((visibility("default"))) hipError_t
+gpu_compute_pair_forces_bin(const pair_args_t& pair_args,
+                            const typename evaluator::param_type* d_params);
+
+template<class evaluator>
+__attribute__((visibility("default"))) hipError_t
+gpu_compute_pair_forces_all_pairs(const pair_args_t& pair_args,
+                                  const typename evaluator::param_type* d_params);
 #endif
 
     } // end namespace kernel
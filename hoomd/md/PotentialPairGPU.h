@@ -51,9 +51,45 @@ template<class evaluator> class PotentialPairGPU : public PotentialPair<evaluato
     //! Destructor
     virtual ~PotentialPairGPU() { }
 
+    //! Set whether particles are binned by neighbor count for dispatch
+    void setBinnedDispatch(bool binned_dispatch)
+        {
+        m_binned_dispatch = binned_dispatch;
+        m_bin_ranges.clear();
+        }
+
+    //! Get whether particles are binned by neighbor count for dispatch
+    bool getBinnedDispatch() const
+        {
+        return m_binned_dispatch;
+        }
+
     protected:
+    //! Range of one neighbor count dispatch bin
+    struct DispatchBin
+        {
+        unsigned int start; //!< Offset of the first bin member in m_bin_index
+        unsigned int size;  //!< Number of particles in the bin
+        unsigned int tpp;   //!< Threads per particle to launch for the bin
+        };
+
     std::shared_ptr<Autotuner<2>> m_tuner; //!< Autotuner for block size and threads per particle
 
+    /// System size below which the brute force all-pairs kernel replaces the neighbor list
+    unsigned int m_all_pairs_crossover = 8192;
+
+    /// Set to true to dispatch particles in bins of similar neighbor count
+    bool m_binned_dispatch = false;
+
+    GPUArray<unsigned int> m_bin_index;      //!< Particle indices grouped by dispatch bin
+    std::vector<DispatchBin> m_bin_ranges;   //!< The non-empty dispatch bins
+
+    //! Determine whether the brute force all-pairs kernel should be used this step
+    bool useAllPairs();
+
+    //! Rebuild the neighbor count dispatch bins
+    void updateDispatchBins();
+
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
     };
@@ -86,17 +122,100 @@ PotentialPairGPU<evaluator>::PotentialPairGPU(std::shared_ptr<SystemDefinition>
 #endif
     }
 
+/*! Small systems are computed with a brute force all-pairs kernel. Below the crossover size,
+    building the cell list and traversing the neighbor list costs more than simply evaluating
+    every pair directly. The all-pairs kernel does not implement exclusions, ghost particles, or
+    multi-GPU partitions, so the neighbor list path remains in use whenever any of those are
+    active.
+*/
+template<class evaluator> bool PotentialPairGPU<evaluator>::useAllPairs()
+    {
+    return this->m_pdata->getN() <= m_all_pairs_crossover && this->m_pdata->getNGhosts() == 0
+           && !this->m_nlist->getExclusionsSet() && this->m_exec_conf->getNumActiveGPUs() == 1;
+    }
+
+/*! Sort the local particles into bins keyed by the threads per particle appropriate for their
+    neighbor count, so that each bin can be launched as a separate kernel wave. A global tpp wastes
+    threads on sparse particles and starves dense ones in polydisperse systems where neighbor
+    counts vary widely across types. Each thread is sized to handle roughly four neighbors; the
+    resulting tpp is clamped to the warp limit.
+
+    The bins are rebuilt only on steps where the neighbor list was rebuilt, so the host read of
+    the neighbor count array amortizes over the lifetime of the list.
+*/
+template<class evaluator> void PotentialPairGPU<evaluator>::updateDispatchBins()
+    {
+    unsigned int nparticles = this->m_pdata->getN();
+
+    if (m_bin_index.getNumElements() < this->m_pdata->getMaxN())
+        {
+        GPUArray<unsigned int> bin_index(this->m_pdata->getMaxN(), this->m_exec_conf);
+        m_bin_index.swap(bin_index);
+        }
+
+    ArrayHandle<unsigned int> h_n_neigh(this->m_nlist->getNNeighArray(),
+                                        access_location::host,
+                                        access_mode::read);
+
+    // count the particles belonging to each power of two tpp value
+    const unsigned int max_tpp = kernel::gpu_pair_force_max_tpp;
+    auto tpp_for_count = [max_tpp](unsigned int n_neigh)
+        {
+        unsigned int tpp = 1;
+        while (tpp < max_tpp && tpp * 4 < n_neigh)
+            tpp *= 2;
+        return tpp;
+        };
+
+    std::vector<unsigned int> bin_count(max_tpp + 1, 0);
+    for (unsigned int i = 0; i < nparticles; i++)
+        bin_count[tpp_for_count(h_n_neigh.data[i])]++;
+
+    // assign each non-empty bin its range in the index array
+    m_bin_ranges.clear();
+    std::vector<unsigned int> bin_start(max_tpp + 1, 0);
+    unsigned int start = 0;
+    for (unsigned int tpp = 1; tpp <= max_tpp; tpp *= 2)
+        {
+        if (bin_count[tpp] > 0)
+            {
+            m_bin_ranges.push_back({start, bin_count[tpp], tpp});
+            bin_start[tpp] = start;
+            start += bin_count[tpp];
+            }
+        }
+
+    // counting sort of the particle indices into their bins
+    ArrayHandle<unsigned int> h_bin_index(m_bin_index,
+                                          access_location::host,
+                                          access_mode::overwrite);
+    for (unsigned int i = 0; i < nparticles; i++)
+        h_bin_index.data[bin_start[tpp_for_count(h_n_neigh.data[i])]++] = i;
+    }
+
 template<class evaluator> void PotentialPairGPU<evaluator>::computeForces(uint64_t timestep)
     {
-    this->m_nlist->compute(timestep);
+    bool all_pairs = useAllPairs();
 
-    // The GPU implementation CANNOT handle a half neighborlist, error out now
-    bool third_law = this->m_nlist->getStorageMode() == NeighborList::half;
-    if (third_law)
+    if (!all_pairs)
         {
-        this->m_exec_conf->msg->error()
-            << "PotentialPairGPU cannot handle a half neighborlist" << std::endl;
-        throw std::runtime_error("Error computing forces in PotentialPairGPU");
+        this->m_nlist->compute(timestep);
+
+        // The GPU implementation CANNOT handle a half neighborlist, error out now
+        bool third_law = this->m_nlist->getStorageMode() == NeighborList::half;
+        if (third_law)
+            {
+            this->m_exec_conf->msg->error()
+                << "PotentialPairGPU cannot handle a half neighborlist" << std::endl;
+            throw std::runtime_error("Error computing forces in PotentialPairGPU");
+            }
+        }
+
+    // The binned dispatch launches one wave per neighbor count bin on a single GPU
+    bool binned = m_binned_dispatch && !all_pairs && this->m_exec_conf->getNumActiveGPUs() == 1;
+    if (binned && (this->m_nlist->hasBeenUpdated(timestep) || m_bin_ranges.empty()))
+        {
+        updateDispatchBins();
         }
 
     // access the neighbor list
@@ -136,29 +255,74 @@ template<class evaluator> void PotentialPairGPU<evaluator>::computeForces(uint64
     unsigned int block_size = param[0];
     unsigned int threads_per_particle = param[1];
 
-    kernel::gpu_compute_pair_forces<evaluator>(
-        kernel::pair_args_t(d_force.data,
-                            d_virial.data,
-                            this->m_virial.getPitch(),
-                            this->m_pdata->getN(),
-                            this->m_pdata->getMaxN(),
-                            d_pos.data,
-                            d_charge.data,
-                            box,
-                            d_n_neigh.data,
-                            d_nlist.data,
-                            d_head_list.data,
-                            d_rcutsq.data,
-                            d_ronsq.data,
-                            this->m_nlist->getNListArray().getPitch(),
-                            this->m_pdata->getNTypes(),
-                            block_size,
-                            this->m_shift_mode,
-                            flags[pdata_flag::pressure_tensor],
-                            threads_per_particle,
-                            this->m_pdata->getGPUPartition(),
-                            this->m_exec_conf->dev_prop),
-        this->m_params.data());
+    kernel::pair_args_t pair_args(d_force.data,
+                                  d_virial.data,
+                                  this->m_virial.getPitch(),
+                                  this->m_pdata->getN(),
+                                  this->m_pdata->getMaxN(),
+                                  d_pos.data,
+                                  d_charge.data,
+                                  box,
+                                  d_n_neigh.data,
+                                  d_nlist.data,
+                                  d_head_list.data,
+                                  d_rcutsq.data,
+                                  d_ronsq.data,
+                                  this->m_nlist->getNListArray().getPitch(),
+                                  this->m_pdata->getNTypes(),
+                                  block_size,
+                                  this->m_shift_mode,
+                                  flags[pdata_flag::pressure_tensor],
+                                  threads_per_particle,
+                                  this->m_pdata->getGPUPartition(),
+                                  this->m_exec_conf->dev_prop,
+                                  this->m_exec_conf->getNumActiveGPUs() == 1
+                                      ? this->m_exec_conf->getStream()
+                                      : 0);
+
+    if (all_pairs)
+        {
+        kernel::gpu_compute_pair_forces_all_pairs<evaluator>(pair_args, this->m_params.data());
+        }
+    else if (binned)
+        {
+        ArrayHandle<unsigned int> d_bin_index(m_bin_index,
+                                              access_location::device,
+                                              access_mode::read);
+
+        for (const auto& bin : m_bin_ranges)
+            {
+            kernel::pair_args_t bin_args(d_force.data,
+                                         d_virial.data,
+                                         this->m_virial.getPitch(),
+                                         bin.size,
+                                         this->m_pdata->getMaxN(),
+                                         d_pos.data,
+                                         d_charge.data,
+                                         box,
+                                         d_n_neigh.data,
+                                         d_nlist.data,
+                                         d_head_list.data,
+                                         d_rcutsq.data,
+                                         d_ronsq.data,
+                                         this->m_nlist->getNListArray().getPitch(),
+                                         this->m_pdata->getNTypes(),
+                                         block_size,
+                                         this->m_shift_mode,
+                                         flags[pdata_flag::pressure_tensor],
+                                         bin.tpp,
+                                         this->m_pdata->getGPUPartition(),
+                                         this->m_exec_conf->dev_prop,
+                                         this->m_exec_conf->getStream(),
+                                         d_bin_index.data + bin.start);
+
+            kernel::gpu_compute_pair_forces_bin<evaluator>(bin_args, this->m_params.data());
+            }
+        }
+    else
+        {
+        kernel::gpu_compute_pair_forces<evaluator>(pair_args, this->m_params.data());
+        }
 
     if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
@@ -182,7 +346,10 @@ template<class T> void export_PotentialPairGPU(pybind11::module& m, const std::s
     pybind11::class_<PotentialPairGPU<T>, PotentialPair<T>, std::shared_ptr<PotentialPairGPU<T>>>(
         m,
         name.c_str())
-        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<NeighborList>>());
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<NeighborList>>())
+        .def_property("binned_neighbor_dispatch",
+                      &PotentialPairGPU<T>::getBinnedDispatch,
+                      &PotentialPairGPU<T>::setBinnedDispatch);
     }
 
     } // end namespace detail
@@ -0,0 +1,236 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __POTENTIAL_PAIR_GPU_JIT_H__
+#define __POTENTIAL_PAIR_GPU_JIT_H__
+
+#ifdef ENABLE_HIP
+
+#include <memory>
+
+#include "PairJITFactory.h"
+#include "PotentialPairGPU.h"
+
+#include "hoomd/Autotuner.h"
+
+/*! \file PotentialPairGPUJIT.h
+    \brief Defines the template class for JIT specialized pair potentials on the GPU
+    \note This header cannot be compiled by nvcc
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Template class for computing JIT specialized pair potentials on the GPU
+/*! Derived from PotentialPairGPU, this class replaces the generic pair force kernel with one
+    recompiled at attach time via NVRTC. The caller supplies the kernel source with the per type
+    pair parameters, cutoffs, and the shift mode emitted as literal constants (see
+    PotentialPairGPUJITKernel.inc), so the compiler folds them into immediates instead of
+    re-loading them from memory every evaluation. Production runs that hold their parameters
+    constant over long trajectories trade one compilation at attach time for this saving on
+    every step.
+
+    The specialized kernel reflects the parameters at the time the source was generated; changing
+    parameters afterwards leaves the kernel stale. The Python layer enforces this by only
+    exposing the specialization at attach time.
+
+    \tparam evaluator EvaluatorPair class used to evaluate V(r) and F(r)/r
+
+    \sa export_PotentialPairGPUJIT()
+*/
+template<class evaluator> class PotentialPairGPUJIT : public PotentialPairGPU<evaluator>
+    {
+    public:
+    //! Construct the pair potential
+    /*! \param sysdef System definition
+        \param nlist Neighbor list
+        \param code Runtime generated kernel source with baked parameters
+        \param kernel_name Fully qualified name of the __global__ function in \a code
+        \param options Additional NVRTC options (include paths)
+        \param compute_arch Compute architecture to compile for
+    */
+    PotentialPairGPUJIT(std::shared_ptr<SystemDefinition> sysdef,
+                        std::shared_ptr<NeighborList> nlist,
+                        const std::string& code,
+                        const std::string& kernel_name,
+                        const std::vector<std::string>& options,
+                        unsigned int compute_arch)
+        : PotentialPairGPU<evaluator>(sysdef, nlist),
+          m_factory(this->m_exec_conf, code, kernel_name, options, compute_arch)
+        {
+        // Autotuner parameters:
+        // 0: block size
+        // 1: threads per particle
+        std::function<bool(const std::array<unsigned int, 2>&)> is_parameter_valid
+            = [](const std::array<unsigned int, 2>& parameter) -> bool
+        {
+            unsigned int block_size = parameter[0];
+            unsigned int tpp = parameter[1];
+            return tpp <= block_size && (block_size % tpp) == 0;
+        };
+
+        m_tuner_jit.reset(new Autotuner<2>({m_factory.getLaunchBounds(), m_factory.getTppList()},
+                                           this->m_exec_conf,
+                                           "pair_jit_" + evaluator::getName(),
+                                           3,
+                                           false,
+                                           is_parameter_valid));
+
+        this->m_autotuners.push_back(m_tuner_jit);
+
+#ifdef ENABLE_MPI
+        m_tuner_jit->setSync(bool(this->m_pdata->getDomainDecomposition()));
+#endif
+        }
+
+    virtual ~PotentialPairGPUJIT() { }
+
+    protected:
+    PairJITFactory m_factory; //!< The NVRTC compiled kernel
+
+    /// Autotuner for block size and threads per particle of the JIT kernel
+    std::shared_ptr<Autotuner<2>> m_tuner_jit;
+
+    //! Actually compute the forces
+    virtual void computeForces(uint64_t timestep);
+    };
+
+template<class evaluator> void PotentialPairGPUJIT<evaluator>::computeForces(uint64_t timestep)
+    {
+#ifdef __HIP_PLATFORM_NVCC__
+    this->m_nlist->compute(timestep);
+
+    // The GPU implementation CANNOT handle a half neighborlist, error out now
+    bool third_law = this->m_nlist->getStorageMode() == NeighborList::half;
+    if (third_law)
+        {
+        this->m_exec_conf->msg->error()
+            << "PotentialPairGPUJIT cannot handle a half neighborlist" << std::endl;
+        throw std::runtime_error("Error computing forces in PotentialPairGPUJIT");
+        }
+
+    // access the neighbor list
+    ArrayHandle<unsigned int> d_n_neigh(this->m_nlist->getNNeighArray(),
+                                        access_location::device,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> d_nlist(this->m_nlist->getNListArray(),
+                                      access_location::device,
+                                      access_mode::read);
+    ArrayHandle<size_t> d_head_list(this->m_nlist->getHeadList(),
+                                    access_location::device,
+                                    access_mode::read);
+
+    // access the particle data
+    ArrayHandle<Scalar4> d_pos(this->m_pdata->getPositions(),
+                               access_location::device,
+                               access_mode::read);
+    ArrayHandle<Scalar> d_charge(this->m_pdata->getCharges(),
+                                 access_location::device,
+                                 access_mode::read);
+
+    BoxDim box = this->m_pdata->getBox();
+
+    ArrayHandle<Scalar4> d_force(this->m_force, access_location::device, access_mode::readwrite);
+    ArrayHandle<Scalar> d_virial(this->m_virial, access_location::device, access_mode::readwrite);
+
+    PDataFlags flags = this->m_pdata->getFlags();
+    unsigned int compute_virial = flags[pdata_flag::pressure_tensor] ? 1 : 0;
+
+    this->m_exec_conf->beginMultiGPU();
+
+    m_tuner_jit->begin();
+    auto param = m_tuner_jit->getParam();
+    unsigned int block_size = param[0];
+    unsigned int tpp = param[1];
+
+    // clamp the block size to the compiled kernel's limit
+    unsigned int max_threads = m_factory.getKernelMaxThreads(0, tpp, block_size);
+    unsigned int run_block_size = std::min(block_size, max_threads);
+    while (run_block_size % tpp != 0)
+        run_block_size -= this->m_exec_conf->dev_prop.warpSize;
+
+    hipStream_t stream
+        = this->m_exec_conf->getNumActiveGPUs() == 1 ? this->m_exec_conf->getStream() : 0;
+
+    auto& gpu_partition = this->m_pdata->getGPUPartition();
+
+    // iterate over active GPUs in reverse, to end up on first GPU when returning
+    for (int idev = gpu_partition.getNumActiveGPUs() - 1; idev >= 0; --idev)
+        {
+        auto range = gpu_partition.getRangeAndSetGPU(idev);
+
+        unsigned int nwork = range.second - range.first;
+        unsigned int offset = range.first;
+
+        dim3 grid(nwork / (run_block_size / tpp) + 1, 1, 1);
+        dim3 threads(run_block_size, 1, 1);
+
+        auto launcher
+            = m_factory.configureKernel(idev, grid, threads, 0, stream, tpp, block_size);
+
+        CUresult res = launcher(d_force.data,
+                                d_virial.data,
+                                this->m_virial.getPitch(),
+                                nwork,
+                                d_pos.data,
+                                d_charge.data,
+                                box,
+                                d_n_neigh.data,
+                                d_nlist.data,
+                                d_head_list.data,
+                                offset,
+                                compute_virial);
+
+        if (res != CUDA_SUCCESS)
+            {
+            char* error;
+            cuGetErrorString(res, const_cast<const char**>(&error));
+            throw std::runtime_error("Error launching NVRTC kernel: " + std::string(error));
+            }
+        }
+
+    if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+
+    m_tuner_jit->end();
+
+    this->m_exec_conf->endMultiGPU();
+
+    // energy and pressure corrections
+    this->computeTailCorrection();
+#endif
+    }
+
+namespace detail
+    {
+//! Export this pair potential to python
+/*! \param name Name of the class in the exported python module
+    \tparam T Evaluator type to export.
+*/
+template<class T> void export_PotentialPairGPUJIT(pybind11::module& m, const std::string& name)
+    {
+    pybind11::class_<PotentialPairGPUJIT<T>,
+                     PotentialPairGPU<T>,
+                     std::shared_ptr<PotentialPairGPUJIT<T>>>(m, name.c_str())
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<NeighborList>,
+                            const std::string&,
+                            const std::string&,
+                            const std::vector<std::string>&,
+                            unsigned int>());
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // ENABLE_HIP
+#endif // __POTENTIAL_PAIR_GPU_JIT_H__
@@ -0,0 +1,186 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "ComputeThermoTypes.h"
+#include "Thermostat.cuh"
+#include "hip/hip_runtime.h"
+
+/*! \file Thermostat.cu
+    \brief Defines GPU kernel code for the device-resident thermostat updates. These single-thread
+    kernels consume the kinetic energy reduction produced by ComputeThermoGPU directly in device
+    memory, so the integration methods never have to stall the stream on a device-to-host copy of
+    the thermodynamic properties.
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Advances the MTTK thermostat degrees of freedom by one timestep
+/*! \param d_state Thermostat internal state [xi, eta, xi_rot, eta_rot]
+    \param d_rescale Output rescaling factors [translation, rotation]
+    \param d_properties Thermodynamic properties computed by ComputeThermoGPU
+    \param ndof_trans Number of translational degrees of freedom of the group
+    \param ndof_rot Number of rotational degrees of freedom of the group
+    \param tau Thermostat time constant
+    \param set_T Temperature set point at the current timestep
+    \param deltaT Amount of real time to step forward in one time step
+    \param aniso True when rotational degrees of freedom are integrated
+
+    Performs the same update as MTTKThermostat::advanceThermostat(), then writes the rescaling
+    factors for the following half steps. A single thread suffices: the update is a handful of
+    flops on scalars and its cost is dwarfed by the launch latency it replaces.
+*/
+__global__ void gpu_mttk_advance_thermostat_kernel(Scalar* d_state,
+                                                   Scalar* d_rescale,
+                                                   const Scalar* d_properties,
+                                                   Scalar ndof_trans,
+                                                   Scalar ndof_rot,
+                                                   Scalar tau,
+                                                   Scalar set_T,
+                                                   Scalar deltaT,
+                                                   bool aniso)
+    {
+    Scalar curr_T_trans = Scalar(2.0) * d_properties[thermo_index::translational_kinetic_energy]
+                          / ndof_trans;
+
+    // update the state variables Xi and eta
+    Scalar xi = d_state[0];
+    Scalar half_step = Scalar(1.0 / 2.0) * deltaT / tau / tau * (curr_T_trans / set_T - Scalar(1.0));
+    Scalar xi_prime = xi + half_step;
+    xi = xi_prime + half_step;
+    d_state[0] = xi;
+    d_state[1] += xi_prime * deltaT;
+
+    Scalar xi_rot = d_state[2];
+    if (aniso && ndof_rot > Scalar(0.0))
+        {
+        // update thermostat for rotational DOF
+        Scalar curr_ke_rot = d_properties[thermo_index::rotational_kinetic_energy];
+
+        Scalar half_step_rot = Scalar(1.0 / 2.0) * deltaT / tau / tau
+                               * (Scalar(2.0) * curr_ke_rot / ndof_rot / set_T - Scalar(1.0));
+        Scalar xi_prime_rot = xi_rot + half_step_rot;
+        xi_rot = xi_prime_rot + half_step_rot;
+        d_state[2] = xi_rot;
+        d_state[3] += xi_prime_rot * deltaT;
+        }
+
+    d_rescale[0] = exp(-Scalar(1.0 / 2.0) * xi * deltaT);
+    d_rescale[1] = exp(-xi_rot * deltaT / Scalar(2.0));
+    }
+
+/*! \param d_state Thermostat internal state [xi, eta, xi_rot, eta_rot]
+    \param d_rescale Output rescaling factors [translation, rotation]
+    \param d_properties Thermodynamic properties computed by ComputeThermoGPU
+    \param ndof_trans Number of translational degrees of freedom of the group
+    \param ndof_rot Number of rotational degrees of freedom of the group
+    \param tau Thermostat time constant
+    \param set_T Temperature set point at the current timestep
+    \param deltaT Amount of real time to step forward in one time step
+    \param aniso True when rotational degrees of freedom are integrated
+    \param stream Stream to launch the kernel on
+*/
+hipError_t gpu_mttk_advance_thermostat(Scalar* d_state,
+                                       Scalar* d_rescale,
+                                       const Scalar* d_properties,
+                                       Scalar ndof_trans,
+                                       Scalar ndof_rot,
+                                       Scalar tau,
+                                       Scalar set_T,
+                                       Scalar deltaT,
+                                       bool aniso,
+                                       hipStream_t stream)
+    {
+    hipLaunchKernelGGL((gpu_mttk_advance_thermostat_kernel),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       d_state,
+                       d_rescale,
+                       d_properties,
+                       ndof_trans,
+                       ndof_rot,
+                       tau,
+                       set_T,
+                       deltaT,
+                       aniso);
+
+    return hipSuccess;
+    }
+
+//! Computes the Berendsen rescaling factors from the current kinetic energy
+/*! \param d_rescale Output rescaling factors [translation, rotation]
+    \param d_properties Thermodynamic properties computed by ComputeThermoGPU
+    \param ndof_trans Number of translational degrees of freedom of the group
+    \param ndof_rot Number of rotational degrees of freedom of the group
+    \param tau Thermostat time constant
+    \param set_T Temperature set point at the current timestep
+    \param deltaT Amount of real time to step forward in one time step
+
+    Performs the same computation as BerendsenThermostat::getRescalingFactorsOne().
+*/
+__global__ void gpu_berendsen_rescale_kernel(Scalar* d_rescale,
+                                             const Scalar* d_properties,
+                                             Scalar ndof_trans,
+                                             Scalar ndof_rot,
+                                             Scalar tau,
+                                             Scalar set_T,
+                                             Scalar deltaT)
+    {
+    Scalar curr_T_trans = Scalar(2.0) * d_properties[thermo_index::translational_kinetic_energy]
+                          / ndof_trans;
+    d_rescale[0] = sqrt(Scalar(1.0) + deltaT / tau * (set_T / curr_T_trans - Scalar(1.0)));
+
+    if (ndof_rot > Scalar(0.0))
+        {
+        Scalar curr_T_rot = Scalar(2.0) * d_properties[thermo_index::rotational_kinetic_energy]
+                            / ndof_rot;
+        d_rescale[1] = sqrt(Scalar(1.0) + deltaT / tau * (set_T / curr_T_rot - Scalar(1.0)));
+        }
+    else
+        {
+        d_rescale[1] = Scalar(1.0);
+        }
+    }
+
+/*! \param d_rescale Output rescaling factors [translation, rotation]
+    \param d_properties Thermodynamic properties computed by ComputeThermoGPU
+    \param ndof_trans Number of translational degrees of freedom of the group
+    \param ndof_rot Number of rotational degrees of freedom of the group
+    \param tau Thermostat time constant
+    \param set_T Temperature set point at the current timestep
+    \param deltaT Amount of real time to step forward in one time step
+    \param stream Stream to launch the kernel on
+*/
+hipError_t gpu_berendsen_rescale(Scalar* d_rescale,
+                                 const Scalar* d_properties,
+                                 Scalar ndof_trans,
+                                 Scalar ndof_rot,
+                                 Scalar tau,
+                                 Scalar set_T,
+                                 Scalar deltaT,
+                                 hipStream_t stream)
+    {
+    hipLaunchKernelGGL((gpu_berendsen_rescale_kernel),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       d_rescale,
+                       d_properties,
+                       ndof_trans,
+                       ndof_rot,
+                       tau,
+                       set_T,
+                       deltaT);
+
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
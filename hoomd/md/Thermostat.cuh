@@ -0,0 +1,49 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef HOOMD_THERMOSTAT_CUH
+#define HOOMD_THERMOSTAT_CUH
+
+#include <hip/hip_runtime.h>
+
+#include "hoomd/HOOMDMath.h"
+
+/*! \file Thermostat.cuh
+    \brief Declares GPU kernel drivers for the device-resident thermostat updates
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Advance the MTTK thermostat degrees of freedom on the device
+/*! Reads the kinetic energy directly from ComputeThermo's device property buffer so that no
+    device-to-host copy is required per timestep.
+*/
+hipError_t gpu_mttk_advance_thermostat(Scalar* d_state,
+                                       Scalar* d_rescale,
+                                       const Scalar* d_properties,
+                                       Scalar ndof_trans,
+                                       Scalar ndof_rot,
+                                       Scalar tau,
+                                       Scalar set_T,
+                                       Scalar deltaT,
+                                       bool aniso,
+                                       hipStream_t stream = 0);
+
+//! Compute the Berendsen rescaling factors on the device
+hipError_t gpu_berendsen_rescale(Scalar* d_rescale,
+                                 const Scalar* d_properties,
+                                 Scalar ndof_trans,
+                                 Scalar ndof_rot,
+                                 Scalar tau,
+                                 Scalar set_T,
+                                 Scalar deltaT,
+                                 hipStream_t stream = 0);
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
+#endif // HOOMD_THERMOSTAT_CUH
@@ -12,6 +12,10 @@
 #include <hoomd/Variant.h>
 #include <hoomd/md/ComputeThermo.h>
 
+#ifdef ENABLE_HIP
+#include <hoomd/md/Thermostat.cuh>
+#endif
+
 namespace hoomd::md
     {
 
@@ -72,6 +76,64 @@ class Thermostat
     */
     virtual void advanceThermostat(uint64_t timestep, Scalar deltaT, bool aniso) { }
 
+    /** Supply the group kinetic energy accumulated by the integration method.
+
+        @param ke_translational Translational kinetic energy of this rank's group members.
+        @param ke_rotational Rotational kinetic energy of this rank's group members.
+
+        Integration methods that already loop over every group member when they update the
+        velocities may accumulate the kinetic energy in passing and hand it to the thermostat
+        here. Thermostats that only need the kinetic energy then skip the separate ComputeThermo
+        reduction in the next advanceThermostat() call, which consumes the cached values. The
+        sums are rank-local; the thermostat completes the reduction across ranks. The default
+        implementation ignores the values, so integration methods may call this unconditionally.
+    */
+    virtual void setKineticEnergy(Scalar ke_translational, Scalar ke_rotational) { }
+
+#ifdef ENABLE_HIP
+    /** Get a device array holding the rescaling factors for the first half step.
+
+        @param timestep Current simulation timestep.
+        @param deltaT Simulation step size.
+        @returns A device-resident array of 2 elements [translation rescale factor, rotation
+                 rescale factor], or nullptr when the thermostat has no device-resident path
+                 and the host factors from getRescalingFactorsOne() must be used instead.
+
+        Thermostats that implement this path compute the rescaling factors in a kernel that
+        reads the kinetic energy reduction directly from ComputeThermo's device buffer, so the
+        integration method never stalls the stream on a device-to-host copy per timestep.
+    */
+    virtual const GlobalArray<Scalar>* getDeviceRescalingFactorsOne(uint64_t timestep,
+                                                                    Scalar deltaT)
+        {
+        return nullptr;
+        }
+
+    /** Get a device array holding the rescaling factors for the second half step.
+
+        @see getDeviceRescalingFactorsOne()
+    */
+    virtual const GlobalArray<Scalar>* getDeviceRescalingFactorsTwo(uint64_t timestep,
+                                                                    Scalar deltaT)
+        {
+        return nullptr;
+        }
+
+    /** Advance the thermostat degrees of freedom (if present) on the device.
+
+        @param timestep Current simulation timestep.
+        @param deltaT Simulation step size.
+        @param aniso Set to true when the integration method is applied to rotational degrees of
+                     freedom.
+        @returns false when the thermostat has no device-resident update and
+                 advanceThermostat() must be called instead.
+    */
+    virtual bool advanceThermostatGPU(uint64_t timestep, Scalar deltaT, bool aniso)
+        {
+        return false;
+        }
+#endif
+
     /// Get the temperature variant.
     std::shared_ptr<Variant> getT()
         {
@@ -147,6 +209,9 @@ class MTTKThermostat : public Thermostat
 
     std::array<Scalar, 2> getRescalingFactorsOne(uint64_t timestep, Scalar deltaT) override
         {
+#ifdef ENABLE_HIP
+        syncStateFromDevice();
+#endif
         Scalar exp_thermo_fac = exp(-Scalar(1.0 / 2.0) * m_state.xi * deltaT);
         Scalar exp_thermo_fac_rot = exp(-m_state.xi_rot * deltaT / Scalar(2.0));
         return {exp_thermo_fac, exp_thermo_fac_rot};
@@ -154,6 +219,9 @@ class MTTKThermostat : public Thermostat
 
     std::array<Scalar, 2> getRescalingFactorsTwo(uint64_t timestep, Scalar deltaT) override
         {
+#ifdef ENABLE_HIP
+        syncStateFromDevice();
+#endif
         Scalar exp_thermo_fac = exp(-Scalar(1.0 / 2.0) * m_state.xi * deltaT);
         Scalar exp_thermo_fac_rot = exp(-m_state.xi_rot * deltaT / Scalar(2.0));
         return {exp_thermo_fac, exp_thermo_fac_rot};
@@ -161,10 +229,51 @@ class MTTKThermostat : public Thermostat
 
     void advanceThermostat(uint64_t timestep, Scalar deltaT, bool aniso = true) override
         {
-        // compute the current thermodynamic properties
-        m_thermo->compute(timestep);
+#ifdef ENABLE_HIP
+        // take over from a previously active device-resident update
+        syncStateFromDevice();
+        m_dev_state_valid = false;
+#endif
+
+        Scalar curr_T_trans;
+        Scalar curr_ke_rot = 0;
+        if (m_ke_valid)
+            {
+            // use the kinetic energy the integration method accumulated while updating the
+            // velocities instead of re-reducing it from the particle data
+            Scalar ke[2] = {m_ke_translational, m_ke_rotational};
+            m_ke_valid = false;
+
+#ifdef ENABLE_MPI
+            if (m_sysdef->isDomainDecomposed())
+                {
+                auto exec_conf = m_sysdef->getParticleData()->getExecConf();
+                MPI_Allreduce(MPI_IN_PLACE,
+                              ke,
+                              2,
+                              MPI_HOOMD_SCALAR,
+                              MPI_SUM,
+                              exec_conf->getMPICommunicator());
+                }
+#endif
+
+            Scalar translation_dof = m_group->getTranslationalDOF();
+            curr_T_trans
+                = translation_dof > 0 ? Scalar(2.0) * ke[0] / translation_dof : Scalar(0.0);
+            curr_ke_rot = ke[1];
+            }
+        else
+            {
+            // compute the current thermodynamic properties
+            m_thermo->compute(timestep);
+
+            curr_T_trans = m_thermo->getTranslationalTemperature();
+            if (aniso)
+                {
+                curr_ke_rot = m_thermo->getRotationalKineticEnergy();
+                }
+            }
 
-        Scalar curr_T_trans = m_thermo->getTranslationalTemperature();
         Scalar T = m_T->operator()(timestep);
 
         // update the state variables Xi and eta
@@ -179,7 +288,6 @@ class MTTKThermostat : public Thermostat
         if (aniso)
             {
             // update thermostat for rotational DOF
-            Scalar curr_ke_rot = m_thermo->getRotationalKineticEnergy();
             Scalar ndof_rot = m_group->getRotationalDOF();
 
             Scalar xi_prime_rot = m_state.xi_rot
@@ -193,12 +301,74 @@ class MTTKThermostat : public Thermostat
             }
         }
 
+    void setKineticEnergy(Scalar ke_translational, Scalar ke_rotational) override
+        {
+        m_ke_translational = ke_translational;
+        m_ke_rotational = ke_rotational;
+        m_ke_valid = true;
+        }
+
+#ifdef ENABLE_HIP
+    const GlobalArray<Scalar>* getDeviceRescalingFactorsOne(uint64_t timestep,
+                                                            Scalar deltaT) override
+        {
+        return deviceRescalingFactors(deltaT);
+        }
+
+    const GlobalArray<Scalar>* getDeviceRescalingFactorsTwo(uint64_t timestep,
+                                                            Scalar deltaT) override
+        {
+        return deviceRescalingFactors(deltaT);
+        }
+
+    bool advanceThermostatGPU(uint64_t timestep, Scalar deltaT, bool aniso) override
+        {
+#ifdef ENABLE_MPI
+        if (m_sysdef->isDomainDecomposed())
+            {
+            // the kinetic energy reduction completes on the host with MPI
+            return false;
+            }
+#endif
+        uploadStateIfInvalid(deltaT);
+
+        // the device path reduces the kinetic energy itself, drop any host-accumulated values
+        m_ke_valid = false;
+
+        // compute the current thermodynamic properties, leaving them in device memory
+        m_thermo->compute(timestep);
+
+        ArrayHandle<Scalar> d_properties(m_thermo->getProperties(),
+                                         access_location::device,
+                                         access_mode::read);
+        ArrayHandle<Scalar> d_state(m_dev_state, access_location::device, access_mode::readwrite);
+        ArrayHandle<Scalar> d_rescale(m_dev_rescale,
+                                      access_location::device,
+                                      access_mode::overwrite);
+
+        kernel::gpu_mttk_advance_thermostat(d_state.data,
+                                            d_rescale.data,
+                                            d_properties.data,
+                                            m_group->getTranslationalDOF(),
+                                            m_group->getRotationalDOF(),
+                                            m_tau,
+                                            m_T->operator()(timestep),
+                                            deltaT,
+                                            aniso);
+
+        return true;
+        }
+#endif
+
     /** Get the thermostat's contribution to the total Hamiltonian of the system.
 
         @param timestep Current simulation timestep.
     */
     Scalar getThermostatEnergy(uint64_t timestep)
         {
+#ifdef ENABLE_HIP
+        syncStateFromDevice();
+#endif
         Scalar translation_dof = m_group->getTranslationalDOF();
         Scalar thermostat_energy
             = static_cast<Scalar>(translation_dof) * m_T->operator()(timestep)
@@ -221,6 +391,10 @@ class MTTKThermostat : public Thermostat
             {
             throw std::length_error("translational_thermostat_dof must have length 2");
             }
+#ifdef ENABLE_HIP
+        syncStateFromDevice();
+        m_dev_state_valid = false;
+#endif
         m_state.xi = v[0].cast<Scalar>();
         m_state.eta = v[1].cast<Scalar>();
         }
@@ -231,6 +405,9 @@ class MTTKThermostat : public Thermostat
     */
     pybind11::tuple getTranslationalDOF()
         {
+#ifdef ENABLE_HIP
+        syncStateFromDevice();
+#endif
         return pybind11::make_tuple(m_state.xi, m_state.eta);
         }
 
@@ -244,6 +421,10 @@ class MTTKThermostat : public Thermostat
             {
             throw std::length_error("rotational_thermostat_dof must have length 2");
             }
+#ifdef ENABLE_HIP
+        syncStateFromDevice();
+        m_dev_state_valid = false;
+#endif
         m_state.xi_rot = v[0].cast<Scalar>();
         m_state.eta_rot = v[1].cast<Scalar>();
         }
@@ -254,6 +435,9 @@ class MTTKThermostat : public Thermostat
     */
     pybind11::tuple getRotationalDOF()
         {
+#ifdef ENABLE_HIP
+        syncStateFromDevice();
+#endif
         return pybind11::make_tuple(m_state.xi_rot, m_state.eta_rot);
         };
 
@@ -275,6 +459,11 @@ class MTTKThermostat : public Thermostat
         auto exec_conf = m_sysdef->getParticleData()->getExecConf();
         exec_conf->msg->notice(6) << "TwoStepNVTMTK randomizing thermostat DOF" << std::endl;
 
+#ifdef ENABLE_HIP
+        syncStateFromDevice();
+        m_dev_state_valid = false;
+#endif
+
         Scalar g = m_group->getTranslationalDOF();
         Scalar sigmasq_t = Scalar(1.0) / (static_cast<Scalar>(g) * m_tau * m_tau);
 
@@ -323,11 +512,99 @@ class MTTKThermostat : public Thermostat
         }
 
     protected:
+#ifdef ENABLE_HIP
+    /// Lazily allocate the device-resident thermostat state.
+    void allocateDeviceArrays()
+        {
+        if (m_dev_state.isNull())
+            {
+            auto exec_conf = m_sysdef->getParticleData()->getExecConf();
+            GlobalArray<Scalar> dev_state(4, exec_conf);
+            m_dev_state.swap(dev_state);
+            GlobalArray<Scalar> dev_rescale(2, exec_conf);
+            m_dev_rescale.swap(dev_rescale);
+            }
+        }
+
+    /** Upload the host thermostat state to the device when the device copy is stale.
+
+        Also seeds the rescaling factors from the current state so that the first half step
+        after the upload uses the same factors the host path would produce.
+    */
+    void uploadStateIfInvalid(Scalar deltaT)
+        {
+        allocateDeviceArrays();
+        if (m_dev_state_valid)
+            return;
+
+        ArrayHandle<Scalar> h_state(m_dev_state, access_location::host, access_mode::overwrite);
+        h_state.data[0] = m_state.xi;
+        h_state.data[1] = m_state.eta;
+        h_state.data[2] = m_state.xi_rot;
+        h_state.data[3] = m_state.eta_rot;
+
+        ArrayHandle<Scalar> h_rescale(m_dev_rescale,
+                                      access_location::host,
+                                      access_mode::overwrite);
+        h_rescale.data[0] = exp(-Scalar(1.0 / 2.0) * m_state.xi * deltaT);
+        h_rescale.data[1] = exp(-m_state.xi_rot * deltaT / Scalar(2.0));
+
+        m_dev_state_valid = true;
+        }
+
+    /// Refresh the host copy of the thermostat state from the device (when active).
+    void syncStateFromDevice()
+        {
+        if (!m_dev_state_valid)
+            return;
+
+        ArrayHandle<Scalar> h_state(m_dev_state, access_location::host, access_mode::read);
+        m_state.xi = h_state.data[0];
+        m_state.eta = h_state.data[1];
+        m_state.xi_rot = h_state.data[2];
+        m_state.eta_rot = h_state.data[3];
+        }
+
+    /// Get the device-resident rescaling factors, or nullptr when they are unavailable.
+    const GlobalArray<Scalar>* deviceRescalingFactors(Scalar deltaT)
+        {
+#ifdef ENABLE_MPI
+        if (m_sysdef->isDomainDecomposed())
+            {
+            // the kinetic energy reduction completes on the host with MPI
+            return nullptr;
+            }
+#endif
+        uploadStateIfInvalid(deltaT);
+        return &m_dev_rescale;
+        }
+#endif
+
     /// The thermostat time constant.
     Scalar m_tau = 0;
 
     /// The thermostat internal degrees of freedom.
     MTTKThermostat::state m_state {};
+
+    /// Rank-local translational kinetic energy provided by the integration method.
+    Scalar m_ke_translational = 0;
+
+    /// Rank-local rotational kinetic energy provided by the integration method.
+    Scalar m_ke_rotational = 0;
+
+    /// True when the provided kinetic energy has not yet been consumed.
+    bool m_ke_valid = false;
+
+#ifdef ENABLE_HIP
+    /// Device copy of the thermostat internal degrees of freedom.
+    GlobalArray<Scalar> m_dev_state;
+
+    /// Device-resident rescaling factors [translation, rotation].
+    GlobalArray<Scalar> m_dev_rescale;
+
+    /// True when m_dev_state holds the authoritative thermostat state.
+    bool m_dev_state_valid = false;
+#endif
     };
 
 /** Implement the Bussi stochastic velocity rescaling thermostat.
@@ -413,8 +690,69 @@ class BerendsenThermostat : public Thermostat
         return {lambda_T, lambda_R};
         }
 
+#ifdef ENABLE_HIP
+    const GlobalArray<Scalar>* getDeviceRescalingFactorsOne(uint64_t timestep,
+                                                            Scalar deltaT) override
+        {
+#ifdef ENABLE_MPI
+        if (m_sysdef->isDomainDecomposed())
+            {
+            // the kinetic energy reduction completes on the host with MPI
+            return nullptr;
+            }
+#endif
+        if (!m_checked_initial_temperature)
+            {
+            // validate the initial temperatures on the host once, device code cannot throw
+            getRescalingFactorsOne(timestep, deltaT);
+            m_checked_initial_temperature = true;
+            }
+
+        if (m_dev_rescale.isNull())
+            {
+            auto exec_conf = m_sysdef->getParticleData()->getExecConf();
+            GlobalArray<Scalar> dev_rescale(2, exec_conf);
+            m_dev_rescale.swap(dev_rescale);
+            }
+
+        // compute the current thermodynamic properties, leaving them in device memory
+        m_thermo->compute(timestep);
+
+        ArrayHandle<Scalar> d_properties(m_thermo->getProperties(),
+                                         access_location::device,
+                                         access_mode::read);
+        ArrayHandle<Scalar> d_rescale(m_dev_rescale,
+                                      access_location::device,
+                                      access_mode::overwrite);
+
+        kernel::gpu_berendsen_rescale(d_rescale.data,
+                                      d_properties.data,
+                                      m_thermo->getTranslationalDOF(),
+                                      m_thermo->getRotationalDOF(),
+                                      m_tau,
+                                      m_T->operator()(timestep),
+                                      deltaT);
+
+        return &m_dev_rescale;
+        }
+
+    bool advanceThermostatGPU(uint64_t timestep, Scalar deltaT, bool aniso) override
+        {
+        // Berendsen has no internal degrees of freedom to advance
+        return true;
+        }
+#endif
+
     protected:
     Scalar m_tau;
+
+#ifdef ENABLE_HIP
+    /// Device-resident rescaling factors [translation, rotation].
+    GlobalArray<Scalar> m_dev_rescale;
+
+    /// True once the initial temperatures have been validated on the host.
+    bool m_checked_initial_temperature = false;
+#endif
     };
 
     } // namespace hoomd::md
@@ -10,6 +10,7 @@
 #endif
 
 #include <pybind11/pybind11.h>
+#include <vector>
 
 namespace hoomd
     {
@@ -41,6 +42,9 @@ class PYBIND11_EXPORT TwoStepBD : public TwoStepLangevinBase
     protected:
     bool m_noiseless_t;
     bool m_noiseless_r;
+
+    /// Scratch buffer holding the random draws for the current step
+    std::vector<Scalar> m_noise;
     };
 
     } // end namespace md
@@ -16,6 +16,12 @@ void hoomd::md::TwoStepConstantVolume::integrateStepOne(uint64_t timestep)
 
     unsigned int group_size = m_group->getNumMembers();
 
+    // accumulate the kinetic energy of the group in passing while the velocities are updated so
+    // that the thermostat does not need a separate reduction over the particle data
+    const bool track_kinetic_energy = static_cast<bool>(m_thermostat);
+    double ke_translational = 0.0;
+    double ke_rotational = 0.0;
+
         // scope array handles for proper releasing before calling the thermo compute
         {
         ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
@@ -27,6 +33,12 @@ void hoomd::md::TwoStepConstantVolume::integrateStepOne(uint64_t timestep)
         ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
                                    access_location::host,
                                    access_mode::readwrite);
+        ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                         access_location::host,
+                                         access_mode::read);
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::read);
 
         for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
             {
@@ -58,6 +70,16 @@ void hoomd::md::TwoStepConstantVolume::integrateStepOne(uint64_t timestep)
             h_vel.data[j].y = v.y;
             h_vel.data[j].z = v.z;
 
+            // sum the translational kinetic energy of the updated velocities, ignoring rigid
+            // body constituent particles as ComputeThermo does
+            if (track_kinetic_energy
+                && (h_body.data[j] >= MIN_FLOPPY || h_body.data[j] == h_tag.data[j]))
+                {
+                ke_translational += (double)h_vel.data[j].w
+                                    * ((double)v.x * (double)v.x + (double)v.y * (double)v.y
+                                       + (double)v.z * (double)v.z);
+                }
+
             h_pos.data[j].x = pos.x;
             h_pos.data[j].y = pos.y;
             h_pos.data[j].z = pos.z;
@@ -95,6 +117,12 @@ void hoomd::md::TwoStepConstantVolume::integrateStepOne(uint64_t timestep)
         ArrayHandle<Scalar3> h_inertia(m_pdata->getMomentsOfInertiaArray(),
                                        access_location::host,
                                        access_mode::read);
+        ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                         access_location::host,
+                                         access_mode::read);
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::read);
 
         for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
             {
@@ -200,12 +228,34 @@ void hoomd::md::TwoStepConstantVolume::integrateStepOne(uint64_t timestep)
 
             h_orientation.data[j] = quat_to_scalar4(q);
             h_angmom.data[j] = quat_to_scalar4(p);
+
+            // sum the rotational kinetic energy of the updated angular momenta, ignoring rigid
+            // body constituent particles as ComputeThermo does
+            if (track_kinetic_energy
+                && (h_body.data[j] >= MIN_FLOPPY || h_body.data[j] == h_tag.data[j]))
+                {
+                quat<Scalar> s(Scalar(0.5) * conj(q) * p);
+                if (I.x > 0)
+                    {
+                    ke_rotational += (double)s.v.x * (double)s.v.x / (double)I.x;
+                    }
+                if (I.y > 0)
+                    {
+                    ke_rotational += (double)s.v.y * (double)s.v.y / (double)I.y;
+                    }
+                if (I.z > 0)
+                    {
+                    ke_rotational += (double)s.v.z * (double)s.v.z / (double)I.z;
+                    }
+                }
             }
         }
 
     // get temperature and advance thermostat
     if (m_thermostat)
         {
+        m_thermostat->setKineticEnergy(Scalar(0.5 * ke_translational),
+                                       Scalar(0.5 * ke_rotational));
         m_thermostat->advanceThermostat(timestep, m_deltaT, m_aniso);
         }
     }
@@ -51,7 +51,16 @@ void TwoStepConstantVolumeGPU::integrateStepOne(uint64_t timestep)
         }
 
     unsigned int group_size = m_group->getNumMembers();
-    const auto&& rescalingFactors = m_thermostat
+
+    // When the thermostat offers a device-resident update, read the rescaling factor directly
+    // from device memory and skip the host round trip through the kinetic energy. The angular
+    // kernels still consume host factors, so the device path is limited to isotropic
+    // integration.
+    const GlobalArray<Scalar>* dev_rescale
+        = (m_thermostat && !m_aniso)
+              ? m_thermostat->getDeviceRescalingFactorsOne(timestep, m_deltaT)
+              : nullptr;
+    const auto&& rescalingFactors = (m_thermostat && !dev_rescale)
                                         ? m_thermostat->getRescalingFactorsOne(timestep, m_deltaT)
                                         : std::array<Scalar, 2> {1., 1.};
         {
@@ -76,6 +85,14 @@ void TwoStepConstantVolumeGPU::integrateStepOne(uint64_t timestep)
 
         auto limits = getKernelLimitValues(timestep);
 
+        std::unique_ptr<ArrayHandle<Scalar>> d_rescale;
+        if (dev_rescale)
+            {
+            d_rescale.reset(new ArrayHandle<Scalar>(*dev_rescale,
+                                                    access_location::device,
+                                                    access_mode::read));
+            }
+
         m_exec_conf->beginMultiGPU();
 
         // perform the update on the GPU
@@ -89,10 +106,14 @@ void TwoStepConstantVolumeGPU::integrateStepOne(uint64_t timestep)
                                          box,
                                          m_tuner_one->getParam()[0],
                                          rescalingFactors[0], // m_exp_thermo_fac,
+                                         d_rescale ? d_rescale->data : nullptr,
                                          m_deltaT,
                                          m_group->getGPUPartition(),
                                          limits.first,
-                                         limits.second);
+                                         limits.second,
+                                         m_exec_conf->getNumActiveGPUs() == 1
+                                             ? m_exec_conf->getStream()
+                                             : 0);
 
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
@@ -141,7 +162,10 @@ void TwoStepConstantVolumeGPU::integrateStepOne(uint64_t timestep)
     // advance thermostat
     if (m_thermostat)
         {
-        m_thermostat->advanceThermostat(timestep, m_deltaT, m_aniso);
+        if (!dev_rescale || !m_thermostat->advanceThermostatGPU(timestep, m_deltaT, m_aniso))
+            {
+            m_thermostat->advanceThermostat(timestep, m_deltaT, m_aniso);
+            }
         }
     }
 
@@ -154,7 +178,12 @@ void TwoStepConstantVolumeGPU::integrateStepTwo(uint64_t timestep)
     ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
                                             access_location::device,
                                             access_mode::read);
-    const auto&& rescalingFactors = m_thermostat
+    // read the rescaling factor from device memory when the thermostat keeps it there
+    const GlobalArray<Scalar>* dev_rescale
+        = (m_thermostat && !m_aniso)
+              ? m_thermostat->getDeviceRescalingFactorsTwo(timestep, m_deltaT)
+              : nullptr;
+    const auto&& rescalingFactors = (m_thermostat && !dev_rescale)
                                         ? m_thermostat->getRescalingFactorsTwo(timestep, m_deltaT)
                                         : std::array<Scalar, 2> {1., 1.};
 
@@ -167,6 +196,14 @@ void TwoStepConstantVolumeGPU::integrateStepTwo(uint64_t timestep)
                                      access_mode::readwrite);
         ArrayHandle<Scalar4> d_net_force(net_force, access_location::device, access_mode::read);
 
+        std::unique_ptr<ArrayHandle<Scalar>> d_rescale;
+        if (dev_rescale)
+            {
+            d_rescale.reset(new ArrayHandle<Scalar>(*dev_rescale,
+                                                    access_location::device,
+                                                    access_mode::read));
+            }
+
         m_exec_conf->beginMultiGPU();
 
         // perform the update on the GPU
@@ -179,7 +216,11 @@ void TwoStepConstantVolumeGPU::integrateStepTwo(uint64_t timestep)
                                          m_tuner_two->getParam()[0],
                                          m_deltaT,
                                          rescalingFactors[0],
-                                         m_group->getGPUPartition());
+                                         d_rescale ? d_rescale->data : nullptr,
+                                         m_group->getGPUPartition(),
+                                         m_exec_conf->getNumActiveGPUs() == 1
+                                             ? m_exec_conf->getStream()
+                                             : 0);
 
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
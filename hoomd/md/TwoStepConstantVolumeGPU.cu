@@ -24,6 +24,8 @@ namespace kernel
     \param work_size Number of members in the group for this GPU
     \param box Box dimensions for periodic boundary condition handling
     \param rescale_factor Velocity rescaling factor from thermostat
+    \param d_rescale_factor Device pointer to the rescaling factor, overrides rescale_factor when
+           non-null
     \param deltaT Amount of real time to step forward in one time step
     \param offset The offset of this GPU into the list of particles
 
@@ -40,6 +42,7 @@ __global__ void gpu_nvt_rescale_step_one_kernel(Scalar4* d_pos,
                                                 unsigned int work_size,
                                                 BoxDim box,
                                                 Scalar rescale_factor,
+                                                const Scalar* d_rescale_factor,
                                                 Scalar deltaT,
                                                 unsigned int offset,
                                                 bool limit = false,
@@ -48,6 +51,10 @@ __global__ void gpu_nvt_rescale_step_one_kernel(Scalar4* d_pos,
     // determine which particle this thread works on
     int group_idx = blockIdx.x * blockDim.x + threadIdx.x;
 
+    // a device-resident thermostat leaves the rescaling factor in device memory
+    if (d_rescale_factor != NULL)
+        rescale_factor = *d_rescale_factor;
+
     if (group_idx < work_size)
         {
         unsigned int idx = d_group_members[group_idx + offset];
@@ -97,7 +104,10 @@ __global__ void gpu_nvt_rescale_step_one_kernel(Scalar4* d_pos,
     \param box Box dimensions for periodic boundary condition handling
     \param block_size Size of the block to run
     \param rescale_factor Thermostat rescaling factor
+    \param d_rescale_factor Device pointer to the rescaling factor, overrides rescale_factor when
+           non-null
     \param deltaT Amount of real time to step forward in one time step
+    \param stream Stream to launch the kernel on
 */
 hipError_t gpu_nvt_rescale_step_one(Scalar4* d_pos,
                                     Scalar4* d_vel,
@@ -108,10 +118,12 @@ hipError_t gpu_nvt_rescale_step_one(Scalar4* d_pos,
                                     const BoxDim& box,
                                     unsigned int block_size,
                                     Scalar rescale_factor,
+                                    const Scalar* d_rescale_factor,
                                     Scalar deltaT,
                                     const GPUPartition& gpu_partition,
                                     bool use_limit,
-                                    Scalar maximum_displacement)
+                                    Scalar maximum_displacement,
+                                    hipStream_t stream)
     {
     unsigned int max_block_size;
     hipFuncAttributes attr;
@@ -136,7 +148,7 @@ hipError_t gpu_nvt_rescale_step_one(Scalar4* d_pos,
                            dim3(grid),
                            dim3(threads),
                            0,
-                           0,
+                           stream,
                            d_pos,
                            d_vel,
                            d_accel,
@@ -145,6 +157,7 @@ hipError_t gpu_nvt_rescale_step_one(Scalar4* d_pos,
                            nwork,
                            box,
                            rescale_factor,
+                           d_rescale_factor,
                            deltaT,
                            range.first,
                            use_limit,
@@ -170,11 +183,16 @@ __global__ void gpu_nvt_rescale_step_two_kernel(Scalar4* d_vel,
                                                 Scalar4* d_net_force,
                                                 Scalar deltaT,
                                                 Scalar rescale_factor,
+                                                const Scalar* d_rescale_factor,
                                                 unsigned int offset)
     {
     // determine which particle this thread works on
     int group_idx = blockIdx.x * blockDim.x + threadIdx.x;
 
+    // a device-resident thermostat leaves the rescaling factor in device memory
+    if (d_rescale_factor != NULL)
+        rescale_factor = *d_rescale_factor;
+
     if (group_idx < work_size)
         {
         unsigned int idx = d_group_members[group_idx + offset];
@@ -211,6 +229,9 @@ __global__ void gpu_nvt_rescale_step_two_kernel(Scalar4* d_vel,
     \param block_size Size of the block to execute on the device
     \param deltaT Amount of real time to step forward in one time step
     \param rescale_factor Exponential velocity scaling factor
+    \param d_rescale_factor Device pointer to the rescaling factor, overrides rescale_factor when
+           non-null
+    \param stream Stream to launch the kernel on
 */
 hipError_t gpu_nvt_rescale_step_two(Scalar4* d_vel,
                                     Scalar3* d_accel,
@@ -220,7 +241,9 @@ hipError_t gpu_nvt_rescale_step_two(Scalar4* d_vel,
                                     unsigned int block_size,
                                     Scalar deltaT,
                                     Scalar rescale_factor,
-                                    const GPUPartition& gpu_partition)
+                                    const Scalar* d_rescale_factor,
+                                    const GPUPartition& gpu_partition,
+                                    hipStream_t stream)
     {
     unsigned int max_block_size;
     hipFuncAttributes attr;
@@ -245,7 +268,7 @@ hipError_t gpu_nvt_rescale_step_two(Scalar4* d_vel,
                            dim3(grid),
                            dim3(threads),
                            0,
-                           0,
+                           stream,
                            d_vel,
                            d_accel,
                            d_group_members,
@@ -253,6 +276,7 @@ hipError_t gpu_nvt_rescale_step_two(Scalar4* d_vel,
                            d_net_force,
                            deltaT,
                            rescale_factor,
+                           d_rescale_factor,
                            range.first);
         }
 
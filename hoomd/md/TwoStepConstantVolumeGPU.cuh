@@ -24,10 +24,12 @@ hipError_t gpu_nvt_rescale_step_one(Scalar4* d_pos,
                                     const BoxDim& box,
                                     unsigned int block_size,
                                     Scalar rescale_factor,
+                                    const Scalar* d_rescale_factor,
                                     Scalar deltaT,
                                     const GPUPartition& gpu_partition,
                                     bool limit = false,
-                                    Scalar limit_displacement = Scalar(0.));
+                                    Scalar limit_displacement = Scalar(0.),
+                                    hipStream_t stream = 0);
 
 //! Kernel driver for the second part of the NVT update called by NVTUpdaterGPU
 hipError_t gpu_nvt_rescale_step_two(Scalar4* d_vel,
@@ -38,7 +40,9 @@ hipError_t gpu_nvt_rescale_step_two(Scalar4* d_vel,
                                     unsigned int block_size,
                                     Scalar deltaT,
                                     Scalar rescale_factor,
-                                    const GPUPartition& gpu_partition);
+                                    const Scalar* d_rescale_factor,
+                                    const GPUPartition& gpu_partition,
+                                    hipStream_t stream = 0);
 
     }  // end namespace kernel
     }  // end namespace md
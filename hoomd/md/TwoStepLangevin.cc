@@ -245,21 +245,53 @@ void TwoStepLangevin::integrateStepTwo(uint64_t timestep)
     // v(t+deltaT) = v(t+deltaT/2) + 1/2 * a(t+deltaT)*deltaT
     uint16_t seed = m_sysdef->getSeed();
 
+    // Draw the random values for the whole group in one tight pass before integrating. Each
+    // particle keeps its own tag-keyed Philox stream and in-stream draw order, so trajectories
+    // are identical to drawing inline; batching hoists the counter arithmetic and the
+    // transcendental-heavy Box-Muller evaluation into a loop the compiler can vectorize.
+    const unsigned int noise_stride = m_aniso ? 6 : 3;
+    m_noise.resize(noise_stride * group_size);
     for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
         {
         unsigned int j = m_group->getMemberIndex(group_idx);
-        unsigned int ptag = h_tag.data[j];
 
-        // Initialize the RNG
         RandomGenerator rng(hoomd::Seed(RNGIdentifier::TwoStepLangevin, timestep, seed),
-                            hoomd::Counter(ptag));
-
-        // first, calculate the BD forces
-        // Generate three random numbers
+                            hoomd::Counter(h_tag.data[j]));
         hoomd::UniformDistribution<Scalar> uniform(Scalar(-1), Scalar(1));
-        Scalar rx = uniform(rng);
-        Scalar ry = uniform(rng);
-        Scalar rz = uniform(rng);
+
+        Scalar* r = m_noise.data() + noise_stride * group_idx;
+        r[0] = uniform(rng);
+        r[1] = uniform(rng);
+        r[2] = uniform(rng);
+
+        if (m_aniso)
+            {
+            Scalar3 gamma_r = h_gamma_r.data[__scalar_as_int(h_pos.data[j].w)];
+            if (gamma_r.x > 0 || gamma_r.y > 0 || gamma_r.z > 0)
+                {
+                Scalar3 sigma_r
+                    = make_scalar3(fast::sqrt(Scalar(2.0) * gamma_r.x * currentTemp / m_deltaT),
+                                   fast::sqrt(Scalar(2.0) * gamma_r.y * currentTemp / m_deltaT),
+                                   fast::sqrt(Scalar(2.0) * gamma_r.z * currentTemp / m_deltaT));
+                if (m_noiseless_r)
+                    sigma_r = make_scalar3(0.0, 0.0, 0.0);
+
+                r[3] = hoomd::NormalDistribution<Scalar>(sigma_r.x)(rng);
+                r[4] = hoomd::NormalDistribution<Scalar>(sigma_r.y)(rng);
+                r[5] = hoomd::NormalDistribution<Scalar>(sigma_r.z)(rng);
+                }
+            }
+        }
+
+    for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+        {
+        unsigned int j = m_group->getMemberIndex(group_idx);
+        const Scalar* r = m_noise.data() + noise_stride * group_idx;
+
+        // first, calculate the BD forces from the pre-drawn random numbers
+        Scalar rx = r[0];
+        Scalar ry = r[1];
+        Scalar rz = r[2];
 
         Scalar gamma;
         unsigned int type = __scalar_as_int(h_pos.data[j].w);
@@ -313,17 +345,10 @@ void TwoStepLangevin::integrateStepTwo(uint64_t timestep)
                 // dynamics
                 vec3<Scalar> bf_torque;
 
-                // original Gaussian random torque
-                Scalar3 sigma_r
-                    = make_scalar3(fast::sqrt(Scalar(2.0) * gamma_r.x * currentTemp / m_deltaT),
-                                   fast::sqrt(Scalar(2.0) * gamma_r.y * currentTemp / m_deltaT),
-                                   fast::sqrt(Scalar(2.0) * gamma_r.z * currentTemp / m_deltaT));
-                if (m_noiseless_r)
-                    sigma_r = make_scalar3(0.0, 0.0, 0.0);
-
-                Scalar rand_x = hoomd::NormalDistribution<Scalar>(sigma_r.x)(rng);
-                Scalar rand_y = hoomd::NormalDistribution<Scalar>(sigma_r.y)(rng);
-                Scalar rand_z = hoomd::NormalDistribution<Scalar>(sigma_r.z)(rng);
+                // original Gaussian random torque, drawn in the batched pass above
+                Scalar rand_x = r[3];
+                Scalar rand_y = r[4];
+                Scalar rand_z = r[5];
 
                 // check for degenerate moment of inertia
                 bool x_zero, y_zero, z_zero;
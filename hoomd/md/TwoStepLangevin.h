@@ -10,6 +10,7 @@
 #endif
 
 #include <pybind11/pybind11.h>
+#include <vector>
 
 namespace hoomd
     {
@@ -75,6 +76,9 @@ class PYBIND11_EXPORT TwoStepLangevin : public TwoStepLangevinBase
 
     /// If set true, there will be no rotational noise (random torque)
     bool m_noiseless_r;
+
+    /// Scratch buffer holding the random draws for the current step
+    std::vector<Scalar> m_noise;
     };
 
     } // end namespace md
@@ -53,11 +53,8 @@ void ZeroMomentumUpdater::update(uint64_t timestep)
                                         access_location::host,
                                         access_mode::read);
 
-        // temp variables for holding the sums
-        Scalar sum_px = 0.0;
-        Scalar sum_py = 0.0;
-        Scalar sum_pz = 0.0;
-        unsigned int n = 0;
+        // temp variables for holding the sums: momentum and the particle count
+        Scalar sums[4] = {0.0, 0.0, 0.0, 0.0};
 
         // add up the momentum of every free particle (including floppy body particles) and every
         // central particle of a rigid body
@@ -66,32 +63,19 @@ void ZeroMomentumUpdater::update(uint64_t timestep)
             if (h_body.data[i] >= MIN_FLOPPY || h_body.data[i] == h_tag.data[i])
                 {
                 Scalar mass = h_vel.data[i].w;
-                sum_px += mass * h_vel.data[i].x;
-                sum_py += mass * h_vel.data[i].y;
-                sum_pz += mass * h_vel.data[i].z;
-                n++;
+                sums[0] += mass * h_vel.data[i].x;
+                sums[1] += mass * h_vel.data[i].y;
+                sums[2] += mass * h_vel.data[i].z;
+                sums[3] += Scalar(1.0);
                 }
             }
 
 #ifdef ENABLE_MPI
         if (m_pdata->getDomainDecomposition())
             {
-            MPI_Allreduce(MPI_IN_PLACE, &n, 1, MPI_INT, MPI_SUM, m_exec_conf->getMPICommunicator());
             MPI_Allreduce(MPI_IN_PLACE,
-                          &sum_px,
-                          1,
-                          MPI_HOOMD_SCALAR,
-                          MPI_SUM,
-                          m_exec_conf->getMPICommunicator());
-            MPI_Allreduce(MPI_IN_PLACE,
-                          &sum_py,
-                          1,
-                          MPI_HOOMD_SCALAR,
-                          MPI_SUM,
-                          m_exec_conf->getMPICommunicator());
-            MPI_Allreduce(MPI_IN_PLACE,
-                          &sum_pz,
-                          1,
+                          sums,
+                          4,
                           MPI_HOOMD_SCALAR,
                           MPI_SUM,
                           m_exec_conf->getMPICommunicator());
@@ -99,9 +83,9 @@ void ZeroMomentumUpdater::update(uint64_t timestep)
 #endif
 
         // calculate the average
-        Scalar avg_px = sum_px / Scalar(n);
-        Scalar avg_py = sum_py / Scalar(n);
-        Scalar avg_pz = sum_pz / Scalar(n);
+        Scalar avg_px = sums[0] / sums[3];
+        Scalar avg_py = sums[1] / sums[3];
+        Scalar avg_pz = sums[2] / sums[3];
 
         // subtract this momentum from every free particle (including floppy body particles) and
         // every central particle of a rigid body
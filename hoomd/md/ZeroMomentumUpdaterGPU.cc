@@ -0,0 +1,142 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ZeroMomentumUpdaterGPU.cc
+    \brief Defines the ZeroMomentumUpdaterGPU class
+*/
+
+#include "ZeroMomentumUpdaterGPU.h"
+#include "ZeroMomentumUpdaterGPU.cuh"
+
+#ifdef ENABLE_MPI
+#include "hoomd/HOOMDMPI.h"
+#endif
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System to zero the momentum of
+ */
+ZeroMomentumUpdaterGPU::ZeroMomentumUpdaterGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                               std::shared_ptr<Trigger> trigger)
+    : ZeroMomentumUpdater(sysdef, trigger)
+    {
+    if (!m_exec_conf->isCUDAEnabled())
+        {
+        throw std::runtime_error("Cannot initialize ZeroMomentumUpdaterGPU on a CPU device.");
+        }
+
+    m_block_size = 256;
+    m_num_blocks = m_pdata->getMaxN() / m_block_size + 1;
+
+    GPUArray<Scalar4> partial_sum(m_num_blocks, m_exec_conf);
+    m_partial_sum.swap(partial_sum);
+
+    GPUArray<Scalar4> sum(1, m_exec_conf);
+    m_sum.swap(sum);
+    }
+
+ZeroMomentumUpdaterGPU::~ZeroMomentumUpdaterGPU()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying ZeroMomentumUpdaterGPU" << endl;
+    }
+
+/*! Perform the needed calculations to zero the system's momentum
+    \param timestep Current time step of the simulation
+
+    The momentum sum and the velocity correction both run on the device. On a single rank the
+    reduced sum never leaves the GPU; under MPI it is staged through the host for the global
+    allreduce.
+*/
+void ZeroMomentumUpdaterGPU::update(uint64_t timestep)
+    {
+    Updater::update(timestep);
+
+    // resize the partial sum space if the particle data arrays have grown
+    m_num_blocks = m_pdata->getN() / m_block_size + 1;
+    if (m_num_blocks > m_partial_sum.getNumElements())
+        {
+        m_partial_sum.resize(m_num_blocks);
+        }
+
+        {
+        ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
+                                   access_location::device,
+                                   access_mode::read);
+        ArrayHandle<unsigned int> d_body(m_pdata->getBodies(),
+                                         access_location::device,
+                                         access_mode::read);
+        ArrayHandle<unsigned int> d_tag(m_pdata->getTags(),
+                                        access_location::device,
+                                        access_mode::read);
+        ArrayHandle<Scalar4> d_partial_sum(m_partial_sum,
+                                           access_location::device,
+                                           access_mode::overwrite);
+        ArrayHandle<Scalar4> d_sum(m_sum, access_location::device, access_mode::overwrite);
+
+        kernel::gpu_zero_momentum_sum(d_sum.data,
+                                      d_partial_sum.data,
+                                      d_vel.data,
+                                      d_body.data,
+                                      d_tag.data,
+                                      m_pdata->getN(),
+                                      m_block_size,
+                                      m_num_blocks);
+
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        // the global sum must pass through the host
+        ArrayHandle<Scalar4> h_sum(m_sum, access_location::host, access_mode::readwrite);
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &h_sum.data[0],
+                      4,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+        {
+        ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
+                                   access_location::device,
+                                   access_mode::readwrite);
+        ArrayHandle<unsigned int> d_body(m_pdata->getBodies(),
+                                         access_location::device,
+                                         access_mode::read);
+        ArrayHandle<unsigned int> d_tag(m_pdata->getTags(),
+                                        access_location::device,
+                                        access_mode::read);
+        ArrayHandle<Scalar4> d_sum(m_sum, access_location::device, access_mode::read);
+
+        kernel::gpu_zero_momentum_apply(d_vel.data,
+                                        d_body.data,
+                                        d_tag.data,
+                                        d_sum.data,
+                                        m_pdata->getN(),
+                                        m_block_size);
+
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+    }
+
+namespace detail
+    {
+void export_ZeroMomentumUpdaterGPU(pybind11::module& m)
+    {
+    pybind11::class_<ZeroMomentumUpdaterGPU,
+                     ZeroMomentumUpdater,
+                     std::shared_ptr<ZeroMomentumUpdaterGPU>>(m, "ZeroMomentumUpdaterGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<Trigger>>());
+    }
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
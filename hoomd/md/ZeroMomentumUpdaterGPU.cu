@@ -0,0 +1,245 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "ZeroMomentumUpdaterGPU.cuh"
+
+/*! \file ZeroMomentumUpdaterGPU.cu
+    \brief Defines GPU kernel code for zeroing the system momentum on the GPU.
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Sums the momentum of the eligible particles within a block
+/*! \param d_partial_sum Partial momentum sums, one Scalar4 per block
+    \param d_vel particle velocities and masses
+    \param d_body particle body ids
+    \param d_tag particle tags
+    \param N number of local particles
+
+    The momentum of every free particle (including floppy body particles) and every central
+    particle of a rigid body is accumulated in shared memory. x, y, and z hold the momentum
+    components and w counts the eligible particles.
+*/
+__global__ void gpu_zero_momentum_partial_sum_kernel(Scalar4* d_partial_sum,
+                                                     const Scalar4* d_vel,
+                                                     const unsigned int* d_body,
+                                                     const unsigned int* d_tag,
+                                                     const unsigned int N)
+    {
+    HIP_DYNAMIC_SHARED(char, s_data)
+    Scalar4* momentum_sdata = (Scalar4*)&s_data[0];
+
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    Scalar4 my_element = make_scalar4(0, 0, 0, 0);
+    if (idx < N)
+        {
+        unsigned int body = __ldg(d_body + idx);
+        if (body >= MIN_FLOPPY || body == __ldg(d_tag + idx))
+            {
+            Scalar4 vel = __ldg(d_vel + idx);
+            Scalar mass = vel.w;
+            my_element = make_scalar4(mass * vel.x, mass * vel.y, mass * vel.z, Scalar(1.0));
+            }
+        }
+    momentum_sdata[threadIdx.x] = my_element;
+    __syncthreads();
+
+    // reduce the sum in parallel
+    int offs = blockDim.x >> 1;
+    while (offs > 0)
+        {
+        if (threadIdx.x < offs)
+            {
+            momentum_sdata[threadIdx.x].x += momentum_sdata[threadIdx.x + offs].x;
+            momentum_sdata[threadIdx.x].y += momentum_sdata[threadIdx.x + offs].y;
+            momentum_sdata[threadIdx.x].z += momentum_sdata[threadIdx.x + offs].z;
+            momentum_sdata[threadIdx.x].w += momentum_sdata[threadIdx.x + offs].w;
+            }
+        offs >>= 1;
+        __syncthreads();
+        }
+
+    // write out our partial sum
+    if (threadIdx.x == 0)
+        {
+        d_partial_sum[blockIdx.x] = momentum_sdata[0];
+        }
+    }
+
+//! Completes the momentum sum over all blocks
+/*! \param d_sum Total momentum sum and eligible particle count (output)
+    \param d_partial_sum Partial momentum sums, one Scalar4 per block
+    \param num_blocks Number of partial sums to reduce
+
+    Only one block is run on the device. The block iterates over the partial sums, producing
+    the total momentum sum and eligible particle count.
+*/
+__global__ void gpu_zero_momentum_reduce_partial_sum_kernel(Scalar4* d_sum,
+                                                            Scalar4* d_partial_sum,
+                                                            unsigned int num_blocks)
+    {
+    HIP_DYNAMIC_SHARED(char, s_data)
+    Scalar4* momentum_sdata = (Scalar4*)&s_data[0];
+
+    Scalar4 sum = make_scalar4(0, 0, 0, 0);
+
+    // sum up the values in the partial sum via a sliding window
+    for (int start = 0; start < num_blocks; start += blockDim.x)
+        {
+        if (start + threadIdx.x < num_blocks)
+            momentum_sdata[threadIdx.x] = d_partial_sum[start + threadIdx.x];
+        else
+            momentum_sdata[threadIdx.x] = make_scalar4(0, 0, 0, 0);
+        __syncthreads();
+
+        // reduce the sum in parallel
+        int offs = blockDim.x >> 1;
+        while (offs > 0)
+            {
+            if (threadIdx.x < offs)
+                {
+                momentum_sdata[threadIdx.x].x += momentum_sdata[threadIdx.x + offs].x;
+                momentum_sdata[threadIdx.x].y += momentum_sdata[threadIdx.x + offs].y;
+                momentum_sdata[threadIdx.x].z += momentum_sdata[threadIdx.x + offs].z;
+                momentum_sdata[threadIdx.x].w += momentum_sdata[threadIdx.x + offs].w;
+                }
+            offs >>= 1;
+            __syncthreads();
+            }
+
+        // everybody sums up the total
+        sum.x += momentum_sdata[0].x;
+        sum.y += momentum_sdata[0].y;
+        sum.z += momentum_sdata[0].z;
+        sum.w += momentum_sdata[0].w;
+        }
+
+    if (threadIdx.x == 0)
+        {
+        *d_sum = sum;
+        }
+    }
+
+/*! \param d_sum Total momentum sum and eligible particle count (output)
+    \param d_partial_sum Partial momentum sums, one Scalar4 per block
+    \param d_vel particle velocities and masses
+    \param d_body particle body ids
+    \param d_tag particle tags
+    \param N number of local particles
+    \param block_size block size to execute the kernels with
+    \param num_blocks number of blocks to execute
+
+    This is a driver for gpu_zero_momentum_partial_sum_kernel() and
+    gpu_zero_momentum_reduce_partial_sum_kernel(), see them for details.
+*/
+hipError_t gpu_zero_momentum_sum(Scalar4* d_sum,
+                                 Scalar4* d_partial_sum,
+                                 const Scalar4* d_vel,
+                                 const unsigned int* d_body,
+                                 const unsigned int* d_tag,
+                                 const unsigned int N,
+                                 const unsigned int block_size,
+                                 const unsigned int num_blocks)
+    {
+    dim3 grid(num_blocks, 1, 1);
+    dim3 threads(block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_zero_momentum_partial_sum_kernel),
+                       grid,
+                       threads,
+                       block_size * sizeof(Scalar4),
+                       0,
+                       d_partial_sum,
+                       d_vel,
+                       d_body,
+                       d_tag,
+                       N);
+
+    hipLaunchKernelGGL((gpu_zero_momentum_reduce_partial_sum_kernel),
+                       dim3(1, 1, 1),
+                       threads,
+                       block_size * sizeof(Scalar4),
+                       0,
+                       d_sum,
+                       d_partial_sum,
+                       num_blocks);
+
+    return hipSuccess;
+    }
+
+//! Subtracts the average momentum from every eligible particle
+/*! \param d_vel particle velocities and masses
+    \param d_body particle body ids
+    \param d_tag particle tags
+    \param d_sum Total momentum sum and eligible particle count
+    \param N number of local particles
+
+    The average momentum is formed from the reduced sum on the device, so the correction
+    applies without staging the sum through the host.
+*/
+__global__ void gpu_zero_momentum_apply_kernel(Scalar4* d_vel,
+                                               const unsigned int* d_body,
+                                               const unsigned int* d_tag,
+                                               const Scalar4* d_sum,
+                                               const unsigned int N)
+    {
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (idx < N)
+        {
+        unsigned int body = __ldg(d_body + idx);
+        if (body >= MIN_FLOPPY || body == __ldg(d_tag + idx))
+            {
+            Scalar4 sum = *d_sum;
+            Scalar4 vel = d_vel[idx];
+            Scalar mass = vel.w;
+
+            vel.x -= sum.x / (sum.w * mass);
+            vel.y -= sum.y / (sum.w * mass);
+            vel.z -= sum.z / (sum.w * mass);
+            d_vel[idx] = vel;
+            }
+        }
+    }
+
+/*! \param d_vel particle velocities and masses
+    \param d_body particle body ids
+    \param d_tag particle tags
+    \param d_sum Total momentum sum and eligible particle count
+    \param N number of local particles
+    \param block_size block size to execute the kernel with
+
+    This is a driver for gpu_zero_momentum_apply_kernel(), see it for details.
+*/
+hipError_t gpu_zero_momentum_apply(Scalar4* d_vel,
+                                   const unsigned int* d_body,
+                                   const unsigned int* d_tag,
+                                   const Scalar4* d_sum,
+                                   const unsigned int N,
+                                   const unsigned int block_size)
+    {
+    dim3 grid((N / block_size) + 1, 1, 1);
+    dim3 threads(block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_zero_momentum_apply_kernel),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       d_vel,
+                       d_body,
+                       d_tag,
+                       d_sum,
+                       N);
+
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
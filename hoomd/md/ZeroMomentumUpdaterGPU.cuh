@@ -0,0 +1,42 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/ParticleData.cuh"
+
+/*! \file ZeroMomentumUpdaterGPU.cuh
+    \brief Declares GPU kernel code for zeroing the system momentum on the GPU.
+*/
+
+#ifndef __ZEROMOMENTUMUPDATERGPU_CUH__
+#define __ZEROMOMENTUMUPDATERGPU_CUH__
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Kernel driver that sums the momentum of the free and central particles
+hipError_t gpu_zero_momentum_sum(Scalar4* d_sum,
+                                 Scalar4* d_partial_sum,
+                                 const Scalar4* d_vel,
+                                 const unsigned int* d_body,
+                                 const unsigned int* d_tag,
+                                 const unsigned int N,
+                                 const unsigned int block_size,
+                                 const unsigned int num_blocks);
+
+//! Kernel driver that subtracts the average momentum from every eligible particle
+hipError_t gpu_zero_momentum_apply(Scalar4* d_vel,
+                                   const unsigned int* d_body,
+                                   const unsigned int* d_tag,
+                                   const Scalar4* d_sum,
+                                   const unsigned int N,
+                                   const unsigned int block_size);
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __ZEROMOMENTUMUPDATERGPU_CUH__
@@ -0,0 +1,54 @@
+// Copyright (c) 2009-2023 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ZeroMomentumUpdaterGPU.h
+    \brief Declares an updater that zeros the momentum of the system on the GPU
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "ZeroMomentumUpdater.h"
+
+#include "hoomd/GPUArray.h"
+
+#include <pybind11/pybind11.h>
+
+#ifndef __ZEROMOMENTUMUPDATERGPU_H__
+#define __ZEROMOMENTUMUPDATERGPU_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Updates particle velocities to zero the momentum on the GPU
+/*! The momentum sum is reduced on the device and the correction is applied by a kernel that
+    reads the reduced sum directly, so single-rank simulations zero the momentum without any
+    host synchronization. Under MPI the reduced sum passes through the host for the global
+    allreduce.
+
+    \ingroup updaters
+*/
+class PYBIND11_EXPORT ZeroMomentumUpdaterGPU : public ZeroMomentumUpdater
+    {
+    public:
+    //! Constructor
+    ZeroMomentumUpdaterGPU(std::shared_ptr<SystemDefinition> sysdef,
+                           std::shared_ptr<Trigger> trigger);
+    virtual ~ZeroMomentumUpdaterGPU();
+
+    //! Take one timestep forward
+    virtual void update(uint64_t timestep);
+
+    private:
+    unsigned int m_block_size;      //!< block size for partial sum memory
+    unsigned int m_num_blocks;      //!< number of memory blocks reserved for partial sum memory
+    GPUArray<Scalar4> m_partial_sum; //!< memory space for partial sums over momentum
+    GPUArray<Scalar4> m_sum;         //!< memory space for the total momentum sum and count
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
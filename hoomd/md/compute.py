@@ -303,6 +303,43 @@ class ThermodynamicQuantities(Compute):
         :math:`[\\mathrm{length}^{D}]`."""
         return self._cpp_obj.volume
 
+    def publish_metrics(self, prefix):
+        """Publish all scalar quantities to the C++ metric registry.
+
+        Args:
+            prefix (str): Namespace prefix for the published metric names.
+                With ``prefix='thermo'`` the quantities appear under
+                ``thermo.kinetic_temperature``, ``thermo.pressure``, etc.
+
+        Published metrics are evaluated entirely on the C++ side and retrieved
+        by consumers such as `hoomd.write.Table` and `hoomd.write.HDF5Log` in a
+        single call per frame, avoiding the per-quantity dispatch overhead of
+        logging each property individually. Do not add quantities to a writer's
+        logger and publish them as metrics at the same time, or they will be
+        computed twice.
+
+        `publish_metrics` may only be called while the compute is attached to a
+        simulation. The metrics are removed when the compute is removed from
+        the simulation.
+
+        Examples::
+
+            thermo.publish_metrics(prefix='thermo')
+        """
+        if not self._attached:
+            raise RuntimeError(
+                "publish_metrics requires that the compute is attached to a "
+                "simulation.")
+        self._cpp_obj.connectMetrics(prefix)
+
+    def unpublish_metrics(self):
+        """Remove this compute's quantities from the C++ metric registry."""
+        if self._attached:
+            self._cpp_obj.disconnectMetrics()
+
+    def _detach_hook(self):
+        self._cpp_obj.disconnectMetrics()
+
 
 class HarmonicAveragedThermodynamicQuantities(Compute):
     """Compute harmonic averaged thermodynamic properties of particles.
@@ -381,3 +418,93 @@ class HarmonicAveragedThermodynamicQuantities(Compute):
         """Average pressure :math:`[\\mathrm{pressure}]`."""
         self._cpp_obj.compute(self._simulation.timestep)
         return self._cpp_obj.pressure
+
+
+class SpatialThermodynamicQuantities(Compute):
+    """Compute spatially binned thermodynamic properties of particles.
+
+    Args:
+        filter (hoomd.filter.filter_like): Particle filter to compute
+            thermodynamic properties for.
+        grid (tuple[int, int, int]): Number of bins along the x, y, and z
+            directions of the simulation box.
+
+    `SpatialThermodynamicQuantities` bins the particles selected by the filter
+    onto a regular ``grid`` spanning the global simulation box and computes
+    per-bin profiles of the number density, the translational kinetic energy,
+    and the virial tensor. The grid is defined in fractional coordinates of the
+    (possibly triclinic) box, so the bins follow the box as it changes shape or
+    size. Add a `SpatialThermodynamicQuantities` instance to a logger to save
+    the profiles to a file, see `hoomd.logging.Logger` for more details.
+
+    Bins are indexed ``(ix * ny + iy) * nz + iz`` where ``(nx, ny, nz)`` is
+    ``grid``.
+
+    Examples::
+
+        spatial = hoomd.md.compute.SpatialThermodynamicQuantities(
+            filter=hoomd.filter.All(), grid=(8, 8, 8))
+
+    Attributes:
+        filter (hoomd.filter.filter_like): Subset of particles to compute
+            thermodynamic properties for.
+
+        grid (tuple[int, int, int]): Number of bins along the x, y, and z
+            directions of the simulation box.
+    """
+
+    def __init__(self, filter, grid):
+
+        # store metadata
+        param_dict = ParameterDict(grid=(int, int, int))
+        param_dict["grid"] = grid
+        # set defaults
+        self._param_dict.update(param_dict)
+
+        self._filter = filter
+        # initialize base class
+        super().__init__()
+
+    def _attach_hook(self):
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            thermo_spatial_cls = _md.ComputeThermoSpatial
+        else:
+            thermo_spatial_cls = _md.ComputeThermoSpatialGPU
+        group = self._simulation.state._get_group(self._filter)
+        self._cpp_obj = thermo_spatial_cls(self._simulation.state._cpp_sys_def,
+                                           group, *self.grid)
+
+    @log(category='sequence', requires_run=True)
+    def density_profile(self):
+        """Per-bin number density :math:`[\\mathrm{length}^{-D}]`.
+
+        The number of selected particles in each bin divided by the bin
+        volume (area in 2D).
+        """
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.density_profile
+
+    @log(category='sequence', requires_run=True)
+    def kinetic_energy_profile(self):
+        """Per-bin translational kinetic energy :math:`[\\mathrm{energy}]`.
+
+        .. math::
+
+            K_\\mathrm{translational,bin} = \\frac{1}{2}
+            \\sum_{i \\in \\mathrm{bin}} m_i v_i^2
+        """
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.kinetic_energy_profile
+
+    @log(category='sequence', requires_run=True)
+    def virial_profile(self):
+        """Per-bin virial tensor components :math:`[\\mathrm{energy}]`.
+
+        An ``(nx * ny * nz, 6)`` array holding the sums of the per-particle
+        net virial components (:math:`W^{xx}`, :math:`W^{xy}`,
+        :math:`W^{xz}`, :math:`W^{yy}`, :math:`W^{yz}`, :math:`W^{zz}`) in
+        each bin. The profile is `NaN` when the pressure tensor is not
+        computed on the current timestep.
+        """
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.virial_profile
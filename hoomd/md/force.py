@@ -79,6 +79,12 @@ class Force(Compute):
         """float: The potential energy :math:`U` of the system from this force \
         :math:`[\\mathrm{energy}]`."""
         self._cpp_obj.compute(self._simulation.timestep)
+        integrator = self._simulation.operations.integrator
+        if (integrator is not None and integrator._attached
+                and self in getattr(integrator, 'forces', ())):
+            # one collective call reduces the energies of all of the
+            # integrator's forces, seeding their caches for later queries
+            integrator._cpp_obj.reduceForceEnergies(self._simulation.timestep)
         return self._cpp_obj.calcEnergySum()
 
     @log(category="particle", requires_run=True)
@@ -156,6 +162,17 @@ class Force(Compute):
             virial.append(self._cpp_obj.getExternalVirial(i))
         return numpy.array(virial, dtype=numpy.float64)
 
+    @log(requires_run=True, default=False)
+    def compute_time(self):
+        """float: The wall time spent computing this force.
+
+        `compute_time` is the cumulative number of seconds spent computing
+        this force since it was created. In GPU simulations, kernel launches
+        are asynchronous and `compute_time` covers the host side of the
+        computation only.
+        """
+        return self._cpp_obj.compute_time
+
     @property
     def cpu_local_force_arrays(self):
         """hoomd.md.data.ForceLocalAccess: Expose force arrays on the CPU.
@@ -612,3 +629,109 @@ class Constant(Force):
 
         self._cpp_obj = my_class(sim.state._cpp_sys_def,
                                  sim.state._get_group(self.filter))
+
+
+class COMDistanceBias(Force):
+    r"""Bias force on the distance between two centers of mass.
+
+    Args:
+        filter_a (`hoomd.filter`): First subset of particles.
+        filter_b (`hoomd.filter`): Second subset of particles.
+        kappa (float): Umbrella spring constant
+            :math:`[\mathrm{energy} \cdot \mathrm{length}^{-2}]`.
+        r0 (float): Umbrella minimum :math:`[\mathrm{length}]`.
+
+    `COMDistanceBias` applies a bias potential along the collective variable
+    :math:`s = |\vec{R}_A - \vec{R}_B|`, where :math:`\vec{R}_A` and
+    :math:`\vec{R}_B` are the unwrapped centers of mass of the particles
+    selected by ``filter_a`` and ``filter_b``:
+
+    .. math::
+
+        U(s) = \frac{\kappa}{2} (s - r_0)^2
+               + \sum_i h \exp\left(-\frac{(s - s_i)^2}{2 \sigma^2}\right)
+
+    With the default zero hill height, `COMDistanceBias` performs umbrella
+    sampling. Set `hill_height`, `hill_width`, and `hill_period` to deposit
+    Gaussian hills at the current value of :math:`s` every `hill_period`
+    steps and perform metadynamics along :math:`s`. The bias force on each
+    group member is the total group force :math:`-dU/ds` distributed by mass
+    fraction.
+
+    When `multi_walker` is enabled and the simulation runs in multiple
+    communicator partitions, hills deposited by every partition are shared,
+    so the walkers fill the free energy surface together. All partitions must
+    reach the depositing timesteps in lockstep.
+
+    Examples::
+
+        bias = hoomd.md.force.COMDistanceBias(
+            filter_a=hoomd.filter.Type(['A']),
+            filter_b=hoomd.filter.Type(['B']),
+            kappa=10.0, r0=2.0)
+        bias.hill_height = 0.5
+        bias.hill_width = 0.2
+        bias.hill_period = 500
+
+    Note:
+
+        The virial associated with the bias force is 0.
+
+    Attributes:
+        filter_a (`hoomd.filter`): First subset of particles.
+        filter_b (`hoomd.filter`): Second subset of particles.
+        kappa (float): Umbrella spring constant
+            :math:`[\mathrm{energy} \cdot \mathrm{length}^{-2}]`.
+        r0 (float): Umbrella minimum :math:`[\mathrm{length}]`.
+        hill_height (float): Gaussian hill height, 0 disables hill
+            deposition :math:`[\mathrm{energy}]`.
+        hill_width (float): Gaussian hill width :math:`[\mathrm{length}]`.
+        hill_period (int): Number of steps between hill depositions, 0
+            disables hill deposition.
+        multi_walker (bool): Share deposited hills across the partitions of
+            the MPI world.
+    """
+
+    def __init__(self, filter_a, filter_b, kappa, r0):
+        super().__init__()
+        # store metadata
+        param_dict = ParameterDict(filter_a=ParticleFilter,
+                                   filter_b=ParticleFilter,
+                                   kappa=float(kappa),
+                                   r0=float(r0),
+                                   hill_height=float(0),
+                                   hill_width=float(0),
+                                   hill_period=int(0),
+                                   multi_walker=bool(False))
+        param_dict["filter_a"] = filter_a
+        param_dict["filter_b"] = filter_b
+        # set defaults
+        self._param_dict.update(param_dict)
+
+    def _attach_hook(self):
+        # initialize the reflected c++ class
+        sim = self._simulation
+
+        self._cpp_obj = _md.COMDistanceBias(
+            sim.state._cpp_sys_def, sim.state._get_group(self.filter_a),
+            sim.state._get_group(self.filter_b))
+
+    @log(requires_run=True)
+    def collective_variable(self):
+        """float: Center of mass distance at the last computation \
+        :math:`[\\mathrm{length}]`."""
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.collective_variable
+
+    @property
+    def hills(self):
+        """list[tuple[float, float]]: Deposited hills as (center, height) \
+        tuples.
+
+        Assign a previously saved list to continue a metadynamics run.
+        """
+        return [tuple(hill) for hill in self._cpp_obj.getHills()]
+
+    @hills.setter
+    def hills(self, hills):
+        self._cpp_obj.setHills([tuple(hill) for hill in hills])
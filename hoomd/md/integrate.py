@@ -167,6 +167,10 @@ class Integrator(_DynamicIntegrator):
         half_step_hook (hoomd.md.HalfStepHook): Enables the user to perform
             arbitrary computations during the half-step of the integration.
 
+        pipeline_kspace (bool): When True, start the reciprocal space part of
+          `hoomd.md.long_range.pppm.Coulomb` forces before the other forces so
+          that it overlaps with the real space force computation on the GPU.
+
     `Integrator` is the top level class that orchestrates the time integration
     step in molecular dynamics simulations. The integration `methods` define
     the equations of motion to integrate under the influence of the given
@@ -276,6 +280,9 @@ class Integrator(_DynamicIntegrator):
 
         half_step_hook (hoomd.md.HalfStepHook): User defined implementation to
             perform computations during the half-step of the integration.
+
+        pipeline_kspace (bool): When True, overlap the reciprocal space part of
+            PPPM forces with the real space force computation.
     """
 
     def __init__(self,
@@ -285,7 +292,8 @@ class Integrator(_DynamicIntegrator):
                  constraints=None,
                  methods=None,
                  rigid=None,
-                 half_step_hook=None):
+                 half_step_hook=None,
+                 pipeline_kspace=False):
 
         super().__init__(forces, constraints, methods, rigid)
 
@@ -294,7 +302,8 @@ class Integrator(_DynamicIntegrator):
                 dt=float(dt),
                 integrate_rotational_dof=bool(integrate_rotational_dof),
                 half_step_hook=OnlyTypes(hoomd.md.HalfStepHook,
-                                         allow_none=True)))
+                                         allow_none=True),
+                pipeline_kspace=bool(pipeline_kspace)))
 
         self.half_step_hook = half_step_hook
 
@@ -324,3 +333,134 @@ class Integrator(_DynamicIntegrator):
         """
         v = self._cpp_obj.computeLinearMomentum()
         return (v.x, v.y, v.z)
+
+
+@hoomd.logging.modify_namespace(("md", "RESPAIntegrator"))
+class RESPAIntegrator(Integrator):
+    r"""Molecular dynamics time integration with multiple time stepping.
+
+    Args:
+        dt (float): Integrator time step size :math:`[\mathrm{time}]`.
+
+        outer_forces (Sequence[hoomd.md.force.Force]): Sequence of forces that
+          are evaluated every `outer_interval` time steps. The default value of
+          ``None`` initializes an empty list.
+
+        outer_interval (int): Number of time steps between evaluations of the
+          `outer_forces`.
+
+        methods (Sequence[hoomd.md.methods.Method]): Sequence of integration
+          methods. The default value of ``None`` initializes an empty list.
+
+        forces (Sequence[hoomd.md.force.Force]): Sequence of forces evaluated
+          every time step. The default value of ``None`` initializes an empty
+          list.
+
+        integrate_rotational_dof (bool): When True, integrate rotational degrees
+          of freedom.
+
+        constraints (Sequence[hoomd.md.constrain.Constraint]): Sequence of
+          constraint forces applied to the particles in the system.
+
+        rigid (hoomd.md.constrain.Rigid): An object defining the rigid bodies in
+          the simulation.
+
+        half_step_hook (hoomd.md.HalfStepHook): Enables the user to perform
+            arbitrary computations during the half-step of the integration.
+
+    `RESPAIntegrator` extends `Integrator` with a second force list,
+    `outer_forces`, whose elements are only evaluated every `outer_interval`
+    time steps. On intermediate steps the outer forces contribute their most
+    recently computed values to the net force. Assign slowly varying,
+    expensive computes (such as `hoomd.md.long_range.pppm.Coulomb` or pair
+    potentials with large cutoffs) to `outer_forces` to amortize their cost
+    over many time steps.
+
+    This is the constant-force extrapolation variant of multiple time
+    stepping. The outer forces are held fixed between evaluations rather than
+    applied as impulses, so `outer_interval` must be kept small enough that
+    the outer forces change little over ``outer_interval * dt``.
+
+    Warning:
+        Multiple time stepping introduces integration error that grows with
+        `outer_interval`. Validate energy conservation for your system before
+        using large intervals.
+
+    Note:
+        A force may appear in `forces` or `outer_forces`, but not both.
+
+    Examples::
+
+        lj = hoomd.md.pair.LJ(nlist=hoomd.md.nlist.Cell(buffer=0.4))
+        lj.params.default = dict(epsilon=1.0, sigma=1.0)
+        lj.r_cut[('A', 'A')] = 2.5
+        coulomb, _ = hoomd.md.long_range.pppm.make_pppm_coulomb_forces(
+            nlist=hoomd.md.nlist.Cell(buffer=0.4), resolution=(64, 64, 64),
+            order=6, r_cut=3.0)
+        nve = hoomd.md.methods.NVE(filter=hoomd.filter.All())
+        integrator = hoomd.md.RESPAIntegrator(dt=0.001, methods=[nve],
+                                              forces=[lj],
+                                              outer_forces=[coulomb],
+                                              outer_interval=4)
+        sim.operations.integrator = integrator
+
+    Attributes:
+        outer_forces (list[hoomd.md.force.Force]): List of forces evaluated
+            every `outer_interval` time steps.
+
+        outer_interval (int): Number of time steps between evaluations of the
+            `outer_forces`.
+    """
+
+    def __init__(self,
+                 dt,
+                 integrate_rotational_dof=False,
+                 forces=None,
+                 outer_forces=None,
+                 outer_interval=1,
+                 constraints=None,
+                 methods=None,
+                 rigid=None,
+                 half_step_hook=None):
+
+        super().__init__(dt, integrate_rotational_dof, forces, constraints,
+                         methods, rigid, half_step_hook)
+
+        outer_forces = [] if outer_forces is None else outer_forces
+        self._outer_forces = syncedlist.SyncedList(
+            Force, syncedlist._PartialGetAttr('_cpp_obj'),
+            iterable=outer_forces)
+
+        self._param_dict.update(ParameterDict(outer_interval=int(
+            outer_interval)))
+
+    def _attach_hook(self):
+        # initialize the reflected c++ class
+        self._cpp_obj = _md.IntegratorRESPA(self._simulation.state._cpp_sys_def,
+                                            self.dt, self.outer_interval)
+        self._outer_forces._sync(self._simulation, self._cpp_obj.outer_forces)
+        # Call attach from DynamicIntegrator which attaches forces,
+        # constraint_forces, and methods, and calls super()._attach() itself.
+        _DynamicIntegrator._attach_hook(self)
+
+    def _detach_hook(self):
+        self._outer_forces._unsync()
+        super()._detach_hook()
+
+    @property
+    def outer_forces(self):
+        return self._outer_forces
+
+    @outer_forces.setter
+    def outer_forces(self, value):
+        _set_synced_list(self._outer_forces, value)
+
+    @property
+    def _children(self):
+        children = super()._children
+        children.extend(self.outer_forces)
+
+        for child in self.outer_forces:
+            children.extend(child._children)
+
+        return children
@@ -110,7 +110,10 @@ class Triplet(Force):
                 RuntimeWarning)
             self.nlist = copy.deepcopy(self.nlist)
         self.nlist._attach(self._simulation)
-        self.nlist._cpp_obj.setStorageMode(_md.NeighborList.storageMode.full)
+        # triplet potentials require all neighbors of each particle: register a
+        # full storage request so pair potentials sharing this list cannot
+        # downgrade it to half storage
+        self.nlist._cpp_obj.addFullStorageRequest()
         if isinstance(self._simulation.device, hoomd.device.CPU):
             cls = getattr(_md, self._cpp_class_name)
         else:
@@ -119,6 +122,10 @@ class Triplet(Force):
         self._cpp_obj = cls(self._simulation.state._cpp_sys_def,
                             self.nlist._cpp_obj)
 
+    def _detach_hook(self):
+        self.nlist._cpp_obj.removeFullStorageRequest()
+        self.nlist._detach()
+
 
 class Tersoff(Triplet):
     r"""Tersoff force.
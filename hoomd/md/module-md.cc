@@ -19,8 +19,10 @@ void export_ActiveForceConstraintComputePlane(pybind11::module& m);
 void export_ActiveForceConstraintComputePrimitive(pybind11::module& m);
 void export_ActiveForceConstraintComputeSphere(pybind11::module& m);
 void export_ActiveRotationalDiffusionUpdater(pybind11::module& m);
+void export_COMDistanceBias(pybind11::module& m);
 void export_ComputeThermo(pybind11::module& m);
 void export_ComputeThermoHMA(pybind11::module& m);
+void export_ComputeThermoSpatial(pybind11::module& m);
 void export_ConstantForceCompute(pybind11::module& m);
 void export_HarmonicAngleForceCompute(pybind11::module& m);
 void export_CosineSqAngleForceCompute(pybind11::module& m);
@@ -52,6 +54,7 @@ void export_PotentialPairExpandedLJ(pybind11::module& m);
 void export_PotentialPairExpandedGaussian(pybind11::module& m);
 void export_PotentialPairExpandedMie(pybind11::module& m);
 void export_PotentialPairYukawa(pybind11::module& m);
+void export_PotentialPairLJYukawa(pybind11::module& m);
 void export_PotentialPairEwald(pybind11::module& m);
 void export_PotentialPairMorse(pybind11::module& m);
 void export_PotentialPairMoliere(pybind11::module& m);
@@ -98,7 +101,9 @@ void export_PotentialExternalWallMorse(pybind11::module& m);
 
 void export_PotentialPairDPDThermoDPD(pybind11::module& m);
 void export_PotentialPairDPDThermoLJ(pybind11::module& m);
+void export_PotentialPairDPDThermoGauss(pybind11::module& m);
 
+void export_IntegratorRESPA(pybind11::module& m);
 void export_IntegratorTwoStep(pybind11::module& m);
 void export_IntegrationMethodTwoStep(pybind11::module& m);
 void export_ZeroMomentumUpdater(pybind11::module& m);
@@ -166,6 +171,7 @@ void export_ActiveForceConstraintComputeSphereGPU(pybind11::module& m);
 void export_ActiveForceComputeGPU(pybind11::module& m);
 void export_ComputeThermoGPU(pybind11::module& m);
 void export_ComputeThermoHMAGPU(pybind11::module& m);
+void export_ComputeThermoSpatialGPU(pybind11::module& m);
 void export_ConstantForceComputeGPU(pybind11::module& m);
 void export_HarmonicAngleForceComputeGPU(pybind11::module& m);
 void export_CosineSqAngleForceComputeGPU(pybind11::module& m);
@@ -184,6 +190,11 @@ void export_ForceCompositeGPU(pybind11::module& m);
 void export_PPPMForceComputeGPU(pybind11::module& m);
 void export_LocalNeighborListDataGPU(pybind11::module& m);
 
+#ifdef __HIP_PLATFORM_NVCC__
+void export_PotentialPairLJGPUJIT(pybind11::module& m);
+void export_PotentialPairMorseGPUJIT(pybind11::module& m);
+#endif
+
 void export_PotentialPairBuckinghamGPU(pybind11::module& m);
 void export_PotentialPairLJGPU(pybind11::module& m);
 void export_PotentialPairLJ1208GPU(pybind11::module& m);
@@ -193,6 +204,7 @@ void export_PotentialPairExpandedLJGPU(pybind11::module& m);
 void export_PotentialPairExpandedGaussianGPU(pybind11::module& m);
 void export_PotentialPairExpandedMieGPU(pybind11::module& m);
 void export_PotentialPairYukawaGPU(pybind11::module& m);
+void export_PotentialPairLJYukawaGPU(pybind11::module& m);
 void export_PotentialPairEwaldGPU(pybind11::module& m);
 void export_PotentialPairMorseGPU(pybind11::module& m);
 void export_PotentialPairMoliereGPU(pybind11::module& m);
@@ -240,6 +252,7 @@ void export_PotentialExternalWallMorseGPU(pybind11::module& m);
 
 void export_PotentialPairDPDThermoDPDGPU(pybind11::module& m);
 void export_PotentialPairDPDThermoLJGPU(pybind11::module& m);
+void export_PotentialPairDPDThermoGaussGPU(pybind11::module& m);
 
 void export_TwoStepConstantVolumeGPU(pybind11::module& m);
 void export_TwoStepLangevinGPU(pybind11::module& m);
@@ -247,6 +260,7 @@ void export_TwoStepBDGPU(pybind11::module& m);
 void export_TwoStepConstantPressureGPU(pybind11::module& m);
 void export_FIREEnergyMinimizerGPU(pybind11::module& m);
 void export_MuellerPlatheFlowGPU(pybind11::module& m);
+void export_ZeroMomentumUpdaterGPU(pybind11::module& m);
 
 void export_TwoStepRATTLEBDGPUCylinder(pybind11::module& m);
 void export_TwoStepRATTLEBDGPUDiamond(pybind11::module& m);
@@ -295,8 +309,10 @@ PYBIND11_MODULE(_md, m)
     export_ActiveForceConstraintComputePrimitive(m);
     export_ActiveForceConstraintComputeSphere(m);
     export_ActiveRotationalDiffusionUpdater(m);
+    export_COMDistanceBias(m);
     export_ComputeThermo(m);
     export_ComputeThermoHMA(m);
+    export_ComputeThermoSpatial(m);
     export_ConstantForceCompute(m);
     export_HarmonicAngleForceCompute(m);
     export_CosineSqAngleForceCompute(m);
@@ -316,6 +332,7 @@ PYBIND11_MODULE(_md, m)
     export_PotentialPairExpandedGaussian(m);
     export_PotentialPairExpandedMie(m);
     export_PotentialPairYukawa(m);
+    export_PotentialPairLJYukawa(m);
     export_PotentialPairEwald(m);
     export_PotentialPairMorse(m);
     export_PotentialPairMoliere(m);
@@ -344,6 +361,7 @@ PYBIND11_MODULE(_md, m)
 
     export_PotentialPairDPDThermoDPD(m);
     export_PotentialPairDPDThermoLJ(m);
+    export_PotentialPairDPDThermoGauss(m);
 
     export_PotentialBondHarmonic(m);
     export_PotentialBondFENE(m);
@@ -388,6 +406,11 @@ PYBIND11_MODULE(_md, m)
     export_ForceCompositeGPU(m);
     export_LocalNeighborListDataGPU(m);
 
+#ifdef __HIP_PLATFORM_NVCC__
+    export_PotentialPairLJGPUJIT(m);
+    export_PotentialPairMorseGPUJIT(m);
+#endif
+
     export_PotentialPairBuckinghamGPU(m);
     export_PotentialPairLJGPU(m);
     export_PotentialPairLJ1208GPU(m);
@@ -397,6 +420,7 @@ PYBIND11_MODULE(_md, m)
     export_PotentialPairExpandedGaussianGPU(m);
     export_PotentialPairExpandedMieGPU(m);
     export_PotentialPairYukawaGPU(m);
+    export_PotentialPairLJYukawaGPU(m);
     export_PotentialPairEwaldGPU(m);
     export_PotentialPairMorseGPU(m);
     export_PotentialPairMoliereGPU(m);
@@ -418,6 +442,7 @@ PYBIND11_MODULE(_md, m)
 
     export_PotentialPairDPDThermoDPDGPU(m);
     export_PotentialPairDPDThermoLJGPU(m);
+    export_PotentialPairDPDThermoGaussGPU(m);
 
     export_AnisoPotentialPairALJ2DGPU(m);
     export_AnisoPotentialPairALJ3DGPU(m);
@@ -445,6 +470,7 @@ PYBIND11_MODULE(_md, m)
     export_ForceDistanceConstraintGPU(m);
     export_ComputeThermoGPU(m);
     export_ComputeThermoHMAGPU(m);
+    export_ComputeThermoSpatialGPU(m);
     export_PPPMForceComputeGPU(m);
     export_ActiveForceComputeGPU(m);
     export_ActiveForceConstraintComputeCylinderGPU(m);
@@ -473,6 +499,7 @@ PYBIND11_MODULE(_md, m)
     export_BerendsenThermostat(m);
 
     export_IntegratorTwoStep(m);
+    export_IntegratorRESPA(m);
     export_IntegrationMethodTwoStep(m);
     export_ZeroMomentumUpdater(m);
     export_TwoStepConstantVolume(m);
@@ -518,6 +545,7 @@ PYBIND11_MODULE(_md, m)
     export_TwoStepConstantPressureGPU(m);
     export_FIREEnergyMinimizerGPU(m);
     export_MuellerPlatheFlowGPU(m);
+    export_ZeroMomentumUpdaterGPU(m);
 
     export_TwoStepRATTLEBDGPUCylinder(m);
     export_TwoStepRATTLEBDGPUDiamond(m);
@@ -103,6 +103,23 @@ class NeighborList(Compute):
         mesh (Mesh): mesh data structure (optional)
         default_r_cut (float): Default cutoff distance :math:`[\mathrm{length}]`
             (optional).
+        sort_by_distance (bool): When `True`, reorder each particle's neighbors
+            by ascending distance after every rebuild. Pair potentials then
+            stop traversing a row at the first neighbor beyond their own
+            cutoff, so several potentials with different cutoffs can share one
+            neighbor list built at the largest cutoff without paying for the
+            extra neighbors. The reordering runs on the CPU; on GPU devices it
+            forces a host round trip of the list on each rebuild. Defaults to
+            `False`.
+        adaptive_ghost_width (bool): When `True`, shrink the communicated
+            ghost layer from the full ``r_cut + buffer`` to a bound measured
+            from the particle displacements actually observed between
+            rebuilds, and tighten the rebuild criterion to match. This
+            reduces ghost communication volume substantially when particles
+            move much less than ``buffer/2`` between rebuilds (e.g. at low
+            temperature); systems that exhaust the full buffer keep the full
+            width. Only affects MPI domain decomposed simulations. Defaults
+            to `False`.
 
     .. py:attribute:: r_cut
 
@@ -134,7 +151,9 @@ class NeighborList(Compute):
         params = ParameterDict(exclusions=[validate_exclusions],
                                buffer=float(buffer),
                                rebuild_check_delay=int(rebuild_check_delay),
-                               check_dist=bool(check_dist))
+                               check_dist=bool(check_dist),
+                               sort_by_distance=bool(False),
+                               adaptive_ghost_width=bool(False))
         params["exclusions"] = exclusions
         self._param_dict.update(params)
 
@@ -322,6 +341,17 @@ class NeighborList(Compute):
         """
         return self._cpp_obj.num_builds
 
+    @log(requires_run=True, default=False)
+    def compute_time(self):
+        """float: The wall time spent building the neighbor list.
+
+        `compute_time` is the cumulative number of seconds spent building the
+        neighbor list since it was created. In GPU simulations, kernel launches
+        are asynchronous and `compute_time` covers the host side of the build
+        only.
+        """
+        return self._cpp_obj.compute_time
+
 
 class Cell(NeighborList):
     r"""Neighbor list computed via a cell list.
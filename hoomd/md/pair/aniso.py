@@ -203,6 +203,16 @@ class GayBerne(AnisotropicPair):
 
         Type: `TypeParameter` [`tuple` [``particle_type``, ``particle_type``],
         `dict`]
+
+    .. py:attribute:: torque_mask
+
+        Whether to compute torques on particles of each type (*default*:
+        `True`). Set to `False` for point-symmetric species (e.g.
+        :math:`\ell_\perp = \ell_\parallel`) that do not integrate rotational
+        degrees of freedom to skip the torque evaluation for those particles.
+        Particles of a masked type receive zero torque from this force.
+
+        Type: `TypeParameter` [``particle_type``, `bool`]
     """
     _cpp_class_name = "AnisoPotentialPairGB"
 
@@ -214,7 +224,9 @@ class GayBerne(AnisotropicPair):
                               lperp=float,
                               lpar=float,
                               len_keys=2))
-        self._add_typeparam(params)
+        torque_mask = TypeParameter('torque_mask', 'particle_types',
+                                    TypeParameterDict(True, len_keys=1))
+        self._extend_typeparam((params, torque_mask))
 
     @log(category="object")
     def type_shapes(self):
@@ -7,6 +7,7 @@ import copy
 import warnings
 
 import hoomd
+from hoomd import _compile
 from hoomd.md import _md
 from hoomd.md import force
 from hoomd.data.parameterdicts import ParameterDict, TypeParameterDict
@@ -64,8 +65,13 @@ class Pair(force.Force):
     # external plugin.
     _ext_module = _md
 
+    # The evaluator class to specialize with NVRTC when `jit_specialize` is
+    # set. Potentials without JIT support leave this as None.
+    _jit_evaluator = None
+
     def __init__(self, nlist, default_r_cut=None, default_r_on=0., mode='none'):
         super().__init__()
+        self._jit_specialize = False
         tp_r_cut = TypeParameter(
             'r_cut', 'particle_types',
             TypeParameterDict(nonnegative_real, len_keys=2))
@@ -123,6 +129,106 @@ class Pair(force.Force):
         # above and raise an error if they occur.
         return self._cpp_obj.computeEnergyBetweenSets(tags1, tags2)
 
+    def patch_params(self, updates):
+        """Batch-update pair coefficients during a run.
+
+        Args:
+            updates (dict[tuple[str, str], dict]): New parameter dicts keyed
+                by particle type pair.
+
+        Fast path for time-dependent force field protocols that change
+        coefficients many times within a run. All entries are patched in
+        place with a single call into the attached force, preserving the
+        neighbor list state and the kernel autotuner state, so an update
+        costs microseconds instead of a parameter dict rebuild per entry.
+
+        Each value must be a complete parameter dict for this potential;
+        values are passed through without validation. Cutoffs are not
+        affected — change ``r_cut`` through `params` so the neighbor list is
+        notified.
+
+        Example::
+
+            lj.patch_params({('A', 'A'): dict(epsilon=new_eps, sigma=1.0)})
+
+        Note:
+            Only supported while the force is attached to a simulation.
+        """
+        if not self._attached:
+            raise hoomd.error.DataAccessError("patch_params")
+        self._cpp_obj.setParamsBatch(list(updates.items()))
+
+    @property
+    def jit_specialize(self):
+        """bool: Recompile the GPU kernel with the parameters baked in.
+
+        When set before attaching, the pair force kernel is recompiled at
+        attach time with NVRTC, with the pair parameters, cutoffs, and the
+        shift mode emitted as literal constants. The compiler folds them into
+        immediates, removing the parameter loads from the inner loop of every
+        force evaluation. This benefits long production runs that hold their
+        parameters constant, at the cost of one compilation at attach time.
+
+        Only supported by potentials that define a JIT evaluator (`LJ` and
+        `Morse`), on GPU devices built with the CUDA platform. All ``params``
+        and ``r_cut`` entries must be set before attaching.
+
+        Warning:
+            The kernel reflects the parameters at attach time. Changing
+            `params`, `r_cut`, `r_on`, or `mode` afterwards does not update
+            the specialized kernel; remove and re-add the force instead.
+        """
+        return self._jit_specialize
+
+    @jit_specialize.setter
+    def jit_specialize(self, value):
+        if self._attached:
+            raise RuntimeError("jit_specialize cannot be set after scheduling.")
+        if value and self._jit_evaluator is None:
+            raise RuntimeError(
+                f"{type(self).__name__} does not support jit_specialize.")
+        self._jit_specialize = bool(value)
+
+    def _make_jit_source(self):
+        """Generate kernel source with the parameters emitted as literals."""
+        types = self._simulation.state.particle_types
+        shift_modes = {"none": 0, "shift": 1, "xplor": 2}
+        params = []
+        rcutsq = []
+        ronsq = []
+        try:
+            for type_i in types:
+                for type_j in types:
+                    pair = (type_i, type_j)
+                    params.append(self._jit_param_literal(self.params[pair]))
+                    r_cut = float(self.r_cut[pair])
+                    rcutsq.append(repr(r_cut * r_cut))
+                    if self.mode == "xplor":
+                        r_on = float(self.r_on[pair])
+                        ronsq.append(repr(r_on * r_on))
+                    else:
+                        ronsq.append("0.")
+        except (KeyError, TypeError) as err:
+            raise RuntimeError(
+                "All pair parameters and cutoffs must be set before attaching "
+                "with jit_specialize enabled.") from err
+        return f"""
+#include "hoomd/md/{self._jit_evaluator}.h"
+
+namespace hoomd {{ namespace md {{ namespace kernel {{ namespace jit {{
+
+typedef hoomd::md::{self._jit_evaluator} evaluator_jit;
+constexpr unsigned int jit_ntypes = {len(types)};
+constexpr unsigned int jit_shift_mode = {shift_modes[self.mode]};
+__device__ const evaluator_jit::param_type jit_params[] = {{{', '.join(params)}}};
+__device__ const Scalar jit_rcutsq[] = {{{', '.join(rcutsq)}}};
+__device__ const Scalar jit_ronsq[] = {{{', '.join(ronsq)}}};
+
+}} }} }} }}
+
+#include "hoomd/md/PotentialPairGPUJITKernel.inc"
+"""
+
     def _attach_hook(self):
         if self.nlist._attached and self._simulation != self.nlist._simulation:
             warnings.warn(
@@ -132,18 +238,45 @@ class Pair(force.Force):
                 RuntimeWarning)
             self.nlist = copy.deepcopy(self.nlist)
         self.nlist._attach(self._simulation)
+        jit_args = None
         if isinstance(self._simulation.device, hoomd.device.CPU):
+            if self._jit_specialize:
+                raise RuntimeError(
+                    "jit_specialize requires a GPU device.")
             cls = getattr(self._ext_module, self._cpp_class_name)
             self.nlist._cpp_obj.setStorageMode(
                 _md.NeighborList.storageMode.half)
         else:
-            cls = getattr(self._ext_module, self._cpp_class_name + "GPU")
-            self.nlist._cpp_obj.setStorageMode(
-                _md.NeighborList.storageMode.full)
-        self._cpp_obj = cls(self._simulation.state._cpp_sys_def,
-                            self.nlist._cpp_obj)
+            if self._jit_specialize:
+                cls = getattr(self._ext_module,
+                              self._cpp_class_name + "GPUJIT", None)
+                if cls is None:
+                    raise RuntimeError(
+                        "jit_specialize requires HOOMD-blue built with the "
+                        "CUDA platform.")
+                gpu_settings = _compile.get_gpu_compilation_settings(
+                    self._simulation.device)
+                jit_args = (self._make_jit_source(),
+                            "hoomd::md::kernel::jit::pair_force_jit",
+                            gpu_settings["includes"], gpu_settings["max_arch"])
+            else:
+                cls = getattr(self._ext_module, self._cpp_class_name + "GPU")
+            # the GPU pair kernels cannot use Newton's third law: register a
+            # full storage request so a CPU consumer sharing this list cannot
+            # downgrade it to half storage
+            self.nlist._cpp_obj.addFullStorageRequest()
+            self._added_full_storage_request = True
+        if jit_args is None:
+            self._cpp_obj = cls(self._simulation.state._cpp_sys_def,
+                                self.nlist._cpp_obj)
+        else:
+            self._cpp_obj = cls(self._simulation.state._cpp_sys_def,
+                                self.nlist._cpp_obj, *jit_args)
 
     def _detach_hook(self):
+        if getattr(self, "_added_full_storage_request", False):
+            self.nlist._cpp_obj.removeFullStorageRequest()
+            self._added_full_storage_request = False
         self.nlist._detach()
 
     def _setattr_param(self, attr, value):
@@ -211,6 +344,13 @@ class LJ(Pair):
         Type: `bool`
     """
     _cpp_class_name = "PotentialPairLJ"
+    _jit_evaluator = "EvaluatorPairLJ"
+
+    @staticmethod
+    def _jit_param_literal(params):
+        sigma_6 = float(params['sigma'])**6
+        epsilon_x_4 = 4.0 * float(params['epsilon'])
+        return f"{{{sigma_6!r}, {epsilon_x_4!r}}}"
 
     def __init__(self,
                  nlist,
@@ -454,6 +594,68 @@ class Yukawa(Pair):
         self._add_typeparam(params)
 
 
+class LJYukawa(Pair):
+    r"""Fused Lennard-Jones plus Yukawa pair force.
+
+    Args:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list.
+        default_r_cut (float): Default cutoff radius :math:`[\mathrm{length}]`.
+        default_r_on (float): Default turn-on radius :math:`[\mathrm{length}]`.
+        mode (str): Energy shifting/smoothing mode.
+
+    `LJYukawa` computes the sum of the `LJ` and `Yukawa` pair forces on every
+    particle in the simulation state:
+
+    .. math::
+
+        U(r) = 4 \varepsilon_{\mathrm{LJ}} \left[ \left(
+        \frac{\sigma}{r} \right)^{12} - \left( \frac{\sigma}{r}
+        \right)^{6} \right] + \varepsilon_{\mathrm{Y}} \frac{ \exp \left(
+        -\kappa r \right) }{r}
+
+    Stacking separate `LJ` and `Yukawa` forces on the same neighbor list
+    traverses the list twice. `LJYukawa` evaluates both terms per neighbor in
+    one traversal. Both terms share ``r_cut``, ``r_on``, and ``mode``.
+
+    Example::
+
+        nl = nlist.Cell()
+        lj_yukawa = pair.LJYukawa(nl, default_r_cut=3.0)
+        lj_yukawa.params[('A', 'A')] = dict(lj=dict(epsilon=1.0, sigma=1.0),
+                                            yukawa=dict(epsilon=1.0,
+                                                        kappa=1.0))
+        lj_yukawa.r_cut[('A', 'B')] = 3.0
+
+    .. py:attribute:: params
+
+        The potential parameters. The dictionary has the following keys:
+
+        * ``lj`` (`dict`, **required**) - `LJ` parameters ``epsilon``
+          and ``sigma``
+        * ``yukawa`` (`dict`, **required**) - `Yukawa` parameters ``epsilon``
+          and ``kappa``
+
+        Type: `TypeParameter` [`tuple` [``particle_type``, ``particle_type``],
+        `dict`]
+
+    .. py:attribute:: mode
+
+        Energy shifting/smoothing mode: ``"none"``, ``"shift"``, or ``"xplor"``.
+
+        Type: `str`
+    """
+    _cpp_class_name = "PotentialPairLJYukawa"
+
+    def __init__(self, nlist, default_r_cut=None, default_r_on=0., mode='none'):
+        super().__init__(nlist, default_r_cut, default_r_on, mode)
+        params = TypeParameter(
+            'params', 'particle_types',
+            TypeParameterDict(lj=dict(epsilon=float, sigma=float),
+                              yukawa=dict(epsilon=float, kappa=float),
+                              len_keys=2))
+        self._add_typeparam(params)
+
+
 class Ewald(Pair):
     r"""Ewald pair force.
 
@@ -664,6 +866,12 @@ class Morse(Pair):
     """
 
     _cpp_class_name = "PotentialPairMorse"
+    _jit_evaluator = "EvaluatorPairMorse"
+
+    @staticmethod
+    def _jit_param_literal(params):
+        return (f"{{{float(params['D0'])!r}, {float(params['alpha'])!r}, "
+                f"{float(params['r0'])!r}}}")
 
     def __init__(self, nlist, default_r_cut=None, default_r_on=0., mode='none'):
         super().__init__(nlist, default_r_cut, default_r_on, mode)
@@ -935,6 +1143,108 @@ class DPDLJ(Pair):
         super()._attach_hook()
 
 
+class DPDGaussian(Pair):
+    r"""Dissipative Particle Dynamics with the Gaussian conservative force.
+
+    Args:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list.
+        kT (`hoomd.variant` or `float`): Temperature of
+            thermostat :math:`[\mathrm{energy}]`.
+        default_r_cut (float): Default cutoff radius :math:`[\mathrm{length}]`.
+        mode (str): Energy shifting mode.
+
+    `DPDGaussian` computes the `DPD` thermostat combined with the `Gaussian`
+    pair force on every particle in the simulation state with:
+
+    .. math::
+        F &= F_{\mathrm{C}}(r) + F_{\mathrm{R,ij}}(r_{ij}) +
+            F_{\mathrm{D,ij}}(v_{ij}), \\
+        F_{\mathrm{C}}(r) &= \partial U / \partial r, \\
+        F_{\mathrm{R, ij}}(r_{ij}) &= - \theta_{ij}\sqrt{3}
+            \sqrt{\frac{2k_b\gamma T}{\Delta t}}\cdot w(r_{ij}), \\
+        F_{\mathrm{D, ij}}(r_{ij}) &= - \gamma w^2(r_{ij})
+            \left( \hat r_{ij} \circ v_{ij} \right), \\
+        U(r) &= \varepsilon \exp \left( -\frac{1}{2}
+               \left( \frac{r}{\sigma} \right)^2 \right), \\
+        w(r_{ij}) &=
+        \begin{cases}
+        \left( 1 - r/r_{\mathrm{cut}} \right)
+        & r < r_{\mathrm{cut}} \\
+        0 & r \ge r_{\mathrm{cut}} \\
+        \end{cases},
+
+    :math:`\hat r_{ij}` is a normalized vector from particle i to
+    particle j, :math:`v_{ij} = v_i - v_j`, and :math:`\theta_{ij}` is a
+    uniformly distributed random number in the range [-1, 1].
+
+    The thermostat, conservative force, and virial are all evaluated in a
+    single neighbor list traversal - use `DPDGaussian` instead of combining
+    `DPD` with a separate `Gaussian` force over the same neighbor list.
+
+    `C. L. Phillips et. al. 2011 <http://dx.doi.org/10.1016/j.jcp.2011.05.021>`_
+    describes the DPD implementation details. Cite it if you utilize the DPD
+    functionality in your work.
+
+    To use the DPD thermostat, apply the `hoomd.md.methods.ConstantVolume` or
+    `hoomd.md.methods.ConstantPressure` integration method  without thermostat
+    along with `DPD` forces.  Use of the DPD thermostat pair force with
+    other integrators will result in nonphysical behavior.
+
+    Example::
+
+        nl = nlist.Cell()
+        dpd_gauss = pair.DPDGaussian(nlist=nl, kT=1.0, default_r_cut=3.0)
+        dpd_gauss.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0, gamma=4.5)
+
+    .. py:attribute:: params
+
+        The `DPDGaussian` potential parameters. The dictionary has the
+        following keys:
+
+        * ``epsilon`` (`float`, **required**) - :math:`\varepsilon`
+          :math:`[\mathrm{energy}]`
+        * ``sigma`` (`float`, **required**) - :math:`\sigma`
+          :math:`[\mathrm{length}]`
+        * ``gamma`` (`float`, **required**) - :math:`\gamma`
+          :math:`[\mathrm{mass} \cdot \mathrm{time}^{-1}]`
+
+        Type: `TypeParameter` [`tuple` [``particle_type``, ``particle_type``],
+        `dict`]
+
+    .. py:attribute:: mode
+
+        Energy shifting/smoothing mode: ``"none"`` or ``"shift"``.
+
+        Type: `str`
+    """
+    _cpp_class_name = "PotentialPairDPDThermoGauss"
+    _accepted_modes = ("none", "shift")
+
+    def __init__(self, nlist, kT, default_r_cut=None, mode='none'):
+
+        super().__init__(nlist=nlist,
+                         default_r_cut=default_r_cut,
+                         default_r_on=0,
+                         mode=mode)
+        params = TypeParameter(
+            'params', 'particle_types',
+            TypeParameterDict(epsilon=float,
+                              sigma=float,
+                              gamma=float,
+                              len_keys=2))
+        self._add_typeparam(params)
+
+        d = ParameterDict(kT=hoomd.variant.Variant)
+        self._param_dict.update(d)
+
+        self.kT = kT
+
+    def _attach_hook(self):
+        """DPDGaussian uses RNGs. Warn the user if they did not set the seed."""
+        self._simulation._warn_if_seed_unset()
+        super()._attach_hook()
+
+
 class ForceShiftedLJ(Pair):
     r"""Force-shifted Lennard-Jones pair force.
 
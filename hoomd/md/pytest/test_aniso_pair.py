@@ -152,6 +152,30 @@ def test_rcut_invalid(r_cut):
         gay_berne.r_cut[('A', 'B')] = r_cut
 
 
+def test_torque_mask(make_two_particle_simulation):
+    """Test that torque_mask is settable and zeroes torques when disabled."""
+    cell = md.nlist.Cell(buffer=0.4)
+    gay_berne = md.pair.aniso.GayBerne(nlist=cell, default_r_cut=2.5)
+    gay_berne.params[('A', 'A')] = {'epsilon': 1, 'lpar': 0.5, 'lperp': 1.0}
+    # torques are computed by default
+    assert gay_berne.torque_mask['A']
+
+    sim = make_two_particle_simulation(dimensions=3, d=0.5, force=gay_berne)
+    sim.run(0)
+    assert gay_berne.torque_mask['A']
+    forces = gay_berne.forces
+    energies = gay_berne.energies
+
+    # masked types receive zero torque, forces and energies are unaffected
+    gay_berne.torque_mask['A'] = False
+    assert not gay_berne.torque_mask['A']
+    torques = gay_berne.torques
+    if torques is not None:
+        assert np.allclose(torques, 0)
+        assert np.allclose(gay_berne.forces, forces)
+        assert np.allclose(gay_berne.energies, energies)
+
+
 def isclose(value, reference, rtol=5e-6):
     """Return if two values are close while automatically managing atol."""
     if isinstance(reference, (Sequence, np.ndarray)):
@@ -0,0 +1,106 @@
+# Copyright (c) 2009-2023 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+from hoomd.conftest import pickling_check
+import numpy
+
+
+def test_attributes():
+    bias = hoomd.md.force.COMDistanceBias(filter_a=hoomd.filter.Type(['A']),
+                                          filter_b=hoomd.filter.Type(['B']),
+                                          kappa=3.0,
+                                          r0=1.5)
+
+    assert bias.kappa == 3.0
+    assert bias.r0 == 1.5
+    assert bias.hill_height == 0.0
+    assert bias.hill_width == 0.0
+    assert bias.hill_period == 0
+    assert bias.multi_walker is False
+
+    bias.hill_height = 0.5
+    bias.hill_width = 0.2
+    bias.hill_period = 100
+    assert bias.hill_height == 0.5
+    assert bias.hill_width == 0.2
+    assert bias.hill_period == 100
+
+
+def test_umbrella_force(simulation_factory, two_particle_snapshot_factory):
+    kappa = 3.0
+    r0 = 1.5
+    d = 4.0
+    bias = hoomd.md.force.COMDistanceBias(filter_a=hoomd.filter.Type(['A']),
+                                          filter_b=hoomd.filter.Type(['B']),
+                                          kappa=kappa,
+                                          r0=r0)
+
+    snapshot = two_particle_snapshot_factory(particle_types=['A', 'B'], d=d)
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.typeid[:] = [0, 1]
+
+    sim = simulation_factory(snapshot)
+
+    integrator = hoomd.md.Integrator(0.0)
+    integrator.methods.append(
+        hoomd.md.methods.Langevin(hoomd.filter.All(), kT=0))
+    integrator.forces.append(bias)
+    sim.operations.integrator = integrator
+    sim.run(1)
+
+    assert bias.collective_variable == numpy.float64(d)
+
+    # particle 0 (A) sits at -d/2 x, so the spring pulls it in +x
+    force = kappa * (d - r0)
+    forces = bias.forces
+    if sim.device.communicator.rank == 0:
+        numpy.testing.assert_allclose(
+            forces, [[force, 0.0, 0.0], [-force, 0.0, 0.0]], atol=1e-12)
+
+    numpy.testing.assert_allclose(bias.energy, kappa / 2 * (d - r0)**2)
+
+    pickling_check(bias)
+
+
+def test_hill_deposition(simulation_factory, two_particle_snapshot_factory):
+    kappa = 3.0
+    r0 = 1.5
+    d = 4.0
+    bias = hoomd.md.force.COMDistanceBias(filter_a=hoomd.filter.Type(['A']),
+                                          filter_b=hoomd.filter.Type(['B']),
+                                          kappa=kappa,
+                                          r0=r0)
+    bias.hill_height = 0.5
+    bias.hill_width = 0.2
+    bias.hill_period = 1
+
+    snapshot = two_particle_snapshot_factory(particle_types=['A', 'B'], d=d)
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.typeid[:] = [0, 1]
+
+    sim = simulation_factory(snapshot)
+
+    integrator = hoomd.md.Integrator(0.0)
+    integrator.methods.append(
+        hoomd.md.methods.Langevin(hoomd.filter.All(), kT=0))
+    integrator.forces.append(bias)
+    sim.operations.integrator = integrator
+    sim.run(2)
+
+    # dt=0 keeps the particles in place, so every hill is centered at s=d
+    hills = bias.hills
+    assert len(hills) > 0
+    for center, height in hills:
+        assert center == numpy.float64(d)
+        assert height == 0.5
+
+    # hills centered at the current value of s add their full height to the
+    # bias energy and no force
+    sim.run(1)
+    expected = kappa / 2 * (d - r0)**2 + len(bias.hills) * bias.hill_height
+    numpy.testing.assert_allclose(bias.energy, expected)
+
+    # the hill list round-trips for restartability
+    bias.hills = hills
+    assert bias.hills == hills
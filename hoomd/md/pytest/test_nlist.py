@@ -62,6 +62,8 @@ def test_common_params(nlist_params):
         "exclusions": ('bond',),
         "rebuild_check_delay": 1,
         "check_dist": True,
+        "sort_by_distance": False,
+        "adaptive_ghost_width": False,
     }
     _assert_nlist_params(nlist, default_params_dict)
     new_params_dict = {
@@ -76,6 +78,10 @@ def test_common_params(nlist_params):
             np.random.randint(8),
         "check_dist":
             False,
+        "sort_by_distance":
+            True,
+        "adaptive_ghost_width":
+            True,
     }
     for param in new_params_dict.keys():
         setattr(nlist, param, new_params_dict[param])
@@ -124,6 +130,73 @@ def test_simple_simulation(nlist_params, simulation_factory,
                                      activate=lambda: sim.run(1))
 
 
+def test_sort_by_distance(simulation_factory, lattice_snapshot_factory):
+    """Sorted neighbor rows must reproduce the unsorted forces."""
+
+    def make_sim(sort):
+        nlist = Cell(buffer=0.4)
+        nlist.sort_by_distance = sort
+        # two potentials with different cutoffs sharing one list
+        lj_short = hoomd.md.pair.LJ(nlist, default_r_cut=1.2)
+        lj_short.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+        lj_long = hoomd.md.pair.LJ(nlist, default_r_cut=2.5)
+        lj_long.params[('A', 'A')] = dict(epsilon=0.5, sigma=1.1)
+        integrator = hoomd.md.Integrator(0.005,
+                                         forces=[lj_short, lj_long],
+                                         methods=[
+                                             hoomd.md.methods.NVE(
+                                                 hoomd.filter.All())
+                                         ])
+        sim = simulation_factory(lattice_snapshot_factory(n=6, a=1.1))
+        sim.operations.integrator = integrator
+        return sim
+
+    reference = make_sim(sort=False)
+    sorted_sim = make_sim(sort=True)
+    reference.run(10)
+    sorted_sim.run(10)
+
+    ref_snap = reference.state.get_snapshot()
+    sorted_snap = sorted_sim.state.get_snapshot()
+    if ref_snap.communicator.rank == 0:
+        np.testing.assert_allclose(ref_snap.particles.position,
+                                   sorted_snap.particles.position,
+                                   rtol=1e-5,
+                                   atol=1e-5)
+
+
+def test_adaptive_ghost_width(simulation_factory, lattice_snapshot_factory):
+    """Adaptive ghost sizing must reproduce the full-width trajectory."""
+
+    def make_sim(adaptive):
+        nlist = Cell(buffer=0.4)
+        nlist.adaptive_ghost_width = adaptive
+        lj = hoomd.md.pair.LJ(nlist, default_r_cut=2.5)
+        lj.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+        integrator = hoomd.md.Integrator(0.005,
+                                         forces=[lj],
+                                         methods=[
+                                             hoomd.md.methods.NVE(
+                                                 hoomd.filter.All())
+                                         ])
+        sim = simulation_factory(lattice_snapshot_factory(n=6, a=1.1))
+        sim.operations.integrator = integrator
+        return sim
+
+    reference = make_sim(adaptive=False)
+    adaptive_sim = make_sim(adaptive=True)
+    reference.run(150)
+    adaptive_sim.run(150)
+
+    ref_snap = reference.state.get_snapshot()
+    adaptive_snap = adaptive_sim.state.get_snapshot()
+    if ref_snap.communicator.rank == 0:
+        np.testing.assert_allclose(ref_snap.particles.position,
+                                   adaptive_snap.particles.position,
+                                   rtol=1e-5,
+                                   atol=1e-5)
+
+
 def test_auto_detach_simulation(simulation_factory,
                                 two_particle_snapshot_factory):
     nlist = Cell(buffer=0.4)
@@ -461,6 +534,38 @@ def test_rank_local_pair_list(simulation_factory, lattice_snapshot_factory,
         _check_local_pair_counts(sim, global_pairs)
 
 
+def test_stencil_asymmetric_rcut(simulation_factory, lattice_snapshot_factory):
+    """Stencil must find the same pairs as Cell with very asymmetric cutoffs."""
+
+    def build_pair_set(nlist):
+        nlist.r_cut[('A', 'A')] = 4.5
+        nlist.r_cut[('A', 'B')] = 2.2
+        nlist.r_cut[('B', 'B')] = 1.3
+
+        snap = lattice_snapshot_factory(particle_types=['A', 'B'], n=8, a=1.2)
+        if snap.communicator.rank == 0:
+            # a dilute large species in a sea of small particles
+            snap.particles.typeid[:] = 1
+            snap.particles.typeid[::29] = 0
+
+        sim = simulation_factory(snap)
+        sim.operations.computes.append(nlist)
+        sim.run(0)
+
+        pair_list = nlist.pair_list
+        if sim.device.communicator.rank == 0:
+            return len(pair_list), set([frozenset(pair) for pair in pair_list])
+        return None, None
+
+    n_cell, cell_pairs = build_pair_set(
+        hoomd.md.nlist.Cell(buffer=0.0, default_r_cut=0.0))
+    n_stencil, stencil_pairs = build_pair_set(
+        hoomd.md.nlist.Stencil(cell_width=1.3, buffer=0.0, default_r_cut=0.0))
+    if cell_pairs is not None:
+        assert n_stencil == n_cell  # ensures no duplicates
+        assert stencil_pairs == cell_pairs
+
+
 @pytest.mark.parametrize("setup", pair_setup_funcs)
 def test_cpu_local_nlist_arrays(simulation_factory, lattice_snapshot_factory,
                                 setup):
@@ -86,6 +86,32 @@ def test_invalid_mode():
             md.pair.LJ(nlist=cell, default_r_cut=2.5, mode=invalid_mode)
 
 
+def test_patch_params(simulation_factory, two_particle_snapshot_factory):
+    lj = md.pair.LJ(nlist=md.nlist.Cell(buffer=0.4), default_r_cut=2.5)
+    lj.params[('A', 'A')] = {'sigma': 1, 'epsilon': 0.5}
+
+    # only supported while attached
+    with pytest.raises(hoomd.error.DataAccessError):
+        lj.patch_params({('A', 'A'): dict(epsilon=1.5, sigma=1.0)})
+
+    sim = simulation_factory(two_particle_snapshot_factory(dimensions=3, d=.5))
+    # dt=0 keeps the particles in place so the energies compare exactly
+    integrator = md.Integrator(dt=0)
+    integrator.forces.append(lj)
+    integrator.methods.append(
+        hoomd.md.methods.ConstantVolume(hoomd.filter.All()))
+    sim.operations.integrator = integrator
+    sim.run(1)
+
+    energy_before = lj.energy
+
+    # the patched coefficients are visible through params and scale the energy
+    lj.patch_params({('A', 'A'): dict(epsilon=1.0, sigma=1.0)})
+    assert lj.params[('A', 'A')]['epsilon'] == 1.0
+    sim.run(1)
+    np.testing.assert_allclose(lj.energy, 2 * energy_before, rtol=1e-5)
+
+
 @pytest.mark.parametrize("mode", ['none', 'shift', 'xplor'])
 def test_mode(simulation_factory, two_particle_snapshot_factory, mode):
     cell = md.nlist.Cell(buffer=0.4)
@@ -201,6 +227,14 @@ def _invalid_params():
     invalid_params_list.extend(
         _make_invalid_params(yukawa_invalid_dicts, md.pair.Yukawa, {}))
 
+    lj_yukawa_valid_dict = {
+        "lj": dict(epsilon=1.0, sigma=1.0),
+        "yukawa": dict(epsilon=0.0005, kappa=1.0)
+    }
+    lj_yukawa_invalid_dicts = _make_invalid_param_dict(lj_yukawa_valid_dict)
+    invalid_params_list.extend(
+        _make_invalid_params(lj_yukawa_invalid_dicts, md.pair.LJYukawa, {}))
+
     ewald_valid_dict = {"alpha": 0.05, "kappa": 1}
     ewald_invalid_dicts = _make_invalid_param_dict(ewald_valid_dict)
     invalid_params_list.extend(
@@ -292,6 +326,12 @@ def _invalid_params():
     invalid_params_list.extend(
         _make_invalid_params(dpdlj_invalid_dicts, md.pair.DPDLJ, {'kT': 1}))
 
+    dpd_gauss_valid_dict = {'sigma': 0.5, 'epsilon': 0.0005, 'gamma': 0.034}
+    dpd_gauss_invalid_dicts = _make_invalid_param_dict(dpd_gauss_valid_dict)
+    invalid_params_list.extend(
+        _make_invalid_params(dpd_gauss_invalid_dicts, md.pair.DPDGaussian,
+                             {'kT': 1}))
+
     dlvo_valid_dict = {'kappa': 1.0, 'Z': 0.1, 'A': 0.1, 'a1': 0.1, 'a2': 0.25}
     dlvo_invalid_dicts = _make_invalid_param_dict(dlvo_valid_dict)
     invalid_params_list.extend(
@@ -430,6 +470,17 @@ def _valid_params(particle_types=['A', 'B']):
         paramtuple(md.pair.Yukawa, dict(zip(combos, yukawa_valid_param_dicts)),
                    {}))
 
+    lj_yukawa_valid_param_dicts = [{
+        'lj': dict(epsilon=lj_eps, sigma=sigma),
+        'yukawa': dict(epsilon=y_eps, kappa=kappa)
+    } for lj_eps, sigma, y_eps, kappa in zip([0.0005, 0.001, 0.0015],
+                                             [0.5, 1.0, 1.5],
+                                             [0.00025, 0.0005, 0.00075],
+                                             [0.5, 1.0, 1.5])]
+    valid_params_list.append(
+        paramtuple(md.pair.LJYukawa,
+                   dict(zip(combos, lj_yukawa_valid_param_dicts)), {}))
+
     ewald_arg_dict = {"alpha": [0.025, 0.05, 0.075], "kappa": [0.5, 1.0, 1.5]}
     ewald_valid_param_dicts = _make_valid_param_dicts(ewald_arg_dict)
     valid_params_list.append(
@@ -558,6 +609,17 @@ def _valid_params(particle_types=['A', 'B']):
         paramtuple(md.pair.DPDLJ, dict(zip(combos, dpdlj_valid_param_dicts)),
                    {"kT": 1}))
 
+    dpd_gauss_arg_dict = {
+        'sigma': [0.5, 1.0, 1.5],
+        'epsilon': [0.0005, 0.001, 0.0015],
+        'gamma': [0.034, 33.2, 1.2]
+    }
+    dpd_gauss_valid_param_dicts = _make_valid_param_dicts(dpd_gauss_arg_dict)
+
+    valid_params_list.append(
+        paramtuple(md.pair.DPDGaussian,
+                   dict(zip(combos, dpd_gauss_valid_param_dicts)), {"kT": 1}))
+
     dlvo_arg_dict = {
         'kappa': [1.0, 2.0, 5.0],
         'Z': [0.1, 0.5, 2.0],
@@ -895,7 +957,7 @@ def test_force_energy_relationship(device, simulation_factory,
                                    two_particle_snapshot_factory, valid_params):
     # don't really test DPD and DPDLJ for this test
     pot_name = valid_params.pair_potential.__name__
-    if any(pot_name == name for name in ["DPD", "DPDLJ"]):
+    if any(pot_name == name for name in ["DPD", "DPDLJ", "DPDGaussian"]):
         pytest.skip("Cannot test force energy relationship for " + pot_name
                     + " pair force")
 
@@ -1377,3 +1439,38 @@ def test_shift(simulation_factory, two_particle_snapshot_factory,
     # is much closer to 0 than V.
     tolerance = max(math.fabs(V / 1e4), 1e-8)
     assert V_shifted == pytest.approx(expected=0, abs=tolerance)
+
+
+def test_jit_specialize(simulation_factory, two_particle_snapshot_factory):
+    lj = md.pair.LJ(nlist=md.nlist.Cell(buffer=0.4), default_r_cut=2.5)
+    lj.params[('A', 'A')] = {'sigma': 1.0, 'epsilon': 1.0}
+
+    # potentials without a JIT evaluator reject the flag
+    gauss = md.pair.Gaussian(nlist=md.nlist.Cell(buffer=0.4),
+                             default_r_cut=2.5)
+    with pytest.raises(RuntimeError):
+        gauss.jit_specialize = True
+
+    lj.jit_specialize = True
+    assert lj.jit_specialize
+
+    sim = simulation_factory(two_particle_snapshot_factory(d=1.5))
+    sim.operations.computes.append(lj)
+    if isinstance(sim.device, hoomd.device.CPU):
+        # the specialized kernel only exists on the GPU
+        with pytest.raises(RuntimeError):
+            sim.run(0)
+        return
+    sim.run(0)
+
+    # the specialized kernel must match the generic one
+    lj_ref = md.pair.LJ(nlist=md.nlist.Cell(buffer=0.4), default_r_cut=2.5)
+    lj_ref.params[('A', 'A')] = {'sigma': 1.0, 'epsilon': 1.0}
+    sim.operations.computes.append(lj_ref)
+    sim.run(1)
+    np.testing.assert_allclose(lj.forces, lj_ref.forces, rtol=1e-6)
+    np.testing.assert_allclose(lj.energies, lj_ref.energies, rtol=1e-6)
+
+    # once attached, the flag is read-only
+    with pytest.raises(RuntimeError):
+        lj.jit_specialize = False
@@ -1,6 +1,8 @@
 # Copyright (c) 2009-2023 The Regents of the University of Michigan.
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+import io
+
 import hoomd
 from hoomd.conftest import operation_pickling_check, logging_check
 from hoomd.error import DataAccessError
@@ -240,3 +242,63 @@ def test_logging():
                 'default': True
             }
         })
+
+
+def test_publish_metrics(simulation_factory, two_particle_snapshot_factory):
+    filt = hoomd.filter.All()
+    thermo = hoomd.md.compute.ThermodynamicQuantities(filt)
+
+    # publishing requires an attached compute
+    with pytest.raises(RuntimeError):
+        thermo.publish_metrics('thermo')
+
+    snap = two_particle_snapshot_factory()
+    if snap.communicator.rank == 0:
+        snap.particles.velocity[:] = [[-2, 0, 0], [2, 0, 0]]
+    sim = simulation_factory(snap)
+    sim.always_compute_pressure = True
+    sim.operations.add(thermo)
+
+    integrator = hoomd.md.Integrator(dt=0.0001)
+    thermostat = hoomd.md.methods.thermostats.MTTK(kT=1.0, tau=1.0)
+    integrator.methods.append(hoomd.md.methods.ConstantVolume(filt, thermostat))
+    sim.operations.integrator = integrator
+    sim.run(0)
+
+    thermo.publish_metrics('thermo')
+    registry = sim.state._cpp_sys_def.getMetricRegistry()
+    names = registry.getNames()
+    assert 'thermo.kinetic_temperature' in names
+    assert 'thermo.pressure' in names
+
+    sim.run(1)
+
+    # the collected frame matches the per-property loggables
+    frame = dict(zip(registry.getNames(), registry.collect(sim.timestep)))
+    np.testing.assert_allclose(frame['thermo.kinetic_temperature'],
+                               thermo.kinetic_temperature)
+    np.testing.assert_allclose(frame['thermo.potential_energy'],
+                               thermo.potential_energy)
+    np.testing.assert_allclose(frame['thermo.kinetic_energy'],
+                               thermo.kinetic_energy)
+    assert frame['thermo.num_particles'] == 2
+
+    # published metrics appear as columns in table output
+    output = io.StringIO()
+    table = hoomd.write.Table(
+        trigger=hoomd.trigger.Periodic(1),
+        logger=hoomd.logging.Logger(categories=['scalar']),
+        output=output)
+    sim.operations.writers.append(table)
+    sim.run(1)
+    if sim.device.communicator.rank == 0:
+        lines = output.getvalue().strip().split('\n')
+        assert 'thermo.kinetic_temperature' in lines[0]
+        assert len(lines[1].split()) == len(lines[0].split())
+
+    # unpublishing and removing the compute both clear the metrics
+    thermo.unpublish_metrics()
+    assert len(registry.getNames()) == 0
+    thermo.publish_metrics('thermo')
+    sim.operations.remove(thermo)
+    assert len(registry.getNames()) == 0
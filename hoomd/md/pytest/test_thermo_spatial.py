@@ -0,0 +1,73 @@
+# Copyright (c) 2009-2023 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+from hoomd.logging import LoggerCategories
+from hoomd.error import DataAccessError
+from hoomd.conftest import logging_check
+import numpy as np
+import pytest
+
+
+def test_before_attaching():
+    filt = hoomd.filter.All()
+    spatial = hoomd.md.compute.SpatialThermodynamicQuantities(filt, (4, 4, 4))
+    assert spatial._filter == filt
+    assert spatial.grid == (4, 4, 4)
+    with pytest.raises(DataAccessError):
+        spatial.density_profile
+    with pytest.raises(DataAccessError):
+        spatial.kinetic_energy_profile
+    with pytest.raises(DataAccessError):
+        spatial.virial_profile
+
+
+def test_after_attaching(simulation_factory, two_particle_snapshot_factory):
+    filt = hoomd.filter.All()
+    spatial = hoomd.md.compute.SpatialThermodynamicQuantities(filt, (2, 2, 2))
+
+    sim = simulation_factory(two_particle_snapshot_factory())
+    sim.operations.add(spatial)
+    assert len(sim.operations.computes) == 1
+    sim.run(0)
+
+    density = spatial.density_profile
+    assert density.shape == (8,)
+    box_volume = sim.state.box.volume
+    # all particles land in some bin
+    np.testing.assert_allclose(np.sum(density) * box_volume / 8, 2)
+
+    ke = spatial.kinetic_energy_profile
+    assert ke.shape == (8,)
+    assert np.all(ke >= 0)
+
+    # the virial profile is NaN unless the pressure tensor is computed
+    assert np.all(np.isnan(spatial.virial_profile))
+    sim.always_compute_pressure = True
+    sim.run(1)
+    virial = spatial.virial_profile
+    assert virial.shape == (8, 6)
+    assert not np.any(np.isnan(virial))
+
+    sim.operations.remove(spatial)
+    assert len(sim.operations.computes) == 0
+    with pytest.raises(DataAccessError):
+        spatial.density_profile
+
+
+def test_logging():
+    logging_check(
+        hoomd.md.compute.SpatialThermodynamicQuantities, ('md', 'compute'), {
+            'density_profile': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'kinetic_energy_profile': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'virial_profile': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            }
+        })
@@ -89,12 +89,16 @@ class _NeighborListBufferInternal(hoomd.custom._InternalAction):
         self._last_tps = 0.0
         self._best_buffer_size = nlist.buffer
         self._max_tps = 0.0
+        self._last_rebuilds_per_step = 0.0
+        self._last_num_builds = None
+        self._rebuild_timestep = None
 
     def act(self, timestep: int):
         if self._update_buffer_domain:
             self._tunable.domain = (self.minimum_buffer, self.maximum_buffer)
             self._update_buffer_domain = False
 
+        self._measure_rebuild_rate(timestep)
         tps = self._tunable.y
         if tps is not None:
             self._last_tps = tps
@@ -107,6 +111,19 @@ class _NeighborListBufferInternal(hoomd.custom._InternalAction):
             else:
                 self._tuned = 0
 
+    def _measure_rebuild_rate(self, timestep: int):
+        builds = self.nlist.num_builds
+        if (self._rebuild_timestep is not None
+                and timestep > self._rebuild_timestep
+                and builds >= self._last_num_builds):
+            delta_steps = timestep - self._rebuild_timestep
+            self._last_rebuilds_per_step = ((builds - self._last_num_builds)
+                                            / delta_steps)
+        # num_builds resets at the start of each call to `Simulation.run`;
+        # restart the interval whenever the counters go backwards.
+        self._last_num_builds = builds
+        self._rebuild_timestep = timestep
+
     def _buffer_post(self, value: float):
         self._update_buffer_domain = True
         return value
@@ -159,6 +176,17 @@ class _NeighborListBufferInternal(hoomd.custom._InternalAction):
         """int: The last TPS computed for the tuner."""
         return self._last_tps
 
+    @hoomd.logging.log
+    def rebuilds_per_step(self):
+        """float: Neighbor list rebuilds per step over the last interval.
+
+        The rebuild rate is measured between consecutive triggerings of the
+        tuner. Values near 1 indicate the buffer is too small (the list is
+        rebuilt nearly every step), while values near 0 indicate a large
+        buffer whose extra neighbors inflate the force-loop cost.
+        """
+        return self._last_rebuilds_per_step
+
     @property
     def final_bin(self):
         """tuple[float, float]: Boundaries of grid search optimization.
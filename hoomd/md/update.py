@@ -36,9 +36,6 @@ class ZeroMomentum(Updater):
     where the index :math:`i` includes only free and central particles (and
     excludes consitutent particles of rigid bodies).
 
-    Note:
-        `ZeroMomentum` executes on the CPU even when using a GPU device.
-
     Examples::
 
         zero_momentum = hoomd.md.update.ZeroMomentum(
@@ -51,8 +48,12 @@ class ZeroMomentum(Updater):
 
     def _attach_hook(self):
         # create the c++ mirror class
-        self._cpp_obj = _md.ZeroMomentumUpdater(
-            self._simulation.state._cpp_sys_def, self.trigger)
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            self._cpp_obj = _md.ZeroMomentumUpdater(
+                self._simulation.state._cpp_sys_def, self.trigger)
+        else:
+            self._cpp_obj = _md.ZeroMomentumUpdaterGPU(
+                self._simulation.state._cpp_sys_def, self.trigger)
 
 
 class ReversePerturbationFlow(Updater):
@@ -355,13 +355,9 @@ void EAMForceCompute::computeForces(uint64_t timestep)
     // create a temporary copy of r_cut squared
     Scalar r_cut_sq = m_r_cut * m_r_cut;
 
-    // parameters for each particle
-    vector<Scalar> atomElectronDensity;
-    atomElectronDensity.resize(m_pdata->getN());
-    vector<Scalar> atomDerivativeEmbeddingFunction;
-    atomDerivativeEmbeddingFunction.resize(m_pdata->getN());
-    vector<Scalar> atomEmbeddingFunction;
-    atomEmbeddingFunction.resize(m_pdata->getN());
+    // per-particle scratch arrays, kept allocated between calls
+    m_electron_density.assign(m_pdata->getN(), Scalar(0.0));
+    m_dF_dP.resize(m_pdata->getN());
     unsigned int ntypes = m_pdata->getNTypes();
 
     for (unsigned int i = 0; i < m_pdata->getN(); i++)
@@ -374,6 +370,9 @@ void EAMForceCompute::computeForces(uint64_t timestep)
         // sanity check
         assert(typei < m_pdata->getNTypes());
 
+        // accumulate the density of particle i in a register
+        Scalar rho_i = 0.0;
+
         // loop over all of the neighbors of this particle
         const unsigned int size = (unsigned int)h_n_neigh.data[i];
 
@@ -399,7 +398,6 @@ void EAMForceCompute::computeForces(uint64_t timestep)
             // start computing the force
             // calculate r squared
             Scalar rsq = dot(dx, dx);
-            ;
             // only compute the force if the particles are closer than the cut-off
             if (rsq < r_cut_sq)
                 {
@@ -411,25 +409,26 @@ void EAMForceCompute::computeForces(uint64_t timestep)
                 // calculate P = sum{rho}
                 idxs = int_position + nr * (typej * ntypes + typei);
                 v = h_rho.data[idxs];
-                atomElectronDensity[i] += v.w + v.z * remainder + v.y * remainder * remainder
-                                          + v.x * remainder * remainder * remainder;
+                rho_i += v.w + remainder * (v.z + remainder * (v.y + remainder * v.x));
                 // if third_law, pair it
                 if (third_law)
                     {
                     idxs = int_position + nr * (typei * ntypes + typej);
                     v = h_rho.data[idxs];
-                    atomElectronDensity[k] += v.w + v.z * remainder + v.y * remainder * remainder
-                                              + v.x * remainder * remainder * remainder;
+                    m_electron_density[k]
+                        += v.w + remainder * (v.z + remainder * (v.y + remainder * v.x));
                     }
                 }
             }
+
+        m_electron_density[i] += rho_i;
         }
 
     for (unsigned int i = 0; i < m_pdata->getN(); i++)
         {
         unsigned int typei = __scalar_as_int(h_pos.data[i].w);
         // calculate position rho for F(rho)
-        position = atomElectronDensity[i] * rdrho;
+        position = m_electron_density[i] * rdrho;
         int_position = (unsigned int)position;
         int_position = min(int_position, nrho - 1);
         remainder = position - int_position;
@@ -438,10 +437,9 @@ void EAMForceCompute::computeForces(uint64_t timestep)
         v = h_F.data[idxs];
         dv = h_dF.data[idxs];
         // compute dF / dP
-        atomDerivativeEmbeddingFunction[i] = dv.z + dv.y * remainder + dv.x * remainder * remainder;
+        m_dF_dP[i] = dv.z + remainder * (dv.y + remainder * dv.x);
         // compute embedded energy F(P), sum up each particle
-        h_force.data[i].w += v.w + v.z * remainder + v.y * remainder * remainder
-                             + v.x * remainder * remainder * remainder;
+        h_force.data[i].w += v.w + remainder * (v.z + remainder * (v.y + remainder * v.x));
         }
 
     for (unsigned int i = 0; i < m_pdata->getN(); i++)
@@ -462,6 +460,9 @@ void EAMForceCompute::computeForces(uint64_t timestep)
         for (int k = 0; k < 6; k++)
             viriali[k] = 0.0;
 
+        // hoist the embedding derivative of particle i out of the neighbor loop
+        const Scalar dFdP_i = m_dF_dP[i];
+
         // loop over all of the neighbors of this particle
         const unsigned int size = (unsigned int)h_n_neigh.data[i];
         for (unsigned int j = 0; j < size; j++)
@@ -505,24 +506,22 @@ void EAMForceCompute::computeForces(uint64_t timestep)
             v = h_rphi.data[idxs];
             dv = h_drphi.data[idxs];
             // pair_eng = phi
-            Scalar pair_eng = (v.w + v.z * remainder + v.y * remainder * remainder
-                               + v.x * remainder * remainder * remainder)
-                              * inverseR;
+            Scalar pair_eng
+                = (v.w + remainder * (v.z + remainder * (v.y + remainder * v.x))) * inverseR;
             // derivativePhi = (phi + r * dphi/dr - phi) * 1/r = dphi / dr
             Scalar derivativePhi
-                = (dv.z + dv.y * remainder + dv.x * remainder * remainder - pair_eng) * inverseR;
+                = (dv.z + remainder * (dv.y + remainder * dv.x) - pair_eng) * inverseR;
             // derivativeRhoI = drho / dr of i
             idxs = int_position + typei * ntypes * nr + typej * nr;
             dv = h_drho.data[idxs];
-            Scalar derivativeRhoI = dv.z + dv.y * remainder + dv.x * remainder * remainder;
+            Scalar derivativeRhoI = dv.z + remainder * (dv.y + remainder * dv.x);
             // derivativeRhoJ = drho / dr of j
             idxs = int_position + typej * ntypes * nr + typei * nr;
             dv = h_drho.data[idxs];
-            Scalar derivativeRhoJ = dv.z + dv.y * remainder + dv.x * remainder * remainder;
+            Scalar derivativeRhoJ = dv.z + remainder * (dv.y + remainder * dv.x);
             // fullDerivativePhi = dF/dP * drho / dr for j + dF/dP * drho / dr for j + phi
-            Scalar fullDerivativePhi = atomDerivativeEmbeddingFunction[i] * derivativeRhoJ
-                                       + atomDerivativeEmbeddingFunction[k] * derivativeRhoI
-                                       + derivativePhi;
+            Scalar fullDerivativePhi
+                = dFdP_i * derivativeRhoJ + m_dF_dP[k] * derivativeRhoI + derivativePhi;
             // compute forces
             Scalar pairForce = -fullDerivativePhi * inverseR;
             viriali[0] += dx.x * dx.x * pairForce;
@@ -88,6 +88,9 @@ class EAMForceCompute : public ForceCompute
     GPUArray<Scalar4> m_drphi; //!< derivative pair wise function and its coefficients
     GPUArray<Scalar> m_dFdP;   //!< derivative F / derivative P
 
+    std::vector<Scalar> m_electron_density; //!< per-particle electron density scratch array
+    std::vector<Scalar> m_dF_dP;            //!< per-particle dF/dP scratch array
+
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
 
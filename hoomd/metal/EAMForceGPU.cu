@@ -120,8 +120,7 @@ __global__ void gpu_kernel_1(Scalar4* d_force,
             // calculate P = sum{rho}
             idxs = int_position + nr * (typej * ntypes + typei);
             v = __ldg(d_rho + idxs);
-            atomElectronDensity += v.w + v.z * remainder + v.y * remainder * remainder
-                                   + v.x * remainder * remainder * remainder;
+            atomElectronDensity += v.w + remainder * (v.z + remainder * (v.y + remainder * v.x));
             }
         }
 
@@ -135,10 +134,9 @@ __global__ void gpu_kernel_1(Scalar4* d_force,
     dv = __ldg(d_dF + idxs);
     v = __ldg(d_F + idxs);
     // compute dF / dP
-    d_dFdP[idx] = dv.z + dv.y * remainder + dv.x * remainder * remainder;
+    d_dFdP[idx] = dv.z + remainder * (dv.y + remainder * dv.x);
     // compute embedded energy F(P), sum up each particle
-    force.w += v.w + v.z * remainder + v.y * remainder * remainder
-               + v.x * remainder * remainder * remainder;
+    force.w += v.w + remainder * (v.z + remainder * (v.y + remainder * v.x));
     // update the d_force
     d_force[idx] = force;
     }
@@ -258,10 +256,9 @@ __global__ void gpu_kernel_2(Scalar4* d_force,
         v = __ldg(d_rphi + idxs);
         dv = __ldg(d_drphi + idxs);
         // aspair_potential = r * phi
-        Scalar aspair_potential = v.w + v.z * remainder + v.y * remainder * remainder
-                                  + v.x * remainder * remainder * remainder;
+        Scalar aspair_potential = v.w + remainder * (v.z + remainder * (v.y + remainder * v.x));
         // derivative_pair_potential = phi + r * dphi / dr
-        Scalar derivative_pair_potential = dv.z + dv.y * remainder + dv.x * remainder * remainder;
+        Scalar derivative_pair_potential = dv.z + remainder * (dv.y + remainder * dv.x);
         // pair_eng = phi
         Scalar pair_eng = aspair_potential * inverseR;
         // derivativePhi = (phi + r * dphi/dr - phi) * 1/r = dphi / dr
@@ -269,11 +266,11 @@ __global__ void gpu_kernel_2(Scalar4* d_force,
         // derivativeRhoI = drho / dr of i
         idxs = int_position + typei * ntypes * nr + typej * nr;
         dv = __ldg(d_drho + idxs);
-        Scalar derivativeRhoI = dv.z + dv.y * remainder + dv.x * remainder * remainder;
+        Scalar derivativeRhoI = dv.z + remainder * (dv.y + remainder * dv.x);
         // derivativeRhoJ = drho / dr of j
         idxs = int_position + typej * ntypes * nr + typei * nr;
         dv = __ldg(d_drho + idxs);
-        Scalar derivativeRhoJ = dv.z + dv.y * remainder + dv.x * remainder * remainder;
+        Scalar derivativeRhoJ = dv.z + remainder * (dv.y + remainder * dv.x);
         // fullDerivativePhi = dF/dP * drho / dr for j + dF/dP * drho / dr for j + phi
         Scalar d_dFdPcur = __ldg(d_dFdP + cur_neigh);
         Scalar fullDerivativePhi
@@ -13,6 +13,7 @@
 #include "ExecutionConfiguration.h"
 #include "ForceCompute.h"
 #include "ForceConstraint.h"
+#include "FrameBufferWriter.h"
 #include "GSDDequeWriter.h"
 #include "GSDDumpWriter.h"
 #include "GSDReader.h"
@@ -23,12 +24,15 @@
 #include "MeshDefinition.h"
 #include "MeshGroupData.h"
 #include "Messenger.h"
+#include "MetricRegistry.h"
+#include "MultipleTauCorrelator.h"
 #include "ParticleData.h"
 #include "ParticleFilterUpdater.h"
 #include "PythonAnalyzer.h"
 #include "PythonLocalDataAccess.h"
 #include "PythonTuner.h"
 #include "PythonUpdater.h"
+#include "RDFAnalyzer.h"
 #include "SFCPackTuner.h"
 #include "SnapshotSystemData.h"
 #include "System.h"
@@ -111,7 +115,10 @@ int initialize_mpi()
     MPI_Initialized(&external_init);
     if (!external_init)
         {
-        MPI_Init(0, (char***)NULL);
+        // request full thread support so that the optional asynchronous progress thread
+        // (MPIConfiguration::setAsyncProgressEnabled) may drive the library concurrently
+        int provided;
+        MPI_Init_thread(0, (char***)NULL, MPI_THREAD_MULTIPLE, &provided);
         }
 
     return external_init;
@@ -245,6 +252,7 @@ PYBIND11_MODULE(_hoomd, m)
     export_MPIConfiguration(m);
     export_ExecutionConfiguration(m);
     export_SystemDefinition(m);
+    export_MetricRegistry(m);
     export_MeshDefinition(m);
     export_SnapshotSystemData(m);
     export_BondedGroupData<BondData, Bond>(m, "BondData", "BondDataSnapshot");
@@ -310,6 +318,9 @@ PYBIND11_MODULE(_hoomd, m)
     export_DCDDumpWriter(m);
     export_GSDDumpWriter(m);
     export_GSDDequeWriter(m);
+    export_FrameBufferWriter(m);
+    export_MultipleTauCorrelator(m);
+    export_RDFAnalyzer(m);
 
     // updaters
     export_Updater(m);
@@ -17,15 +17,122 @@ mpcd::ATCollisionMethodGPU::ATCollisionMethodGPU(std::shared_ptr<SystemDefinitio
                                                  uint64_t period,
                                                  int phase,
                                                  std::shared_ptr<Variant> T)
-    : mpcd::ATCollisionMethod(sysdef, cur_timestep, period, phase, T)
+    : mpcd::ATCollisionMethod(sysdef, cur_timestep, period, phase, T),
+      m_rand_cell_vel(m_exec_conf), m_use_rand_cell_vel(false)
     {
     m_tuner_draw.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
                                         m_exec_conf,
                                         "mpcd_at_draw"));
+    m_tuner_rand.reset(new Autotuner<2>({AutotunerBase::makeBlockSizeRange(m_exec_conf),
+                                         AutotunerBase::getTppListPow2(m_exec_conf)},
+                                        m_exec_conf,
+                                        "mpcd_at_rand"));
     m_tuner_apply.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
                                          m_exec_conf,
                                          "mpcd_at_apply"));
-    m_autotuners.insert(m_autotuners.end(), {m_tuner_draw, m_tuner_apply});
+    m_autotuners.insert(m_autotuners.end(), {m_tuner_draw, m_tuner_rand, m_tuner_apply});
+    }
+
+/*!
+ * \param timestep Current timestep.
+ */
+void mpcd::ATCollisionMethodGPU::rule(uint64_t timestep)
+    {
+#ifdef ENABLE_MPI
+    if (m_exec_conf->getNRanks() > 1)
+        {
+        /*
+         * With domain decomposition, the boundary cells need to accumulate the random
+         * draws from neighboring ranks through the cell communicator, so fall back on
+         * the full cell thermo compute of the swapped velocity arrays.
+         */
+        m_use_rand_cell_vel = false;
+        ATCollisionMethod::rule(timestep);
+        return;
+        }
+#endif // ENABLE_MPI
+
+    // compute the real cell averages, which also draws the random velocities via callback
+    m_thermo->compute(timestep);
+
+    /*
+     * On a single rank, the cell average of the random draws is accumulated in one pass
+     * over the binned cell list rather than swapping the velocity arrays and running a
+     * second cell thermo compute.
+     */
+    sumRandCellVelocities();
+    m_use_rand_cell_vel = true;
+
+    // apply random velocities
+    applyVelocities();
+    }
+
+void mpcd::ATCollisionMethodGPU::sumRandCellVelocities()
+    {
+    const unsigned int ncells = m_cl->getNCells();
+    m_rand_cell_vel.resize(ncells);
+
+    ArrayHandle<double4> d_rand_vel(m_rand_cell_vel,
+                                    access_location::device,
+                                    access_mode::overwrite);
+    ArrayHandle<unsigned int> d_cell_np(m_cl->getCellSizeArray(),
+                                        access_location::device,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> d_cell_list(m_cl->getCellList(),
+                                          access_location::device,
+                                          access_mode::read);
+    ArrayHandle<Scalar4> d_vel_alt(m_mpcd_pdata->getAltVelocities(),
+                                   access_location::device,
+                                   access_mode::read);
+    const unsigned int N_mpcd = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
+
+    if (m_embed_group)
+        {
+        ArrayHandle<Scalar4> d_vel_alt_embed(m_pdata->getAltVelocities(),
+                                             access_location::device,
+                                             access_mode::read);
+        ArrayHandle<unsigned int> d_embed_idx(m_embed_group->getIndexArray(),
+                                              access_location::device,
+                                              access_mode::read);
+
+        m_tuner_rand->begin();
+        auto param = m_tuner_rand->getParam();
+        mpcd::gpu::at_rand_cell_velocity(d_rand_vel.data,
+                                         d_cell_np.data,
+                                         d_cell_list.data,
+                                         m_cl->getCellListIndexer(),
+                                         d_vel_alt.data,
+                                         d_vel_alt_embed.data,
+                                         d_embed_idx.data,
+                                         N_mpcd,
+                                         m_mpcd_pdata->getMass(),
+                                         ncells,
+                                         param[0],
+                                         param[1]);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner_rand->end();
+        }
+    else
+        {
+        m_tuner_rand->begin();
+        auto param = m_tuner_rand->getParam();
+        mpcd::gpu::at_rand_cell_velocity(d_rand_vel.data,
+                                         d_cell_np.data,
+                                         d_cell_list.data,
+                                         m_cl->getCellListIndexer(),
+                                         d_vel_alt.data,
+                                         NULL,
+                                         NULL,
+                                         N_mpcd,
+                                         m_mpcd_pdata->getMass(),
+                                         ncells,
+                                         param[0],
+                                         param[1]);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner_rand->end();
+        }
     }
 
 void mpcd::ATCollisionMethodGPU::drawVelocities(uint64_t timestep)
@@ -113,11 +220,12 @@ void mpcd::ATCollisionMethodGPU::applyVelocities()
     const unsigned int N_mpcd = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
     unsigned int N_tot = N_mpcd;
 
-    // cell data
+    // cell data, using the fused cell averages of the random draws when they are current
     ArrayHandle<double4> d_cell_vel(m_thermo->getCellVelocities(),
                                     access_location::device,
                                     access_mode::read);
-    ArrayHandle<double4> d_rand_vel(m_rand_thermo->getCellVelocities(),
+    ArrayHandle<double4> d_rand_vel(m_use_rand_cell_vel ? m_rand_cell_vel
+                                                        : m_rand_thermo->getCellVelocities(),
                                     access_location::device,
                                     access_mode::read);
 
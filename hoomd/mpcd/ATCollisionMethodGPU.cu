@@ -10,6 +10,7 @@
 #include "ParticleDataUtilities.h"
 #include "hoomd/RNGIdentifiers.h"
 #include "hoomd/RandomNumbers.h"
+#include "hoomd/WarpTools.cuh"
 
 namespace hoomd
     {
@@ -72,6 +73,101 @@ __global__ void at_draw_velocity(Scalar4* d_alt_vel,
         }
     }
 
+//! Kernel to compute the per-cell average of the random velocities
+/*!
+ * \param d_rand_vel Average random velocity and mass per cell (output)
+ * \param d_cell_np Number of particles per cell
+ * \param d_cell_list MPCD cell list
+ * \param cli Indexer into the cell list
+ * \param d_vel_alt Random MPCD particle velocities
+ * \param d_vel_alt_embed Random embedded particle velocities
+ * \param d_embed_idx Embedded particle indexes
+ * \param N_mpcd Number of MPCD particles
+ * \param mpcd_mass Mass of MPCD particle
+ * \param Ncell Number of cells
+ *
+ * \tparam tpp Number of threads to use per cell
+ *
+ * \b Implementation details:
+ * Using \a tpp threads per cell, the momentum of the random draws is accumulated
+ * per cell directly from the binned cell list, mirroring
+ * mpcd::gpu::kernel::inner_cell_thermo without the energy accumulation. This
+ * replaces a full pass of the cell thermo compute over the swapped velocity
+ * arrays, so the cell list layout is only traversed once more after the real
+ * velocities have been averaged.
+ */
+template<unsigned int tpp>
+__global__ void at_rand_cell_velocity(double4* d_rand_vel,
+                                      const unsigned int* d_cell_np,
+                                      const unsigned int* d_cell_list,
+                                      const Index2D cli,
+                                      const Scalar4* d_vel_alt,
+                                      const Scalar4* d_vel_alt_embed,
+                                      const unsigned int* d_embed_idx,
+                                      const unsigned int N_mpcd,
+                                      const Scalar mpcd_mass,
+                                      const unsigned int Ncell)
+    {
+    // tpp threads per cell
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= tpp * Ncell)
+        return;
+
+    const unsigned int cell_id = idx / tpp;
+    const unsigned int np = d_cell_np[cell_id];
+    double4 momentum = make_double4(0.0, 0.0, 0.0, 0.0);
+
+    for (unsigned int offset = (idx % tpp); offset < np; offset += tpp)
+        {
+        // Load particle data
+        const unsigned int cur_p = d_cell_list[cli(offset, cell_id)];
+        double3 vel_i;
+        double mass_i;
+        if (cur_p < N_mpcd)
+            {
+            Scalar4 vel_cell = d_vel_alt[cur_p];
+            vel_i = make_double3(vel_cell.x, vel_cell.y, vel_cell.z);
+            mass_i = mpcd_mass;
+            }
+        else
+            {
+            Scalar4 vel_m = d_vel_alt_embed[d_embed_idx[cur_p - N_mpcd]];
+            vel_i = make_double3(vel_m.x, vel_m.y, vel_m.z);
+            mass_i = vel_m.w;
+            }
+
+        // add momentum
+        momentum.x += mass_i * vel_i.x;
+        momentum.y += mass_i * vel_i.y;
+        momentum.z += mass_i * vel_i.z;
+        momentum.w += mass_i;
+        }
+
+    // reduce quantities down into the 0-th lane per logical warp
+    if (tpp > 1)
+        {
+        hoomd::detail::WarpReduce<Scalar, tpp> reducer;
+        momentum.x = reducer.Sum(momentum.x);
+        momentum.y = reducer.Sum(momentum.y);
+        momentum.z = reducer.Sum(momentum.z);
+        momentum.w = reducer.Sum(momentum.w);
+        }
+
+    // 0-th lane in each warp normalizes and writes the result
+    if (idx % tpp == 0)
+        {
+        const double mass = momentum.w;
+        double3 vel_cm = make_double3(0.0, 0.0, 0.0);
+        if (mass > 0.)
+            {
+            vel_cm.x = momentum.x / mass;
+            vel_cm.y = momentum.y / mass;
+            vel_cm.z = momentum.z / mass;
+            }
+        d_rand_vel[cell_id] = make_double4(vel_cm.x, vel_cm.y, vel_cm.z, mass);
+        }
+    }
+
 __global__ void at_apply_velocity(Scalar4* d_vel,
                                   Scalar4* d_vel_embed,
                                   const Scalar4* d_vel_alt,
@@ -163,6 +259,148 @@ cudaError_t at_draw_velocity(Scalar4* d_alt_vel,
     return cudaSuccess;
     }
 
+//! Templated launcher for multiple threads-per-cell kernel for random cell velocities
+/*
+ * \param d_rand_vel Average random velocity and mass per cell (output)
+ * \param d_cell_np Number of particles per cell
+ * \param d_cell_list MPCD cell list
+ * \param cli Indexer into the cell list
+ * \param d_vel_alt Random MPCD particle velocities
+ * \param d_vel_alt_embed Random embedded particle velocities
+ * \param d_embed_idx Embedded particle indexes
+ * \param N_mpcd Number of MPCD particles
+ * \param mpcd_mass Mass of MPCD particle
+ * \param Ncell Number of cells
+ * \param block_size Number of threads per block
+ * \param tpp Number of threads per cell
+ *
+ * \tparam cur_tpp Number of threads-per-cell for this template instantiation
+ *
+ * Launchers are recursively instantiated at compile-time in order to match the
+ * correct number of threads at runtime. If the templated number of threads matches
+ * the runtime number of threads, then the kernel is launched. Otherwise, the
+ * next template (with threads reduced by a factor of 2) is launched. This
+ * recursion is broken by a specialized template for 0 threads, which does no
+ * work.
+ */
+template<unsigned int cur_tpp>
+inline void launch_at_rand_cell_velocity(double4* d_rand_vel,
+                                         const unsigned int* d_cell_np,
+                                         const unsigned int* d_cell_list,
+                                         const Index2D& cli,
+                                         const Scalar4* d_vel_alt,
+                                         const Scalar4* d_vel_alt_embed,
+                                         const unsigned int* d_embed_idx,
+                                         const unsigned int N_mpcd,
+                                         const Scalar mpcd_mass,
+                                         const unsigned int Ncell,
+                                         const unsigned int block_size,
+                                         const unsigned int tpp)
+    {
+    if (cur_tpp == tpp)
+        {
+        unsigned int max_block_size;
+        cudaFuncAttributes attr;
+        cudaFuncGetAttributes(&attr,
+                              (const void*)mpcd::gpu::kernel::at_rand_cell_velocity<cur_tpp>);
+        max_block_size = attr.maxThreadsPerBlock;
+
+        unsigned int run_block_size = min(block_size, max_block_size);
+        dim3 grid(cur_tpp * Ncell / run_block_size + 1);
+        mpcd::gpu::kernel::at_rand_cell_velocity<cur_tpp><<<grid, run_block_size>>>(d_rand_vel,
+                                                                                    d_cell_np,
+                                                                                    d_cell_list,
+                                                                                    cli,
+                                                                                    d_vel_alt,
+                                                                                    d_vel_alt_embed,
+                                                                                    d_embed_idx,
+                                                                                    N_mpcd,
+                                                                                    mpcd_mass,
+                                                                                    Ncell);
+        }
+    else
+        {
+        launch_at_rand_cell_velocity<cur_tpp / 2>(d_rand_vel,
+                                                  d_cell_np,
+                                                  d_cell_list,
+                                                  cli,
+                                                  d_vel_alt,
+                                                  d_vel_alt_embed,
+                                                  d_embed_idx,
+                                                  N_mpcd,
+                                                  mpcd_mass,
+                                                  Ncell,
+                                                  block_size,
+                                                  tpp);
+        }
+    }
+//! Template specialization to break recursion
+template<>
+inline void launch_at_rand_cell_velocity<0>(double4* d_rand_vel,
+                                            const unsigned int* d_cell_np,
+                                            const unsigned int* d_cell_list,
+                                            const Index2D& cli,
+                                            const Scalar4* d_vel_alt,
+                                            const Scalar4* d_vel_alt_embed,
+                                            const unsigned int* d_embed_idx,
+                                            const unsigned int N_mpcd,
+                                            const Scalar mpcd_mass,
+                                            const unsigned int Ncell,
+                                            const unsigned int block_size,
+                                            const unsigned int tpp)
+    {
+    }
+
+/*!
+ * \param d_rand_vel Average random velocity and mass per cell (output)
+ * \param d_cell_np Number of particles per cell
+ * \param d_cell_list MPCD cell list
+ * \param cli Indexer into the cell list
+ * \param d_vel_alt Random MPCD particle velocities
+ * \param d_vel_alt_embed Random embedded particle velocities
+ * \param d_embed_idx Embedded particle indexes
+ * \param N_mpcd Number of MPCD particles
+ * \param mpcd_mass Mass of MPCD particle
+ * \param Ncell Number of cells
+ * \param block_size Number of threads per block
+ * \param tpp Number of threads per cell
+ *
+ * \returns cudaSuccess on completion
+ *
+ * \sa mpcd::gpu::launch_at_rand_cell_velocity
+ * \sa mpcd::gpu::kernel::at_rand_cell_velocity
+ */
+cudaError_t at_rand_cell_velocity(double4* d_rand_vel,
+                                  const unsigned int* d_cell_np,
+                                  const unsigned int* d_cell_list,
+                                  const Index2D& cli,
+                                  const Scalar4* d_vel_alt,
+                                  const Scalar4* d_vel_alt_embed,
+                                  const unsigned int* d_embed_idx,
+                                  const unsigned int N_mpcd,
+                                  const Scalar mpcd_mass,
+                                  const unsigned int Ncell,
+                                  const unsigned int block_size,
+                                  const unsigned int tpp)
+    {
+    if (Ncell == 0)
+        return cudaSuccess;
+
+    launch_at_rand_cell_velocity<32>(d_rand_vel,
+                                     d_cell_np,
+                                     d_cell_list,
+                                     cli,
+                                     d_vel_alt,
+                                     d_vel_alt_embed,
+                                     d_embed_idx,
+                                     N_mpcd,
+                                     mpcd_mass,
+                                     Ncell,
+                                     block_size,
+                                     tpp);
+    return cudaSuccess;
+    }
+
 cudaError_t at_apply_velocity(Scalar4* d_vel,
                               Scalar4* d_vel_embed,
                               const Scalar4* d_vel_alt,
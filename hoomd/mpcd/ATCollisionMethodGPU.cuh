@@ -35,6 +35,20 @@ cudaError_t at_draw_velocity(Scalar4* d_alt_vel,
                              const unsigned int N_tot,
                              const unsigned int block_size);
 
+//! Compute the per-cell average of the random velocities for the Andersen thermostat
+cudaError_t at_rand_cell_velocity(double4* d_rand_vel,
+                                  const unsigned int* d_cell_np,
+                                  const unsigned int* d_cell_list,
+                                  const Index2D& cli,
+                                  const Scalar4* d_vel_alt,
+                                  const Scalar4* d_vel_alt_embed,
+                                  const unsigned int* d_embed_idx,
+                                  const unsigned int N_mpcd,
+                                  const Scalar mpcd_mass,
+                                  const unsigned int Ncell,
+                                  const unsigned int block_size,
+                                  const unsigned int tpp);
+
 //! Apply velocities for the Andersen thermostat
 cudaError_t at_apply_velocity(Scalar4* d_vel,
                               Scalar4* d_vel_embed,
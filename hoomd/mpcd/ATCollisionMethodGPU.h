@@ -33,15 +33,25 @@ class PYBIND11_EXPORT ATCollisionMethodGPU : public mpcd::ATCollisionMethod
     void setCellList(std::shared_ptr<mpcd::CellList> cl);
 
     protected:
+    //! Implementation of the collision rule
+    virtual void rule(uint64_t timestep);
+
     //! Draw velocities for particles in each cell on the GPU
     virtual void drawVelocities(uint64_t timestep);
 
+    //! Average the random velocities per cell on the GPU
+    void sumRandCellVelocities();
+
     //! Apply the random velocities to particles in each cell on the GPU
     virtual void applyVelocities();
 
     private:
     std::shared_ptr<Autotuner<1>> m_tuner_draw;  //!< Tuner for drawing random velocities
+    std::shared_ptr<Autotuner<2>> m_tuner_rand;  //!< Tuner for averaging random velocities
     std::shared_ptr<Autotuner<1>> m_tuner_apply; //!< Tuner for applying random velocities
+
+    GPUVector<double4> m_rand_cell_vel; //!< Cell average of the random velocities
+    bool m_use_rand_cell_vel;           //!< True when m_rand_cell_vel holds the averages
     };
 
 namespace detail
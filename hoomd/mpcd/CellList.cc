@@ -104,7 +104,17 @@ void mpcd::CellList::compute(uint64_t timestep)
         bool overflowed = false;
         do
             {
-            buildCellList();
+            if (!overflowed)
+                {
+                buildCellList();
+                }
+            else
+                {
+                // an overflowed build already assigned every particle a valid cell, so the
+                // resized list can be repopulated from the stashed cell ids without binning
+                // the positions a second time
+                refillCellList();
+                }
 
             overflowed = checkConditions();
 
@@ -668,6 +678,47 @@ void mpcd::CellList::buildCellList()
     m_conditions.resetFlags(conditions);
     }
 
+/*!
+ * When buildCellList() overflows, the cell assignment of every particle is still valid and has
+ * been stashed into the velocity array (solvent) or the embedded cell id array (solute). The
+ * resized cell list can therefore be repopulated by reading the stashed ids back, skipping the
+ * binning arithmetic and validity checks of a full rebuild.
+ */
+void mpcd::CellList::refillCellList()
+    {
+    ArrayHandle<unsigned int> h_cell_list(m_cell_list,
+                                          access_location::host,
+                                          access_mode::overwrite);
+    ArrayHandle<unsigned int> h_cell_np(m_cell_np, access_location::host, access_mode::overwrite);
+    // zero the cell counter
+    memset(h_cell_np.data, 0, sizeof(unsigned int) * m_cell_indexer.getNumElements());
+
+    ArrayHandle<Scalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                               access_location::host,
+                               access_mode::read);
+    const unsigned int N_mpcd = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
+    unsigned int N_tot = N_mpcd;
+
+    std::unique_ptr<ArrayHandle<unsigned int>> h_embed_cell_ids;
+    if (m_embed_group)
+        {
+        h_embed_cell_ids.reset(new ArrayHandle<unsigned int>(m_embed_cell_ids,
+                                                             access_location::host,
+                                                             access_mode::read));
+        N_tot += m_embed_group->getNumMembers();
+        }
+
+    for (unsigned int cur_p = 0; cur_p < N_tot; ++cur_p)
+        {
+        const unsigned int bin_idx = (cur_p < N_mpcd)
+                                         ? __scalar_as_int(h_vel.data[cur_p].w)
+                                         : h_embed_cell_ids->data[cur_p - N_mpcd];
+
+        const unsigned int offset = h_cell_np.data[bin_idx]++;
+        h_cell_list.data[m_cell_list_indexer(offset, bin_idx)] = cur_p;
+        }
+    }
+
 /*!
  * \param timestep Timestep that the sorting occurred
  * \param order Mapping of sorted particle indexes onto old particle indexes
@@ -16,10 +16,13 @@ mpcd::CellListGPU::CellListGPU(std::shared_ptr<SystemDefinition> sysdef) : mpcd:
     m_tuner_cell.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
                                         m_exec_conf,
                                         "mpcd_cell"));
+    m_tuner_refill.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                          m_exec_conf,
+                                          "mpcd_cell_refill"));
     m_tuner_sort.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
                                         m_exec_conf,
                                         "mpcd_cell_sort"));
-    m_autotuners.insert(m_autotuners.end(), {m_tuner_cell, m_tuner_sort});
+    m_autotuners.insert(m_autotuners.end(), {m_tuner_cell, m_tuner_refill, m_tuner_sort});
 
 #ifdef ENABLE_MPI
     m_tuner_embed_migrate.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
@@ -129,6 +132,62 @@ void mpcd::CellListGPU::buildCellList()
         }
     }
 
+/*!
+ * Refills the cell list on the GPU from the cell ids stashed by the last buildCellList() pass,
+ * skipping the binning arithmetic and validity checks of a full rebuild.
+ */
+void mpcd::CellListGPU::refillCellList()
+    {
+    ArrayHandle<unsigned int> d_cell_list(m_cell_list,
+                                          access_location::device,
+                                          access_mode::overwrite);
+    ArrayHandle<unsigned int> d_cell_np(m_cell_np, access_location::device, access_mode::overwrite);
+    ArrayHandle<Scalar4> d_vel(m_mpcd_pdata->getVelocities(),
+                               access_location::device,
+                               access_mode::read);
+
+    const unsigned int N_mpcd = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual();
+    unsigned int N_tot = N_mpcd;
+
+    if (m_embed_group)
+        {
+        ArrayHandle<unsigned int> d_embed_cell_ids(m_embed_cell_ids,
+                                                   access_location::device,
+                                                   access_mode::read);
+        N_tot += m_embed_group->getNumMembers();
+
+        m_tuner_refill->begin();
+        mpcd::gpu::refill_cell_list(d_cell_np.data,
+                                    d_cell_list.data,
+                                    d_vel.data,
+                                    d_embed_cell_ids.data,
+                                    m_cell_indexer,
+                                    m_cell_list_indexer,
+                                    N_mpcd,
+                                    N_tot,
+                                    m_tuner_refill->getParam()[0]);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner_refill->end();
+        }
+    else
+        {
+        m_tuner_refill->begin();
+        mpcd::gpu::refill_cell_list(d_cell_np.data,
+                                    d_cell_list.data,
+                                    d_vel.data,
+                                    NULL,
+                                    m_cell_indexer,
+                                    m_cell_list_indexer,
+                                    N_mpcd,
+                                    N_tot,
+                                    m_tuner_refill->getParam()[0]);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner_refill->end();
+        }
+    }
+
 /*!
  * \param timestep Timestep that the sorting occurred
  * \param order Mapping of sorted particle indexes onto old particle indexes
@@ -155,6 +155,49 @@ __global__ void compute_cell_list(unsigned int* d_cell_np,
         }
     }
 
+//! Kernel to refill the MPCD cell list from the stashed cell ids
+/*!
+ * \param d_cell_np Array of number of particles per cell
+ * \param d_cell_list 2D array of MPCD particles in each cell
+ * \param d_vel MPCD particle velocities holding the stashed cell ids
+ * \param d_embed_cell_ids Cell indexes of embedded particles
+ * \param cell_list_indexer 2D indexer for particle position in cell
+ * \param N_mpcd Number of MPCD particles
+ * \param N_tot Total number of particle (MPCD + embedded)
+ *
+ * \b Implementation
+ * One thread is launched per particle. The cell id stashed by the last compute_cell_list pass
+ * is read back rather than binning the position again, and the particle is written into its
+ * cell. The caller must guarantee that the cell list is large enough to hold every particle,
+ * which holds after an overflowed build because the per-cell counts were fully accumulated.
+ */
+__global__ void refill_cell_list(unsigned int* d_cell_np,
+                                 unsigned int* d_cell_list,
+                                 const Scalar4* d_vel,
+                                 const unsigned int* d_embed_cell_ids,
+                                 const Index2D cell_list_indexer,
+                                 const unsigned int N_mpcd,
+                                 const unsigned int N_tot)
+    {
+    // one thread per particle
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N_tot)
+        return;
+
+    unsigned int bin_idx;
+    if (idx < N_mpcd)
+        {
+        bin_idx = __scalar_as_int(d_vel[idx].w);
+        }
+    else
+        {
+        bin_idx = d_embed_cell_ids[idx - N_mpcd];
+        }
+
+    const unsigned int offset = atomicInc(&d_cell_np[bin_idx], 0xffffffff);
+    d_cell_list[cell_list_indexer(offset, bin_idx)] = idx;
+    }
+
 /*!
  * \param d_migrate_flag Flag signaling migration is required (output)
  * \param d_pos Embedded particle positions
@@ -311,6 +354,55 @@ cudaError_t mpcd::gpu::compute_cell_list(unsigned int* d_cell_np,
     return cudaSuccess;
     }
 
+/*!
+ * \param d_cell_np Array of number of particles per cell
+ * \param d_cell_list 2D array of MPCD particles in each cell
+ * \param d_vel MPCD particle velocities holding the stashed cell ids
+ * \param d_embed_cell_ids Cell indexes of embedded particles
+ * \param cell_indexer 3D indexer for cell id
+ * \param cell_list_indexer 2D indexer for particle position in cell
+ * \param N_mpcd Number of MPCD particles
+ * \param N_tot Total number of particle (MPCD + embedded)
+ * \param block_size Number of threads per block
+ *
+ * \returns cudaSuccess on completion, or an error on failure
+ *
+ * \sa mpcd::gpu::kernel::refill_cell_list
+ */
+cudaError_t mpcd::gpu::refill_cell_list(unsigned int* d_cell_np,
+                                        unsigned int* d_cell_list,
+                                        const Scalar4* d_vel,
+                                        const unsigned int* d_embed_cell_ids,
+                                        const Index3D& cell_indexer,
+                                        const Index2D& cell_list_indexer,
+                                        const unsigned int N_mpcd,
+                                        const unsigned int N_tot,
+                                        const unsigned int block_size)
+    {
+    // set the number of particles in each cell to zero
+    cudaError_t error
+        = cudaMemset(d_cell_np, 0, sizeof(unsigned int) * cell_indexer.getNumElements());
+    if (error != cudaSuccess)
+        return error;
+
+    unsigned int max_block_size;
+    cudaFuncAttributes attr;
+    cudaFuncGetAttributes(&attr, (const void*)mpcd::gpu::kernel::refill_cell_list);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid(N_tot / run_block_size + 1);
+    mpcd::gpu::kernel::refill_cell_list<<<grid, run_block_size>>>(d_cell_np,
+                                                                  d_cell_list,
+                                                                  d_vel,
+                                                                  d_embed_cell_ids,
+                                                                  cell_list_indexer,
+                                                                  N_mpcd,
+                                                                  N_tot);
+
+    return cudaSuccess;
+    }
+
 /*!
  * \param d_migrate_flag Flag signaling migration is required (output)
  * \param d_pos Embedded particle positions
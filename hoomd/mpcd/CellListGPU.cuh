@@ -43,6 +43,17 @@ cudaError_t compute_cell_list(unsigned int* d_cell_np,
                               const unsigned int N_tot,
                               const unsigned int block_size);
 
+//! Kernel driver to refill the cell list from the stashed cell ids
+cudaError_t refill_cell_list(unsigned int* d_cell_np,
+                             unsigned int* d_cell_list,
+                             const Scalar4* d_vel,
+                             const unsigned int* d_embed_cell_ids,
+                             const Index3D& cell_indexer,
+                             const Index2D& cell_list_indexer,
+                             const unsigned int N_mpcd,
+                             const unsigned int N_tot,
+                             const unsigned int block_size);
+
 //! Kernel driver to check if any embedded particles require migration
 cudaError_t cell_check_migrate_embed(unsigned int* d_migrate_flag,
                                      const Scalar4* d_pos,
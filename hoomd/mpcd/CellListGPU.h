@@ -33,6 +33,9 @@ class PYBIND11_EXPORT CellListGPU : public mpcd::CellList
     //! Compute the cell list of particles on the GPU
     virtual void buildCellList();
 
+    //! Refill the cell list from the stashed cell ids on the GPU
+    virtual void refillCellList();
+
     //! Callback to sort cell list on the GPU when particle data is sorted
     virtual void sort(uint64_t timestep,
                       const GPUArray<unsigned int>& order,
@@ -48,6 +51,9 @@ class PYBIND11_EXPORT CellListGPU : public mpcd::CellList
     /// Autotuner for the cell list calculation.
     std::shared_ptr<Autotuner<1>> m_tuner_cell;
 
+    /// Autotuner for refilling the cell list after an overflow.
+    std::shared_ptr<Autotuner<1>> m_tuner_refill;
+
     /// Autotuner for sorting the cell list.
     std::shared_ptr<Autotuner<1>> m_tuner_sort;
 #ifdef ENABLE_MPI
@@ -58,7 +58,8 @@ class PYBIND11_EXPORT ConfinedStreamingMethod : public mpcd::StreamingMethod
                             int phase,
                             std::shared_ptr<const Geometry> geom)
         : mpcd::StreamingMethod(sysdef, cur_timestep, period, phase), m_geom(geom),
-          m_validate_geom(true)
+          m_validate_geom(true), m_mask_dim(make_uint3(0, 0, 0)),
+          m_mask_origin(make_int3(0, 0, 0)), m_mask_cell_size(0)
         {
         }
 
@@ -76,17 +77,27 @@ class PYBIND11_EXPORT ConfinedStreamingMethod : public mpcd::StreamingMethod
         {
         m_validate_geom = true;
         m_geom = geom;
+        // force a rebuild of the boundary cell mask for the new geometry
+        m_mask_dim = make_uint3(0, 0, 0);
         }
 
     protected:
     std::shared_ptr<const Geometry> m_geom; //!< Streaming geometry
     bool m_validate_geom;                   //!< If true, run a validation check on the geometry
 
+    GPUArray<unsigned char> m_boundary_cells; //!< Flags for cells adjacent to the boundary
+    uint3 m_mask_dim;                         //!< Cell dimensions the mask was built for
+    int3 m_mask_origin;                       //!< Cell origin the mask was built for
+    Scalar m_mask_cell_size;                  //!< Cell size the mask was built for
+
     //! Validate the system with the streaming geometry
     void validate();
 
     //! Check that particles lie inside the geometry
     virtual bool validateParticles();
+
+    //! Flag the cells that lie near the geometry boundary
+    void computeBoundaryCells();
     };
 
 /*!
@@ -110,6 +121,22 @@ template<class Geometry> void ConfinedStreamingMethod<Geometry>::stream(uint64_t
 
     const BoxDim box = m_cl->getCoverageBox();
 
+    // rebuild the boundary cell mask if the cell list has been resized or the geometry changed
+    const uint3 cell_dim = m_cl->getDim();
+    const int3 cell_origin = m_cl->getOriginIndex();
+    const Scalar cell_size = m_cl->getCellSize();
+    if (cell_dim.x != m_mask_dim.x || cell_dim.y != m_mask_dim.y || cell_dim.z != m_mask_dim.z
+        || cell_origin.x != m_mask_origin.x || cell_origin.y != m_mask_origin.y
+        || cell_origin.z != m_mask_origin.z || cell_size != m_mask_cell_size)
+        {
+        computeBoundaryCells();
+        }
+    const Index3D& ci = m_cl->getCellIndexer();
+    const Scalar3 global_lo = m_pdata->getGlobalBox().getLo();
+    ArrayHandle<unsigned char> h_boundary_cells(m_boundary_cells,
+                                                access_location::host,
+                                                access_mode::read);
+
     ArrayHandle<Scalar4> h_pos(m_mpcd_pdata->getPositions(),
                                access_location::host,
                                access_mode::readwrite);
@@ -135,14 +162,45 @@ template<class Geometry> void ConfinedStreamingMethod<Geometry>::stream(uint64_t
             vel += Scalar(0.5) * m_mpcd_dt * field->evaluate(pos) / mass;
             }
 
-        // propagate the particle to its new position ballistically
-        Scalar dt_remain = m_mpcd_dt;
-        bool collide = true;
-        do
+        // particles far from the walls take a straight-line fast path: the cell mask is padded
+        // by one cell width, so a particle starting in a bulk cell that moves no more than one
+        // cell in any direction cannot reach the boundary during this step
+        const Scalar3 dx = m_mpcd_dt * vel;
+        bool bulk = std::fabs(dx.x) <= cell_size && std::fabs(dx.y) <= cell_size
+                    && std::fabs(dx.z) <= cell_size;
+        if (bulk)
+            {
+            const Scalar3 delta = pos - global_lo;
+            const int3 cell = make_int3((int)std::floor(delta.x / cell_size) - cell_origin.x,
+                                        (int)std::floor(delta.y / cell_size) - cell_origin.y,
+                                        (int)std::floor(delta.z / cell_size) - cell_origin.z);
+            if (cell.x >= 0 && cell.x < (int)cell_dim.x && cell.y >= 0 && cell.y < (int)cell_dim.y
+                && cell.z >= 0 && cell.z < (int)cell_dim.z)
+                {
+                bulk = !h_boundary_cells.data[ci(cell.x, cell.y, cell.z)];
+                }
+            else
+                {
+                bulk = false;
+                }
+            }
+
+        if (bulk)
+            {
+            // propagate the particle to its new position ballistically
+            pos += dx;
+            }
+        else
             {
-            pos += dt_remain * vel;
-            collide = m_geom->detectCollision(pos, vel, dt_remain);
-            } while (dt_remain > 0 && collide);
+            // propagate with collision detection against the boundary
+            Scalar dt_remain = m_mpcd_dt;
+            bool collide = true;
+            do
+                {
+                pos += dt_remain * vel;
+                collide = m_geom->detectCollision(pos, vel, dt_remain);
+                } while (dt_remain > 0 && collide);
+            }
         // finalize velocity update
         if (field)
             {
@@ -220,6 +278,68 @@ template<class Geometry> bool ConfinedStreamingMethod<Geometry>::validateParticl
     return true;
     }
 
+/*!
+ * Flags the cells of the MPCD cell list that lie near the geometry boundary. A cell is flagged
+ * when any point of a 3x3x3 lattice covering the cell, padded outward by one cell width plus the
+ * maximum grid shift, lies outside the geometry. Particles in unflagged (bulk) cells can safely
+ * skip collision detection during streaming provided they move no more than one cell width.
+ */
+template<class Geometry> void ConfinedStreamingMethod<Geometry>::computeBoundaryCells()
+    {
+    m_mask_dim = m_cl->getDim();
+    m_mask_origin = m_cl->getOriginIndex();
+    m_mask_cell_size = m_cl->getCellSize();
+
+    const Index3D& ci = m_cl->getCellIndexer();
+    if (m_boundary_cells.getNumElements() < ci.getNumElements())
+        {
+        GPUArray<unsigned char> boundary_cells(ci.getNumElements(), m_exec_conf);
+        m_boundary_cells.swap(boundary_cells);
+        }
+
+    const Scalar3 global_lo = m_pdata->getGlobalBox().getLo();
+    const Scalar margin = m_mask_cell_size + m_cl->getMaxGridShift();
+
+    ArrayHandle<unsigned char> h_boundary_cells(m_boundary_cells,
+                                                access_location::host,
+                                                access_mode::overwrite);
+    unsigned int num_boundary = 0;
+    for (unsigned int k = 0; k < m_mask_dim.z; ++k)
+        {
+        for (unsigned int j = 0; j < m_mask_dim.y; ++j)
+            {
+            for (unsigned int i = 0; i < m_mask_dim.x; ++i)
+                {
+                const Scalar3 lo
+                    = make_scalar3(global_lo.x + m_mask_cell_size * (m_mask_origin.x + (int)i),
+                                   global_lo.y + m_mask_cell_size * (m_mask_origin.y + (int)j),
+                                   global_lo.z + m_mask_cell_size * (m_mask_origin.z + (int)k))
+                      - make_scalar3(margin, margin, margin);
+                const Scalar half_width = Scalar(0.5) * m_mask_cell_size + margin;
+
+                unsigned char boundary = 0;
+                for (int sz = 0; sz <= 2 && !boundary; ++sz)
+                    {
+                    for (int sy = 0; sy <= 2 && !boundary; ++sy)
+                        {
+                        for (int sx = 0; sx <= 2 && !boundary; ++sx)
+                            {
+                            const Scalar3 point
+                                = lo + half_width * make_scalar3(Scalar(sx), Scalar(sy), Scalar(sz));
+                            boundary = m_geom->isOutside(point);
+                            }
+                        }
+                    }
+                h_boundary_cells.data[ci(i, j, k)] = boundary;
+                num_boundary += boundary;
+                }
+            }
+        }
+
+    m_exec_conf->msg->notice(4) << "ConfinedStreamingMethod: " << num_boundary << " of "
+                                << ci.getNumElements() << " cells are boundary cells." << std::endl;
+    }
+
 namespace detail
     {
 //! Export mpcd::StreamingMethod to python
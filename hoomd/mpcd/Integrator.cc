@@ -72,9 +72,19 @@ void mpcd::Integrator::update(uint64_t timestep)
             }
         }
 
-    // optionally sort
+    // optionally sort, either at every collision or on the sorter's own period
     if (m_sorter)
-        m_sorter->update(timestep);
+        {
+        if (m_sort_on_collide)
+            {
+            if (checkCollide(timestep))
+                m_sorter->forceSort(timestep);
+            }
+        else
+            {
+            m_sorter->update(timestep);
+            }
+        }
 
     // call the MPCD collision rule before the first MD step so that any embedded velocities are
     // updated first
@@ -196,6 +206,7 @@ void mpcd::detail::export_Integrator(pybind11::module& m)
         .def("removeStreamingMethod", &mpcd::Integrator::removeStreamingMethod)
         .def("setSorter", &mpcd::Integrator::setSorter)
         .def("removeSorter", &mpcd::Integrator::removeSorter)
+        .def("setSortOnCollide", &mpcd::Integrator::setSortOnCollide)
         .def("addFiller", &mpcd::Integrator::addFiller)
         .def("removeAllFillers", &mpcd::Integrator::removeAllFillers)
 #ifdef ENABLE_MPI
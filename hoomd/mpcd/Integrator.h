@@ -137,6 +137,26 @@ class PYBIND11_EXPORT Integrator : public hoomd::md::IntegratorTwoStep
         m_sorter.reset();
         }
 
+    //! Toggle sorting at every collision step
+    /*!
+     * \param enable If true, sort at every collision step instead of on the sorter period
+     *
+     * When enabled, the sorter is synchronized with the collision cadence so that the
+     * collision kernels always stream through cell-ordered particle data. The cell list
+     * built for the sort is remapped in place and reused by the collision, so no extra
+     * cell list builds are incurred.
+     */
+    void setSortOnCollide(bool enable)
+        {
+        m_sort_on_collide = enable;
+        }
+
+    //! Get whether sorting occurs at every collision step
+    bool getSortOnCollide() const
+        {
+        return m_sort_on_collide;
+        }
+
     //! Add a virtual particle filling method
     void addFiller(std::shared_ptr<mpcd::VirtualParticleFiller> filler);
 
@@ -157,6 +177,8 @@ class PYBIND11_EXPORT Integrator : public hoomd::md::IntegratorTwoStep
 
     std::vector<std::shared_ptr<mpcd::VirtualParticleFiller>>
         m_fillers; //!< MPCD virtual particle fillers
+
+    bool m_sort_on_collide = false; //!< If true, sort at every collision step
     private:
     //! Check if a collision will occur at the current timestep
     bool checkCollide(uint64_t timestep)
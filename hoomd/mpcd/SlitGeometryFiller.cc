@@ -17,7 +17,8 @@ mpcd::SlitGeometryFiller::SlitGeometryFiller(std::shared_ptr<SystemDefinition> s
                                              unsigned int type,
                                              std::shared_ptr<Variant> T,
                                              std::shared_ptr<const mpcd::detail::SlitGeometry> geom)
-    : mpcd::VirtualParticleFiller(sysdef, density, type, T), m_geom(geom)
+    : mpcd::VirtualParticleFiller(sysdef, density, type, T), m_geom(geom), m_z_min(0), m_z_max(0),
+      m_N_lo(0), m_N_hi(0)
     {
     m_exec_conf->msg->notice(5) << "Constructing MPCD SlitGeometryFiller" << std::endl;
     }
@@ -45,6 +46,12 @@ void mpcd::SlitGeometryFiller::computeNumFill()
     const Scalar A = L.x * L.y;
     const Scalar H = m_geom->getH();
 
+    // cache the old fill bounds to detect changes to the fill volume
+    const Scalar old_z_min = m_z_min;
+    const Scalar old_z_max = m_z_max;
+    const unsigned int old_N_lo = m_N_lo;
+    const unsigned int old_N_hi = m_N_hi;
+
     // default is not to fill anything
     m_z_min = -H;
     m_z_max = H;
@@ -71,6 +78,12 @@ void mpcd::SlitGeometryFiller::computeNumFill()
 
     // total number of fill particles
     m_N_fill = m_N_hi + m_N_lo;
+
+    // any change to the fill slabs moves the particle positions, so force a full redraw
+    if (m_z_min != old_z_min || m_z_max != old_z_max || m_N_lo != old_N_lo || m_N_hi != old_N_hi)
+        {
+        invalidateRefill();
+        }
     }
 
 /*!
@@ -136,6 +149,52 @@ void mpcd::SlitGeometryFiller::drawParticles(uint64_t timestep)
         }
     }
 
+/*!
+ * \param timestep Current timestep to refresh particle velocities
+ *
+ * The positions and tags of the persistent fill population are kept, and only the
+ * velocities are redrawn from the thermal distribution. The fill region for each
+ * particle is recovered from its tag so that the refresh is insensitive to any
+ * reordering of the virtual particles by the sorter.
+ */
+void mpcd::SlitGeometryFiller::refillParticles(uint64_t timestep)
+    {
+    ArrayHandle<Scalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                               access_location::host,
+                               access_mode::readwrite);
+    ArrayHandle<unsigned int> h_tag(m_mpcd_pdata->getTags(),
+                                    access_location::host,
+                                    access_mode::read);
+
+    const Scalar vel_factor = fast::sqrt((*m_T)(timestep) / m_mpcd_pdata->getMass());
+
+    uint16_t seed = m_sysdef->getSeed();
+
+    // index to start refilling from
+    const unsigned int first_idx = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual() - m_N_fill;
+    for (unsigned int i = 0; i < m_N_fill; ++i)
+        {
+        const unsigned int pidx = first_idx + i;
+        const unsigned int tag = h_tag.data[pidx];
+        hoomd::RandomGenerator rng(
+            hoomd::Seed(hoomd::RNGIdentifier::SlitGeometryFiller, timestep, seed),
+            hoomd::Counter(tag));
+
+        // recover the fill region from the tag to pick the sign of the wall velocity
+        const unsigned int fill_id = tag - m_first_tag;
+        const signed char sign = (char)((fill_id >= m_N_lo) - (fill_id < m_N_lo));
+
+        hoomd::NormalDistribution<Scalar> gen(vel_factor, 0.0);
+        Scalar3 vel;
+        gen(vel.x, vel.y, rng);
+        vel.z = gen(rng);
+        h_vel.data[pidx] = make_scalar4(vel.x + sign * m_geom->getVelocity(),
+                                        vel.y,
+                                        vel.z,
+                                        __int_as_scalar(mpcd::detail::NO_CELL));
+        }
+    }
+
 /*!
  * \param m Python module to export to
  */
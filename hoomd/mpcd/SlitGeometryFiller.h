@@ -41,6 +41,7 @@ class PYBIND11_EXPORT SlitGeometryFiller : public mpcd::VirtualParticleFiller
     void setGeometry(std::shared_ptr<const mpcd::detail::SlitGeometry> geom)
         {
         m_geom = geom;
+        invalidateRefill();
         }
 
     protected:
@@ -55,6 +56,9 @@ class PYBIND11_EXPORT SlitGeometryFiller : public mpcd::VirtualParticleFiller
 
     //! Draw particles within the fill volume
     virtual void drawParticles(uint64_t timestep);
+
+    //! Refresh the velocities of a persistent fill population
+    virtual void refillParticles(uint64_t timestep);
     };
 
 namespace detail
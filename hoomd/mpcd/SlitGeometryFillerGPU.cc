@@ -22,7 +22,10 @@ mpcd::SlitGeometryFillerGPU::SlitGeometryFillerGPU(
     m_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
                                    m_exec_conf,
                                    "mpcd_slit_filler"));
-    m_autotuners.push_back(m_tuner);
+    m_tuner_refill.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                          m_exec_conf,
+                                          "mpcd_slit_refill"));
+    m_autotuners.insert(m_autotuners.end(), {m_tuner, m_tuner_refill});
     }
 
 /*!
@@ -67,6 +70,40 @@ void mpcd::SlitGeometryFillerGPU::drawParticles(uint64_t timestep)
     m_tuner->end();
     }
 
+/*!
+ * \param timestep Current timestep
+ */
+void mpcd::SlitGeometryFillerGPU::refillParticles(uint64_t timestep)
+    {
+    ArrayHandle<Scalar4> d_vel(m_mpcd_pdata->getVelocities(),
+                               access_location::device,
+                               access_mode::readwrite);
+    ArrayHandle<unsigned int> d_tag(m_mpcd_pdata->getTags(),
+                                    access_location::device,
+                                    access_mode::read);
+
+    const unsigned int first_idx = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual() - m_N_fill;
+
+    uint16_t seed = m_sysdef->getSeed();
+
+    m_tuner_refill->begin();
+    mpcd::gpu::slit_refill_velocities(d_vel.data,
+                                      d_tag.data,
+                                      *m_geom,
+                                      m_mpcd_pdata->getMass(),
+                                      m_N_lo,
+                                      m_N_hi,
+                                      m_first_tag,
+                                      first_idx,
+                                      (*m_T)(timestep),
+                                      timestep,
+                                      seed,
+                                      m_tuner_refill->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner_refill->end();
+    }
+
 /*!
  * \param m Python module to export to
  */
@@ -103,6 +103,61 @@ __global__ void slit_draw_particles(Scalar4* d_pos,
                                vel.z,
                                __int_as_scalar(mpcd::detail::NO_CELL));
     }
+
+/*!
+ * \param d_vel Particle velocities
+ * \param d_tag Particle tags
+ * \param geom Slit geometry to fill
+ * \param N_lo Number of particles in the lower region
+ * \param N_tot Total number of fill particles
+ * \param first_tag First tag of filled particles
+ * \param first_idx First (local) particle index of filled particles
+ * \param vel_factor Scale factor for uniform normal velocities consistent with particle mass /
+ * temperature \param timestep Current timestep \param seed User seed to PRNG for drawing velocities
+ *
+ * \b Implementation:
+ *
+ * Using one thread per particle, only the velocity of the persistent fill particle is redrawn
+ * from the thermal distribution. The fill region is recovered from the tag stored in the array
+ * so that the refresh is insensitive to any reordering of the virtual particles.
+ */
+__global__ void slit_refill_velocities(Scalar4* d_vel,
+                                       const unsigned int* d_tag,
+                                       const mpcd::detail::SlitGeometry geom,
+                                       const unsigned int N_lo,
+                                       const unsigned int N_tot,
+                                       const unsigned int first_tag,
+                                       const unsigned int first_idx,
+                                       const Scalar vel_factor,
+                                       const uint64_t timestep,
+                                       const uint16_t seed)
+    {
+    // one thread per particle
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N_tot)
+        return;
+
+    const unsigned int pidx = first_idx + idx;
+    const unsigned int tag = d_tag[pidx];
+
+    // recover the fill region from the tag to pick the sign of the wall velocity
+    const unsigned int fill_id = tag - first_tag;
+    const signed char sign = (fill_id >= N_lo) - (fill_id < N_lo);
+
+    // initialize random number generator for the velocity
+    hoomd::RandomGenerator rng(
+        hoomd::Seed(hoomd::RNGIdentifier::SlitGeometryFiller, timestep, seed),
+        hoomd::Counter(tag));
+
+    hoomd::NormalDistribution<Scalar> gen(vel_factor, 0.0);
+    Scalar3 vel;
+    gen(vel.x, vel.y, rng);
+    vel.z = gen(rng);
+    d_vel[pidx] = make_scalar4(vel.x + sign * geom.getVelocity(),
+                               vel.y,
+                               vel.z,
+                               __int_as_scalar(mpcd::detail::NO_CELL));
+    }
     } // end namespace kernel
 
 /*!
@@ -177,6 +232,63 @@ cudaError_t slit_draw_particles(Scalar4* d_pos,
     return cudaSuccess;
     }
 
+/*!
+ * \param d_vel Particle velocities
+ * \param d_tag Particle tags
+ * \param geom Slit geometry to fill
+ * \param mass Mass of fill particles
+ * \param N_lo Number of particles in the lower region
+ * \param N_hi Number of particles in the upper region
+ * \param first_tag First tag of filled particles
+ * \param first_idx First (local) particle index of filled particles
+ * \param kT Temperature for fill particles
+ * \param timestep Current timestep
+ * \param seed User seed to PRNG for drawing velocities
+ * \param block_size Number of threads per block
+ *
+ * \sa kernel::slit_refill_velocities
+ */
+cudaError_t slit_refill_velocities(Scalar4* d_vel,
+                                   const unsigned int* d_tag,
+                                   const mpcd::detail::SlitGeometry& geom,
+                                   const Scalar mass,
+                                   const unsigned int N_lo,
+                                   const unsigned int N_hi,
+                                   const unsigned int first_tag,
+                                   const unsigned int first_idx,
+                                   const Scalar kT,
+                                   const uint64_t timestep,
+                                   const uint16_t seed,
+                                   const unsigned int block_size)
+    {
+    const unsigned int N_tot = N_lo + N_hi;
+    if (N_tot == 0)
+        return cudaSuccess;
+
+    unsigned int max_block_size;
+    cudaFuncAttributes attr;
+    cudaFuncGetAttributes(&attr, (const void*)kernel::slit_refill_velocities);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    // precompute factor for rescaling the velocities since it is the same for all particles
+    const Scalar vel_factor = fast::sqrt(kT / mass);
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid(N_tot / run_block_size + 1);
+    kernel::slit_refill_velocities<<<grid, run_block_size>>>(d_vel,
+                                                             d_tag,
+                                                             geom,
+                                                             N_lo,
+                                                             N_tot,
+                                                             first_tag,
+                                                             first_idx,
+                                                             vel_factor,
+                                                             timestep,
+                                                             seed);
+
+    return cudaSuccess;
+    }
+
     } // end namespace gpu
     } // end namespace mpcd
     } // end namespace hoomd
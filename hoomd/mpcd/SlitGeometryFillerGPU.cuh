@@ -40,6 +40,20 @@ cudaError_t slit_draw_particles(Scalar4* d_pos,
                                 const uint16_t seed,
                                 const unsigned int block_size);
 
+//! Refresh the velocities of persistent virtual particles in the SlitGeometry
+cudaError_t slit_refill_velocities(Scalar4* d_vel,
+                                   const unsigned int* d_tag,
+                                   const mpcd::detail::SlitGeometry& geom,
+                                   const Scalar mass,
+                                   const unsigned int N_lo,
+                                   const unsigned int N_hi,
+                                   const unsigned int first_tag,
+                                   const unsigned int first_idx,
+                                   const Scalar kT,
+                                   const uint64_t timestep,
+                                   const uint16_t seed,
+                                   const unsigned int block_size);
+
     }  // end namespace gpu
     }  // end namespace mpcd
     }  // end namespace hoomd
@@ -139,6 +139,9 @@ void mpcd::SlitPoreGeometryFiller::computeNumFill()
     // size is now updated, cache the cell dimensions used
     m_needs_recompute = false;
     m_recompute_cache = make_scalar3(cell_size, max_shift, m_density);
+
+    // the fill boxes have been regenerated, so the particle positions need a full redraw
+    invalidateRefill();
     }
 
 /*!
@@ -213,6 +216,48 @@ void mpcd::SlitPoreGeometryFiller::drawParticles(uint64_t timestep)
         }
     }
 
+/*!
+ * \param timestep Current timestep to refresh particle velocities
+ *
+ * The positions and tags of the persistent fill population are kept, and only the
+ * velocities are redrawn from the thermal distribution keyed on the particle tags,
+ * so the refresh is insensitive to any reordering of the virtual particles.
+ */
+void mpcd::SlitPoreGeometryFiller::refillParticles(uint64_t timestep)
+    {
+    // quit early if not filling to ensure we don't access any memory that hasn't been set
+    if (m_N_fill == 0)
+        return;
+
+    ArrayHandle<Scalar4> h_vel(m_mpcd_pdata->getVelocities(),
+                               access_location::host,
+                               access_mode::readwrite);
+    ArrayHandle<unsigned int> h_tag(m_mpcd_pdata->getTags(),
+                                    access_location::host,
+                                    access_mode::read);
+    const Scalar vel_factor = fast::sqrt((*m_T)(timestep) / m_mpcd_pdata->getMass());
+
+    uint16_t seed = m_sysdef->getSeed();
+
+    // index to start refilling from
+    const unsigned int first_idx = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual() - m_N_fill;
+    for (unsigned int i = 0; i < m_N_fill; ++i)
+        {
+        const unsigned int pidx = first_idx + i;
+        const unsigned int tag = h_tag.data[pidx];
+        hoomd::RandomGenerator rng(
+            hoomd::Seed(hoomd::RNGIdentifier::SlitPoreGeometryFiller, timestep, seed),
+            hoomd::Counter(tag));
+
+        hoomd::NormalDistribution<Scalar> gen(vel_factor, 0.0);
+        Scalar3 vel;
+        gen(vel.x, vel.y, rng);
+        vel.z = gen(rng);
+        h_vel.data[pidx]
+            = make_scalar4(vel.x, vel.y, vel.z, __int_as_scalar(mpcd::detail::NO_CELL));
+        }
+    }
+
 /*!
  * \param m Python module to export to
  */
@@ -43,6 +43,7 @@ class PYBIND11_EXPORT SlitPoreGeometryFiller : public mpcd::VirtualParticleFille
         {
         m_geom = geom;
         notifyRecompute();
+        invalidateRefill();
         }
 
     protected:
@@ -59,6 +60,9 @@ class PYBIND11_EXPORT SlitPoreGeometryFiller : public mpcd::VirtualParticleFille
     //! Draw particles within the fill volume
     virtual void drawParticles(uint64_t timestep);
 
+    //! Refresh the velocities of a persistent fill population
+    virtual void refillParticles(uint64_t timestep);
+
     private:
     bool m_needs_recompute;
     Scalar3 m_recompute_cache;
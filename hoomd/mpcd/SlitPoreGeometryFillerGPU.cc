@@ -23,7 +23,10 @@ mpcd::SlitPoreGeometryFillerGPU::SlitPoreGeometryFillerGPU(
     m_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
                                    m_exec_conf,
                                    "mpcd_slit_filler"));
-    m_autotuners.push_back(m_tuner);
+    m_tuner_refill.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                          m_exec_conf,
+                                          "mpcd_slit_pore_refill"));
+    m_autotuners.insert(m_autotuners.end(), {m_tuner, m_tuner_refill});
     }
 
 /*!
@@ -71,6 +74,40 @@ void mpcd::SlitPoreGeometryFillerGPU::drawParticles(uint64_t timestep)
     m_tuner->end();
     }
 
+/*!
+ * \param timestep Current timestep
+ */
+void mpcd::SlitPoreGeometryFillerGPU::refillParticles(uint64_t timestep)
+    {
+    if (m_N_fill == 0)
+        return;
+
+    ArrayHandle<Scalar4> d_vel(m_mpcd_pdata->getVelocities(),
+                               access_location::device,
+                               access_mode::readwrite);
+    ArrayHandle<unsigned int> d_tag(m_mpcd_pdata->getTags(),
+                                    access_location::device,
+                                    access_mode::read);
+
+    const unsigned int first_idx = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual() - m_N_fill;
+
+    uint16_t seed = m_sysdef->getSeed();
+
+    m_tuner_refill->begin();
+    mpcd::gpu::slit_pore_refill_velocities(d_vel.data,
+                                           d_tag.data,
+                                           m_N_fill,
+                                           m_mpcd_pdata->getMass(),
+                                           first_idx,
+                                           (*m_T)(timestep),
+                                           timestep,
+                                           seed,
+                                           m_tuner_refill->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner_refill->end();
+    }
+
 /*!
  * \param m Python module to export to
  */
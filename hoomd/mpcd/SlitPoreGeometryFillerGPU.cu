@@ -115,6 +115,48 @@ __global__ void slit_pore_draw_particles(Scalar4* d_pos,
     // reference?)
     d_vel[pidx] = make_scalar4(vel.x, vel.y, vel.z, __int_as_scalar(mpcd::detail::NO_CELL));
     }
+
+/*!
+ * \param d_vel Particle velocities
+ * \param d_tag Particle tags
+ * \param N_tot Total number of fill particles
+ * \param first_idx First (local) particle index of filled particles
+ * \param vel_factor Scale factor for uniform normal velocities consistent with particle mass /
+ * temperature \param timestep Current timestep \param seed User seed to PRNG for drawing velocities
+ *
+ * \b Implementation:
+ *
+ * Using one thread per particle, only the velocity of the persistent fill particle is redrawn
+ * from the thermal distribution. The random stream is keyed on the tag stored in the array so
+ * that the refresh is insensitive to any reordering of the virtual particles.
+ */
+__global__ void slit_pore_refill_velocities(Scalar4* d_vel,
+                                            const unsigned int* d_tag,
+                                            const unsigned int N_tot,
+                                            const unsigned int first_idx,
+                                            const Scalar vel_factor,
+                                            const uint64_t timestep,
+                                            const uint16_t seed)
+    {
+    // one thread per particle
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N_tot)
+        return;
+
+    const unsigned int pidx = first_idx + idx;
+    const unsigned int tag = d_tag[pidx];
+
+    // initialize random number generator for the velocity
+    hoomd::RandomGenerator rng(
+        hoomd::Seed(hoomd::RNGIdentifier::SlitPoreGeometryFiller, timestep, seed),
+        hoomd::Counter(tag));
+
+    hoomd::NormalDistribution<Scalar> gen(vel_factor, 0.0);
+    Scalar3 vel;
+    gen(vel.x, vel.y, rng);
+    vel.z = gen(rng);
+    d_vel[pidx] = make_scalar4(vel.x, vel.y, vel.z, __int_as_scalar(mpcd::detail::NO_CELL));
+    }
     } // end namespace kernel
 
 /*!
@@ -186,6 +228,53 @@ cudaError_t slit_pore_draw_particles(Scalar4* d_pos,
     return cudaSuccess;
     }
 
+/*!
+ * \param d_vel Particle velocities
+ * \param d_tag Particle tags
+ * \param N_tot Total number of fill particles
+ * \param mass Mass of fill particles
+ * \param first_idx First (local) particle index of filled particles
+ * \param kT Temperature for fill particles
+ * \param timestep Current timestep
+ * \param seed User seed to PRNG for drawing velocities
+ * \param block_size Number of threads per block
+ *
+ * \sa kernel::slit_pore_refill_velocities
+ */
+cudaError_t slit_pore_refill_velocities(Scalar4* d_vel,
+                                        const unsigned int* d_tag,
+                                        const unsigned int N_tot,
+                                        const Scalar mass,
+                                        const unsigned int first_idx,
+                                        const Scalar kT,
+                                        const uint64_t timestep,
+                                        const uint16_t seed,
+                                        const unsigned int block_size)
+    {
+    if (N_tot == 0)
+        return cudaSuccess;
+
+    unsigned int max_block_size;
+    cudaFuncAttributes attr;
+    cudaFuncGetAttributes(&attr, (const void*)kernel::slit_pore_refill_velocities);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    // precompute factor for rescaling the velocities since it is the same for all particles
+    const Scalar vel_factor = fast::sqrt(kT / mass);
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid(N_tot / run_block_size + 1);
+    kernel::slit_pore_refill_velocities<<<grid, run_block_size>>>(d_vel,
+                                                                  d_tag,
+                                                                  N_tot,
+                                                                  first_idx,
+                                                                  vel_factor,
+                                                                  timestep,
+                                                                  seed);
+
+    return cudaSuccess;
+    }
+
     } // end namespace gpu
     } // end namespace mpcd
     } // end namespace hoomd
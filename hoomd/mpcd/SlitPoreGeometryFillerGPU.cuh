@@ -39,6 +39,17 @@ cudaError_t slit_pore_draw_particles(Scalar4* d_pos,
                                      const uint16_t seed,
                                      const unsigned int block_size);
 
+//! Refresh the velocities of persistent virtual particles in the SlitPoreGeometry
+cudaError_t slit_pore_refill_velocities(Scalar4* d_vel,
+                                        const unsigned int* d_tag,
+                                        const unsigned int N_tot,
+                                        const Scalar mass,
+                                        const unsigned int first_idx,
+                                        const Scalar kT,
+                                        const uint64_t timestep,
+                                        const uint16_t seed,
+                                        const unsigned int block_size);
+
     }  // end namespace gpu
     }  // end namespace mpcd
     }  // end namespace hoomd
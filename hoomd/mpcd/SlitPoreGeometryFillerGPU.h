@@ -37,8 +37,12 @@ class PYBIND11_EXPORT SlitPoreGeometryFillerGPU : public mpcd::SlitPoreGeometryF
     //! Draw particles within the fill volume on the GPU
     virtual void drawParticles(uint64_t timestep);
 
+    //! Refresh the velocities of a persistent fill population on the GPU
+    virtual void refillParticles(uint64_t timestep);
+
     private:
-    std::shared_ptr<hoomd::Autotuner<1>> m_tuner; //!< Autotuner for drawing particles
+    std::shared_ptr<hoomd::Autotuner<1>> m_tuner;        //!< Autotuner for drawing particles
+    std::shared_ptr<hoomd::Autotuner<1>> m_tuner_refill; //!< Autotuner for refilling velocities
     };
 
 namespace detail
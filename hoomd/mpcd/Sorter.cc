@@ -40,6 +40,18 @@ void mpcd::Sorter::update(uint64_t timestep)
     if (!shouldSort(timestep))
         return;
 
+    forceSort(timestep);
+    }
+
+/*!
+ * \param timestep Current simulation timestep
+ *
+ * Sorts the particle data immediately, bypassing the period check. This is used by the
+ * mpcd::Integrator to synchronize sorting with the collision cadence, where the cell list
+ * computed for the sort is remapped in place and reused directly by the collision step.
+ */
+void mpcd::Sorter::forceSort(uint64_t timestep)
+    {
     if (!m_cl)
         {
         throw std::runtime_error("Cell list has not been set");
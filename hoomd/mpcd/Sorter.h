@@ -52,6 +52,9 @@ class PYBIND11_EXPORT Sorter : public Autotuned
     //! Update the particle data order
     virtual void update(uint64_t timestep);
 
+    //! Sort the particle data now, regardless of the sorting period
+    void forceSort(uint64_t timestep);
+
     bool peekSort(uint64_t timestep) const;
 
     //! Change the period
@@ -16,7 +16,8 @@ mpcd::VirtualParticleFiller::VirtualParticleFiller(std::shared_ptr<SystemDefinit
                                                    std::shared_ptr<Variant> T)
     : m_sysdef(sysdef), m_pdata(m_sysdef->getParticleData()), m_exec_conf(m_pdata->getExecConf()),
       m_mpcd_pdata(m_sysdef->getMPCDParticleData()), m_density(density), m_type(type), m_T(T),
-      m_N_fill(0), m_first_tag(0)
+      m_N_fill(0), m_first_tag(0), m_persistent(false), m_refill_valid(false), m_last_N_fill(0),
+      m_last_first_tag(0), m_last_first_idx(0)
     {
     }
 
@@ -51,8 +52,27 @@ void mpcd::VirtualParticleFiller::fill(uint64_t timestep)
     // add the new virtual particles locally
     m_mpcd_pdata->addVirtualParticles(m_N_fill);
 
-    // draw the particles consistent with those tags
-    drawParticles(timestep);
+    /*
+     * In persistent mode, the population from the previous fill is still resident in the
+     * arrays because removing virtual particles only resets the counter without touching the
+     * data. When the number of particles, the tag range, and the index range all line up with
+     * the last fill, only the velocities need to be refreshed. Otherwise (or on the first
+     * fill), draw the complete population.
+     */
+    const unsigned int first_idx = m_mpcd_pdata->getN() + m_mpcd_pdata->getNVirtual() - m_N_fill;
+    if (m_persistent && m_refill_valid && m_N_fill == m_last_N_fill
+        && m_first_tag == m_last_first_tag && first_idx == m_last_first_idx)
+        {
+        refillParticles(timestep);
+        }
+    else
+        {
+        drawParticles(timestep);
+        }
+    m_last_N_fill = m_N_fill;
+    m_last_first_tag = m_first_tag;
+    m_last_first_idx = first_idx;
+    m_refill_valid = true;
 
     m_mpcd_pdata->invalidateCellCache();
     }
@@ -65,6 +85,7 @@ void mpcd::VirtualParticleFiller::setDensity(Scalar density)
         throw std::runtime_error("Invalid virtual particle density");
         }
     m_density = density;
+    invalidateRefill();
     }
 
 void mpcd::VirtualParticleFiller::setType(unsigned int type)
@@ -76,6 +97,7 @@ void mpcd::VirtualParticleFiller::setType(unsigned int type)
         throw std::runtime_error("Invalid type id");
         }
     m_type = type;
+    invalidateRefill();
     }
 
 /*!
@@ -92,7 +114,8 @@ void mpcd::detail::export_VirtualParticleFiller(pybind11::module& m)
                             std::shared_ptr<Variant>>())
         .def("setDensity", &mpcd::VirtualParticleFiller::setDensity)
         .def("setType", &mpcd::VirtualParticleFiller::setType)
-        .def("setTemperature", &mpcd::VirtualParticleFiller::setTemperature);
+        .def("setTemperature", &mpcd::VirtualParticleFiller::setTemperature)
+        .def("setPersistent", &mpcd::VirtualParticleFiller::setPersistent);
     }
 
     } // end namespace hoomd
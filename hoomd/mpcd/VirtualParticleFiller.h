@@ -59,6 +59,28 @@ class PYBIND11_EXPORT VirtualParticleFiller : public Autotuned
         m_T = T;
         }
 
+    //! Set whether the fill population persists between fills
+    /*!
+     * \param persistent If true, keep the fill population between fills
+     *
+     * In persistent mode, the positions and tags of the virtual particles are kept from the
+     * previous fill whenever the fill volume and particle layout are unchanged, and only the
+     * velocities are redrawn from the thermal distribution. This eliminates the cost of
+     * regenerating the full population every collision at the expense of reusing the same
+     * random positions. Any change to the fill volume, density, type, or local particle
+     * count falls back on a complete redraw.
+     */
+    void setPersistent(bool persistent)
+        {
+        m_persistent = persistent;
+        }
+
+    //! Get whether the fill population persists between fills
+    bool getPersistent() const
+        {
+        return m_persistent;
+        }
+
     //! Set the cell list used for filling
     virtual void setCellList(std::shared_ptr<mpcd::CellList> cl)
         {
@@ -84,6 +106,31 @@ class PYBIND11_EXPORT VirtualParticleFiller : public Autotuned
 
     //! Draw particles within the fill volume
     virtual void drawParticles(uint64_t timestep) { }
+
+    //! Refresh the velocities of a persistent fill population
+    /*!
+     * Deriving classes may override this method to redraw only the velocities of the
+     * particles kept from the previous fill, keyed on the tags stored in the arrays so
+     * that the refresh is insensitive to particle sorting. The default falls back on a
+     * complete redraw.
+     */
+    virtual void refillParticles(uint64_t timestep)
+        {
+        drawParticles(timestep);
+        }
+
+    //! Mark the cached fill population as unusable for the next fill
+    void invalidateRefill()
+        {
+        m_refill_valid = false;
+        }
+
+    private:
+    bool m_persistent;             //!< If true, keep the fill population between fills
+    bool m_refill_valid;           //!< If true, the cached fill population can be refreshed
+    unsigned int m_last_N_fill;    //!< Number of particles added by the last fill
+    unsigned int m_last_first_tag; //!< First tag of the last fill
+    unsigned int m_last_first_idx; //!< First particle index of the last fill
     };
 
 namespace detail
@@ -242,13 +242,15 @@ class integrator():
 
         sorter = hoomd.context.current.mpcd.sorter
         if sorter is not None and sorter.enabled:
-            if collide is not None and (sorter.period < collide.period
-                                        or sorter.period % collide.period != 0):
+            if (collide is not None and not sorter.on_collide
+                    and (sorter.period < collide.period
+                         or sorter.period % collide.period != 0)):
                 hoomd.context.current.device.cpp_msg.error(
                     'mpcd.integrate: sorting period should be a multiple of collision period\n'
                 )
                 raise ValueError(
                     'Sorting period must be multiple of collision period')
             self.cpp_integrator.setSorter(sorter._cpp)
+            self.cpp_integrator.setSortOnCollide(sorter.on_collide)
         else:
             self.cpp_integrator.removeSorter()
@@ -65,6 +65,7 @@ class sort():
 
         self.period = period
         self.enabled = True
+        self.on_collide = False
 
     def disable(self):
         self.enabled = False
@@ -93,6 +94,32 @@ class sort():
         self._cpp.setPeriod(hoomd.context.current.system.getCurrentTimeStep(),
                             self.period)
 
+    def set_on_collide(self, enable=True):
+        """ Sort at every collision step instead of on a fixed period.
+
+        Args:
+            enable (bool): If True, sort whenever a collision occurs.
+
+        When enabled, the sorting period is ignored and particles are put into
+        cell order at every collision step. The cell list built for the sort is
+        reused by the collision, so the collision kernels always stream through
+        cell-ordered data without extra cell list builds. This is most useful
+        for bandwidth-bound systems where performance degrades noticeably
+        between sorter invocations.
+
+        Examples::
+
+            sorter.set_on_collide()
+            sorter.set_on_collide(enable=False)
+
+        Note:
+            The mode takes effect the next time the integrator is updated,
+            which occurs automatically at the start of the next :py:func:`hoomd.run()`.
+
+        """
+
+        self.on_collide = enable
+
     def tune(self, start, stop, step, tsteps, quiet=False):
         """ Tune the sorting period.
 
@@ -407,6 +407,15 @@ class AutotunedObject(_HOOMDBaseObject):
         increase performance as the new system parameters may lead to different
         optimal parameters.
 
+    Note:
+        Tuned `kernel_parameters` persist across detach and re-attach: when an
+        operation is removed from a simulation and later added back, the
+        previously tuned values are restored. Workflows that alternate
+        operations (such as switching between integrators in multi-phase
+        protocols) therefore skip re-tuning on every switch. Call
+        `tune_kernel_parameters` to re-tune after a restore when the system
+        changed significantly between phases.
+
     Note:
         In MPI parallel execution, all methods and attributes of
         `AutotunedObject` reference the rank local tuner objects. Different
@@ -421,6 +430,32 @@ class AutotunedObject(_HOOMDBaseObject):
         * `hoomd.Operations.tune_kernel_parameters`
     """
 
+    def _attach(self, simulation):
+        first_attach = self._use_count == 0
+        super()._attach(simulation)
+        if not (first_attach and self._attached):
+            return
+        # Restore kernel parameters saved at the last detach so workflows that
+        # alternate operations (e.g. switching integrators between phases)
+        # warm-start the autotuners instead of re-tuning from scratch.
+        saved = getattr(self, '_saved_kernel_parameters', None)
+        if saved:
+            current = self._cpp_obj.getAutotunerParameters()
+            restored = {
+                key: value for key, value in saved.items() if key in current
+            }
+            if restored:
+                self._cpp_obj.setAutotunerParameters(restored)
+
+    def _detach(self, force=False):
+        if self._attached and self._use_count == 1:
+            try:
+                self._saved_kernel_parameters = (
+                    self._cpp_obj.getAutotunerParameters())
+            except AttributeError:
+                pass
+        return super()._detach(force)
+
     @property
     def kernel_parameters(self):
         """dict[str, tuple[float]]: Kernel parameters.
@@ -462,6 +497,42 @@ class AutotunedObject(_HOOMDBaseObject):
             raise hoomd.error.DataAccessError("is_tuning_complete")
         return self._cpp_obj.isAutotuningComplete()
 
+    @property
+    def kernel_statistics(self):
+        """dict[str, dict[str, float]]: Kernel timing statistics.
+
+        The dictionary maps GPU kernel names to dictionaries of timing
+        statistics in milliseconds. ``tuned_time`` is the center time of the
+        optimal parameters measured when tuning last completed. When
+        `measure_kernel_performance` is enabled, ``mean``, ``median``,
+        ``minimum``, and ``maximum`` summarize a rolling window of the
+        ``n_samples`` most recent kernel launches. Compare these to
+        ``tuned_time`` to flag kernels that have degraded relative to the
+        tuning baseline.
+        """
+        if not self._attached:
+            raise hoomd.error.DataAccessError("kernel_statistics")
+        return self._cpp_obj.getAutotunerStatistics()
+
+    @property
+    def measure_kernel_performance(self):
+        """bool: Measure kernel run times after tuning completes.
+
+        When ``True``, continue to time kernel launches after tuning completes
+        and retain a rolling window of recent measurements in
+        `kernel_statistics`. Defaults to ``False`` because each measurement
+        synchronizes the GPU and reduces performance.
+        """
+        return getattr(self, '_measure_kernel_performance', False)
+
+    @measure_kernel_performance.setter
+    def measure_kernel_performance(self, enable):
+        if not self._attached:
+            raise hoomd.error.DataAccessError("measure_kernel_performance")
+        self._measure_kernel_performance = bool(enable)
+        self._cpp_obj.setAutotunerMeasurementsEnabled(
+            self._measure_kernel_performance)
+
     def tune_kernel_parameters(self):
         """Start tuning kernel parameters.
 
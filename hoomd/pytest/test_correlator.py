@@ -0,0 +1,82 @@
+# Copyright (c) 2009-2023 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+from hoomd.conftest import logging_check
+from hoomd.logging import LoggerCategories
+import numpy as np
+import pytest
+
+
+@pytest.fixture(scope='function')
+def sim(simulation_factory, two_particle_snapshot_factory):
+    snapshot = two_particle_snapshot_factory()
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.velocity[:] = [[1.0, 0.0, 0.0], [0.0, -2.0, 0.0]]
+    return simulation_factory(snapshot)
+
+
+def test_attributes(sim):
+    correlator = hoomd.write.Correlator(trigger=hoomd.trigger.Periodic(1),
+                                        points_per_level=8,
+                                        max_levels=4)
+    assert correlator.points_per_level == 8
+    assert correlator.max_levels == 4
+
+    sim.operations.writers.append(correlator)
+    sim.run(0)
+    assert correlator.num_samples == 0
+
+
+def test_invalid_arguments(sim):
+    correlator = hoomd.write.Correlator(trigger=hoomd.trigger.Periodic(1),
+                                        points_per_level=3)
+    sim.operations.writers.append(correlator)
+    with pytest.raises(Exception):
+        sim.run(0)
+
+
+def test_accumulation(sim):
+    correlator = hoomd.write.Correlator(trigger=hoomd.trigger.Periodic(1))
+    sim.operations.writers.append(correlator)
+
+    sim.run(40)
+
+    if sim.device.communicator.rank == 0:
+        assert correlator.num_samples == 40
+        lag_times = correlator.lag_times
+        msd = correlator.msd
+        vacf = correlator.vacf
+        assert len(lag_times) == len(msd) == len(vacf)
+        assert lag_times[0] == 0.0
+        assert np.all(np.diff(lag_times) > 0)
+        # without an integrator the state is frozen: MSD is zero and the
+        # VACF equals <v^2> at every lag
+        v_sq = (1.0**2 + 2.0**2) / 2.0
+        np.testing.assert_allclose(msd, np.zeros(len(msd)), atol=1e-12)
+        np.testing.assert_allclose(vacf, np.full(len(vacf), v_sq), rtol=1e-5)
+
+    correlator.reset()
+    assert correlator.num_samples == 0
+
+
+def test_logging():
+    logging_check(
+        hoomd.write.Correlator, ('write',), {
+            'lag_times': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'msd': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'vacf': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'num_samples': {
+                'category': LoggerCategories.scalar,
+                'default': True
+            }
+        })
@@ -103,6 +103,51 @@ def test_cpu_build_specifics():
     assert type(hoomd.device.auto_select()) == hoomd.device.CPU
 
 
+def test_memory_tracking(device, simulation_factory, lattice_snapshot_factory):
+    # the budget is off by default and settable
+    assert device.memory_budget == 0
+    device.memory_budget = 1024**4
+    assert device.memory_budget == 1024**4
+    device.memory_budget = 0
+
+    # a simulation registers tagged allocations in the usage report
+    sim = simulation_factory(lattice_snapshot_factory(n=4))
+    sim.run(0)
+
+    usage = device.memory_usage
+    assert type(usage) is list
+    assert len(usage) > 0
+    tags = [tag for tag, n_bytes in usage]
+    assert 'm_pos' in tags
+    for tag, n_bytes in usage:
+        assert n_bytes > 0
+
+
+def test_allocation_tracing(device, simulation_factory,
+                            lattice_snapshot_factory):
+    assert not device.allocation_tracing
+
+    sim = simulation_factory(lattice_snapshot_factory(n=4))
+
+    # allocations made while tracing is off are not recorded
+    sim.run(0)
+    device.allocation_tracing = True
+    assert device.allocation_tracing
+    assert device.allocation_trace == []
+
+    # tracing records subsequent allocations with their owning tag
+    sim2 = simulation_factory(lattice_snapshot_factory(n=4))
+    sim2.run(0)
+    trace = device.allocation_trace
+    device.allocation_tracing = False
+    assert len(trace) > 0
+    tags = [tag for tag, kind, n_bytes in trace]
+    assert 'm_pos' in tags
+    for tag, kind, n_bytes in trace:
+        assert kind in ('host', 'device', 'managed')
+        assert n_bytes > 0
+
+
 def test_device_notice(device, tmp_path):
     # Message file declared. Should output in specified file.
     device.notice_level = 4
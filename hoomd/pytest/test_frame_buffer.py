@@ -0,0 +1,53 @@
+# Copyright (c) 2009-2023 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+import numpy as np
+import pytest
+
+
+@pytest.fixture(scope='function')
+def sim(simulation_factory, two_particle_snapshot_factory):
+    return simulation_factory(two_particle_snapshot_factory())
+
+
+def test_attributes():
+    buffer = hoomd.write.FrameBuffer(trigger=hoomd.trigger.Periodic(1),
+                                     max_frames=5)
+    assert buffer.max_frames == 5
+    assert len(buffer) == 0
+
+
+def test_capture_and_eviction(sim):
+    buffer = hoomd.write.FrameBuffer(trigger=hoomd.trigger.Periodic(1),
+                                     max_frames=3)
+    sim.operations.writers.append(buffer)
+
+    sim.run(2)
+    assert len(buffer) == 2
+
+    # the buffer keeps only the last max_frames frames
+    sim.run(4)
+    assert len(buffer) == 3
+    timesteps = [frame.timestep for frame in buffer]
+    assert timesteps == [4, 5, 6]
+
+    buffer.clear()
+    assert len(buffer) == 0
+
+
+def test_frame_contents(sim):
+    buffer = hoomd.write.FrameBuffer(trigger=hoomd.trigger.Periodic(1))
+    sim.operations.writers.append(buffer)
+    sim.run(1)
+
+    frame = buffer[-1]
+    assert frame.timestep == 1
+    assert frame.box == sim.state.box
+    if sim.device.communicator.rank == 0:
+        snapshot = sim.state.get_snapshot()
+        np.testing.assert_allclose(frame.particles.position,
+                                   snapshot.particles.position)
+
+    with pytest.raises(IndexError):
+        buffer[len(buffer)]
@@ -507,6 +507,15 @@ class TestLocalSnapshots:
                 with pytest.raises(RuntimeError):
                     sim.state.set_snapshot(base_snapshot)
 
+    def test_read_only_snapshot(self, base_simulation):
+        """Ensure the read-only snapshot view exposes read-only arrays."""
+        sim = base_simulation()
+        with sim.state.cpu_local_snapshot_read_only as data:
+            assert data.particles.position.read_only
+            assert data.bonds.typeid.read_only
+            with pytest.raises(ValueError):
+                data.particles.position[:] = 0
+
     @pytest.fixture
     def base_simulation(self, simulation_factory, base_snapshot):
         """Creates the simulation from the base_snapshot."""
@@ -0,0 +1,94 @@
+# Copyright (c) 2009-2023 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+from hoomd.conftest import logging_check
+from hoomd.logging import LoggerCategories
+import numpy as np
+import pytest
+
+
+def test_attributes(simulation_factory, two_particle_snapshot_factory):
+    sim = simulation_factory(two_particle_snapshot_factory())
+    rdf = hoomd.write.RDF(trigger=hoomd.trigger.Periodic(1),
+                          bins=50,
+                          r_max=3.0)
+    assert rdf.bins == 50
+    assert rdf.r_max == 3.0
+
+    sim.operations.writers.append(rdf)
+    sim.run(0)
+    assert rdf.num_samples == 0
+
+
+def test_invalid_arguments(simulation_factory, two_particle_snapshot_factory):
+    sim = simulation_factory(two_particle_snapshot_factory())
+    rdf = hoomd.write.RDF(trigger=hoomd.trigger.Periodic(1),
+                          bins=50,
+                          r_max=-1.0)
+    sim.operations.writers.append(rdf)
+    with pytest.raises(Exception):
+        sim.run(0)
+
+
+def test_accumulation(simulation_factory, two_particle_snapshot_factory):
+    # two particles at separation d=1: every count lands in the bin at r=1
+    sim = simulation_factory(two_particle_snapshot_factory(d=1.0, L=20))
+    rdf = hoomd.write.RDF(trigger=hoomd.trigger.Periodic(1),
+                          bins=20,
+                          r_max=2.0)
+    sim.operations.writers.append(rdf)
+
+    sim.run(10)
+
+    if sim.device.communicator.rank == 0:
+        assert rdf.num_samples == 10
+        bin_centers = rdf.bin_centers
+        g_r = rdf.rdf
+        assert len(bin_centers) == len(g_r) == 20
+        np.testing.assert_allclose(np.diff(bin_centers), 0.1)
+        nonzero = np.flatnonzero(g_r)
+        assert len(nonzero) == 1
+        assert np.isclose(bin_centers[nonzero[0]], 1.05)
+        # the accumulated ordered pair count in that bin is 2 per sample
+        dr = 0.1
+        r_in = nonzero[0] * dr
+        shell = 4.0 * np.pi / 3.0 * ((r_in + dr)**3 - r_in**3)
+        volume = 20.0**3
+        expected = 2.0 / (2.0 * 1.0 / volume * shell)
+        np.testing.assert_allclose(g_r[nonzero[0]], expected, rtol=1e-5)
+
+    rdf.reset()
+    assert rdf.num_samples == 0
+
+
+def test_structure_factor(simulation_factory, lattice_snapshot_factory):
+    sim = simulation_factory(lattice_snapshot_factory(n=5, a=1.0))
+    rdf = hoomd.write.RDF(trigger=hoomd.trigger.Periodic(1),
+                          bins=100,
+                          r_max=2.0)
+    sim.operations.writers.append(rdf)
+    sim.run(1)
+
+    k = np.linspace(0.5, 10.0, 20)
+    s_k = rdf.structure_factor(k)
+    assert s_k.shape == k.shape
+    assert np.all(np.isfinite(s_k))
+
+
+def test_logging():
+    logging_check(
+        hoomd.write.RDF, ('write',), {
+            'bin_centers': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'rdf': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'num_samples': {
+                'category': LoggerCategories.scalar,
+                'default': True
+            }
+        })
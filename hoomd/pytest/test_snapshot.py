@@ -535,3 +535,35 @@ def test_invalid_bond_typeids(
         group.N = 0
 
     simulation_factory(snap)
+
+
+def test_fill_lattice(s):
+    if s.communicator.rank == 0:
+        s.configuration.box = [4, 4, 4, 0, 0, 0]
+        s.fill_lattice(nx=4, ny=4, nz=4)
+        assert s.particles.N == 64
+        assert s.particles.types == ['A']
+        # one particle at the center of each unit cell
+        assert numpy.allclose(s.particles.position[0], [-1.5, -1.5, -1.5])
+        assert numpy.allclose(s.particles.position[-1], [1.5, 1.5, 1.5])
+        # all particles are in the box and unique
+        assert numpy.all(numpy.abs(s.particles.position) <= 2)
+        assert len(numpy.unique(s.particles.position, axis=0)) == 64
+
+
+def test_fill_random(s):
+    if s.communicator.rank == 0:
+        s.configuration.box = [10, 10, 10, 0, 0, 0]
+        s.fill_random(N=100, min_dist=0.5, seed=3)
+        assert s.particles.N == 100
+        assert s.particles.types == ['A']
+        assert numpy.all(numpy.abs(s.particles.position) <= 5)
+
+        # all pairwise minimum image distances respect min_dist
+        pos = s.particles.position[:]
+        for i in range(100):
+            dx = pos - pos[i]
+            dx -= 10 * numpy.round(dx / 10)
+            r = numpy.linalg.norm(dx, axis=1)
+            r[i] = numpy.inf
+            assert numpy.min(r) >= 0.5
@@ -37,6 +37,29 @@ def test_default_sorter(simulation_factory, two_particle_snapshot_factory):
     assert isinstance(sim.operations.tuners[0], hoomd.tune.ParticleSorter)
 
 
+def test_sort_by_type(simulation_factory, lattice_snapshot_factory):
+    """Test that sort_by_type orders particle types contiguously."""
+    sorter = hoomd.tune.ParticleSorter(trigger=hoomd.trigger.Periodic(1),
+                                       grid=1,
+                                       sort_by_type=True)
+    assert sorter.sort_by_type
+
+    snap = lattice_snapshot_factory(particle_types=['A', 'B'], n=4)
+    if snap.communicator.rank == 0:
+        snap.particles.typeid[::2] = 1
+
+    sim = simulation_factory(snap)
+    sim.operations.tuners.clear()
+    sim.operations.tuners.append(sorter)
+    sim.run(2)
+
+    # with a single grid bin the sort reduces to ordering by type id
+    with sim.state.cpu_local_snapshot as data:
+        typeid = data.particles.typeid
+        assert all(
+            typeid[i] <= typeid[i + 1] for i in range(len(typeid) - 1))
+
+
 def test_pickling(simulation_factory, two_particle_snapshot_factory):
     """Test pickling `hoomd.tune.ParticleSorter`."""
     sim = simulation_factory(two_particle_snapshot_factory())
@@ -124,6 +124,42 @@ def test_eval(trigger, eval_func):
         assert trigger(i) == eval_func(i)
 
 
+@pytest.mark.parametrize('trigger, eval_func',
+                         zip(triggers(), _eval_funcs),
+                         ids=_test_name)
+def test_next_step(trigger, eval_func):
+    for i in range(0, 2000, 13):
+        next_step = trigger.next_step(i)
+        # next_step is a lower bound: it must not skip over any active step
+        assert next_step >= i
+        for step in range(i, min(next_step, i + 100)):
+            assert not eval_func(step)
+
+
+def test_next_step_periodic():
+    trigger = hoomd.trigger.Periodic(456, 18)
+    for i in range(0, 2000, 13):
+        next_step = trigger.next_step(i)
+        # periodic triggers know their schedule exactly
+        assert (next_step - 18) % 456 == 0
+        assert all(not trigger(step) for step in range(i, next_step))
+        assert trigger(next_step)
+
+
+def test_next_step_composite():
+    # And takes the latest bound of its constituents, Or the earliest
+    and_trigger = hoomd.trigger.And(
+        [hoomd.trigger.Periodic(100),
+         hoomd.trigger.After(1000)])
+    assert and_trigger.next_step(5) == 1001
+    assert and_trigger.next_step(1001) == 1100
+    or_trigger = hoomd.trigger.Or(
+        [hoomd.trigger.Periodic(100),
+         hoomd.trigger.On(5000)])
+    assert or_trigger.next_step(5) == 100
+    assert or_trigger.next_step(4950) == 5000
+
+
 @pytest.mark.parametrize('trigger', triggers(), ids=_test_name)
 def test_pickling(trigger):
     pkled_trigger = pickle.loads(pickle.dumps(trigger))
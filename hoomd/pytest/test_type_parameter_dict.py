@@ -5,6 +5,8 @@ import itertools
 
 import pytest
 
+import hoomd
+
 from hoomd.conftest import BaseMappingTest, Either, pickling_check
 from hoomd.data.parameterdicts import TypeParameterDict
 from hoomd.pytest.dummy import DummyCppObj
@@ -327,3 +329,34 @@ class TestTypeParameterDictAttached(TestTypeParameterDict):
                 assert test_mapping[key] == {**test_mapping.default, **v}
             if isinstance(old_v, _HOOMDSyncedCollection):
                 assert old_v._isolated
+
+
+class TestTrustedData:
+    """Test hoomd.util.trust_validated_data skips validation."""
+
+    def make_collection(self):
+        return TypeParameterDict(foo=1, bar=identity, baz="hello", len_keys=1)
+
+    def test_setitem_skips_validation(self):
+        mapping = self.make_collection()
+        with hoomd.util.trust_validated_data():
+            # an int would fail validation against the dict specification
+            mapping["A"] = 42
+        assert mapping["A"] == 42
+
+    def test_attach_trusted(self):
+        mapping = self.make_collection()
+        blob = {"foo": 2, "bar": "world", "baz": "hi"}
+        with hoomd.util.trust_validated_data():
+            mapping["A"] = blob
+            mapping._attach(DummyCppObj(),
+                            param_name="type_param",
+                            types=("A",))
+        assert mapping["A"] == blob
+
+    def test_validation_restored(self):
+        mapping = self.make_collection()
+        with hoomd.util.trust_validated_data():
+            pass
+        with pytest.raises(TypeConversionError):
+            mapping["A"] = [1, 2]
@@ -188,7 +188,8 @@ class Simulation(metaclass=Loggable):
     def create_state_from_gsd(self,
                               filename,
                               frame=-1,
-                              domain_decomposition=(None, None, None)):
+                              domain_decomposition=(None, None, None),
+                              parallel_read=False):
         """Create the simulation state from a GSD file.
 
         Args:
@@ -205,6 +206,12 @@ class Simulation(metaclass=Loggable):
                 to include in each domain. The sum of each list of floats must
                 be 1.0 (e.g. ``([0.25, 0.75], [0.2, 0.8], [1.0])``).
 
+            parallel_read (bool): When `True`, each MPI rank reads only its
+                stripe of the large per-particle data chunks directly from the
+                file, greatly reducing the startup time of large checkpoints.
+                The file must be accessible from every rank (e.g. on a shared
+                parallel filesystem). Has no effect on a single rank.
+
         When `timestep` is `None` before calling, `create_state_from_gsd`
         sets `timestep` to the value in the selected GSD frame in the file.
 
@@ -228,7 +235,7 @@ class Simulation(metaclass=Loggable):
         filename = _hoomd.mpi_bcast_str(filename, self.device._cpp_exec_conf)
         # Grab snapshot and timestep
         reader = _hoomd.GSDReader(self.device._cpp_exec_conf, filename,
-                                  abs(frame), frame < 0)
+                                  abs(frame), frame < 0, parallel_read)
         snapshot = Snapshot._from_cpp_snapshot(reader.getSnapshot(),
                                                self.device.communicator)
 
@@ -407,6 +414,52 @@ class Simulation(metaclass=Loggable):
         else:
             return self._cpp_sys.walltime
 
+    @log(category='object')
+    def operation_times(self):
+        """dict: Wall time in seconds spent in the major subsystems.
+
+        The dictionary holds the cumulative wall time spent executing the
+        integrator (``'integrator'``), computing forces (``'forces'``),
+        building neighbor lists (``'neighbor_lists'``), and communicating
+        between MPI ranks (``'communication'``). All times accumulate over the
+        lifetime of the simulation, so rates may be obtained by differencing
+        consecutive log entries.
+
+        Note:
+            The categories overlap: the integrator time includes the time
+            spent computing forces, building neighbor lists, and most of the
+            communication time. On the GPU, kernel launches are asynchronous
+            and the force and neighbor list times cover the host side of the
+            computation only.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=simulation, quantities=['operation_times'])
+        """
+        if self._state is None:
+            return {}
+
+        times = {
+            'integrator': self._cpp_sys.integrator_time,
+            'forces': 0.0,
+            'neighbor_lists': 0.0,
+            'communication': self._cpp_sys.communication_time,
+        }
+
+        integrator = self.operations.integrator
+        if integrator is not None and integrator._attached:
+            nlists_seen = set()
+            for force in getattr(integrator, 'forces', []):
+                times['forces'] += force._cpp_obj.compute_time
+                nlist = getattr(force, 'nlist', None)
+                if (nlist is not None and nlist._attached
+                        and id(nlist) not in nlists_seen):
+                    nlists_seen.add(id(nlist))
+                    times['neighbor_lists'] += nlist._cpp_obj.compute_time
+        return times
+
     @log
     def final_timestep(self):
         """float: `run` will end at this timestep.
@@ -458,6 +458,65 @@ class Snapshot:
         self._cpp_obj.wrap()
         return self
 
+    def fill_lattice(self, nx, ny, nz=1):
+        """Fill the snapshot with particles on a simple cubic lattice.
+
+        Args:
+            nx (int): Number of unit cells in the x direction.
+            ny (int): Number of unit cells in the y direction.
+            nz (int): Number of unit cells in the z direction.
+
+        Replaces the particle data with ``nx * ny * nz`` particles of type id
+        0, one at the center of each unit cell of a grid spanning the current
+        box. Set ``configuration.box`` before calling. The fill executes as a
+        native bulk operation, avoiding the cost of assembling large
+        configurations element by element in Python.
+
+        Returns:
+            ``self``
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            snapshot.configuration.box = [10, 10, 10, 0, 0, 0]
+            snapshot.fill_lattice(nx=10, ny=10, nz=10)
+        """
+        if self.communicator.rank == 0:
+            self._cpp_obj.fillLattice(nx, ny, nz)
+        return self
+
+    def fill_random(self, N, min_dist=0, seed=0):
+        """Fill the snapshot with randomly placed particles.
+
+        Args:
+            N (int): Number of particles to place.
+            min_dist (float): Minimum allowed distance between any two
+                particles. Defaults to 0 (no restriction).
+            seed (int): Random number seed.
+
+        Replaces the particle data with ``N`` particles of type id 0 placed
+        uniformly at random in the current box. Candidate positions closer
+        than ``min_dist`` to an already placed particle are rejected using a
+        temporary cell grid, so the cost remains linear in ``N``. Set
+        ``configuration.box`` before calling. Raises an error when a particle
+        cannot be placed after many attempts - lower the density or
+        ``min_dist`` in that case.
+
+        Returns:
+            ``self``
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            snapshot.configuration.box = [10, 10, 10, 0, 0, 0]
+            snapshot.fill_random(N=1000, min_dist=0.5, seed=3)
+        """
+        if self.communicator.rank == 0:
+            self._cpp_obj.fillRandom(N, min_dist, seed)
+        return self
+
     def _broadcast_box(self):
         self._cpp_obj._broadcast_box(self.communicator.cpp_mpi_conf)
 
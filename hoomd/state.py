@@ -697,6 +697,36 @@ class State:
                 "another local_snapshot context manager.")
         return LocalSnapshot(self)
 
+    @property
+    def cpu_local_snapshot_read_only(self):
+        """hoomd.data.LocalSnapshot: Expose simulation data on the CPU \
+            read-only.
+
+        Provides the same zero-copy, MPI rank local view as
+        `State.cpu_local_snapshot`, but every exposed array is read-only.
+        Because the buffers are acquired for reading only, accessing them does
+        not invalidate the copy of the data on the GPU: in-situ analysis that
+        only reads the state through this view does not force HOOMD-blue to
+        re-copy the state back to the GPU on the next timestep.
+
+        Use the ``rtag`` arrays (e.g. ``data.particles.rtag``) to map global
+        tags to rank local array indices. To obtain the gathered, tag-sorted
+        global state instead, call `get_snapshot` explicitly.
+
+        .. code-block:: python
+
+            with simulation.state.cpu_local_snapshot_read_only as data:
+                order_parameter = compute(data.particles.position)
+
+        Note:
+            Getting a local snapshot object is order :math:`O(1)`.
+        """
+        if self._in_context_manager:
+            raise RuntimeError(
+                "Cannot enter cpu_local_snapshot_read_only context manager "
+                "inside another local_snapshot context manager.")
+        return LocalSnapshot(self, force_read_only=True)
+
     @property
     def gpu_local_snapshot(self):
         """hoomd.data.LocalSnapshotGPU: Expose simulation data on the GPU.
@@ -756,6 +786,29 @@ class State:
         else:
             return LocalSnapshotGPU(self)
 
+    @property
+    def gpu_local_snapshot_read_only(self):
+        """hoomd.data.LocalSnapshotGPU: Expose simulation data on the GPU \
+            read-only.
+
+        Provides the same zero-copy view as `State.gpu_local_snapshot`, but
+        every exposed array is read-only and the buffers are acquired for
+        reading only. See `State.cpu_local_snapshot_read_only`.
+
+        Warning:
+            This property is only available when running on a GPU (or multiple
+            GPUs).
+        """
+        if not isinstance(self._simulation.device, hoomd.device.GPU):
+            raise RuntimeError(
+                "Cannot access gpu_snapshot with a non GPU device.")
+        elif self._in_context_manager:
+            raise RuntimeError(
+                "Cannot enter gpu_local_snapshot_read_only context manager "
+                "inside another local_snapshot context manager.")
+        else:
+            return LocalSnapshotGPU(self, force_read_only=True)
+
     def thermalize_particle_momenta(self, filter, kT):
         """Assign random values to particle momenta.
 
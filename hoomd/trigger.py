@@ -81,6 +81,22 @@ class Trigger(_hoomd.Trigger):
 
             Returns:
                 bool: `True` when the trigger is active, `False` when it is not.
+
+        next_step(timestep):
+            Report the next timestep at which the trigger may be active.
+
+            Args:
+                timestep (int): The first timestep to consider.
+
+            The simulation run loop skips evaluating operations whose triggers
+            cannot be active. The returned value is a lower bound only: the
+            trigger is still evaluated with `compute` when that timestep
+            arrives. The base class returns *timestep*, which keeps the
+            trigger evaluated every step. Override this in subclasses with a
+            known schedule to skip idle steps.
+
+            Returns:
+                int: The next timestep at which `compute` may return `True`.
     """
 
     def __getstate__(self):
@@ -21,6 +21,7 @@ class LoadBalancer(Tuner):
         tolerance (float): Load imbalance tolerance.
         max_iterations (int): Maximum number of iterations to
             attempt in a single step.
+        balance_time (bool): Balance on measured per-rank time when `True`.
 
     `LoadBalancer` adjusts the boundaries of the MPI domains to distribute
     the particle load close to evenly between them. The load imbalance is
@@ -71,6 +72,15 @@ class LoadBalancer(Tuner):
     or to balance once in a short test run and then set the decomposition
     statically in a separate initialization.
 
+    When ``balance_time`` is `True`, `LoadBalancer` weights the particle count
+    of each rank by the wall time the rank spent evaluating forces since the
+    previous balancing step, and equalizes the weighted counts. Use this in
+    systems where the cost per particle varies between ranks (for example,
+    density gradients with a fixed cutoff). The measurement covers the force
+    loop of the MD integrator; on GPU devices it includes only the host-side
+    time and may be less accurate. When no integrator is present or no time
+    has been measured yet, balancing falls back to particle counts.
+
     Balancing is ignored if there is no domain decomposition available (MPI is
     not built or is running on a single rank).
 
@@ -83,6 +93,7 @@ class LoadBalancer(Tuner):
         tolerance (float): Load imbalance tolerance.
         max_iterations (int): Maximum number of iterations to
             attempt in a single step.
+        balance_time (bool): Balance on measured per-rank time when `True`.
     """
 
     def __init__(self,
@@ -91,19 +102,22 @@ class LoadBalancer(Tuner):
                  y=True,
                  z=True,
                  tolerance=1.02,
-                 max_iterations=1):
+                 max_iterations=1,
+                 balance_time=False):
         super().__init__(trigger)
 
         defaults = dict(x=x,
                         y=y,
                         z=z,
                         tolerance=tolerance,
-                        max_iterations=max_iterations)
+                        max_iterations=max_iterations,
+                        balance_time=balance_time)
         load_balancer_params = ParameterDict(x=bool,
                                              y=bool,
                                              z=bool,
                                              max_iterations=int,
-                                             tolerance=float)
+                                             tolerance=float,
+                                             balance_time=bool)
         self._param_dict.update(load_balancer_params)
         self._param_dict.update(defaults)
 
@@ -115,3 +129,8 @@ class LoadBalancer(Tuner):
 
         self._cpp_obj = cpp_cls(self._simulation.state._cpp_sys_def,
                                 self.trigger)
+
+        # supply the per-rank time measurement for balance_time
+        integrator = self._simulation.operations.integrator
+        if integrator is not None and integrator._attached:
+            self._cpp_obj.setIntegrator(integrator._cpp_obj)
@@ -0,0 +1,115 @@
+# Copyright (c) 2009-2023 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Persist tuned kernel parameters across simulations.
+
+Autotuners rescan all kernel launch configurations at the start of every
+process, which costs degraded performance at the beginning of each job. For
+campaigns of many short jobs, save the tuned parameters once with
+`save_kernel_parameters` and warm-start subsequent jobs with
+`load_kernel_parameters` so that steady-state performance is reached within the
+first few steps.
+
+Cached entries are keyed by the operation type, the kernel name, the device
+description, the number of particle types, and the particle count bucketed by
+powers of two. Entries saved with one HOOMD-blue version or on different
+hardware are ignored on load.
+"""
+
+import json
+import os
+
+import hoomd
+
+
+def _operation_key(simulation, operation):
+    """Make the cache key for one operation in a simulation."""
+    cls = type(operation)
+    n_bucket = max(1, simulation.state.N_particles).bit_length()
+    return "|".join((
+        f"{cls.__module__}.{cls.__qualname__}",
+        ";".join(simulation.device.devices),
+        hoomd.version.version,
+        f"ntypes={len(simulation.state.particle_types)}",
+        f"nbucket={n_bucket}",
+    ))
+
+
+def _autotuned_operations(simulation):
+    """Yield every attached operation that exposes kernel parameters."""
+    for operation in simulation.operations:
+        yield operation
+        # integrators hold further autotuned objects that are not scheduled
+        # directly in the operations container
+        for attr in ('forces', 'methods', 'constraints', 'rigid'):
+            value = getattr(operation, attr, None)
+            if value is None:
+                continue
+            if isinstance(value, hoomd.operation.AutotunedObject):
+                yield value
+            else:
+                try:
+                    yield from (v for v in value
+                                if isinstance(v, hoomd.operation.AutotunedObject))
+                except TypeError:
+                    pass
+
+
+def save_kernel_parameters(simulation, filename):
+    """Save tuned kernel parameters from all attached operations to a file.
+
+    Args:
+        simulation (hoomd.Simulation): Simulation with attached operations.
+        filename (str): JSON file to write. Existing entries for other
+            operations, devices, or system sizes are preserved.
+
+    Call after a run long enough for tuning to complete (see
+    `hoomd.operation.AutotunedObject.is_tuning_complete`).
+    """
+    cache = {}
+    if os.path.exists(filename):
+        with open(filename) as f:
+            cache = json.load(f)
+
+    for operation in _autotuned_operations(simulation):
+        if not isinstance(operation, hoomd.operation.AutotunedObject):
+            continue
+        if not operation._attached:
+            continue
+        cache[_operation_key(simulation, operation)] = {
+            name: list(parameter)
+            for name, parameter in operation.kernel_parameters.items()
+        }
+
+    with open(filename, 'w') as f:
+        json.dump(cache, f, indent=2)
+
+
+def load_kernel_parameters(simulation, filename):
+    """Warm-start autotuners from parameters saved by `save_kernel_parameters`.
+
+    Args:
+        simulation (hoomd.Simulation): Simulation with attached operations.
+        filename (str): JSON file written by `save_kernel_parameters`.
+
+    Operations without a matching cache entry keep scanning as usual. Call
+    after the operations are attached, e.g. after ``simulation.run(0)``.
+    """
+    with open(filename) as f:
+        cache = json.load(f)
+
+    for operation in _autotuned_operations(simulation):
+        if not isinstance(operation, hoomd.operation.AutotunedObject):
+            continue
+        if not operation._attached:
+            continue
+        entry = cache.get(_operation_key(simulation, operation))
+        if entry is None:
+            continue
+        current = operation.kernel_parameters
+        parameters = {
+            name: tuple(parameter)
+            for name, parameter in entry.items() if name in current
+        }
+        if parameters:
+            operation.kernel_parameters = parameters
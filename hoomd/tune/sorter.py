@@ -22,6 +22,13 @@ class ParticleSorter(Tuner):
             value of `None` sets ``grid=4096`` in 2D simulations and
             ``grid=256`` in 3D simulations.
 
+        group_molecules (bool): When `True`, keep the constituents of each
+            rigid body or constraint molecule contiguous in memory. Defaults
+            to `False`.
+
+        sort_by_type (bool): When `True`, order particles by type within each
+            grid bin of the space-filling curve. Defaults to `False`.
+
     `ParticleSorter` improves simulation performance by sorting the particles in
     memory along a space-filling curve. This takes particles that are close in
     space and places them close in memory, leading to a higher rate of
@@ -41,7 +48,11 @@ class ParticleSorter(Tuner):
             of the system).
     """
 
-    def __init__(self, trigger=200, grid=None):
+    def __init__(self,
+                 trigger=200,
+                 grid=None,
+                 group_molecules=False,
+                 sort_by_type=False):
         super().__init__(trigger)
         sorter_params = ParameterDict(
             grid=OnlyTypes(int,
@@ -50,6 +61,32 @@ class ParticleSorter(Tuner):
                            allow_none=True))
         self._param_dict.update(sorter_params)
         self.grid = grid
+        self._group_molecules = bool(group_molecules)
+        self._sort_by_type = bool(sort_by_type)
+
+    @property
+    def group_molecules(self):
+        """bool: Whether molecule constituents are kept contiguous in memory.
+
+        Set at construction. When `True`, the sorter places every member of a
+        rigid body or constraint molecule in one contiguous index range at the
+        molecule's position along the space-filling curve, giving the rigid
+        body and constraint kernels coalesced reads of their constituents.
+        """
+        return self._group_molecules
+
+    @property
+    def sort_by_type(self):
+        """bool: Whether particles are ordered by type within each grid bin.
+
+        Set at construction. When `True`, particles that share a grid bin on
+        the space-filling curve sort by type id, so spatially segregated
+        systems form long contiguous runs of each type. Pair kernels then read
+        the same per-type parameters for neighboring particles, improving
+        cache and warp coherence without disturbing the spatial order of the
+        curve.
+        """
+        return self._sort_by_type
 
     @staticmethod
     def _to_power_of_two(value):
@@ -72,3 +109,51 @@ class ParticleSorter(Tuner):
             cpp_cls = getattr(_hoomd, 'SFCPackTuner')
         self._cpp_obj = cpp_cls(self._simulation.state._cpp_sys_def,
                                 self.trigger)
+        if not isinstance(self._simulation.device, hoomd.device.GPU):
+            self._connect_cell_list()
+        if self._group_molecules:
+            self._connect_molecules()
+        if self._sort_by_type:
+            self._cpp_obj.setSortByType(True)
+
+    def _connect_cell_list(self):
+        """Reuse an attached cell-based neighbor list's binned build.
+
+        On CPU devices, the sorter reads the space-filling-curve order directly
+        from a cell list that the neighbor list builds anyway, instead of
+        running its own binning and sorting pass.
+        """
+        integrator = self._simulation.operations.integrator
+        if integrator is None:
+            return
+        try:
+            from hoomd.md.nlist import Cell
+        except ImportError:
+            return
+        for force in getattr(integrator, 'forces', []):
+            nlist = getattr(force, 'nlist', None)
+            if isinstance(nlist, Cell) and nlist._attached:
+                self._cpp_obj.setCellList(nlist._cpp_obj.getCellList())
+                return
+
+    def _connect_molecules(self):
+        """Keep molecule constituents adjacent in memory.
+
+        Reads the per-tag molecule ids from an attached rigid body or
+        constraint force and passes them to the sorter, which keeps the
+        members of each molecule contiguous in index space.
+        """
+        integrator = self._simulation.operations.integrator
+        if integrator is None:
+            return
+        candidates = []
+        rigid = getattr(integrator, 'rigid', None)
+        if rigid is not None:
+            candidates.append(rigid)
+        candidates.extend(getattr(integrator, 'constraints', []))
+        for op in candidates:
+            if op._attached and hasattr(op._cpp_obj, 'getMoleculeTags'):
+                molecule_tags = op._cpp_obj.getMoleculeTags()
+                if len(molecule_tags) > 0:
+                    self._cpp_obj.setMoleculeTags(molecule_tags)
+                    return
@@ -6,6 +6,7 @@
 import hoomd
 import io
 from collections.abc import Iterable, Mapping, MutableMapping
+from contextlib import contextmanager
 
 
 def _to_camel_case(string):
@@ -28,6 +29,50 @@ def _bad_iterable_type(obj):
     return isinstance(obj, (str, dict, io.IOBase))
 
 
+# Counter tracking active trust_validated_data contexts (supports nesting).
+_trust_level = 0
+
+
+def _is_data_trusted():
+    """Returns True inside a `trust_validated_data` context."""
+    return _trust_level > 0
+
+
+@contextmanager
+def trust_validated_data():
+    """Skip parameter validation within the enclosed block.
+
+    Inside the context, values assigned to operation parameters (e.g.
+    `hoomd.data.typeparam.TypeParameter` entries) are stored and sent to C++
+    as given, without type conversion, processing, or completeness checks.
+    Use this to speed up script startup when re-using parameters that were
+    already validated in a previous run, for example a `dict` exported with
+    ``to_base()``:
+
+    .. code-block:: python
+
+        params = lj.params.to_base()  # in a previous, validated run
+        ...
+        with hoomd.util.trust_validated_data():
+            lj.params.update(params)
+
+    The time spent validating parameters grows with the number of type pairs,
+    so the savings are largest for pair potentials with many types.
+
+    Warning:
+        Values set inside the context must be complete (all defaults filled
+        in) and of exactly the types HOOMD would produce by validation.
+        Passing anything else results in undefined behavior, typically an
+        exception at `hoomd.Simulation.run` time.
+    """
+    global _trust_level
+    _trust_level += 1
+    try:
+        yield
+    finally:
+        _trust_level -= 1
+
+
 def _dict_map(dict_, func):
     r"""Perform a recursive map on a nested mapping.
 
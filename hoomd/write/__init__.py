@@ -9,6 +9,12 @@ results to output files or streams:
 * `GSD` and `DCD` save the simulation trajectory to a file.
 * `Burst` provides a sliding window of a simulation trajectory wrote out at
   `Burst.dump` for use in selective high frequency trajectory data.
+* `FrameBuffer` keeps the last frames in an in-memory ring buffer for online
+  analysis without file I/O.
+* `Correlator` accumulates mean squared displacements and velocity
+  autocorrelations in-engine without writing trajectories.
+* `RDF` accumulates the radial distribution function in-engine without
+  writing trajectories.
 * Combine `GSD` with a `hoomd.logging.Logger` to save system properties or
   per-particle calculated results.
 * Use `HDF5Log` to store logged data in HDF5 resizable datasets.
@@ -28,9 +34,12 @@ See Also:
     Tutorial: :doc:`tutorial/02-Logging/00-index`
 """
 
+from hoomd.write.correlate import Correlator
 from hoomd.write.custom_writer import CustomWriter
 from hoomd.write.gsd import GSD
 from hoomd.write.gsd_burst import Burst
+from hoomd.write.frame_buffer import FrameBuffer
 from hoomd.write.dcd import DCD
+from hoomd.write.rdf import RDF
 from hoomd.write.table import Table
 from hoomd.write.hdf5 import HDF5Log
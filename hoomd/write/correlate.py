@@ -0,0 +1,107 @@
+# Copyright (c) 2009-2023 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Streaming correlation functions of single-particle dynamics."""
+
+import numpy
+
+from hoomd import _hoomd
+from hoomd.data.parameterdicts import ParameterDict
+from hoomd.logging import log
+from hoomd.operation import Writer
+
+
+class Correlator(Writer):
+    r"""Accumulate MSD and VACF on the fly with a multiple-tau correlator.
+
+    `Correlator` samples the unwrapped particle positions and velocities each
+    time it triggers and feeds them into a multiple-tau (order-:math:`n`)
+    correlator. The mean squared displacement
+
+    .. math::
+
+        \mathrm{MSD}(\tau) = \left\langle \frac{1}{N} \sum_{i=1}^{N}
+        \left| \vec{r}_i(t + \tau) - \vec{r}_i(t) \right|^2 \right\rangle_t
+
+    and the velocity autocorrelation function
+
+    .. math::
+
+        \mathrm{VACF}(\tau) = \left\langle \frac{1}{N} \sum_{i=1}^{N}
+        \vec{v}_i(t + \tau) \cdot \vec{v}_i(t) \right\rangle_t
+
+    are accumulated as running averages: each correlator level holds
+    ``points_per_level`` samples, and every second sample is averaged pairwise
+    into the next coarser level, so the accessible lag times grow with the run
+    while the state stays at a few kilobytes. This computes dynamic
+    observables in-engine instead of post-processing dumped trajectories.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to sample.
+            Use a `hoomd.trigger.Periodic` trigger; the reported lag times
+            assume periodic sampling.
+        points_per_level (int): Number of correlation points per level. Must
+            be even and at least 4. Defaults to 16.
+        max_levels (int): Maximum number of correlator levels. Defaults to 32.
+
+    The values at short lags are exact; values at lags beyond
+    ``points_per_level`` samples carry the usual multiple-tau pairwise
+    averaging error.
+
+    Example::
+
+        correlator = hoomd.write.Correlator(
+            trigger=hoomd.trigger.Periodic(10))
+        sim.operations.writers.append(correlator)
+        sim.run(1_000_000)
+        msd = correlator.msd
+
+    Note:
+        In MPI parallel execution, the accumulated data is available on rank
+        0 only.
+
+    Attributes:
+        trigger (hoomd.trigger.Trigger): Select the timesteps to sample.
+        points_per_level (int): Number of correlation points per level
+            (read only).
+        max_levels (int): Maximum number of correlator levels (read only).
+    """
+
+    def __init__(self, trigger, points_per_level=16, max_levels=32):
+        super().__init__(trigger)
+        self._param_dict.update(
+            ParameterDict(points_per_level=int(points_per_level),
+                          max_levels=int(max_levels)))
+
+    def _attach_hook(self):
+        self._cpp_obj = _hoomd.MultipleTauCorrelator(
+            self._simulation.state._cpp_sys_def, self.trigger,
+            self.points_per_level, self.max_levels)
+
+    def reset(self):
+        """Discard all accumulated samples."""
+        if self._attached:
+            self._cpp_obj.reset()
+
+    @log(category='sequence', requires_run=True)
+    def lag_times(self):
+        """(*N_lags*,) `numpy.ndarray` of `float`: Lag times in time steps \
+        with accumulated data, in increasing order."""
+        return numpy.array(self._cpp_obj.getLagTimes())
+
+    @log(category='sequence', requires_run=True)
+    def msd(self):
+        r"""(*N_lags*,) `numpy.ndarray` of `float`: Mean squared displacement \
+        :math:`[\mathrm{length}^2]` at each lag time of `lag_times`."""
+        return numpy.array(self._cpp_obj.getMSD())
+
+    @log(category='sequence', requires_run=True)
+    def vacf(self):
+        r"""(*N_lags*,) `numpy.ndarray` of `float`: Velocity autocorrelation \
+        :math:`[\mathrm{velocity}^2]` at each lag time of `lag_times`."""
+        return numpy.array(self._cpp_obj.getVACF())
+
+    @log(requires_run=True)
+    def num_samples(self):
+        """int: Number of samples accumulated so far."""
+        return self._cpp_obj.num_samples
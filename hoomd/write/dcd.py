@@ -71,6 +71,10 @@ class DCD(Writer):
             *unwrap_full* is True.
         angle_z (bool): When True, the particle orientation angle is written to
             the z component
+        async_write (bool): When `True`, unwrap, convert, and write frames on a
+            background I/O thread. The simulation only blocks when the previous
+            frame is still being written. The last frame may be lost on
+            abnormal exits.
     """
 
     def __init__(self,
@@ -90,7 +94,8 @@ class DCD(Writer):
                           overwrite=bool(overwrite),
                           unwrap_full=bool(unwrap_full),
                           unwrap_rigid=bool(unwrap_rigid),
-                          angle_z=bool(angle_z)))
+                          angle_z=bool(angle_z),
+                          async_write=False))
         self.filter = filter
 
     def _attach_hook(self):
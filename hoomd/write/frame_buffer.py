@@ -0,0 +1,97 @@
+# Copyright (c) 2009-2023 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Capture recent trajectory frames in memory."""
+
+from collections import namedtuple
+
+from hoomd import _hoomd
+from hoomd.box import Box
+from hoomd.data.parameterdicts import ParameterDict
+from hoomd.operation import Writer
+
+Frame = namedtuple('Frame', ['timestep', 'box', 'particles'])
+"""A buffered trajectory frame.
+
+Attributes:
+    timestep (int): Time step the frame was captured at.
+    box (hoomd.Box): The global simulation box of the frame.
+    particles: Particle data of the frame. The ``position``, ``velocity``,
+        ``orientation``, and other array properties are numpy views of the
+        buffered memory, valid as long as the frame stays in the buffer.
+"""
+
+
+class FrameBuffer(Writer):
+    r"""Store the last :math:`N` trajectory frames in memory.
+
+    When triggered, `FrameBuffer` captures a frame of the simulation state
+    into an in-memory ring buffer. When the next frame would result in
+    :math:`N + 1` frames being stored, the oldest frame is removed. Frames are
+    accessed by index without any file I/O: the particle arrays of a `Frame`
+    are numpy views of the buffered memory, so online analysis and
+    machine-learning pipelines can consume recent trajectory data without
+    round-tripping through the filesystem.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to store
+            in the buffer.
+        max_frames (int): The maximum number of frames to store. -1 represents
+            no limit. Defaults to -1.
+
+    Example::
+
+        buffer = hoomd.write.FrameBuffer(trigger=hoomd.trigger.Periodic(100),
+                                         max_frames=10)
+        sim.operations.writers.append(buffer)
+        sim.run(1000)
+        positions = buffer[-1].particles.position
+
+    Warning:
+        The array views of a `Frame` are invalidated when the frame is evicted
+        from the buffer. Copy them to keep data past the buffer horizon.
+
+    Note:
+        In MPI parallel execution, the frame data is available on rank 0 only.
+
+    Attributes:
+        trigger (hoomd.trigger.Trigger): Select the timesteps to store in the
+            buffer.
+        max_frames (int): The maximum number of frames to store. -1 represents
+            no limit.
+    """
+
+    def __init__(self, trigger, max_frames=-1):
+        super().__init__(trigger)
+        self._param_dict.update(ParameterDict(max_frames=int(max_frames)))
+
+    def _attach_hook(self):
+        self._cpp_obj = _hoomd.FrameBufferWriter(
+            self._simulation.state._cpp_sys_def, self.trigger, self.max_frames)
+
+    def clear(self):
+        """Remove all frames from the buffer."""
+        if self._attached:
+            self._cpp_obj.clear()
+
+    def __len__(self):
+        """int: The current number of buffered frames."""
+        if self._attached:
+            return len(self._cpp_obj)
+        return 0
+
+    def __getitem__(self, index):
+        """Frame: The buffered frame at ``index`` (0 is the oldest)."""
+        n_frames = len(self)
+        if index < 0:
+            index += n_frames
+        if not 0 <= index < n_frames:
+            raise IndexError("Frame index out of range.")
+        return Frame(timestep=self._cpp_obj.getFrameTimestep(index),
+                     box=Box._from_cpp(self._cpp_obj.getFrameBox(index)),
+                     particles=self._cpp_obj.getFrameSnapshot(index))
+
+    def __iter__(self):
+        """Iterate over the buffered frames, oldest first."""
+        for index in range(len(self)):
+            yield self[index]
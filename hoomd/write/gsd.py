@@ -177,8 +177,36 @@ class GSD(Writer):
         write_diameter (bool): When `False`, do not write
             ``particles/diameter``. Set to `True` to write non-default particle
             diameters.
+        async_write (bool): When `True`, encode and write frames on a
+            background I/O thread. The simulation only blocks when the
+            previous frame is still being written. Buffered frames may be
+            lost on abnormal exits, as with ``maximum_write_buffer_size``.
+        fork_write (bool): When `True`, fork the process on each trigger: the
+            child serializes the frozen copy-on-write state to the file and
+            exits while the simulation continues stepping immediately. Only
+            available on the CPU device in non-MPI simulations, and mutually
+            exclusive with ``async_write`` and ``compress_positions``.
+            Defaults to `False`.
         maximum_write_buffer_size (int): Size (in bytes) to buffer in memory
            before writing to the file.
+        compress_positions (bool): When `True`, write ``particles/position``
+            as fixed-point deltas to the previous frame in a custom
+            ``compression/position`` chunk. `GSD` transparently decodes the
+            chunk when reading, but files written with this option are not
+            readable by external GSD schema tools. Defaults to `False`.
+        compression_precision (float): Quantization step (in distance units)
+            used by ``compress_positions``. Positions are reproduced to
+            within half of this value.
+        normalized_positions (bool): When `True`, write positions as
+            box-normalized 16-bit fractions in a custom
+            ``quantization/position`` chunk instead of
+            ``particles/position``, cutting the position chunk size in half.
+            Each frame is self-contained and supports random access, but the
+            absolute resolution is limited to the box length divided by
+            65535, so this is intended for trajectories that are only
+            visualized and never re-analyzed numerically. Include
+            ``'configuration/box'`` in `dynamic` when the box changes so that
+            viewers can rescale the fractions. Defaults to `False`.
     """
 
     def __init__(self,
@@ -222,7 +250,12 @@ class GSD(Writer):
                           truncate=bool(truncate),
                           dynamic=[dynamic_validation],
                           write_diameter=False,
+                          async_write=False,
+                          fork_write=False,
                           maximum_write_buffer_size=64 * 1024 * 1024,
+                          compress_positions=False,
+                          compression_precision=1e-4,
+                          normalized_positions=False,
                           _defaults=dict(filter=filter, dynamic=dynamic)))
 
         self._logger = None if logger is None else _GSDLogWriter(logger)
@@ -67,7 +67,8 @@ class _HDF5LogInternal(custom._InternalAction):
     """A HDF5 HOOMD logging backend."""
 
     _skip_for_equality = custom._InternalAction._skip_for_equality | {
-        "_fh", "_attached_"
+        "_fh", "_attached_", "_sim", "_registry", "_metric_keys",
+        "_metric_layout", "_buffers", "_buffered_frames"
     }
 
     flags = (
@@ -106,6 +107,12 @@ class _HDF5LogInternal(custom._InternalAction):
         self._param_dict = param_dict
         self._fh = None
         self._attached_ = False
+        self._sim = None
+        self._registry = None
+        self._metric_keys = []
+        self._metric_layout = None
+        self._buffers = None
+        self._buffered_frames = 0
 
     def _initialize(self, communicator):
         if communicator is None or communicator.rank == 0:
@@ -118,6 +125,7 @@ class _HDF5LogInternal(custom._InternalAction):
     def __del__(self):
         """Closes file upon destruction."""
         if getattr(self, "_fh", None) is not None:
+            self._flush_row_buffers()
             self._fh.close()
 
     def _setattr_param(self, attr, value):
@@ -126,6 +134,9 @@ class _HDF5LogInternal(custom._InternalAction):
 
     def attach(self, simulation):
         self._initialize(simulation.device.communicator)
+        self._sim = simulation
+        self._registry = simulation.state._cpp_sys_def.getMetricRegistry()
+        self._metric_layout = None
         self._attached_ = True
 
     def _attached(self):
@@ -133,30 +144,39 @@ class _HDF5LogInternal(custom._InternalAction):
 
     def detach(self):
         self._attached_ = False
+        self._sim = None
+        self._registry = None
         if self._fh is not None:
+            self._flush_row_buffers()
             self._fh.close()
+        self._buffers = None
 
     def act(self, timestep):
         """Write a new frame of logger data to the HDF5 file."""
         log_dict = util._dict_flatten(self.logger.log())
+        # gather registry metrics on all ranks: collect is collective when the
+        # producing computes reduce over MPI
+        log_dict.update(self._get_metric_dict(timestep))
         if self._fh is None:
             return
         if self._frame == 0:
             self._initialize_datasets(log_dict)
+        if self._buffers is None:
+            self._initialize_row_buffers(log_dict)
         for key, (value, category) in log_dict.items():
             if logging.LoggerCategories[category] in self._reject_categories:
                 continue
             if value is None:
                 continue
             str_key = "/".join(("hoomd-data",) + key)
-            if str_key not in self._fh:
+            if str_key not in self._buffers:
                 raise RuntimeError(
                     "The logged quantities cannot change within a file.")
-            dataset = self._fh[str_key]
-            dataset.resize(self._frame + 1, axis=0)
-            dataset[self._frame, ...] = value
+            self._buffers[str_key][self._buffered_frames, ...] = value
         self._frame += 1
-        self._fh["hoomd-data"].attrs["frames"] = self._frame
+        self._buffered_frames += 1
+        if self._buffered_frames == self._buffer_capacity:
+            self._flush_row_buffers()
 
     @_skip_fh
     def flush(self):
@@ -181,8 +201,50 @@ class _HDF5LogInternal(custom._InternalAction):
                 if hasattr(writer, 'flush'):
                     writer.flush()
         """
+        self._flush_row_buffers()
         self._fh.flush()
 
+    @_skip_fh
+    def _initialize_row_buffers(self, log_dict):
+        """Size one in-memory row buffer per dataset.
+
+        Rows are accumulated in these buffers and written to the file in
+        blocks, since a per-frame resize and single-row write for every
+        quantity dominates the cost of fine-grained logging. The buffers hold
+        one chunk of the smallest-chunked dataset so that the flushed blocks
+        line up with the chunk boundaries of scalar datasets.
+        """
+        capacity = self._SCALAR_CHUNK
+        str_keys = []
+        for key, (value, category) in log_dict.items():
+            if logging.LoggerCategories[category] in self._reject_categories:
+                continue
+            str_key = "/".join(("hoomd-data",) + key)
+            if str_key not in self._fh:
+                raise RuntimeError(
+                    "The logged quantities cannot change within a file.")
+            str_keys.append(str_key)
+            capacity = min(capacity, self._fh[str_key].chunks[0])
+        self._buffer_capacity = capacity
+        self._buffers = {
+            str_key: np.zeros((capacity,) + self._fh[str_key].shape[1:],
+                              dtype=self._fh[str_key].dtype)
+            for str_key in str_keys
+        }
+
+    @_skip_fh
+    def _flush_row_buffers(self):
+        """Append all buffered rows to their datasets."""
+        if getattr(self, "_buffered_frames", 0) == 0:
+            return
+        start = self._frame - self._buffered_frames
+        for str_key, buffer in self._buffers.items():
+            dataset = self._fh[str_key]
+            dataset.resize(self._frame, axis=0)
+            dataset[start:self._frame, ...] = buffer[:self._buffered_frames]
+        self._fh["hoomd-data"].attrs["frames"] = self._frame
+        self._buffered_frames = 0
+
     @_skip_fh
     def _create_dataset(self, key: str, shape, dtype, chunk_size):
         self._fh.create_dataset(
@@ -243,10 +305,33 @@ class _HDF5LogInternal(custom._InternalAction):
             group.attrs["hoomd-schema"] = [0, 1]
             group.attrs["frames"] = 0
 
+    def _get_metric_dict(self, timestep):
+        """Fetch all registry-published metrics with a single call."""
+        if self._registry is None:
+            return {}
+        if self._registry.layout_version != self._metric_layout:
+            self._metric_keys = [
+                tuple(name.split(".")) for name in self._registry.getNames()
+            ]
+            self._metric_layout = self._registry.layout_version
+        if len(self._metric_keys) == 0:
+            return {}
+        if timestep is None:
+            timestep = self._sim.timestep
+        values = self._registry.collect(timestep)
+        return {
+            key: (value, "scalar")
+            for key, value in zip(self._metric_keys, values)
+        }
+
     def __getstate__(self):
         state = copy.copy(self.__dict__)
         del state["_fh"]
+        state.pop("_sim", None)
+        state.pop("_registry", None)
         state["_attached_"] = False
+        state["_buffers"] = None
+        state["_buffered_frames"] = 0
         return state
 
     def __setstate__(self, state):
@@ -0,0 +1,118 @@
+# Copyright (c) 2009-2023 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Online radial distribution function accumulation."""
+
+import numpy
+
+from hoomd import _hoomd
+from hoomd.data.parameterdicts import ParameterDict
+from hoomd.logging import log
+from hoomd.operation import Writer
+
+
+class RDF(Writer):
+    r"""Accumulate the radial distribution function during the run.
+
+    `RDF` histograms all pair distances up to ``r_max`` each time it triggers
+    and keeps a running average of the radial distribution function
+    :math:`g(r)`. The histogram is built with a cell sweep sized to ``r_max``,
+    so each sample costs :math:`O(N)` at liquid densities, and the accumulated
+    :math:`g(r)` is available during the run without dumping trajectory
+    frames. The static structure factor :math:`S(k)` can be computed from the
+    accumulated data with `structure_factor`.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to sample.
+        bins (int): Number of histogram bins.
+        r_max (float): Maximum pair distance to histogram
+            :math:`[\mathrm{length}]`. Must be at most half the smallest box
+            plane separation for the cell sweep to count each pair once.
+
+    Example::
+
+        rdf = hoomd.write.RDF(trigger=hoomd.trigger.Periodic(100),
+                              bins=100,
+                              r_max=3.0)
+        sim.operations.writers.append(rdf)
+        sim.run(10_000)
+        g_r = rdf.rdf
+
+    Note:
+        In MPI parallel execution, the accumulated data is available on rank
+        0 only.
+
+    Attributes:
+        trigger (hoomd.trigger.Trigger): Select the timesteps to sample.
+        bins (int): Number of histogram bins (read only).
+        r_max (float): Maximum pair distance to histogram (read only).
+    """
+
+    def __init__(self, trigger, bins, r_max):
+        super().__init__(trigger)
+        self._param_dict.update(
+            ParameterDict(bins=int(bins), r_max=float(r_max)))
+
+    def _attach_hook(self):
+        self._cpp_obj = _hoomd.RDFAnalyzer(
+            self._simulation.state._cpp_sys_def, self.trigger, self.bins,
+            self.r_max)
+
+    def reset(self):
+        """Discard all accumulated samples."""
+        if self._attached:
+            self._cpp_obj.reset()
+
+    def structure_factor(self, k):
+        r"""Compute the static structure factor from the accumulated g(r).
+
+        Evaluates the Fourier transform of the accumulated radial
+        distribution function
+
+        .. math::
+
+            S(k) = 1 + 4 \pi \rho \int_0^{r_\mathrm{max}} r^2
+            \left( g(r) - 1 \right) \frac{\sin(kr)}{kr} \, dr
+
+        with :math:`\rho` the number density averaged over the accumulated
+        samples. The result is truncated at ``r_max``; choose ``r_max`` large
+        enough that :math:`g(r)` has decayed to 1.
+
+        Args:
+            k (numpy.ndarray): Wavenumbers at which to evaluate
+                :math:`S(k)` :math:`[\mathrm{length}^{-1}]`.
+
+        Returns:
+            numpy.ndarray: :math:`S(k)` at each wavenumber.
+
+        Only valid for 3D simulations.
+        """
+        if self._simulation.state._cpp_sys_def.getNDimensions() != 3:
+            raise RuntimeError(
+                "structure_factor is only implemented for 3D simulations.")
+
+        k = numpy.atleast_1d(numpy.asarray(k, dtype=numpy.float64))
+        r = numpy.array(self._cpp_obj.getBinCenters())
+        g = numpy.array(self._cpp_obj.getRDF())
+        rho = self._cpp_obj.getAverageDensity()
+
+        kr = numpy.outer(k, r)
+        integrand = r * r * (g - 1.0) * numpy.sinc(kr / numpy.pi)
+        return 1.0 + 4.0 * numpy.pi * rho * numpy.trapz(integrand, r, axis=1)
+
+    @log(category='sequence', requires_run=True)
+    def bin_centers(self):
+        r"""(*bins*,) `numpy.ndarray` of `float`: Center of each histogram \
+        bin :math:`[\mathrm{length}]`."""
+        return numpy.array(self._cpp_obj.getBinCenters())
+
+    @log(category='sequence', requires_run=True)
+    def rdf(self):
+        """(*bins*,) `numpy.ndarray` of `float`: Accumulated radial \
+        distribution function at each bin center of `bin_centers`."""
+        return numpy.array(self._cpp_obj.getRDF())
+
+    @log(requires_run=True)
+    def num_samples(self):
+        """int: Number of samples accumulated so far."""
+        return self._cpp_obj.num_samples
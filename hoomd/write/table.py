@@ -183,7 +183,9 @@ class _TableInternal(_InternalAction):
         Action.Flags.EXTERNAL_FIELD_VIRIAL
     ]
 
-    _skip_for_equality = {"_comm"}
+    _skip_for_equality = {
+        "_comm", "_sim", "_registry", "_metric_keys", "_metric_layout"
+    }
 
     def __init__(self,
                  logger,
@@ -237,6 +239,10 @@ class _TableInternal(_InternalAction):
         self._cur_headers_with_width = dict()
         self._fmt = _Formatter(pretty, max_precision)
         self._comm = None
+        self._sim = None
+        self._registry = None
+        self._metric_keys = []
+        self._metric_layout = None
 
     def _setattr_param(self, attr, value):
         """Makes self._param_dict attributes read only."""
@@ -244,9 +250,14 @@ class _TableInternal(_InternalAction):
 
     def attach(self, simulation):
         self._comm = simulation.device._comm
+        self._sim = simulation
+        self._registry = simulation.state._cpp_sys_def.getMetricRegistry()
+        self._metric_layout = None
 
     def detach(self):
         self._comm = None
+        self._sim = None
+        self._registry = None
 
     def _get_log_dict(self):
         """Get a flattened dict for writing to output."""
@@ -255,6 +266,24 @@ class _TableInternal(_InternalAction):
             for key, value in _dict_flatten(self.logger.log()).items()
         }
 
+    def _get_metric_dict(self, timestep):
+        """Fetch all registry-published metrics with a single call."""
+        if self._registry is None:
+            return {}
+        if self._registry.layout_version != self._metric_layout:
+            self._metric_keys = [
+                tuple(name.split('.')) for name in self._registry.getNames()
+            ]
+            self._metric_layout = self._registry.layout_version
+        if len(self._metric_keys) == 0:
+            return {}
+        if timestep is None:
+            timestep = self._sim.timestep
+        # collect is collective when the producing computes reduce over MPI:
+        # call it on all ranks before doing any rank 0 only work.
+        values = self._registry.collect(timestep)
+        return dict(zip(self._metric_keys, values))
+
     def _update_headers(self, new_keys):
         """Update headers and write the current headers to output.
 
@@ -307,6 +336,7 @@ class _TableInternal(_InternalAction):
         changed.
         """
         output_dict = self._get_log_dict()
+        output_dict.update(self._get_metric_dict(timestep))
         if self._comm is not None and self._comm.rank == 0:
             # determine if a header needs to be written. This is always the case
             # for the first call of act, and if the logged quantities change
@@ -323,6 +353,8 @@ class _TableInternal(_InternalAction):
     def __getstate__(self):
         state = copy.copy(self.__dict__)
         state.pop('_comm', None)
+        state.pop('_sim', None)
+        state.pop('_registry', None)
         # This is to handle when the output specified is just stdout. By default
         # file objects like this are not picklable, so we need to handle it
         # differently. We let `None` represent stdout in the state dictionary.